@@ -314,19 +314,15 @@ int tty_close ( struct device* dev, struct filp *file){
     return 0;
 }
 
-int _tty_tiocspgrp ( struct tty_state* tty_data, struct proc* who, ptr_t* ptr){
-    pid_t pgrp;
+int _tty_set_foreground(struct tty_state* tty_data, struct proc* who, pid_t pgrp){
     struct proc* p;
     bool found = false;
-    int ret;
 
     if(tty_data->controlling_session != who->session_id){
         return -ENOTTY;
     }
-    if ((ret = copy_from_user(who, &pgrp, (vptr_t *)*(pid_t **)ptr, sizeof(pid_t))) <= 0)
-        return ret;
-    foreach_proc(p){
-        if(p->procgrp == pgrp && p->session_id == who->session_id){
+    foreach_pgrp_member(p, pgrp){
+        if(p->session_id == who->session_id){
             found = true;
         }
     }
@@ -339,6 +335,44 @@ int _tty_tiocspgrp ( struct tty_state* tty_data, struct proc* who, ptr_t* ptr){
     return 0;
 }
 
+int _tty_tiocspgrp ( struct tty_state* tty_data, struct proc* who, ptr_t* ptr){
+    pid_t pgrp;
+    int ret;
+
+    if ((ret = copy_from_user(who, &pgrp, (vptr_t *)*(pid_t **)ptr, sizeof(pid_t))) <= 0)
+        return ret;
+    return _tty_set_foreground(tty_data, who, pgrp);
+}
+
+/**
+ * set the foreground process group of the tty opened as file,
+ * used by spawn when the caller is not the process in the group
+ * @param file 
+ * @param who   process in the session of the tty
+ * @param pgrp 
+ * @param prev  set to the previous foreground group
+ * @return int 
+ */
+int tty_set_foreground(struct filp* file, struct proc* who, pid_t pgrp, pid_t* prev){
+    struct tty_state* tty_data;
+
+    if(file->filp_dev != &_tty_dev && file->filp_dev != &_tty2_dev)
+        return -ENOTTY;
+    tty_data = (struct tty_state*)file->filp_dev->private;
+    *prev = tty_data->foreground_group;
+    return _tty_set_foreground(tty_data, who, pgrp);
+}
+
+/**
+ * put back the foreground group replaced by tty_set_foreground(), when
+ * the spawn it was set for fails
+ * @param dev 
+ * @param pgrp 
+ */
+void tty_restore_foreground(struct device* dev, pid_t pgrp){
+    ((struct tty_state*)dev->private)->foreground_group = pgrp;
+}
+
 int tty_ioctl(struct filp* file, int request, ptr_t* stack_ptr){
     int ret = 0;
     int result;
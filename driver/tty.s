@@ -0,0 +1,1609 @@
+.global	tty1_filp
+tty1_filp:
+	.word	0x0
+.global	tty2_filp
+tty2_filp:
+	.word	0x0
+name:
+	.word	L.9
+name2:
+	.word	L.10
+.global	__kputc
+.text
+__kputc:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 4($sp)
+	sw	$13, 4($sp)
+	lw	$13, 4($sp)
+	sw	$13, 2($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.12
+	lw	$13, 2($sp)
+	sgti	$13, $13, 127
+	bnez	$13, L.12
+L.14:
+L.15:
+	lw	$13, 3($sp)
+	lw	$13, 3($13)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.14
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	sw	$12, 0($13)
+	lw	$1, 4($sp)
+	j	L.11
+L.12:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.11:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	__kputs
+__kputs:
+	subui	$sp, $sp, 6
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addu	$7, $0, $0
+	j	L.19
+L.18:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	addui	$12, $13, 1
+	sw	$12, 7($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	__kputc
+	addu	$13, $0, $1
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	seq	$13, $13, $12
+	bnez	$13, L.21
+	addi	$7, $7, 1
+L.21:
+L.19:
+	lw	$13, 7($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.18
+	addu	$1, $0, $7
+L.17:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	kgetc_blocking
+kgetc_blocking:
+	subui	$sp, $sp, 6
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2
+	lw	$13, 0($13)
+	andi	$13, $13, 256
+	seq	$13, $13, $0
+	bnez	$13, L.24
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.23
+L.24:
+L.26:
+	addui	$7, $0, 32
+L.29:
+L.30:
+	addu	$13, $0, $0
+	sw	$13, 5($sp)
+	lhi	$12, 0x7
+	ori	$12, $12, 0x3
+	lw	$12, 0($12)
+	andi	$12, $12, 1
+	sne	$13, $12, $13
+	bnez	$13, L.32
+	subi	$13, $7, 1
+	addu	$7, $0, $13
+	lw	$12, 5($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.29
+L.32:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	is_sigpending
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.33
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffc
+	j	L.23
+L.33:
+L.27:
+	seq	$13, $7, $0
+	bnez	$13, L.26
+	lhi	$13, 0x7
+	ori	$13, $13, 0x1
+	lw	$1, 0($13)
+L.23:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	terminal_backspace
+terminal_backspace:
+	subui	$sp, $sp, 6
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	addui	$13, $13, 48
+	addu	$13, $0, $13
+	sleu	$13, $12, $13
+	bnez	$13, L.36
+	lw	$13, 6($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.38
+	lw	$13, 6($sp)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+L.38:
+	lw	$13, 6($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.40
+	lw	$13, 6($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	jal	__kputc
+L.40:
+L.36:
+L.35:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	clear_terminal_buffer
+clear_terminal_buffer:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	j	L.44
+L.43:
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	jal	terminal_backspace
+L.44:
+	lw	$13, 5($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	addui	$13, $13, 48
+	addu	$13, $0, $13
+	sgtu	$13, $12, $13
+	bnez	$13, L.43
+L.42:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+L.47:
+	.word	0x1b
+	.word	0x5b
+	.word	0x31
+	.word	0x3b
+	.word	0x31
+	.word	0x48
+	.word	0x1b
+	.word	0x5b
+	.word	0x32
+	.word	0x4a
+	.word	0x0
+.global	clear_screen
+.text
+clear_screen:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	la	$13, L.47
+	sw	$13, 1($sp)
+	jal	__kputs
+L.46:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+L.49:
+	.word	0x5c
+	.word	0x30
+	.word	0x33
+	.word	0x33
+	.word	0x5b
+	.word	0x31
+	.word	0x44
+	.word	0x0
+.global	move_cursor
+.text
+move_cursor:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 5($sp)
+	addi	$13, $13, 48
+	sw	$13, L.49+5($0)
+	lw	$13, 6($sp)
+	sw	$13, L.49+6($0)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	la	$13, L.49
+	sw	$13, 1($sp)
+	jal	__kputs
+L.48:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	clear_reader
+clear_reader:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$0, 5($13)
+	lw	$13, 1($sp)
+	sw	$0, 6($13)
+L.52:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	can_return_in_non_canonical
+can_return_in_non_canonical:
+	subui	$sp, $sp, 5
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 5($sp)
+	sw	$13, 4($sp)
+	lw	$12, 12($13)
+	addui	$11, $0, 2
+	and	$12, $12, $11
+	sneu	$13, $12, $0
+	bnez	$13, L.55
+	lw	$13, 4($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	lw	$12, 4($sp)
+	lw	$12, 4($12)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$12, 4($sp)
+	lw	$12, 20($12)
+	addu	$12, $0, $12
+	slt	$13, $13, $12
+	bnez	$13, L.55
+	addui	$7, $0, 1
+	j	L.56
+L.55:
+	addu	$7, $0, $0
+L.56:
+	addu	$1, $0, $7
+L.53:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	tty_exception_handler
+tty_exception_handler:
+	subui	$sp, $sp, 19
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	jal	get_exception_m
+	addu	$13, $0, $1
+	sw	$13, 16($sp)
+	lw	$13, 19($sp)
+	lw	$6, 1($13)
+	lw	$13, 19($sp)
+	addui	$7, $13, 9
+	addui	$13, $7, 5
+	sw	$13, 17($sp)
+	lw	$13, 3($6)
+	sw	$13, 18($sp)
+	lw	$13, 18($sp)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.58
+	lw	$5, 1($6)
+	lw	$13, 0($7)
+	addui	$12, $0, 256
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.60
+	snei	$13, $5, 13
+	bnez	$13, L.60
+	addui	$5, $0, 10
+L.60:
+	snei	$13, $5, 10
+	bnez	$13, L.63
+	addui	$4, $0, 1
+	j	L.64
+L.63:
+	addu	$4, $0, $0
+L.64:
+	sw	$4, 15($sp)
+	lw	$13, 15($sp)
+	sw	$13, 14($sp)
+	lw	$13, 3($7)
+	addui	$12, $0, 1
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.65
+	sw	$0, 13($sp)
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sne	$13, $5, $13
+	bnez	$13, L.67
+	addui	$13, $0, 2
+	sw	$13, 13($sp)
+	j	L.68
+L.67:
+	lw	$13, 17($sp)
+	lw	$13, 10($13)
+	addu	$13, $0, $13
+	sne	$13, $5, $13
+	bnez	$13, L.69
+	addui	$13, $0, 18
+	sw	$13, 13($sp)
+	j	L.70
+L.69:
+	lw	$13, 17($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sne	$13, $5, $13
+	bnez	$13, L.71
+	addui	$13, $0, 3
+	sw	$13, 13($sp)
+L.71:
+L.70:
+L.68:
+	addu	$13, $0, $0
+	sw	$13, 12($sp)
+	lw	$12, 13($sp)
+	seq	$13, $12, $13
+	bnez	$13, L.73
+	lw	$13, 19($sp)
+	lw	$13, 112($13)
+	lw	$12, 12($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.73
+	lw	$13, proc_table($0)
+	sw	$13, 0($sp)
+	lw	$13, 19($sp)
+	lw	$13, 112($13)
+	subu	$13, $0, $13
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	jal	sys_kill
+	j	L.75
+L.73:
+L.65:
+	lw	$13, 3($7)
+	addui	$12, $0, 2
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.76
+	lw	$13, 17($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sne	$13, $5, $13
+	bnez	$13, L.78
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	lw	$13, 3($7)
+	addui	$12, $0, 16
+	and	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	terminal_backspace
+	j	L.75
+L.78:
+	lw	$13, 3($7)
+	addui	$12, $0, 32
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.80
+	lw	$13, 17($sp)
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	sne	$13, $5, $13
+	bnez	$13, L.80
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	lw	$13, 3($7)
+	addui	$12, $0, 16
+	and	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	clear_terminal_buffer
+	j	L.75
+L.80:
+	lw	$13, 17($sp)
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	sne	$13, $5, $13
+	bnez	$13, L.82
+	addui	$13, $0, 1
+	sw	$13, 14($sp)
+L.82:
+L.76:
+	lw	$13, 19($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	sgeu	$13, $12, $13
+	bnez	$13, L.84
+	lw	$13, 3($7)
+	addui	$12, $0, 2
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.89
+	subi	$13, $5, 32
+	addu	$13, $0, $13
+	addui	$12, $0, 95
+	sltu	$13, $13, $12
+	bnez	$13, L.89
+	lw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.86
+L.89:
+	lw	$13, 19($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	sw	$5, 0($12)
+	lw	$13, 3($7)
+	addui	$12, $0, 10
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.90
+	sw	$6, 0($sp)
+	sw	$5, 1($sp)
+	jal	__kputc
+L.90:
+L.86:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	jal	can_return_in_non_canonical
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.85
+	addui	$13, $0, 1
+	sw	$13, 14($sp)
+	j	L.85
+L.84:
+	lw	$13, 0($7)
+	addui	$12, $0, 8192
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.94
+	sw	$6, 0($sp)
+	addui	$13, $0, 7
+	sw	$13, 1($sp)
+	jal	__kputc
+L.94:
+L.85:
+	lw	$13, 19($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	jal	is_sigpending
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.96
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfffc
+	sw	$13, 1($sp)
+	lw	$13, 19($sp)
+	lw	$13, 5($13)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	lw	$13, 16($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	jal	clear_reader
+	j	L.97
+L.96:
+	lw	$13, 19($sp)
+	sw	$13, 13($sp)
+	lw	$12, 5($13)
+	addu	$12, $0, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.98
+	lw	$13, 14($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.101
+	lw	$13, 13($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	lw	$12, 13($sp)
+	lw	$12, 3($12)
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.101
+	lw	$13, 13($sp)
+	lw	$13, 6($13)
+	lw	$13, 1($13)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.98
+L.101:
+	lw	$13, 19($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 12($sp)
+	lw	$13, 19($sp)
+	lw	$12, 7($13)
+	sw	$12, 0($sp)
+	lw	$13, 4($13)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	memcpy
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 19($sp)
+	lw	$13, 5($13)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	lw	$13, 16($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, 19($sp)
+	addui	$12, $13, 48
+	sw	$12, 2($13)
+	lw	$13, 19($sp)
+	addui	$12, $13, 48
+	sw	$12, 4($13)
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	jal	clear_reader
+L.98:
+L.97:
+L.58:
+L.75:
+	sw	$0, 4($6)
+L.57:
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 19
+	jr	$ra
+.global	tty1_handler
+tty1_handler:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	la	$13, tty1_state
+	sw	$13, 0($sp)
+	jal	tty_exception_handler
+L.102:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	tty2_handler
+tty2_handler:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	la	$13, tty2_state
+	sw	$13, 0($sp)
+	jal	tty_exception_handler
+L.103:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	__tty_init
+__tty_init:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	lw	$12, 5($sp)
+	sw	$12, 8($13)
+	lw	$13, 3($sp)
+	addui	$12, $0, 263
+	sw	$12, 2($13)
+	lw	$13, 5($sp)
+	addui	$7, $13, 48
+	sw	$7, 2($13)
+	lw	$13, 5($sp)
+	addui	$12, $7, 63
+	sw	$12, 3($13)
+	lw	$13, 5($sp)
+	lw	$12, 3($sp)
+	sw	$12, 1($13)
+	lw	$13, 5($sp)
+	sw	$7, 4($13)
+	addu	$1, $0, $0
+L.104:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	__tty_read
+__tty_read:
+	subui	$sp, $sp, 10
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, 9($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	sw	$0, 0($13)
+	lw	$13, 10($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$13, $0, $13
+	addu	$6, $0, $13
+	lw	$13, 12($sp)
+	sgeu	$13, $6, $13
+	bnez	$13, L.107
+	addu	$5, $0, $6
+	j	L.108
+L.107:
+	lw	$5, 12($sp)
+L.108:
+	addu	$7, $0, $5
+	sequ	$13, $7, $0
+	bnez	$13, L.109
+	lw	$13, 10($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	sleu	$13, $12, $13
+	bnez	$13, L.109
+	lw	$13, 10($sp)
+	lw	$13, 2($13)
+	sw	$0, 0($13)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	lw	$13, 4($13)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	strlcpy
+	subu	$6, $6, $7
+	lw	$13, 10($sp)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	addu	$12, $7, $12
+	sw	$12, 0($13)
+	sw	$7, 9($sp)
+L.109:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	addui	$12, $0, 3
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	addu	$1, $0, $13
+L.105:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	tty_write_rex
+tty_write_rex:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$7, 5($sp)
+	j	L.113
+L.112:
+	lw	$13, 0($7)
+	sw	$13, 3($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.115
+	lw	$13, 3($sp)
+	sgti	$13, $13, 127
+	bnez	$13, L.115
+L.117:
+L.118:
+	lw	$13, 4($sp)
+	lw	$13, 3($13)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.117
+	lw	$13, 4($sp)
+	lw	$12, 0($7)
+	sw	$12, 0($13)
+L.115:
+	addui	$7, $7, 1
+L.113:
+	lw	$13, 6($sp)
+	addui	$12, $0, 1
+	subu	$12, $13, $12
+	sw	$12, 6($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.112
+	addu	$13, $0, $7
+	lw	$12, 5($sp)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$1, $0, $13
+L.111:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	tty_read
+tty_read:
+	subui	$sp, $sp, 14
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, 14($sp)
+	lw	$7, 11($13)
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 13($sp)
+	lw	$12, 116($13)
+	lw	$11, 113($7)
+	sne	$13, $12, $11
+	bnez	$13, L.123
+	lw	$13, 112($7)
+	lw	$12, 13($sp)
+	lw	$12, 115($12)
+	seq	$13, $13, $12
+	bnez	$13, L.121
+L.123:
+	lw	$13, curr_syscall_caller($0)
+	addui	$13, $13, 143
+	sw	$13, 12($sp)
+	la	$13, L.124
+	sw	$13, 0($sp)
+	lw	$13, curr_syscall_caller($0)
+	lw	$12, 114($13)
+	sw	$12, 1($sp)
+	lw	$12, 116($13)
+	sw	$12, 2($sp)
+	lw	$13, 115($13)
+	sw	$13, 3($sp)
+	lw	$13, 14($sp)
+	lw	$13, 5($13)
+	lw	$13, 0($13)
+	sw	$13, 4($sp)
+	lw	$13, 113($7)
+	sw	$13, 5($sp)
+	lw	$13, 112($7)
+	sw	$13, 6($sp)
+	jal	kwarn
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	addui	$12, $0, 1
+	sequ	$13, $13, $12
+	bnez	$13, L.127
+	lw	$13, curr_syscall_caller($0)
+	addui	$13, $13, 135
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	sigismember
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.125
+L.127:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffb
+	j	L.120
+L.125:
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	send_sig
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1b
+	j	L.120
+L.121:
+	lw	$13, 5($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.128
+	lw	$13, 5($7)
+	lw	$13, 131($13)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.130
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff0
+	j	L.120
+L.130:
+	sw	$7, 0($sp)
+	jal	clear_reader
+L.128:
+	lw	$13, 14($sp)
+	lw	$13, 1($13)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.134
+	sw	$7, 0($sp)
+	jal	can_return_in_non_canonical
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.132
+L.134:
+	sw	$7, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	lw	$13, 16($sp)
+	sw	$13, 2($sp)
+	jal	__tty_read
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.120
+L.132:
+	lw	$13, 15($sp)
+	sw	$13, 7($7)
+	lw	$13, 16($sp)
+	sw	$13, 8($7)
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 5($7)
+	lw	$13, 14($sp)
+	sw	$13, 6($7)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+L.120:
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.global	tty_write
+tty_write:
+	subui	$sp, $sp, 7
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	lw	$13, 11($13)
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	tty_write_rex
+	addu	$13, $0, $1
+	sw	$13, 5($sp)
+	lw	$1, 5($sp)
+L.135:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	tty_open
+tty_open:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	lw	$12, 2($sp)
+	lw	$12, 8($12)
+	sw	$12, 11($13)
+	addu	$1, $0, $0
+L.136:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	tty_close
+tty_close:
+	addu	$1, $0, $0
+L.137:
+	jr	$ra
+.global	_tty_set_foreground
+_tty_set_foreground:
+	subui	$sp, $sp, 5
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	addu	$6, $0, $0
+	lw	$13, 5($sp)
+	lw	$13, 113($13)
+	lw	$12, 6($sp)
+	lw	$12, 116($12)
+	seq	$13, $13, $12
+	bnez	$13, L.139
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe7
+	j	L.138
+L.139:
+	lw	$13, 7($sp)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	lw	$13, pgrp_hash($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff7f
+	addu	$7, $13, $12
+	j	L.144
+L.141:
+	lw	$13, 115($7)
+	lw	$12, 7($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.145
+	lw	$13, 116($7)
+	lw	$12, 6($sp)
+	lw	$12, 116($12)
+	sne	$13, $13, $12
+	bnez	$13, L.147
+	addui	$6, $0, 1
+L.147:
+L.145:
+L.142:
+	lw	$13, 129($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff7f
+	addu	$7, $13, $12
+L.144:
+	addui	$13, $7, 129
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	andi	$12, $12, 63
+	slli	$12, $12, 1
+	la	$11, pgrp_hash
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.141
+	sne	$13, $6, $0
+	bnez	$13, L.149
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.138
+L.149:
+	lw	$13, 5($sp)
+	lw	$12, 7($sp)
+	sw	$12, 112($13)
+	addu	$1, $0, $0
+L.138:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	_tty_tiocspgrp
+_tty_tiocspgrp:
+	subui	$sp, $sp, 8
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 7
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	addui	$13, $0, 1
+	sw	$13, 3($sp)
+	jal	copy_from_user
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	sgt	$13, $13, $0
+	bnez	$13, L.152
+	lw	$1, 6($sp)
+	j	L.151
+L.152:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	_tty_set_foreground
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.151:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	tty_set_foreground
+tty_set_foreground:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	la	$12, _tty_dev
+	addu	$12, $0, $12
+	sequ	$13, $13, $12
+	bnez	$13, L.155
+	la	$13, _tty2_dev
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	sequ	$13, $12, $13
+	bnez	$13, L.155
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe7
+	j	L.154
+L.155:
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	lw	$7, 8($13)
+	lw	$13, 11($sp)
+	lw	$12, 112($7)
+	sw	$12, 0($13)
+	sw	$7, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	_tty_set_foreground
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.154:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	tty_restore_foreground
+tty_restore_foreground:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$13, 8($13)
+	lw	$12, 3($sp)
+	sw	$12, 112($13)
+L.157:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	tty_ioctl
+tty_ioctl:
+	subui	$sp, $sp, 15
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	sw	$0, 14($sp)
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 12($sp)
+	lw	$13, 15($sp)
+	lw	$13, 5($13)
+	lw	$13, 8($13)
+	sw	$13, 13($sp)
+	lw	$13, 16($sp)
+	sw	$13, 10($sp)
+	seqi	$13, $13, 11
+	bnez	$13, L.167
+	addui	$13, $0, 12
+	sw	$13, 9($sp)
+	lw	$12, 10($sp)
+	seq	$13, $12, $13
+	bnez	$13, L.168
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	sgt	$13, $13, $12
+	bnez	$13, L.180
+L.179:
+	lw	$13, 16($sp)
+	sw	$13, 8($sp)
+	seqi	$13, $13, 1
+	bnez	$13, L.161
+	lw	$13, 8($sp)
+	seqi	$13, $13, 2
+	bnez	$13, L.164
+	j	L.159
+L.180:
+	lw	$13, 16($sp)
+	sw	$13, 7($sp)
+	seqi	$13, $13, 18
+	bnez	$13, L.169
+	lw	$13, 7($sp)
+	seqi	$13, $13, 19
+	bnez	$13, L.174
+	j	L.159
+L.161:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	addui	$13, $13, 9
+	sw	$13, 2($sp)
+	addui	$13, $0, 39
+	sw	$13, 3($sp)
+	jal	copy_to_user
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	lw	$13, 11($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.160
+	lw	$1, 11($sp)
+	j	L.158
+L.164:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	addui	$13, $13, 9
+	sw	$13, 1($sp)
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	addui	$13, $0, 39
+	sw	$13, 3($sp)
+	jal	copy_from_user
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	lw	$13, 11($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.160
+	lw	$1, 11($sp)
+	j	L.158
+L.167:
+	lw	$13, 17($sp)
+	lw	$12, 13($sp)
+	lw	$12, 112($12)
+	sw	$12, 0($13)
+	j	L.160
+L.168:
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 17($sp)
+	sw	$13, 2($sp)
+	jal	_tty_tiocspgrp
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.158
+L.169:
+	lw	$13, 12($sp)
+	lw	$12, 116($13)
+	lw	$13, 114($13)
+	seq	$13, $12, $13
+	bnez	$13, L.170
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.158
+L.170:
+	lw	$13, 13($sp)
+	lw	$13, 113($13)
+	seq	$13, $13, $0
+	bnez	$13, L.172
+	lw	$13, 12($sp)
+	lw	$13, 110($13)
+	sequ	$13, $13, $0
+	bnez	$13, L.172
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.158
+L.172:
+	lw	$13, 13($sp)
+	lw	$12, 12($sp)
+	lw	$12, 116($12)
+	sw	$12, 113($13)
+	j	L.160
+L.174:
+	lw	$13, 12($sp)
+	lw	$12, 116($13)
+	lw	$13, 114($13)
+	seq	$13, $12, $13
+	bnez	$13, L.175
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.158
+L.175:
+	lw	$13, 13($sp)
+	lw	$13, 112($13)
+	seq	$13, $13, $0
+	bnez	$13, L.177
+	lw	$13, proc_table($0)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	lw	$13, 112($13)
+	subu	$13, $0, $13
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	sys_kill
+L.177:
+	lw	$13, 13($sp)
+	sw	$0, 112($13)
+	lw	$13, 13($sp)
+	sw	$0, 113($13)
+	j	L.160
+L.159:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.158
+L.160:
+	lw	$1, 14($sp)
+L.158:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	tty_dev_init
+tty_dev_init:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 8
+	sw	$13, 0($sp)
+	la	$13, tty1_handler
+	sw	$13, 1($sp)
+	jal	register_irq
+	lhi	$13, 0x7
+	ori	$13, $13, 0x0
+	sw	$13, 0($sp)
+	la	$13, _tty_dev
+	sw	$13, 1($sp)
+	la	$13, tty1_state
+	sw	$13, 2($sp)
+	jal	__tty_init
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.181:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	tty_dev_io_read
+tty_dev_io_read:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, tty1_state
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	__tty_read
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.182:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	tty_dev_io_write
+tty_dev_io_write:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x0
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	tty_write_rex
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.183:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	tty_dev_release
+tty_dev_release:
+	addu	$1, $0, $0
+L.184:
+	jr	$ra
+.global	tty2_dev_init
+tty2_dev_init:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 9
+	sw	$13, 0($sp)
+	la	$13, tty2_handler
+	sw	$13, 1($sp)
+	jal	register_irq
+	lhi	$13, 0x7
+	ori	$13, $13, 0x1000
+	sw	$13, 0($sp)
+	la	$13, _tty2_dev
+	sw	$13, 1($sp)
+	la	$13, tty2_state
+	sw	$13, 2($sp)
+	jal	__tty_init
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.185:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	tty2_dev_io_read
+tty2_dev_io_read:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, tty2_state
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	__tty_read
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.186:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	tty2_dev_io_write
+tty2_dev_io_write:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x1000
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	tty_write_rex
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.187:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	tty2_dev_release
+tty2_dev_release:
+	addu	$1, $0, $0
+L.188:
+	jr	$ra
+dops:
+	.word	tty_dev_init
+	.word	tty_dev_io_read
+	.word	tty_dev_io_write
+	.word	tty_dev_release
+dops2:
+	.word	tty2_dev_init
+	.word	tty2_dev_io_read
+	.word	tty2_dev_io_write
+	.word	tty2_dev_release
+fops:
+	.word	tty_open
+	.word	tty_read
+	.word	tty_write
+	.word	tty_close
+	.word	tty_ioctl
+.global	init_tty_filp
+.text
+init_tty_filp:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	jal	get_free_filp
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $0, 100
+	sw	$13, 2($7)
+	lw	$13, 5($sp)
+	sw	$13, 5($7)
+	lw	$13, 6($sp)
+	lw	$12, 5($sp)
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	sw	$13, 11($7)
+	lw	$13, 4($sp)
+	sw	$7, 0($13)
+L.189:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	init_tty
+init_tty:
+	subui	$sp, $sp, 8
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	la	$13, tty1_filp
+	sw	$13, 0($sp)
+	la	$13, _tty_dev
+	sw	$13, 1($sp)
+	la	$13, tty1_state
+	sw	$13, 2($sp)
+	jal	init_tty_filp
+	la	$13, tty2_filp
+	sw	$13, 0($sp)
+	la	$13, _tty2_dev
+	sw	$13, 1($sp)
+	la	$13, tty2_state
+	sw	$13, 2($sp)
+	jal	init_tty_filp
+	la	$13, _tty_dev
+	sw	$13, 0($sp)
+	lw	$13, name($0)
+	sw	$13, 1($sp)
+	addui	$13, $0, 769
+	sw	$13, 2($sp)
+	addui	$13, $0, 8192
+	sw	$13, 3($sp)
+	la	$13, dops
+	sw	$13, 4($sp)
+	la	$13, fops
+	sw	$13, 5($sp)
+	jal	register_device
+	la	$13, _tty2_dev
+	sw	$13, 0($sp)
+	lw	$13, name2($0)
+	sw	$13, 1($sp)
+	addui	$13, $0, 770
+	sw	$13, 2($sp)
+	addui	$13, $0, 8192
+	sw	$13, 3($sp)
+	la	$13, dops2
+	sw	$13, 4($sp)
+	la	$13, fops
+	sw	$13, 5($sp)
+	jal	register_device
+L.190:
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.bss
+.global	_tty2_dev
+_tty2_dev:
+	.space	9
+.global	_tty_dev
+_tty_dev:
+	.space	9
+.global	tty2_state
+tty2_state:
+	.space	114
+.global	tty1_state
+tty1_state:
+	.space	114
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.124:
+	.asciiz	"tty_read: invalid reader %d session %d pgrp %d, tty %x session %d foreground grp %d\n"
+L.10:
+	.asciiz	"tty2"
+L.9:
+	.asciiz	"tty"
@@ -0,0 +1,658 @@
+.global	visualise_lru
+.text
+visualise_lru:
+	subui	$sp, $sp, 8
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$6, $0, 4
+	lw	$7, lru_cache+1($0)
+	j	L.12
+L.11:
+	addu	$13, $0, $7
+	la	$12, buf_table
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	divi	$13, $13, 8
+	addu	$5, $0, $13
+	la	$13, L.14
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	jal	kprintf
+	lw	$7, 1($7)
+	subi	$6, $6, 1
+L.12:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.15
+	sgt	$13, $6, $0
+	bnez	$13, L.11
+L.15:
+	la	$13, L.16
+	sw	$13, 0($sp)
+	jal	kprintf
+L.9:
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	get_imap
+get_imap:
+	subui	$sp, $sp, 6
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	sw	$13, 5($sp)
+	lw	$13, 5($sp)
+	lw	$13, 12($13)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	sw	$13, 4($sp)
+	lw	$1, 4($sp)
+L.17:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	get_inode_table
+get_inode_table:
+	subui	$sp, $sp, 8
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	lw	$12, 6($7)
+	multu	$13, $13, $12
+	srli	$6, $13, 8
+	slli	$13, $6, 8
+	lw	$12, 15($7)
+	sleu	$13, $13, $12
+	bnez	$13, L.19
+	addu	$1, $0, $0
+	j	L.18
+L.19:
+	lw	$13, 14($7)
+	addu	$13, $13, $6
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$1, 7($sp)
+L.18:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	get_bmap
+get_bmap:
+	subui	$sp, $sp, 6
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	sw	$13, 5($sp)
+	lw	$13, 5($sp)
+	lw	$13, 10($13)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	sw	$13, 4($sp)
+	lw	$1, 4($sp)
+L.21:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	rm_lru
+rm_lru:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.23
+	lw	$13, 2($sp)
+	lw	$12, 1($13)
+	lw	$13, 2($13)
+	sw	$13, 2($12)
+L.23:
+	lw	$13, 2($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.25
+	lw	$13, 2($sp)
+	lw	$12, 2($13)
+	lw	$13, 1($13)
+	sw	$13, 1($12)
+L.25:
+	lw	$13, lru_cache($0)
+	addu	$13, $0, $13
+	lw	$12, 2($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.27
+	lw	$13, 2($sp)
+	lw	$13, 2($13)
+	sw	$13, lru_cache($0)
+L.27:
+	lw	$13, lru_cache+1($0)
+	addu	$13, $0, $13
+	lw	$12, 2($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.29
+	lw	$13, 2($sp)
+	lw	$13, 1($13)
+	sw	$13, lru_cache+1($0)
+L.29:
+L.22:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	dequeue_buf
+dequeue_buf:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$7, lru_cache($0)
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.34
+	addu	$1, $0, $0
+	j	L.33
+L.34:
+	lw	$13, 2($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.36
+	lw	$13, 2($7)
+	sw	$0, 1($13)
+L.36:
+	addui	$13, $7, 2
+	lw	$12, 0($13)
+	sw	$12, lru_cache($0)
+	sw	$0, 0($13)
+	sw	$0, 1($7)
+	addu	$1, $0, $7
+L.33:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	enqueue_buf
+enqueue_buf:
+	subui	$sp, $sp, 2
+	sw	$7, 0($sp)
+	sw	$13, 1($sp)
+	lw	$7, lru_cache+1($0)
+	lw	$13, 2($sp)
+	sw	$0, 2($13)
+	lw	$13, 2($sp)
+	sw	$7, 1($13)
+	lw	$13, 2($sp)
+	sw	$13, 2($7)
+	lw	$13, 2($sp)
+	sw	$13, lru_cache+1($0)
+L.38:
+	lw	$7, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	flush_all_buffer
+flush_all_buffer:
+	subui	$sp, $sp, 6
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addu	$6, $0, $0
+L.42:
+	slli	$13, $6, 3
+	la	$12, buf_table
+	addu	$7, $13, $12
+	lw	$13, 5($7)
+	seq	$13, $13, $0
+	bnez	$13, L.46
+	sw	$7, 0($sp)
+	lw	$13, 4($7)
+	lw	$13, 7($13)
+	lw	$13, 2($13)
+	jalr	$13
+	sw	$0, 5($7)
+L.46:
+L.43:
+	addi	$6, $6, 1
+	slti	$13, $6, 4
+	bnez	$13, L.42
+	addu	$1, $0, $0
+L.41:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	flush_inode_zones
+flush_inode_zones:
+	subui	$sp, $sp, 8
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addu	$4, $0, $0
+L.49:
+	lw	$13, 8($sp)
+	addui	$13, $13, 8
+	addu	$13, $4, $13
+	lw	$5, 0($13)
+	sequ	$13, $5, $0
+	bnez	$13, L.53
+	addu	$6, $0, $0
+L.55:
+	slli	$13, $6, 3
+	la	$12, buf_table
+	addu	$7, $13, $12
+	lw	$13, 3($7)
+	sneu	$13, $13, $5
+	bnez	$13, L.59
+	lw	$13, 5($7)
+	seq	$13, $13, $0
+	bnez	$13, L.59
+	sw	$7, 0($sp)
+	lw	$13, 4($7)
+	lw	$13, 7($13)
+	lw	$13, 2($13)
+	jalr	$13
+	sw	$0, 5($7)
+L.59:
+L.56:
+	addi	$6, $6, 1
+	slti	$13, $6, 4
+	bnez	$13, L.55
+L.53:
+L.50:
+	addi	$4, $4, 1
+	slti	$13, $4, 8
+	bnez	$13, L.49
+	addu	$1, $0, $0
+L.48:
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	put_block_buffer_immed
+put_block_buffer_immed:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, 3($sp)
+	sw	$13, 0($sp)
+	lw	$13, 4($13)
+	lw	$13, 7($13)
+	lw	$13, 2($13)
+	jalr	$13
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.62
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffb
+	j	L.61
+L.62:
+	lw	$13, 3($sp)
+	sw	$0, 5($13)
+	lw	$13, 3($sp)
+	sw	$13, 0($sp)
+	jal	put_block_buffer
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.61:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	put_block_buffer_dirt
+put_block_buffer_dirt:
+	subui	$sp, $sp, 4
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	addui	$12, $0, 1
+	sw	$12, 5($13)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	jal	put_block_buffer
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.64:
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	put_block_buffer
+put_block_buffer:
+	subui	$sp, $sp, 4
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	jal	enqueue_buf
+	lw	$13, 4($sp)
+	addui	$13, $13, 6
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	lw	$13, 6($13)
+	sgt	$13, $13, $0
+	bnez	$13, L.66
+	lw	$13, 4($sp)
+	sw	$0, 6($13)
+L.66:
+	addu	$1, $0, $0
+L.65:
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	get_block_buffer
+get_block_buffer:
+	subui	$sp, $sp, 10
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addu	$6, $0, $0
+L.69:
+	slli	$13, $6, 3
+	la	$12, buf_table
+	addu	$7, $13, $12
+	lw	$13, 3($7)
+	lw	$12, 10($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.73
+	sw	$7, 0($sp)
+	jal	rm_lru
+	addui	$13, $7, 6
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	addu	$1, $0, $7
+	j	L.68
+L.73:
+L.70:
+	addi	$6, $6, 1
+	slti	$13, $6, 4
+	bnez	$13, L.69
+	jal	dequeue_buf
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.75
+	addu	$1, $0, $0
+	j	L.68
+L.75:
+	lw	$13, 5($7)
+	seq	$13, $13, $0
+	bnez	$13, L.77
+	sw	$7, 0($sp)
+	lw	$13, 4($7)
+	lw	$13, 7($13)
+	lw	$13, 2($13)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sw	$0, 5($7)
+L.77:
+	lw	$13, 4($7)
+	addu	$13, $0, $13
+	sw	$13, 9($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.79
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	lw	$12, 9($sp)
+	sequ	$13, $12, $13
+	bnez	$13, L.79
+	sw	$7, 0($sp)
+	lw	$13, 4($7)
+	lw	$13, 7($13)
+	lw	$13, 3($13)
+	jalr	$13
+	sw	$0, 7($7)
+L.79:
+	lw	$13, 7($7)
+	sne	$13, $13, $0
+	bnez	$13, L.81
+	sw	$7, 0($sp)
+	lw	$13, 11($sp)
+	lw	$13, 7($13)
+	lw	$13, 0($13)
+	jalr	$13
+	addui	$13, $0, 1
+	sw	$13, 7($7)
+L.81:
+	sw	$7, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	lw	$12, 10($sp)
+	sw	$12, 2($sp)
+	lw	$13, 7($13)
+	lw	$13, 1($13)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sgt	$13, $5, $0
+	bnez	$13, L.83
+	la	$13, L.85
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	kwarn
+	sw	$7, 0($sp)
+	lw	$13, 11($sp)
+	lw	$13, 7($13)
+	lw	$13, 3($13)
+	jalr	$13
+	sw	$0, 7($7)
+	sw	$7, 0($sp)
+	jal	enqueue_buf
+	addu	$1, $0, $0
+	j	L.68
+L.83:
+	lw	$13, 10($sp)
+	sw	$13, 3($7)
+	lw	$13, 11($sp)
+	sw	$13, 4($7)
+	addu	$13, $0, $0
+	sw	$13, 1($7)
+	sw	$13, 2($7)
+	sw	$0, 5($7)
+	addui	$13, $0, 1
+	sw	$13, 6($7)
+	addu	$1, $0, $7
+L.68:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	flush_super_block
+flush_super_block:
+	subui	$sp, $sp, 6
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sw	$7, 0($sp)
+	jal	dearch_superblock
+	sw	$7, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 49
+	sw	$13, 2($sp)
+	lw	$13, 6($sp)
+	lw	$13, 5($13)
+	lw	$13, 2($13)
+	jalr	$13
+L.86:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	init_buf
+init_buf:
+	subui	$sp, $sp, 9
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addu	$6, $0, $0
+	addu	$7, $0, $0
+	addu	$5, $0, $0
+	addu	$6, $0, $0
+L.88:
+	slli	$13, $6, 3
+	la	$12, buf_table
+	addu	$7, $13, $12
+	sw	$7, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 8
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.92
+	sw	$7, lru_cache($0)
+	sw	$7, lru_cache+1($0)
+	addu	$13, $0, $0
+	sw	$13, 1($7)
+	sw	$13, 2($7)
+	j	L.93
+L.92:
+	sw	$7, 2($5)
+	sw	$5, 1($7)
+	sw	$7, lru_cache+1($0)
+L.93:
+	addu	$5, $0, $7
+L.89:
+	addi	$6, $6, 1
+	slti	$13, $6, 4
+	bnez	$13, L.88
+L.87:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.bss
+lru_cache:
+	.space	2
+buf_table:
+	.space	32
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.85:
+	.asciiz	"retrieve_block return %d for %d\n"
+L.16:
+	.asciiz	"\n"
+L.14:
+	.asciiz	"%d -> "
@@ -0,0 +1,182 @@
+.global	init_dev
+.text
+init_dev:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+L.10:
+	la	$13, devices_list
+	sw	$13, devices_list($0)
+	sw	$13, devices_list+1($0)
+L.11:
+L.9:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	init_drivers
+init_drivers:
+	subui	$sp, $sp, 6
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, devices_list($0)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffd
+	addu	$7, $13, $12
+	j	L.18
+L.15:
+	lw	$13, 5($7)
+	sw	$13, 5($sp)
+	addu	$12, $0, $0
+	addu	$11, $0, $13
+	sequ	$13, $11, $12
+	bnez	$13, L.19
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $12
+	bnez	$13, L.19
+	lw	$13, 5($7)
+	lw	$13, 0($13)
+	jalr	$13
+L.19:
+L.16:
+	lw	$13, 3($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffd
+	addu	$7, $13, $12
+L.18:
+	addui	$13, $7, 3
+	addu	$13, $0, $13
+	la	$12, devices_list
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.15
+L.14:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	register_device
+register_device:
+	subui	$sp, $sp, 5
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	lw	$12, 6($sp)
+	sw	$12, 1($13)
+	lw	$13, 5($sp)
+	lw	$12, 7($sp)
+	sw	$12, 0($13)
+	lw	$13, 5($sp)
+	lw	$12, 8($sp)
+	sw	$12, 2($13)
+	lw	$13, 5($sp)
+	lw	$12, 9($sp)
+	sw	$12, 5($13)
+	lw	$13, 5($sp)
+	lw	$12, 10($sp)
+	sw	$12, 6($13)
+L.22:
+L.25:
+	lw	$13, 5($sp)
+	addui	$7, $13, 3
+	la	$6, devices_list
+	lw	$5, devices_list($0)
+	sw	$7, 1($5)
+	sw	$5, 0($7)
+	sw	$6, 1($7)
+	sw	$7, 0($6)
+L.26:
+L.23:
+	addu	$1, $0, $0
+L.21:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	get_dev
+get_dev:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, devices_list($0)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffd
+	addu	$7, $13, $12
+	j	L.32
+L.29:
+	lw	$13, 0($7)
+	lw	$12, 3($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.33
+	addu	$1, $0, $7
+	j	L.28
+L.33:
+L.30:
+	lw	$13, 3($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffd
+	addu	$7, $13, $12
+L.32:
+	addui	$13, $7, 3
+	addu	$13, $0, $13
+	la	$12, devices_list
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.29
+	addu	$1, $0, $0
+L.28:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.bss
+.global	devices_list
+devices_list:
+	.space	2
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,212 @@
+.global	get_fd
+.text
+get_fd:
+	subui	$sp, $sp, 3
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$13, 2($sp)
+	addu	$6, $0, $0
+	lw	$7, 4($sp)
+	j	L.13
+L.10:
+	lw	$13, 3($sp)
+	addui	$13, $13, 214
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.14
+	lw	$13, 5($sp)
+	sw	$7, 0($13)
+	addui	$6, $0, 1
+	j	L.12
+L.14:
+L.11:
+	addi	$7, $7, 1
+L.13:
+	slti	$13, $7, 16
+	bnez	$13, L.10
+L.12:
+	sne	$13, $6, $0
+	bnez	$13, L.16
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe8
+	j	L.9
+L.16:
+	lw	$13, 6($sp)
+	sw	$7, 8($13)
+	addu	$1, $0, $0
+L.9:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	init_filp_by_inode
+init_filp_by_inode:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	sw	$12, 3($13)
+	lw	$13, 2($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	lw	$12, 16($12)
+	sw	$12, 5($13)
+	addu	$1, $0, $0
+L.18:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	release_filp
+release_filp:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$0, 2($13)
+	addu	$1, $0, $0
+L.19:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	find_filp
+find_filp:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	addu	$7, $0, $0
+L.21:
+	addui	$13, $0, 12
+	mult	$13, $13, $7
+	lw	$13, fd_table+3($13)
+	addu	$13, $0, $13
+	lw	$12, 3($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.25
+	addui	$13, $0, 12
+	mult	$13, $13, $7
+	la	$12, fd_table
+	addu	$1, $13, $12
+	j	L.20
+L.25:
+L.22:
+	addi	$7, $7, 1
+	slti	$13, $7, 32
+	bnez	$13, L.21
+	addu	$1, $0, $0
+L.20:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	get_free_filp
+get_free_filp:
+	subui	$sp, $sp, 8
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addu	$7, $0, $0
+L.29:
+	addui	$13, $0, 12
+	mult	$13, $13, $7
+	la	$12, fd_table
+	addu	$6, $13, $12
+	lw	$13, 2($6)
+	sne	$13, $13, $0
+	bnez	$13, L.33
+	sw	$6, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 12
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$1, $0, $6
+	j	L.28
+L.33:
+L.30:
+	addi	$7, $7, 1
+	slti	$13, $7, 32
+	bnez	$13, L.29
+	addu	$1, $0, $0
+L.28:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	init_filp
+init_filp:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	addu	$7, $0, $0
+	addu	$7, $0, $0
+L.36:
+	addui	$13, $0, 12
+	mult	$13, $13, $7
+	la	$12, fd_table
+	addu	$6, $13, $12
+	sw	$0, 2($6)
+	sw	$7, 8($6)
+L.37:
+	addi	$7, $7, 1
+	slti	$13, $7, 32
+	bnez	$13, L.36
+L.35:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.bss
+fd_table:
+	.space	384
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,47 @@
+.global	init_fs
+.text
+init_fs:
+	subui	$sp, $sp, 1
+	sw	$ra, 0($sp)
+	jal	init_buf
+	jal	init_inode
+	jal	init_filp
+	jal	init_root_fs
+	jal	init_pipe
+L.9:
+	lw	$ra, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
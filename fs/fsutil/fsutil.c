@@ -9,6 +9,7 @@
 #include <unistd.h>
 #include <argp.h>
 #include <dirent.h>
+#include <limits.h>
 #include <kernel/proc.h>
 #include <winix/welf.h>
 #include <winix/list.h>
@@ -19,6 +20,7 @@
 #include <fs/fs_methods.h>
 #include <bsd/string.h>
 #include "srec_import.h"
+#include "srec_disk.h"
 #include "../mock/mock.h"
 
 /* Program documentation. */
@@ -33,6 +35,10 @@ static struct argp_option options[] = {
         {"output",   'o', "OUTPUT", 0, "Output Path" },
         {"source",   's', "SOURCE", 0, "Source Path" },
         {"unix time",   'u', "UNIX_TIME", 0, "Unix Time" },
+        {"image",   'i', "IMAGE", 0, "Raw Disk Image Output Path" },
+        {"incremental",   'I', 0, 0, "Reuse the previous image, rewriting only changed binaries" },
+        {"blocks",   'n', "BLOCKS", 0, "Disk Size in Blocks" },
+        {"inode ratio",   'r', "RATIO", 0, "Disk Bytes per Inode, 0 for 3% of the Disk" },
         {0}
 };
 
@@ -41,6 +47,9 @@ struct arguments
 {
     char *output_path;
     char *source_path;
+    char *image_path;
+    int incremental;
+    struct fs_geometry geometry;
     int debug;
     int do_unit_test;
     unsigned int unix_time;
@@ -70,6 +79,26 @@ static error_t parse_opt (int key, char *arg, struct argp_state *state)
         case 's':
             arguments->source_path = arg;
             break;
+        case 'i':
+            arguments->image_path = arg;
+            break;
+        case 'I':
+            arguments->incremental = true;
+            break;
+        case 'n':
+            arguments->geometry.disk_size = strtoul(arg, &endptr, 0) * BLOCK_SIZE;
+            if (*endptr || arguments->geometry.disk_size == 0){
+                argp_usage (state);
+                return 1;
+            }
+            break;
+        case 'r':
+            arguments->geometry.inode_ratio = strtoul(arg, &endptr, 0);
+            if (*endptr){
+                argp_usage (state);
+                return 1;
+            }
+            break;
         case 'u':
             arguments->unix_time = arg ? (unsigned int)strtoul(arg, NULL, 10) : 0;
             set_start_unix_time(arguments->unix_time);
@@ -86,205 +115,48 @@ static error_t parse_opt (int key, char *arg, struct argp_state *state)
 static struct argp argp = { options, parse_opt, args_doc, doc };
 
 
+/**
+ * Write the disk as a linkable C file. Only the run length encoded image
+ * is emitted as data, DISK_RAW itself lands in bss and is filled in by
+ * blk_dev_init() at boot
+ */
 void write_disk(char* path){
-    int i;
-    char str2[] = "unsigned int DISK_RAW[] = {\n";
-    char str3[] = "};\n";
-    unsigned int *val = (unsigned int*)DISK_RAW;
+    int i, len;
+    unsigned int *rle;
+    unsigned int disk_words = DISK_RAW_SIZE / sizeof(unsigned int);
     FILE *fp;
 
-//    printf("opening %s\n", path);
-    fp = fopen(path, "w");
-    fprintf(fp, "%s", str2);
+    /* worst case, every record header is followed by a single literal */
+    rle = malloc(disk_words * 2 * sizeof(unsigned int));
+    assert(rle != NULL);
+    len = disk_rle_compress(rle, disk_words * 2, (unsigned int*)DISK_RAW, disk_words);
+    assert(len > 0);
 
-    for(i = 0; i < DISK_SIZE_DWORD; i++){
-        fprintf(fp, "\t0x%08x,\n", *val++);
+    fp = fopen(path, "w");
+    assert(fp != NULL);
+    fprintf(fp, "unsigned int DISK_RAW[%u];\n", disk_words);
+    fprintf(fp, "unsigned int DISK_RAW_SIZE = %u;\n\n", disk_words);
+    fprintf(fp, "unsigned int DISK_RLE_LEN = %d;\n", len);
+    fprintf(fp, "unsigned int DISK_RLE[] = {\n");
+    for(i = 0; i < len; i++){
+        fprintf(fp, "\t0x%08x,\n", rle[i]);
     }
-    fprintf(fp, "%s\n\n", str3);
+    fprintf(fp, "};\n\n");
     fclose(fp);
-}
-
-void combine_srec_binary_debug(struct winix_elf_list* elf_list, struct srec_binary* binary, struct srec_debug* debug){
-    struct winix_elf* elf = &elf_list->elf;
-    elf->binary_pc = binary->binary_pc;
-    // binary_idx is the number of instructions in the binary
-    // one instruction is 4 bytes, 1 word in WRAMP architecture
-    // to convert to bytes, multiply by 4
-    elf->binary_size = binary->binary_idx * sizeof(unsigned int);
-    elf->bss_size = debug->bss_size * sizeof(unsigned int);
-    elf->data_size = debug->data_size * sizeof(unsigned int);
-    elf->text_size = debug->text_size * sizeof(unsigned int);
-    elf->binary_offset = binary->binary_offset * sizeof(unsigned int);
-    elf->magic = WINIX_ELF_MAGIC;
-    elf_list->binary_data = binary->binary_data;
-}
-
-void merge_srec_debug(struct list_head* lists,
-    struct list_head *srec_binary_list, struct list_head *srec_debug_list){
-    struct srec_binary *b1, *b2;
-    struct srec_debug *d1, *d2;
-    char *name;
-    list_for_each_entry_safe(struct srec_binary, b1, b2, srec_binary_list, list){
-        name = b1->name;
-        list_for_each_entry_safe(struct srec_debug, d1, d2, srec_debug_list, list){
-            if(strcmp(name, d1->name) == 0){
-                struct winix_elf_list *elf = malloc(sizeof(struct winix_elf_list));
-                strlcpy(elf->name, b1->name, WINIX_ELF_NAME_LEN);
-                combine_srec_binary_debug(elf, b1, d1);
-                list_add(&elf->list, lists);
-//                printf("found match for %s\n", name);
-                list_del(&b1->list);
-                free(b1);
-                list_del(&d1->list);
-                free(d1);
-            }
-        }
-    }
-}
-
-void debug_super_block(char* str){
-    struct superblock *sb = get_sb(get_dev(ROOT_DEV));
-    printf("in use %d, remaining %d after %s\n", sb->s_block_inuse, sb->s_free_blocks, str);
-}
-
-#define PATH_LEN   (1024)
-
-
-int get_srec_list(struct list_head *srec_list, const char* path, int offset){
-    struct list_head srec_binary_list;
-    struct list_head srec_debug_list;
-    struct dirent *dp;
-    DIR *dfd;
-    char filename_qfd[PATH_LEN] ;
-
-    INIT_LIST_HEAD(&srec_binary_list);
-    INIT_LIST_HEAD(&srec_debug_list);
-    INIT_LIST_HEAD(srec_list);
-
-    if ((dfd = opendir(path)) == NULL)
-    {
-        fprintf(stderr, "Can't open %s\n", path);
-        return 0;
-    }
-
-    while ((dp = readdir(dfd)) != NULL)
-    {
-        if ( dp->d_type == DT_REG )
-        {
-#ifdef __wramp__
-            char *dot = char32_index(dp->d_name, '.');
-#else
-            char *dot = index(dp->d_name, '.');
-#endif
-            char *extension_name = dot + 1;
-            snprintf(filename_qfd, PATH_LEN, "%s/%s", path, dp->d_name);
-
-            if(strcmp(extension_name, "srec") == 0){
-                struct srec_binary *result = malloc(sizeof(struct srec_binary));
-                decode_srec(filename_qfd, offset, result);
-                list_add(&result->list, &srec_binary_list);
-//                printf("srec %s %d %d pc %x\n", result->name, result->binary_offset, result->binary_idx, result->binary_pc);
-            }else if(strcmp(extension_name, "verbose") == 0){
-                struct srec_debug *result = malloc(sizeof(struct srec_debug));
-                decode_srec_debug( filename_qfd, result);
-                list_add(&result->list, &srec_debug_list);
-//                printf("srec debug %s %x %x %x\n", result->name, result->text_size, result->data_size, result->bss_size);
-            }
-        }
-    }
-    merge_srec_debug(srec_list, &srec_binary_list, &srec_debug_list);
-    return 0;
-}
-
-void write_srec_list(struct list_head* lists){
-    static char bin_path[] = "/bin";
-    struct winix_elf_list *pos, *tmp;
-    char path[PATH_LEN];
-    int ret, fd;
-    int elf_size = sizeof(struct winix_elf);
-    int binary_size;
-    ret = sys_mkdir(curr_scheduling_proc, bin_path, 0755);
-    // printf("ret %d\n", ret);
-    assert(ret == 0);
-    list_for_each_entry_safe(struct winix_elf_list, pos, tmp, lists, list){
-        snprintf(path, PATH_LEN, "%s%s%s", bin_path, "/", pos->name);
-//        printf("writing %s %x %x\n", pos->name, pos->binary_data[0], pos->binary_data[1]);
-        fd = sys_creat(curr_scheduling_proc, path, 0755);
-        assert(fd >= 0);
-
-        ret = sys_write(curr_scheduling_proc, fd, &pos->elf, elf_size);
-        assert(ret == elf_size);
-
-        binary_size = pos->elf.binary_size;
-        ret = sys_write(curr_scheduling_proc, fd, pos->binary_data,  binary_size);
-        assert(ret == binary_size);
-
-        ret = sys_lseek(curr_scheduling_proc, fd, elf_size, SEEK_SET);
-        assert(ret == elf_size);
-
-        unsigned int read_buffer[pos->elf.binary_size];
-        ret = sys_read(curr_scheduling_proc, fd, read_buffer, binary_size);
-        assert(ret == binary_size);
-        assert(memcmp(pos->binary_data, read_buffer, binary_size) == 0);
-        
-        ret = sys_close(curr_scheduling_proc, fd);
-        assert(ret == 0);
-
-    }
-}
-
-void verify_srec_with_disk(struct list_head* lists){
-    static char bin_path[] = "/bin";
-    struct winix_elf_list *pos, *tmp;
-    char path[PATH_LEN];
-    int ret, fd;
-    int elf_size = sizeof(struct winix_elf);
-    int binary_size;
-
-    list_for_each_entry_safe(struct winix_elf_list, pos, tmp, lists, list){
-        snprintf(path, PATH_LEN, "%s%s%s", bin_path, "/", pos->name);
-        binary_size = pos->elf.binary_size;
-        struct winix_elf elf;
-
-        fd = sys_open(curr_scheduling_proc, path, 0, 0);
-        assert(fd >= 0);
-
-        ret = sys_read(curr_scheduling_proc, fd, &elf, elf_size);
-        assert(ret == elf_size);
-        assert(memcmp(&elf, &pos->elf, elf_size) == 0);
-
-        unsigned int read_buffer[pos->elf.binary_size];
-        ret = sys_read(curr_scheduling_proc, fd, read_buffer,  binary_size);
-        assert(ret == binary_size);
-        assert(memcmp(read_buffer, pos->binary_data, binary_size) == 0);
-
-        ret = sys_close(curr_scheduling_proc, fd);
-        assert(ret == 0);
-
-        // debug_super_block(pos->name);
-        free(pos->binary_data);
-        free(pos);
-    }
-}
-
-int write_srec_to_disk(char* path, struct arguments* arguments){
-    struct list_head srec_list;
-    int ret;
-
-    if((ret = get_srec_list(&srec_list, path, arguments->offset)))
-        return ret;
-    write_srec_list(&srec_list);
-    verify_srec_with_disk(&srec_list);
-    return 0;
+    free(rle);
 }
 
 
 int main(int argc, char** argv){
     struct arguments arguments;
+    struct list_head manifest;
+    unsigned long long version;
+    bool reused = false;
     memset(&arguments, 0, sizeof(struct arguments));
 
     arguments.debug = false;
     arguments.offset = 2048;
+    arguments.geometry.disk_size = DISK_SIZE;
     argp_parse (&argp, argc, argv, 0, 0, &arguments);
     if( arguments.source_path == NULL && arguments.output_path == NULL ){
         fprintf(stderr,"Format ERROR: source file = NULL\n"
@@ -296,17 +168,37 @@ int main(int argc, char** argv){
 
 
     mock_init_proc();
-    init_disk();
+    if(init_disk_geometry(&arguments.geometry)){
+        fprintf(stderr, "Disk of %zu bytes is too small\n", arguments.geometry.disk_size);
+        return 1;
+    }
+    INIT_LIST_HEAD(&manifest);
+    version = get_fsutil_version("/proc/self/exe");
+    if(arguments.incremental && arguments.image_path){
+        /* fall back to a full build if either the image or its manifest is unusable */
+        if(load_manifest(&manifest, arguments.image_path, version) || load_disk_image(arguments.image_path)){
+            free_manifest(&manifest);
+            init_disk_geometry(&arguments.geometry);
+        }else{
+            reused = true;
+        }
+    }
     init_dev();
     init_fs();
     init_drivers();
+    if(reused)
+        stamp_inodes(get_dev(ROOT_DEV), arguments.unix_time);
 
     if(arguments.source_path && arguments.output_path){
-        write_srec_to_disk(arguments.source_path, &arguments);
+        write_srec_to_disk(arguments.source_path, arguments.offset, arguments.image_path ? &manifest : NULL);
         flush_all_buffer();
         flush_inodes();
         flush_super_block(get_dev(ROOT_DEV));
         write_disk(arguments.output_path);
+        if(arguments.image_path){
+            write_disk_image(arguments.image_path);
+            write_manifest(&manifest, arguments.image_path, version);
+        }
     }
 
 //    do_tests();
@@ -0,0 +1,460 @@
+#define __STDC_WANT_LIB_EXT1__ 1
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <errno.h>
+#include <dirent.h>
+#include <limits.h>
+#include <kernel/proc.h>
+#include <winix/welf.h>
+#include <winix/list.h>
+#include <winix/dev.h>
+#include <fs/common.h>
+#include <fs/cache.h>
+#include <fs/super.h>
+#include <fs/fs_methods.h>
+#include <bsd/string.h>
+#include "srec_import.h"
+#include "srec_disk.h"
+#include "../mock/mock.h"
+
+/**
+ * Write the disk as a raw binary image, one host word per disk word
+ */
+void write_disk_image(char* path){
+    FILE *fp;
+    size_t ret;
+
+    fp = fopen(path, "wb");
+    assert(fp != NULL);
+    ret = fwrite(DISK_RAW, 1, DISK_RAW_SIZE, fp);
+    assert(ret == DISK_RAW_SIZE);
+    fclose(fp);
+}
+
+/**
+ * Load a raw image written by write_disk_image() into DISK_RAW. The image
+ * is only accepted if its geometry matches the one makefs() just laid out,
+ * otherwise the freshly made disk is left untouched
+ */
+int load_disk_image(char* path){
+    struct superblock fresh, *loaded;
+    FILE *fp;
+    size_t ret;
+    char *image;
+    int trailing;
+
+    fp = fopen(path, "rb");
+    if(!fp)
+        return -ENOENT;
+    image = malloc(DISK_RAW_SIZE);
+    assert(image != NULL);
+    ret = fread(image, 1, DISK_RAW_SIZE, fp);
+    trailing = fgetc(fp);
+    fclose(fp);
+
+    memcpy(&fresh, DISK_RAW, sizeof(struct superblock));
+    loaded = (struct superblock*)image;
+    if(ret != DISK_RAW_SIZE || trailing != EOF ||
+        loaded->magic != fresh.magic ||
+        loaded->s_block_size != fresh.s_block_size ||
+        loaded->s_inode_size != fresh.s_inode_size ||
+        loaded->s_blockmapnr != fresh.s_blockmapnr ||
+        loaded->s_blockmap_size != fresh.s_blockmap_size ||
+        loaded->s_inodemapnr != fresh.s_inodemapnr ||
+        loaded->s_inodemap_size != fresh.s_inodemap_size ||
+        loaded->s_inode_tablenr != fresh.s_inode_tablenr ||
+        loaded->s_inode_table_size != fresh.s_inode_table_size){
+        free(image);
+        return -EINVAL;
+    }
+    memcpy(DISK_RAW, image, DISK_RAW_SIZE);
+    free(image);
+    return 0;
+}
+
+/**
+ * The manifest records a content hash for each srec/verbose pair written
+ * into /bin, so an incremental build can tell which binaries changed since
+ * the previous image. It is kept next to the image as "<image>.manifest",
+ * one "name hash" pair per line, after a MANIFEST_VERSION line naming the
+ * fsutil that wrote the image
+ */
+#define FNV_OFFSET_BASIS    (0xcbf29ce484222325ULL)
+#define FNV_PRIME           (0x100000001b3ULL)
+
+unsigned long long hash_file(const char* path, unsigned long long hash){
+    unsigned char buf[BUFSIZ];
+    size_t i, n;
+    FILE *fp = fopen(path, "rb");
+    if(!fp)
+        return hash;
+    while((n = fread(buf, 1, BUFSIZ, fp)) > 0){
+        for(i = 0; i < n; i++){
+            hash ^= buf[i];
+            hash *= FNV_PRIME;
+        }
+    }
+    fclose(fp);
+    return hash;
+}
+
+struct srec_manifest_entry* get_manifest_entry(struct list_head* manifest, const char* name){
+    struct srec_manifest_entry *pos;
+    list_for_each_entry(struct srec_manifest_entry, pos, manifest, list){
+        if(strcmp(pos->name, name) == 0)
+            return pos;
+    }
+    pos = calloc(1, sizeof(struct srec_manifest_entry));
+    assert(pos != NULL);
+    strlcpy(pos->name, name, WINIX_ELF_NAME_LEN);
+    list_add(&pos->list, manifest);
+    return pos;
+}
+
+void manifest_path(char* buf, size_t len, const char* image_path){
+    snprintf(buf, len, "%s.manifest", image_path);
+}
+
+int load_manifest(struct list_head* manifest, const char* image_path, unsigned long long version){
+    char path[PATH_MAX];
+    char name[WINIX_ELF_NAME_LEN];
+    unsigned long long hash;
+    struct srec_manifest_entry *entry;
+    FILE *fp;
+
+    manifest_path(path, PATH_MAX, image_path);
+    fp = fopen(path, "r");
+    if(!fp)
+        return -ENOENT;
+    /* an image written by another fsutil may be laid out differently */
+    if(!version || fscanf(fp, MANIFEST_VERSION " %llx", &hash) != 1 || hash != version){
+        fclose(fp);
+        return -EINVAL;
+    }
+    while(fscanf(fp, "%255s %llx", name, &hash) == 2){
+        entry = get_manifest_entry(manifest, name);
+        entry->old_hash = hash;
+        entry->has_old = true;
+    }
+    fclose(fp);
+    return 0;
+}
+
+void write_manifest(struct list_head* manifest, const char* image_path, unsigned long long version){
+    char path[PATH_MAX];
+    struct srec_manifest_entry *pos;
+    FILE *fp;
+
+    manifest_path(path, PATH_MAX, image_path);
+    fp = fopen(path, "w");
+    assert(fp != NULL);
+    fprintf(fp, MANIFEST_VERSION " %016llx\n", version);
+    list_for_each_entry(struct srec_manifest_entry, pos, manifest, list){
+        if(pos->has_new)
+            fprintf(fp, "%s %016llx\n", pos->name, pos->new_hash);
+    }
+    fclose(fp);
+}
+
+/**
+ * Version of the image format and of the fsutil writing it. Any change to
+ * fsutil or to the file system code built into it changes the version, and
+ * a previous image of another version is not reused. Returns 0 if fsutil
+ * can not be read
+ */
+unsigned long long get_fsutil_version(const char* exe_path){
+    unsigned long long hash = FNV_OFFSET_BASIS;
+    FILE *fp = fopen(exe_path, "rb");
+
+    if(!fp)
+        return 0;
+    fclose(fp);
+    hash ^= FSUTIL_IMAGE_VERSION;
+    hash *= FNV_PRIME;
+    return hash_file(exe_path, hash);
+}
+
+void free_manifest(struct list_head* manifest){
+    struct srec_manifest_entry *pos, *tmp;
+    list_for_each_entry_safe(struct srec_manifest_entry, pos, tmp, manifest, list){
+        list_del(&pos->list);
+        free(pos);
+    }
+}
+
+/**
+ * Hash the srec/verbose pair of the given program, together with the text
+ * offset they are decoded against. Returns true if the previous image
+ * already holds this exact pair
+ */
+bool is_srec_unchanged(struct list_head* manifest, const char* dir, const char* filename, int offset){
+    char name[WINIX_ELF_NAME_LEN];
+    char path[PATH_MAX];
+    char *dot;
+    unsigned long long hash = FNV_OFFSET_BASIS;
+    struct srec_manifest_entry *entry;
+
+    strlcpy(name, filename, WINIX_ELF_NAME_LEN);
+    dot = strrchr(name, '.');
+    if(dot)
+        *dot = '\0';
+    entry = get_manifest_entry(manifest, name);
+    if(!entry->has_new){
+        hash ^= (unsigned int)offset;
+        hash *= FNV_PRIME;
+        snprintf(path, PATH_MAX, "%s/%s.srec", dir, name);
+        hash = hash_file(path, hash);
+        snprintf(path, PATH_MAX, "%s/%s.verbose", dir, name);
+        hash = hash_file(path, hash);
+        entry->new_hash = hash;
+        entry->has_new = true;
+    }
+    return entry->has_old && entry->old_hash == entry->new_hash;
+}
+
+void combine_srec_binary_debug(struct winix_elf_list* elf_list, struct srec_binary* binary, struct srec_debug* debug){
+    struct winix_elf* elf = &elf_list->elf;
+    elf->binary_pc = binary->binary_pc;
+    // binary_idx is the number of instructions in the binary
+    // one instruction is 4 bytes, 1 word in WRAMP architecture
+    // to convert to bytes, multiply by 4
+    elf->binary_size = binary->binary_idx * sizeof(unsigned int);
+    elf->bss_size = debug->bss_size * sizeof(unsigned int);
+    elf->data_size = debug->data_size * sizeof(unsigned int);
+    elf->text_size = debug->text_size * sizeof(unsigned int);
+    elf->binary_offset = binary->binary_offset * sizeof(unsigned int);
+    elf->magic = WINIX_ELF_MAGIC;
+    elf_list->binary_data = binary->binary_data;
+}
+
+void merge_srec_debug(struct list_head* lists,
+    struct list_head *srec_binary_list, struct list_head *srec_debug_list){
+    struct srec_binary *b1, *b2;
+    struct srec_debug *d1, *d2;
+    char *name;
+    list_for_each_entry_safe(struct srec_binary, b1, b2, srec_binary_list, list){
+        name = b1->name;
+        list_for_each_entry_safe(struct srec_debug, d1, d2, srec_debug_list, list){
+            if(strcmp(name, d1->name) == 0){
+                struct winix_elf_list *elf = malloc(sizeof(struct winix_elf_list));
+                strlcpy(elf->name, b1->name, WINIX_ELF_NAME_LEN);
+                combine_srec_binary_debug(elf, b1, d1);
+                list_add(&elf->list, lists);
+//                printf("found match for %s\n", name);
+                list_del(&b1->list);
+                free(b1);
+                list_del(&d1->list);
+                free(d1);
+            }
+        }
+    }
+}
+
+void debug_super_block(char* str){
+    struct superblock *sb = get_sb(get_dev(ROOT_DEV));
+    printf("in use %d, remaining %d after %s\n", sb->s_block_inuse, sb->s_free_blocks, str);
+}
+
+#define PATH_LEN   (1024)
+
+
+/**
+ * Decode every srec and verbose file under path into srec_list. The files
+ * are independent, so they are collected first and decoded in parallel;
+ * the results are then linked in directory order, which keeps the disk
+ * layout identical to a sequential decode
+ */
+int get_srec_list(struct list_head *srec_list, const char* path, int offset, struct list_head* manifest){
+    struct list_head srec_binary_list;
+    struct list_head srec_debug_list;
+    struct dirent *dp;
+    DIR *dfd;
+    struct srec_job *jobs = NULL, *job;
+    int nr_jobs = 0, jobs_size = 0, i;
+
+    INIT_LIST_HEAD(&srec_binary_list);
+    INIT_LIST_HEAD(&srec_debug_list);
+    INIT_LIST_HEAD(srec_list);
+
+    if ((dfd = opendir(path)) == NULL)
+    {
+        fprintf(stderr, "Can't open %s\n", path);
+        return 0;
+    }
+
+    while ((dp = readdir(dfd)) != NULL)
+    {
+        if ( dp->d_type == DT_REG )
+        {
+#ifdef __wramp__
+            char *dot = char32_index(dp->d_name, '.');
+#else
+            char *dot = index(dp->d_name, '.');
+#endif
+            char *extension_name;
+            if(!dot)
+                continue;
+            extension_name = dot + 1;
+            if(strcmp(extension_name, "srec") != 0 && strcmp(extension_name, "verbose") != 0)
+                continue;
+            if(manifest && is_srec_unchanged(manifest, path, dp->d_name, offset))
+                continue;
+
+            if(nr_jobs == jobs_size){
+                jobs_size = jobs_size ? jobs_size * 2 : 64;
+                jobs = realloc(jobs, jobs_size * sizeof(struct srec_job));
+                assert(jobs != NULL);
+            }
+            job = &jobs[nr_jobs++];
+            memset(job, 0, sizeof(struct srec_job));
+            snprintf(job->path, SREC_PATH_LEN, "%s/%s", path, dp->d_name);
+            if(strcmp(extension_name, "srec") == 0){
+                job->binary = malloc(sizeof(struct srec_binary));
+            }else{
+                job->debug = malloc(sizeof(struct srec_debug));
+            }
+        }
+    }
+    closedir(dfd);
+
+    decode_srec_jobs(jobs, nr_jobs, offset, 0);
+    for(i = 0; i < nr_jobs; i++){
+        job = &jobs[i];
+        if(job->binary){
+            list_add(&job->binary->list, &srec_binary_list);
+//            printf("srec %s %d %d pc %x\n", job->binary->name, job->binary->binary_offset, job->binary->binary_idx, job->binary->binary_pc);
+        }else{
+            list_add(&job->debug->list, &srec_debug_list);
+//            printf("srec debug %s %x %x %x\n", job->debug->name, job->debug->text_size, job->debug->data_size, job->debug->bss_size);
+        }
+    }
+    free(jobs);
+    merge_srec_debug(srec_list, &srec_binary_list, &srec_debug_list);
+    return 0;
+}
+
+void write_srec_list(struct list_head* lists){
+    static char bin_path[] = "/bin";
+    struct winix_elf_list *pos, *tmp;
+    char path[PATH_LEN];
+    int ret, fd;
+    int elf_size = sizeof(struct winix_elf);
+    int binary_size;
+    ret = sys_mkdir(curr_scheduling_proc, bin_path, 0755);
+    // printf("ret %d\n", ret);
+    assert(ret == 0 || ret == -EEXIST);
+    list_for_each_entry_safe(struct winix_elf_list, pos, tmp, lists, list){
+        snprintf(path, PATH_LEN, "%s%s%s", bin_path, "/", pos->name);
+//        printf("writing %s %x %x\n", pos->name, pos->binary_data[0], pos->binary_data[1]);
+        ret = sys_unlink(curr_scheduling_proc, path, false);
+        assert(ret == 0 || ret == -ENOENT);
+        fd = sys_creat(curr_scheduling_proc, path, 0755);
+        assert(fd >= 0);
+
+        ret = sys_write(curr_scheduling_proc, fd, &pos->elf, elf_size);
+        assert(ret == elf_size);
+
+        binary_size = pos->elf.binary_size;
+        ret = sys_write(curr_scheduling_proc, fd, pos->binary_data,  binary_size);
+        assert(ret == binary_size);
+
+        ret = sys_lseek(curr_scheduling_proc, fd, elf_size, SEEK_SET);
+        assert(ret == elf_size);
+
+        unsigned int read_buffer[pos->elf.binary_size];
+        ret = sys_read(curr_scheduling_proc, fd, read_buffer, binary_size);
+        assert(ret == binary_size);
+        assert(memcmp(pos->binary_data, read_buffer, binary_size) == 0);
+        
+        ret = sys_close(curr_scheduling_proc, fd);
+        assert(ret == 0);
+
+    }
+}
+
+void verify_srec_with_disk(struct list_head* lists){
+    static char bin_path[] = "/bin";
+    struct winix_elf_list *pos, *tmp;
+    char path[PATH_LEN];
+    int ret, fd;
+    int elf_size = sizeof(struct winix_elf);
+    int binary_size;
+
+    list_for_each_entry_safe(struct winix_elf_list, pos, tmp, lists, list){
+        snprintf(path, PATH_LEN, "%s%s%s", bin_path, "/", pos->name);
+        binary_size = pos->elf.binary_size;
+        struct winix_elf elf;
+
+        fd = sys_open(curr_scheduling_proc, path, 0, 0);
+        assert(fd >= 0);
+
+        ret = sys_read(curr_scheduling_proc, fd, &elf, elf_size);
+        assert(ret == elf_size);
+        assert(memcmp(&elf, &pos->elf, elf_size) == 0);
+
+        unsigned int read_buffer[pos->elf.binary_size];
+        ret = sys_read(curr_scheduling_proc, fd, read_buffer,  binary_size);
+        assert(ret == binary_size);
+        assert(memcmp(read_buffer, pos->binary_data, binary_size) == 0);
+
+        ret = sys_close(curr_scheduling_proc, fd);
+        assert(ret == 0);
+
+        // debug_super_block(pos->name);
+        free(pos->binary_data);
+        free(pos);
+    }
+}
+
+/**
+ * Remove binaries recorded in the previous manifest whose srec no longer exists
+ */
+void remove_stale_srec(struct list_head* manifest){
+    static char bin_path[] = "/bin";
+    struct srec_manifest_entry *pos;
+    char path[PATH_LEN];
+    int ret;
+
+    list_for_each_entry(struct srec_manifest_entry, pos, manifest, list){
+        if(pos->has_old && !pos->has_new){
+            snprintf(path, PATH_LEN, "%s/%s", bin_path, pos->name);
+            ret = sys_unlink(curr_scheduling_proc, path, false);
+            assert(ret == 0 || ret == -ENOENT);
+        }
+    }
+}
+
+/**
+ * Date every inode of a reused image at the given time, as a full build
+ * would have, so that -u is not lost on the binaries left in place
+ */
+void stamp_inodes(struct device* dev, unsigned int now){
+    struct superblock* sb = get_sb(dev);
+    unsigned int num, inodes_nr = sb->s_inode_table_size / sb->s_inode_size;
+    struct inode* ino;
+
+    for(num = 1; num < inodes_nr; num++){
+        if(!is_inode_in_use(num, dev))
+            continue;
+        ino = get_inode(num, dev);
+        assert(ino != NULL);
+        ino->i_atime = ino->i_mtime = ino->i_ctime = now;
+        put_inode(ino, true);
+    }
+}
+
+int write_srec_to_disk(char* path, int offset, struct list_head* manifest){
+    struct list_head srec_list;
+    int ret;
+
+    if((ret = get_srec_list(&srec_list, path, offset, manifest)))
+        return ret;
+    if(manifest)
+        remove_stale_srec(manifest);
+    write_srec_list(&srec_list);
+    verify_srec_with_disk(&srec_list);
+    return 0;
+}
@@ -0,0 +1,33 @@
+#ifndef FS_SREC_DISK_H_
+#define FS_SREC_DISK_H_
+
+#include <stdbool.h>
+#include <winix/list.h>
+#include <winix/welf.h>
+
+/* bump when the layout of the image or of the manifest changes */
+#define FSUTIL_IMAGE_VERSION    (2)
+#define MANIFEST_VERSION        "#version"
+
+struct srec_manifest_entry{
+    char name[WINIX_ELF_NAME_LEN];
+    unsigned long long old_hash;
+    unsigned long long new_hash;
+    bool has_old;
+    bool has_new;
+    struct list_head list;
+};
+
+struct device;
+
+void write_disk_image(char* path);
+int load_disk_image(char* path);
+unsigned long long get_fsutil_version(const char* exe_path);
+int load_manifest(struct list_head* manifest, const char* image_path, unsigned long long version);
+void write_manifest(struct list_head* manifest, const char* image_path, unsigned long long version);
+void free_manifest(struct list_head* manifest);
+bool is_srec_unchanged(struct list_head* manifest, const char* dir, const char* filename, int offset);
+void stamp_inodes(struct device* dev, unsigned int now);
+int write_srec_to_disk(char* path, int offset, struct list_head* manifest);
+
+#endif //FS_SREC_DISK_H_
@@ -1,4 +1,5 @@
 #include <stddef.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -6,13 +7,30 @@
 #include <unistd.h>
 #include <libgen.h>
 #include <argp.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
 #include <winix/welf.h>
 #include <bsd/string.h>
 #include "srec_import.h"
-#include "../mock/mock.h"
 
 #define TO_UPPER_CHAR(c) (c - 32)
 
+/* srec records are at most 255 bytes, i.e. 2 + 2 + 255 * 2 characters */
+#define SREC_MAX_LINE       (516)
+#define SREC_INIT_WORDS     (1024)
+#define SREC_MAX_THREADS    (16)
+
+/* value of every hex digit, anything else decodes as 0 */
+static const unsigned char hex_value[256] = {
+    ['0'] = 0, ['1'] = 1, ['2'] = 2, ['3'] = 3, ['4'] = 4,
+    ['5'] = 5, ['6'] = 6, ['7'] = 7, ['8'] = 8, ['9'] = 9,
+    ['A'] = 10, ['B'] = 11, ['C'] = 12, ['D'] = 13, ['E'] = 14, ['F'] = 15,
+    ['a'] = 10, ['b'] = 11, ['c'] = 12, ['d'] = 13, ['e'] = 14, ['f'] = 15,
+};
+
+#define hex_byte(p)     ((hex_value[(unsigned char)(p)[0]] << 4) | hex_value[(unsigned char)(p)[1]])
+
 void print_srec_result(struct srec_binary* result, char* filename){
     int j;
     printf("unsigned int %s_code[] = {\n", filename);
@@ -34,12 +52,34 @@ char* remove_extension(char *str)
     return mystr;
 }
 
+/**
+ * Map the whole file read only. Returns NULL for an empty or unreadable file
+ */
+static char* map_file(const char* path, size_t* len){
+    char *addr;
+    off_t size;
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return NULL;
+    size = lseek(fd, 0, SEEK_END);
+    if(size <= 0){
+        close(fd);
+        return NULL;
+    }
+    addr = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(addr == MAP_FAILED)
+        return NULL;
+    *len = (size_t)size;
+    return addr;
+}
+
 int srec_add_binary(struct srec_binary* srec_result, unsigned int item){
 //    printf("%ld %x\n", srec_result->binary_idx, item);
     srec_result->binary_data[srec_result->binary_idx] = item;
     srec_result->binary_idx++;
     if(srec_result->binary_idx >= srec_result->binary_size){
-        srec_result->binary_size += 1024;
+        srec_result->binary_size *= 2;
         srec_result->binary_data = realloc(srec_result->binary_data, (size_t)(sizeof(unsigned int) * srec_result->binary_size));
         if(srec_result->binary_data == NULL){
             perror("realloc returned NULL ");
@@ -51,7 +91,7 @@ int srec_add_binary(struct srec_binary* srec_result, unsigned int item){
 
 void init_srec_binary_struct(struct srec_binary* result){
     memset(result, 0, sizeof(struct srec_binary));
-    result->binary_size = 1024;
+    result->binary_size = SREC_INIT_WORDS;
     result->binary_data = (unsigned int*)calloc(result->binary_size, sizeof(unsigned int) );
 }
 
@@ -59,72 +99,85 @@ static char text_size[] = ".text segment size = 0x";
 static char data_size[] = ".data segment size = 0x";
 static char bss_size[] = ".bss segment size = 0x";
 
-int decode_segment_size(unsigned int* val, char* prefix, char* line){
-    int len = (int)strlen(prefix);
-    char *strvalue = &line[len];
-    if(strvalue[strlen(strvalue) - 1] == '\n'){
-        strvalue[strlen(strvalue) - 1] = '\0';
-    }
-    while(*strvalue && *strvalue == '0'){
+int decode_segment_size(unsigned int* val, char* prefix, const char* line, size_t len){
+    size_t prefix_len = strlen(prefix);
+    const char *strvalue = line + prefix_len;
+    const char *end = line + len;
+
+    while(strvalue < end && *strvalue == '0'){
         strvalue++;
     }
-    *val = (unsigned int)hex2int(strvalue, (int)strlen(strvalue));
+    *val = (unsigned int)hex2int((char *)strvalue, (int)(end - strvalue));
 //    printf(" size %s | %d %x\n",  strvalue, *val, *val);
     return 0;
 }
 
+static bool has_prefix(const char* line, size_t len, const char* prefix, size_t prefix_len){
+    return len >= prefix_len && memcmp(line, prefix, prefix_len) == 0;
+}
+
 int decode_srec_debug(char* filepath, struct srec_debug* result){
-    FILE* f = fopen(filepath, "r");
-    char *filename = remove_extension(filepath);
-    char *line;
-    if(!f)
-        return -1;
-    line = malloc(1024);
-    if(!line){
-        fclose(f);
-        return -1;
-    }
+    char *filename;
+    char *addr, *line, *end, *next;
+    size_t size, len;
+
+    memset(result, 0, offsetof(struct srec_debug, list));
+    addr = map_file(filepath, &size);
+    filename = remove_extension(filepath);
     strlcpy(result->name, filename, WINIX_ELF_NAME_LEN);
-    while(fgets(line, 1024, f)){
-        if(strstr(line, text_size)){
-            decode_segment_size(&result->text_size, text_size, line);
+    if(!addr)
+        return -1;
+
+    end = addr + size;
+    for(line = addr; line < end; line = next){
+        next = memchr(line, '\n', (size_t)(end - line));
+        len = next ? (size_t)(next - line) : (size_t)(end - line);
+        next = next ? next + 1 : end;
+
+        /* segment sizes are the only lines that start with '.' */
+        if(*line != '.')
+            continue;
+        if(has_prefix(line, len, text_size, sizeof(text_size) - 1)){
+            decode_segment_size(&result->text_size, text_size, line, len);
         }
-        else if(strstr(line, data_size)){
-            decode_segment_size(&result->data_size, data_size, line);
+        else if(has_prefix(line, len, data_size, sizeof(data_size) - 1)){
+            decode_segment_size(&result->data_size, data_size, line, len);
         }
-        else if(strstr(line, bss_size)){
-            decode_segment_size(&result->bss_size, bss_size, line);
+        else if(has_prefix(line, len, bss_size, sizeof(bss_size) - 1)){
+            decode_segment_size(&result->bss_size, bss_size, line, len);
         }
     }
-    free(line);
+    munmap(addr, size);
     return 0;
 }
 
 int decode_srec(char *path, int offset, struct srec_binary* result)
 {
-    int temp = 0;
-    size_t wordsLoaded = 0;
-    FILE *fp;
-    char *line = NULL;
-    int len = 10240;
     char *filename;
+    char *addr, *line, *end, *next;
+    size_t size, len;
+
     init_srec_binary_struct(result);
-    fp = fopen(path, "r");
-    if (fp == NULL){
+    addr = map_file(path, &size);
+    if (addr == NULL && access(path, R_OK)){
         perror("Path cannot be found ");
         exit(EXIT_FAILURE);
     }
-    line = malloc((unsigned int)len);
     filename = remove_extension(path);
 //    printf("filename is '%s' path = '%s'\n", filename, path);
     strlcpy(result->name, filename, WINIX_ELF_NAME_LEN);
-    while(fgets(line, len, fp)){
-        temp = winix_load_srec_mem_val(line, result);
-        wordsLoaded += (size_t)temp;
-    };
-    free(line);
-
     result->binary_offset = (unsigned int)offset;
+    if(addr == NULL)
+        return 0;
+
+    end = addr + size;
+    for(line = addr; line < end; line = next){
+        next = memchr(line, '\n', (size_t)(end - line));
+        len = next ? (size_t)(next - line) : (size_t)(end - line);
+        next = next ? next + 1 : end;
+        winix_load_srec_mem_val(line, len, result);
+    }
+    munmap(addr, size);
 //    print_srec_result(result, filename);
     return 0;
 }
@@ -138,68 +191,52 @@ void assert(int expression, const char *message)
         abort();
     }
 }
+
 int hex2int(char *a, int len)
 {
     int i;
-    int val = 0;
+    unsigned int val = 0;
 
     for (i = 0; i < len; i++)
     {
-        if (a[i] <= '9')
-        {
-            val += (a[i] - 48) * (1 << (4 * (len - 1 - i)));
-        }
-
-        else if (a[i] <= 'F')
-        {
-            val += (a[i] - 55) * (1 << (4 * (len - 1 - i)));
-        }
-        else if(a[i] <= 'f'){
-            val += (a[i] - 87) * (1 << (4 * (len - 1 - i)));
-        }
+        val = (val << 4) | hex_value[(unsigned char)a[i]];
     }
-
-    return val;
+    return (int)val;
 }
 
-int substring(char *buffer, char *original, int start_index, int length)
-{
-    int i = 0;
-    int count = 0;
-    for (i = start_index; i < length + start_index; i++)
-    {
-        buffer[count] = original[i];
-        count++;
-    }
-    buffer[count] = '\0';
-    return count;
-}
-
-int winix_load_srec_mem_val(char *line, struct srec_binary* result)
+/**
+ * Decode one srec record of len characters, the line does not need to be
+ * NUL terminated. Data records are appended to result, a type 7 record
+ * sets the entry point.
+ *
+ * Returns the number of words loaded, 0 for a malformed record or the
+ * entry point, and -1 for any other record type
+ */
+int winix_load_srec_mem_val(const char *line, size_t len, struct srec_binary* result)
 {
     int wordsLoaded = 0;
-    int index = 0;
-    int checksum = 0;
+    const char *p;
+    unsigned int checksum = 0;
     unsigned char byteCheckSum = 0;
     int recordType = 0;
     int addressLength = 0;
     int byteCount = 0;
-    char buffer[128];
-    int tempBufferCount = 0;
-    int address = 0;
+    unsigned int address = 0;
     unsigned char data[255];
     int readChecksum = 0;
-    size_t memVal = 0;
+    unsigned int memVal = 0;
     int i = 0;
-    int j = 0;
 
-    // printf("%s\r\n",line);
-    // printf("loop %d\n",linecount );
     // Start code, always 'S'
-    if (line[index++] != 'S')
+    if (len < 1 || line[0] != 'S')
     {
         printf("Expection S\n");
-        goto err_end;
+        return 0;
+    }
+    if (len < 4)
+    {
+        printf("record too short\n");
+        return 0;
     }
 
     // Record type, 1 digit, 0-9, defining the data field
@@ -211,7 +248,7 @@ int winix_load_srec_mem_val(char *line, struct srec_binary* result)
     //7: Starting address for the program, 32 bit address
     //8: Starting address for the program, 24 bit address
     //9: Starting address for the program, 16 bit address
-    recordType = line[index++] - '0';
+    recordType = line[1] - '0';
 
     switch (recordType)
     {
@@ -238,69 +275,45 @@ int winix_load_srec_mem_val(char *line, struct srec_binary* result)
 
         default:
             printf("unknown record type\n");
-            goto err_end;
+            return 0;
     }
 
-    tempBufferCount = substring(buffer, line, index, 2);
-    // printf("record value %s, value in base 10: %d,length %d\r\n",buffer,hex2int(buffer,tempBufferCount),tempBufferCount);
-    byteCount = hex2int(buffer, tempBufferCount);
-    index += 2;
+    byteCount = hex_byte(line + 2);
     checksum += byteCount;
-
-    // byteCount = ((int)line[index++])*10 + ((int)line[index++]);
-    // int byteCount = Convert.ToInt32(line.substring(index, 2), 16);
-    // printf("byteCount %d\r\n",byteCount);
+    // every byte counted by byteCount is two characters, checksum included
+    if (byteCount <= addressLength || len < 4 + (size_t)byteCount * 2)
+    {
+        printf("record too short\n");
+        return 0;
+    }
 
     // Address, 4, 6 or 8 hex digits determined by the record type
+    p = line + 4;
     for (i = 0; i < addressLength; i++)
     {
-        tempBufferCount = substring(buffer, line, index + i * 2, 2);
-        // printf("temp unsigned char value %s, value in base 10: %d,length %d\r\n",buffer,hex2int(buffer,tempBufferCount),tempBufferCount);
-        checksum += hex2int(buffer, tempBufferCount);
-        // string ch = line.substring(index + i * 2, 2);
-        // checksum += Convert.ToInt32(ch, 16);
-    }
-    if (addressLength != 0)
-    {
-        tempBufferCount = substring(buffer, line, index, addressLength * 2);
-        // printf("temp address value %s, value in base 10: %d,length %d\r\n",buffer,hex2int(buffer,tempBufferCount),tempBufferCount);
-        address = hex2int(buffer, tempBufferCount);
+        int byte = hex_byte(p);
+        checksum += byte;
+        address = (address << 8) | byte;
+        p += 2;
     }
-
-    // address = Convert.ToInt32(line.substring(index, addressLength * 2), 16);
-    // printf("index %d\n",index );
-    index += addressLength * 2;
-    // printf("index %d\n",index );
     byteCount -= addressLength;
-    // printf("byteCount %d\n",byteCount );
-    // Data, a sequence of bytes.
-    // data.length = 255
 
+    // Data, a sequence of bytes.
     for (i = 0; i < byteCount - 1; i++)
     {
-        tempBufferCount = substring(buffer, line, index, 2);
-        // printf("temp unsigned char value %s, value in base 10: %d,length %d\r\n",buffer,hex2int(buffer,tempBufferCount),tempBufferCount);
-        data[i] = (unsigned char)hex2int(buffer, tempBufferCount);
-        // data[i] = (byte)Convert.ToInt32(line.substring(index, 2), 16);
-        index += 2;
+        data[i] = (unsigned char)hex_byte(p);
         checksum += data[i];
+        p += 2;
     }
 
     // Checksum, two hex digits. Inverted LSB of the sum of values, including unsigned char count, address and all data.
-    // readChecksum = (byte)Convert.ToInt32(line.substring(index, 2), 16);
-
-    tempBufferCount = substring(buffer, line, index, 2);
-    // printf("read checksum value %s, value in base 10: %d,length %d\r\n",buffer,hex2int(buffer,tempBufferCount),tempBufferCount);
-    readChecksum = hex2int(buffer, tempBufferCount);
-    // printf("checksum %d\r\n",checksum );
+    readChecksum = hex_byte(p);
     byteCheckSum = (unsigned char)(checksum & 0xFF);
-    // printf("checksum %d\r\n",byteCheckSum );
     byteCheckSum = (unsigned char)~byteCheckSum;
-    // printf("checksum %d\r\n",byteCheckSum );
     if (readChecksum != byteCheckSum)
     {
         printf("failed checksum\r\n");
-        goto err_end;
+        return 0;
     }
 
     // Put in memory
@@ -309,39 +322,96 @@ int winix_load_srec_mem_val(char *line, struct srec_binary* result)
         printf("Data should only contain full 32-bit words.\n");
     }
 
-    // printf("recordType %d\n", recordType);
-    // printf("%lu\n",(size_t)data[0] );
-    // printf("byteCount %d\n",byteCount );
     switch (recordType)
     {
         case 3: // data intended to be stored in memory.
 
-            for (i = 0; i < byteCount - 1; i += 4)
+            for (i = 0; i + 4 <= byteCount - 1; i += 4)
             {
-                memVal = 0;
-                for (j = i; j < i + 4; j++)
-                {
-
-                    memVal <<= 8;
-                    memVal |= data[j];
-                }
-
+                memVal = ((unsigned int)data[i] << 24) | ((unsigned int)data[i + 1] << 16) |
+                         ((unsigned int)data[i + 2] << 8) | data[i + 3];
                 wordsLoaded++;
-                // memory_values[start_index + wordsLoaded] = memVal;
-//                printf("0x%08x, %08x\n", (unsigned int)memVal, memVal);
                 srec_add_binary(result, memVal);
             }
             break;
 
         case 7: // entry point for the program.
-            result->binary_pc = (unsigned int)address;
+            result->binary_pc = address;
             return 0;
         default:
             return -1;
     }
 
     return wordsLoaded;
-    err_end:
-    return 0;
+}
+
+struct srec_work{
+    struct srec_job *jobs;
+    int nr_jobs;
+    int next;
+    int offset;
+    pthread_mutex_t lock;
+};
+
+static void decode_srec_job(struct srec_job* job, int offset){
+    if(job->binary)
+        job->ret = decode_srec(job->path, offset, job->binary);
+    else
+        job->ret = decode_srec_debug(job->path, job->debug);
+}
 
+static void* srec_worker(void* arg){
+    struct srec_work *work = arg;
+    int i;
+    while(true){
+        pthread_mutex_lock(&work->lock);
+        i = work->next++;
+        pthread_mutex_unlock(&work->lock);
+        if(i >= work->nr_jobs)
+            break;
+        decode_srec_job(&work->jobs[i], work->offset);
+    }
+    return NULL;
+}
+
+/**
+ * Decode a batch of srec and verbose files. Every job is independent, so
+ * they are spread over nr_threads workers; results are stored in the jobs
+ * themselves, which keeps the caller's ordering intact. A nr_threads of 0
+ * uses one worker per online CPU
+ */
+int decode_srec_jobs(struct srec_job* jobs, int nr_jobs, int offset, int nr_threads){
+    pthread_t threads[SREC_MAX_THREADS];
+    struct srec_work work;
+    int i, started = 0;
+
+    if(nr_threads <= 0)
+        nr_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(nr_threads > SREC_MAX_THREADS)
+        nr_threads = SREC_MAX_THREADS;
+    if(nr_threads > nr_jobs)
+        nr_threads = nr_jobs;
+
+    if(nr_threads <= 1){
+        for(i = 0; i < nr_jobs; i++)
+            decode_srec_job(&jobs[i], offset);
+        return 0;
+    }
+
+    work.jobs = jobs;
+    work.nr_jobs = nr_jobs;
+    work.next = 0;
+    work.offset = offset;
+    pthread_mutex_init(&work.lock, NULL);
+    for(i = 0; i < nr_threads; i++){
+        if(pthread_create(&threads[i], NULL, srec_worker, &work))
+            break;
+        started++;
+    }
+    /* the calling thread helps out, so this completes even if no worker started */
+    srec_worker(&work);
+    for(i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+    pthread_mutex_destroy(&work.lock);
+    return 0;
 }
@@ -5,11 +5,21 @@
 #ifndef FS_SREC_IMPORT_H_
 #define FS_SREC_IMPORT_H_
 
+#define SREC_PATH_LEN   (1024)
+
+/* one srec or verbose file to decode, exactly one of binary and debug is set */
+struct srec_job{
+    char path[SREC_PATH_LEN];
+    struct srec_binary *binary;
+    struct srec_debug *debug;
+    int ret;
+};
+
 int decode_srec(char *filename, int offset, struct srec_binary* result);
 void init_srec_binary_struct(struct srec_binary* result);
-int winix_load_srec_words_length(char *line);
-int winix_load_srec_mem_val(char *line, struct srec_binary* result);
+int winix_load_srec_mem_val(const char *line, size_t len, struct srec_binary* result);
 int hex2int(char *a, int len);
 int decode_srec_debug(char* filepath, struct srec_debug* result);
+int decode_srec_jobs(struct srec_job* jobs, int nr_jobs, int offset, int nr_threads);
 
 #endif //FS_SREC_IMPORT_H_
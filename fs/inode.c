@@ -40,7 +40,7 @@ bool is_valid_inode_num(int num, struct device* id){
     unsigned int inodes_nr;
 
     inodes_nr = sb->s_inode_table_size / sb->s_inode_size;
-    return 1 <= num && num <= inodes_nr;
+    return 1 <= num && num < inodes_nr;
 }
 
 bool is_valid_block_num(block_t bnr, struct device* id){
@@ -49,63 +49,80 @@ bool is_valid_block_num(block_t bnr, struct device* id){
     return bnr < total_block;
 }
 
+/**
+ * Bitmaps span as many consecutive blocks as needed, each block covering
+ * BITMAP_BITS_PER_BLOCK blocks or inodes. Get the bitmap block holding bit
+ * num of the map starting at map_nr, and the bit offset within that block
+ */
+static struct block_buffer* get_bitmap_block(block_t map_nr, unsigned int num, int *bit, struct device* id){
+    *bit = num % BITMAP_BITS_PER_BLOCK;
+    return get_block_buffer(map_nr + num / BITMAP_BITS_PER_BLOCK, id);
+}
+
+/**
+ * Find and set the first free bit of the map starting at map_nr and
+ * map_size chars long, bits at or beyond limit are never handed out.
+ * Returns the bit number, or -ENOSPC if the map is full
+ */
+static int alloc_bitmap_bit(block_t map_nr, unsigned int map_size, unsigned int limit, struct device* id){
+    block_t i, map_blocks = map_size / BLOCK_SIZE;
+    struct block_buffer *buf;
+    int free_bit;
+    unsigned int num;
+
+    for(i = 0; i < map_blocks; i++){
+        buf = get_block_buffer(map_nr + i, id);
+        free_bit = bitmap_search_from((unsigned int*)buf->block, BLOCK_SIZE_DWORD, 0, 1);
+        if(free_bit >= 0){
+            num = i * BITMAP_BITS_PER_BLOCK + free_bit;
+            if(num >= limit){
+                put_block_buffer(buf);
+                break;
+            }
+            bitmap_set_bit((unsigned int*)buf->block, BLOCK_SIZE_DWORD, free_bit);
+            put_block_buffer_dirt(buf);
+            return num;
+        }
+        put_block_buffer(buf);
+    }
+    return -ENOSPC;
+}
+
 bool is_inode_in_use(int num, struct device* id){
-    bool ret = false;
+    bool ret;
     struct superblock* sb = get_sb(id);
     struct block_buffer *buf;
-    block_t imap_end;
+    int bit;
 
     if(!is_valid_inode_num(num, id))
         return false;
-    
-    buf = get_block_buffer(sb->s_inodemapnr, id);
-    imap_end = buf->b_blocknr + (sb->s_inodemap_size / BLOCK_SIZE);
 
-    while (buf->b_blocknr < imap_end){
-        ret = is_bit_on((unsigned int*)buf->block, BLOCK_SIZE / sizeof(unsigned int), num);
-        if(ret)
-            goto end;
-        put_block_buffer(buf);
-        buf = get_block_buffer(buf->b_blocknr + 1, id);
-    }
-end:
+    buf = get_bitmap_block(sb->s_inodemapnr, num, &bit, id);
+    ret = is_bit_on((unsigned int*)buf->block, BLOCK_SIZE_DWORD, bit);
     put_block_buffer(buf);
     return ret;
 }
 
 int alloc_block(inode_t *ino, struct device* id){
     struct superblock* sb = get_sb(id);
-    struct block_buffer *bmap = get_block_buffer(sb->s_blockmapnr, id);
-    block_t bmap_end = sb->s_blockmapnr + (sb->s_blockmap_size / BLOCK_SIZE);
-    block_t bnr = bmap->b_blocknr;
-    int free_bit = -1;
-
-    while(bmap->b_blocknr < bmap_end){
-        free_bit = bitmap_search_from((unsigned int*) bmap->block, BLOCK_SIZE_DWORD, 0, 1);
-        if(free_bit > 0){
-            if (!is_valid_block_num(free_bit, id)){
-                return -ENOSPC;
-            }
-            bitmap_set_bit((unsigned int*)bmap->block, BLOCK_SIZE_DWORD, free_bit);
-            sb->s_block_inuse += 1;
-            sb->s_free_blocks -= 1;
-            put_block_buffer_dirt(bmap);
-            // kdebug("alloc_block %d for inode %d\n", free_bit, ino->i_num);
-            return free_bit;
-        }
-        put_block_buffer(bmap);
-        bnr++;
-        bmap = get_block_buffer(bnr, id);
+    unsigned int total_block = sb->s_block_inuse + sb->s_free_blocks;
+    int bnr;
+
+    bnr = alloc_bitmap_bit(sb->s_blockmapnr, sb->s_blockmap_size, total_block, id);
+    if(bnr < 0){
+        kwarn("no free block id found for dev %d", id->dev_id);
+        return bnr;
     }
-    kwarn("no free block id found for dev %d", id->dev_id);
-    put_block_buffer(bmap);
-    return -ENOSPC;
+    sb->s_block_inuse += 1;
+    sb->s_free_blocks -= 1;
+    // kdebug("alloc_block %d for inode %d\n", bnr, ino->i_num);
+    return bnr;
 }
 
 int release_block(block_t bnr, struct device* id){
     struct superblock* sb = get_sb(id);
-    block_t bmap_nr = sb->s_blockmapnr + (bnr / BLOCK_SIZE);
     struct block_buffer *bmap, *block;
+    int bit;
     if(!is_valid_block_num(bnr, id)){
         kwarn("Invalid block id %d\n", bnr);
         return -EINVAL;
@@ -114,12 +131,11 @@ int release_block(block_t bnr, struct device* id){
     memset(block->block, 0, BLOCK_SIZE);
     put_block_buffer_dirt(block);
 
-    bmap = get_block_buffer(bmap_nr, id);
-
-    bitmap_clear_bit((unsigned int*)bmap->block, BLOCK_SIZE_DWORD, bnr);
+    bmap = get_bitmap_block(sb->s_blockmapnr, bnr, &bit, id);
+    bitmap_clear_bit((unsigned int*)bmap->block, BLOCK_SIZE_DWORD, bit);
     sb->s_block_inuse -= 1;
     sb->s_free_blocks += 1;
-    return put_block_buffer(bmap);
+    return put_block_buffer_dirt(bmap);
 }
 
 blkcnt_t get_inode_blocks(struct inode* ino){
@@ -242,32 +258,15 @@ int put_inode(inode_t *inode, bool is_dirty){
 
 inode_t* alloc_inode(struct device* parentdev, struct device* inodev){
     struct superblock* sb;
-    int inum = 0;
-    block_t imap_end = 0, bnr = 0;
-    struct block_buffer *imap;
+    int inum;
     inode_t *inode;
-    bool found = false;
     clock_t unix_time = get_unix_time();
 
     sb = get_sb(parentdev);
-    imap = get_imap(parentdev);
-    imap_end = imap->b_blocknr + (sb->s_blockmap_size / BLOCK_SIZE);
-    while(imap->b_blocknr < imap_end){
-        inum = bitmap_search_from((unsigned int*)imap->block, BLOCK_SIZE_DWORD, 0, 1);
-        if(inum > 0){
-            found = true;
-            break;
-        }
-        put_block_buffer(imap);
-        bnr++;
-        imap = get_block_buffer(bnr, parentdev);
-    }
-    if(!found){
-        put_block_buffer(imap);
+    inum = alloc_bitmap_bit(sb->s_inodemapnr, sb->s_inodemap_size,
+                            sb->s_inode_table_size / sb->s_inode_size, parentdev);
+    if(inum < 0)
         return NULL;
-    }
-    bitmap_set_bit((unsigned int*)imap->block, BLOCK_SIZE_DWORD, inum);
-    put_block_buffer_dirt(imap);
 
     inode = get_free_inode_slot();
     if (!inode)
@@ -311,7 +310,7 @@ int _release_inode(inode_t *inode, bool is_indirect_zone){
     struct superblock* sb = get_sb(id);
     struct block_buffer *imap;
     block_t zone_id;
-    int i = 0;
+    int i = 0, bit;
     if(inode->i_count != 0){
         kwarn("%d is in use before releasing\n", inum);
         return -EINVAL;
@@ -335,9 +334,8 @@ int _release_inode(inode_t *inode, bool is_indirect_zone){
         }
     }
     
-    // assumping inum is smaller than 1024 for simplicity
-    imap = get_block_buffer(sb->s_inode_tablenr, id);
-    bitmap_clear_bit((unsigned int*)imap->block, BLOCK_SIZE_DWORD, inum);
+    imap = get_bitmap_block(sb->s_inodemapnr, inum, &bit, id);
+    bitmap_clear_bit((unsigned int*)imap->block, BLOCK_SIZE_DWORD, bit);
     sb->s_inode_inuse -= 1;
     sb->s_free_inodes += 1;
     put_block_buffer_dirt(imap);
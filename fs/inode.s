@@ -0,0 +1,2209 @@
+.global	get_free_inode_slot
+.text
+get_free_inode_slot:
+	subui	$sp, $sp, 8
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addu	$7, $0, $0
+L.10:
+	addui	$13, $0, 26
+	mult	$13, $13, $7
+	la	$12, inode_table
+	addu	$6, $13, $12
+	lw	$13, 17($6)
+	sne	$13, $13, $0
+	bnez	$13, L.14
+	sw	$6, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 26
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$1, $0, $6
+	j	L.9
+L.14:
+L.11:
+	addi	$7, $7, 1
+	slti	$13, $7, 48
+	bnez	$13, L.10
+	addu	$1, $0, $0
+L.9:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	has_file_access
+has_file_access:
+	subui	$sp, $sp, 5
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 5($sp)
+	lw	$13, 110($13)
+	sneu	$13, $13, $0
+	bnez	$13, L.17
+	addui	$1, $0, 1
+	j	L.16
+L.17:
+	lw	$13, 6($sp)
+	sw	$13, 4($sp)
+	lw	$12, 5($sp)
+	lw	$12, 110($12)
+	lw	$11, 2($13)
+	sneu	$13, $12, $11
+	bnez	$13, L.19
+	lw	$13, 7($sp)
+	slli	$13, $13, 8
+	lw	$12, 4($sp)
+	lw	$12, 0($12)
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.19
+	addui	$1, $0, 1
+	j	L.16
+L.19:
+	lw	$13, 6($sp)
+	sw	$13, 3($sp)
+	lw	$12, 5($sp)
+	lw	$12, 111($12)
+	lw	$11, 3($13)
+	sneu	$13, $12, $11
+	bnez	$13, L.21
+	lw	$13, 7($sp)
+	slli	$13, $13, 4
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.21
+	addui	$1, $0, 1
+	j	L.16
+L.21:
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 0($12)
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.23
+	addui	$1, $0, 1
+	j	L.16
+L.23:
+	addu	$1, $0, $0
+L.16:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	is_valid_inode_num
+is_valid_inode_num:
+	subui	$sp, $sp, 8
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 15($7)
+	lw	$12, 6($7)
+	divu	$13, $13, $12
+	sw	$13, 7($sp)
+	lw	$13, 8($sp)
+	sw	$13, 6($sp)
+	addui	$12, $0, 1
+	sgt	$13, $12, $13
+	bnez	$13, L.27
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	sgeu	$13, $13, $12
+	bnez	$13, L.27
+	addui	$6, $0, 1
+	j	L.28
+L.27:
+	addu	$6, $0, $0
+L.28:
+	addu	$1, $0, $6
+L.25:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	is_valid_block_num
+is_valid_block_num:
+	subui	$sp, $sp, 7
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 1($7)
+	lw	$12, 3($7)
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	sgeu	$13, $13, $12
+	bnez	$13, L.31
+	addui	$6, $0, 1
+	j	L.32
+L.31:
+	addu	$6, $0, $0
+L.32:
+	addu	$1, $0, $6
+L.29:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+get_bitmap_block:
+	subui	$sp, $sp, 6
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	addui	$11, $0, 8191
+	and	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	lw	$12, 7($sp)
+	srli	$12, $12, 13
+	addu	$13, $13, $12
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.33:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+alloc_bitmap_bit:
+	subui	$sp, $sp, 12
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, 13($sp)
+	srli	$3, $13, 8
+	addu	$6, $0, $0
+	j	L.38
+L.35:
+	lw	$13, 12($sp)
+	addu	$13, $13, $6
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	addui	$13, $0, 256
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	addui	$13, $0, 1
+	sw	$13, 3($sp)
+	jal	bitmap_search_from
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	slt	$13, $5, $0
+	bnez	$13, L.39
+	slli	$13, $6, 13
+	addu	$12, $0, $5
+	addu	$4, $13, $12
+	lw	$13, 14($sp)
+	sltu	$13, $4, $13
+	bnez	$13, L.41
+	sw	$7, 0($sp)
+	jal	put_block_buffer
+	j	L.37
+L.41:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	addui	$13, $0, 256
+	sw	$13, 1($sp)
+	sw	$5, 2($sp)
+	jal	bitmap_set_bit
+	sw	$7, 0($sp)
+	jal	put_block_buffer_dirt
+	addu	$1, $0, $4
+	j	L.34
+L.39:
+	sw	$7, 0($sp)
+	jal	put_block_buffer
+L.36:
+	addui	$13, $0, 1
+	addu	$6, $6, $13
+L.38:
+	sltu	$13, $6, $3
+	bnez	$13, L.35
+L.37:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe4
+L.34:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	is_inode_in_use
+is_inode_in_use:
+	subui	$sp, $sp, 10
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	is_valid_inode_num
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.44
+	addu	$1, $0, $0
+	j	L.43
+L.44:
+	lw	$13, 8($sp)
+	lw	$13, 12($13)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	addui	$13, $sp, 7
+	sw	$13, 2($sp)
+	lw	$13, 11($sp)
+	sw	$13, 3($sp)
+	jal	get_bitmap_block
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	addui	$13, $0, 256
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	sw	$7, 0($sp)
+	jal	put_block_buffer
+	lw	$1, 9($sp)
+L.43:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	alloc_block
+alloc_block:
+	subui	$sp, $sp, 11
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 1($7)
+	lw	$12, 3($7)
+	addu	$13, $13, $12
+	sw	$13, 10($sp)
+	lw	$13, 10($7)
+	sw	$13, 0($sp)
+	lw	$13, 11($7)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	alloc_bitmap_bit
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.47
+	la	$13, L.49
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	kwarn
+	addu	$1, $0, $6
+	j	L.46
+L.47:
+	addui	$13, $7, 1
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	addui	$13, $7, 3
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	subu	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $6
+L.46:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	release_block
+release_block:
+	subui	$sp, $sp, 12
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	jal	is_valid_block_num
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.51
+	la	$13, L.53
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	jal	kwarn
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.50
+L.51:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lw	$13, 0($5)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 256
+	sw	$13, 2($sp)
+	jal	memset
+	sw	$5, 0($sp)
+	jal	put_block_buffer_dirt
+	lw	$13, 10($7)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	lw	$13, 13($sp)
+	sw	$13, 3($sp)
+	jal	get_bitmap_block
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 0($6)
+	sw	$13, 0($sp)
+	addui	$13, $0, 256
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_clear_bit
+	addui	$13, $7, 1
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	subu	$12, $12, $11
+	sw	$12, 0($13)
+	addui	$13, $7, 3
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	sw	$6, 0($sp)
+	jal	put_block_buffer_dirt
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.50:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	get_inode_blocks
+get_inode_blocks:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addu	$7, $0, $0
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	_iter_zone_init
+	j	L.56
+L.55:
+	addui	$13, $0, 1
+	addu	$7, $7, $13
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	jal	iter_zone_get_next
+L.56:
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	jal	iter_zone_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.55
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	jal	iter_zone_close
+	addu	$1, $0, $7
+L.54:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	get_inode_total_size_word
+get_inode_total_size_word:
+	subui	$sp, $sp, 4
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	jal	get_inode_blocks
+	addu	$13, $0, $1
+	sw	$13, 3($sp)
+	lw	$13, 3($sp)
+	slli	$1, $13, 8
+L.58:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	init_inode_non_disk
+init_inode_non_disk:
+	subui	$sp, $sp, 8
+	sw	$10, 2($sp)
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$12, 10($sp)
+	sw	$12, 16($13)
+	lw	$13, 8($sp)
+	lw	$12, 11($sp)
+	sw	$12, 20($13)
+	lw	$13, 8($sp)
+	lw	$12, 9($sp)
+	sw	$12, 17($13)
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.60
+	lw	$13, 11($sp)
+	addui	$12, $13, 14
+	lw	$11, 9($sp)
+	addu	$11, $0, $11
+	lw	$10, 6($13)
+	multu	$11, $11, $10
+	srli	$11, $11, 8
+	lw	$10, 0($12)
+	addu	$11, $11, $10
+	sw	$11, 7($sp)
+	lw	$11, 7($sp)
+	slli	$11, $11, 8
+	lw	$12, 0($12)
+	slli	$12, $12, 8
+	lw	$13, 15($13)
+	addu	$13, $12, $13
+	sltu	$13, $11, $13
+	bnez	$13, L.62
+	la	$13, L.64
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	kwarn
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.59
+L.62:
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	sw	$12, 19($13)
+L.60:
+	addu	$1, $0, $0
+L.59:
+	lw	$10, 2($sp)
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	arch_inode
+arch_inode:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	addui	$12, $13, 4
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 20($13)
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	divu	$13, $11, $13
+	sw	$13, 0($12)
+L.65:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	dearch_inode
+dearch_inode:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	addui	$12, $13, 4
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 20($13)
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	multu	$13, $11, $13
+	sw	$13, 0($12)
+L.66:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	read_inode
+read_inode:
+	subui	$sp, $sp, 13
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 13($sp)
+	addu	$13, $0, $13
+	lw	$12, 6($6)
+	multu	$13, $13, $12
+	srli	$13, $13, 8
+	sw	$13, 12($sp)
+	lw	$13, 13($sp)
+	addu	$13, $0, $13
+	lw	$12, 6($6)
+	multu	$13, $13, $12
+	addui	$12, $0, 255
+	and	$13, $13, $12
+	sw	$13, 11($sp)
+	lw	$13, 14($6)
+	lw	$12, 12($sp)
+	addu	$13, $13, $12
+	sw	$13, 10($sp)
+	jal	get_free_inode_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.68
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe4
+	j	L.67
+L.68:
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	jal	is_inode_in_use
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.70
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.67
+L.70:
+	lw	$13, 13($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.72
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.67
+L.72:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sw	$7, 0($sp)
+	lw	$13, 11($sp)
+	lw	$12, 0($5)
+	addu	$13, $13, $12
+	sw	$13, 1($sp)
+	addui	$13, $0, 16
+	sw	$13, 2($sp)
+	jal	memcpy
+	addui	$13, $7, 18
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	sw	$7, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	lw	$13, 15($sp)
+	sw	$13, 2($sp)
+	sw	$6, 3($sp)
+	jal	init_inode_non_disk
+	sw	$7, 0($sp)
+	jal	arch_inode
+	sw	$5, 0($sp)
+	jal	put_block_buffer
+	lw	$13, 14($sp)
+	sw	$7, 0($13)
+	addu	$1, $0, $0
+L.67:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	get_inode
+get_inode:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	sw	$0, 8($sp)
+	addu	$7, $0, $0
+L.75:
+	addui	$13, $0, 26
+	mult	$13, $13, $7
+	la	$12, inode_table
+	addu	$13, $13, $12
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	lw	$13, 17($13)
+	lw	$12, 9($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.79
+	lw	$13, 8($sp)
+	addui	$13, $13, 18
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$1, 8($sp)
+	j	L.74
+L.79:
+L.76:
+	addi	$7, $7, 1
+	slti	$13, $7, 48
+	bnez	$13, L.75
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 8
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	read_inode
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$13, 7($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.81
+	la	$13, L.83
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	kwarn
+	addu	$1, $0, $0
+	j	L.74
+L.81:
+	lw	$1, 8($sp)
+L.74:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	put_inode
+put_inode:
+	subui	$sp, $sp, 11
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.85
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.84
+L.85:
+	lw	$13, 11($sp)
+	lw	$13, 18($13)
+	sle	$13, $13, $0
+	bnez	$13, L.87
+	lw	$13, 11($sp)
+	addui	$13, $13, 18
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+L.87:
+	lw	$13, 12($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.89
+	addu	$1, $0, $0
+	j	L.84
+L.89:
+	lw	$13, 11($sp)
+	lw	$13, 16($13)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+	lw	$13, 11($sp)
+	lw	$12, 17($13)
+	sw	$12, 9($sp)
+	lw	$12, 9($sp)
+	addu	$12, $0, $12
+	lw	$11, 10($sp)
+	lw	$11, 6($11)
+	multu	$12, $12, $11
+	addui	$11, $0, 255
+	and	$12, $12, $11
+	sw	$12, 8($sp)
+	lw	$12, 19($13)
+	sw	$12, 0($sp)
+	lw	$13, 16($13)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	dearch_inode
+	lw	$13, 8($sp)
+	lw	$12, 0($7)
+	addu	$13, $13, $12
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 16
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	arch_inode
+	sw	$7, 0($sp)
+	jal	put_block_buffer_dirt
+	lw	$13, 11($sp)
+	addui	$13, $13, 21
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffbf
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.84:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	alloc_inode
+alloc_inode:
+	subui	$sp, $sp, 12
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, start_unix_time($0)
+	addui	$11, $0, 60
+	divu	$13, $13, $11
+	addu	$5, $12, $13
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 12($6)
+	sw	$13, 0($sp)
+	lw	$13, 13($6)
+	sw	$13, 1($sp)
+	lw	$13, 15($6)
+	lw	$12, 6($6)
+	divu	$13, $13, $12
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	alloc_bitmap_bit
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	sge	$13, $4, $0
+	bnez	$13, L.92
+	addu	$1, $0, $0
+	j	L.91
+L.92:
+	jal	get_free_inode_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.94
+	addu	$1, $0, $0
+	j	L.91
+L.94:
+	sw	$7, 0($sp)
+	sw	$4, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	sw	$6, 3($sp)
+	jal	init_inode_non_disk
+	addui	$13, $7, 18
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, start_unix_time($0)
+	addui	$11, $0, 60
+	divu	$13, $13, $11
+	addu	$13, $12, $13
+	sw	$13, 7($7)
+	sw	$5, 7($7)
+	sw	$5, 6($7)
+	sw	$5, 5($7)
+	addui	$13, $6, 4
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	subu	$12, $12, $11
+	sw	$12, 0($13)
+	addui	$13, $6, 2
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $7
+L.91:
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	init_inode_proc_field
+init_inode_proc_field:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	lw	$12, 5($sp)
+	lw	$12, 111($12)
+	sw	$12, 3($13)
+	lw	$13, 4($sp)
+	lw	$12, 5($sp)
+	lw	$12, 110($12)
+	sw	$12, 2($13)
+	lw	$13, 4($sp)
+	lw	$12, 6($sp)
+	lw	$11, 7($sp)
+	lw	$10, 5($sp)
+	lw	$10, 213($10)
+	subu	$10, $0, $10
+	subui	$10, $10, 1
+	and	$11, $11, $10
+	or	$12, $12, $11
+	sw	$12, 0($13)
+L.96:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	truncate_inode
+truncate_inode:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	_iter_zone_init
+	j	L.99
+L.98:
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	jal	iter_zone_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sw	$7, 0($sp)
+	lw	$13, 8($sp)
+	lw	$13, 16($13)
+	sw	$13, 1($sp)
+	jal	release_block
+L.99:
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	jal	iter_zone_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.98
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	jal	iter_zone_close
+	addu	$1, $0, $0
+L.97:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	_release_inode
+_release_inode:
+	subui	$sp, $sp, 16
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$11, 10($sp)
+	sw	$12, 11($sp)
+	sw	$13, 12($sp)
+	sw	$ra, 13($sp)
+	lw	$13, 16($sp)
+	lw	$5, 16($13)
+	lw	$13, 16($sp)
+	lw	$13, 17($13)
+	sw	$13, 15($sp)
+	sw	$5, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	addu	$7, $0, $0
+	lw	$13, 16($sp)
+	lw	$13, 18($13)
+	seq	$13, $13, $0
+	bnez	$13, L.102
+	la	$13, L.104
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	jal	kwarn
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.101
+L.102:
+	addu	$7, $0, $0
+L.105:
+	lw	$13, 16($sp)
+	addui	$13, $13, 8
+	addu	$13, $7, $13
+	lw	$6, 0($13)
+	sequ	$13, $6, $0
+	bnez	$13, L.109
+	lw	$13, 17($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.113
+	sgei	$13, $7, 6
+	bnez	$13, L.111
+L.113:
+	sw	$6, 0($sp)
+	sw	$5, 1($sp)
+	jal	release_block
+	lw	$13, 16($sp)
+	addui	$13, $13, 8
+	addu	$13, $7, $13
+	sw	$0, 0($13)
+	j	L.112
+L.111:
+	addu	$13, $0, $6
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	jal	get_inode
+	addu	$13, $0, $1
+	addu	$2, $0, $13
+	addu	$13, $0, $2
+	sequ	$13, $13, $0
+	bnez	$13, L.114
+	sw	$2, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	sw	$2, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	_release_inode
+L.114:
+L.112:
+L.109:
+L.106:
+	addi	$7, $7, 1
+	slti	$13, $7, 8
+	bnez	$13, L.105
+	lw	$13, 12($4)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	addui	$13, $sp, 14
+	sw	$13, 2($sp)
+	sw	$5, 3($sp)
+	jal	get_bitmap_block
+	addu	$13, $0, $1
+	addu	$3, $0, $13
+	lw	$13, 0($3)
+	sw	$13, 0($sp)
+	addui	$13, $0, 256
+	sw	$13, 1($sp)
+	lw	$13, 14($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_clear_bit
+	addui	$13, $4, 2
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	subu	$12, $12, $11
+	sw	$12, 0($13)
+	addui	$13, $4, 4
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	sw	$3, 0($sp)
+	jal	put_block_buffer_dirt
+	lw	$13, 16($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 26
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$1, $0, $0
+L.101:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$11, 10($sp)
+	lw	$12, 11($sp)
+	lw	$13, 12($sp)
+	lw	$ra, 13($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.global	fill_dirent
+fill_dirent:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$13, 0($13)
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	addui	$13, $13, 2
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 29
+	sw	$13, 2($sp)
+	jal	char32_strlcpy
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	lw	$12, 17($12)
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.117
+	lw	$13, 8($sp)
+	addui	$12, $0, 4
+	sw	$12, 1($13)
+	j	L.118
+L.117:
+	lw	$13, 6($sp)
+	addui	$12, $0, 8192
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.119
+	lw	$13, 8($sp)
+	addui	$12, $0, 2
+	sw	$12, 1($13)
+	j	L.120
+L.119:
+	lw	$13, 6($sp)
+	addui	$12, $0, 0x8000
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.121
+	lw	$13, 8($sp)
+	addui	$12, $0, 8
+	sw	$12, 1($13)
+	j	L.122
+L.121:
+	lw	$13, 6($sp)
+	addui	$12, $0, 24576
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.123
+	lw	$13, 8($sp)
+	addui	$12, $0, 6
+	sw	$12, 1($13)
+L.123:
+L.122:
+L.120:
+L.118:
+	addu	$1, $0, $0
+L.116:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	init_dirent
+init_dirent:
+	subui	$sp, $sp, 9
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sequ	$13, $13, $12
+	bnez	$13, L.126
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffec
+	j	L.125
+L.126:
+	lw	$13, 10($sp)
+	lw	$5, 8($13)
+	sneu	$13, $5, $0
+	bnez	$13, L.128
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.125
+L.128:
+	sw	$5, 0($sp)
+	lw	$13, 10($sp)
+	lw	$13, 16($13)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$7, 0($6)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	la	$13, L.130
+	sw	$13, 2($sp)
+	jal	fill_dirent
+	addui	$7, $7, 32
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	la	$13, L.131
+	sw	$13, 2($sp)
+	jal	fill_dirent
+	sw	$6, 0($sp)
+	jal	put_block_buffer_dirt
+	addu	$1, $0, $0
+L.125:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	add_inode_to_directory
+add_inode_to_directory:
+	subui	$sp, $sp, 17
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addu	$6, $0, $0
+	lw	$13, 18($sp)
+	lw	$13, 0($13)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sequ	$13, $13, $12
+	bnez	$13, L.133
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.132
+L.133:
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	has_file_access
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.135
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff3
+	j	L.132
+L.135:
+	lw	$13, 20($sp)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addui	$12, $0, 28
+	sleu	$13, $13, $12
+	bnez	$13, L.137
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffdc
+	j	L.132
+L.137:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $0
+	sw	$13, 2($sp)
+	sw	$13, 3($sp)
+	sw	$13, 4($sp)
+	jal	_iter_dirent_init
+	j	L.140
+L.139:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.142
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_alloc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.144
+	j	L.141
+L.144:
+	lw	$13, 18($sp)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	addui	$11, $0, 256
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+L.142:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.146
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 20($sp)
+	sw	$13, 2($sp)
+	jal	fill_dirent
+	lw	$13, 19($sp)
+	lw	$13, 16($13)
+	lw	$13, 0($13)
+	sw	$13, 31($7)
+	lw	$13, 19($sp)
+	addui	$13, $13, 1
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	sw	$12, 5($13)
+	addu	$6, $0, $0
+	j	L.141
+L.146:
+L.140:
+	j	L.139
+L.141:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	addu	$1, $0, $6
+L.132:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	remove_inode_from_dir
+remove_inode_from_dir:
+	subui	$sp, $sp, 17
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xfffe
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	has_file_access
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.150
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff3
+	j	L.149
+L.150:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $0
+	sw	$13, 2($sp)
+	sw	$13, 3($sp)
+	sw	$13, 4($sp)
+	jal	_iter_dirent_init
+	j	L.153
+L.152:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 0($7)
+	lw	$12, 19($sp)
+	lw	$12, 17($12)
+	sne	$13, $13, $12
+	bnez	$13, L.155
+	addui	$13, $7, 2
+	sw	$13, 0($sp)
+	lw	$13, 20($sp)
+	sw	$13, 1($sp)
+	jal	char32_strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.155
+	sw	$0, 2($7)
+	sw	$0, 0($7)
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	sw	$12, 5($13)
+	lw	$13, 19($sp)
+	addui	$13, $13, 1
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	subu	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$6, $0, $0
+	j	L.154
+L.155:
+L.153:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.152
+L.154:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	addu	$1, $0, $6
+L.149:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	_iter_zone_init
+_iter_zone_init:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	sw	$12, 0($13)
+	lw	$13, 3($sp)
+	addui	$13, $13, 18
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 2($sp)
+	lw	$12, 4($sp)
+	addu	$12, $0, $12
+	sw	$12, 1($13)
+	addu	$1, $0, $0
+L.158:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	_iter_get_current_zone
+_iter_get_current_zone:
+	subui	$sp, $sp, 18
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$10, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	addu	$7, $0, $0
+	addu	$6, $0, $0
+	lw	$13, 18($sp)
+	lw	$13, 0($13)
+	lw	$13, 16($13)
+	sw	$13, 16($sp)
+	lw	$13, 18($sp)
+	lw	$4, 0($13)
+	lw	$13, 1($13)
+	addui	$12, $0, 22
+	sltu	$13, $13, $12
+	bnez	$13, L.160
+	addu	$1, $0, $0
+	j	L.159
+L.160:
+	lw	$13, 18($sp)
+	lw	$13, 1($13)
+	addui	$12, $0, 6
+	sgeu	$13, $13, $12
+	bnez	$13, L.162
+	lw	$13, 18($sp)
+	lw	$12, 1($13)
+	lw	$13, 0($13)
+	addui	$13, $13, 8
+	addu	$5, $12, $13
+	j	L.163
+L.162:
+	lw	$13, 18($sp)
+	lw	$12, 1($13)
+	addui	$11, $0, 6
+	subu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 17($sp)
+	lw	$12, 17($sp)
+	addui	$11, $0, 8
+	div	$10, $12, $11
+	sw	$10, 15($sp)
+	rem	$12, $12, $11
+	sw	$12, 14($sp)
+	lw	$12, 15($sp)
+	lw	$13, 0($13)
+	addui	$13, $13, 14
+	addu	$5, $12, $13
+	lw	$13, 0($5)
+	sneu	$13, $13, $0
+	bnez	$13, L.164
+	lw	$13, 19($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.166
+	j	L.168
+L.166:
+	lw	$13, 16($sp)
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	jal	alloc_inode
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.169
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffe4
+	j	L.168
+L.169:
+	addui	$13, $4, 21
+	lw	$12, 0($13)
+	ori	$12, $12, 64
+	sw	$12, 0($13)
+	addui	$13, $6, 21
+	lw	$12, 0($13)
+	ori	$12, $12, 32
+	sw	$12, 0($13)
+	lw	$13, 17($6)
+	addu	$13, $0, $13
+	sw	$13, 0($5)
+	j	L.165
+L.164:
+	lw	$13, 0($5)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	lw	$13, 16($4)
+	sw	$13, 1($sp)
+	jal	get_inode
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.171
+	la	$13, L.173
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	lw	$13, 0($13)
+	lw	$13, 17($13)
+	sw	$13, 1($sp)
+	lw	$13, 0($5)
+	sw	$13, 2($sp)
+	jal	kwarn
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffea
+	j	L.168
+L.171:
+L.165:
+	lw	$13, 14($sp)
+	addui	$12, $6, 8
+	addu	$5, $13, $12
+	addu	$4, $0, $6
+L.163:
+	lw	$13, 20($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.174
+	lw	$13, 0($5)
+	sequ	$13, $13, $0
+	bnez	$13, L.176
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffea
+	j	L.168
+L.176:
+	sw	$4, 0($sp)
+	lw	$13, 16($4)
+	sw	$13, 1($sp)
+	jal	alloc_block
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.178
+	j	L.168
+L.178:
+	addu	$13, $0, $7
+	sw	$13, 0($5)
+L.174:
+	lw	$13, 0($5)
+	addu	$7, $0, $13
+L.168:
+	addu	$13, $0, $6
+	sequ	$13, $13, $0
+	bnez	$13, L.180
+	sw	$6, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 13($sp)
+	lw	$12, 19($sp)
+	sne	$13, $12, $13
+	bnez	$13, L.185
+	lw	$13, 20($sp)
+	lw	$12, 13($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.183
+L.185:
+	addui	$3, $0, 1
+	j	L.184
+L.183:
+	addu	$3, $0, $0
+L.184:
+	sw	$3, 1($sp)
+	jal	put_inode
+L.180:
+	addu	$1, $0, $7
+L.159:
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$10, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 18
+	jr	$ra
+.global	iter_zone_has_next
+iter_zone_has_next:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	_iter_get_current_zone
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.186:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	iter_zone_get_next
+iter_zone_get_next:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	_iter_get_current_zone
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.188
+	lw	$13, 8($sp)
+	addui	$13, $13, 1
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+L.188:
+	addu	$1, $0, $7
+L.187:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	iter_zone_alloc
+iter_zone_alloc:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$13, 1($13)
+	addui	$12, $0, 22
+	sltu	$13, $13, $12
+	bnez	$13, L.191
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe5
+	j	L.190
+L.191:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	_iter_get_current_zone
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.190:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	iter_zone_close
+iter_zone_close:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	sw	$0, 1($13)
+	lw	$13, 2($sp)
+	lw	$13, 0($13)
+	addui	$13, $13, 18
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.193:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	_iter_dirent_get_current
+_iter_dirent_get_current:
+	subui	$sp, $sp, 8
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 32
+	addu	$12, $0, $12
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sleu	$13, $12, $13
+	bnez	$13, L.195
+	lw	$13, 8($sp)
+	addui	$13, $13, 3
+	sw	$13, 0($sp)
+	jal	iter_zone_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.197
+	addu	$1, $0, $0
+	j	L.194
+L.197:
+	lw	$13, 8($sp)
+	addui	$13, $13, 3
+	sw	$13, 0($sp)
+	jal	iter_zone_get_next
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	lw	$13, 3($13)
+	lw	$13, 16($13)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	lw	$12, 0($12)
+	addui	$11, $0, 256
+	addu	$12, $12, $11
+	sw	$12, 1($13)
+	lw	$13, 8($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.199
+	lw	$13, 8($sp)
+	lw	$13, 2($13)
+	sw	$13, 0($sp)
+	jal	put_block_buffer
+L.199:
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	sw	$12, 2($13)
+L.195:
+	lw	$13, 8($sp)
+	lw	$1, 0($13)
+L.194:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	_iter_dirent_init
+_iter_dirent_init:
+	subui	$sp, $sp, 7
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	sw	$0, 2($13)
+	lw	$13, 7($sp)
+	sw	$0, 1($13)
+	lw	$13, 7($sp)
+	addui	$13, $13, 3
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	_iter_zone_init
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	jal	_iter_dirent_get_current
+	addu	$12, $0, $1
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	lw	$12, 10($sp)
+	slli	$12, $12, 5
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	lw	$12, 11($sp)
+	sw	$12, 5($13)
+	addu	$1, $0, $0
+L.201:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	iter_dirent_has_next
+iter_dirent_has_next:
+	subui	$sp, $sp, 6
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+L.203:
+	lw	$13, 6($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 32
+	addu	$12, $0, $12
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sleu	$13, $12, $13
+	bnez	$13, L.206
+	lw	$13, 6($sp)
+	addui	$13, $13, 3
+	sw	$13, 0($sp)
+	jal	iter_zone_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.208
+	addu	$1, $0, $0
+	j	L.202
+L.208:
+L.206:
+	lw	$13, 6($sp)
+	sw	$13, 5($sp)
+	addu	$12, $0, $0
+	lw	$11, 5($13)
+	seq	$13, $11, $12
+	bnez	$13, L.212
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	seq	$13, $13, $12
+	bnez	$13, L.210
+L.212:
+	j	L.205
+L.210:
+	lw	$13, 6($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 32
+	sw	$12, 0($13)
+L.204:
+	j	L.203
+L.205:
+	addui	$1, $0, 1
+L.202:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	iter_dirent_get_next
+iter_dirent_get_next:
+	subui	$sp, $sp, 5
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	_iter_dirent_get_current
+	addu	$12, $0, $1
+	sw	$12, 0($13)
+	lw	$13, 5($sp)
+	lw	$12, 0($13)
+	addui	$11, $12, 32
+	sw	$11, 0($13)
+	addu	$1, $0, $12
+L.213:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	iter_dirent_alloc
+iter_dirent_alloc:
+	subui	$sp, $sp, 4
+	sw	$7, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	addui	$13, $13, 3
+	sw	$13, 0($sp)
+	jal	iter_zone_alloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	slt	$13, $7, $0
+	bnez	$13, L.215
+	addu	$1, $0, $0
+	j	L.214
+L.215:
+	addu	$1, $0, $7
+L.214:
+	lw	$7, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	iter_dirent_close
+iter_dirent_close:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, 3($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.218
+	lw	$13, 3($sp)
+	lw	$13, 2($13)
+	sw	$13, 0($sp)
+	jal	put_block_buffer
+	lw	$13, 3($sp)
+	sw	$0, 2($13)
+L.218:
+	lw	$13, 3($sp)
+	addui	$13, $13, 3
+	sw	$13, 0($sp)
+	jal	iter_zone_close
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.217:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	flush_inodes
+flush_inodes:
+	subui	$sp, $sp, 7
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addu	$7, $0, $0
+L.221:
+	addui	$13, $0, 26
+	mult	$13, $13, $7
+	la	$12, inode_table
+	addu	$6, $13, $12
+	lw	$13, 21($6)
+	andi	$13, $13, 64
+	seq	$13, $13, $0
+	bnez	$13, L.225
+	sw	$6, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	put_inode
+L.225:
+L.222:
+	addi	$7, $7, 1
+	slti	$13, $7, 48
+	bnez	$13, L.221
+L.220:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	init_inode
+init_inode:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	addu	$7, $0, $0
+L.228:
+	addui	$13, $0, 26
+	mult	$13, $13, $7
+	la	$12, inode_table
+	addu	$6, $13, $12
+	sw	$0, 17($6)
+	sw	$0, 18($6)
+L.229:
+	addi	$7, $7, 1
+	slti	$13, $7, 48
+	bnez	$13, L.228
+L.227:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.extern	build_bug_on 1
+.extern	next_timeout 1
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.bss
+.global	inode_table
+inode_table:
+	.space	1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.173:
+	.asciiz	"inode %d indirect ino %d not found\n"
+L.131:
+	.asciiz	".."
+L.130:
+	.asciiz	"."
+L.104:
+	.asciiz	"%d is in use before releasing\n"
+L.83:
+	.asciiz	"read inode %d return %d\n"
+L.64:
+	.asciiz	"ino %d exceeding\n"
+L.53:
+	.asciiz	"Invalid block id %d\n"
+L.49:
+	.asciiz	"no free block id found for dev %d"
@@ -13,52 +13,77 @@ unsigned int setBits(unsigned int n)
     return ret;
 }
 
-int makefs( char* disk_raw, size_t disk_size)
+/**
+ * Lay out a fresh file system on disk_raw:
+ *   superblock | block bitmap | inode bitmap | inode table | root directory | data
+ * Both bitmaps take as many blocks as needed to cover every block and
+ * inode of the disk. disk_raw is expected to be zeroed.
+ */
+int makefs(char* disk_raw, const struct fs_geometry* geometry)
 {
     char *pdisk = disk_raw;
     struct winix_dirent* pdir;
     const time_t now = start_unix_time;
     const int root_inode_num = 1;
     inode_t root_node;
-    unsigned int blocks_nr = disk_size / BLOCK_SIZE;
+    unsigned int blocks_nr = geometry->disk_size / BLOCK_SIZE;
+    unsigned int inodes_nr, inode_table_blocks;
+    unsigned int blockmap_blocks, inodemap_blocks;
     block_t sb_block_nr = 0;
     block_t blockmap_block_nr = 1;
-    block_t inodemap_block_nr = 2;
-    block_t inode_table_block_nr = 3;
-    unsigned int inode_tablesize = (int)(blocks_nr * 0.03) * BLOCK_SIZE;
-    block_t root_node_block_nr = inode_table_block_nr + (inode_tablesize / BLOCK_SIZE);
-    block_t block_in_use = root_node_block_nr + 1;
-    block_t remaining_blocks = blocks_nr - block_in_use;
-    unsigned int free_inodes = inode_tablesize / INODE_DISK_SIZE - 1;
-    unsigned int bitval = 0;
+    block_t inodemap_block_nr, inode_table_block_nr;
+    unsigned int inode_tablesize;
+    block_t root_node_block_nr;
+    block_t block_in_use;
+    block_t remaining_blocks;
+    unsigned int free_inodes;
     struct superblock s2;
+    struct superblock superblock;
 
-    struct superblock superblock = {
-        .magic = SUPER_BLOCK_MAGIC, // magic
-        .s_block_inuse = block_in_use, // blocks in use
-        .s_inode_inuse = 1, // inode in use
-        .s_free_blocks = remaining_blocks, // free blocks
-        .s_free_inodes = free_inodes, // free inodes
-        .s_block_size = BLOCK_SIZE, // block size
-        .s_inode_size = INODE_DISK_SIZE, // inode size
-        .s_rootnr = root_inode_num, // root inode number
+    if(geometry->inode_ratio){
+        inodes_nr = geometry->disk_size / geometry->inode_ratio;
+        inode_table_blocks = DIV_ROUND_UP(inodes_nr * INODE_DISK_SIZE, BLOCK_SIZE);
+    }else{
+        /* by default 3% of the disk holds the inode table */
+        inode_table_blocks = (int)(blocks_nr * 0.03);
+    }
+    inode_tablesize = inode_table_blocks * BLOCK_SIZE;
+    inodes_nr = inode_tablesize / INODE_DISK_SIZE;
+    blockmap_blocks = DIV_ROUND_UP(blocks_nr, BITMAP_BITS_PER_BLOCK);
+    inodemap_blocks = DIV_ROUND_UP(inodes_nr, BITMAP_BITS_PER_BLOCK);
 
-        .s_superblock_nr = sb_block_nr,
-        .s_superblock_size = BLOCK_SIZE,
-        .s_blockmapnr = blockmap_block_nr, // block bitmap block index
-        .s_blockmap_size = BLOCK_SIZE,
-        .s_inodemapnr = inodemap_block_nr, // inode bitmap block index
-        .s_inodemap_size = BLOCK_SIZE,
-        .s_inode_tablenr = inode_table_block_nr, // inode table block index
-        .s_inode_table_size = inode_tablesize,
-        .s_char_bit = CHAR_BIT,
-    };
+    inodemap_block_nr = blockmap_block_nr + blockmap_blocks;
+    inode_table_block_nr = inodemap_block_nr + inodemap_blocks;
+    root_node_block_nr = inode_table_block_nr + inode_table_blocks;
+    block_in_use = root_node_block_nr + 1;
+    if(inode_table_blocks == 0 || block_in_use >= blocks_nr)
+        return -EINVAL;
+    remaining_blocks = blocks_nr - block_in_use;
+    // inode 0 is reserved, inode 1 is the root
+    free_inodes = inodes_nr - 2;
+
+    memset(&superblock, 0, sizeof(struct superblock));
+    superblock.magic = SUPER_BLOCK_MAGIC; // magic
+    superblock.s_block_inuse = block_in_use; // blocks in use
+    superblock.s_inode_inuse = 1; // inode in use
+    superblock.s_free_blocks = remaining_blocks; // free blocks
+    superblock.s_free_inodes = free_inodes; // free inodes
+    superblock.s_block_size = BLOCK_SIZE; // block size
+    superblock.s_inode_size = INODE_DISK_SIZE; // inode size
+    superblock.s_rootnr = root_inode_num; // root inode number
+
+    superblock.s_superblock_nr = sb_block_nr;
+    superblock.s_superblock_size = BLOCK_SIZE;
+    superblock.s_blockmapnr = blockmap_block_nr; // block bitmap block index
+    superblock.s_blockmap_size = blockmap_blocks * BLOCK_SIZE;
+    superblock.s_inodemapnr = inodemap_block_nr; // inode bitmap block index
+    superblock.s_inodemap_size = inodemap_blocks * BLOCK_SIZE;
+    superblock.s_inode_tablenr = inode_table_block_nr; // inode table block index
+    superblock.s_inode_table_size = inode_tablesize;
+    superblock.s_char_bit = CHAR_BIT;
     char32_strlcpy(superblock.s_name, rootfs_name, SUPERBLOCK_NAME_LEN);
     // printf("block nr %d %d %d inode table size %ld\n", blocks_nr, block_in_use, remaining_blocks, inode_tablesize / BLOCK_SIZE);
     assert(BLOCK_SIZE > sizeof(struct superblock));
-    assert(BLOCK_SIZE_DWORD * 32 >= blocks_nr);
-    assert(BLOCK_SIZE_DWORD * 32 >= free_inodes);
-
 
     memset(&root_node, 0, sizeof(inode_t));
     root_node.i_mode = S_IFDIR | 0755;
@@ -77,13 +102,11 @@ int makefs( char* disk_raw, size_t disk_size)
     pdisk += superblock.s_superblock_size;
 
     // kdebug("block in use %d\n", block_in_use);
-    bitmap_set_nbits((unsigned int *)pdisk, BLOCK_SIZE_DWORD, 0, block_in_use);
+    bitmap_set_nbits((unsigned int *)pdisk, blockmap_blocks * BLOCK_SIZE_DWORD, 0, block_in_use);
     pdisk += superblock.s_blockmap_size;
 
-    //inode map, first bit is set for root inode
-    bitval = 0;
-    bitmap_set_nbits(&bitval, 1, 0, 2);
-    memcpy(pdisk, &bitval , sizeof(unsigned int));
+    //inode map, bit 0 is reserved and bit 1 is the root inode
+    bitmap_set_nbits((unsigned int *)pdisk, inodemap_blocks * BLOCK_SIZE_DWORD, 0, 2);
     pdisk += superblock.s_inodemap_size;
     //inode table, first one is used by root node
     memcpy(pdisk + INODE_DISK_SIZE, &root_node, INODE_DISK_SIZE);
@@ -95,5 +118,4 @@ int makefs( char* disk_raw, size_t disk_size)
     fill_dirent(&root_node, pdir, "..");
 
     return 0;
-    // return DISK_RAW;
-}
\ No newline at end of file
+}
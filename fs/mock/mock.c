@@ -5,7 +5,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 
-char DISK_RAW[DISK_SIZE];
+char *DISK_RAW;
+unsigned int DISK_RAW_SIZE;
 
 #define MEM_SIZE (1024 * 1024)
 char mem[MEM_SIZE];
@@ -15,10 +16,21 @@ struct proc pcurr;
 struct proc *curr_scheduling_proc;
 struct proc *curr_syscall_caller;
 
+int init_disk_geometry(const struct fs_geometry* geometry){
+    size_t size = geometry->disk_size - geometry->disk_size % BLOCK_SIZE;
+    if(size != DISK_RAW_SIZE){
+        free(DISK_RAW);
+        DISK_RAW = malloc(size);
+        assert(DISK_RAW != NULL);
+        DISK_RAW_SIZE = size;
+    }
+    memset(DISK_RAW, 0, DISK_RAW_SIZE);
+    return makefs(DISK_RAW, geometry);
+}
+
 void init_disk(){
-    int ret;
-    memset(DISK_RAW, 0, DISK_SIZE);
-    ret = makefs(DISK_RAW, DISK_SIZE);
+    struct fs_geometry geometry = {DISK_SIZE, 0};
+    int ret = init_disk_geometry(&geometry);
     assert(ret == 0);
 }
 
@@ -64,6 +76,28 @@ void kfree(void *ptr){
 
 }
 
+struct kmem_cache *kmem_cache_create(const char *name, size_t size){
+    struct kmem_cache *cache = kmalloc(1, sizeof(struct kmem_cache));
+    if(cache){
+        memset(cache, 0, sizeof(struct kmem_cache));
+        cache->name = name;
+        cache->size = size;
+    }
+    return cache;
+}
+
+void *kmem_cache_alloc(struct kmem_cache *cache){
+    void *ret = kmalloc(1, cache->size);
+    if(ret)
+        cache->nr_active++;
+    return ret;
+}
+
+void kmem_cache_free(struct kmem_cache *cache, void *ptr){
+    cache->nr_active--;
+    kfree(ptr);
+}
+
 int syscall_reply(int reply, int dest, struct message* m){
     kdebug("Syscall %d reply to %d\n", reply, dest);
     return 0;
@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <sys/ipc.h>
 #include <kernel/proc.h>
+#include <fs/super.h>
 
 void* kmalloc(size_t nitimes, size_t size);
 void kfree(void *ptr);
@@ -23,5 +24,6 @@ void init_tty();
 char *strlcpy(char *dest, const char *src, size_t n);
 void set_start_unix_time(clock_t t);
 void init_disk();
+int init_disk_geometry(const struct fs_geometry* geometry);
 
 #endif //FS_CMAKE_UTIL_H_
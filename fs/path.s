@@ -0,0 +1,599 @@
+.global	dot1
+dot1:
+	.word	L.9
+.global	dot2
+dot2:
+	.word	L.10
+.global	get_name
+.text
+get_name:
+	subui	$sp, $sp, 5
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$5, 6($sp)
+	lw	$6, 5($sp)
+	j	L.13
+L.12:
+	addui	$6, $6, 1
+L.13:
+	lw	$13, 0($6)
+	addu	$7, $0, $13
+	seqi	$13, $13, 47
+	bnez	$13, L.12
+	j	L.16
+L.15:
+	addu	$13, $0, $5
+	lw	$12, 6($sp)
+	addui	$12, $12, 29
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.18
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	sw	$7, 0($13)
+L.18:
+	addui	$13, $6, 1
+	addu	$6, $0, $13
+	lw	$7, 0($13)
+L.16:
+	addu	$13, $0, $6
+	lw	$12, 5($sp)
+	addui	$12, $12, 128
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.21
+	seqi	$13, $7, 47
+	bnez	$13, L.21
+	sne	$13, $7, $0
+	bnez	$13, L.15
+L.21:
+	j	L.23
+L.22:
+	addui	$13, $6, 1
+	addu	$6, $0, $13
+	lw	$7, 0($13)
+L.23:
+	snei	$13, $7, 47
+	bnez	$13, L.25
+	addu	$13, $0, $6
+	lw	$12, 5($sp)
+	addui	$12, $12, 128
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.22
+L.25:
+	addu	$13, $0, $5
+	lw	$12, 6($sp)
+	addui	$12, $12, 29
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.26
+	sw	$0, 0($5)
+L.26:
+	addu	$13, $0, $6
+	lw	$12, 5($sp)
+	addui	$12, $12, 128
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.28
+	addu	$1, $0, $0
+	j	L.11
+L.28:
+	addu	$1, $0, $6
+L.11:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	advance
+advance:
+	subui	$sp, $sp, 15
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffea
+	lw	$13, 16($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.31
+	addu	$1, $0, $6
+	j	L.30
+L.31:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $0
+	sw	$13, 2($sp)
+	sw	$13, 3($sp)
+	sw	$13, 4($sp)
+	jal	_iter_dirent_init
+	j	L.34
+L.33:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	jal	iter_dirent_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $7, 2
+	sw	$13, 0($sp)
+	lw	$13, 16($sp)
+	sw	$13, 1($sp)
+	jal	char32_strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.36
+	lw	$6, 0($7)
+	j	L.35
+L.36:
+L.34:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	jal	iter_dirent_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.33
+L.35:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	addu	$1, $0, $6
+L.30:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	get_parent_inode_num
+get_parent_inode_num:
+	subui	$sp, $sp, 15
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffea
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $0
+	sw	$13, 2($sp)
+	sw	$13, 3($sp)
+	sw	$13, 4($sp)
+	jal	_iter_dirent_init
+	j	L.40
+L.39:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	jal	iter_dirent_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $7, 2
+	sw	$13, 0($sp)
+	lw	$13, dot2($0)
+	sw	$13, 1($sp)
+	jal	char32_strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.42
+	lw	$6, 0($7)
+	j	L.41
+L.42:
+L.40:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	jal	iter_dirent_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.39
+L.41:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	addu	$1, $0, $6
+L.38:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	get_child_inode_name
+get_child_inode_name:
+	subui	$sp, $sp, 18
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lhi	$4, 0xffff
+	ori	$4, $4, 0xffea
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffea
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $0
+	sw	$13, 2($sp)
+	sw	$13, 3($sp)
+	sw	$13, 4($sp)
+	jal	_iter_dirent_init
+	j	L.46
+L.45:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	jal	iter_dirent_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 0($7)
+	lw	$12, 19($sp)
+	lw	$12, 17($12)
+	sne	$13, $13, $12
+	bnez	$13, L.48
+	addui	$5, $7, 2
+	sw	$5, 0($sp)
+	jal	char32_strlen
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 20($sp)
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	addi	$13, $6, 1
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	char32_strlcpy2
+	addu	$4, $0, $6
+	j	L.47
+L.48:
+L.46:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	jal	iter_dirent_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.45
+L.47:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	addu	$1, $0, $4
+L.44:
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 18
+	jr	$ra
+.global	__eath_path
+__eath_path:
+	subui	$sp, $sp, 10
+	sw	$3, 2($sp)
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$7, 10($sp)
+	lw	$13, 1($7)
+	sequ	$13, $13, $0
+	bnez	$13, L.53
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.51
+L.53:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+	j	L.50
+L.51:
+	lw	$3, 16($7)
+	j	L.55
+L.54:
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	jal	get_name
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.57
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+	j	L.50
+L.57:
+	lw	$13, 0($5)
+	sne	$13, $13, $0
+	bnez	$13, L.59
+	lw	$13, 0($7)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.61
+	lw	$13, 11($sp)
+	sw	$7, 0($13)
+	sw	$7, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	jal	advance
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffea
+	sne	$13, $6, $13
+	bnez	$13, L.63
+	addu	$1, $0, $0
+	j	L.50
+L.63:
+	sw	$6, 0($sp)
+	lw	$13, 16($7)
+	sw	$13, 1($sp)
+	jal	get_inode
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	lw	$13, 12($sp)
+	sw	$4, 0($13)
+	addu	$1, $0, $0
+	j	L.50
+L.61:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffec
+	j	L.50
+L.59:
+	lw	$13, 0($7)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.65
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffec
+	j	L.50
+L.65:
+	sw	$7, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	jal	advance
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffea
+	sne	$13, $6, $13
+	bnez	$13, L.67
+	addu	$1, $0, $0
+	j	L.50
+L.67:
+	sw	$7, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	sw	$6, 0($sp)
+	sw	$3, 1($sp)
+	jal	get_inode
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	addu	$7, $0, $4
+	sw	$5, 13($sp)
+L.55:
+	j	L.54
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+L.50:
+	lw	$3, 2($sp)
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	eat_path
+eat_path:
+	subui	$sp, $sp, 14
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 14($sp)
+	sw	$13, 12($sp)
+	addu	$12, $0, $0
+	lw	$11, 231($13)
+	addu	$11, $0, $11
+	sequ	$13, $11, $12
+	bnez	$13, L.72
+	lw	$13, 12($sp)
+	lw	$13, 230($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $12
+	bnez	$13, L.70
+L.72:
+	addui	$13, $0, 257
+	sw	$13, 0($sp)
+	jal	get_dev
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	get_inode
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 14($sp)
+	sw	$7, 230($13)
+	sw	$7, 231($13)
+L.70:
+	lw	$13, 15($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 47
+	bnez	$13, L.74
+	lw	$13, 14($sp)
+	lw	$6, 230($13)
+	j	L.75
+L.74:
+	lw	$13, 14($sp)
+	lw	$6, 231($13)
+L.75:
+	addu	$7, $0, $6
+	addui	$13, $7, 18
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 17($sp)
+	sw	$0, 0($13)
+	lw	$13, 16($sp)
+	sw	$0, 0($13)
+	sw	$7, 0($sp)
+	lw	$13, 16($sp)
+	sw	$13, 1($sp)
+	lw	$13, 17($sp)
+	sw	$13, 2($sp)
+	lw	$13, 15($sp)
+	sw	$13, 3($sp)
+	lw	$13, 18($sp)
+	sw	$13, 4($sp)
+	jal	__eath_path
+	addu	$13, $0, $1
+	sw	$13, 13($sp)
+	lw	$13, 16($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.76
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+	j	L.69
+L.76:
+	lw	$1, 13($sp)
+L.69:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.global	get_inode_by_path
+get_inode_by_path:
+	subui	$sp, $sp, 38
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	sw	$0, 37($sp)
+	lw	$13, 38($sp)
+	sw	$13, 0($sp)
+	lw	$13, 39($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 37
+	sw	$13, 2($sp)
+	lw	$13, 40($sp)
+	sw	$13, 3($sp)
+	addui	$13, $sp, 7
+	sw	$13, 4($sp)
+	jal	eat_path
+	addu	$13, $0, $1
+	sw	$13, 36($sp)
+	lw	$13, 37($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$1, 36($sp)
+L.78:
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 38
+	jr	$ra
+.global	is_fd_opened_and_valid
+is_fd_opened_and_valid:
+	subui	$sp, $sp, 4
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.82
+	lw	$13, 2($sp)
+	slti	$13, $13, 16
+	bnez	$13, L.80
+L.82:
+	addu	$1, $0, $0
+	j	L.79
+L.80:
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 3($sp)
+	lw	$13, 3($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.83
+	addu	$1, $0, $0
+	j	L.79
+L.83:
+	addui	$1, $0, 1
+L.79:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.10:
+	.asciiz	".."
+L.9:
+	.asciiz	"."
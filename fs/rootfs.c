@@ -63,8 +63,94 @@ void __blk_dev_init(char *disk, size_t size){
     // kdebug("sb block in use %d inode table size %d\n", sb->s_block_inuse, sb->s_inode_table_size);
 }
 
+/**
+ * The disk image linked into the kernel is run length encoded by fsutil,
+ * so that unused disk space costs nothing in the kernel image. The stream
+ * is a sequence of records, each starting with a header word. If the
+ * header has DISK_RLE_ZERO_RUN set, the lower bits give the length of a
+ * run of zero words, otherwise the header is the number of literal words
+ * that follow it.
+ *
+ * Returns the number of words written to dst, or -EINVAL if the stream
+ * is malformed or does not fit in dst
+ */
+int disk_rle_expand(unsigned int *dst, size_t dst_len, const unsigned int *src, size_t src_len){
+    const unsigned int *src_end = src + src_len;
+    unsigned int *dst_start = dst;
+    unsigned int *dst_end = dst + dst_len;
+    unsigned int header, len;
+
+    while(src < src_end){
+        header = *src++;
+        len = header & ~DISK_RLE_ZERO_RUN;
+        if(len > dst_end - dst)
+            return -EINVAL;
+
+        if(header & DISK_RLE_ZERO_RUN){
+            memset(dst, 0, len * sizeof(unsigned int));
+        }else{
+            if(len > src_end - src)
+                return -EINVAL;
+            memcpy(dst, src, len * sizeof(unsigned int));
+            src += len;
+        }
+        dst += len;
+    }
+    return dst - dst_start;
+}
+
+#ifdef FSUTIL
+
+/**
+ * Encode src in the format understood by disk_rle_expand(). Zero runs
+ * shorter than DISK_RLE_MIN_RUN words are kept as literals, since a
+ * record header would cost more than it saves.
+ *
+ * Returns the number of words written to dst, or -ENOSPC if dst is too small
+ */
+int disk_rle_compress(unsigned int *dst, size_t dst_len, const unsigned int *src, size_t src_len){
+    size_t i = 0, j, run;
+    size_t out = 0;
+    size_t literal_start;
+
+    while(i < src_len){
+        /* count the zero run at i */
+        for(run = 0; i + run < src_len && src[i + run] == 0; run++);
+        if(run >= DISK_RLE_MIN_RUN){
+            if(out + 1 > dst_len)
+                return -ENOSPC;
+            dst[out++] = DISK_RLE_ZERO_RUN | run;
+            i += run;
+            continue;
+        }
+
+        /* extend the literal until a worthwhile zero run starts */
+        literal_start = i;
+        while(i < src_len){
+            for(run = 0; i + run < src_len && src[i + run] == 0 && run < DISK_RLE_MIN_RUN; run++);
+            if(run >= DISK_RLE_MIN_RUN)
+                break;
+            i += run ? run : 1;
+        }
+
+        if(out + 1 + (i - literal_start) > dst_len)
+            return -ENOSPC;
+        dst[out++] = i - literal_start;
+        for(j = literal_start; j < i; j++)
+            dst[out++] = src[j];
+    }
+    return out;
+}
+
+#endif
+
 int blk_dev_init(){
-    __blk_dev_init(DISK_RAW, DISK_SIZE);
+#ifndef FSUTIL
+    size_t len = DISK_RAW_SIZE / sizeof(unsigned int);
+    int ret = disk_rle_expand((unsigned int *)DISK_RAW, len, DISK_RLE, DISK_RLE_LEN);
+    ASSERT(ret == len);
+#endif
+    __blk_dev_init(DISK_RAW, DISK_RAW_SIZE);
     return 0;
 }
 
@@ -0,0 +1,920 @@
+.global	DEVICE_NAME
+DEVICE_NAME:
+	.word	L.9
+.global	FS_TYPE
+FS_TYPE:
+	.word	L.10
+.global	devid
+devid:
+	.word	0x101
+.global	get_sb
+.text
+get_sb:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	addu	$13, $0, $13
+	la	$12, rootfs_dev
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.12
+	la	$1, root_sb
+	j	L.11
+L.12:
+	addu	$1, $0, $0
+L.11:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	blk_dev_io_read_write
+blk_dev_io_read_write:
+	subui	$sp, $sp, 5
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 7($sp)
+	addu	$7, $0, $13
+	lw	$13, 6($sp)
+	lw	$12, rootfs_disk_size($0)
+	sltu	$13, $13, $12
+	bnez	$13, L.15
+	addu	$1, $0, $0
+	j	L.14
+L.15:
+	lw	$13, 6($sp)
+	lw	$12, 7($sp)
+	addu	$13, $13, $12
+	lw	$12, rootfs_disk_size($0)
+	sleu	$13, $13, $12
+	bnez	$13, L.17
+	lw	$13, rootfs_disk_size($0)
+	lw	$12, 6($sp)
+	subu	$13, $13, $12
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sw	$13, 7($sp)
+L.17:
+	lw	$13, 6($sp)
+	lw	$12, rootfs_disk($0)
+	addu	$6, $13, $12
+	j	L.20
+L.19:
+	lw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.22
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	lw	$12, 5($sp)
+	addui	$11, $12, 1
+	sw	$11, 5($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+	j	L.23
+L.22:
+	lw	$13, 5($sp)
+	addui	$12, $13, 1
+	sw	$12, 5($sp)
+	addu	$12, $0, $6
+	addui	$6, $12, 1
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.23:
+L.20:
+	addu	$13, $0, $7
+	subi	$7, $13, 1
+	sgt	$13, $13, $0
+	bnez	$13, L.19
+	lw	$13, 7($sp)
+	addu	$1, $0, $13
+L.14:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	blk_dev_io_read
+blk_dev_io_read:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	blk_dev_io_read_write
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.24:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	blk_dev_io_write
+blk_dev_io_write:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	addui	$13, $0, 1
+	sw	$13, 3($sp)
+	jal	blk_dev_io_read_write
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.25:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	__blk_dev_init
+__blk_dev_init:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	sw	$13, rootfs_disk_size($0)
+	lw	$13, 7($sp)
+	sw	$13, rootfs_disk($0)
+	la	$13, root_sb
+	sw	$13, 0($sp)
+	lw	$13, rootfs_disk($0)
+	sw	$13, 1($sp)
+	addui	$13, $0, 49
+	sw	$13, 2($sp)
+	jal	memcpy
+	la	$13, root_sb
+	sw	$13, 0($sp)
+	jal	arch_superblock
+	lw	$13, root_sb($0)
+	lhi	$12, 0xabcd
+	ori	$12, $12, 0xefff
+	sneu	$13, $13, $12
+	bnez	$13, L.29
+	addui	$7, $0, 1
+	j	L.30
+L.29:
+	addu	$7, $0, $0
+L.30:
+	sw	$7, 0($sp)
+	addui	$13, $0, 62
+	sw	$13, 1($sp)
+	la	$13, L.28
+	sw	$13, 2($sp)
+	jal	_assert
+L.26:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	disk_rle_expand
+disk_rle_expand:
+	subui	$sp, $sp, 11
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	addu	$5, $13, $12
+	lw	$13, 11($sp)
+	sw	$13, 10($sp)
+	lw	$13, 12($sp)
+	lw	$12, 11($sp)
+	addu	$4, $13, $12
+	j	L.33
+L.32:
+	lw	$13, 13($sp)
+	addui	$12, $13, 1
+	sw	$12, 13($sp)
+	lw	$6, 0($13)
+	lhi	$13, 0x7fff
+	ori	$13, $13, 0xffff
+	and	$7, $6, $13
+	addu	$13, $0, $4
+	lw	$12, 11($sp)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	sleu	$13, $7, $13
+	bnez	$13, L.35
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.31
+L.35:
+	lhi	$13, 0x8000
+	ori	$13, $13, 0x0
+	and	$13, $6, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.37
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 1
+	multu	$13, $13, $7
+	sw	$13, 2($sp)
+	jal	memset
+	j	L.38
+L.37:
+	addu	$13, $0, $5
+	lw	$12, 13($sp)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	sleu	$13, $7, $13
+	bnez	$13, L.39
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.31
+L.39:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	multu	$13, $13, $7
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 13($sp)
+	addu	$13, $7, $13
+	sw	$13, 13($sp)
+L.38:
+	lw	$13, 11($sp)
+	addu	$13, $7, $13
+	sw	$13, 11($sp)
+L.33:
+	lw	$13, 13($sp)
+	addu	$13, $0, $13
+	addu	$12, $0, $5
+	sltu	$13, $13, $12
+	bnez	$13, L.32
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	lw	$12, 10($sp)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$1, $0, $13
+L.31:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	blk_dev_init
+blk_dev_init:
+	subui	$sp, $sp, 9
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$7, DISK_RAW_SIZE($0)
+	la	$13, DISK_RAW
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	la	$13, DISK_RLE
+	sw	$13, 2($sp)
+	lw	$13, DISK_RLE_LEN($0)
+	sw	$13, 3($sp)
+	jal	disk_rle_expand
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $7
+	bnez	$13, L.43
+	addui	$6, $0, 1
+	j	L.44
+L.43:
+	addu	$6, $0, $0
+L.44:
+	sw	$6, 0($sp)
+	addui	$13, $0, 151
+	sw	$13, 1($sp)
+	la	$13, L.28
+	sw	$13, 2($sp)
+	jal	_assert
+	la	$13, DISK_RAW
+	sw	$13, 0($sp)
+	lw	$13, DISK_RAW_SIZE($0)
+	sw	$13, 1($sp)
+	jal	__blk_dev_init
+	addu	$1, $0, $0
+L.41:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	arch_superblock
+arch_superblock:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	addui	$12, $13, 6
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	divu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 5
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	divu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 9
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	divu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 11
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	divu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 13
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	divu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 15
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	divu	$13, $11, $13
+	sw	$13, 0($12)
+L.45:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	dearch_superblock
+dearch_superblock:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	addui	$12, $13, 6
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	multu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 5
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	multu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 9
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	multu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 11
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	multu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 13
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	multu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 4($sp)
+	addui	$12, $13, 15
+	lw	$11, 0($12)
+	addui	$10, $0, 32
+	lw	$13, 16($13)
+	divu	$13, $10, $13
+	multu	$13, $11, $13
+	sw	$13, 0($12)
+L.46:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	blk_dev_release
+blk_dev_release:
+	addu	$1, $0, $0
+L.47:
+	jr	$ra
+init_block:
+	addu	$1, $0, $0
+L.48:
+	jr	$ra
+retrieve_block:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 6($sp)
+	slli	$7, $13, 8
+	lw	$13, rootfs_disk_size($0)
+	sltu	$13, $7, $13
+	bnez	$13, L.50
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffe4
+	sw	$13, 3($sp)
+	lw	$1, 3($sp)
+	j	L.49
+L.50:
+	lw	$13, 4($sp)
+	lw	$12, rootfs_disk($0)
+	addu	$12, $7, $12
+	sw	$12, 0($13)
+	addui	$1, $0, 256
+L.49:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+flush_block:
+	addui	$1, $0, 256
+L.52:
+	jr	$ra
+release_block:
+	addu	$1, $0, $0
+L.53:
+	jr	$ra
+bops:
+	.word	init_block
+	.word	retrieve_block
+	.word	flush_block
+	.word	release_block
+.global	root_fs_read_write
+.text
+root_fs_read_write:
+	subui	$sp, $sp, 22
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$11, 10($sp)
+	sw	$12, 11($sp)
+	sw	$13, 12($sp)
+	sw	$ra, 13($sp)
+	addu	$2, $0, $0
+	sw	$0, 18($sp)
+	addu	$3, $0, $0
+	lw	$13, 25($sp)
+	srli	$12, $13, 8
+	sw	$12, 17($sp)
+	addui	$12, $0, 255
+	and	$6, $13, $12
+	lw	$13, 22($sp)
+	lw	$13, 3($13)
+	sw	$13, 18($sp)
+	lw	$13, 26($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.55
+	lw	$13, 18($sp)
+	lw	$13, 4($13)
+	lw	$12, 25($sp)
+	subu	$13, $13, $12
+	sw	$13, 16($sp)
+	lw	$13, 24($sp)
+	lw	$12, 16($sp)
+	sgeu	$13, $13, $12
+	bnez	$13, L.58
+	lw	$13, 24($sp)
+	sw	$13, 15($sp)
+	j	L.59
+L.58:
+	lw	$13, 16($sp)
+	sw	$13, 15($sp)
+L.59:
+	lw	$13, 15($sp)
+	sw	$13, 24($sp)
+L.55:
+	addui	$13, $sp, 20
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	lw	$13, 17($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	_iter_zone_init
+	j	L.61
+L.60:
+	addui	$13, $sp, 20
+	sw	$13, 0($sp)
+	jal	iter_zone_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.63
+	lw	$13, 26($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.65
+	j	L.62
+L.65:
+	addui	$13, $sp, 20
+	sw	$13, 0($sp)
+	jal	iter_zone_alloc
+	addu	$13, $0, $1
+	sw	$13, 19($sp)
+	lw	$13, 19($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.67
+	sne	$13, $2, $0
+	bnez	$13, L.62
+	lw	$2, 19($sp)
+	j	L.62
+L.67:
+L.63:
+	addui	$13, $sp, 20
+	sw	$13, 0($sp)
+	jal	iter_zone_get_next
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	addui	$13, $0, 256
+	subu	$13, $13, $6
+	lw	$12, 24($sp)
+	sleu	$13, $13, $12
+	bnez	$13, L.72
+	lw	$13, 24($sp)
+	sw	$13, 16($sp)
+	j	L.73
+L.72:
+	addui	$13, $0, 256
+	subu	$13, $13, $6
+	sw	$13, 16($sp)
+L.73:
+	lw	$5, 16($sp)
+	addu	$7, $0, $0
+	lw	$13, 22($sp)
+	lw	$13, 1($13)
+	lhi	$12, 0x8
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.74
+	slli	$13, $4, 8
+	addu	$6, $6, $13
+	lw	$13, 23($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$5, 2($sp)
+	lw	$13, 26($sp)
+	sw	$13, 3($sp)
+	jal	blk_dev_io_read_write
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 23($sp)
+	addu	$13, $7, $13
+	sw	$13, 23($sp)
+	j	L.75
+L.74:
+	sw	$5, 14($sp)
+	sw	$4, 0($sp)
+	lw	$13, 22($sp)
+	lw	$13, 5($13)
+	sw	$13, 1($sp)
+	jal	get_block_buffer
+	addu	$13, $0, $1
+	addu	$3, $0, $13
+	lw	$13, 0($3)
+	addu	$13, $6, $13
+	sw	$13, 15($sp)
+	j	L.77
+L.76:
+	lw	$13, 26($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.79
+	lw	$13, 15($sp)
+	addui	$12, $13, 1
+	sw	$12, 15($sp)
+	lw	$12, 23($sp)
+	addui	$11, $12, 1
+	sw	$11, 23($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+	j	L.80
+L.79:
+	lw	$13, 23($sp)
+	addui	$12, $13, 1
+	sw	$12, 23($sp)
+	lw	$12, 15($sp)
+	addui	$11, $12, 1
+	sw	$11, 15($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.80:
+L.77:
+	lw	$13, 14($sp)
+	addui	$12, $0, 1
+	subu	$12, $13, $12
+	sw	$12, 14($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.76
+	addu	$13, $0, $5
+	add	$7, $7, $13
+	lw	$13, 26($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.81
+	addui	$13, $0, 1
+	sw	$13, 5($3)
+L.81:
+	sw	$3, 0($sp)
+	jal	put_block_buffer
+L.75:
+	sne	$13, $7, $0
+	bnez	$13, L.83
+	j	L.62
+L.83:
+	lw	$13, 24($sp)
+	subu	$13, $13, $5
+	sw	$13, 24($sp)
+	add	$2, $2, $7
+	lw	$13, 22($sp)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	addu	$11, $0, $7
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 26($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.85
+	lw	$13, 22($sp)
+	lw	$13, 3($13)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	addu	$11, $0, $7
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+L.85:
+	addu	$6, $0, $0
+L.61:
+	lw	$13, 24($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.60
+L.62:
+	addui	$13, $sp, 20
+	sw	$13, 0($sp)
+	jal	iter_zone_close
+	addu	$1, $0, $2
+L.54:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$11, 10($sp)
+	lw	$12, 11($sp)
+	lw	$13, 12($sp)
+	lw	$ra, 13($sp)
+	addui	$sp, $sp, 22
+	jr	$ra
+.global	root_fs_read
+root_fs_read:
+	subui	$sp, $sp, 7
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	lw	$13, 10($sp)
+	sw	$13, 3($sp)
+	sw	$0, 4($sp)
+	jal	root_fs_read_write
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.87:
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	root_fs_write
+root_fs_write:
+	subui	$sp, $sp, 7
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	lw	$13, 10($sp)
+	sw	$13, 3($sp)
+	addui	$13, $0, 1
+	sw	$13, 4($sp)
+	jal	root_fs_read_write
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.88:
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	root_fs_open
+root_fs_open:
+	addu	$1, $0, $0
+L.89:
+	jr	$ra
+.global	root_fs_close
+root_fs_close:
+	subui	$sp, $sp, 6
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	lw	$13, 2($13)
+	sne	$13, $13, $0
+	bnez	$13, L.91
+	lw	$13, 7($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	put_inode
+	lw	$13, 7($sp)
+	lw	$13, 3($13)
+	sw	$13, 5($sp)
+	lw	$12, 18($13)
+	sne	$13, $12, $0
+	bnez	$13, L.93
+	lw	$13, 5($sp)
+	lw	$13, 1($13)
+	sneu	$13, $13, $0
+	bnez	$13, L.93
+	lw	$13, 7($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	_release_inode
+L.93:
+L.91:
+	addu	$1, $0, $0
+L.90:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	root_fs_ioctl
+root_fs_ioctl:
+	addu	$1, $0, $0
+L.95:
+	jr	$ra
+dops:
+	.word	blk_dev_init
+	.word	blk_dev_io_read
+	.word	blk_dev_io_write
+	.word	blk_dev_release
+ops:
+	.word	root_fs_open
+	.word	root_fs_read
+	.word	root_fs_write
+	.word	root_fs_close
+	.word	root_fs_ioctl
+.global	init_root_fs
+.text
+init_root_fs:
+	subui	$sp, $sp, 8
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	la	$13, bops
+	sw	$13, rootfs_dev+7($0)
+	la	$13, rootfs_dev
+	sw	$13, 0($sp)
+	lw	$13, DEVICE_NAME($0)
+	sw	$13, 1($sp)
+	lw	$13, devid($0)
+	sw	$13, 2($sp)
+	addui	$13, $0, 0x8000
+	sw	$13, 3($sp)
+	la	$13, dops
+	sw	$13, 4($sp)
+	la	$13, ops
+	sw	$13, 5($sp)
+	jal	register_device
+L.96:
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.bss
+.global	root_sb
+root_sb:
+	.space	49
+.global	rootfs_dev
+rootfs_dev:
+	.space	9
+rootfs_disk_size:
+	.space	1
+rootfs_disk:
+	.space	1
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.28:
+	.asciiz	"fs/rootfs.c"
+L.10:
+	.asciiz	"wfs"
+L.9:
+	.asciiz	"sda"
@@ -0,0 +1,320 @@
+.global	sys_chdir
+.text
+sys_chdir:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addu	$7, $0, $0
+	sw	$0, 8($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 8
+	sw	$13, 2($sp)
+	jal	get_inode_by_path
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	addu	$1, $0, $7
+	j	L.9
+L.10:
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.12
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffef
+	j	L.9
+L.12:
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sequ	$13, $13, $12
+	bnez	$13, L.14
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffec
+	j	L.16
+L.14:
+	lw	$13, 9($sp)
+	addui	$13, $13, 231
+	lw	$12, 0($13)
+	sw	$12, 7($sp)
+	lw	$12, 8($sp)
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $0
+	j	L.9
+L.16:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $7
+L.9:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	sys_mkdir
+sys_mkdir:
+	subui	$sp, $sp, 42
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	sw	$0, 40($sp)
+	sw	$0, 41($sp)
+	addu	$7, $0, $0
+	addu	$6, $0, $0
+	lw	$13, 42($sp)
+	sw	$13, 0($sp)
+	lw	$13, 43($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 40
+	sw	$13, 2($sp)
+	addui	$13, $sp, 41
+	sw	$13, 3($sp)
+	addui	$13, $sp, 11
+	sw	$13, 4($sp)
+	jal	eat_path
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.18
+	addu	$1, $0, $7
+	j	L.17
+L.18:
+	lw	$13, 41($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.20
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffef
+	j	L.22
+L.20:
+	lw	$13, 40($sp)
+	lw	$13, 16($13)
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	jal	alloc_inode
+	addu	$13, $0, $1
+	sw	$13, 41($sp)
+	lw	$13, 41($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.23
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffe4
+	j	L.22
+L.23:
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 42($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 16384
+	sw	$13, 2($sp)
+	lw	$13, 44($sp)
+	sw	$13, 3($sp)
+	jal	init_inode_proc_field
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 40($sp)
+	lw	$13, 16($13)
+	sw	$13, 1($sp)
+	jal	alloc_block
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sgt	$13, $5, $0
+	bnez	$13, L.25
+	addu	$7, $0, $5
+	j	L.22
+L.25:
+	lw	$13, 41($sp)
+	addu	$12, $0, $5
+	sw	$12, 8($13)
+	lw	$13, 41($sp)
+	addui	$12, $0, 256
+	sw	$12, 4($13)
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	lw	$13, 41($sp)
+	sw	$13, 1($sp)
+	jal	init_dirent
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.27
+	j	L.22
+L.27:
+	lw	$13, 42($sp)
+	sw	$13, 0($sp)
+	lw	$13, 40($sp)
+	sw	$13, 1($sp)
+	lw	$13, 41($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 11
+	sw	$13, 3($sp)
+	jal	add_inode_to_directory
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.29
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	_release_inode
+	j	L.31
+L.29:
+	addui	$6, $0, 1
+L.22:
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	put_inode
+L.31:
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $7
+L.17:
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 42
+	jr	$ra
+.global	do_chdir
+do_chdir:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.33
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.32
+L.33:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	jal	sys_chdir
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.32:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	do_mkdir
+do_mkdir:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.36
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.35
+L.36:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	sys_mkdir
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.35:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
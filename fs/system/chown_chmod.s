@@ -0,0 +1,177 @@
+.global	sys_chown
+.text
+sys_chown:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.9:
+	jr	$ra
+.global	do_chown
+do_chown:
+	subui	$sp, $sp, 8
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 9($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.11
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.10
+L.11:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	sw	$12, 2($sp)
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	sys_chown
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.10:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	sys_chmod
+sys_chmod:
+	subui	$sp, $sp, 8
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	sw	$0, 7($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 7
+	sw	$13, 2($sp)
+	jal	get_inode_by_path
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.14
+	lw	$1, 6($sp)
+	j	L.13
+L.14:
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.16
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+	j	L.13
+L.16:
+	lw	$13, 7($sp)
+	lw	$12, 10($sp)
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $0
+L.13:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_chmod
+do_chmod:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.19
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.18
+L.19:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	sys_chmod
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.18:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
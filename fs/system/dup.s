@@ -0,0 +1,249 @@
+.global	sys_dup
+.text
+sys_dup:
+	subui	$sp, $sp, 11
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.9
+L.10:
+	jal	get_free_filp
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.12
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe9
+	j	L.9
+L.12:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	sw	$6, 3($sp)
+	jal	get_fd
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.14
+	lw	$1, 9($sp)
+	j	L.9
+L.14:
+	lw	$13, 11($sp)
+	addui	$13, $13, 214
+	lw	$12, 12($sp)
+	addu	$12, $12, $13
+	lw	$7, 0($12)
+	lw	$12, 10($sp)
+	addu	$13, $12, $13
+	sw	$7, 0($13)
+	addui	$13, $7, 2
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$1, 10($sp)
+L.9:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	sys_dup2
+sys_dup2:
+	subui	$sp, $sp, 12
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.17
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.16
+L.17:
+	lw	$13, 14($sp)
+	sw	$13, 10($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.21
+	lw	$13, 10($sp)
+	slti	$13, $13, 16
+	bnez	$13, L.19
+L.21:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.16
+L.19:
+	jal	get_free_filp
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.22
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe9
+	j	L.16
+L.22:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	sw	$5, 3($sp)
+	jal	get_fd
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $6, $0
+	bnez	$13, L.24
+	addu	$1, $0, $6
+	j	L.16
+L.24:
+	lw	$13, 14($sp)
+	lw	$12, 12($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.26
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	jal	sys_close
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $6, $0
+	bnez	$13, L.28
+	addu	$1, $0, $6
+	j	L.16
+L.28:
+L.26:
+	lw	$13, 13($sp)
+	lw	$12, 12($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$7, 0($13)
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.30
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.16
+L.30:
+	lw	$13, 14($sp)
+	lw	$12, 12($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	sw	$7, 0($13)
+	addui	$13, $7, 2
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$1, 14($sp)
+L.16:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	do_dup
+do_dup:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	jal	sys_dup
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.32:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	do_dup2
+do_dup2:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	lw	$12, 2($13)
+	sw	$12, 1($sp)
+	lw	$13, 3($13)
+	sw	$13, 2($sp)
+	jal	sys_dup2
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.33:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,211 @@
+.global	sys_getcwd
+.text
+sys_getcwd:
+	subui	$sp, $sp, 42
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	sw	$0, 12($sp)
+	lw	$13, 44($sp)
+	sgti	$13, $13, 1
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffde
+	j	L.9
+L.10:
+	lw	$13, 44($sp)
+	lw	$12, 43($sp)
+	addu	$13, $13, $12
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	addu	$5, $13, $12
+	sw	$0, 0($5)
+	addui	$13, $0, 1
+	addu	$3, $0, $13
+	lw	$13, 42($sp)
+	lw	$7, 231($13)
+	addui	$13, $7, 18
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	j	L.13
+L.12:
+	sw	$7, 0($sp)
+	jal	get_parent_inode_num
+	addu	$13, $0, $1
+	addu	$2, $0, $13
+	sw	$2, 0($sp)
+	lw	$13, 16($7)
+	sw	$13, 1($sp)
+	jal	get_inode
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	sw	$4, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $sp, 13
+	sw	$13, 2($sp)
+	jal	get_child_inode_name
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.15
+	sw	$6, 12($sp)
+	j	L.17
+L.15:
+	sw	$7, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	addu	$7, $0, $4
+	addi	$13, $6, 1
+	add	$3, $3, $13
+	lw	$13, 44($sp)
+	slt	$13, $3, $13
+	bnez	$13, L.18
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffde
+	sw	$13, 12($sp)
+	j	L.17
+L.18:
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	addu	$13, $5, $13
+	addu	$5, $0, $13
+	addui	$12, $0, 47
+	sw	$12, 0($13)
+	subu	$5, $5, $6
+	sw	$5, 0($sp)
+	addui	$13, $sp, 13
+	sw	$13, 1($sp)
+	addu	$13, $0, $6
+	sw	$13, 2($sp)
+	jal	memcpy
+L.13:
+	lw	$13, 17($7)
+	snei	$13, $13, 1
+	bnez	$13, L.12
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	addu	$13, $5, $13
+	addu	$5, $0, $13
+	addui	$12, $0, 47
+	sw	$12, 0($13)
+L.17:
+	sw	$7, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$13, 45($sp)
+	sw	$5, 0($13)
+	lw	$1, 12($sp)
+L.9:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 42
+	jr	$ra
+.global	do_getcwd
+do_getcwd:
+	subui	$sp, $sp, 12
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 13($sp)
+	lw	$7, 2($13)
+	lw	$13, 13($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addu	$13, $0, $7
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.21
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.20
+L.21:
+	lw	$13, 12($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$11, 13($sp)
+	lw	$11, 5($11)
+	addu	$12, $12, $11
+	sw	$12, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	addui	$13, $sp, 10
+	sw	$13, 3($sp)
+	jal	sys_getcwd
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	lw	$13, 11($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.23
+	lw	$1, 11($sp)
+	j	L.20
+L.23:
+	lw	$13, 10($sp)
+	lw	$12, 12($sp)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	addu	$1, $0, $13
+L.20:
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,202 @@
+.global	sys_getdents
+.text
+sys_getdents:
+	subui	$sp, $sp, 18
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addu	$6, $0, $0
+	lw	$13, 18($sp)
+	sw	$13, 0($sp)
+	lw	$13, 19($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.9
+L.10:
+	lw	$13, 19($sp)
+	lw	$12, 18($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$5, 0($13)
+	lw	$4, 3($5)
+	lw	$13, 0($4)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sequ	$13, $13, $12
+	bnez	$13, L.12
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffec
+	j	L.9
+L.12:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	sw	$4, 1($sp)
+	lw	$13, 9($5)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	lw	$13, 10($5)
+	sw	$13, 3($sp)
+	sw	$0, 4($sp)
+	jal	_iter_dirent_init
+	j	L.15
+L.14:
+	lw	$13, 21($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.17
+	j	L.16
+L.17:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	jal	iter_dirent_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 0($7)
+	sle	$13, $13, $0
+	bnez	$13, L.19
+	lw	$13, 20($sp)
+	addui	$12, $13, 31
+	sw	$12, 20($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $0, 31
+	sw	$13, 2($sp)
+	jal	memcpy
+	addu	$13, $0, $6
+	addui	$12, $0, 31
+	addu	$13, $13, $12
+	addu	$6, $0, $13
+	lw	$13, 21($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	sw	$13, 21($sp)
+L.19:
+L.15:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	jal	iter_dirent_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.14
+L.16:
+	lw	$13, 16($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	sw	$13, 9($5)
+	lw	$13, 12($sp)
+	addu	$13, $0, $13
+	lw	$12, 14($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	divi	$13, $13, 32
+	sw	$13, 10($5)
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	addu	$1, $0, $6
+L.9:
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 18
+	jr	$ra
+.global	do_getdents
+do_getdents:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 10($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	lw	$7, 3($13)
+	lw	$13, 10($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 31
+	addu	$12, $0, $7
+	multu	$13, $13, $12
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.25
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.24
+L.25:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	addu	$13, $0, $7
+	sw	$13, 3($sp)
+	jal	sys_getdents
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.24:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
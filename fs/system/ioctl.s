@@ -0,0 +1,100 @@
+.global	_sys_ioctl
+.text
+_sys_ioctl:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.9
+L.10:
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$7, 0($13)
+	sw	$7, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	lw	$13, 5($7)
+	lw	$13, 6($13)
+	lw	$13, 4($13)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.9:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	do_ioctl
+do_ioctl:
+	subui	$sp, $sp, 7
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	lw	$12, 2($13)
+	sw	$12, 1($sp)
+	lw	$12, 3($13)
+	sw	$12, 2($sp)
+	lw	$13, 5($13)
+	sw	$13, 3($sp)
+	jal	_sys_ioctl
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.12:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,328 @@
+.global	sys_link
+.text
+sys_link:
+	subui	$sp, $sp, 41
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, 40($sp)
+	sw	$0, 39($sp)
+	sw	$0, 38($sp)
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 42($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 40
+	sw	$13, 2($sp)
+	jal	get_inode_by_path
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	j	L.12
+L.10:
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 43($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 38
+	sw	$13, 2($sp)
+	addui	$13, $sp, 39
+	sw	$13, 3($sp)
+	addui	$13, $sp, 9
+	sw	$13, 4($sp)
+	jal	eat_path
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.13
+	j	L.15
+L.13:
+	lw	$13, 39($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.16
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffef
+	j	L.15
+L.16:
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 38($sp)
+	sw	$13, 1($sp)
+	lw	$13, 40($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 9
+	sw	$13, 3($sp)
+	jal	add_inode_to_directory
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.15:
+	lw	$13, 39($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.18
+	lw	$13, 39($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+L.18:
+	lw	$13, 38($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, 38($sp)
+	sw	$13, 0($sp)
+	sne	$13, $7, $0
+	bnez	$13, L.23
+	addui	$6, $0, 1
+	j	L.24
+L.23:
+	addu	$6, $0, $0
+L.24:
+	sw	$6, 1($sp)
+	jal	put_inode
+L.20:
+L.12:
+	lw	$13, 40($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.25
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+L.25:
+	addu	$1, $0, $7
+L.9:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 41
+	jr	$ra
+.global	sys_unlink
+sys_unlink:
+	subui	$sp, $sp, 41
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, 39($sp)
+	sw	$0, 40($sp)
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 42($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 39
+	sw	$13, 2($sp)
+	addui	$13, $sp, 40
+	sw	$13, 3($sp)
+	addui	$13, $sp, 10
+	sw	$13, 4($sp)
+	jal	eat_path
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.28
+	j	L.30
+L.28:
+	lw	$13, 40($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.31
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xfffe
+	j	L.30
+L.31:
+	lw	$13, 43($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.33
+	lw	$13, 40($sp)
+	lw	$13, 0($13)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sneu	$13, $13, $12
+	bnez	$13, L.33
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffeb
+	j	L.35
+L.33:
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 39($sp)
+	sw	$13, 1($sp)
+	lw	$13, 40($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 10
+	sw	$13, 3($sp)
+	jal	remove_inode_from_dir
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$13, 40($sp)
+	sw	$13, 9($sp)
+	lw	$12, 1($13)
+	sneu	$13, $12, $0
+	bnez	$13, L.30
+	lw	$13, 9($sp)
+	lw	$13, 18($13)
+	sne	$13, $13, $0
+	bnez	$13, L.30
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	_release_inode
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.30
+L.35:
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+L.30:
+	lw	$13, 39($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $7
+L.27:
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 41
+	jr	$ra
+.global	do_link
+do_link:
+	subui	$sp, $sp, 7
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.41
+	lw	$13, 8($sp)
+	lw	$13, 6($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.39
+L.41:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.38
+L.39:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	lw	$11, 5($12)
+	addu	$11, $13, $11
+	sw	$11, 1($sp)
+	lw	$12, 6($12)
+	addu	$13, $13, $12
+	sw	$13, 2($sp)
+	jal	sys_link
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.38:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	do_unlink
+do_unlink:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.43
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.42
+L.43:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	sys_unlink
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.42:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,246 @@
+.global	extend_file
+.text
+extend_file:
+	subui	$sp, $sp, 13
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addu	$5, $0, $0
+	lw	$13, 13($sp)
+	lw	$3, 3($13)
+	sw	$3, 0($sp)
+	jal	get_inode_total_size_word
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	lw	$13, 15($sp)
+	snei	$13, $13, 2
+	bnez	$13, L.10
+	lw	$13, 14($sp)
+	addu	$12, $0, $4
+	addu	$13, $13, $12
+	sw	$13, 14($sp)
+L.10:
+	lw	$13, 14($sp)
+	addu	$12, $0, $4
+	sgeu	$13, $13, $12
+	bnez	$13, L.12
+	lw	$13, 13($sp)
+	lw	$12, 14($sp)
+	sw	$12, 4($13)
+	lw	$13, 14($sp)
+	addu	$1, $0, $13
+	j	L.9
+L.12:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	sw	$3, 1($sp)
+	sw	$0, 2($sp)
+	jal	_iter_zone_init
+	lw	$13, 14($sp)
+	addu	$12, $0, $4
+	subu	$13, $13, $12
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1023
+	addu	$6, $13, $12
+L.14:
+L.15:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_zone_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.14
+	j	L.18
+L.17:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_zone_alloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.20
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_zone_close
+	addu	$1, $0, $7
+	j	L.9
+L.20:
+	addui	$13, $0, 256
+	addu	$5, $5, $13
+	subu	$6, $6, $13
+L.18:
+	sneu	$13, $6, $0
+	bnez	$13, L.17
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_zone_close
+	addu	$1, $0, $5
+L.9:
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	sys_lseek
+sys_lseek:
+	subui	$sp, $sp, 9
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.23
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.22
+L.23:
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	lw	$13, 3($13)
+	lw	$13, 21($13)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.25
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe3
+	j	L.22
+L.25:
+	lw	$13, 12($sp)
+	sw	$13, 6($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.29
+	lw	$13, 6($sp)
+	seqi	$13, $13, 1
+	bnez	$13, L.30
+	lw	$13, 6($sp)
+	seqi	$13, $13, 2
+	bnez	$13, L.31
+	j	L.27
+L.29:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	extend_file
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	j	L.28
+L.30:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 4($13)
+	lw	$12, 11($sp)
+	addu	$13, $13, $12
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	extend_file
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	j	L.28
+L.31:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	extend_file
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	j	L.28
+L.27:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.22
+L.28:
+	lw	$1, 7($sp)
+L.22:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_lseek
+do_lseek:
+	subui	$sp, $sp, 7
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	lw	$12, 2($13)
+	sw	$12, 1($sp)
+	lw	$12, 3($13)
+	addu	$12, $0, $12
+	sw	$12, 2($sp)
+	lw	$13, 4($13)
+	sw	$13, 3($sp)
+	jal	sys_lseek
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.32:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
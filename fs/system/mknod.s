@@ -0,0 +1,200 @@
+.global	sys_mknod
+.text
+sys_mknod:
+	subui	$sp, $sp, 41
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	sw	$0, 40($sp)
+	sw	$0, 39($sp)
+	lw	$13, 44($sp)
+	sw	$13, 0($sp)
+	jal	get_dev
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffa
+	j	L.9
+L.10:
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 42($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 39
+	sw	$13, 2($sp)
+	addui	$13, $sp, 40
+	sw	$13, 3($sp)
+	addui	$13, $sp, 10
+	sw	$13, 4($sp)
+	jal	eat_path
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.12
+	addu	$1, $0, $7
+	j	L.9
+L.12:
+	lw	$13, 40($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.16
+	lw	$13, 10($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.14
+L.16:
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffef
+	j	L.17
+L.14:
+	lw	$13, 39($sp)
+	lw	$13, 16($13)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	alloc_inode
+	addu	$13, $0, $1
+	sw	$13, 40($sp)
+	lw	$13, 40($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.18
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffe4
+	j	L.17
+L.18:
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	lw	$13, 39($sp)
+	sw	$13, 1($sp)
+	lw	$13, 40($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 10
+	sw	$13, 3($sp)
+	jal	add_inode_to_directory
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	_release_inode
+	j	L.17
+L.20:
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	lw	$13, 41($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($6)
+	sw	$13, 2($sp)
+	lw	$13, 43($sp)
+	sw	$13, 3($sp)
+	jal	init_inode_proc_field
+L.17:
+	lw	$13, 40($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$13, 39($sp)
+	sw	$13, 0($sp)
+	sne	$13, $7, $0
+	bnez	$13, L.23
+	addui	$5, $0, 1
+	j	L.24
+L.23:
+	addu	$5, $0, $0
+L.24:
+	sw	$5, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $7
+L.9:
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 41
+	jr	$ra
+.global	do_mknod
+do_mknod:
+	subui	$sp, $sp, 8
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.26
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.25
+L.26:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$12, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$11, 5($12)
+	addu	$13, $13, $11
+	sw	$13, 1($sp)
+	lw	$13, 2($12)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	lw	$13, 3($12)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	sys_mknod
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.25:
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
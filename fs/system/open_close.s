@@ -0,0 +1,525 @@
+.global	filp_close
+.text
+filp_close:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$12, 5($13)
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 6($12)
+	lw	$13, 3($13)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.9:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	sys_close
+sys_close:
+	subui	$sp, $sp, 7
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.11
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.10
+L.11:
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 5($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	filp_close
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.13
+	lw	$1, 6($sp)
+	j	L.10
+L.13:
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	sw	$0, 0($13)
+	addu	$1, $0, $0
+L.10:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	alloc_inode_under_dir
+alloc_inode_under_dir:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 11($sp)
+	lw	$13, 16($13)
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	jal	alloc_inode
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.16
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe4
+	j	L.15
+L.16:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	add_inode_to_directory
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.18
+	sw	$7, 0($sp)
+	sw	$0, 1($sp)
+	jal	_release_inode
+	lw	$1, 7($sp)
+	j	L.15
+L.18:
+	lw	$13, 10($sp)
+	sw	$7, 0($13)
+	addu	$1, $0, $0
+L.15:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	filp_open
+filp_open:
+	subui	$sp, $sp, 46
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	sw	$0, 45($sp)
+	sw	$0, 44($sp)
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, start_unix_time($0)
+	addui	$11, $0, 60
+	divu	$13, $13, $11
+	addu	$13, $12, $13
+	sw	$13, 42($sp)
+	sw	$0, 43($sp)
+	lw	$13, 46($sp)
+	sw	$13, 0($sp)
+	lw	$13, 48($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 44
+	sw	$13, 2($sp)
+	addui	$13, $sp, 45
+	sw	$13, 3($sp)
+	addui	$13, $sp, 13
+	sw	$13, 4($sp)
+	jal	eat_path
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.21
+	addu	$1, $0, $6
+	j	L.20
+L.21:
+	lw	$13, 44($sp)
+	lw	$13, 16($13)
+	sw	$13, 12($sp)
+	lw	$13, 45($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.23
+	lw	$13, 49($sp)
+	sw	$13, 11($sp)
+	addu	$12, $0, $0
+	andi	$11, $13, 512
+	seq	$13, $11, $12
+	bnez	$13, L.24
+	lw	$13, 11($sp)
+	andi	$13, $13, 256
+	seq	$13, $13, $12
+	bnez	$13, L.24
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffef
+	j	L.27
+L.23:
+	lw	$13, 13($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.28
+	lw	$13, 49($sp)
+	andi	$13, $13, 256
+	sne	$13, $13, $0
+	bnez	$13, L.30
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xfffe
+	j	L.27
+L.30:
+	lw	$13, 46($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 45
+	sw	$13, 2($sp)
+	lw	$13, 44($sp)
+	sw	$13, 3($sp)
+	addui	$13, $sp, 13
+	sw	$13, 4($sp)
+	jal	alloc_inode_under_dir
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.32
+	j	L.27
+L.32:
+	lw	$13, 45($sp)
+	sw	$13, 0($sp)
+	lw	$13, 46($sp)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	lw	$13, 2($13)
+	sw	$13, 2($sp)
+	lw	$13, 50($sp)
+	sw	$13, 3($sp)
+	jal	init_inode_proc_field
+	addui	$13, $0, 1
+	sw	$13, 43($sp)
+	j	L.29
+L.28:
+	lw	$13, 49($sp)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.34
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffeb
+	j	L.27
+L.34:
+	lw	$13, 44($sp)
+	sw	$13, 45($sp)
+L.29:
+L.24:
+	jal	get_free_filp
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.36
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe9
+	j	L.20
+L.36:
+	lw	$13, 49($sp)
+	andi	$13, $13, 4096
+	seq	$13, $13, $0
+	bnez	$13, L.38
+	lw	$13, 45($sp)
+	sw	$13, 0($sp)
+	jal	truncate_inode
+L.38:
+	sw	$7, 0($sp)
+	lw	$13, 45($sp)
+	sw	$13, 1($sp)
+	jal	init_filp_by_inode
+	lw	$13, 49($sp)
+	andi	$13, $13, 8192
+	seq	$13, $13, $0
+	bnez	$13, L.40
+	lw	$13, 45($sp)
+	lw	$13, 4($13)
+	sw	$13, 4($7)
+L.40:
+	lw	$13, 50($sp)
+	sw	$13, 0($7)
+	lw	$13, 49($sp)
+	addu	$13, $0, $13
+	sw	$13, 1($7)
+	lw	$13, 45($sp)
+	lw	$12, 42($sp)
+	sw	$12, 5($13)
+	lw	$13, 45($sp)
+	lw	$13, 16($13)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 6($13)
+	lw	$13, 0($13)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.42
+	j	L.27
+L.42:
+	lw	$13, 47($sp)
+	sw	$7, 0($13)
+L.27:
+	lw	$13, 44($sp)
+	sw	$13, 0($sp)
+	lw	$13, 43($sp)
+	sw	$13, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $6
+L.20:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 46
+	jr	$ra
+.global	sys_open
+sys_open:
+	subui	$sp, $sp, 11
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 10
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	lw	$13, 13($sp)
+	sw	$13, 3($sp)
+	lw	$13, 14($sp)
+	sw	$13, 4($sp)
+	jal	filp_open
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.45
+	addu	$1, $0, $7
+	j	L.44
+L.45:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	lw	$13, 10($sp)
+	sw	$13, 3($sp)
+	jal	get_fd
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.47
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	jal	filp_close
+	addu	$1, $0, $7
+	j	L.44
+L.47:
+	lw	$13, 9($sp)
+	lw	$12, 11($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$12, 10($sp)
+	sw	$12, 0($13)
+	lw	$1, 9($sp)
+L.44:
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	sys_creat
+sys_creat:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 768
+	sw	$13, 2($sp)
+	lw	$13, 8($sp)
+	sw	$13, 3($sp)
+	jal	sys_open
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.49:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	do_open
+do_open:
+	subui	$sp, $sp, 10
+	sw	$10, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 11($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.51
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.50
+L.51:
+	lw	$13, 10($sp)
+	lw	$12, 11($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	lw	$10, 5($12)
+	addu	$11, $11, $10
+	sw	$11, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($12)
+	sw	$13, 2($sp)
+	lw	$13, 3($12)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	sys_open
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.50:
+	lw	$10, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	do_creat
+do_creat:
+	subui	$sp, $sp, 9
+	sw	$10, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.54
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.53
+L.54:
+	lw	$13, 9($sp)
+	lw	$12, 10($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	lw	$10, 5($12)
+	addu	$11, $11, $10
+	sw	$11, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($12)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	sys_creat
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.53:
+	lw	$10, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_close
+do_close:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	jal	sys_close
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.56:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.extern	next_timeout 1
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
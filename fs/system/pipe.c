@@ -14,6 +14,9 @@ static dev_t pipe_devid = MAKEDEV(2, 1);
 #define PIPE_LIMIT  (PAGE_LEN)
 #define PIPE_INODE_INUM (INT_MAX)
 
+static struct kmem_cache *pipe_cache;
+static struct kmem_cache *pipe_waiting_cache;
+
 struct pipe_waiting{
     struct proc* who;
     int sys_call_num;
@@ -59,7 +62,7 @@ int sys_pipe(struct proc* who, int fd[2]){
     if(!ptr)
         return -ENOMEM;
 
-    pipe = kmalloc(1, sizeof(struct filp_pipe));
+    pipe = kmem_cache_alloc(pipe_cache);
     if(!pipe){
         ret = -ENOMEM;
         goto failed_filp_pipe;
@@ -112,7 +115,7 @@ int sys_pipe(struct proc* who, int fd[2]){
     inode->i_count = 0;
 
     failed_filp_slot:
-    kfree(pipe);
+    kmem_cache_free(pipe_cache, pipe);
 
     failed_filp_pipe:
     release_pages((ptr_t *)ptr, PAGE_LEN);
@@ -188,7 +191,7 @@ int pipe_read ( struct filp *filp, char *data, size_t count, off_t offset){
         if(ino->i_count == 1) // write end is closed
             return 0;
 
-        next = (struct pipe_waiting*)kmalloc(1, sizeof(struct pipe_waiting));
+        next = (struct pipe_waiting*)kmem_cache_alloc(pipe_waiting_cache);
         if(!next)
             return -ENOMEM;
         curr_syscall_caller->flags |= STATE_WAITING;
@@ -212,7 +215,7 @@ int pipe_read ( struct filp *filp, char *data, size_t count, off_t offset){
         next->who->flags &= ~STATE_WAITING;
         syscall_reply2(next->sys_call_num, ret2, next->who->proc_nr, &msg);
         kfree(next->data);
-        kfree(next);
+        kmem_cache_free(pipe_waiting_cache, next);
     }
     return ret;
 }
@@ -249,7 +252,7 @@ int pipe_write ( struct filp *filp, char *data, size_t count, off_t offset){
             ret2 = _pipe_read(next->who, next->filp, next->data, next->count, next->offset);
             next->who->flags &= ~STATE_WAITING;
             syscall_reply2(next->sys_call_num, ret2, next->who->proc_nr, &msg);
-            kfree(next);
+            kmem_cache_free(pipe_waiting_cache, next);
         }
     }
 
@@ -261,12 +264,12 @@ int pipe_write ( struct filp *filp, char *data, size_t count, off_t offset){
         if(filp->filp_flags & O_NONBLOCK)
             return 0;
         
-        next = (struct pipe_waiting*)kmalloc(1, sizeof(struct pipe_waiting));
+        next = (struct pipe_waiting*)kmem_cache_alloc(pipe_waiting_cache);
         if(!next)
             return -ENOMEM;
         p = (char *)kmalloc(count, sizeof(char));
-        if(!next){
-            kfree(next);
+        if(!p){
+            kmem_cache_free(pipe_waiting_cache, next);
             return -ENOMEM;
         }
         p2 = p;
@@ -320,13 +323,15 @@ int pipe_close ( struct device* dev, struct filp *file){
             ret = fn(next->who, next->filp, next->data, next->count, next->offset);
             next->who->flags &= ~STATE_WAITING;
             syscall_reply2(next->sys_call_num, ret, next->who->proc_nr, &msg);
-            kfree(next);
+            if(next->sys_call_num == WRITE)
+                kfree(next->data);
+            kmem_cache_free(pipe_waiting_cache, next);
             next = get_next_waiting(waiting);
         }
         if(ino->i_count == 0){
             // kdebug("Releasing pipe %d\n", file->filp_ino->i_num);
             release_pages((ptr_t *)file->pipe->data, PAGE_LEN);
-            kfree(file->pipe);
+            kmem_cache_free(pipe_cache, file->pipe);
             
             // release inode
             memset(ino, 0, sizeof(struct inode));
@@ -342,5 +347,7 @@ int pipe_close ( struct device* dev, struct filp *file){
 static struct filp_operations pipe_fops = {pipe_open, pipe_read, pipe_write, pipe_close};
 
 void init_pipe(){
+    pipe_cache = kmem_cache_create("filp_pipe", sizeof(struct filp_pipe));
+    pipe_waiting_cache = kmem_cache_create("pipe_waiting", sizeof(struct pipe_waiting));
     register_device(&pipe_dev, name, pipe_devid, S_IFIFO, NULL, &pipe_fops);
 }
@@ -0,0 +1,1144 @@
+name:
+	.word	L.9
+pipe_devid:
+	.word	0x201
+.global	set_filp
+.text
+set_filp:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	jal	get_free_filp
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.11
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe9
+	j	L.10
+L.11:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 7
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	get_fd
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.13
+	lw	$1, 8($sp)
+	j	L.10
+L.13:
+	lw	$13, 10($sp)
+	sw	$7, 0($13)
+	lw	$1, 7($sp)
+L.10:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_pipe
+do_pipe:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	lw	$7, 5($13)
+	sw	$7, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.16
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.15
+L.16:
+	lw	$13, 8($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	addu	$12, $12, $7
+	sw	$12, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	sys_pipe
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.15:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	sys_pipe
+sys_pipe:
+	subui	$sp, $sp, 16
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	addu	$3, $0, $0
+	addui	$13, $0, 1024
+	sw	$13, 13($sp)
+	lw	$13, 13($sp)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	get_free_pages
+	addu	$13, $0, $1
+	addu	$2, $0, $13
+	addu	$13, $0, $2
+	sneu	$13, $13, $0
+	bnez	$13, L.19
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.18
+L.19:
+	lw	$13, pipe_cache($0)
+	sw	$13, 0($sp)
+	jal	kmem_cache_alloc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.21
+	lhi	$3, 0xffff
+	ori	$3, $3, 0xfff4
+	j	L.23
+L.21:
+	sw	$2, 0($6)
+	sw	$0, 2($6)
+	jal	get_free_inode_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.24
+	lhi	$3, 0xffff
+	ori	$3, $3, 0xffe9
+	j	L.26
+L.24:
+	addui	$13, $7, 21
+	lw	$12, 0($13)
+	ori	$12, $12, 2
+	sw	$12, 0($13)
+	addui	$13, $0, 2
+	sw	$13, 18($7)
+	addui	$13, $0, 1
+	sw	$13, 1($7)
+	sw	$7, 0($sp)
+	lhi	$13, 0x7fff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	la	$13, pipe_dev
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	init_inode_non_disk
+	lw	$13, 16($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 15
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	set_filp
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sge	$13, $5, $0
+	bnez	$13, L.27
+	addu	$3, $0, $5
+	j	L.29
+L.27:
+	lw	$13, 15($sp)
+	addui	$12, $0, 2
+	sw	$12, 6($13)
+	lw	$13, 15($sp)
+	sw	$6, 7($13)
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	init_filp_by_inode
+	lw	$13, 16($sp)
+	addui	$13, $13, 214
+	addu	$13, $5, $13
+	lw	$12, 15($sp)
+	sw	$12, 0($13)
+	lw	$13, 17($sp)
+	sw	$5, 0($13)
+	lw	$13, 16($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 14
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	set_filp
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	sge	$13, $4, $0
+	bnez	$13, L.30
+	addu	$3, $0, $4
+	j	L.32
+L.30:
+	lw	$13, 14($sp)
+	sw	$0, 6($13)
+	lw	$13, 14($sp)
+	sw	$6, 7($13)
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	init_filp_by_inode
+	lw	$13, 16($sp)
+	addui	$13, $13, 214
+	addu	$13, $4, $13
+	lw	$12, 14($sp)
+	sw	$12, 0($13)
+	lw	$13, 17($sp)
+	sw	$4, 1($13)
+L.33:
+	addui	$13, $7, 24
+	sw	$13, 0($13)
+	addui	$13, $7, 24
+	sw	$13, 25($7)
+L.34:
+L.36:
+	addui	$13, $7, 22
+	sw	$13, 0($13)
+	addui	$13, $7, 22
+	sw	$13, 23($7)
+L.37:
+	addu	$1, $0, $0
+	j	L.18
+L.32:
+	lw	$13, 16($sp)
+	addui	$13, $13, 214
+	addu	$13, $5, $13
+	sw	$0, 0($13)
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	release_filp
+L.29:
+	sw	$0, 18($7)
+L.26:
+	lw	$13, pipe_cache($0)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	kmem_cache_free
+L.23:
+	sw	$2, 0($sp)
+	addui	$13, $0, 1024
+	sw	$13, 1($sp)
+	jal	release_pages
+	addu	$1, $0, $3
+L.18:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.global	get_next_waiting
+get_next_waiting:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.40
+	lw	$13, 2($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffa
+	addu	$1, $13, $12
+	j	L.39
+L.40:
+	addu	$1, $0, $0
+L.39:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	shift_pipe_data
+shift_pipe_data:
+	subui	$sp, $sp, 6
+	sw	$4, 0($sp)
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	lw	$13, 6($sp)
+	lw	$13, 7($13)
+	lw	$7, 0($13)
+	addu	$6, $0, $0
+	lw	$13, 6($sp)
+	lw	$13, 7($13)
+	lw	$4, 2($13)
+	j	L.44
+L.43:
+	addu	$13, $6, $7
+	lw	$12, 7($sp)
+	addu	$12, $12, $7
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	addu	$13, $13, $7
+	sw	$0, 0($13)
+	addui	$13, $0, 1
+	lw	$12, 7($sp)
+	addu	$12, $12, $13
+	sw	$12, 7($sp)
+	addu	$6, $6, $13
+L.44:
+	lw	$13, 7($sp)
+	sltu	$13, $13, $4
+	bnez	$13, L.43
+	addu	$5, $0, $6
+	j	L.47
+L.46:
+	addu	$13, $0, $5
+	addui	$12, $0, 1
+	addu	$5, $13, $12
+	addu	$13, $13, $7
+	sw	$0, 0($13)
+L.47:
+	sltu	$13, $5, $4
+	bnez	$13, L.46
+	lw	$13, 6($sp)
+	lw	$13, 7($13)
+	sw	$6, 2($13)
+L.42:
+	lw	$4, 0($sp)
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+_pipe_read:
+	subui	$sp, $sp, 10
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 11($sp)
+	lw	$13, 7($13)
+	lw	$6, 0($13)
+	lw	$13, 13($sp)
+	lw	$12, 11($sp)
+	lw	$12, 7($12)
+	lw	$12, 2($12)
+	sgeu	$13, $13, $12
+	bnez	$13, L.51
+	lw	$4, 13($sp)
+	j	L.52
+L.51:
+	lw	$13, 11($sp)
+	lw	$13, 7($13)
+	lw	$4, 2($13)
+L.52:
+	addu	$5, $0, $4
+	addu	$7, $0, $0
+	j	L.56
+L.53:
+	lw	$13, 12($sp)
+	addui	$12, $13, 1
+	sw	$12, 12($sp)
+	addu	$12, $7, $6
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.54:
+	addui	$13, $0, 1
+	addu	$7, $7, $13
+L.56:
+	sltu	$13, $7, $5
+	bnez	$13, L.53
+	addu	$13, $0, $7
+	sw	$13, 9($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	shift_pipe_data
+	lw	$1, 9($sp)
+L.49:
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+_pipe_write:
+	subui	$sp, $sp, 10
+	sw	$2, 0($sp)
+	sw	$3, 1($sp)
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	lw	$13, 11($sp)
+	lw	$13, 7($13)
+	lw	$6, 0($13)
+	lw	$5, 12($sp)
+	lw	$13, 11($sp)
+	lw	$13, 7($13)
+	lw	$3, 2($13)
+	lw	$13, 13($sp)
+	addu	$13, $3, $13
+	addui	$12, $0, 1024
+	sgeu	$13, $13, $12
+	bnez	$13, L.59
+	lw	$13, 13($sp)
+	addu	$13, $3, $13
+	sw	$13, 9($sp)
+	j	L.60
+L.59:
+	addui	$13, $0, 1024
+	sw	$13, 9($sp)
+L.60:
+	lw	$4, 9($sp)
+	addu	$7, $0, $3
+	j	L.64
+L.61:
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	addu	$12, $7, $6
+	lw	$13, 0($13)
+	sw	$13, 0($12)
+L.62:
+	addi	$7, $7, 1
+L.64:
+	addu	$13, $0, $7
+	sltu	$13, $13, $4
+	bnez	$13, L.61
+	addu	$13, $0, $7
+	subu	$13, $13, $3
+	addu	$2, $0, $13
+	lw	$13, 11($sp)
+	lw	$13, 7($13)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addu	$11, $0, $2
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $2
+L.57:
+	lw	$2, 0($sp)
+	lw	$3, 1($sp)
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	pipe_read
+pipe_read:
+	subui	$sp, $sp, 24
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$11, 10($sp)
+	sw	$12, 11($sp)
+	sw	$13, 12($sp)
+	sw	$ra, 13($sp)
+	lw	$13, 24($sp)
+	lw	$6, 3($13)
+	lw	$13, 24($sp)
+	lw	$13, 6($13)
+	sne	$13, $13, $0
+	bnez	$13, L.66
+	addu	$1, $0, $0
+	j	L.65
+L.66:
+	addu	$13, $0, $0
+	sw	$13, 27($sp)
+	lw	$12, 24($sp)
+	lw	$12, 7($12)
+	lw	$12, 2($12)
+	sneu	$13, $12, $13
+	bnez	$13, L.68
+	lw	$13, 24($sp)
+	lw	$13, 1($13)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.70
+	addu	$1, $0, $0
+	j	L.65
+L.70:
+	lw	$13, 18($6)
+	snei	$13, $13, 1
+	bnez	$13, L.72
+	addu	$1, $0, $0
+	j	L.65
+L.72:
+	lw	$13, pipe_waiting_cache($0)
+	sw	$13, 0($sp)
+	jal	kmem_cache_alloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.74
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.65
+L.74:
+	lw	$13, curr_syscall_caller($0)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 4
+	sw	$12, 0($13)
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 0($7)
+	lw	$13, 24($sp)
+	sw	$13, 2($7)
+	lw	$13, 25($sp)
+	sw	$13, 3($7)
+	lw	$13, 26($sp)
+	sw	$13, 4($7)
+	lw	$13, 27($sp)
+	sw	$13, 5($7)
+	addui	$13, $0, 23
+	sw	$13, 1($7)
+L.76:
+L.79:
+	addui	$5, $7, 6
+	addui	$4, $6, 22
+	lw	$3, 22($6)
+	sw	$5, 1($3)
+	sw	$3, 0($5)
+	sw	$4, 1($5)
+	sw	$5, 0($4)
+L.80:
+L.77:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+	j	L.65
+L.68:
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 0($sp)
+	lw	$13, 24($sp)
+	sw	$13, 1($sp)
+	lw	$13, 25($sp)
+	sw	$13, 2($sp)
+	lw	$13, 26($sp)
+	sw	$13, 3($sp)
+	lw	$13, 27($sp)
+	sw	$13, 4($sp)
+	jal	_pipe_read
+	addu	$13, $0, $1
+	sw	$13, 23($sp)
+	addui	$13, $6, 24
+	sw	$13, 0($sp)
+	jal	get_next_waiting
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.82
+L.84:
+L.87:
+L.90:
+	lw	$13, 6($7)
+	lw	$12, 7($7)
+	sw	$12, 1($13)
+	lw	$13, 7($7)
+	lw	$12, 6($7)
+	sw	$12, 0($13)
+L.91:
+L.88:
+	sw	$0, 6($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 7($7)
+L.85:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 2($7)
+	sw	$13, 1($sp)
+	lw	$13, 3($7)
+	sw	$13, 2($sp)
+	lw	$13, 4($7)
+	sw	$13, 3($sp)
+	lw	$13, 5($7)
+	sw	$13, 4($sp)
+	jal	_pipe_write
+	addu	$13, $0, $1
+	sw	$13, 22($sp)
+	lw	$13, 0($7)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffb
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 1($7)
+	sw	$13, 0($sp)
+	lw	$13, 22($sp)
+	sw	$13, 1($sp)
+	lw	$13, 0($7)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 14
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, 3($7)
+	sw	$13, 0($sp)
+	jal	kfree
+	lw	$13, pipe_waiting_cache($0)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	kmem_cache_free
+L.82:
+	lw	$1, 23($sp)
+L.65:
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$11, 10($sp)
+	lw	$12, 11($sp)
+	lw	$13, 12($sp)
+	lw	$ra, 13($sp)
+	addui	$sp, $sp, 24
+	jr	$ra
+.global	pipe_write
+pipe_write:
+	subui	$sp, $sp, 27
+	sw	$2, 5($sp)
+	sw	$3, 6($sp)
+	sw	$4, 7($sp)
+	sw	$5, 8($sp)
+	sw	$6, 9($sp)
+	sw	$7, 10($sp)
+	sw	$11, 11($sp)
+	sw	$12, 12($sp)
+	sw	$13, 13($sp)
+	sw	$ra, 14($sp)
+	lw	$13, 27($sp)
+	lw	$6, 3($13)
+	lw	$13, 27($sp)
+	lw	$13, 6($13)
+	snei	$13, $13, 2
+	bnez	$13, L.94
+	addu	$1, $0, $0
+	j	L.93
+L.94:
+	lw	$13, 27($sp)
+	lw	$13, 3($13)
+	lw	$13, 18($13)
+	snei	$13, $13, 1
+	bnez	$13, L.96
+	addui	$13, $0, 13
+	sw	$13, 16($sp)
+	addui	$13, $0, 3
+	lw	$12, 16($sp)
+	mult	$13, $13, $12
+	lw	$12, curr_syscall_caller($0)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	addui	$12, $0, 1
+	sneu	$13, $13, $12
+	bnez	$13, L.98
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe0
+	j	L.93
+L.98:
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 0($sp)
+	lw	$13, 16($sp)
+	sw	$13, 1($sp)
+	jal	send_sig
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+	j	L.93
+L.96:
+	lw	$13, 29($sp)
+	addui	$12, $0, 1024
+	sleu	$13, $13, $12
+	bnez	$13, L.100
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffe4
+	j	L.93
+L.100:
+	lw	$13, 29($sp)
+	addui	$12, $0, 1024
+	lw	$11, 27($sp)
+	lw	$11, 7($11)
+	lw	$11, 2($11)
+	subu	$12, $12, $11
+	sleu	$13, $13, $12
+	bnez	$13, L.102
+	addui	$13, $6, 22
+	sw	$13, 0($sp)
+	jal	get_next_waiting
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.104
+L.106:
+L.109:
+L.112:
+	lw	$13, 6($7)
+	lw	$12, 7($7)
+	sw	$12, 1($13)
+	lw	$13, 7($7)
+	lw	$12, 6($7)
+	sw	$12, 0($13)
+L.113:
+L.110:
+	sw	$0, 6($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 7($7)
+L.107:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 2($7)
+	sw	$13, 1($sp)
+	lw	$13, 3($7)
+	sw	$13, 2($sp)
+	lw	$13, 4($7)
+	sw	$13, 3($sp)
+	lw	$13, 5($7)
+	sw	$13, 4($sp)
+	jal	_pipe_read
+	addu	$13, $0, $1
+	sw	$13, 25($sp)
+	lw	$13, 0($7)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffb
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 1($7)
+	sw	$13, 0($sp)
+	lw	$13, 25($sp)
+	sw	$13, 1($sp)
+	lw	$13, 0($7)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 17
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, pipe_waiting_cache($0)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	kmem_cache_free
+L.104:
+L.102:
+	lw	$13, 29($sp)
+	addui	$12, $0, 1024
+	lw	$11, 27($sp)
+	lw	$11, 7($11)
+	lw	$11, 2($11)
+	subu	$12, $12, $11
+	sleu	$13, $13, $12
+	bnez	$13, L.115
+	lw	$13, 29($sp)
+	addu	$5, $0, $13
+	lw	$13, 27($sp)
+	lw	$13, 1($13)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.117
+	addu	$1, $0, $0
+	j	L.93
+L.117:
+	lw	$13, pipe_waiting_cache($0)
+	sw	$13, 0($sp)
+	jal	kmem_cache_alloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.119
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.93
+L.119:
+	lw	$13, 29($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	kmalloc
+	addu	$13, $0, $1
+	sw	$13, 16($sp)
+	lw	$13, 16($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.121
+	lw	$13, pipe_waiting_cache($0)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	kmem_cache_free
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.93
+L.121:
+	lw	$4, 16($sp)
+	j	L.124
+L.123:
+	addu	$13, $0, $4
+	addui	$4, $13, 1
+	lw	$12, 28($sp)
+	addui	$11, $12, 1
+	sw	$11, 28($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.124:
+	addu	$13, $0, $5
+	subi	$5, $13, 1
+	sne	$13, $13, $0
+	bnez	$13, L.123
+	lw	$13, curr_syscall_caller($0)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 4
+	sw	$12, 0($13)
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 0($7)
+	lw	$13, 27($sp)
+	sw	$13, 2($7)
+	lw	$13, 16($sp)
+	sw	$13, 3($7)
+	lw	$13, 29($sp)
+	sw	$13, 4($7)
+	lw	$13, 30($sp)
+	sw	$13, 5($7)
+	addui	$13, $0, 24
+	sw	$13, 1($7)
+L.126:
+L.129:
+	addui	$3, $7, 6
+	addui	$2, $6, 24
+	lw	$13, 24($6)
+	sw	$13, 15($sp)
+	lw	$13, 15($sp)
+	sw	$3, 1($13)
+	lw	$13, 15($sp)
+	sw	$13, 0($3)
+	sw	$2, 1($3)
+	sw	$3, 0($2)
+L.130:
+L.127:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+	j	L.93
+L.115:
+	lw	$13, curr_syscall_caller($0)
+	sw	$13, 0($sp)
+	lw	$13, 27($sp)
+	sw	$13, 1($sp)
+	lw	$13, 28($sp)
+	sw	$13, 2($sp)
+	lw	$13, 29($sp)
+	sw	$13, 3($sp)
+	lw	$13, 30($sp)
+	sw	$13, 4($sp)
+	jal	_pipe_write
+	addu	$13, $0, $1
+	sw	$13, 26($sp)
+	lw	$1, 26($sp)
+L.93:
+	lw	$2, 5($sp)
+	lw	$3, 6($sp)
+	lw	$4, 7($sp)
+	lw	$5, 8($sp)
+	lw	$6, 9($sp)
+	lw	$7, 10($sp)
+	lw	$11, 11($sp)
+	lw	$12, 12($sp)
+	lw	$13, 13($sp)
+	lw	$ra, 14($sp)
+	addui	$sp, $sp, 27
+	jr	$ra
+.global	pipe_open
+pipe_open:
+	addu	$1, $0, $0
+L.132:
+	jr	$ra
+.global	pipe_close
+pipe_close:
+	subui	$sp, $sp, 22
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	lw	$13, 23($sp)
+	lw	$13, 3($13)
+	sw	$13, 13($sp)
+	lw	$13, 23($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 23($sp)
+	lw	$13, 2($13)
+	sne	$13, $13, $0
+	bnez	$13, L.134
+	lw	$13, 13($sp)
+	addui	$13, $13, 18
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 23($sp)
+	lw	$13, 6($13)
+	snei	$13, $13, 2
+	bnez	$13, L.136
+	la	$4, _pipe_write
+	lw	$13, 13($sp)
+	addui	$5, $13, 24
+	j	L.137
+L.136:
+	la	$4, _pipe_read
+	lw	$13, 13($sp)
+	addui	$5, $13, 22
+L.137:
+	sw	$5, 0($sp)
+	jal	get_next_waiting
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.139
+L.138:
+L.141:
+L.144:
+L.147:
+	lw	$13, 6($7)
+	lw	$12, 7($7)
+	sw	$12, 1($13)
+	lw	$13, 7($7)
+	lw	$12, 6($7)
+	sw	$12, 0($13)
+L.148:
+L.145:
+	sw	$0, 6($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 7($7)
+L.142:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 2($7)
+	sw	$13, 1($sp)
+	lw	$13, 3($7)
+	sw	$13, 2($sp)
+	lw	$13, 4($7)
+	sw	$13, 3($sp)
+	lw	$13, 5($7)
+	sw	$13, 4($sp)
+	jalr	$4
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 0($7)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffb
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 1($7)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	lw	$13, 0($7)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 14
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, 1($7)
+	snei	$13, $13, 24
+	bnez	$13, L.150
+	lw	$13, 3($7)
+	sw	$13, 0($sp)
+	jal	kfree
+L.150:
+	lw	$13, pipe_waiting_cache($0)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	kmem_cache_free
+	sw	$5, 0($sp)
+	jal	get_next_waiting
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.139:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.138
+	lw	$13, 13($sp)
+	lw	$13, 18($13)
+	sne	$13, $13, $0
+	bnez	$13, L.152
+	lw	$13, 23($sp)
+	lw	$13, 7($13)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1024
+	sw	$13, 1($sp)
+	jal	release_pages
+	lw	$13, pipe_cache($0)
+	sw	$13, 0($sp)
+	lw	$13, 23($sp)
+	lw	$13, 7($13)
+	sw	$13, 1($sp)
+	jal	kmem_cache_free
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 26
+	sw	$13, 2($sp)
+	jal	memset
+L.152:
+L.134:
+	addu	$1, $0, $0
+L.133:
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 22
+	jr	$ra
+pipe_fops:
+	.word	pipe_open
+	.word	pipe_read
+	.word	pipe_write
+	.word	pipe_close
+
+.word	0
+.global	init_pipe
+.text
+init_pipe:
+	subui	$sp, $sp, 8
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	la	$13, L.155
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	sw	$13, 1($sp)
+	jal	kmem_cache_create
+	addu	$13, $0, $1
+	sw	$13, pipe_cache($0)
+	la	$13, L.156
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	jal	kmem_cache_create
+	addu	$13, $0, $1
+	sw	$13, pipe_waiting_cache($0)
+	la	$13, pipe_dev
+	sw	$13, 0($sp)
+	lw	$13, name($0)
+	sw	$13, 1($sp)
+	lw	$13, pipe_devid($0)
+	sw	$13, 2($sp)
+	addui	$13, $0, 4096
+	sw	$13, 3($sp)
+	sw	$0, 4($sp)
+	la	$13, pipe_fops
+	sw	$13, 5($sp)
+	jal	register_device
+L.154:
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.bss
+pipe_waiting_cache:
+	.space	1
+pipe_cache:
+	.space	1
+.global	pipe_dev
+pipe_dev:
+	.space	9
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.156:
+	.asciiz	"pipe_waiting"
+L.155:
+	.asciiz	"filp_pipe"
+L.9:
+	.asciiz	"pipe"
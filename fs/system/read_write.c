@@ -46,14 +46,18 @@ int sys_write(struct proc *who,int fd, void *buf, size_t count){
 
 int do_read(struct proc* who, struct message* msg){
     char* buf = (char *) get_physical_addr(msg->m1_p1, who);
-    if(!is_vaddr_accessible(msg->m1_p1, who))
+    if(msg->m1_i2 < 0)
+        return -EINVAL;
+    if(!is_vaddr_ok(msg->m1_p1, msg->m1_i2 > 0 ? msg->m1_i2 : 1, who))
         return -EFAULT;
     return sys_read(who, msg->m1_i1, buf, msg->m1_i2);
 }
 
 int do_write(struct proc* who, struct message* msg){
     char* buf = (char *) get_physical_addr(msg->m1_p1, who);
-    if(!is_vaddr_accessible(msg->m1_p1, who))
+    if(msg->m1_i2 < 0)
+        return -EINVAL;
+    if(!is_vaddr_ok(msg->m1_p1, msg->m1_i2 > 0 ? msg->m1_i2 : 1, who))
         return -EFAULT;
     return sys_write(who, msg->m1_i1, buf, msg->m1_i2);
 }
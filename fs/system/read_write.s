@@ -0,0 +1,346 @@
+.global	filp_read
+.text
+filp_read:
+	subui	$sp, $sp, 8
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	sw	$13, curr_syscall_caller($0)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$12, 10($sp)
+	sw	$12, 1($sp)
+	lw	$12, 11($sp)
+	sw	$12, 2($sp)
+	lw	$12, 4($13)
+	sw	$12, 3($sp)
+	lw	$13, 5($13)
+	lw	$13, 6($13)
+	lw	$13, 1($13)
+	jalr	$13
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$1, 7($sp)
+L.9:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	sys_read
+sys_read:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.11
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.10
+L.11:
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$7, 0($13)
+	lw	$13, 3($7)
+	lw	$13, 0($13)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.13
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffeb
+	j	L.10
+L.13:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	filp_read
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$1, 8($sp)
+L.10:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	filp_write
+filp_write:
+	subui	$sp, $sp, 8
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	sw	$13, curr_syscall_caller($0)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$12, 10($sp)
+	sw	$12, 1($sp)
+	lw	$12, 11($sp)
+	sw	$12, 2($sp)
+	lw	$12, 4($13)
+	sw	$12, 3($sp)
+	lw	$13, 5($13)
+	lw	$13, 6($13)
+	lw	$13, 2($13)
+	jalr	$13
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$1, 7($sp)
+L.15:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	sys_write
+sys_write:
+	subui	$sp, $sp, 11
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$10, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.17
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.16
+L.17:
+	lw	$13, 12($sp)
+	lw	$12, 11($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$7, 0($13)
+	lw	$13, 3($7)
+	lw	$13, 0($13)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.19
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffeb
+	j	L.16
+L.19:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	lw	$13, 14($sp)
+	sw	$13, 3($sp)
+	jal	filp_write
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sle	$13, $6, $0
+	bnez	$13, L.21
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, 3($7)
+	lw	$11, start_unix_time($0)
+	addui	$10, $0, 60
+	divu	$13, $13, $10
+	addu	$13, $11, $13
+	sw	$13, 6($12)
+L.21:
+	addu	$1, $0, $6
+L.16:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$10, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	do_read
+do_read:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 10($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	sge	$13, $13, $0
+	bnez	$13, L.24
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.23
+L.24:
+	lw	$13, 10($sp)
+	lw	$12, 5($13)
+	sw	$12, 0($sp)
+	lw	$13, 3($13)
+	sle	$13, $13, $0
+	bnez	$13, L.29
+	lw	$13, 10($sp)
+	lw	$7, 3($13)
+	j	L.30
+L.29:
+	addui	$7, $0, 1
+L.30:
+	addu	$13, $0, $7
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.26
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.23
+L.26:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	lw	$12, 2($13)
+	sw	$12, 1($sp)
+	lw	$12, 8($sp)
+	sw	$12, 2($sp)
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	sys_read
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.23:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_write
+do_write:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 10($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	sge	$13, $13, $0
+	bnez	$13, L.32
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.31
+L.32:
+	lw	$13, 10($sp)
+	lw	$12, 5($13)
+	sw	$12, 0($sp)
+	lw	$13, 3($13)
+	sle	$13, $13, $0
+	bnez	$13, L.37
+	lw	$13, 10($sp)
+	lw	$7, 3($13)
+	j	L.38
+L.37:
+	addui	$7, $0, 1
+L.38:
+	addu	$13, $0, $7
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.34
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.31
+L.34:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	lw	$12, 2($13)
+	sw	$12, 1($sp)
+	lw	$12, 8($sp)
+	sw	$12, 2($sp)
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	sys_write
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.31:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.extern	next_timeout 1
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
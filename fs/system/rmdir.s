@@ -0,0 +1,204 @@
+.global	sys_rmdir
+.text
+sys_rmdir:
+	subui	$sp, $sp, 17
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	sw	$0, 10($sp)
+	addu	$6, $0, $0
+	lw	$13, 18($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.9
+L.10:
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	jal	get_inode_by_path
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.12
+	addu	$1, $0, $6
+	j	L.9
+L.12:
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sequ	$13, $13, $12
+	bnez	$13, L.14
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffec
+	j	L.16
+L.14:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $0
+	sw	$13, 2($sp)
+	sw	$13, 3($sp)
+	sw	$13, 4($sp)
+	jal	_iter_dirent_init
+	j	L.18
+L.17:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_get_next
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $7, 2
+	sw	$13, 0($sp)
+	la	$13, L.22
+	sw	$13, 1($sp)
+	jal	char32_strcmp
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.20
+	addui	$13, $7, 2
+	sw	$13, 0($sp)
+	la	$13, L.23
+	sw	$13, 1($sp)
+	jal	char32_strcmp
+	addu	$13, $0, $1
+	addu	$12, $0, $0
+	seq	$13, $13, $12
+	bnez	$13, L.20
+	lw	$13, 0($7)
+	seq	$13, $13, $12
+	bnez	$13, L.20
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffd9
+	j	L.16
+L.20:
+L.18:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_has_next
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.17
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	jal	iter_dirent_close
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	sys_unlink
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	j	L.24
+L.16:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.25
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+L.25:
+L.24:
+	addu	$1, $0, $6
+L.9:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	do_rmdir
+do_rmdir:
+	subui	$sp, $sp, 135
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 135($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 7
+	sw	$13, 1($sp)
+	lw	$13, 136($sp)
+	lw	$13, 5($13)
+	sw	$13, 2($sp)
+	addui	$13, $0, 128
+	sw	$13, 3($sp)
+	jal	copy_from_user
+	addu	$13, $0, $1
+	sge	$13, $13, $0
+	bnez	$13, L.28
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.27
+L.28:
+	lw	$13, 135($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 7
+	sw	$13, 1($sp)
+	jal	sys_rmdir
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$1, 6($sp)
+L.27:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 135
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.23:
+	.asciiz	"."
+L.22:
+	.asciiz	".."
@@ -0,0 +1,292 @@
+.global	set_statbuf
+.text
+set_statbuf:
+	subui	$sp, $sp, 6
+	sw	$10, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 16($12)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 17($12)
+	sw	$12, 1($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 0($12)
+	sw	$12, 2($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 1($12)
+	sw	$12, 3($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 2($12)
+	sw	$12, 4($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 3($12)
+	sw	$12, 5($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 16($12)
+	lw	$12, 0($12)
+	sw	$12, 6($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 4($12)
+	sw	$12, 7($13)
+	lw	$13, 7($sp)
+	addui	$13, $13, 7
+	lw	$12, 0($13)
+	addui	$11, $0, 32
+	lw	$10, 6($sp)
+	lw	$10, 20($10)
+	lw	$10, 16($10)
+	divu	$11, $11, $10
+	multu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $0, 256
+	sw	$12, 8($13)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_inode_blocks
+	addu	$13, $0, $1
+	lw	$12, 7($sp)
+	sw	$13, 9($12)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 5($12)
+	sw	$12, 10($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 6($12)
+	sw	$12, 11($13)
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	lw	$12, 7($12)
+	sw	$12, 12($13)
+L.9:
+	lw	$10, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	sys_fstat
+sys_fstat:
+	subui	$sp, $sp, 6
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.11
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.10
+L.11:
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 5($sp)
+	lw	$13, 5($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	set_statbuf
+	addu	$1, $0, $0
+L.10:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	sys_stat
+sys_stat:
+	subui	$sp, $sp, 7
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	sw	$0, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 6
+	sw	$13, 2($sp)
+	jal	get_inode_by_path
+	addu	$13, $0, $1
+	sw	$13, 5($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.14
+	lw	$1, 5($sp)
+	j	L.13
+L.14:
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.16
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+	j	L.13
+L.16:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	set_statbuf
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $0
+L.13:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	do_stat
+do_stat:
+	subui	$sp, $sp, 7
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.21
+	lw	$13, 8($sp)
+	lw	$13, 6($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 13
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.19
+L.21:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.18
+L.19:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	lw	$11, 5($12)
+	addu	$11, $13, $11
+	sw	$11, 1($sp)
+	lw	$12, 6($12)
+	addu	$13, $13, $12
+	sw	$13, 2($sp)
+	jal	sys_stat
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.18:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	do_fstat
+do_fstat:
+	subui	$sp, $sp, 7
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 13
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.23
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.22
+L.23:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$12, 8($sp)
+	lw	$11, 2($12)
+	sw	$11, 1($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 2($sp)
+	jal	sys_fstat
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.22:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,208 @@
+.global	sys_statfs
+.text
+sys_statfs:
+	subui	$sp, $sp, 43
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$10, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addu	$6, $0, $0
+	sw	$0, 41($sp)
+	sw	$0, 42($sp)
+	lw	$13, 43($sp)
+	sw	$13, 0($sp)
+	lw	$13, 44($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 42
+	sw	$13, 2($sp)
+	addui	$13, $sp, 41
+	sw	$13, 3($sp)
+	addui	$13, $sp, 12
+	sw	$13, 4($sp)
+	jal	eat_path
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	addu	$1, $0, $6
+	j	L.9
+L.10:
+	lw	$13, 42($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.12
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xfffe
+	j	L.14
+L.12:
+	lw	$13, 42($sp)
+	lw	$13, 16($13)
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.15
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffda
+	j	L.14
+L.15:
+	lw	$13, 45($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 8
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 45($sp)
+	lw	$12, 0($7)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lw	$13, 45($sp)
+	lw	$12, 5($7)
+	addu	$12, $0, $12
+	sw	$12, 1($13)
+	lw	$13, 45($sp)
+	addui	$13, $13, 1
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addui	$11, $0, 32
+	lw	$10, 16($7)
+	divu	$11, $11, $10
+	multu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lw	$13, 45($sp)
+	lw	$12, 1($7)
+	lw	$11, 3($7)
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 2($13)
+	lw	$13, 45($sp)
+	lw	$12, 3($7)
+	addu	$12, $0, $12
+	sw	$12, 4($13)
+	sw	$12, 3($13)
+	lw	$13, 45($sp)
+	lw	$12, 2($7)
+	lw	$11, 4($7)
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 5($13)
+	lw	$13, 45($sp)
+	lw	$12, 4($7)
+	addu	$12, $0, $12
+	sw	$12, 6($13)
+	lw	$13, 45($sp)
+	addui	$12, $0, 28
+	sw	$12, 7($13)
+L.14:
+	lw	$13, 42($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$13, 41($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $6
+L.9:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$10, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 43
+	jr	$ra
+.global	do_statfs
+do_statfs:
+	subui	$sp, $sp, 8
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$7, 5($13)
+	lw	$13, 9($sp)
+	lw	$6, 6($13)
+	sw	$7, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.20
+	sw	$6, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.18
+L.20:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.17
+L.18:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$12, $13, $7
+	sw	$12, 1($sp)
+	addu	$13, $13, $6
+	sw	$13, 2($sp)
+	jal	sys_statfs
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.17:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,53 @@
+.global	do_sync
+.text
+do_sync:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	jal	flush_all_buffer
+	jal	flush_inodes
+	addui	$13, $0, 257
+	sw	$13, 0($sp)
+	jal	get_dev
+	addu	$13, $0, $1
+	sw	$13, 0($sp)
+	jal	flush_super_block
+	addu	$1, $0, $0
+L.9:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
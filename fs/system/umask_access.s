@@ -0,0 +1,183 @@
+.global	sys_umask
+.text
+sys_umask:
+	subui	$sp, $sp, 4
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	lw	$13, 213($13)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	lw	$12, 5($sp)
+	addui	$11, $0, 511
+	and	$12, $12, $11
+	sw	$12, 213($13)
+	lw	$13, 3($sp)
+	addu	$1, $0, $13
+L.9:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	do_umask
+do_umask:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	sys_umask
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.10:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	sys_access
+sys_access:
+	subui	$sp, $sp, 9
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	sw	$0, 8($sp)
+	addu	$7, $0, $0
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 8
+	sw	$13, 2($sp)
+	jal	get_inode_by_path
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 11($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.12
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.16
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+	j	L.11
+L.12:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	has_file_access
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$13, 7($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.18
+	addu	$6, $0, $0
+	j	L.19
+L.18:
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xfff3
+L.19:
+	addu	$7, $0, $6
+L.16:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	addu	$1, $0, $7
+L.11:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_access
+do_access:
+	subui	$sp, $sp, 9
+	sw	$10, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.21
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.20
+L.21:
+	lw	$13, 9($sp)
+	lw	$12, 10($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	lw	$10, 5($12)
+	addu	$11, $11, $10
+	sw	$11, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($12)
+	sw	$13, 2($sp)
+	jal	sys_access
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.20:
+	lw	$10, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
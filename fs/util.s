@@ -0,0 +1,227 @@
+.global	char32_strlcpy
+.text
+char32_strlcpy:
+	subui	$sp, $sp, 4
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	sw	$13, 3($sp)
+	j	L.11
+L.10:
+	lw	$13, 4($sp)
+	addui	$12, $13, 1
+	sw	$12, 4($sp)
+	lw	$12, 5($sp)
+	addui	$11, $12, 1
+	sw	$11, 5($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+L.11:
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.13
+	lw	$13, 6($sp)
+	addui	$12, $0, 1
+	subu	$12, $13, $12
+	sw	$12, 6($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+L.13:
+	lw	$13, 4($sp)
+	sw	$0, 0($13)
+	lw	$1, 3($sp)
+L.9:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	char32_strlcpy2
+char32_strlcpy2:
+	subui	$sp, $sp, 4
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	sw	$13, 3($sp)
+	j	L.16
+L.15:
+	lw	$13, 4($sp)
+	addui	$12, $13, 1
+	sw	$12, 4($sp)
+	lw	$12, 5($sp)
+	addui	$11, $12, 1
+	sw	$11, 5($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+L.16:
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	sequ	$13, $13, $0
+	bnez	$13, L.18
+	lw	$13, 6($sp)
+	addui	$12, $0, 1
+	subu	$12, $13, $12
+	sw	$12, 6($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.15
+L.18:
+	lw	$13, 4($sp)
+	sw	$0, 0($13)
+	lw	$1, 3($sp)
+L.14:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	char32_strlen
+char32_strlen:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	sw	$13, 2($sp)
+	j	L.23
+L.20:
+L.21:
+	lw	$13, 3($sp)
+	addui	$13, $13, 1
+	sw	$13, 3($sp)
+L.23:
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	sneu	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, 3($sp)
+	addu	$13, $0, $13
+	lw	$12, 2($sp)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$1, $0, $13
+L.19:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	char32_strcmp
+char32_strcmp:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	j	L.26
+L.25:
+	lw	$13, 2($sp)
+	lw	$13, 0($13)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	sequ	$13, $13, $12
+	bnez	$13, L.28
+	j	L.27
+L.28:
+	lw	$13, 2($sp)
+	addui	$13, $13, 1
+	sw	$13, 2($sp)
+	lw	$13, 3($sp)
+	addui	$13, $13, 1
+	sw	$13, 3($sp)
+L.26:
+	lw	$13, 2($sp)
+	lw	$13, 0($13)
+	sequ	$13, $13, $0
+	bnez	$13, L.30
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.25
+L.30:
+L.27:
+	lw	$13, 2($sp)
+	lw	$13, 0($13)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$1, $0, $13
+L.24:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	char32_index
+char32_index:
+	subui	$sp, $sp, 5
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$7, 5($sp)
+	j	L.33
+L.32:
+	addui	$7, $7, 1
+L.33:
+	lw	$13, 0($7)
+	sw	$13, 4($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.35
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	lw	$12, 4($sp)
+	sneu	$13, $12, $13
+	bnez	$13, L.32
+L.35:
+	lw	$13, 0($7)
+	sequ	$13, $13, $0
+	bnez	$13, L.37
+	addu	$6, $0, $7
+	j	L.38
+L.37:
+	addu	$6, $0, $0
+L.38:
+	addu	$13, $0, $6
+	addu	$1, $0, $13
+L.31:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -1,11 +1,18 @@
 #ifndef _SCHED_H_
 #define _SCHED_H_
 
+#include <sys/types.h>
+#include <sys/sched.h>
+#include <sys/syscall.h>
+
 void sched_yield();
+int sched_setscheduler(pid_t pid, int policy, const struct sched_param *param);
+int sched_getscheduler(pid_t pid);
 
 #if defined(__wramp__) & !defined(LINTING) && !defined(_SYSTEM)
 
 #define sched_yield()                       wramp_syscall(SCHED_YIELD)
+#define sched_getscheduler(pid)             wramp_syscall(SCHED_GETSCHEDULER, pid)
 #endif
 
 #endif
@@ -0,0 +1,34 @@
+#ifndef _SPAWN_H_
+#define _SPAWN_H_ 1
+
+#include <sys/types.h>
+#include <sys/spawn.h>
+#include <sys/syscall.h>
+
+/* the assembler does not take symbols longer than 29 characters */
+#define posix_spawn_file_actions_destroy    __spawn_actions_destroy
+#define posix_spawn_file_actions_addopen    __spawn_actions_addopen
+#define posix_spawn_file_actions_addclose   __spawn_actions_addclose
+#define posix_spawn_file_actions_adddup2    __spawn_actions_adddup2
+
+int posix_spawn(pid_t *pid, const char *path,
+                const posix_spawn_file_actions_t *file_actions,
+                const posix_spawnattr_t *attrp,
+                char *const argv[], char *const envp[]);
+
+int posix_spawn_file_actions_init(posix_spawn_file_actions_t *file_actions);
+int posix_spawn_file_actions_destroy(posix_spawn_file_actions_t *file_actions);
+int posix_spawn_file_actions_addopen(posix_spawn_file_actions_t *file_actions,
+                int fd, const char *path, int oflag, mode_t mode);
+int posix_spawn_file_actions_addclose(posix_spawn_file_actions_t *file_actions, int fd);
+int posix_spawn_file_actions_adddup2(posix_spawn_file_actions_t *file_actions, int fd, int newfd);
+
+int posix_spawnattr_init(posix_spawnattr_t *attr);
+int posix_spawnattr_destroy(posix_spawnattr_t *attr);
+int posix_spawnattr_setflags(posix_spawnattr_t *attr, short flags);
+int posix_spawnattr_setpgroup(posix_spawnattr_t *attr, pid_t pgroup);
+int posix_spawnattr_setsigdefault(posix_spawnattr_t *attr, const sigset_t *sigdefault);
+int posix_spawnattr_setsigmask(posix_spawnattr_t *attr, const sigset_t *sigmask);
+int posix_spawnattr_tcsetpgrp_np(posix_spawnattr_t *attr, int fd);
+
+#endif
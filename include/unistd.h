@@ -37,6 +37,7 @@ char *getcwd(char *buf, size_t size);
 int execve(const char *pathname, char *const argv[],char *const envp[]);
 int execv(const char *path, char *const argv[]);
 int rmdir(const char *pathname);
+int nice(int inc);
 
 pid_t tcgetpgrp(int fd);
 int tcsetpgrp(int fd, pid_t pgrp);
@@ -0,0 +1,24654 @@
+unsigned int DISK_RAW[40960];
+unsigned int DISK_RAW_SIZE = 40960;
+
+unsigned int DISK_RLE_LEN = 24647;
+unsigned int DISK_RLE[] = {
+	0x0000001d,
+	0xabcdefff,
+	0x00000075,
+	0x00000022,
+	0x0000002b,
+	0x0000001d,
+	0x00000400,
+	0x00000040,
+	0x00000001,
+	0x00000000,
+	0x00000400,
+	0x00000001,
+	0x00000400,
+	0x00000002,
+	0x00000400,
+	0x00000003,
+	0x00001000,
+	0x00000008,
+	0x00000057,
+	0x00000049,
+	0x0000004e,
+	0x00000049,
+	0x00000058,
+	0x0000005f,
+	0x00000052,
+	0x0000004f,
+	0x0000004f,
+	0x00000054,
+	0x00000046,
+	0x00000053,
+	0x800000e3,
+	0x00000004,
+	0xffffffff,
+	0xffffffff,
+	0xffffffff,
+	0xfffff800,
+	0x800000fc,
+	0x00000002,
+	0xffffffff,
+	0xe0000000,
+	0x8000010e,
+	0x00000009,
+	0x000041ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000400,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000007,
+	0x80000007,
+	0x0000000c,
+	0x000041ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00001000,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000008,
+	0x00000029,
+	0x00000052,
+	0x0000006b,
+	0x80000004,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000338,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000009,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000002a8,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000000a,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000194,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000000b,
+	0x80000007,
+	0x0000000d,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x0000102c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000000c,
+	0x0000000d,
+	0x0000000e,
+	0x0000000f,
+	0x00000010,
+	0x80000003,
+	0x00000010,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00004e0c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000011,
+	0x00000012,
+	0x00000013,
+	0x00000014,
+	0x00000015,
+	0x00000016,
+	0x00000008,
+	0x00000009,
+	0x80000005,
+	0x0000000b,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000017,
+	0x00000018,
+	0x00000019,
+	0x0000001a,
+	0x0000001b,
+	0x0000001c,
+	0x0000001d,
+	0x0000001e,
+	0x80000005,
+	0x00000017,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000001f,
+	0x00000020,
+	0x00000021,
+	0x00000022,
+	0x00000023,
+	0x00000024,
+	0x00000000,
+	0x00000000,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000e18,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000025,
+	0x00000026,
+	0x00000027,
+	0x00000028,
+	0x80000004,
+	0x0000000f,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000032b4,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000002a,
+	0x0000002b,
+	0x0000002c,
+	0x0000002d,
+	0x0000002e,
+	0x0000002f,
+	0x0000000c,
+	0x80000006,
+	0x0000001a,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000030,
+	0x00000031,
+	0x00000032,
+	0x00000033,
+	0x00000034,
+	0x00000035,
+	0x00000036,
+	0x00000000,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00001900,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000037,
+	0x00000038,
+	0x00000039,
+	0x0000003a,
+	0x0000003b,
+	0x0000003c,
+	0x0000000e,
+	0x80000006,
+	0x00000004,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000003d,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x0000005c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000003e,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000002c8,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000003f,
+	0x80000007,
+	0x00000010,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00003984,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000040,
+	0x00000041,
+	0x00000042,
+	0x00000043,
+	0x00000044,
+	0x00000045,
+	0x00000012,
+	0x00000013,
+	0x80000005,
+	0x0000000b,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000046,
+	0x00000047,
+	0x00000048,
+	0x00000049,
+	0x0000004a,
+	0x0000004b,
+	0x0000004c,
+	0x0000004d,
+	0x80000005,
+	0x00000004,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000004e,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000003a8,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000004f,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000204,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000050,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000380,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000051,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x0000013c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000053,
+	0x80000007,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000002bc,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000054,
+	0x80000007,
+	0x0000000d,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000012f0,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000055,
+	0x00000056,
+	0x00000057,
+	0x00000058,
+	0x00000059,
+	0x80000003,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000002e4,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000005a,
+	0x80000007,
+	0x0000000f,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00001ac4,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000005b,
+	0x0000005c,
+	0x0000005d,
+	0x0000005e,
+	0x0000005f,
+	0x00000060,
+	0x0000001c,
+	0x80000006,
+	0x00000004,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000061,
+	0x80000007,
+	0x0000001a,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x000014cc,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000062,
+	0x00000063,
+	0x00000064,
+	0x00000065,
+	0x00000066,
+	0x00000067,
+	0x00000000,
+	0x00000000,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000758,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000068,
+	0x00000069,
+	0x80000006,
+	0x00000009,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000374,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000006a,
+	0x80000007,
+	0x0000000a,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000590,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000006c,
+	0x0000006d,
+	0x80000006,
+	0x00000019,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x0000160c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x0000006e,
+	0x0000006f,
+	0x00000070,
+	0x00000071,
+	0x00000072,
+	0x00000073,
+	0x00000000,
+	0x00000000,
+	0x000081ed,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x00000290,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x6ad5229c,
+	0x00000074,
+	0x800001d7,
+	0x00000003,
+	0x00000001,
+	0x00000004,
+	0x0000002e,
+	0x8000001d,
+	0x00000004,
+	0x00000001,
+	0x00000004,
+	0x0000002e,
+	0x0000002e,
+	0x8000001c,
+	0x00000005,
+	0x00000002,
+	0x00000004,
+	0x00000062,
+	0x00000069,
+	0x0000006e,
+	0x8000001a,
+	0x00000001,
+	0x00000101,
+	0x800000a0,
+	0x00000003,
+	0x00000002,
+	0x00000004,
+	0x0000002e,
+	0x8000001d,
+	0x00000004,
+	0x00000001,
+	0x00000004,
+	0x0000002e,
+	0x0000002e,
+	0x8000001c,
+	0x00000008,
+	0x00000003,
+	0x00000000,
+	0x00000075,
+	0x00000070,
+	0x00000074,
+	0x00000069,
+	0x0000006d,
+	0x00000065,
+	0x80000017,
+	0x00000008,
+	0x00000101,
+	0x00000004,
+	0x00000000,
+	0x0000006d,
+	0x0000006b,
+	0x00000064,
+	0x00000069,
+	0x00000072,
+	0x80000018,
+	0x00000008,
+	0x00000101,
+	0x00000005,
+	0x00000000,
+	0x00000074,
+	0x0000006f,
+	0x00000075,
+	0x00000063,
+	0x00000068,
+	0x80000018,
+	0x00000007,
+	0x00000101,
+	0x00000006,
+	0x00000000,
+	0x0000006e,
+	0x00000069,
+	0x00000063,
+	0x00000065,
+	0x80000019,
+	0x00000006,
+	0x00000101,
+	0x00000007,
+	0x00000000,
+	0x00000077,
+	0x00000073,
+	0x00000068,
+	0x8000001a,
+	0x00000005,
+	0x00000101,
+	0x0000000a,
+	0x00000000,
+	0x00000077,
+	0x00000063,
+	0x8000001b,
+	0x00000056,
+	0x00000101,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x0000031c,
+	0x000001c4,
+	0x00000158,
+	0x00000000,
+	0x1ee30015,
+	0x93e00007,
+	0x94e00008,
+	0x95e00009,
+	0x96e0000a,
+	0x97e0000b,
+	0x9be0000c,
+	0x9ce0000d,
+	0x9de0000e,
+	0x9fe0000f,
+	0x1d010001,
+	0x9de00000,
+	0x1de10011,
+	0x9de00001,
+	0x6000046f,
+	0x0d010001,
+	0x0301000d,
+	0x1d010010,
+	0x9de00000,
+	0x1d010003,
+	0x9de00001,
+	0x6000046f,
+	0x0d010001,
+	0x0701000d,
+	0x04360007,
+	0x1d01003c,
+	0x0546000d,
+	0x0656000d,
+	0x1c010018,
+	0x0b66000c,
+	0x9be00010,
+	0x0448000d,
+	0x0558000d,
+	0x0668000c,
+	0x1d010001,
+	0x9de00000,
+	0xcd0004a7,
+	0x9de00001,
+	0x8de00010,
+	0x9de00002,
+	0x96e00003,
+	0x95e00004,
+	0x94e00005,
+	0x0d380007,
+	0x9de00006,
+	0x6000045d,
+	0x1d010001,
+	0x9de00000,
+	0xcd000471,
+	0x9de00001,
+	0x8de00011,
+	0x0c010007,
+	0x0bd7000c,
+	0x9be00002,
+	0x0dd9000c,
+	0x9de00003,
+	0x8de00012,
+	0x0dd7000c,
+	0x9de00004,
+	0x8de00012,
+	0x0dd9000c,
+	0x9de00005,
+	0x6000045d,
+	0x01010000,
+	0x83e00007,
+	0x84e00008,
+	0x85e00009,
+	0x86e0000a,
+	0x87e0000b,
+	0x8be0000c,
+	0x8ce0000d,
+	0x8de0000e,
+	0x8fe0000f,
+	0x1ee10015,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000069,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x6000046f,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000075,
+	0x00000073,
+	0x00000065,
+	0x00000072,
+	0x00000020,
+	0x00000074,
+	0x00000069,
+	0x0000006d,
+	0x00000065,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000002e,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x00000073,
+	0x00000065,
+	0x00000063,
+	0x0000006f,
+	0x0000006e,
+	0x00000064,
+	0x00000073,
+	0x0000002c,
+	0x00000020,
+	0x00000073,
+	0x00000079,
+	0x00000073,
+	0x00000074,
+	0x00000065,
+	0x0000006d,
+	0x00000020,
+	0x00000074,
+	0x00000069,
+	0x0000006d,
+	0x00000065,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000002e,
+	0x00000025,
+	0x00000030,
+	0x00000032,
+	0x00000064,
+	0x00000020,
+	0x00000073,
+	0x00000065,
+	0x00000063,
+	0x0000006f,
+	0x0000006e,
+	0x00000064,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000055,
+	0x00000070,
+	0x00000074,
+	0x00000069,
+	0x0000006d,
+	0x00000065,
+	0x00000020,
+	0x00000069,
+	0x00000073,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x00000064,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x00000068,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000006d,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000002e,
+	0x00000025,
+	0x00000030,
+	0x00000032,
+	0x00000064,
+	0x00000073,
+	0x0000000a,
+	0x80000033,
+	0x00000035,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x0000028c,
+	0x00000200,
+	0x0000008c,
+	0x00000040,
+	0x1ee30006,
+	0x97e00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00006,
+	0x3dd60002,
+	0xb0d00007,
+	0x8d000438,
+	0x9de00000,
+	0xcd000486,
+	0x9de00001,
+	0x6000043d,
+	0x11010001,
+	0x40000424,
+	0x1d010028,
+	0x9de00000,
+	0x1d0101ed,
+	0x9de00001,
+	0x8de00007,
+	0x8dd00001,
+	0x9de00002,
+	0x60000429,
+	0x0d010001,
+	0x0701000d,
+	0x2d760000,
+	0xb0d00005,
+	0xcd000480,
+	0x9de00000,
+	0x60000462,
+	0x11010001,
+	0x40000424,
+	0x1d010019,
+	0x9de00000,
+	0x97e00001,
+	0x60000429,
+	0x01010000,
+	0x87e00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000065,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000429,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0004a3,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000429,
+	0xc10004a3,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000460,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x6000044f,
+	0x0d010001,
+	0x8c000438,
+	0x9ce00000,
+	0xcc00049b,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x6000043d,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x0000006d,
+	0x0000006b,
+	0x00000064,
+	0x00000069,
+	0x00000072,
+	0x00000000,
+	0x0000006d,
+	0x00000069,
+	0x00000073,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000020,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x00000072,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80000057,
+	0x0000002d,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x00000178,
+	0x00000124,
+	0x00000054,
+	0x00000000,
+	0x1ee30007,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00007,
+	0x3dd60002,
+	0xb0d00007,
+	0x8d000430,
+	0x9de00000,
+	0xcd000449,
+	0x9de00001,
+	0x60000435,
+	0x11010001,
+	0x4000041f,
+	0x1d010016,
+	0x9de00000,
+	0x1d010102,
+	0x9de00001,
+	0x8de00008,
+	0x8dd00001,
+	0x9de00002,
+	0x1d0101ed,
+	0x9de00003,
+	0x60000447,
+	0x0d010001,
+	0x9de00006,
+	0x1d010019,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x60000447,
+	0x01010000,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000028,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000447,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x0000006d,
+	0x00000069,
+	0x00000073,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000020,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x00000072,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x0000000a,
+	0x8000009c,
+	0x000002ac,
+	0x19960503,
+	0x00000411,
+	0x00001000,
+	0x00001010,
+	0x00000d00,
+	0x00000310,
+	0x00000040,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d0006af,
+	0x9de00000,
+	0xcd0007c8,
+	0x9de00001,
+	0x600006b4,
+	0x8d0006af,
+	0x9de00000,
+	0xcd000791,
+	0x9de00001,
+	0x600006b4,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee3004c,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x1601000a,
+	0x05010000,
+	0x17010001,
+	0x40000458,
+	0x8de0004d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00000,
+	0xcd00078e,
+	0x9de00001,
+	0x6000071b,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00022,
+	0x1d700001,
+	0x8ce0004c,
+	0x2dd6000c,
+	0xb0d0001e,
+	0x1d700001,
+	0x8ce0004d,
+	0x0dd1000c,
+	0x8dd00000,
+	0x9de00000,
+	0x1de1004b,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x600005d6,
+	0x0d010001,
+	0x0601000d,
+	0x8de0004b,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000c,
+	0x8d0006af,
+	0x9de00000,
+	0xcd000776,
+	0x9de00001,
+	0x1d700001,
+	0x8ce0004d,
+	0x0dd1000c,
+	0x8dd00000,
+	0x9de00002,
+	0x600006b4,
+	0x11010001,
+	0x400004d3,
+	0x17700001,
+	0x40000457,
+	0x8de0004d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00000,
+	0xcd000773,
+	0x9de00001,
+	0x6000071b,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00002,
+	0x15010001,
+	0x40000457,
+	0x60000400,
+	0x11010001,
+	0x400004d3,
+	0x17700001,
+	0x8de0004c,
+	0x2d76000d,
+	0xb0d00006,
+	0x8de0004d,
+	0x0d71000d,
+	0x8dd00000,
+	0x8dd00000,
+	0x3dd8002d,
+	0xb0dfffbb,
+	0x8de0004c,
+	0x2d70000d,
+	0xb0d00003,
+	0x60000400,
+	0x11010001,
+	0x400004d3,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x90d00000,
+	0x96e00000,
+	0x6000052d,
+	0x0d010001,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d00010,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x2dd90000,
+	0xb0d00005,
+	0xcd00076e,
+	0x9de00000,
+	0x600006c6,
+	0x11010001,
+	0x400004d3,
+	0x0d010000,
+	0x9de0000a,
+	0x2d58000d,
+	0xb0d0000e,
+	0x8de0000a,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x90e00002,
+	0x60000572,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00005,
+	0xcd00075b,
+	0x9de00000,
+	0x600006c6,
+	0x11010001,
+	0x400004d3,
+	0x8de0004d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00000,
+	0x1d01002f,
+	0x9de00001,
+	0x600006e4,
+	0x0d010001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0000a,
+	0x1de1000b,
+	0x9de00000,
+	0x8de0004d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x600004ec,
+	0x400004be,
+	0x1de1000b,
+	0x9de00000,
+	0xcd000755,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x600004ec,
+	0x1de1000b,
+	0x9de00000,
+	0x8de0004d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x6000059a,
+	0x60000703,
+	0x0d010001,
+	0x1c010005,
+	0x9ce00000,
+	0x1ce1000b,
+	0x9ce00001,
+	0x8ce0004d,
+	0x0c71000c,
+	0x9ce00002,
+	0x9de00003,
+	0x60000513,
+	0x8d0006af,
+	0x9de00000,
+	0xcd000740,
+	0x9de00001,
+	0x8de0004d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00002,
+	0x600006b4,
+	0x11010001,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1004c,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd000804,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000513,
+	0xc1000804,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30004,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x9de00003,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x400004ff,
+	0x8de00004,
+	0x1cd10001,
+	0x9ce00004,
+	0x8ce00005,
+	0x1bc10001,
+	0x9be00005,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00005,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00006,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00006,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00004,
+	0x90d00000,
+	0x81e00003,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10004,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01003b,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x60000513,
+	0x0d010001,
+	0x0701000d,
+	0x2d760000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000528,
+	0x11720014,
+	0x87e00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x90d00000,
+	0x0d010000,
+	0x9de00000,
+	0x9de00001,
+	0x60000515,
+	0x0d010001,
+	0x0701000d,
+	0x3d0effff,
+	0x1dddffff,
+	0x2d7a000d,
+	0xb0d0000e,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x2dd90000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x4000056c,
+	0x8de00008,
+	0x0770000d,
+	0x3d0effff,
+	0x1dddffec,
+	0x2d76000d,
+	0xb0d00002,
+	0x370effff,
+	0x177dffec,
+	0x3d740013,
+	0xb0d00001,
+	0x17010013,
+	0x1d01003a,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x97e00003,
+	0x60000513,
+	0x0d010001,
+	0x2dd60000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x4000056c,
+	0x01010007,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00009,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00011,
+	0x8de00006,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000d,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x1c010016,
+	0x9cd00000,
+	0x310effff,
+	0x111dffff,
+	0x40000595,
+	0x1d01003c,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x60000513,
+	0x0d010001,
+	0x0101000d,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffffa,
+	0x8de00005,
+	0x3c0effff,
+	0x1ccdffff,
+	0x0dd1000c,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0c010007,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0d01000d,
+	0x9de00004,
+	0x8de00007,
+	0x8ce00004,
+	0x0dd3000c,
+	0x9de00007,
+	0x8de00007,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x01010007,
+	0x400005d0,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8ce00006,
+	0x1bc10001,
+	0x9be00006,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00006,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00007,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00007,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00005,
+	0x90d00000,
+	0x01010007,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee3000d,
+	0x93e00000,
+	0x94e00001,
+	0x95e00002,
+	0x96e00003,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x16010001,
+	0x07010000,
+	0x400005e6,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000c,
+	0x1cd20009,
+	0x3dc00005,
+	0xb0d00003,
+	0x8de0000c,
+	0x3dda0020,
+	0xb0d00002,
+	0x15010001,
+	0x400005f2,
+	0x05010000,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002b,
+	0xb0d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x40000606,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002d,
+	0xb0d00005,
+	0x360effff,
+	0x166dffff,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000f,
+	0x2dda0000,
+	0xb0d00022,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda0030,
+	0xb0d0001c,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd20041,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd00061,
+	0x14d20041,
+	0x4000061b,
+	0x8de0000d,
+	0x84d00001,
+	0x3d4a0078,
+	0xb0d00006,
+	0x1d010010,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10002,
+	0x9de0000d,
+	0x4000062b,
+	0x1d010008,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x4000062b,
+	0x1d01000a,
+	0x9de0000f,
+	0x8de0000f,
+	0x9de0000b,
+	0x3dd00002,
+	0xb0d00003,
+	0x8de0000b,
+	0x3dd40024,
+	0xb0d00048,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01010000,
+	0x40000697,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20030,
+	0x0d01000d,
+	0x1c01000a,
+	0x2dd7000c,
+	0xb0d00004,
+	0x8de0000d,
+	0x8dd00000,
+	0x14d20030,
+	0x40000656,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20061,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd00041,
+	0x13d20061,
+	0x40000654,
+	0x8de0000d,
+	0x83d00000,
+	0x1d320041,
+	0x14d0000a,
+	0x8de0000f,
+	0x2d40000d,
+	0xb0d00001,
+	0x4000068f,
+	0x3d0e7fff,
+	0x1dddffff,
+	0x0dd20004,
+	0x8ce0000f,
+	0x0dd6000c,
+	0x2d74000d,
+	0xb0d00013,
+	0x3d6a0001,
+	0xb0d00003,
+	0x330e7fff,
+	0x133dffff,
+	0x40000668,
+	0x330e8000,
+	0x133d0000,
+	0x07010003,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x1c010022,
+	0x9cd00000,
+	0x40000677,
+	0x8de0000f,
+	0x0d74000d,
+	0x07d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000a,
+	0x1cd20030,
+	0x0c01000c,
+	0x1b01000a,
+	0x2dc1000b,
+	0xb0dfffb9,
+	0x1d010006,
+	0x9de00009,
+	0x8ce0000a,
+	0x1cc20061,
+	0x0c01000c,
+	0x2dc1000d,
+	0xb0dfffb2,
+	0x8de0000a,
+	0x1dd20041,
+	0x0d01000d,
+	0x8ce00009,
+	0x2dd1000c,
+	0xb0dfffac,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01640007,
+	0x83e00000,
+	0x84e00001,
+	0x85e00002,
+	0x86e00003,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000d,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x0000014f,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000513,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x600004db,
+	0x0d010001,
+	0x8c0006af,
+	0x9ce00000,
+	0xcc0007fc,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x600006b4,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30005,
+	0x96e00000,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x400006ec,
+	0x17710001,
+	0x8d700000,
+	0x9de00004,
+	0x2dd80000,
+	0xb0d00004,
+	0x8de00006,
+	0x8ce00004,
+	0x2dca000d,
+	0xb0dffff7,
+	0x8d700000,
+	0x2dd80000,
+	0xb0d00002,
+	0x06010007,
+	0x400006fa,
+	0x06010000,
+	0x0d010006,
+	0x0101000d,
+	0x86e00000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x9fe00002,
+	0x8d000702,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x60000511,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c0103ff,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x9d000702,
+	0x81000702,
+	0x8ce00000,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x4000072c,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x2dd8000c,
+	0xb0d00001,
+	0x40000737,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00004,
+	0x1dd10001,
+	0x9de00004,
+	0x0d010000,
+	0x9de00002,
+	0x8ce00003,
+	0x8cc00000,
+	0x2dc8000d,
+	0xb0d00005,
+	0x8de00004,
+	0x8dd00000,
+	0x8ce00002,
+	0x2dda000c,
+	0xb0dfffe8,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x01d2000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x0000006e,
+	0x00000069,
+	0x00000063,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000063,
+	0x00000061,
+	0x0000006e,
+	0x0000006e,
+	0x0000006f,
+	0x00000074,
+	0x00000020,
+	0x00000072,
+	0x00000075,
+	0x0000006e,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x0000002f,
+	0x00000062,
+	0x00000069,
+	0x0000006e,
+	0x0000002f,
+	0x00000000,
+	0x00000073,
+	0x00000063,
+	0x00000068,
+	0x00000065,
+	0x00000064,
+	0x0000005f,
+	0x00000073,
+	0x00000065,
+	0x00000074,
+	0x00000073,
+	0x00000063,
+	0x00000068,
+	0x00000065,
+	0x00000064,
+	0x00000075,
+	0x0000006c,
+	0x00000065,
+	0x00000072,
+	0x00000000,
+	0x0000006e,
+	0x00000069,
+	0x00000063,
+	0x00000065,
+	0x00000000,
+	0x0000002d,
+	0x00000073,
+	0x00000000,
+	0x00000049,
+	0x0000006e,
+	0x00000076,
+	0x00000061,
+	0x0000006c,
+	0x00000069,
+	0x00000064,
+	0x00000020,
+	0x00000061,
+	0x00000064,
+	0x0000006a,
+	0x00000075,
+	0x00000073,
+	0x00000074,
+	0x0000006d,
+	0x00000065,
+	0x0000006e,
+	0x00000074,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x0000002d,
+	0x0000006e,
+	0x00000000,
+	0x00000020,
+	0x00000020,
+	0x0000002d,
+	0x00000073,
+	0x00000020,
+	0x00000020,
+	0x00000072,
+	0x00000075,
+	0x0000006e,
+	0x00000020,
+	0x00000074,
+	0x00000068,
+	0x00000065,
+	0x00000020,
+	0x00000063,
+	0x0000006f,
+	0x0000006d,
+	0x0000006d,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x00000020,
+	0x00000074,
+	0x00000068,
+	0x00000065,
+	0x00000020,
+	0x00000070,
+	0x00000072,
+	0x0000006f,
+	0x00000070,
+	0x0000006f,
+	0x00000072,
+	0x00000074,
+	0x00000069,
+	0x0000006f,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x00000020,
+	0x00000073,
+	0x00000068,
+	0x00000061,
+	0x00000072,
+	0x00000065,
+	0x00000020,
+	0x00000063,
+	0x0000006c,
+	0x00000061,
+	0x00000073,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000075,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x0000006e,
+	0x00000069,
+	0x00000063,
+	0x00000065,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x0000006e,
+	0x00000020,
+	0x00000061,
+	0x00000064,
+	0x0000006a,
+	0x00000075,
+	0x00000073,
+	0x00000074,
+	0x0000006d,
+	0x00000065,
+	0x0000006e,
+	0x00000074,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x00000073,
+	0x0000005d,
+	0x00000020,
+	0x00000063,
+	0x0000006f,
+	0x0000006d,
+	0x0000006d,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x00000020,
+	0x0000005b,
+	0x00000061,
+	0x00000072,
+	0x00000067,
+	0x00000073,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x800000f6,
+	0x00000809,
+	0x19960503,
+	0x0000068d,
+	0x00001000,
+	0x00004df0,
+	0x0000462c,
+	0x000007c4,
+	0x00000698,
+	0x1ee30014,
+	0x92e00003,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9be00009,
+	0x9ce0000a,
+	0x9de0000b,
+	0x9fe0000c,
+	0x06010000,
+	0x8de00015,
+	0x9de00000,
+	0x8de00014,
+	0x9de00001,
+	0x1d010064,
+	0x9de00002,
+	0x60000bb0,
+	0x8de00015,
+	0x0701000d,
+	0x0c010000,
+	0x9cd00076,
+	0x9cd00096,
+	0x9cd00095,
+	0x8de00015,
+	0x0c010000,
+	0x9cd00098,
+	0x9cd00064,
+	0x9cd00097,
+	0x8de00015,
+	0x90d00065,
+	0x8de00015,
+	0x0c010000,
+	0x9cd0009a,
+	0x9cd00099,
+	0x40000543,
+	0x17710001,
+	0x8d700000,
+	0x9de00013,
+	0x1cd20009,
+	0x3dc00005,
+	0xb0d00003,
+	0x8de00013,
+	0x3dda0020,
+	0xb0d00002,
+	0x15010001,
+	0x40000431,
+	0x05010000,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0dffff1,
+	0x8d700000,
+	0x2dda0000,
+	0xb0d00001,
+	0x40000549,
+	0x84700000,
+	0x1d01005c,
+	0x9de00012,
+	0x2d48000d,
+	0xb0d00067,
+	0x8de00012,
+	0x2d42000d,
+	0xb0d00010,
+	0x1d010022,
+	0x9de00011,
+	0x2d48000d,
+	0xb0d00079,
+	0x3d480026,
+	0xb0d0005a,
+	0x3d480027,
+	0xb0d00066,
+	0x8de00011,
+	0x2d40000d,
+	0xb0d00096,
+	0x3d48003c,
+	0xb0d00020,
+	0x3d48003e,
+	0xb0d00034,
+	0x400004e1,
+	0x1d010060,
+	0x9de00010,
+	0x2d48000d,
+	0xb0d0007b,
+	0x8de00010,
+	0x2d40000d,
+	0xb0d0008a,
+	0x3d48007c,
+	0xb0d00001,
+	0x400004e1,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x0d010006,
+	0x16d00001,
+	0x8ce00015,
+	0x1cc10076,
+	0x0dd1000c,
+	0x90d00000,
+	0x8de00015,
+	0x1dd10064,
+	0x8cd00000,
+	0x1cc00001,
+	0x9cd00000,
+	0x8de00015,
+	0x1dd10065,
+	0x0dc1000d,
+	0x96d00000,
+	0x40000543,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x40000472,
+	0x17710001,
+	0x8d700000,
+	0x9de0000f,
+	0x1cd20009,
+	0x3dc00005,
+	0xb0d00003,
+	0x8de0000f,
+	0x3dda0020,
+	0xb0d00002,
+	0x13010001,
+	0x4000047d,
+	0x03010000,
+	0x0d010003,
+	0x2ddb0000,
+	0xb0dffff1,
+	0x8de00015,
+	0x97d00095,
+	0x400004e9,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x8d700000,
+	0x3dda003e,
+	0xb0d00006,
+	0x8de00015,
+	0x1c010001,
+	0x9cd00097,
+	0x17710001,
+	0x4000048f,
+	0x17710001,
+	0x8d700000,
+	0x9de0000e,
+	0x1cd20009,
+	0x3dc00005,
+	0xb0d00003,
+	0x8de0000e,
+	0x3dda0020,
+	0xb0d00002,
+	0x12010001,
+	0x4000049a,
+	0x02010000,
+	0x0d010002,
+	0x2ddb0000,
+	0xb0dffff1,
+	0x8de00015,
+	0x97d00096,
+	0x400004e9,
+	0x8de00015,
+	0x1c010001,
+	0x9cd00098,
+	0x400004e9,
+	0x0d010006,
+	0x16d00001,
+	0x1c710001,
+	0x0701000c,
+	0x8be00015,
+	0x1bb10076,
+	0x0dd1000b,
+	0x9cd00000,
+	0x17710001,
+	0x400004e9,
+	0x0d010006,
+	0x16d00001,
+	0x1c710001,
+	0x0701000c,
+	0x8be00015,
+	0x1bb10076,
+	0x0dd1000b,
+	0x9cd00000,
+	0x400004b8,
+	0x17710001,
+	0x8d700000,
+	0x3dda0027,
+	0xb0dffffc,
+	0x90700000,
+	0x400004e9,
+	0x0d010006,
+	0x16d00001,
+	0x0c010007,
+	0x17c10001,
+	0x8be00015,
+	0x1bb10076,
+	0x0dd1000b,
+	0x9cd00000,
+	0x400004c7,
+	0x17710001,
+	0x8d700000,
+	0x3dda0022,
+	0xb0dffffc,
+	0x1d710001,
+	0x0701000d,
+	0x90d00000,
+	0x17710001,
+	0x40000543,
+	0x0d010006,
+	0x16d00001,
+	0x0c010007,
+	0x17c10001,
+	0x8be00015,
+	0x1bb10076,
+	0x0dd1000b,
+	0x9cd00000,
+	0x400004d9,
+	0x17710001,
+	0x8d700000,
+	0x3dda0060,
+	0xb0dffffc,
+	0x1d710001,
+	0x0701000d,
+	0x90d00000,
+	0x17710001,
+	0x40000543,
+	0x0d010006,
+	0x16d00001,
+	0x8ce00015,
+	0x1cc10076,
+	0x0dd1000c,
+	0x97d00000,
+	0x400004e9,
+	0x17710001,
+	0x8d700000,
+	0x9de0000f,
+	0x2dd80000,
+	0xb0d00023,
+	0x8de0000f,
+	0x1dd20009,
+	0x3dd00005,
+	0xb0d00003,
+	0x8de0000f,
+	0x3dda0020,
+	0xb0d00002,
+	0x13010001,
+	0x400004f7,
+	0x03010000,
+	0x0d010003,
+	0x2ddb0000,
+	0xb0d00016,
+	0x8d700000,
+	0x9de0000e,
+	0x3dd8007c,
+	0xb0d00012,
+	0x8de0000e,
+	0x3dd8003c,
+	0xb0d0000f,
+	0x8de0000e,
+	0x3dd8003e,
+	0xb0d0000c,
+	0x8de0000e,
+	0x3dd80027,
+	0xb0d00009,
+	0x8de0000e,
+	0x3dd8003d,
+	0xb0d00006,
+	0x8de0000e,
+	0x3dd80022,
+	0xb0d00003,
+	0x8de0000e,
+	0x3dda0060,
+	0xb0dfffd8,
+	0x8d700000,
+	0x3dda003d,
+	0xb0d00029,
+	0x02010000,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x8de00015,
+	0x1c620001,
+	0x1bd10076,
+	0x0cc1000b,
+	0x8cc00000,
+	0x9cd00099,
+	0x0d010006,
+	0x16d00001,
+	0x8ce00015,
+	0x1cc10076,
+	0x0dd1000c,
+	0x97d00000,
+	0x8de00015,
+	0x1c620001,
+	0x1bd10076,
+	0x0cc1000b,
+	0x8cc00000,
+	0x9cd0009a,
+	0x8d700000,
+	0x3dda0022,
+	0xb0d00001,
+	0x82700000,
+	0x8d700000,
+	0x3dda0027,
+	0xb0d00001,
+	0x82700000,
+	0x17710001,
+	0x40000534,
+	0x17710001,
+	0x8d700000,
+	0x9de0000d,
+	0x2dd80000,
+	0xb0d00003,
+	0x8de0000d,
+	0x2dda0002,
+	0xb0dffff8,
+	0x17710001,
+	0x8d700000,
+	0x2dda0000,
+	0xb0d00001,
+	0x40000549,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x3d66001d,
+	0xb0d00004,
+	0x8de00015,
+	0x8dd00064,
+	0x3dd00008,
+	0xb0dffedd,
+	0x8de00015,
+	0x1dd10076,
+	0x0d61000d,
+	0x90d00000,
+	0x8de00015,
+	0x1dd10077,
+	0x0d61000d,
+	0x90d00000,
+	0x2d640000,
+	0xb0d00005,
+	0x8de00015,
+	0x1dd10064,
+	0x8cd00000,
+	0x1cc00001,
+	0x9cd00000,
+	0x2d6a0000,
+	0xb0d00005,
+	0x8de00015,
+	0x9dd00076,
+	0x8de00015,
+	0x8dd00076,
+	0x90d00000,
+	0x8de00015,
+	0x96d00075,
+	0x01010000,
+	0x82e00003,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8be00009,
+	0x8ce0000a,
+	0x8de0000b,
+	0x8fe0000c,
+	0x1ee10014,
+	0x50f00000,
+	0x1ee3000e,
+	0x93e00003,
+	0x94e00004,
+	0x95e00005,
+	0x96e00006,
+	0x97e00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x87e0000e,
+	0x86e0000f,
+	0x8d700000,
+	0x3dda0022,
+	0xb0d00002,
+	0x17710001,
+	0x400005c2,
+	0x8d700000,
+	0x3dda0027,
+	0xb0d00041,
+	0x17710001,
+	0x400005c2,
+	0x8d700000,
+	0x9de0000d,
+	0x3dd80022,
+	0xb0d00003,
+	0x8de0000d,
+	0x3dda0027,
+	0xb0d00001,
+	0x90700000,
+	0x8d700000,
+	0x3dda0024,
+	0xb0d0002e,
+	0x1d710001,
+	0x0701000d,
+	0x0301000d,
+	0x40000593,
+	0x17710001,
+	0x8d700000,
+	0x9de0000c,
+	0x2dd80000,
+	0xb0d0000d,
+	0x1d01001a,
+	0x9de0000b,
+	0x8ce0000c,
+	0x1cc20041,
+	0x0c01000c,
+	0x2dc1000d,
+	0xb0dffff4,
+	0x8de0000c,
+	0x1dd20061,
+	0x0d01000d,
+	0x8ce0000b,
+	0x2dd1000c,
+	0xb0dfffee,
+	0x84700000,
+	0x90700000,
+	0x93e00000,
+	0x600010b5,
+	0x0d010001,
+	0x0501000d,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0d00002,
+	0x94700000,
+	0x400005c2,
+	0x90600000,
+	0x96e00000,
+	0x95e00001,
+	0x8de00010,
+	0x0d01000d,
+	0x9de00002,
+	0x6000154f,
+	0x95e00000,
+	0x60000b96,
+	0x0d010001,
+	0x06d10006,
+	0x94700000,
+	0x400005c2,
+	0x0d010006,
+	0x16d10001,
+	0x0c010007,
+	0x17c10001,
+	0x8cc00000,
+	0x9cd00000,
+	0x8d700000,
+	0x2dda0000,
+	0xb0dfffbe,
+	0x90600000,
+	0x01010000,
+	0x83e00003,
+	0x84e00004,
+	0x85e00005,
+	0x86e00006,
+	0x87e00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee1000e,
+	0x50f00000,
+	0x0000002e,
+	0x00000068,
+	0x00000069,
+	0x00000073,
+	0x00000074,
+	0x0000006f,
+	0x00000072,
+	0x00000079,
+	0x00000000,
+	0x00000057,
+	0x00000049,
+	0x0000004e,
+	0x00000049,
+	0x00000058,
+	0x0000003e,
+	0x00000020,
+	0x00000000,
+	0x00000000,
+	0x00000924,
+	0x00001753,
+	0x00000a39,
+	0x0000174d,
+	0x00000a4c,
+	0x00001745,
+	0x00000ad7,
+	0x00001740,
+	0x00000941,
+	0x0000173b,
+	0x00000a6c,
+	0x00001737,
+	0x00000a5f,
+	0x00001732,
+	0x00000b3b,
+	0x0000172d,
+	0x000009bd,
+	0x00001728,
+	0x000009bd,
+	0x00001726,
+	0x000009a1,
+	0x00001723,
+	0x00000a2a,
+	0x0000171d,
+	0x00000b6a,
+	0x0000171a,
+	0x00000a07,
+	0x00001714,
+	0x00000000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010015,
+	0x9de00000,
+	0x90e00001,
+	0x60000bae,
+	0x0d010001,
+	0x9d0018e5,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30008,
+	0x96e00004,
+	0x97e00005,
+	0x9de00006,
+	0x9fe00007,
+	0x1d010014,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x60000bae,
+	0x0d010001,
+	0x0701000d,
+	0x60000601,
+	0x90e00000,
+	0x8d0018e5,
+	0x9de00001,
+	0x60000c23,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x16010001,
+	0x40000627,
+	0x06010000,
+	0x96e00000,
+	0x1d010045,
+	0x9de00001,
+	0xcd001705,
+	0x9de00002,
+	0x60000d8c,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010001,
+	0x9de00002,
+	0xcd0018bc,
+	0x9de00003,
+	0x60000bae,
+	0x1d010001,
+	0x9d0005e2,
+	0x86e00004,
+	0x87e00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x1d010031,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x3d0e0000,
+	0x1ddd0001,
+	0x9de00002,
+	0x60000bae,
+	0x1d010031,
+	0x9de00000,
+	0x1d010012,
+	0x9de00001,
+	0x3d0e0000,
+	0x1ddd0001,
+	0x9de00002,
+	0x60000bae,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30009,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x1d010016,
+	0x9de00000,
+	0x1d012101,
+	0x9de00001,
+	0x8de00009,
+	0x9de00002,
+	0x1d0101b6,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0701000d,
+	0x2d760000,
+	0xb0d0000f,
+	0x60000b94,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d03000d,
+	0x1dd30001,
+	0x1c010001,
+	0x0dd1000c,
+	0x0101000d,
+	0x40000687,
+	0x8de0000a,
+	0x9de00000,
+	0x60000b96,
+	0x0d010001,
+	0x1c010018,
+	0x9ce00000,
+	0x97e00001,
+	0x8ce0000a,
+	0x9ce00002,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x9de00008,
+	0x1d010019,
+	0x9de00000,
+	0x97e00001,
+	0x60000bae,
+	0x81e00008,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee3006c,
+	0x96e00004,
+	0x97e00005,
+	0x9de00006,
+	0x9fe00007,
+	0x60000601,
+	0x8de0006c,
+	0x3dd40002,
+	0xb0d0002a,
+	0x8de0006d,
+	0x8dd00001,
+	0x9de00000,
+	0xcd001702,
+	0x9de00001,
+	0x60001058,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00021,
+	0x90e00008,
+	0x17010002,
+	0x400006b7,
+	0x1de10008,
+	0x9de00000,
+	0x8de0006d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00001,
+	0x1d010064,
+	0x9de00002,
+	0x6000154f,
+	0x8de0006c,
+	0x1dd20001,
+	0x2d76000d,
+	0xb0d00007,
+	0x1de10008,
+	0x9de00000,
+	0xcd001700,
+	0x9de00001,
+	0x1d010064,
+	0x9de00002,
+	0x6000154f,
+	0x17700001,
+	0x8de0006c,
+	0x2d70000d,
+	0xb0dfffe8,
+	0x1de10008,
+	0x9de00000,
+	0x600008b9,
+	0x0d010001,
+	0x0101000d,
+	0x400006fc,
+	0x6000060e,
+	0x6000063d,
+	0x400006ef,
+	0xcd0005da,
+	0x9de00000,
+	0x60001020,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00001,
+	0x400006f0,
+	0x97e00000,
+	0x60000b96,
+	0x0d010001,
+	0x0601000d,
+	0x2d680000,
+	0xb0d00007,
+	0x8d700000,
+	0x9de0006b,
+	0x3dd80023,
+	0xb0d00003,
+	0x8de0006b,
+	0x3dda000a,
+	0xb0d00001,
+	0x400006ef,
+	0x8d700000,
+	0x2dd80000,
+	0xb0d00006,
+	0x97e00000,
+	0x60000db8,
+	0xcd0005d1,
+	0x9de00000,
+	0x97e00001,
+	0x60000654,
+	0x1d620001,
+	0x0dd10007,
+	0x8dd00000,
+	0x3dda000a,
+	0xb0d00003,
+	0x1d620001,
+	0x0dd10007,
+	0x90d00000,
+	0x97e00000,
+	0x600008b9,
+	0x97e00000,
+	0x60001492,
+	0x400006c3,
+	0x8d0005e2,
+	0x2dd80000,
+	0xb0d00008,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0xcd0018bc,
+	0x9de00003,
+	0x60000bae,
+	0x01010000,
+	0x86e00004,
+	0x87e00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1006c,
+	0x50f00000,
+	0x1ee30015,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00015,
+	0x9de00000,
+	0xcd0016fa,
+	0x9de00001,
+	0x8de00016,
+	0x0d01000d,
+	0x9de00002,
+	0x60000bb0,
+	0x8de00015,
+	0x9de00000,
+	0x8de00017,
+	0x9de00001,
+	0x8de00016,
+	0x0d01000d,
+	0x9de00002,
+	0x6000154f,
+	0x1d010020,
+	0x9de00000,
+	0x8de00015,
+	0x9de00001,
+	0x1de10007,
+	0x9de00002,
+	0x60000bae,
+	0x0d010001,
+	0x9de00014,
+	0x8de00014,
+	0x2dd80000,
+	0xb0d00002,
+	0x81e00014,
+	0x4000072f,
+	0x8de00009,
+	0x1c018000,
+	0x0ddb000c,
+	0x2dd90000,
+	0xb0d00002,
+	0x07010000,
+	0x4000072e,
+	0x370effff,
+	0x177dffff,
+	0x01010007,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10015,
+	0x50f00000,
+	0x1ee30065,
+	0x97e00006,
+	0x9be00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x8de00066,
+	0x8ce00065,
+	0x1cc10065,
+	0x0dd1000c,
+	0x87d00000,
+	0x1d010003,
+	0x9de0002b,
+	0x1de1000d,
+	0x9de00000,
+	0x1d01001e,
+	0x9de00001,
+	0x8de00065,
+	0x1dd10076,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00002,
+	0x60000702,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d0000d,
+	0x8d000c0c,
+	0x9de00000,
+	0xcd0016e4,
+	0x9de00001,
+	0x8de00065,
+	0x1dd10076,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00002,
+	0x60000c11,
+	0x310effff,
+	0x111dffff,
+	0x40000830,
+	0x1de1002f,
+	0x9de00000,
+	0x60000cdf,
+	0x8de00066,
+	0x2dda0000,
+	0xb0d0000f,
+	0x8de00065,
+	0x8dd00095,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0000a,
+	0x1de1002f,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x8ce00065,
+	0x8cc00095,
+	0x9ce00002,
+	0x9de00003,
+	0x90e00004,
+	0x60000cf5,
+	0x8de00065,
+	0x9de0000b,
+	0x8ce00066,
+	0x8bd00064,
+	0x1bb20001,
+	0x2dca000b,
+	0xb0d0001e,
+	0x8de0000b,
+	0x8dd00096,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00019,
+	0x1d010101,
+	0x9de0000c,
+	0x8de00065,
+	0x8dd00097,
+	0x2dd80000,
+	0xb0d00004,
+	0x8de0000c,
+	0x1ddd2000,
+	0x9de0000c,
+	0x4000078a,
+	0x8de0000c,
+	0x1ddd1000,
+	0x9de0000c,
+	0x1de1002f,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x8de00065,
+	0x8dd00096,
+	0x9de00002,
+	0x8de0000c,
+	0x9de00003,
+	0x1d0101b4,
+	0x9de00004,
+	0x60000cf5,
+	0x8de00065,
+	0x8dd00064,
+	0x3dd40001,
+	0xb0d00030,
+	0x8de00066,
+	0x1dd00001,
+	0x8ce00065,
+	0x8cc00064,
+	0x2dd6000c,
+	0xb0d00014,
+	0x1de1002f,
+	0x9de00000,
+	0x1d010001,
+	0x8ce00067,
+	0x8cc00001,
+	0x9ce00001,
+	0x9de00002,
+	0x60000d21,
+	0x1de1002f,
+	0x9de00000,
+	0x8de00067,
+	0x8dd00001,
+	0x9de00001,
+	0x60000d0c,
+	0x1de1002f,
+	0x9de00000,
+	0x8de00067,
+	0x8dd00000,
+	0x9de00001,
+	0x60000d0c,
+	0x8de00066,
+	0x2dd40000,
+	0xb0d00013,
+	0x1de1002f,
+	0x9de00000,
+	0x8de00068,
+	0x8dd00000,
+	0x9de00001,
+	0x90e00002,
+	0x60000d21,
+	0x1de1002f,
+	0x9de00000,
+	0x8de00068,
+	0x8dd00000,
+	0x9de00001,
+	0x60000d0c,
+	0x1de1002f,
+	0x9de00000,
+	0x8de00068,
+	0x8dd00001,
+	0x9de00001,
+	0x60000d0c,
+	0x1de10060,
+	0x9de00000,
+	0x60000d36,
+	0x1de1002e,
+	0x9de00000,
+	0x60001273,
+	0x1de1002e,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x6000123b,
+	0x1de1002e,
+	0x9de00000,
+	0x1d010012,
+	0x9de00001,
+	0x6000123b,
+	0x1de10060,
+	0x9de00000,
+	0x1de1002e,
+	0x9de00001,
+	0x60000d64,
+	0x1de10060,
+	0x9de00000,
+	0x8d0018e4,
+	0x9de00001,
+	0x60000d59,
+	0x8d0018e4,
+	0x2dda0000,
+	0xb0d00007,
+	0x1de10060,
+	0x9de00000,
+	0x90e00001,
+	0x60000d7c,
+	0x8de0002b,
+	0x1ddd0008,
+	0x9de0002b,
+	0x1de10060,
+	0x9de00000,
+	0x8de0002b,
+	0x9de00001,
+	0x60000d46,
+	0x8d0005e2,
+	0x2dd80000,
+	0xb0d00008,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0xcd0018bc,
+	0x9de00003,
+	0x60000bae,
+	0x60000be7,
+	0x0d010001,
+	0x1ce1002c,
+	0x9ce00000,
+	0x1ce1000d,
+	0x9ce00001,
+	0x1ce1002f,
+	0x9ce00002,
+	0x1ce10060,
+	0x9ce00003,
+	0x8ce00065,
+	0x1cc10076,
+	0x0c71000c,
+	0x9ce00004,
+	0x9de00005,
+	0x60000c55,
+	0x0d010001,
+	0x9de0002d,
+	0x1de10060,
+	0x9de00000,
+	0x60000d44,
+	0x1de1002f,
+	0x9de00000,
+	0x60000ced,
+	0x8de0002d,
+	0x2dd80000,
+	0xb0d00011,
+	0x60000b94,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8ce0002d,
+	0x0c01000c,
+	0x9cd00000,
+	0xcd0016de,
+	0x9de00000,
+	0x60001097,
+	0x310effff,
+	0x111dffff,
+	0x40000830,
+	0x8d0018e4,
+	0x2dda0000,
+	0xb0d00002,
+	0x8de0002c,
+	0x9d0018e4,
+	0x81e0002c,
+	0x87e00006,
+	0x8be00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee10065,
+	0x50f00000,
+	0x1ee30018,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x06010000,
+	0x8de00018,
+	0x8dd00075,
+	0x2dda0000,
+	0xb0d00002,
+	0x11010001,
+	0x400008af,
+	0x0d010000,
+	0x9d0018e4,
+	0x0701000d,
+	0x4000087c,
+	0x1d7a0001,
+	0x1ce1000d,
+	0x05d1000c,
+	0x8de00018,
+	0x8dd00064,
+	0x1dd20001,
+	0x2d76000d,
+	0xb0d0000e,
+	0x1d01001b,
+	0x9de00000,
+	0x95e00001,
+	0x60000bae,
+	0x0d010001,
+	0x0401000d,
+	0x2d480000,
+	0xb0d00006,
+	0xcd0016d9,
+	0x9de00000,
+	0x60001097,
+	0x310effff,
+	0x111dffff,
+	0x400008af,
+	0x8de00018,
+	0x9de00000,
+	0x97e00001,
+	0x95e00002,
+	0x96e00003,
+	0x60000735,
+	0x0d010001,
+	0x0301000d,
+	0x8de00018,
+	0x1dd1006d,
+	0x0d71000d,
+	0x93d00000,
+	0x0d010006,
+	0x2dd90000,
+	0xb0d0000a,
+	0x1d010019,
+	0x9de00000,
+	0x8d600000,
+	0x9de00001,
+	0x60000bae,
+	0x1d010019,
+	0x9de00000,
+	0x8d600001,
+	0x9de00001,
+	0x60000bae,
+	0x06010005,
+	0x17700001,
+	0x8de00018,
+	0x8dd00064,
+	0x2d70000d,
+	0xb0dfffcb,
+	0x07010000,
+	0x400008a4,
+	0x8de00018,
+	0x1dd1006d,
+	0x0d71000d,
+	0x8dd00000,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d00001,
+	0x400008a3,
+	0x1d01000a,
+	0x9de00000,
+	0x8de00018,
+	0x1dd1006d,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00001,
+	0x1de10017,
+	0x9de00002,
+	0x1d010002,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0401000d,
+	0x8de00017,
+	0x1ddb007f,
+	0x9de0000c,
+	0x3dd80011,
+	0xb0d00003,
+	0x8de0000c,
+	0x3dda0012,
+	0xb0d00002,
+	0x8d0018e4,
+	0x9d0018e3,
+	0x17700001,
+	0x8de00018,
+	0x8dd00064,
+	0x2d70000d,
+	0xb0dfffda,
+	0x90e00000,
+	0x8d0018e5,
+	0x9de00001,
+	0x60000c23,
+	0x8de00017,
+	0x1dde0008,
+	0x11db00ff,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee10018,
+	0x50f00000,
+	0x1ee300a8,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x07010000,
+	0x8de000a8,
+	0x9de00000,
+	0x1de1000d,
+	0x9de00001,
+	0x60000400,
+	0x0d010000,
+	0x9de0000b,
+	0x8ce000a6,
+	0x0c01000c,
+	0x2dc9000d,
+	0xb0d0002a,
+	0x8de000a7,
+	0x0d01000d,
+	0x8ce0000b,
+	0x2dd9000c,
+	0xb0d00025,
+	0x1d010064,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x9de0000c,
+	0x8de000a7,
+	0x9de00000,
+	0x8de0000c,
+	0x9de00001,
+	0x1d010064,
+	0x9de00002,
+	0x6000056e,
+	0x8de0000c,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00010,
+	0x1d010001,
+	0x9de00000,
+	0xcd0016cb,
+	0x9de00001,
+	0x8de000a6,
+	0x9de00002,
+	0x8de0000c,
+	0x9de00003,
+	0x60000c11,
+	0x8de000a6,
+	0x9de00000,
+	0x8de0000c,
+	0x9de00001,
+	0x1d010001,
+	0x9de00002,
+	0x60000e5d,
+	0x8de0000c,
+	0x9de00000,
+	0x60001492,
+	0x01010000,
+	0x4000091d,
+	0xc70005e3,
+	0x400008f8,
+	0x17710002,
+	0x0d010000,
+	0x9de0000a,
+	0x0c010007,
+	0x2dc9000d,
+	0xb0d0000e,
+	0x8d700001,
+	0x9de00009,
+	0x0c01000d,
+	0x8be0000a,
+	0x2dc9000b,
+	0xb0d00008,
+	0x8de00083,
+	0x9de00000,
+	0x8de00009,
+	0x9de00001,
+	0x60001058,
+	0x0d010001,
+	0x2dda0000,
+	0xb0dfffec,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00009,
+	0x8de00082,
+	0x9de00000,
+	0x1de10083,
+	0x9de00001,
+	0x8d700000,
+	0x70d00000,
+	0x0d010001,
+	0x0101000d,
+	0x4000091d,
+	0x1de1000d,
+	0x9de00000,
+	0x60000837,
+	0x0d010001,
+	0x0101000d,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee100a8,
+	0x50f00000,
+	0x1ee30007,
+	0x96e00003,
+	0x97e00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000be7,
+	0x0d010001,
+	0x0601000d,
+	0x40000933,
+	0x1d010001,
+	0x9de00000,
+	0xcd0016c7,
+	0x9de00001,
+	0x97e00002,
+	0x60000c11,
+	0x0d010006,
+	0x16d10001,
+	0x8dd00000,
+	0x0701000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dffff3,
+	0x01010000,
+	0x86e00003,
+	0x87e00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee3000a,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00008,
+	0x1d010001,
+	0x9de00007,
+	0x8de0000a,
+	0x3dd60002,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd0016b1,
+	0x9de00001,
+	0x60000c11,
+	0x11010001,
+	0x4000099c,
+	0x8de0000b,
+	0x8dd00001,
+	0x8dd00000,
+	0x3dda002d,
+	0xb0d0001c,
+	0x8de0000b,
+	0x8dd00001,
+	0x1dd10001,
+	0x9de00000,
+	0x1de10009,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x600012a3,
+	0x0d010001,
+	0x9de00008,
+	0x8de00009,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000b,
+	0x8d000c0c,
+	0x9de00000,
+	0xcd00169c,
+	0x9de00001,
+	0x8de0000b,
+	0x8dd00001,
+	0x1dd10001,
+	0x9de00002,
+	0x60000c11,
+	0x11010001,
+	0x4000099c,
+	0x1d010002,
+	0x9de00007,
+	0x8de00007,
+	0x8ce0000b,
+	0x0dd1000c,
+	0x8dd00000,
+	0x9de00000,
+	0x1de10009,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x600012a3,
+	0x0d010001,
+	0x9de00006,
+	0x8de00009,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000a,
+	0x8d000c0c,
+	0x9de00000,
+	0xcd00169c,
+	0x9de00001,
+	0x8de0000b,
+	0x8dd00002,
+	0x9de00002,
+	0x60000c11,
+	0x11010001,
+	0x4000099c,
+	0x1d01000b,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x60000bae,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00003,
+	0xcd001696,
+	0x9de00000,
+	0x60001097,
+	0x01010000,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee1000a,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00005,
+	0x3dd60002,
+	0xb0d00002,
+	0x11010001,
+	0x400009b8,
+	0x1d01001d,
+	0x9de00000,
+	0x8de00006,
+	0x8dd00001,
+	0x9de00001,
+	0x60000bae,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00003,
+	0xcd001695,
+	0x9de00000,
+	0x60001097,
+	0x01010007,
+	0x87e00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0xc70005e3,
+	0x1d010001,
+	0x9de00000,
+	0xcd001681,
+	0x9de00001,
+	0x60000c11,
+	0x400009d1,
+	0x1d010001,
+	0x9de00000,
+	0xcd00167a,
+	0x9de00001,
+	0x8d700001,
+	0x9de00002,
+	0x60000c11,
+	0x17710002,
+	0x0d010000,
+	0x9de00007,
+	0x0c010007,
+	0x2dc9000d,
+	0xb0d00005,
+	0x8d700001,
+	0x0d01000d,
+	0x8ce00007,
+	0x2ddb000c,
+	0xb0dfffee,
+	0x01010000,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x0000006c,
+	0x00000073,
+	0x00000020,
+	0x0000002d,
+	0x0000006c,
+	0x00000061,
+	0x00000068,
+	0x00000020,
+	0x0000002f,
+	0x00000062,
+	0x00000069,
+	0x0000006e,
+	0x00000020,
+	0x0000007c,
+	0x00000020,
+	0x00000067,
+	0x00000072,
+	0x00000065,
+	0x00000070,
+	0x00000020,
+	0x00000073,
+	0x0000006e,
+	0x00000061,
+	0x0000006b,
+	0x00000065,
+	0x00000020,
+	0x0000007c,
+	0x00000020,
+	0x00000077,
+	0x00000063,
+	0x00000020,
+	0x0000007c,
+	0x00000020,
+	0x00000063,
+	0x00000061,
+	0x00000074,
+	0x00000000,
+	0x1ee30005,
+	0x96e00001,
+	0x97e00002,
+	0x9de00003,
+	0x9fe00004,
+	0x07010000,
+	0xcd0009e2,
+	0x9de00000,
+	0x600008b9,
+	0x0d010001,
+	0x0601000d,
+	0x2dd80000,
+	0xb0d00001,
+	0x40000a18,
+	0x17700001,
+	0x3d70000a,
+	0xb0dffff5,
+	0x01010000,
+	0x86e00001,
+	0x87e00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x0000001b,
+	0x0000005b,
+	0x00000030,
+	0x0000003b,
+	0x00000030,
+	0x00000048,
+	0x0000001b,
+	0x0000005b,
+	0x00000032,
+	0x0000004a,
+	0x00000000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x1d010001,
+	0x9de00000,
+	0xcd001677,
+	0x9de00001,
+	0xcd000a1f,
+	0x9de00002,
+	0x60000c11,
+	0x01010000,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010001,
+	0x9de00000,
+	0xcd00164c,
+	0x9de00001,
+	0x60000c11,
+	0x1d01000d,
+	0x9de00000,
+	0x1d010004,
+	0x9de00001,
+	0x60000bae,
+	0x0d010001,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010001,
+	0x9de00000,
+	0xcd001631,
+	0x9de00001,
+	0x60000c11,
+	0x1d01000d,
+	0x9de00000,
+	0x1d010005,
+	0x9de00001,
+	0x60000bae,
+	0x0d010001,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x1d01000d,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x60000bae,
+	0x01010000,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000c,
+	0x9de00000,
+	0x60000bae,
+	0x0d010001,
+	0x1c010001,
+	0x9ce00000,
+	0xcc00162d,
+	0x9ce00001,
+	0x9de00002,
+	0x60000c11,
+	0x01010000,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000e,
+	0x96e00000,
+	0x97e00001,
+	0x98e00002,
+	0x99e00003,
+	0x9ae00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x16010001,
+	0x40000aca,
+	0x1de10009,
+	0x1c010005,
+	0x0cc40006,
+	0x8be0000e,
+	0x09c1000b,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x88900002,
+	0x8a900003,
+	0x98d00002,
+	0x9ad00003,
+	0x88900004,
+	0x98d00004,
+	0x07010006,
+	0x40000aaf,
+	0x1d010005,
+	0x0dd40007,
+	0x8ce0000e,
+	0x0bd1000c,
+	0x9be00008,
+	0x1dd20005,
+	0x09d1000c,
+	0x8de00008,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x88900002,
+	0x8a900003,
+	0x98d00002,
+	0x9ad00003,
+	0x88900004,
+	0x98d00004,
+	0x17720001,
+	0x2d740000,
+	0xb0d00009,
+	0x1d010005,
+	0x0dd40007,
+	0x1dd20005,
+	0x8ce0000e,
+	0x0dd1000c,
+	0x8dd00003,
+	0x8ce0000c,
+	0x2dd0000c,
+	0xb0dfffe2,
+	0x1d010005,
+	0x0dd40007,
+	0x8ce0000e,
+	0x0dd1000c,
+	0x19e10009,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x88900002,
+	0x8a900003,
+	0x98d00002,
+	0x9ad00003,
+	0x88900004,
+	0x98d00004,
+	0x16600001,
+	0x8de0000f,
+	0x2d60000d,
+	0xb0dfffbe,
+	0x86e00000,
+	0x87e00001,
+	0x88e00002,
+	0x89e00003,
+	0x8ae00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x1ee1000e,
+	0x50f00000,
+	0x1ee3000d,
+	0x96e00007,
+	0x97e00008,
+	0x9be00009,
+	0x9ce0000a,
+	0x9de0000b,
+	0x9fe0000c,
+	0x8de0000d,
+	0x3dd60002,
+	0xb0d00008,
+	0x1d01000d,
+	0x9de00000,
+	0x1d010003,
+	0x9de00001,
+	0x60000bae,
+	0x0d010001,
+	0x0101000d,
+	0x40000b33,
+	0x8de0000e,
+	0x8dd00001,
+	0x9de00000,
+	0xcd00162a,
+	0x9de00001,
+	0x60001058,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00007,
+	0x8d000c0c,
+	0x9de00000,
+	0xcd001618,
+	0x9de00001,
+	0x60000c11,
+	0x11010001,
+	0x40000b33,
+	0x1d01000d,
+	0x9de00000,
+	0x1d010009,
+	0x9de00001,
+	0xcd00177c,
+	0x9de00002,
+	0x1d010040,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0601000d,
+	0x2d660000,
+	0xb0d00005,
+	0xcd001740,
+	0x9de00000,
+	0x60001097,
+	0x11010001,
+	0x40000b33,
+	0xcd00177c,
+	0x9de00000,
+	0x96e00001,
+	0x60000a80,
+	0x1d010001,
+	0x9de00000,
+	0xcd0015e9,
+	0x9de00001,
+	0x60000c11,
+	0x07010000,
+	0x40000b2b,
+	0x1d010001,
+	0x9de00000,
+	0xcd0015cd,
+	0x9de00001,
+	0x1d010005,
+	0x0dd40007,
+	0x8cd0177c,
+	0x0c01000c,
+	0x1b010001,
+	0x0cc3000b,
+	0x9ce00002,
+	0x8cd0177f,
+	0x9ce00003,
+	0x8cd01780,
+	0x9ce00004,
+	0x8cd0177d,
+	0x9ce00005,
+	0x8dd0177e,
+	0x9de00006,
+	0x60000c11,
+	0x17700001,
+	0x2d700006,
+	0xb0dfffe9,
+	0x1d010001,
+	0x9de00000,
+	0xcd001591,
+	0x9de00001,
+	0x60000c11,
+	0x01010000,
+	0x86e00007,
+	0x87e00008,
+	0x8be00009,
+	0x8ce0000a,
+	0x8de0000b,
+	0x8fe0000c,
+	0x1ee1000d,
+	0x50f00000,
+	0x1ee30007,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00006,
+	0x8de00007,
+	0x3dd40001,
+	0xb0d00018,
+	0x8de00008,
+	0x8dd00001,
+	0x9de00000,
+	0x1de10005,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x600012a3,
+	0x0d010001,
+	0x9de00006,
+	0x8de00005,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000a,
+	0x8d000c0c,
+	0x9de00000,
+	0xcd00169c,
+	0x9de00001,
+	0x8de00008,
+	0x8dd00001,
+	0x9de00002,
+	0x60000c11,
+	0x11010001,
+	0x40000b66,
+	0x1d010001,
+	0x9de00000,
+	0xcd00158b,
+	0x9de00001,
+	0x60000c11,
+	0x1d010002,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x90e00002,
+	0x60000bae,
+	0x11010001,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00004,
+	0x9de00005,
+	0x9fe00006,
+	0x90e00000,
+	0x8d0018e3,
+	0x9de00001,
+	0x60000c23,
+	0x1d01000b,
+	0x9de00000,
+	0x8d0018e3,
+	0x0d03000d,
+	0x9de00001,
+	0x1d010013,
+	0x9de00002,
+	0x60000bae,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d0000c,
+	0x1d01000a,
+	0x9de00000,
+	0x8d0018e3,
+	0x0d03000d,
+	0x9de00001,
+	0x1de10007,
+	0x9de00002,
+	0x1d010002,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0701000d,
+	0x90e00000,
+	0x8d0018e5,
+	0x9de00001,
+	0x60000c23,
+	0x01010007,
+	0x87e00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00003,
+	0x9de00002,
+	0x40000b9f,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00003,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffff9,
+	0x8de00003,
+	0x0d01000d,
+	0x8ce00002,
+	0x0c01000c,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0101000d,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30004,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x9de00003,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x40000bc3,
+	0x8de00004,
+	0x1cd10001,
+	0x9ce00004,
+	0x8ce00005,
+	0x1bc10001,
+	0x9be00005,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00005,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00006,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00006,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00004,
+	0x90d00000,
+	0x81e00003,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0018e6,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000bae,
+	0xc10018e6,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x9fe00002,
+	0x8d000be6,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x60000b94,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c0103ff,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x9d000be6,
+	0x81000be6,
+	0x8ce00000,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000024,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01002d,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x1d01000c,
+	0x9de00002,
+	0x1de10007,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x80000006,
+	0x00000b40,
+	0x00000bff,
+	0x00000c05,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00005,
+	0x2dd90000,
+	0xb0d0000b,
+	0x87e00003,
+	0x0d010007,
+	0x17d10001,
+	0x8ce00004,
+	0x9cd00000,
+	0x8de00005,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de00005,
+	0x2ddb0000,
+	0xb0dffff6,
+	0x81e00003,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30044,
+	0x98e00003,
+	0x99e00004,
+	0x9ae00005,
+	0x9be00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x1de1000b,
+	0x9de00000,
+	0x90e00001,
+	0x1d010039,
+	0x9de00002,
+	0x60000c3d,
+	0x8de00045,
+	0x9de0000b,
+	0x8de00048,
+	0x9de0000c,
+	0x8de00049,
+	0x9de0000d,
+	0x8de00046,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0000a,
+	0x1de1000e,
+	0x89e00046,
+	0x19910031,
+	0x1bd10031,
+	0x19930001,
+	0x1bb30001,
+	0x88900000,
+	0x98b00000,
+	0x2ad1000b,
+	0xb0affffa,
+	0x8de00047,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0000c,
+	0x1de1003f,
+	0x89e00047,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x88900002,
+	0x8a900003,
+	0x98d00002,
+	0x9ad00003,
+	0x88900004,
+	0x98d00004,
+	0x1d010039,
+	0x9de00000,
+	0x1de1000b,
+	0x9de00001,
+	0x60000bae,
+	0x0d010001,
+	0x9de0000a,
+	0x8de0000a,
+	0x2dd60000,
+	0xb0d0000b,
+	0x60000b94,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0101000d,
+	0x40000ca4,
+	0x8de00044,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00044,
+	0x8ce0000a,
+	0x9cd00000,
+	0x01010000,
+	0x88e00003,
+	0x89e00004,
+	0x8ae00005,
+	0x8be00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee10044,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x0d010000,
+	0x9de00004,
+	0x8ce00007,
+	0x2dc0000d,
+	0xb0d00004,
+	0x8de00008,
+	0x8ce00004,
+	0x2dd6000c,
+	0xb0d00002,
+	0x11010009,
+	0x40000cd9,
+	0x8de00005,
+	0x8dd00000,
+	0x3dd00008,
+	0xb0d00002,
+	0x1101000c,
+	0x40000cd9,
+	0x8de00005,
+	0x8cd00000,
+	0x1bc00001,
+	0x9bd00000,
+	0x1d010006,
+	0x0dd4000c,
+	0x8ce00005,
+	0x1cc10001,
+	0x07d1000c,
+	0x8de00006,
+	0x9d700000,
+	0x8de00007,
+	0x9d700001,
+	0x8de00008,
+	0x9d700002,
+	0x8de00009,
+	0x9d700003,
+	0x8de0000a,
+	0x9d700004,
+	0x8de0000b,
+	0x9d700005,
+	0x01010000,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00005,
+	0x9de00000,
+	0x90e00001,
+	0x1d010031,
+	0x9de00002,
+	0x60000c3d,
+	0x01010000,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30001,
+	0x9de00000,
+	0x8de00001,
+	0x90d00000,
+	0x01010000,
+	0x8de00000,
+	0x1ee10001,
+	0x50f00000,
+	0x1ee30009,
+	0x9de00007,
+	0x9fe00008,
+	0x8de00009,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x8de0000a,
+	0x9de00002,
+	0x90e00003,
+	0x8de0000b,
+	0x9de00004,
+	0x8de0000c,
+	0x9de00005,
+	0x8de0000d,
+	0x9de00006,
+	0x60000cad,
+	0x0d010001,
+	0x0101000d,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30009,
+	0x9de00007,
+	0x9fe00008,
+	0x8de00009,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x8de0000a,
+	0x9de00002,
+	0x0d010000,
+	0x9de00003,
+	0x90e00004,
+	0x9de00005,
+	0x90e00006,
+	0x60000cad,
+	0x0d010001,
+	0x0101000d,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30009,
+	0x9de00007,
+	0x9fe00008,
+	0x8de00009,
+	0x9de00000,
+	0x1d010003,
+	0x9de00001,
+	0x8de0000a,
+	0x9de00002,
+	0x8de0000b,
+	0x9de00003,
+	0x90e00004,
+	0x90e00005,
+	0x90e00006,
+	0x60000cad,
+	0x0d010001,
+	0x0101000d,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00005,
+	0x9de00000,
+	0x90e00001,
+	0x1d010005,
+	0x9de00002,
+	0x60000c3d,
+	0x01010000,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x01010000,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00003,
+	0x3c0effff,
+	0x1ccdfff0,
+	0x0ddb000c,
+	0x2dd80000,
+	0xb0d00002,
+	0x11010016,
+	0x40000d55,
+	0x8de00002,
+	0x8ce00003,
+	0x9cd00000,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x8ce00003,
+	0x9cd00001,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x8ce00003,
+	0x8cc00000,
+	0x9cd00002,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x8ce00003,
+	0x8cc00000,
+	0x9cd00003,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00003,
+	0x2dd60000,
+	0xb0d00002,
+	0x11010009,
+	0x40000d88,
+	0x8de00002,
+	0x8ce00003,
+	0x9cd00004,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00006,
+	0x2dda0000,
+	0xb0d0000a,
+	0x8d000c0c,
+	0x9de00000,
+	0xcd001757,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x8de00007,
+	0x9de00003,
+	0x60000c11,
+	0x60000ea3,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0xc10018f6,
+	0x50f00000,
+	0x1ee30003,
+	0x9de00001,
+	0x9fe00002,
+	0x8d0018f6,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00001,
+	0x40000db4,
+	0x1d01000a,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x9d0018f6,
+	0x900018f7,
+	0x900018f8,
+	0x1d01000a,
+	0x9d0018f9,
+	0x900018fa,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d010002,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x0701000d,
+	0x60000da2,
+	0x8de00006,
+	0x9de00000,
+	0x60000e3b,
+	0x0d010001,
+	0x9d700000,
+	0x90700001,
+	0x8d0018f8,
+	0x8c0018f9,
+	0x2dd0000c,
+	0xb0d0000d,
+	0x8d0018f9,
+	0x1dda0001,
+	0x9d0018f9,
+	0x8d0018f6,
+	0x9de00000,
+	0x1d010001,
+	0x8c0018f9,
+	0x0c01000c,
+	0x0dd5000c,
+	0x9de00001,
+	0x60001112,
+	0x0d010001,
+	0x9d0018f6,
+	0x8d0018f8,
+	0x8c0018f6,
+	0x0dd1000c,
+	0x97d00000,
+	0x8d0018f7,
+	0x1dd00001,
+	0x9d0018f7,
+	0x8d0018f8,
+	0x1dd00001,
+	0x9d0018f8,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00003,
+	0x9de00002,
+	0x2dd00000,
+	0xb0d00004,
+	0x8d0018f8,
+	0x8ce00002,
+	0x2dc0000d,
+	0xb0d00002,
+	0x01010000,
+	0x40000dfb,
+	0x8de00003,
+	0x8c0018f6,
+	0x0dd1000c,
+	0x81d00000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8d0018f7,
+	0x2dd20000,
+	0xb0d00002,
+	0x01010000,
+	0x40000e0e,
+	0x8d0018f7,
+	0x1dd20001,
+	0x9d0018f7,
+	0x8d0018f7,
+	0x8c0018f6,
+	0x0dd1000c,
+	0x81d00000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8d0018f7,
+	0x8c0018f8,
+	0x1cc20001,
+	0x2dd0000c,
+	0xb0d00002,
+	0x01010000,
+	0x40000e23,
+	0x8d0018f7,
+	0x1dd00001,
+	0x9d0018f7,
+	0x8d0018f7,
+	0x8c0018f6,
+	0x0dd1000c,
+	0x81d00000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8d0018f7,
+	0x2dd00000,
+	0xb0d00004,
+	0x8d0018f7,
+	0x8c0018f8,
+	0x2dd0000c,
+	0xb0d00002,
+	0x01010000,
+	0x40000e37,
+	0x8d0018f7,
+	0x8c0018f6,
+	0x0dd1000c,
+	0x81d00000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30008,
+	0x96e00003,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de00008,
+	0x9de00000,
+	0x60000b96,
+	0x0d010001,
+	0x1c010001,
+	0x06d1000c,
+	0x96e00000,
+	0x600013de,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000e56,
+	0x97e00000,
+	0x8de00008,
+	0x9de00001,
+	0x96e00002,
+	0x60000bb0,
+	0x01010007,
+	0x86e00003,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30008,
+	0x96e00003,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de0000a,
+	0x2dda0000,
+	0xb0d00009,
+	0x8de00008,
+	0x9de00000,
+	0x600010b5,
+	0x0d010001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x01010000,
+	0x40000e9c,
+	0x8de00008,
+	0x9de00000,
+	0x60000b96,
+	0x0d010001,
+	0x8ce00009,
+	0x9ce00000,
+	0x60000b96,
+	0x0c010001,
+	0x0dd1000c,
+	0x1c010002,
+	0x0dd1000c,
+	0x0601000d,
+	0x0d010006,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x0701000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000e9c,
+	0x97e00000,
+	0x8de00008,
+	0x9de00001,
+	0x0d010006,
+	0x9de00002,
+	0x60000bb0,
+	0x97e00000,
+	0xcd001772,
+	0x9de00001,
+	0x0d010006,
+	0x9de00002,
+	0x6000154f,
+	0x97e00000,
+	0x8de00009,
+	0x9de00001,
+	0x0d010006,
+	0x9de00002,
+	0x6000154f,
+	0x97e00000,
+	0x60001199,
+	0x0d010001,
+	0x0101000d,
+	0x86e00003,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000c,
+	0x9de00000,
+	0x60000bae,
+	0x0d010001,
+	0x1c01000b,
+	0x9ce00000,
+	0x9de00001,
+	0x1d010006,
+	0x9de00002,
+	0x60000bae,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30005,
+	0x96e00000,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x40000ebe,
+	0x17710001,
+	0x8d700000,
+	0x9de00004,
+	0x2dd80000,
+	0xb0d00004,
+	0x8de00006,
+	0x8ce00004,
+	0x2dca000d,
+	0xb0dffff7,
+	0x8d700000,
+	0x2dd80000,
+	0xb0d00002,
+	0x06010007,
+	0x40000ecc,
+	0x06010000,
+	0x0d010006,
+	0x0101000d,
+	0x86e00000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x00000000,
+	0x000018fb,
+	0x00000000,
+	0x1ee30008,
+	0x9be00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010001,
+	0x9de00002,
+	0x8d000ed5,
+	0x9de00003,
+	0x60000bae,
+	0x8d000ed5,
+	0x1dd10003,
+	0x8cd00000,
+	0x3b0effff,
+	0x1bbdfff5,
+	0x0b01000b,
+	0x0ccb000b,
+	0x9cd00000,
+	0x8d000ed5,
+	0x1c010001,
+	0x9cd0000b,
+	0x8d000ed5,
+	0x90d0000a,
+	0x1d010001,
+	0x9d000ed4,
+	0x8be00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30007,
+	0x9de00004,
+	0x9fe00005,
+	0x1d010008,
+	0x9de00006,
+	0x8d000c36,
+	0x1dd20001,
+	0x9d000c36,
+	0x8d000c37,
+	0x1dd20001,
+	0x9d000c37,
+	0x1de10006,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x9de00002,
+	0x8d000c3c,
+	0x9de00003,
+	0x60001514,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30002,
+	0x9de00000,
+	0x9fe00001,
+	0x40000f15,
+	0x60000ef9,
+	0x8d000c37,
+	0x2dd20000,
+	0xb0dffffc,
+	0x8de00000,
+	0x8fe00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee3000b,
+	0x94e00004,
+	0x95e00005,
+	0x96e00006,
+	0x97e00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x60000f10,
+	0x0d010000,
+	0x9d000c36,
+	0x9d000c37,
+	0x8de0000b,
+	0x0d01000d,
+	0xcc000e12,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d0000a,
+	0x8d000ed6,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d00005,
+	0x60000e27,
+	0x0d010001,
+	0x0501000d,
+	0x90000ed6,
+	0x40000f4a,
+	0x8de0000b,
+	0x0d01000d,
+	0xcc000dff,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00008,
+	0x8d000ed6,
+	0x3dda0001,
+	0xb0d00005,
+	0x60000e27,
+	0x0d010001,
+	0x0501000d,
+	0x90000ed6,
+	0x40000f4a,
+	0x8de0000b,
+	0x70d00000,
+	0x0d010001,
+	0x0501000d,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0d0000c,
+	0x8de0000b,
+	0x0d01000d,
+	0xcc000dff,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00003,
+	0x340effff,
+	0x144dffff,
+	0x40000f57,
+	0x14010001,
+	0x94000ed6,
+	0x40000f79,
+	0x86500000,
+	0x96e00000,
+	0x60000b96,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x0d73000d,
+	0x0dd10006,
+	0x8dd00000,
+	0x3dda000a,
+	0xb0d00005,
+	0x1d010001,
+	0x0d73000d,
+	0x0701000d,
+	0x0dd10006,
+	0x90d00000,
+	0x96e00000,
+	0x1d010001,
+	0x9de00001,
+	0x97e00002,
+	0x8d000c3c,
+	0x9de00003,
+	0x60001514,
+	0x8d000c35,
+	0x9de00000,
+	0x96e00001,
+	0x1d010080,
+	0x9de00002,
+	0x60000bb0,
+	0x0d010007,
+	0x9d000c37,
+	0x9d000c36,
+	0x84e00004,
+	0x85e00005,
+	0x86e00006,
+	0x87e00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee1000b,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9de00001,
+	0x9fe00002,
+	0x60000da0,
+	0x0d010001,
+	0x0701000d,
+	0x8d700002,
+	0x9d700001,
+	0x87e00000,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee3000b,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x90e0000a,
+	0x0d010000,
+	0x9d000c36,
+	0x9d000c37,
+	0x9d000c39,
+	0x9d000c3a,
+	0x1d010080,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x9d000c35,
+	0x40001012,
+	0x1de1000a,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x9de00002,
+	0x8d000c3b,
+	0x9de00003,
+	0x600014fb,
+	0x0d010001,
+	0x0701000d,
+	0x3d0effff,
+	0x1dddffff,
+	0x2d7a000d,
+	0xb0d0000f,
+	0x60000b94,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x1c010004,
+	0x2ddb000c,
+	0xb0d00001,
+	0x40001012,
+	0x01010007,
+	0x40001019,
+	0x8de0000a,
+	0x8c000ed5,
+	0x8cc00009,
+	0x0c01000c,
+	0x2dda000c,
+	0xb0d00003,
+	0x1d010001,
+	0x9d000c3a,
+	0x40001013,
+	0x8de0000a,
+	0x8c000ed5,
+	0x8cc00007,
+	0x0c01000c,
+	0x2dda000c,
+	0xb0d00005,
+	0x8d000c36,
+	0x2dd40000,
+	0xb0d00041,
+	0x60000ef9,
+	0x40001012,
+	0x8de0000a,
+	0x8c000ed5,
+	0x8cc00008,
+	0x0c01000c,
+	0x2dda000c,
+	0xb0d00002,
+	0x60000f10,
+	0x40001012,
+	0x8de0000a,
+	0x3dda0010,
+	0xb0d00004,
+	0xcd000dff,
+	0x9de00000,
+	0x60000f1c,
+	0x40001012,
+	0x8de0000a,
+	0x3dda000e,
+	0xb0d00004,
+	0xcd000e12,
+	0x9de00000,
+	0x60000f1c,
+	0x40001012,
+	0x8d000c37,
+	0x3dd00080,
+	0xb0d00001,
+	0x40001013,
+	0x8de0000a,
+	0x3dda000d,
+	0xb0d00002,
+	0x1d01000a,
+	0x9de0000a,
+	0x8de0000a,
+	0x9de00009,
+	0x1cd20020,
+	0x0c01000c,
+	0x1b01005f,
+	0x2dc1000b,
+	0xb0d00003,
+	0x8de00009,
+	0x3dda000a,
+	0xb0d00012,
+	0x8d000c36,
+	0x1dd00001,
+	0x9d000c36,
+	0x8d000c37,
+	0x1cd00001,
+	0x9c000c37,
+	0x8c000c35,
+	0x0dd1000c,
+	0x8ce0000a,
+	0x9cd00000,
+	0x1de1000a,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x9de00002,
+	0x8d000c3c,
+	0x9de00003,
+	0x60001514,
+	0x8de0000a,
+	0x3dda000a,
+	0xb0d00001,
+	0x40001013,
+	0x40000fa2,
+	0x60000f82,
+	0x8d000c37,
+	0x8c000c35,
+	0x0dd1000c,
+	0x90d00000,
+	0x01010000,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000b,
+	0x50f00000,
+	0x1ee30009,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8d000ed4,
+	0x2dda0000,
+	0xb0d00001,
+	0x60000ed7,
+	0x8de00009,
+	0x9d000c38,
+	0x8d000c38,
+	0x9de00000,
+	0x60000b96,
+	0x0d010001,
+	0x8c000c38,
+	0x9ce00000,
+	0x1c010001,
+	0x9ce00001,
+	0x9de00002,
+	0xcd000c05,
+	0x9de00003,
+	0x60001514,
+	0x8d000ed4,
+	0x2dd80000,
+	0xb0d00008,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0x8d000ed5,
+	0x9de00003,
+	0x60000bae,
+	0x60000f90,
+	0x0d010001,
+	0x9de00008,
+	0x0d010000,
+	0x9de00007,
+	0x8c000c3a,
+	0x2dc8000d,
+	0xb0d00004,
+	0x8d000c37,
+	0x8ce00007,
+	0x2dd8000c,
+	0xb0d00003,
+	0x8de00008,
+	0x2dd80000,
+	0xb0d00002,
+	0x01010000,
+	0x40001053,
+	0x81000c35,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x40001069,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x2dd8000c,
+	0xb0d00001,
+	0x40001074,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00004,
+	0x1dd10001,
+	0x9de00004,
+	0x0d010000,
+	0x9de00002,
+	0x8ce00003,
+	0x8cc00000,
+	0x2dc8000d,
+	0xb0d00005,
+	0x8de00004,
+	0x8dd00000,
+	0x8ce00002,
+	0x2dda000c,
+	0xb0dfffe8,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x01d2000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d00107d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x4000108b,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x8100107d,
+	0x40001093,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x60000bae,
+	0x0d010001,
+	0x9d00107d,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000b94,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000bd5,
+	0x0d010001,
+	0x8c000c0c,
+	0x9ce00000,
+	0xcc001774,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000c11,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30007,
+	0x95e00000,
+	0x96e00001,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00007,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x400010e6,
+	0x60000be7,
+	0x0d010001,
+	0x0501000d,
+	0x400010de,
+	0x87e00007,
+	0x400010c9,
+	0x17710001,
+	0x8d700000,
+	0x9de00006,
+	0x2dd80000,
+	0xb0d00006,
+	0x0d010006,
+	0x16d10001,
+	0x8dd00000,
+	0x8ce00006,
+	0x2dc8000d,
+	0xb0dffff5,
+	0x8d700000,
+	0x2dda0000,
+	0xb0d00003,
+	0x8d600000,
+	0x3dd8003d,
+	0xb0d00001,
+	0x400010de,
+	0x1d610001,
+	0x0d01000d,
+	0x0101000d,
+	0x400010e6,
+	0x0d010005,
+	0x15d10001,
+	0x8dd00000,
+	0x0601000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dfffe1,
+	0x01010000,
+	0x85e00000,
+	0x86e00001,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30006,
+	0x95e00000,
+	0x96e00001,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x86d00004,
+	0x8de00007,
+	0x85d00004,
+	0x07010000,
+	0x40001100,
+	0x0d710005,
+	0x0c710006,
+	0x8cc00000,
+	0x9cd00000,
+	0x1d010001,
+	0x0771000d,
+	0x1d7a0002,
+	0x9de00005,
+	0x8ce00006,
+	0x8cc00000,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de00007,
+	0x8dd00000,
+	0x8ce00005,
+	0x2dc1000d,
+	0xb0dfffef,
+	0x85e00000,
+	0x86e00001,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000c,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de0000c,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00006,
+	0x8de0000d,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x0101000d,
+	0x40001192,
+	0x8de0000c,
+	0x9de00000,
+	0x60001466,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d0006a,
+	0x8de0000d,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de0000a,
+	0x8de0000c,
+	0x9de00000,
+	0x6000145b,
+	0x0d010001,
+	0x9de0000b,
+	0x8de0000b,
+	0x8dd00000,
+	0x8ce0000a,
+	0x2dd1000c,
+	0xb0d0000d,
+	0x8de0000b,
+	0x8dd00000,
+	0x8ce0000a,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d0004f,
+	0x8de0000b,
+	0x9de00000,
+	0x8de0000a,
+	0x9de00001,
+	0x60001389,
+	0x4000118f,
+	0x8de0000b,
+	0x8dd00001,
+	0x9de00009,
+	0x8de00009,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00027,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00023,
+	0x8de0000b,
+	0x8bd00000,
+	0x8dd00004,
+	0x0d01000d,
+	0x0d01000d,
+	0x0d01000d,
+	0x0dd1000b,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00018,
+	0x1d010005,
+	0x0db1000d,
+	0x8ce00006,
+	0x8cc00000,
+	0x0dd1000c,
+	0x8ce0000a,
+	0x2dd1000c,
+	0xb0d00010,
+	0x8de0000b,
+	0x9de00000,
+	0x60001426,
+	0x8de0000b,
+	0x8dd00000,
+	0x8ce0000a,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00020,
+	0x8de0000b,
+	0x9de00000,
+	0x8de0000a,
+	0x9de00001,
+	0x60001389,
+	0x4000118f,
+	0x8de0000a,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x9de00008,
+	0x8de00008,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40001192,
+	0x8de00008,
+	0x9de00000,
+	0x6000145b,
+	0x0d010001,
+	0x9de00007,
+	0x8de0000b,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x600010ee,
+	0x8de0000c,
+	0x9de00000,
+	0x60001492,
+	0x81e00008,
+	0x40001192,
+	0x81e0000c,
+	0x40001192,
+	0x01010000,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee1000c,
+	0x50f00000,
+	0x00000000,
+	0x1ee3000b,
+	0x94e00002,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9be00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x8de0000b,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40001231,
+	0x60000be7,
+	0x0d010001,
+	0x0701000d,
+	0x8de0000b,
+	0x9de00000,
+	0x1d01003d,
+	0x9de00001,
+	0x60000eb6,
+	0x0d010001,
+	0x0601000d,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0002c,
+	0x90600000,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00025,
+	0x400011d7,
+	0x85e0000b,
+	0x0d010005,
+	0x9de0000a,
+	0x8cd00000,
+	0x2dc80000,
+	0xb0d00009,
+	0x8de0000a,
+	0x15d10001,
+	0x0d010004,
+	0x14d10001,
+	0x8ce0000a,
+	0x8cc00000,
+	0x8dd00000,
+	0x2dc8000d,
+	0xb0dffff2,
+	0x8d500000,
+	0x2dda0000,
+	0xb0d00003,
+	0x8d400000,
+	0x3dd8003d,
+	0xb0d00002,
+	0x17710001,
+	0x400011d7,
+	0x1d01003d,
+	0x9d600000,
+	0x8de0000b,
+	0x9d700000,
+	0x01010000,
+	0x40001231,
+	0x8d700000,
+	0x0d01000d,
+	0x0d01000d,
+	0x0401000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dfffdc,
+	0x1d01003d,
+	0x9d600000,
+	0x87000be6,
+	0x8d001198,
+	0x2dda0000,
+	0xb0d00029,
+	0x04010000,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x14400001,
+	0x0d010007,
+	0x17d10001,
+	0x8dd00000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dffff9,
+	0x1d01000a,
+	0x1c010001,
+	0x0b46000d,
+	0x0dd4000b,
+	0x1dd0000a,
+	0x0d01000d,
+	0x0dc5000d,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x0701000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x11010001,
+	0x40001231,
+	0x94001198,
+	0x85000be6,
+	0x97000be6,
+	0x0d010007,
+	0x17d10001,
+	0x0c010005,
+	0x15c10001,
+	0x8cc00000,
+	0x9cd00000,
+	0x0d01000c,
+	0x2ddb0000,
+	0xb0dffff7,
+	0x87000be6,
+	0x40001225,
+	0x8d001198,
+	0x1dd8000a,
+	0x2dda0000,
+	0xb0d00014,
+	0x8d000be6,
+	0x9de00000,
+	0x1d01000a,
+	0x1c010001,
+	0x8b001198,
+	0x0bb6000d,
+	0x0dd4000b,
+	0x1dd0000a,
+	0x0d01000d,
+	0x0dc5000d,
+	0x9de00001,
+	0x60001112,
+	0x0d010001,
+	0x0701000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x11010001,
+	0x40001231,
+	0x97000be6,
+	0x8d001198,
+	0x1dd20001,
+	0x0dd10007,
+	0x8ce0000b,
+	0x9cd00000,
+	0x8d001198,
+	0x0dd10007,
+	0x90d00000,
+	0x8d001198,
+	0x1dd00001,
+	0x9d001198,
+	0x01010000,
+	0x84e00002,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8be00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1000b,
+	0x50f00000,
+	0x1ee30004,
+	0x9ae00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40001250,
+	0x8de00004,
+	0x8cd00000,
+	0x1b010001,
+	0x8ae00005,
+	0x0bba000a,
+	0x0ccd000b,
+	0x9cd00000,
+	0x01010000,
+	0x8ae00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30004,
+	0x9ae00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x4000126d,
+	0x8de00004,
+	0x8cd00000,
+	0x1b010001,
+	0x8ae00005,
+	0x0bba000a,
+	0x0b03000b,
+	0x1bb30001,
+	0x0ccb000b,
+	0x9cd00000,
+	0x01010000,
+	0x8ae00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30001,
+	0x9de00000,
+	0x8de00001,
+	0x90d00000,
+	0x01010000,
+	0x8de00000,
+	0x1ee10001,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0e003f,
+	0x1ccdffff,
+	0x9cd00000,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30003,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x4000129e,
+	0x8de00003,
+	0x8dd00000,
+	0x1c010001,
+	0x8be00004,
+	0x0cca000b,
+	0x0ddb000c,
+	0x2dd90000,
+	0xb0d00002,
+	0x11010001,
+	0x4000129e,
+	0x01010000,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee3000d,
+	0x93e00000,
+	0x94e00001,
+	0x95e00002,
+	0x96e00003,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x16010001,
+	0x07010000,
+	0x400012b3,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000c,
+	0x1cd20009,
+	0x3dc00005,
+	0xb0d00003,
+	0x8de0000c,
+	0x3dda0020,
+	0xb0d00002,
+	0x15010001,
+	0x400012bf,
+	0x05010000,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002b,
+	0xb0d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x400012d3,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002d,
+	0xb0d00005,
+	0x360effff,
+	0x166dffff,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000f,
+	0x2dda0000,
+	0xb0d00022,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda0030,
+	0xb0d0001c,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd20041,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd00061,
+	0x14d20041,
+	0x400012e8,
+	0x8de0000d,
+	0x84d00001,
+	0x3d4a0078,
+	0xb0d00006,
+	0x1d010010,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10002,
+	0x9de0000d,
+	0x400012f8,
+	0x1d010008,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x400012f8,
+	0x1d01000a,
+	0x9de0000f,
+	0x8de0000f,
+	0x9de0000b,
+	0x3dd00002,
+	0xb0d00003,
+	0x8de0000b,
+	0x3dd40024,
+	0xb0d00048,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01010000,
+	0x40001364,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20030,
+	0x0d01000d,
+	0x1c01000a,
+	0x2dd7000c,
+	0xb0d00004,
+	0x8de0000d,
+	0x8dd00000,
+	0x14d20030,
+	0x40001323,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20061,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd00041,
+	0x13d20061,
+	0x40001321,
+	0x8de0000d,
+	0x83d00000,
+	0x1d320041,
+	0x14d0000a,
+	0x8de0000f,
+	0x2d40000d,
+	0xb0d00001,
+	0x4000135c,
+	0x3d0e7fff,
+	0x1dddffff,
+	0x0dd20004,
+	0x8ce0000f,
+	0x0dd6000c,
+	0x2d74000d,
+	0xb0d00013,
+	0x3d6a0001,
+	0xb0d00003,
+	0x330e7fff,
+	0x133dffff,
+	0x40001335,
+	0x330e8000,
+	0x133d0000,
+	0x07010003,
+	0x60000b94,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x1c010022,
+	0x9cd00000,
+	0x40001344,
+	0x8de0000f,
+	0x0d74000d,
+	0x07d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000a,
+	0x1cd20030,
+	0x0c01000c,
+	0x1b01000a,
+	0x2dc1000b,
+	0xb0dfffb9,
+	0x1d010006,
+	0x9de00009,
+	0x8ce0000a,
+	0x1cc20061,
+	0x0c01000c,
+	0x2dc1000d,
+	0xb0dfffb2,
+	0x8de0000a,
+	0x1dd20041,
+	0x0d01000d,
+	0x8ce00009,
+	0x2dd1000c,
+	0xb0dfffac,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01640007,
+	0x83e00000,
+	0x84e00001,
+	0x85e00002,
+	0x86e00003,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000d,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8700136f,
+	0x40001379,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x6000107e,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x6000107e,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x400013d8,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d00136f,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d00136f,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60001370,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60001389,
+	0x90700003,
+	0x4000141f,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x600013b1,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x40001420,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x600013b1,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40001420,
+	0x9700136f,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d00136f,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c00136f,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x6000107e,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x6000145b,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x40001489,
+	0x07010000,
+	0x01010007,
+	0x4000148c,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x60001466,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x6000145b,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x60001426,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x60001426,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x1d010006,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010007,
+	0x400014f5,
+	0x1d010016,
+	0x9de00000,
+	0x1d010102,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x60000bae,
+	0x0d010001,
+	0x9d700001,
+	0x8d700001,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d00001,
+	0x400014f2,
+	0x1d0101f4,
+	0x9de00000,
+	0x600013de,
+	0x0d010001,
+	0x9d700004,
+	0x8d700004,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x400014ef,
+	0x1d0101f4,
+	0x9d700003,
+	0x01010007,
+	0x400014f5,
+	0x8d700004,
+	0x9de00000,
+	0x60001492,
+	0x97e00000,
+	0x60001492,
+	0x01010000,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30008,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00009,
+	0x8ce0000a,
+	0x0dd5000c,
+	0x9de00007,
+	0x1d010017,
+	0x9de00000,
+	0x8de0000b,
+	0x8dd00001,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x8de00007,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0101000d,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30008,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00009,
+	0x8ce0000a,
+	0x0dd5000c,
+	0x9de00007,
+	0x1d010018,
+	0x9de00000,
+	0x8de0000b,
+	0x8dd00001,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x8de00007,
+	0x9de00003,
+	0x60000bae,
+	0x0d010001,
+	0x0101000d,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010019,
+	0x9de00000,
+	0x8de00005,
+	0x8dd00001,
+	0x9de00001,
+	0x60000bae,
+	0x0d010001,
+	0x9de00004,
+	0x8de00005,
+	0x8dd00004,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00004,
+	0x8de00005,
+	0x8dd00004,
+	0x9de00000,
+	0x60001492,
+	0x8de00005,
+	0x8dd00002,
+	0x1ddb0800,
+	0x1ddf0800,
+	0x2dd80000,
+	0xb0d00003,
+	0x8de00005,
+	0x9de00000,
+	0x60001492,
+	0x81e00004,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffffa,
+	0x8de00005,
+	0x3c0effff,
+	0x1ccdffff,
+	0x0dd1000c,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0c010007,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0d01000d,
+	0x9de00004,
+	0x8de00007,
+	0x8ce00004,
+	0x0dd3000c,
+	0x9de00007,
+	0x8de00007,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x01010007,
+	0x40001585,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8ce00006,
+	0x1bc10001,
+	0x9be00006,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00006,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00007,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00007,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00005,
+	0x90d00000,
+	0x01010007,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x00000042,
+	0x00000079,
+	0x00000065,
+	0x00000021,
+	0x0000000a,
+	0x00000000,
+	0x00000072,
+	0x00000065,
+	0x00000073,
+	0x0000006f,
+	0x0000006c,
+	0x00000076,
+	0x00000065,
+	0x00000020,
+	0x00000063,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x00000073,
+	0x00000069,
+	0x00000074,
+	0x00000065,
+	0x00000073,
+	0x00000020,
+	0x00000077,
+	0x00000069,
+	0x00000074,
+	0x00000068,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x0000006f,
+	0x0000006c,
+	0x00000073,
+	0x0000002f,
+	0x0000006b,
+	0x00000064,
+	0x00000062,
+	0x00000067,
+	0x0000002e,
+	0x00000070,
+	0x00000079,
+	0x00000020,
+	0x00000077,
+	0x00000069,
+	0x0000006e,
+	0x00000069,
+	0x00000078,
+	0x00000020,
+	0x0000003c,
+	0x00000063,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x00000073,
+	0x00000069,
+	0x00000074,
+	0x00000065,
+	0x0000003e,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x0000000a,
+	0x00000000,
+	0x00000030,
+	0x00000078,
+	0x00000025,
+	0x00000030,
+	0x00000035,
+	0x00000078,
+	0x00000020,
+	0x00000020,
+	0x00000025,
+	0x00000037,
+	0x00000064,
+	0x00000020,
+	0x00000020,
+	0x00000025,
+	0x00000037,
+	0x00000064,
+	0x00000020,
+	0x00000020,
+	0x00000025,
+	0x00000037,
+	0x00000064,
+	0x00000020,
+	0x00000020,
+	0x00000025,
+	0x00000037,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000063,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x00000073,
+	0x00000069,
+	0x00000074,
+	0x00000065,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x0000006c,
+	0x00000069,
+	0x00000076,
+	0x00000065,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000070,
+	0x00000065,
+	0x00000061,
+	0x0000006b,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x0000006f,
+	0x00000063,
+	0x00000073,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000020,
+	0x00000066,
+	0x00000072,
+	0x00000065,
+	0x00000065,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000055,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000073,
+	0x0000006c,
+	0x00000061,
+	0x00000062,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x00000070,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x0000002d,
+	0x00000070,
+	0x00000000,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000079,
+	0x00000073,
+	0x00000063,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x00000074,
+	0x00000072,
+	0x00000061,
+	0x00000063,
+	0x0000006b,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000064,
+	0x00000069,
+	0x00000073,
+	0x00000061,
+	0x00000062,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000050,
+	0x00000072,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000073,
+	0x00000079,
+	0x00000073,
+	0x00000063,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x00000074,
+	0x00000072,
+	0x00000061,
+	0x00000063,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x00000020,
+	0x00000053,
+	0x00000065,
+	0x00000072,
+	0x00000069,
+	0x00000061,
+	0x0000006c,
+	0x00000020,
+	0x00000050,
+	0x0000006f,
+	0x00000072,
+	0x00000074,
+	0x00000020,
+	0x00000032,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000000,
+	0x00000020,
+	0x0000002a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000041,
+	0x00000076,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000061,
+	0x00000062,
+	0x0000006c,
+	0x00000065,
+	0x00000020,
+	0x00000043,
+	0x0000006f,
+	0x0000006d,
+	0x0000006d,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000000,
+	0x0000006b,
+	0x00000069,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x00000000,
+	0x00000049,
+	0x0000006e,
+	0x00000076,
+	0x00000061,
+	0x0000006c,
+	0x00000069,
+	0x00000064,
+	0x00000020,
+	0x0000006e,
+	0x00000075,
+	0x0000006d,
+	0x00000062,
+	0x00000065,
+	0x00000072,
+	0x00000020,
+	0x00000027,
+	0x00000025,
+	0x00000073,
+	0x00000027,
+	0x0000000a,
+	0x00000000,
+	0x0000006b,
+	0x00000069,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x0000003c,
+	0x0000002d,
+	0x00000073,
+	0x00000069,
+	0x00000067,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x0000003e,
+	0x00000020,
+	0x0000005b,
+	0x00000070,
+	0x00000069,
+	0x00000064,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000073,
+	0x00000065,
+	0x00000074,
+	0x00000065,
+	0x0000006e,
+	0x00000076,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000003d,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000070,
+	0x00000069,
+	0x00000070,
+	0x00000065,
+	0x00000000,
+	0x00000073,
+	0x00000070,
+	0x00000061,
+	0x00000077,
+	0x0000006e,
+	0x00000000,
+	0x00000055,
+	0x0000006e,
+	0x0000006b,
+	0x0000006e,
+	0x0000006f,
+	0x00000077,
+	0x0000006e,
+	0x00000020,
+	0x00000063,
+	0x0000006f,
+	0x0000006d,
+	0x0000006d,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x00000020,
+	0x00000027,
+	0x00000025,
+	0x00000073,
+	0x00000027,
+	0x0000000a,
+	0x00000000,
+	0x0000002f,
+	0x00000062,
+	0x00000069,
+	0x0000006e,
+	0x0000002f,
+	0x00000000,
+	0x00000020,
+	0x00000000,
+	0x0000002d,
+	0x00000063,
+	0x00000000,
+	0x00000075,
+	0x00000073,
+	0x00000065,
+	0x00000072,
+	0x0000002f,
+	0x00000077,
+	0x00000073,
+	0x00000068,
+	0x0000002f,
+	0x00000077,
+	0x00000073,
+	0x00000068,
+	0x0000002e,
+	0x00000063,
+	0x00000000,
+	0x00000073,
+	0x00000074,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x00000000,
+	0x00000066,
+	0x00000067,
+	0x00000000,
+	0x00000063,
+	0x0000006c,
+	0x00000065,
+	0x00000061,
+	0x00000072,
+	0x00000000,
+	0x00000063,
+	0x00000064,
+	0x00000000,
+	0x0000003f,
+	0x00000000,
+	0x00000068,
+	0x00000065,
+	0x0000006c,
+	0x00000070,
+	0x00000000,
+	0x00000065,
+	0x00000078,
+	0x00000069,
+	0x00000074,
+	0x00000000,
+	0x00000066,
+	0x00000072,
+	0x00000065,
+	0x00000065,
+	0x00000000,
+	0x00000070,
+	0x00000069,
+	0x00000064,
+	0x00000000,
+	0x0000006b,
+	0x00000069,
+	0x0000006c,
+	0x0000006c,
+	0x00000000,
+	0x00000073,
+	0x0000006c,
+	0x00000061,
+	0x00000062,
+	0x00000000,
+	0x00000075,
+	0x0000006e,
+	0x00000074,
+	0x00000072,
+	0x00000061,
+	0x00000063,
+	0x00000065,
+	0x00000000,
+	0x00000074,
+	0x00000072,
+	0x00000061,
+	0x00000063,
+	0x00000065,
+	0x00000000,
+	0x00000065,
+	0x0000006e,
+	0x00000076,
+	0x00000000,
+	0x00000061,
+	0x00000073,
+	0x00000073,
+	0x00000065,
+	0x00000072,
+	0x00000074,
+	0x00000069,
+	0x0000006f,
+	0x0000006e,
+	0x00000020,
+	0x00000066,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000061,
+	0x00000074,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x0000003d,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x8000007e,
+	0x00000007,
+	0x19960503,
+	0x00000453,
+	0x00001000,
+	0x00000dfc,
+	0x00000ce4,
+	0x00000118,
+	0x00000018,
+	0x80000003,
+	0x00000150,
+	0x1ee30006,
+	0x96e00001,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x06010000,
+	0x0d010000,
+	0x9d000784,
+	0x9d000783,
+	0x9d000782,
+	0x40000427,
+	0x8d000782,
+	0x1dd00001,
+	0x9d000782,
+	0x3d780020,
+	0xb0d00004,
+	0x3d780009,
+	0xb0d00002,
+	0x3d7a000a,
+	0xb0d00007,
+	0x2d680000,
+	0xb0d00003,
+	0x8d000783,
+	0x1dd00001,
+	0x9d000783,
+	0x06010000,
+	0x40000420,
+	0x16010001,
+	0x3d78000a,
+	0xb0d00002,
+	0x3d7a000c,
+	0xb0d00003,
+	0x8d000784,
+	0x1dd00001,
+	0x9d000784,
+	0xcd000550,
+	0x9de00000,
+	0x60000574,
+	0x0d010001,
+	0x0701000d,
+	0x2dd20000,
+	0xb0dfffe1,
+	0x8d000781,
+	0x8c000784,
+	0x0dd0000c,
+	0x9d000781,
+	0x8d000780,
+	0x8c000783,
+	0x0dd0000c,
+	0x9d000780,
+	0x8d00077f,
+	0x8c000782,
+	0x0dd0000c,
+	0x9d00077f,
+	0x86e00001,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8d00055d,
+	0x9de00000,
+	0xcd000762,
+	0x9de00001,
+	0x60000562,
+	0x1d010002,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x90e00002,
+	0x60000737,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee3000e,
+	0x94e00003,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x1d010001,
+	0x8ce0000e,
+	0x1cc20001,
+	0x9ce0000d,
+	0x0701000d,
+	0x8de0000f,
+	0x86d00001,
+	0x0d010006,
+	0x9de0000b,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d0002a,
+	0x8de0000b,
+	0x16d10001,
+	0x8de0000b,
+	0x8dd00000,
+	0x3dda002d,
+	0xb0d00024,
+	0x8de0000d,
+	0x1dd20001,
+	0x9de0000d,
+	0x17700001,
+	0x4000048e,
+	0x84600000,
+	0x1d01006c,
+	0x9de0000a,
+	0x2d48000d,
+	0xb0d00009,
+	0x8de0000a,
+	0x2d42000d,
+	0xb0d00003,
+	0x3d480063,
+	0xb0d0000c,
+	0x4000048c,
+	0x3d480077,
+	0xb0d00005,
+	0x4000048c,
+	0x8d000400,
+	0x1dd00001,
+	0x9d000400,
+	0x4000048d,
+	0x8d000401,
+	0x1dd00001,
+	0x9d000401,
+	0x4000048d,
+	0x8d000402,
+	0x1dd00001,
+	0x9d000402,
+	0x4000048d,
+	0x60000441,
+	0x16610001,
+	0x8d600000,
+	0x2dda0000,
+	0xb0dfffe1,
+	0x0d010000,
+	0x9de0000a,
+	0x8c000400,
+	0x2dca000d,
+	0xb0d0000c,
+	0x8d000401,
+	0x8ce0000a,
+	0x2dda000c,
+	0xb0d00008,
+	0x8d000402,
+	0x8ce0000a,
+	0x2dda000c,
+	0xb0d00004,
+	0x1d010001,
+	0x9d000400,
+	0x9d000401,
+	0x9d000402,
+	0x8de0000d,
+	0x3dd00002,
+	0xb0d00002,
+	0x14010001,
+	0x400004a8,
+	0x04010000,
+	0x94e0000c,
+	0x8de0000e,
+	0x2d70000d,
+	0xb0d00071,
+	0x60000403,
+	0x8d000400,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000784,
+	0x9de00002,
+	0x60000562,
+	0x8d000401,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000783,
+	0x9de00002,
+	0x60000562,
+	0x8d000402,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000782,
+	0x9de00002,
+	0x60000562,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075a,
+	0x9de00001,
+	0x60000562,
+	0x1d010002,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x60000737,
+	0x4000051d,
+	0x1d010019,
+	0x9de00000,
+	0x90e00001,
+	0x60000737,
+	0x1d010016,
+	0x9de00000,
+	0x90e00001,
+	0x8de0000f,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00002,
+	0x60000737,
+	0x0d010001,
+	0x0501000d,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d0000b,
+	0x8d00055d,
+	0x9de00000,
+	0xcd000746,
+	0x9de00001,
+	0x8de0000f,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00002,
+	0x60000562,
+	0x17700001,
+	0x4000051d,
+	0x60000403,
+	0x8d000400,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000784,
+	0x9de00002,
+	0x60000562,
+	0x8d000401,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000783,
+	0x9de00002,
+	0x60000562,
+	0x8d000402,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000782,
+	0x9de00002,
+	0x60000562,
+	0x1d010001,
+	0x9de00000,
+	0xcd000741,
+	0x9de00001,
+	0x8de0000f,
+	0x0d71000d,
+	0x8dd00000,
+	0x9de00002,
+	0x60000562,
+	0x17700001,
+	0x8de0000e,
+	0x2d70000d,
+	0xb0dfffb7,
+	0x8de0000c,
+	0x2dd80000,
+	0xb0d00023,
+	0x8d000400,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000781,
+	0x9de00002,
+	0x60000562,
+	0x8d000401,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d000780,
+	0x9de00002,
+	0x60000562,
+	0x8d000402,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd00075d,
+	0x9de00001,
+	0x8d00077f,
+	0x9de00002,
+	0x60000562,
+	0x1d010001,
+	0x9de00000,
+	0xcd000739,
+	0x9de00001,
+	0x60000562,
+	0x01010000,
+	0x84e00003,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1000e,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x0000021c,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000737,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000b,
+	0x9be00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de0000b,
+	0x8dd00002,
+	0x1ddb0010,
+	0x2dd80000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x400005c3,
+	0x8de0000b,
+	0x8dd00004,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00009,
+	0x1d0101f4,
+	0x9de00000,
+	0x60000652,
+	0x0d010001,
+	0x8ce0000b,
+	0x9dc00004,
+	0x8de0000b,
+	0x1c0101f4,
+	0x9cd00003,
+	0x8de0000b,
+	0x8cd00000,
+	0x8dd00004,
+	0x0dc1000d,
+	0x9de0000a,
+	0x8de0000b,
+	0x8dd00005,
+	0x0d01000d,
+	0x9de00008,
+	0x2dd90000,
+	0xb0d00005,
+	0x8de0000a,
+	0x0d01000d,
+	0x8ce00008,
+	0x2dc1000d,
+	0xb0d0001d,
+	0x1d010017,
+	0x9de00000,
+	0x8de0000b,
+	0x8cd00001,
+	0x9ce00001,
+	0x8cd00004,
+	0x9ce00002,
+	0x8dd00003,
+	0x9de00003,
+	0x60000737,
+	0x0d010001,
+	0x9de00009,
+	0x8de00009,
+	0x2dd20000,
+	0xb0d00008,
+	0x8de0000b,
+	0x1dd10002,
+	0x8cd00000,
+	0x1ccd0010,
+	0x9cd00000,
+	0x310effff,
+	0x111dffff,
+	0x400005c3,
+	0x8de0000b,
+	0x8ce00009,
+	0x9cd00000,
+	0x8de0000b,
+	0x8cd00004,
+	0x9cd00005,
+	0x8de0000b,
+	0x1dd10005,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8dc00000,
+	0x0101000d,
+	0x8be00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1000b,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d0005c9,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x400005d7,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x810005c9,
+	0x400005df,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x60000737,
+	0x0d010001,
+	0x9d0005c9,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x870005e3,
+	0x400005ed,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x600005ca,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x600005ca,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x4000064c,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d0005e3,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d0005e3,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x600005e4,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x600005fd,
+	0x90700003,
+	0x40000693,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000625,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x40000694,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000625,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000694,
+	0x970005e3,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d0005e3,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c0005e3,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x600005ca,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x600006cf,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x400006fd,
+	0x07010000,
+	0x01010007,
+	0x40000700,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x600006da,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x600006cf,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x6000069a,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x6000069a,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000074,
+	0x00000061,
+	0x0000006c,
+	0x0000000a,
+	0x00000000,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000077,
+	0x00000063,
+	0x0000003a,
+	0x00000020,
+	0x00000063,
+	0x00000061,
+	0x0000006e,
+	0x0000006e,
+	0x0000006f,
+	0x00000074,
+	0x00000020,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x0000006e,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000020,
+	0x0000000a,
+	0x00000000,
+	0x00000020,
+	0x00000025,
+	0x00000036,
+	0x00000064,
+	0x00000000,
+	0x00000055,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000077,
+	0x00000063,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x0000006c,
+	0x00000077,
+	0x00000063,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x0000006e,
+	0x00000061,
+	0x0000006d,
+	0x00000065,
+	0x00000020,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x0000005d,
+	0x0000000a,
+	0x8000007b,
+	0x00000006,
+	0x0000000b,
+	0x00000000,
+	0x00000074,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x80000019,
+	0x00000007,
+	0x00000101,
+	0x0000000d,
+	0x00000000,
+	0x00000074,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x80000019,
+	0x00000005,
+	0x00000101,
+	0x0000000f,
+	0x00000000,
+	0x00000070,
+	0x00000073,
+	0x8000001b,
+	0x00000008,
+	0x00000101,
+	0x00000010,
+	0x00000000,
+	0x00000072,
+	0x0000006d,
+	0x00000064,
+	0x00000069,
+	0x00000072,
+	0x80000018,
+	0x00000007,
+	0x00000101,
+	0x00000011,
+	0x00000000,
+	0x00000067,
+	0x00000072,
+	0x00000065,
+	0x00000070,
+	0x80000019,
+	0x00000007,
+	0x00000101,
+	0x00000014,
+	0x00000000,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000074,
+	0x80000019,
+	0x00000007,
+	0x00000101,
+	0x00000015,
+	0x00000000,
+	0x00000065,
+	0x00000063,
+	0x00000068,
+	0x0000006f,
+	0x80000019,
+	0x00000006,
+	0x00000101,
+	0x00000016,
+	0x00000000,
+	0x00000063,
+	0x00000061,
+	0x00000074,
+	0x8000001a,
+	0x0000002a,
+	0x00000101,
+	0x19960503,
+	0x00000427,
+	0x00001000,
+	0x00003298,
+	0x000029a4,
+	0x000008f4,
+	0x0000009c,
+	0x000005ed,
+	0x0000107a,
+	0x00000001,
+	0x000005a7,
+	0x00001074,
+	0x00000001,
+	0x000007eb,
+	0x0000106a,
+	0x00000001,
+	0x00000651,
+	0x00001065,
+	0x00000001,
+	0x000006b5,
+	0x0000105f,
+	0x00000001,
+	0x00000767,
+	0x00001059,
+	0x00000001,
+	0x000008bd,
+	0x00001053,
+	0x00000001,
+	0x0000051e,
+	0x0000104c,
+	0x00000001,
+	0x00000943,
+	0x00001047,
+	0x00000001,
+	0x000008a0,
+	0x00001041,
+	0x00000000,
+	0x00000481,
+	0x0000103d,
+	0x00000000,
+	0x00000464,
+	0x80000005,
+	0x00000687,
+	0x1ee30009,
+	0x97e00002,
+	0x9be00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de0000a,
+	0x8dd00001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x8de00009,
+	0x1dd20001,
+	0x9de00000,
+	0x8de0000a,
+	0x1dd10001,
+	0x9de00001,
+	0x60000464,
+	0x0d010001,
+	0x0101000d,
+	0x4000045d,
+	0xc7000400,
+	0x4000043f,
+	0x17710003,
+	0x0d010000,
+	0x9de00008,
+	0x0c010007,
+	0x2dc9000d,
+	0xb0d0000f,
+	0x8d700001,
+	0x9de00007,
+	0x0c01000d,
+	0x8be00008,
+	0x2dc9000b,
+	0xb0d00009,
+	0x8de0000a,
+	0x8dd00001,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000e44,
+	0x0d010001,
+	0x2dda0000,
+	0xb0dfffeb,
+	0x8de00009,
+	0x1dd20001,
+	0x9de00000,
+	0x8de0000a,
+	0x1dd10001,
+	0x9de00001,
+	0x8d700000,
+	0x70d00000,
+	0x0d010001,
+	0x0101000d,
+	0x87e00002,
+	0x8be00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00003,
+	0x9de00004,
+	0x9fe00005,
+	0xc7000400,
+	0x1d010001,
+	0x9de00000,
+	0xcd001025,
+	0x9de00001,
+	0x60000abd,
+	0x40000477,
+	0x1d010001,
+	0x9de00000,
+	0xcd00101e,
+	0x9de00001,
+	0x8d700001,
+	0x9de00002,
+	0x60000abd,
+	0x17710003,
+	0x8d700001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dffff4,
+	0x01010000,
+	0x87e00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000c,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0xc7000400,
+	0x90e0000b,
+	0x400004ac,
+	0x8d700002,
+	0x2dd80000,
+	0xb0d0001d,
+	0x1d010001,
+	0x8c700001,
+	0x9ce0000a,
+	0x9de00000,
+	0x1de1000a,
+	0x9de00001,
+	0x8d700000,
+	0x70d00000,
+	0x0d010001,
+	0x0601000d,
+	0x1d010001,
+	0x9de00000,
+	0xcd00100b,
+	0x9de00001,
+	0x8d700001,
+	0x9de00002,
+	0x96e00003,
+	0x60000abd,
+	0x2d6a0000,
+	0xb0d00002,
+	0x15010001,
+	0x400004a5,
+	0x05010000,
+	0x95e00000,
+	0x1d01006a,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x17710003,
+	0x8d700001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dfffdb,
+	0x01010000,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1000c,
+	0x50f00000,
+	0x1ee30005,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d0010bc,
+	0x8ce00005,
+	0x0dd0000c,
+	0x9d0010bc,
+	0x1d010001,
+	0x9de00000,
+	0xcd000fe8,
+	0x9de00001,
+	0x60000abd,
+	0x1d01000c,
+	0x9de00000,
+	0x600009ff,
+	0x1d010001,
+	0x9de00000,
+	0xcd000fdc,
+	0x9de00001,
+	0x60000abd,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30005,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d0010bc,
+	0x8ce00005,
+	0x0dd0000c,
+	0x9d0010bc,
+	0x1d010001,
+	0x9de00000,
+	0xcd000fce,
+	0x9de00001,
+	0x60000abd,
+	0x1d010002,
+	0x9de00000,
+	0x600009ff,
+	0x1d010001,
+	0x9de00000,
+	0xcd000fc2,
+	0x9de00001,
+	0x60000abd,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30005,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d0010bc,
+	0x8ce00005,
+	0x0dd0000c,
+	0x9d0010bc,
+	0x1d010001,
+	0x9de00000,
+	0xcd000fb4,
+	0x9de00001,
+	0x60000abd,
+	0x1d01000f,
+	0x9de00000,
+	0x600009ff,
+	0x1d010001,
+	0x9de00000,
+	0xcd000fa8,
+	0x9de00001,
+	0x60000abd,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30005,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d0010bc,
+	0x8ce00005,
+	0x0dd0000c,
+	0x9d0010bc,
+	0x1d010001,
+	0x9de00000,
+	0xcd000f99,
+	0x9de00001,
+	0x60000abd,
+	0x1d010001,
+	0x9de00000,
+	0xcd000f8c,
+	0x9de00001,
+	0x60000abd,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee3000e,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9de00007,
+	0x9fe00008,
+	0x900010bc,
+	0x1de1000c,
+	0x9de00000,
+	0x60000b07,
+	0x90e0000d,
+	0xcd0004b9,
+	0x9de0000b,
+	0x1d010008,
+	0x9de00000,
+	0x1d01000a,
+	0x9de00001,
+	0x1de1000b,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0xcd0004d3,
+	0x9de0000b,
+	0x1d010008,
+	0x9de00000,
+	0x1d01000c,
+	0x9de00001,
+	0x1de1000b,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0xcd0004ed,
+	0x9de0000b,
+	0x1d010008,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x1de1000b,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0xcd000507,
+	0x9de0000b,
+	0x1d010008,
+	0x9de00000,
+	0x1d01000f,
+	0x9de00001,
+	0x1de1000b,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x1de1000a,
+	0x9de00000,
+	0x60000b0f,
+	0x1d010013,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x1de10009,
+	0x9de00002,
+	0x8de0000a,
+	0x9de00003,
+	0x600009fd,
+	0x1d01000a,
+	0x9de00000,
+	0x600009ff,
+	0x8d0010bc,
+	0x2dda0000,
+	0xb0d00002,
+	0x17010001,
+	0x40000566,
+	0x07010000,
+	0x97e00000,
+	0x1d0100ac,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1d010012,
+	0x9de00000,
+	0x1de1000a,
+	0x9de00001,
+	0x600009fd,
+	0x1de1000a,
+	0x9de00000,
+	0x1d01000a,
+	0x9de00001,
+	0x60000b1b,
+	0x0d010001,
+	0x9de00000,
+	0x1d0100b0,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8d0010bc,
+	0x2dda0000,
+	0xb0d00002,
+	0x16010001,
+	0x40000583,
+	0x06010000,
+	0x96e00000,
+	0x1d0100b1,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1d010001,
+	0x9de00000,
+	0xcd000f5b,
+	0x9de00001,
+	0x60000abd,
+	0x1d010011,
+	0x9de00000,
+	0x8de00009,
+	0x9de00001,
+	0x600009fd,
+	0x8d0010bc,
+	0x3dda0027,
+	0xb0d00002,
+	0x15010001,
+	0x40000599,
+	0x05010000,
+	0x95e00000,
+	0x1d0100b6,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x01010000,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000e,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x07010000,
+	0x90e00007,
+	0x1d010031,
+	0x9de00000,
+	0x1d010008,
+	0x9de00001,
+	0x3d0e0000,
+	0x1ddd0001,
+	0x9de00002,
+	0x600009fd,
+	0x1d010001,
+	0x8ce00007,
+	0x07d6000c,
+	0x9de00000,
+	0xcd000f45,
+	0x9de00001,
+	0x97e00002,
+	0x60000abd,
+	0x1d010031,
+	0x9de00000,
+	0x1d010008,
+	0x9de00001,
+	0x90e00002,
+	0x600009fd,
+	0x01010000,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30003,
+	0x9de00001,
+	0x9fe00002,
+	0x8de00003,
+	0x9de00000,
+	0x600005cb,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30003,
+	0x9de00001,
+	0x9fe00002,
+	0x1d010003,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x0101000d,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30003,
+	0x9de00001,
+	0x9fe00002,
+	0x1d010035,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x0101000d,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30010,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x98e00007,
+	0x99e00008,
+	0x9ae00009,
+	0x9be0000a,
+	0x9de0000b,
+	0x9fe0000c,
+	0x1de1000e,
+	0xc9000e69,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x07010000,
+	0x07010000,
+	0x1de1000e,
+	0x0d71000d,
+	0x8dd00000,
+	0x70d00000,
+	0x0d010001,
+	0x0601000d,
+	0x2d6a0000,
+	0xb0d0000f,
+	0x1d01000d,
+	0x9de00000,
+	0x1d010008,
+	0x9de00001,
+	0x600009fd,
+	0x1d010001,
+	0x9de00000,
+	0xcd000f1e,
+	0x9de00001,
+	0x97e00002,
+	0x60000abd,
+	0x1d010001,
+	0x9de00000,
+	0x600005cb,
+	0x40000634,
+	0x1d01000a,
+	0x9de00000,
+	0x3d0effff,
+	0x1dddffff,
+	0x9de00001,
+	0x1de1000d,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x8de0000d,
+	0x1ddb007f,
+	0x9de00000,
+	0x1d0100df,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de0000d,
+	0x1ddb007f,
+	0x3dda000b,
+	0xb0d00002,
+	0x15010001,
+	0x4000062e,
+	0x05010000,
+	0x95e00000,
+	0x1d0100e0,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x17700001,
+	0x3d700002,
+	0xb0dfffc8,
+	0x01010000,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x88e00007,
+	0x89e00008,
+	0x8ae00009,
+	0x8be0000a,
+	0x8de0000b,
+	0x8fe0000c,
+	0x1ee10010,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x1d010001,
+	0x9de00000,
+	0xcd000f02,
+	0x9de00001,
+	0x8de00005,
+	0x9de00002,
+	0x60000abd,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee3000b,
+	0x96e00004,
+	0x97e00005,
+	0x9de00006,
+	0x9fe00007,
+	0x3d0e0000,
+	0x1ddd0001,
+	0x9de0000a,
+	0x1d010035,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x9de00008,
+	0x2dda0000,
+	0xb0d0001b,
+	0x1d010031,
+	0x9de00000,
+	0x1d01000b,
+	0x9de00001,
+	0xcd000643,
+	0x9de00002,
+	0x600009fd,
+	0x1d010001,
+	0x9de00000,
+	0xcd000eff,
+	0x9de00001,
+	0x8de0000a,
+	0x9de00002,
+	0x60000abd,
+	0x1d010031,
+	0x9de00000,
+	0x1d01000b,
+	0x9de00001,
+	0x90e00002,
+	0x600009fd,
+	0x1d010002,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x600009fd,
+	0x4000069f,
+	0x1d01000a,
+	0x9de00000,
+	0x3d0effff,
+	0x1dddffff,
+	0x9de00001,
+	0x1de10009,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x8de00009,
+	0x1ddb007f,
+	0x2dda0000,
+	0xb0d00002,
+	0x17010001,
+	0x4000068b,
+	0x07010000,
+	0x97e00000,
+	0x1d0100f7,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de00009,
+	0x1dde0008,
+	0x1ddb00ff,
+	0x2dda0000,
+	0xb0d00002,
+	0x16010001,
+	0x40000699,
+	0x06010000,
+	0x96e00000,
+	0x1d0100f8,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x01010000,
+	0x86e00004,
+	0x87e00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1000b,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010001,
+	0x9de00000,
+	0xcd000ee6,
+	0x9de00001,
+	0x60000abd,
+	0x1d010001,
+	0x9d0006a6,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee3001d,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x1d010035,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00078,
+	0x90e00016,
+	0x1d0103e8,
+	0x9de00015,
+	0x1de10017,
+	0x9de00000,
+	0x90e00001,
+	0x1d010004,
+	0x9de00002,
+	0x60000df8,
+	0x900006a6,
+	0x8de0001d,
+	0x3dd40001,
+	0xb0d00019,
+	0x8de0001e,
+	0x8dd00001,
+	0x9de00000,
+	0x1de1001b,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x60000d19,
+	0x0d010001,
+	0x0d01000d,
+	0x9de00016,
+	0x8de0001b,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000a,
+	0x8d000ab8,
+	0x9de00000,
+	0xcd000ed2,
+	0x9de00001,
+	0x8de0001e,
+	0x8dd00001,
+	0x9de00002,
+	0x60000abd,
+	0x11010001,
+	0x4000075f,
+	0x8de00016,
+	0x9de00019,
+	0x8de00015,
+	0x9de0001a,
+	0x1d010031,
+	0x9de00000,
+	0x1d01000e,
+	0x9de00001,
+	0xcd0006a7,
+	0x9de00002,
+	0x600009fd,
+	0x1d010037,
+	0x9de00000,
+	0x90e00001,
+	0x1de10017,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x1d010017,
+	0x9de00000,
+	0x90e00001,
+	0x1de1000a,
+	0x9de00002,
+	0x1d01000a,
+	0x9de00003,
+	0x600009fd,
+	0x0d010001,
+	0x9de00014,
+	0x8de00014,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d00002,
+	0x17010001,
+	0x4000070c,
+	0x07010000,
+	0x97e00000,
+	0x1d010121,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x60000e42,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x1c010004,
+	0x2ddb000c,
+	0xb0d00002,
+	0x16010001,
+	0x40000721,
+	0x06010000,
+	0x96e00000,
+	0x1d010122,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8d0006a6,
+	0x3dda0001,
+	0xb0d00002,
+	0x15010001,
+	0x4000072d,
+	0x05010000,
+	0x95e00000,
+	0x1d010123,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1d010002,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x600009fd,
+	0x4000075e,
+	0x1d01000a,
+	0x9de00000,
+	0x3d0effff,
+	0x1dddffff,
+	0x9de00001,
+	0x1de1001c,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x8de0001c,
+	0x1ddb007f,
+	0x2dda0000,
+	0xb0d00002,
+	0x17010001,
+	0x4000074a,
+	0x07010000,
+	0x97e00000,
+	0x1d010127,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de0001c,
+	0x1dde0008,
+	0x1ddb00ff,
+	0x2dda0000,
+	0xb0d00002,
+	0x16010001,
+	0x40000758,
+	0x06010000,
+	0x96e00000,
+	0x1d010128,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x01010000,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1001d,
+	0x50f00000,
+	0x1ee30015,
+	0x96e00004,
+	0x97e00005,
+	0x98e00006,
+	0x99e00007,
+	0x9ae00008,
+	0x9be00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x1d011388,
+	0x9de0000d,
+	0x1de10011,
+	0x9de00000,
+	0x90e00001,
+	0x1d010004,
+	0x9de00002,
+	0x60000df8,
+	0x1de1000e,
+	0x9de00000,
+	0x90e00001,
+	0x1d010003,
+	0x9de00002,
+	0x60000df8,
+	0x900006a6,
+	0x1d010035,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d0001d,
+	0x8de0000d,
+	0x9de00014,
+	0x1de10011,
+	0x19e10013,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0xcd0006a7,
+	0x9de0000e,
+	0x1d010002,
+	0x9de00010,
+	0x1d010008,
+	0x9de00000,
+	0x1d01000e,
+	0x9de00001,
+	0x1de1000e,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x1d010037,
+	0x9de00000,
+	0x90e00001,
+	0x1de10011,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x400007a0,
+	0x400007cc,
+	0x1d01000a,
+	0x9de00000,
+	0x3d0effff,
+	0x1dddffff,
+	0x9de00001,
+	0x1de1000c,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x8d0006a6,
+	0x3dda0001,
+	0xb0d00002,
+	0x17010001,
+	0x400007b1,
+	0x07010000,
+	0x97e00000,
+	0x1d010142,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de0000c,
+	0x1ddb007f,
+	0x9de00000,
+	0x1d010143,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de0000c,
+	0x1ddb007f,
+	0x3dda000e,
+	0xb0d00002,
+	0x16010001,
+	0x400007c6,
+	0x06010000,
+	0x96e00000,
+	0x1d010144,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x01010000,
+	0x86e00004,
+	0x87e00005,
+	0x88e00006,
+	0x89e00007,
+	0x8ae00008,
+	0x8be00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee10015,
+	0x50f00000,
+	0x1ee30006,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d010001,
+	0x9de00000,
+	0xcd000eb3,
+	0x9de00001,
+	0x8de00006,
+	0x9de00002,
+	0x60000abd,
+	0x8d0010a6,
+	0x8ce00006,
+	0x0dd0000c,
+	0x9d0010a6,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30011,
+	0x92e00004,
+	0x93e00005,
+	0x94e00006,
+	0x95e00007,
+	0x96e00008,
+	0x97e00009,
+	0x9ce0000a,
+	0x9de0000b,
+	0x9fe0000c,
+	0x13010002,
+	0x12010001,
+	0x90e00010,
+	0x900010a6,
+	0x8de00011,
+	0x3dd40001,
+	0xb0d00018,
+	0x8de00012,
+	0x8dd00001,
+	0x9de00000,
+	0x1de1000e,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x60000d19,
+	0x0d010001,
+	0x0301000d,
+	0x8de0000e,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000a,
+	0x8d000ab8,
+	0x9de00000,
+	0xcd000ed2,
+	0x9de00001,
+	0x8de00012,
+	0x8dd00001,
+	0x9de00002,
+	0x60000abd,
+	0x11010001,
+	0x40000895,
+	0x1d010015,
+	0x0c010003,
+	0x0dd5000c,
+	0x9de00000,
+	0x60000c12,
+	0x0d010001,
+	0x9de0000f,
+	0x8de0000f,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x40000885,
+	0x1d010001,
+	0x0c010003,
+	0x0dd5000c,
+	0x9de00000,
+	0x60000c12,
+	0x0d010001,
+	0x0401000d,
+	0x0d010004,
+	0x2ddb0000,
+	0xb0d00001,
+	0x40000882,
+	0x86e0000f,
+	0x07010000,
+	0x40000857,
+	0x1d010038,
+	0x9de00000,
+	0x60000c12,
+	0x0d010001,
+	0x0c710004,
+	0x9dc00000,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00040,
+	0x0d710004,
+	0x8dd00000,
+	0x9d600010,
+	0x1d010038,
+	0x9d600012,
+	0xcd0010a7,
+	0x9d600014,
+	0x0d010002,
+	0x8ce00010,
+	0x0cc0000d,
+	0x9ce00010,
+	0x96e00000,
+	0xcc0007d7,
+	0x9ce00001,
+	0x1c010001,
+	0x9ce00002,
+	0x12d00001,
+	0x9de00003,
+	0x60000a4a,
+	0x16610015,
+	0x0d010000,
+	0x9de0000d,
+	0x2d78000d,
+	0xb0d00007,
+	0x1d780032,
+	0x8ce0000d,
+	0x2dda000c,
+	0xb0d00003,
+	0x1d010021,
+	0x9de00000,
+	0x60000b8e,
+	0x17700001,
+	0x2d700003,
+	0xb0dfffd5,
+	0x1d01000a,
+	0x9de00000,
+	0x60000b8e,
+	0x86e0000f,
+	0x07010000,
+	0x40000866,
+	0xcd0010a7,
+	0x9de00000,
+	0x0d010006,
+	0x16d10015,
+	0x9de00001,
+	0x60000b78,
+	0x17700001,
+	0x2d700003,
+	0xb0dffff7,
+	0x8d0010a6,
+	0x8ce00010,
+	0x2dda000c,
+	0xb0d00003,
+	0x1d010001,
+	0x9de0000d,
+	0x40000870,
+	0x90e0000d,
+	0x8de0000d,
+	0x9de00000,
+	0x1d01018b,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x05010000,
+	0x4000087e,
+	0x0d510004,
+	0x8dd00000,
+	0x9de00000,
+	0x60000cc6,
+	0x15500001,
+	0x2d500007,
+	0xb0dffff9,
+	0x94e00000,
+	0x60000cc6,
+	0x8de0000f,
+	0x9de00000,
+	0x60000cc6,
+	0x60000e42,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x1c01000c,
+	0x2ddb000c,
+	0xb0d00003,
+	0xcd000eac,
+	0x9de00000,
+	0x60000e24,
+	0x01010000,
+	0x82e00004,
+	0x83e00005,
+	0x84e00006,
+	0x85e00007,
+	0x86e00008,
+	0x87e00009,
+	0x8ce0000a,
+	0x8de0000b,
+	0x8fe0000c,
+	0x1ee10011,
+	0x50f00000,
+	0x1ee30007,
+	0x9de00003,
+	0x9fe00004,
+	0x1de10005,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0x60000df8,
+	0x1d010001,
+	0x9de00005,
+	0x400008b7,
+	0x1d010001,
+	0x9de00000,
+	0xcd000eaa,
+	0x9de00001,
+	0x60000abd,
+	0x1d01002f,
+	0x9de00000,
+	0x1de10005,
+	0x9de00001,
+	0x90e00002,
+	0x600009fd,
+	0x400008ac,
+	0x01010000,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30013,
+	0x92e00003,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x1d010001,
+	0x9de00000,
+	0x1de1000f,
+	0x9de00001,
+	0x600009fd,
+	0x0d010001,
+	0x0601000d,
+	0x2d690000,
+	0xb0d00002,
+	0x15010001,
+	0x400008d3,
+	0x05010000,
+	0x95e00000,
+	0x1d0101ab,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de0000f,
+	0x2dd90000,
+	0xb0d00002,
+	0x14010001,
+	0x400008df,
+	0x04010000,
+	0x94e00000,
+	0x1d0101ac,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de00010,
+	0x2dd90000,
+	0xb0d00002,
+	0x13010001,
+	0x400008eb,
+	0x03010000,
+	0x93e00000,
+	0x1d0101ad,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1d010001,
+	0x9de00000,
+	0x3d0e0000,
+	0x1ddd0001,
+	0x9de00001,
+	0x600009fd,
+	0x0d010001,
+	0x0701000d,
+	0x3d0effff,
+	0x1dddffff,
+	0x0d01000d,
+	0x2d7b000d,
+	0xb0d0000e,
+	0x60000e42,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x1c01000e,
+	0x2ddb000c,
+	0xb0d00002,
+	0x12010001,
+	0x4000090d,
+	0x02010000,
+	0x92e00000,
+	0x1d0101af,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1de1000d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0x60000df8,
+	0x3d0e05f5,
+	0x1ddde100,
+	0x9de0000e,
+	0x1d01002f,
+	0x9de00000,
+	0x1de1000d,
+	0x9de00001,
+	0x90e00002,
+	0x600009fd,
+	0x1d010001,
+	0x9de00000,
+	0x90e00001,
+	0x600009fd,
+	0x0d010001,
+	0x0701000d,
+	0x2d790000,
+	0xb0d00005,
+	0x2d750006,
+	0xb0d00003,
+	0x1d010001,
+	0x9de0000c,
+	0x40000930,
+	0x90e0000c,
+	0x8de0000c,
+	0x9de00000,
+	0x1d0101b5,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x01010000,
+	0x82e00003,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee10013,
+	0x50f00000,
+	0x1ee3007c,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x98e00009,
+	0x99e0000a,
+	0x9ae0000b,
+	0x9be0000c,
+	0x9ce0000d,
+	0x9de0000e,
+	0x9fe0000f,
+	0x1de10010,
+	0xc9000e6b,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x88900002,
+	0x8a900003,
+	0x98d00002,
+	0x9ad00003,
+	0x1d01001b,
+	0x9de00000,
+	0x1de1007a,
+	0x9de00001,
+	0x600009fd,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00002,
+	0x17010001,
+	0x40000965,
+	0x07010000,
+	0x97e00000,
+	0x1d0101be,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1d010035,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00021,
+	0x1d010019,
+	0x9de00000,
+	0x8de0007a,
+	0x9de00001,
+	0x600009fd,
+	0x1d010023,
+	0x9de00000,
+	0x8de0007b,
+	0x9de00001,
+	0x1d010001,
+	0x9de00002,
+	0x600009fd,
+	0x1d010019,
+	0x9de00000,
+	0x8de0007b,
+	0x9de00001,
+	0x600009fd,
+	0x60000a93,
+	0x0d010001,
+	0x1c010005,
+	0x9ce00000,
+	0xcc000ea1,
+	0x9ce00001,
+	0x1ce10010,
+	0x9ce00002,
+	0x9de00003,
+	0x600009fd,
+	0x1d010002,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x90e00002,
+	0x600009fd,
+	0x1d01000a,
+	0x9de00000,
+	0x3d0effff,
+	0x1dddffff,
+	0x9de00001,
+	0x1de10079,
+	0x9de00002,
+	0x90e00003,
+	0x600009fd,
+	0x8de00079,
+	0x1ddb007f,
+	0x2dda0000,
+	0xb0d00002,
+	0x16010001,
+	0x400009a2,
+	0x06010000,
+	0x96e00000,
+	0x1d0101c8,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x8de00079,
+	0x1dde0008,
+	0x1ddb00ff,
+	0x2dda0000,
+	0xb0d00002,
+	0x15010001,
+	0x400009b0,
+	0x05010000,
+	0x95e00000,
+	0x1d0101c9,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1de10015,
+	0x9de00000,
+	0x90e00001,
+	0x1d010064,
+	0x9de00002,
+	0x60000df8,
+	0x1d010017,
+	0x9de00000,
+	0x8de0007a,
+	0x9de00001,
+	0x1de10015,
+	0x9de00002,
+	0x1d010064,
+	0x9de00003,
+	0x600009fd,
+	0x0d010001,
+	0x9de00014,
+	0x8de00014,
+	0x3dda0004,
+	0xb0d00002,
+	0x14010001,
+	0x400009cd,
+	0x04010000,
+	0x94e00000,
+	0x1d0101cd,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1de10015,
+	0x9de00000,
+	0xcd000e6f,
+	0x9de00001,
+	0x60000e44,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00002,
+	0x13010001,
+	0x400009de,
+	0x03010000,
+	0x93e00000,
+	0x1d0101ce,
+	0x9de00001,
+	0xcd000ff6,
+	0x9de00002,
+	0x60000e10,
+	0x1d010019,
+	0x9de00000,
+	0x8de0007a,
+	0x9de00001,
+	0x600009fd,
+	0x1d010019,
+	0x9de00000,
+	0x8de0007b,
+	0x9de00001,
+	0x600009fd,
+	0x01010000,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x88e00009,
+	0x89e0000a,
+	0x8ae0000b,
+	0x8be0000c,
+	0x8ce0000d,
+	0x8de0000e,
+	0x8fe0000f,
+	0x1ee1007c,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30006,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000c,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x1c01000b,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00006,
+	0x9de00002,
+	0x600009fd,
+	0x0d010001,
+	0x0101000d,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d000a14,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x40000a22,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x81000a14,
+	0x40000a2a,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x600009fd,
+	0x0d010001,
+	0x9d000a14,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00005,
+	0x8dd00014,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00006,
+	0x1d010002,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x600009fd,
+	0x8de00005,
+	0x8dd00014,
+	0x9de00000,
+	0x60000b61,
+	0x1d010002,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x90e00002,
+	0x600009fd,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee3000a,
+	0x97e00003,
+	0x9be00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x1de1000d,
+	0x9de00009,
+	0x8de0000a,
+	0x9de00008,
+	0x0c010000,
+	0x0b01000d,
+	0x2db9000c,
+	0xb0d0000a,
+	0x8de00008,
+	0x8dd00010,
+	0x0d01000d,
+	0x2dd9000c,
+	0xb0d00005,
+	0x8de00008,
+	0x8dd00012,
+	0x1c010032,
+	0x2dd7000c,
+	0xb0d00001,
+	0x40000a8b,
+	0x8de0000a,
+	0xcc000b72,
+	0x9cd0000f,
+	0x8de0000a,
+	0xcc000a2e,
+	0x0c01000c,
+	0x9cd00007,
+	0x8de0000a,
+	0x8cd00012,
+	0x8bd00010,
+	0x0cc1000b,
+	0x3b0effff,
+	0x1bbdffff,
+	0x07c1000b,
+	0x8ce0000c,
+	0x1cc00003,
+	0x0773000c,
+	0x97d0000d,
+	0x0d010007,
+	0x17d10001,
+	0x8ce0000b,
+	0x0c01000c,
+	0x9cd00000,
+	0x0d010007,
+	0x17d10001,
+	0x8ce0000c,
+	0x0c01000c,
+	0x9cd00000,
+	0x97e00000,
+	0x8de00009,
+	0x9de00001,
+	0x8de0000c,
+	0x0d01000d,
+	0x9de00002,
+	0x60000cf7,
+	0x8de0000c,
+	0x07d10007,
+	0x8de0000a,
+	0x0d01000d,
+	0x9d700000,
+	0x87e00003,
+	0x8be00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1000a,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x9fe00002,
+	0x8d000a92,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x60000e42,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c0103ff,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x9d000a92,
+	0x81000a92,
+	0x8ce00000,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10003,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x000005e8,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x600009fd,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30004,
+	0x9ae00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000ae4,
+	0x8de00004,
+	0x8cd00000,
+	0x1b010001,
+	0x8ae00005,
+	0x0bba000a,
+	0x0ccd000b,
+	0x9cd00000,
+	0x01010000,
+	0x8ae00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30004,
+	0x9ae00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000b01,
+	0x8de00004,
+	0x8cd00000,
+	0x1b010001,
+	0x8ae00005,
+	0x0bba000a,
+	0x0b03000b,
+	0x1bb30001,
+	0x0ccb000b,
+	0x9cd00000,
+	0x01010000,
+	0x8ae00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30001,
+	0x9de00000,
+	0x8de00001,
+	0x90d00000,
+	0x01010000,
+	0x8de00000,
+	0x1ee10001,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0e003f,
+	0x1ccdffff,
+	0x9cd00000,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30003,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000b32,
+	0x8de00003,
+	0x8dd00000,
+	0x1c010001,
+	0x8be00004,
+	0x0cca000b,
+	0x0ddb000c,
+	0x2dd90000,
+	0xb0d00002,
+	0x11010001,
+	0x40000b32,
+	0x01010000,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0010bd,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x600009fd,
+	0xc10010bd,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x91e00000,
+	0x92e00001,
+	0x81e00002,
+	0x82e00000,
+	0x92100000,
+	0x82e00001,
+	0x92100001,
+	0x93100002,
+	0x94100003,
+	0x95100004,
+	0x96100005,
+	0x97100006,
+	0x98100007,
+	0x99100008,
+	0x9a100009,
+	0x9b10000a,
+	0x9c10000b,
+	0x9d10000c,
+	0x9f10000f,
+	0x1ee10002,
+	0x9e10000d,
+	0x81effffe,
+	0x82efffff,
+	0x50f00000,
+	0x8de00000,
+	0x81d00000,
+	0x82d00001,
+	0x83d00002,
+	0x84d00003,
+	0x85d00004,
+	0x86d00005,
+	0x87d00006,
+	0x88d00007,
+	0x89d00008,
+	0x8ad00009,
+	0x8bd0000a,
+	0x8cd0000b,
+	0x8fd0000f,
+	0x8ed0000d,
+	0x8dd0000c,
+	0x50f00000,
+	0x82e00000,
+	0x83e00001,
+	0x1ee10002,
+	0x70200000,
+	0x0ee10003,
+	0x50800000,
+	0x1ee30001,
+	0x91e00000,
+	0x81e00001,
+	0x92100001,
+	0x82e00000,
+	0x92100000,
+	0x93100002,
+	0x94100003,
+	0x95100004,
+	0x96100005,
+	0x97100006,
+	0x98100007,
+	0x99100008,
+	0x9a100009,
+	0x9b10000a,
+	0x9c10000b,
+	0x9d10000c,
+	0x9f10000f,
+	0x1ee10001,
+	0x9e10000d,
+	0x1ee10001,
+	0x40000b61,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x1d010001,
+	0x9de00000,
+	0xcd001080,
+	0x9de00001,
+	0x8de00005,
+	0x9de00002,
+	0x60000abd,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00002,
+	0x81e00005,
+	0x40000b9f,
+	0x310effff,
+	0x111dffff,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x87000ba3,
+	0x40000bad,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x60000a15,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x60000a15,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x40000c0c,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d000ba3,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d000ba3,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000ba4,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000bbd,
+	0x90700003,
+	0x40000c53,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000be5,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x40000c54,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000be5,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000c54,
+	0x97000ba3,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d000ba3,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c000ba3,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x60000a15,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x60000c8f,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x40000cbd,
+	0x07010000,
+	0x01010007,
+	0x40000cc0,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x60000c9a,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x60000c8f,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x60000c5a,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x60000c5a,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30004,
+	0x96e00000,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00004,
+	0x86e00005,
+	0x8de00006,
+	0x2dd90000,
+	0xb0d00011,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x40000d0c,
+	0x0d010007,
+	0x17d10001,
+	0x0c010006,
+	0x16c10001,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00006,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de00006,
+	0x2ddb0000,
+	0xb0dffff4,
+	0x81e00004,
+	0x86e00000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee3000d,
+	0x93e00000,
+	0x94e00001,
+	0x95e00002,
+	0x96e00003,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x16010001,
+	0x07010000,
+	0x40000d29,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000c,
+	0x1cd20009,
+	0x3dc00005,
+	0xb0d00003,
+	0x8de0000c,
+	0x3dda0020,
+	0xb0d00002,
+	0x15010001,
+	0x40000d35,
+	0x05010000,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002b,
+	0xb0d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x40000d49,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002d,
+	0xb0d00005,
+	0x360effff,
+	0x166dffff,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000f,
+	0x2dda0000,
+	0xb0d00022,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda0030,
+	0xb0d0001c,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd20041,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd00061,
+	0x14d20041,
+	0x40000d5e,
+	0x8de0000d,
+	0x84d00001,
+	0x3d4a0078,
+	0xb0d00006,
+	0x1d010010,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10002,
+	0x9de0000d,
+	0x40000d6e,
+	0x1d010008,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x40000d6e,
+	0x1d01000a,
+	0x9de0000f,
+	0x8de0000f,
+	0x9de0000b,
+	0x3dd00002,
+	0xb0d00003,
+	0x8de0000b,
+	0x3dd40024,
+	0xb0d00048,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01010000,
+	0x40000dda,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20030,
+	0x0d01000d,
+	0x1c01000a,
+	0x2dd7000c,
+	0xb0d00004,
+	0x8de0000d,
+	0x8dd00000,
+	0x14d20030,
+	0x40000d99,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20061,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd00041,
+	0x13d20061,
+	0x40000d97,
+	0x8de0000d,
+	0x83d00000,
+	0x1d320041,
+	0x14d0000a,
+	0x8de0000f,
+	0x2d40000d,
+	0xb0d00001,
+	0x40000dd2,
+	0x3d0e7fff,
+	0x1dddffff,
+	0x0dd20004,
+	0x8ce0000f,
+	0x0dd6000c,
+	0x2d74000d,
+	0xb0d00013,
+	0x3d6a0001,
+	0xb0d00003,
+	0x330e7fff,
+	0x133dffff,
+	0x40000dab,
+	0x330e8000,
+	0x133d0000,
+	0x07010003,
+	0x60000e42,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x1c010022,
+	0x9cd00000,
+	0x40000dba,
+	0x8de0000f,
+	0x0d74000d,
+	0x07d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000a,
+	0x1cd20030,
+	0x0c01000c,
+	0x1b01000a,
+	0x2dc1000b,
+	0xb0dfffb9,
+	0x1d010006,
+	0x9de00009,
+	0x8ce0000a,
+	0x1cc20061,
+	0x0c01000c,
+	0x2dc1000d,
+	0xb0dfffb2,
+	0x8de0000a,
+	0x1dd20041,
+	0x0d01000d,
+	0x8ce00009,
+	0x2dd1000c,
+	0xb0dfffac,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01640007,
+	0x83e00000,
+	0x84e00001,
+	0x85e00002,
+	0x86e00003,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000d,
+	0x50f00000,
+	0x1ee30006,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000c,
+	0x9de00000,
+	0x600009fd,
+	0x0d010001,
+	0x1c01000b,
+	0x9ce00000,
+	0x9de00001,
+	0x1d010006,
+	0x9de00002,
+	0x600009fd,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00005,
+	0x2dd90000,
+	0xb0d0000b,
+	0x87e00003,
+	0x0d010007,
+	0x17d10001,
+	0x8ce00004,
+	0x9cd00000,
+	0x8de00005,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de00005,
+	0x2ddb0000,
+	0xb0dffff6,
+	0x81e00003,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00006,
+	0x2dda0000,
+	0xb0d0000a,
+	0x8d000ab8,
+	0x9de00000,
+	0xcd001083,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x8de00007,
+	0x9de00003,
+	0x60000abd,
+	0x60000de5,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000e42,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000b37,
+	0x0d010001,
+	0x8c000ab8,
+	0x9ce00000,
+	0xcc00109e,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000abd,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x40000e55,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x2dd8000c,
+	0xb0d00001,
+	0x40000e60,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00004,
+	0x1dd10001,
+	0x9de00004,
+	0x0d010000,
+	0x9de00002,
+	0x8ce00003,
+	0x8cc00000,
+	0x2dc8000d,
+	0xb0d00005,
+	0x8de00004,
+	0x8dd00000,
+	0x8ce00002,
+	0x2dda000c,
+	0xb0dfffe8,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x01d2000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x000005d5,
+	0x000005e1,
+	0x00000ea1,
+	0x00000e9e,
+	0x00000e74,
+	0x00000000,
+	0x00000064,
+	0x00000065,
+	0x00000066,
+	0x0000000a,
+	0x00000000,
+	0x00000065,
+	0x00000063,
+	0x00000068,
+	0x0000006f,
+	0x00000020,
+	0x00000061,
+	0x00000062,
+	0x00000063,
+	0x0000005c,
+	0x0000006e,
+	0x00000064,
+	0x00000065,
+	0x00000066,
+	0x0000005c,
+	0x0000006e,
+	0x00000067,
+	0x00000068,
+	0x0000006e,
+	0x00000020,
+	0x0000007c,
+	0x00000020,
+	0x00000074,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000020,
+	0x0000002d,
+	0x0000006e,
+	0x00000020,
+	0x00000032,
+	0x00000020,
+	0x0000007c,
+	0x00000020,
+	0x00000067,
+	0x00000072,
+	0x00000065,
+	0x00000070,
+	0x00000020,
+	0x00000064,
+	0x00000065,
+	0x00000066,
+	0x00000000,
+	0x0000002d,
+	0x00000063,
+	0x00000000,
+	0x0000002f,
+	0x00000062,
+	0x00000069,
+	0x0000006e,
+	0x0000002f,
+	0x00000077,
+	0x00000073,
+	0x00000068,
+	0x00000000,
+	0x00000061,
+	0x00000000,
+	0x0000006d,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x0000006f,
+	0x00000063,
+	0x00000000,
+	0x00000048,
+	0x00000065,
+	0x0000006c,
+	0x0000006c,
+	0x0000006f,
+	0x00000020,
+	0x00000057,
+	0x0000006f,
+	0x00000072,
+	0x0000006c,
+	0x00000064,
+	0x00000021,
+	0x00000020,
+	0x00000049,
+	0x00000027,
+	0x0000006d,
+	0x00000020,
+	0x00000063,
+	0x0000006f,
+	0x00000072,
+	0x0000006f,
+	0x00000075,
+	0x00000074,
+	0x00000069,
+	0x0000006e,
+	0x00000065,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000049,
+	0x0000006e,
+	0x00000076,
+	0x00000061,
+	0x0000006c,
+	0x00000069,
+	0x00000064,
+	0x00000020,
+	0x0000006e,
+	0x00000075,
+	0x0000006d,
+	0x00000062,
+	0x00000065,
+	0x00000072,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000061,
+	0x0000006c,
+	0x00000061,
+	0x00000072,
+	0x0000006d,
+	0x00000020,
+	0x00000068,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x0000006c,
+	0x00000065,
+	0x00000072,
+	0x00000020,
+	0x00000074,
+	0x00000072,
+	0x00000069,
+	0x00000067,
+	0x00000067,
+	0x00000065,
+	0x00000072,
+	0x00000065,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000000,
+	0x00000073,
+	0x00000069,
+	0x00000067,
+	0x00000073,
+	0x00000065,
+	0x00000067,
+	0x00000076,
+	0x00000020,
+	0x00000068,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x0000006c,
+	0x00000065,
+	0x00000072,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x00000076,
+	0x0000006f,
+	0x0000006b,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000047,
+	0x00000065,
+	0x0000006e,
+	0x00000065,
+	0x00000072,
+	0x00000061,
+	0x00000074,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000063,
+	0x0000006b,
+	0x00000020,
+	0x0000006f,
+	0x00000076,
+	0x00000065,
+	0x00000072,
+	0x00000066,
+	0x0000006c,
+	0x0000006f,
+	0x00000077,
+	0x00000020,
+	0x00000066,
+	0x0000006f,
+	0x00000072,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x0000000a,
+	0x00000000,
+	0x00000064,
+	0x00000069,
+	0x00000076,
+	0x00000069,
+	0x00000064,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000066,
+	0x0000006f,
+	0x0000006f,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x00000062,
+	0x00000079,
+	0x00000020,
+	0x00000030,
+	0x0000000a,
+	0x00000000,
+	0x00000073,
+	0x00000069,
+	0x00000067,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x00000020,
+	0x00000068,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x0000006c,
+	0x00000065,
+	0x00000072,
+	0x00000020,
+	0x00000075,
+	0x00000073,
+	0x00000072,
+	0x00000031,
+	0x00000020,
+	0x00000073,
+	0x00000068,
+	0x0000006f,
+	0x00000075,
+	0x0000006c,
+	0x00000064,
+	0x00000020,
+	0x00000062,
+	0x00000065,
+	0x00000020,
+	0x00000063,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000061,
+	0x00000066,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x00000020,
+	0x00000074,
+	0x00000068,
+	0x00000069,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000054,
+	0x00000045,
+	0x00000052,
+	0x0000004d,
+	0x00000020,
+	0x00000065,
+	0x0000006e,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000054,
+	0x00000045,
+	0x00000052,
+	0x0000004d,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000072,
+	0x00000074,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000049,
+	0x0000004e,
+	0x00000054,
+	0x00000020,
+	0x00000065,
+	0x0000006e,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000049,
+	0x0000004e,
+	0x00000054,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000072,
+	0x00000074,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000055,
+	0x00000052,
+	0x00000032,
+	0x00000020,
+	0x00000065,
+	0x0000006e,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000055,
+	0x00000052,
+	0x00000032,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000072,
+	0x00000074,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000055,
+	0x00000052,
+	0x00000031,
+	0x00000020,
+	0x00000065,
+	0x0000006e,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000053,
+	0x00000049,
+	0x00000047,
+	0x00000055,
+	0x00000052,
+	0x00000031,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000072,
+	0x00000074,
+	0x0000000a,
+	0x00000000,
+	0x00000075,
+	0x00000073,
+	0x00000065,
+	0x00000072,
+	0x0000002f,
+	0x00000063,
+	0x0000006f,
+	0x0000006d,
+	0x0000006d,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x00000073,
+	0x0000002f,
+	0x00000074,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x0000002e,
+	0x00000063,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000074,
+	0x00000075,
+	0x00000072,
+	0x0000006e,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x0000002d,
+	0x0000002d,
+	0x0000002d,
+	0x0000000a,
+	0x0000000a,
+	0x00000000,
+	0x00000020,
+	0x0000002a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000041,
+	0x00000076,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000061,
+	0x00000062,
+	0x0000006c,
+	0x00000065,
+	0x00000020,
+	0x00000054,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x00000020,
+	0x0000004f,
+	0x00000070,
+	0x00000074,
+	0x00000069,
+	0x0000006f,
+	0x0000006e,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000072,
+	0x00000075,
+	0x0000006e,
+	0x00000000,
+	0x00000077,
+	0x00000068,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000000,
+	0x00000070,
+	0x00000069,
+	0x00000070,
+	0x00000065,
+	0x00000000,
+	0x00000073,
+	0x00000069,
+	0x00000067,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x00000000,
+	0x00000074,
+	0x00000069,
+	0x0000006d,
+	0x00000065,
+	0x00000073,
+	0x00000000,
+	0x00000074,
+	0x00000069,
+	0x0000006d,
+	0x00000065,
+	0x00000072,
+	0x00000000,
+	0x00000065,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000072,
+	0x00000000,
+	0x0000006e,
+	0x00000075,
+	0x0000006c,
+	0x0000006c,
+	0x00000000,
+	0x00000063,
+	0x0000006f,
+	0x00000072,
+	0x0000006f,
+	0x00000075,
+	0x00000074,
+	0x00000069,
+	0x0000006e,
+	0x00000065,
+	0x00000000,
+	0x00000066,
+	0x0000006c,
+	0x0000006f,
+	0x00000061,
+	0x00000074,
+	0x00000000,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000063,
+	0x0000006b,
+	0x00000000,
+	0x00000025,
+	0x00000063,
+	0x00000000,
+	0x00000061,
+	0x00000073,
+	0x00000073,
+	0x00000065,
+	0x00000072,
+	0x00000074,
+	0x00000069,
+	0x0000006f,
+	0x0000006e,
+	0x00000020,
+	0x00000066,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000061,
+	0x00000074,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80000054,
+	0x0000040c,
+	0x19960503,
+	0x0000047d,
+	0x00001000,
+	0x000018e4,
+	0x000017d8,
+	0x0000010c,
+	0x00000040,
+	0x1ee3000f,
+	0x92e00004,
+	0x93e00005,
+	0x94e00006,
+	0x95e00007,
+	0x96e00008,
+	0x97e00009,
+	0x9ce0000a,
+	0x9de0000b,
+	0x9fe0000c,
+	0x90e0000e,
+	0x90e0000d,
+	0x04010000,
+	0x07010000,
+	0x05010000,
+	0x1d010001,
+	0x8ce00010,
+	0x0c01000c,
+	0x0dd5000c,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x0601000d,
+	0x40000432,
+	0x12300001,
+	0x8de00010,
+	0x2d40000d,
+	0xb0d00004,
+	0x0d710006,
+	0x8dd00000,
+	0x9de00000,
+	0x6000096e,
+	0x0d010002,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x0c710006,
+	0x9dc00000,
+	0x0d710006,
+	0x8dd00000,
+	0x9de00000,
+	0x8de0000e,
+	0x9de00001,
+	0x0d010002,
+	0x9de00002,
+	0x60000520,
+	0x1d700001,
+	0x8ce00010,
+	0x07d8000c,
+	0x14400001,
+	0x1de1000e,
+	0x9de00000,
+	0x1de1000d,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x8de0000f,
+	0x9de00003,
+	0x60000611,
+	0x0d010001,
+	0x0301000d,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0dfffd7,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x9de00000,
+	0x6000096e,
+	0x8de00010,
+	0x2d46000d,
+	0xb0d00012,
+	0x05010000,
+	0x4000045a,
+	0x1d010001,
+	0x9de00000,
+	0xcd000a36,
+	0x9de00001,
+	0x0d510006,
+	0x8dd00000,
+	0x9de00002,
+	0x60000814,
+	0x0d510006,
+	0x8dd00000,
+	0x9de00000,
+	0x6000096e,
+	0x15500001,
+	0x2d500004,
+	0xb0dffff1,
+	0x40000470,
+	0x05010000,
+	0x4000046d,
+	0x0d700005,
+	0x8ce00010,
+	0x0dd8000c,
+	0x0dd10006,
+	0x82d00000,
+	0x1d010001,
+	0x9de00000,
+	0xcd000a36,
+	0x9de00001,
+	0x92e00002,
+	0x60000814,
+	0x92e00000,
+	0x6000096e,
+	0x15500001,
+	0x8de00010,
+	0x2d50000d,
+	0xb0dfffef,
+	0x96e00000,
+	0x6000096e,
+	0x82e00004,
+	0x83e00005,
+	0x84e00006,
+	0x85e00007,
+	0x86e00008,
+	0x87e00009,
+	0x8ce0000a,
+	0x8de0000b,
+	0x8fe0000c,
+	0x1ee1000f,
+	0x50f00000,
+	0x1ee3004f,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0xc7000802,
+	0x06010000,
+	0x1501000a,
+	0x04010000,
+	0x16010001,
+	0x400004e5,
+	0x8de00050,
+	0x0d61000d,
+	0x8dd00000,
+	0x9de00000,
+	0xcd000a33,
+	0x9de00001,
+	0x60000826,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d0001e,
+	0x1d600001,
+	0x8ce00050,
+	0x0dd1000c,
+	0x8dd00000,
+	0x9de00000,
+	0x1de1004e,
+	0x9de00001,
+	0x1d01000a,
+	0x9de00002,
+	0x60000545,
+	0x0d010001,
+	0x0501000d,
+	0x8de0004e,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d0000c,
+	0x8d00080f,
+	0x9de00000,
+	0xcd000a16,
+	0x9de00001,
+	0x1d600001,
+	0x8ce00050,
+	0x0dd1000c,
+	0x8dd00000,
+	0x9de00002,
+	0x60000814,
+	0x11010001,
+	0x40000516,
+	0x16600001,
+	0x400004e4,
+	0x8de00050,
+	0x0d61000d,
+	0x8dd00000,
+	0x9de00000,
+	0xcd000a13,
+	0x9de00001,
+	0x60000826,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00002,
+	0x14010001,
+	0x400004e4,
+	0x8de00050,
+	0x0d61000d,
+	0x8dd00000,
+	0x9de00000,
+	0xcd000a11,
+	0x9de00001,
+	0x60000731,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00018,
+	0x600009f4,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x600007f1,
+	0x0d010001,
+	0x8c00080f,
+	0x9ce00000,
+	0xcc0009f6,
+	0x9ce00001,
+	0x8ce00050,
+	0x8cc00001,
+	0x9ce00002,
+	0x9de00003,
+	0x60000814,
+	0x11010001,
+	0x40000516,
+	0x16600001,
+	0x8de0004f,
+	0x2d60000d,
+	0xb0dfffa4,
+	0x97e00000,
+	0x95e00001,
+	0x60000400,
+	0x2d480000,
+	0xb0d00028,
+	0x1de1004c,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0x600007bd,
+	0x3d0e0773,
+	0x1ddd5940,
+	0x9de0004d,
+	0x40000514,
+	0x1d01002f,
+	0x9de00000,
+	0x1de1004c,
+	0x9de00001,
+	0x90e00002,
+	0x600007d5,
+	0x40000507,
+	0x1de1000c,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x0d010003,
+	0x9de00002,
+	0xcd000808,
+	0x9de00003,
+	0x60000782,
+	0x1de1000c,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x97e00003,
+	0x60000769,
+	0x0d010001,
+	0x0d01000d,
+	0x0301000d,
+	0x2dd20000,
+	0xb0dfffea,
+	0x400004f7,
+	0x01010000,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee1004f,
+	0x50f00000,
+	0x1ee30004,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x9de00003,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x40000533,
+	0x8de00004,
+	0x1cd10001,
+	0x9ce00004,
+	0x8ce00005,
+	0x1bc10001,
+	0x9be00005,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00005,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00006,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00006,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00004,
+	0x90d00000,
+	0x81e00003,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee3000d,
+	0x93e00000,
+	0x94e00001,
+	0x95e00002,
+	0x96e00003,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x16010001,
+	0x07010000,
+	0x40000555,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000c,
+	0x1cd20009,
+	0x3dc00005,
+	0xb0d00003,
+	0x8de0000c,
+	0x3dda0020,
+	0xb0d00002,
+	0x15010001,
+	0x40000561,
+	0x05010000,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002b,
+	0xb0d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x40000575,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda002d,
+	0xb0d00005,
+	0x360effff,
+	0x166dffff,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000f,
+	0x2dda0000,
+	0xb0d00022,
+	0x8de0000d,
+	0x8dd00000,
+	0x3dda0030,
+	0xb0d0001c,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd20041,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00001,
+	0x1dd00061,
+	0x14d20041,
+	0x4000058a,
+	0x8de0000d,
+	0x84d00001,
+	0x3d4a0078,
+	0xb0d00006,
+	0x1d010010,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10002,
+	0x9de0000d,
+	0x4000059a,
+	0x1d010008,
+	0x9de0000f,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x4000059a,
+	0x1d01000a,
+	0x9de0000f,
+	0x8de0000f,
+	0x9de0000b,
+	0x3dd00002,
+	0xb0d00003,
+	0x8de0000b,
+	0x3dd40024,
+	0xb0d00048,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01010000,
+	0x40000606,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20030,
+	0x0d01000d,
+	0x1c01000a,
+	0x2dd7000c,
+	0xb0d00004,
+	0x8de0000d,
+	0x8dd00000,
+	0x14d20030,
+	0x400005c5,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd20061,
+	0x0d01000d,
+	0x1c01001a,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de0000d,
+	0x8dd00000,
+	0x1dd00041,
+	0x13d20061,
+	0x400005c3,
+	0x8de0000d,
+	0x83d00000,
+	0x1d320041,
+	0x14d0000a,
+	0x8de0000f,
+	0x2d40000d,
+	0xb0d00001,
+	0x400005fe,
+	0x3d0e7fff,
+	0x1dddffff,
+	0x0dd20004,
+	0x8ce0000f,
+	0x0dd6000c,
+	0x2d74000d,
+	0xb0d00013,
+	0x3d6a0001,
+	0xb0d00003,
+	0x330e7fff,
+	0x133dffff,
+	0x400005d7,
+	0x330e8000,
+	0x133d0000,
+	0x07010003,
+	0x600009f4,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x1c010022,
+	0x9cd00000,
+	0x400005e6,
+	0x8de0000f,
+	0x0d74000d,
+	0x07d00004,
+	0x8de0000d,
+	0x1dd10001,
+	0x9de0000d,
+	0x8de0000d,
+	0x8dd00000,
+	0x9de0000a,
+	0x1cd20030,
+	0x0c01000c,
+	0x1b01000a,
+	0x2dc1000b,
+	0xb0dfffb9,
+	0x1d010006,
+	0x9de00009,
+	0x8ce0000a,
+	0x1cc20061,
+	0x0c01000c,
+	0x2dc1000d,
+	0xb0dfffb2,
+	0x8de0000a,
+	0x1dd20041,
+	0x0d01000d,
+	0x8ce00009,
+	0x2dd1000c,
+	0xb0dfffac,
+	0x8de0000e,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00000,
+	0x01640007,
+	0x83e00000,
+	0x84e00001,
+	0x85e00002,
+	0x86e00003,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000d,
+	0x50f00000,
+	0x1ee30008,
+	0x96e00002,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x0d010000,
+	0x9de00007,
+	0x8ce00008,
+	0x0c01000c,
+	0x2dc9000d,
+	0xb0d0000a,
+	0x8de00009,
+	0x0d01000d,
+	0x8ce00007,
+	0x2dd9000c,
+	0xb0d00005,
+	0x8de0000b,
+	0x0d01000d,
+	0x8ce00007,
+	0x2ddb000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000680,
+	0x8de00008,
+	0x8dd00000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00012,
+	0x8de00009,
+	0x1c010078,
+	0x9cd00000,
+	0x8de00009,
+	0x8dd00000,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x8ce00008,
+	0x9dc00000,
+	0x8de00008,
+	0x8dd00000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000680,
+	0x06010000,
+	0x40000669,
+	0x1d010001,
+	0x0d61000d,
+	0x8ce00009,
+	0x8cc00000,
+	0x2dd1000c,
+	0xb0d00015,
+	0x8de00009,
+	0x8cd00000,
+	0x1cca0001,
+	0x9cd00000,
+	0x8de00008,
+	0x8cd00000,
+	0x9ce00000,
+	0x8ce00009,
+	0x8cc00000,
+	0x9ce00001,
+	0x600006ab,
+	0x0c010001,
+	0x9cd00000,
+	0x8de00008,
+	0x8dd00000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000680,
+	0x0d010006,
+	0x1c010001,
+	0x06d1000c,
+	0x8ce00008,
+	0x8cc00000,
+	0x0dd1000c,
+	0x97d00000,
+	0x8de0000a,
+	0x2d7a000d,
+	0xb0d00001,
+	0x40000672,
+	0x8de0000b,
+	0x9de00000,
+	0x6000099f,
+	0x0d010001,
+	0x0701000d,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0dfffd1,
+	0x2d6b0000,
+	0xb0d00007,
+	0x3d0effff,
+	0x1dddffff,
+	0x2d7a000d,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000680,
+	0x8de00008,
+	0x8dd00000,
+	0x0d61000d,
+	0x90d00000,
+	0x01010006,
+	0x86e00002,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x95e00000,
+	0x96e00001,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x86d00004,
+	0x8de00007,
+	0x85d00004,
+	0x07010000,
+	0x40000699,
+	0x0d710005,
+	0x0c710006,
+	0x8cc00000,
+	0x9cd00000,
+	0x1d010001,
+	0x0771000d,
+	0x1d7a0002,
+	0x9de00005,
+	0x8ce00006,
+	0x8cc00000,
+	0x2dd7000c,
+	0xb0d00005,
+	0x8de00007,
+	0x8dd00000,
+	0x8ce00005,
+	0x2dc1000d,
+	0xb0dfffef,
+	0x85e00000,
+	0x86e00001,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000c,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de0000c,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00006,
+	0x8de0000d,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x0101000d,
+	0x4000072b,
+	0x8de0000c,
+	0x9de00000,
+	0x60000942,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d0006a,
+	0x8de0000d,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de0000a,
+	0x8de0000c,
+	0x9de00000,
+	0x60000937,
+	0x0d010001,
+	0x9de0000b,
+	0x8de0000b,
+	0x8dd00000,
+	0x8ce0000a,
+	0x2dd1000c,
+	0xb0d0000d,
+	0x8de0000b,
+	0x8dd00000,
+	0x8ce0000a,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d0004f,
+	0x8de0000b,
+	0x9de00000,
+	0x8de0000a,
+	0x9de00001,
+	0x60000865,
+	0x40000728,
+	0x8de0000b,
+	0x8dd00001,
+	0x9de00009,
+	0x8de00009,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00027,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00023,
+	0x8de0000b,
+	0x8bd00000,
+	0x8dd00004,
+	0x0d01000d,
+	0x0d01000d,
+	0x0d01000d,
+	0x0dd1000b,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00018,
+	0x1d010005,
+	0x0db1000d,
+	0x8ce00006,
+	0x8cc00000,
+	0x0dd1000c,
+	0x8ce0000a,
+	0x2dd1000c,
+	0xb0d00010,
+	0x8de0000b,
+	0x9de00000,
+	0x60000902,
+	0x8de0000b,
+	0x8dd00000,
+	0x8ce0000a,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00020,
+	0x8de0000b,
+	0x9de00000,
+	0x8de0000a,
+	0x9de00001,
+	0x60000865,
+	0x40000728,
+	0x8de0000a,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x9de00008,
+	0x8de00008,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x4000072b,
+	0x8de00008,
+	0x9de00000,
+	0x60000937,
+	0x0d010001,
+	0x9de00007,
+	0x8de0000b,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000687,
+	0x8de0000c,
+	0x9de00000,
+	0x6000096e,
+	0x81e00008,
+	0x4000072b,
+	0x81e0000c,
+	0x4000072b,
+	0x01010000,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee1000c,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x1d010006,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010007,
+	0x40000763,
+	0x1d010016,
+	0x9de00000,
+	0x1d010102,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x600007d5,
+	0x0d010001,
+	0x9d700001,
+	0x8d700001,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d00001,
+	0x40000760,
+	0x1d0101f4,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x9d700004,
+	0x8d700004,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x4000075d,
+	0x1d0101f4,
+	0x9d700003,
+	0x01010007,
+	0x40000763,
+	0x8d700004,
+	0x9de00000,
+	0x6000096e,
+	0x97e00000,
+	0x6000096e,
+	0x01010000,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30008,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00009,
+	0x8ce0000a,
+	0x0dd5000c,
+	0x9de00007,
+	0x1d010017,
+	0x9de00000,
+	0x8de0000b,
+	0x8dd00001,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x8de00007,
+	0x9de00003,
+	0x600007d5,
+	0x0d010001,
+	0x0101000d,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30008,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00009,
+	0x8ce0000a,
+	0x0dd5000c,
+	0x9de00007,
+	0x1d010018,
+	0x9de00000,
+	0x8de0000b,
+	0x8dd00001,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x8de00007,
+	0x9de00003,
+	0x600007d5,
+	0x0d010001,
+	0x0101000d,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010019,
+	0x9de00000,
+	0x8de00005,
+	0x8dd00001,
+	0x9de00001,
+	0x600007d5,
+	0x0d010001,
+	0x9de00004,
+	0x8de00005,
+	0x8dd00004,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00004,
+	0x8de00005,
+	0x8dd00004,
+	0x9de00000,
+	0x6000096e,
+	0x8de00005,
+	0x8dd00002,
+	0x1ddb0800,
+	0x1ddf0800,
+	0x2dd80000,
+	0xb0d00003,
+	0x8de00005,
+	0x9de00000,
+	0x6000096e,
+	0x81e00004,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00005,
+	0x2dd90000,
+	0xb0d0000b,
+	0x87e00003,
+	0x0d010007,
+	0x17d10001,
+	0x8ce00004,
+	0x9cd00000,
+	0x8de00005,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de00005,
+	0x2ddb0000,
+	0xb0dffff6,
+	0x81e00003,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d0007d7,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x400007e5,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x810007d7,
+	0x400007ed,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x600007d5,
+	0x0d010001,
+	0x9d0007d7,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd000a39,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x600007d5,
+	0xc1000a39,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000224,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x600007d5,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x40000837,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x2dd8000c,
+	0xb0d00001,
+	0x40000842,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00004,
+	0x1dd10001,
+	0x9de00004,
+	0x0d010000,
+	0x9de00002,
+	0x8ce00003,
+	0x8cc00000,
+	0x2dc8000d,
+	0xb0d00005,
+	0x8de00004,
+	0x8dd00000,
+	0x8ce00002,
+	0x2dda000c,
+	0xb0dfffe8,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x01d2000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8700084b,
+	0x40000855,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x600007d8,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x600007d8,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x400008b4,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d00084b,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d00084b,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x6000084c,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000865,
+	0x90700003,
+	0x400008fb,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x6000088d,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x400008fc,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x6000088d,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x400008fc,
+	0x9700084b,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d00084b,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c00084b,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x600007d8,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x60000937,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x40000965,
+	0x07010000,
+	0x01010007,
+	0x40000968,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x60000942,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x60000937,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x60000902,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x60000902,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee3000b,
+	0x9be00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de0000b,
+	0x8dd00002,
+	0x1ddb0010,
+	0x2dd80000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x400009ee,
+	0x8de0000b,
+	0x8dd00004,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00009,
+	0x1d0101f4,
+	0x9de00000,
+	0x600008ba,
+	0x0d010001,
+	0x8ce0000b,
+	0x9dc00004,
+	0x8de0000b,
+	0x1c0101f4,
+	0x9cd00003,
+	0x8de0000b,
+	0x8cd00000,
+	0x8dd00004,
+	0x0dc1000d,
+	0x9de0000a,
+	0x8de0000b,
+	0x8dd00005,
+	0x0d01000d,
+	0x9de00008,
+	0x2dd90000,
+	0xb0d00005,
+	0x8de0000a,
+	0x0d01000d,
+	0x8ce00008,
+	0x2dc1000d,
+	0xb0d0001d,
+	0x1d010017,
+	0x9de00000,
+	0x8de0000b,
+	0x8cd00001,
+	0x9ce00001,
+	0x8cd00004,
+	0x9ce00002,
+	0x8dd00003,
+	0x9de00003,
+	0x600007d5,
+	0x0d010001,
+	0x9de00009,
+	0x8de00009,
+	0x2dd20000,
+	0xb0d00008,
+	0x8de0000b,
+	0x1dd10002,
+	0x8cd00000,
+	0x1ccd0010,
+	0x9cd00000,
+	0x310effff,
+	0x111dffff,
+	0x400009ee,
+	0x8de0000b,
+	0x8ce00009,
+	0x9cd00000,
+	0x8de0000b,
+	0x8cd00004,
+	0x9cd00005,
+	0x8de0000b,
+	0x1dd10005,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8dc00000,
+	0x0101000d,
+	0x8be00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1000b,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x00000045,
+	0x00000072,
+	0x00000072,
+	0x0000006f,
+	0x00000072,
+	0x00000020,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x0000006e,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000002c,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000072,
+	0x00000000,
+	0x0000002d,
+	0x00000066,
+	0x00000000,
+	0x00000049,
+	0x0000006e,
+	0x00000076,
+	0x00000061,
+	0x0000006c,
+	0x00000069,
+	0x00000064,
+	0x00000020,
+	0x0000006e,
+	0x00000075,
+	0x0000006d,
+	0x00000062,
+	0x00000065,
+	0x00000072,
+	0x00000020,
+	0x0000006f,
+	0x00000066,
+	0x00000020,
+	0x0000006c,
+	0x00000069,
+	0x0000006e,
+	0x00000065,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x0000002d,
+	0x0000006e,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x800000c1,
+	0x00000017,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x00000040,
+	0x00000040,
+	0x00000000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x1d01000d,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x6000040e,
+	0x0d010001,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x800000e9,
+	0x00000060,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x000002ac,
+	0x000001f0,
+	0x000000bc,
+	0x00000040,
+	0x1ee30006,
+	0x97e00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x1dd10001,
+	0x9de00007,
+	0x8dd00000,
+	0x9de00005,
+	0x8de00006,
+	0x3dd60002,
+	0xb0d00007,
+	0x8d000463,
+	0x9de00000,
+	0xcd000489,
+	0x9de00001,
+	0x60000468,
+	0x11010001,
+	0x40000420,
+	0x1d010038,
+	0x9de00000,
+	0x8de00005,
+	0x9de00001,
+	0x6000047a,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00003,
+	0xcd00047c,
+	0x9de00000,
+	0x60000438,
+	0x01010007,
+	0x87e00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0004ab,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x6000047a,
+	0xc10004ab,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000425,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000427,
+	0x0d010001,
+	0x8c000463,
+	0x9ce00000,
+	0xcc0004a3,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000468,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000042,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x6000047a,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000072,
+	0x0000006d,
+	0x00000064,
+	0x00000069,
+	0x00000072,
+	0x00000020,
+	0x00000066,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x00000000,
+	0x00000075,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000072,
+	0x0000006d,
+	0x00000064,
+	0x00000069,
+	0x00000072,
+	0x00000020,
+	0x0000005b,
+	0x00000044,
+	0x00000049,
+	0x00000052,
+	0x00000045,
+	0x00000043,
+	0x00000054,
+	0x0000004f,
+	0x00000052,
+	0x00000059,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x8000004f,
+	0x00000bd7,
+	0x19960503,
+	0x00000404,
+	0x00001000,
+	0x00003968,
+	0x00002fc4,
+	0x000009a4,
+	0x00000008,
+	0x00000001,
+	0x00000001,
+	0x00000000,
+	0x00000000,
+	0x1ee3000b,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x8de0000c,
+	0x17d10001,
+	0x8de0000b,
+	0x9d00125a,
+	0x8de0000c,
+	0x8dd00000,
+	0x9d00125b,
+	0x40000437,
+	0x8d00125a,
+	0x1dd20001,
+	0x9d00125a,
+	0x8d700000,
+	0x85d00001,
+	0x1d01006e,
+	0x9de00009,
+	0x2d58000d,
+	0xb0d0000f,
+	0x8de00009,
+	0x2d52000d,
+	0xb0d00003,
+	0x3d580065,
+	0xb0d00012,
+	0x40000435,
+	0x3d580073,
+	0xb0d0000b,
+	0x3d580076,
+	0xb0d00001,
+	0x40000435,
+	0x90000401,
+	0x1d010001,
+	0x9d000402,
+	0x40000436,
+	0x8d000403,
+	0x1dd00001,
+	0x9d000403,
+	0x40000436,
+	0x0d010000,
+	0x9d000402,
+	0x9d000401,
+	0x40000436,
+	0x17710001,
+	0x40000440,
+	0x6000051a,
+	0x17710001,
+	0x8d700000,
+	0x9de00009,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00004,
+	0x8de00009,
+	0x8dd00000,
+	0x3dd8002d,
+	0xb0dfffd3,
+	0x8d700000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x6000051a,
+	0x0d010007,
+	0x17d10001,
+	0x8dd00000,
+	0x9de00000,
+	0x60000885,
+	0x0d010001,
+	0x0601000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x8d000fda,
+	0x9de00000,
+	0xcd001065,
+	0x9de00001,
+	0x60000fdf,
+	0x1d010002,
+	0x9de00000,
+	0x9de00001,
+	0x90e00002,
+	0x600007ea,
+	0x8d700000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00030,
+	0x90e00000,
+	0x96e00001,
+	0x6000049a,
+	0x40000491,
+	0x8d700000,
+	0x9de00000,
+	0xcd001063,
+	0x9de00001,
+	0x600006d0,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00005,
+	0xcd001063,
+	0x9de00000,
+	0x96e00001,
+	0x6000049a,
+	0x4000048c,
+	0x1d010019,
+	0x9de00000,
+	0x90e00001,
+	0x600007ea,
+	0x1d010016,
+	0x9de00000,
+	0x90e00001,
+	0x8d700000,
+	0x9de00002,
+	0x600007ea,
+	0x0d010001,
+	0x9de0000a,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0d0000a,
+	0x8d000fda,
+	0x9de00000,
+	0xcd001054,
+	0x9de00001,
+	0x8d700000,
+	0x9de00002,
+	0x60000fdf,
+	0x1d010002,
+	0x9d000400,
+	0x4000048c,
+	0x8d700000,
+	0x9de00000,
+	0x96e00001,
+	0x6000049a,
+	0x17710001,
+	0x8d700000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dfffd0,
+	0x81000400,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000b,
+	0x50f00000,
+	0x1ee30070,
+	0x93e00003,
+	0x94e00004,
+	0x95e00005,
+	0x96e00006,
+	0x97e00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x06010000,
+	0x400004df,
+	0x1de1000b,
+	0x9de00000,
+	0x1d01000a,
+	0x9de00001,
+	0x6000055e,
+	0x0d010001,
+	0x0401000d,
+	0x16600001,
+	0x0d010004,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x8d000fda,
+	0x9de00000,
+	0xcd00103f,
+	0x9de00001,
+	0x8de00070,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x83e00070,
+	0x400004bb,
+	0xc3001039,
+	0x93e00002,
+	0x60000fdf,
+	0x400004bf,
+	0x90400000,
+	0x8de00071,
+	0x9de00000,
+	0x1de1000b,
+	0x9de00001,
+	0x60000d74,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d0000e,
+	0x8d000401,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00070,
+	0x9de00000,
+	0x96e00001,
+	0x1de1000b,
+	0x9de00002,
+	0x600004f4,
+	0x8d000400,
+	0x3dd80002,
+	0xb0d0000b,
+	0x90000400,
+	0x400004df,
+	0x8d000402,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00070,
+	0x9de00000,
+	0x96e00001,
+	0x1de1000b,
+	0x9de00002,
+	0x600004f4,
+	0x1de1000b,
+	0x9de00000,
+	0x1d010065,
+	0x9de00001,
+	0x6000052b,
+	0x0d010001,
+	0x0501000d,
+	0x3c0effff,
+	0x1ccdffff,
+	0x2dda000c,
+	0xb0dfffbb,
+	0x83e00003,
+	0x84e00004,
+	0x85e00005,
+	0x86e00006,
+	0x87e00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee10070,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00005,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0000a,
+	0x8d00125a,
+	0x3dd40003,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd001035,
+	0x9de00001,
+	0x8de00005,
+	0x9de00002,
+	0x60000fdf,
+	0x8d000403,
+	0x2dd80000,
+	0xb0d00007,
+	0x1d010001,
+	0x9de00000,
+	0xcd001031,
+	0x9de00001,
+	0x8de00006,
+	0x9de00002,
+	0x60000fdf,
+	0x1d010001,
+	0x9de00000,
+	0xcd00102d,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x60000fdf,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8d000fda,
+	0x9de00000,
+	0xcd000ff1,
+	0x9de00001,
+	0x60000fdf,
+	0x1d010002,
+	0x9de00000,
+	0x9de00001,
+	0x90e00002,
+	0x600007ea,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30006,
+	0x96e00001,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x86e00006,
+	0x40000554,
+	0xcd000fcd,
+	0x9de00000,
+	0x60000830,
+	0x0d010001,
+	0x0701000d,
+	0x8de00006,
+	0x1cd10001,
+	0x9ce00006,
+	0x97d00000,
+	0x2d760000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000557,
+	0x8de00006,
+	0x0d01000d,
+	0x0c010006,
+	0x0dd3000c,
+	0x0d01000d,
+	0x8ce00007,
+	0x1cc20001,
+	0x2dd8000c,
+	0xb0d00002,
+	0x3d7a000a,
+	0xb0d00008,
+	0x8de00006,
+	0x90d00000,
+	0x8de00006,
+	0x0d01000d,
+	0x0c010006,
+	0x0dd3000c,
+	0x0101000d,
+	0x40000557,
+	0x40000533,
+	0x310effff,
+	0x111dffff,
+	0x86e00001,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30005,
+	0x96e00000,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x40000566,
+	0x17710001,
+	0x8d700000,
+	0x9de00004,
+	0x2dd80000,
+	0xb0d00004,
+	0x8de00006,
+	0x8ce00004,
+	0x2dca000d,
+	0xb0dffff7,
+	0x8d700000,
+	0x2dd80000,
+	0xb0d00002,
+	0x06010007,
+	0x40000574,
+	0x06010000,
+	0x0d010006,
+	0x0101000d,
+	0x86e00000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8700057c,
+	0x40000586,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x6000074b,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x6000074b,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x400005e5,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d00057c,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d00057c,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x6000057d,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000596,
+	0x90700003,
+	0x4000062c,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x600005be,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x4000062d,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x600005be,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x4000062d,
+	0x9700057c,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d00057c,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c00057c,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x6000074b,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x60000668,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x40000696,
+	0x07010000,
+	0x01010007,
+	0x40000699,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x60000673,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x60000668,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x60000633,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x60000633,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x400006e1,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x2dd8000c,
+	0xb0d00001,
+	0x400006ec,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00004,
+	0x1dd10001,
+	0x9de00004,
+	0x0d010000,
+	0x9de00002,
+	0x8ce00003,
+	0x8cc00000,
+	0x2dc8000d,
+	0xb0d00005,
+	0x8de00004,
+	0x8dd00000,
+	0x8ce00002,
+	0x2dda000c,
+	0xb0dfffe8,
+	0x8de00003,
+	0x8dd00000,
+	0x8ce00004,
+	0x8cc00000,
+	0x01d2000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee3000b,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x87e0000c,
+	0x86e0000b,
+	0x0d010007,
+	0x0c010006,
+	0x2dd9000c,
+	0xb0d00003,
+	0x8de0000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x81e0000b,
+	0x40000742,
+	0x0d010006,
+	0x9de0000a,
+	0x0c010007,
+	0x2dd5000c,
+	0xb0d00015,
+	0x8de0000a,
+	0x0dd3000c,
+	0x0d01000d,
+	0x8ce0000d,
+	0x0c01000c,
+	0x2dd6000c,
+	0xb0d0000e,
+	0x8de0000d,
+	0x1c010001,
+	0x0dd3000c,
+	0x0501000d,
+	0x4000071d,
+	0x0d510006,
+	0x0c510007,
+	0x8cc00000,
+	0x9cd00000,
+	0x15520001,
+	0x2d560000,
+	0xb0dffff9,
+	0x81e0000b,
+	0x40000742,
+	0x0d010007,
+	0x9de00009,
+	0x0c010006,
+	0x2dd5000c,
+	0xb0d00014,
+	0x8de00009,
+	0x0dd3000c,
+	0x0d01000d,
+	0x8ce0000d,
+	0x0c01000c,
+	0x2dd6000c,
+	0xb0d0000d,
+	0x05010000,
+	0x40000735,
+	0x0d510006,
+	0x0c510007,
+	0x8cc00000,
+	0x9cd00000,
+	0x1d010001,
+	0x0551000d,
+	0x8de0000d,
+	0x2d51000d,
+	0xb0dffff7,
+	0x81e0000b,
+	0x40000742,
+	0x8de0000b,
+	0x9de00000,
+	0x8de0000c,
+	0x9de00001,
+	0x8de0000d,
+	0x9de00002,
+	0x600007ec,
+	0x81e0000b,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000b,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d00074a,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x40000758,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x8100074a,
+	0x40000760,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x600007ea,
+	0x0d010001,
+	0x9d00074a,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00002,
+	0x9de00003,
+	0x9fe00004,
+	0x07010000,
+	0x4000077b,
+	0x8de00006,
+	0x9de00000,
+	0x8de00005,
+	0x8dd00000,
+	0x9de00001,
+	0x6000055e,
+	0x0d010001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x01010007,
+	0x40000780,
+	0x8de00005,
+	0x1dd10001,
+	0x9de00005,
+	0x1d010001,
+	0x0771000d,
+	0x8de00005,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dfffeb,
+	0x01010007,
+	0x87e00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x40000798,
+	0x8de00004,
+	0x8dd00000,
+	0x8ce00005,
+	0x8cc00000,
+	0x2dd8000c,
+	0xb0d00002,
+	0x01010000,
+	0x400007ab,
+	0x8de00004,
+	0x1dd10001,
+	0x9de00004,
+	0x8de00005,
+	0x1dd10001,
+	0x9de00005,
+	0x0d010000,
+	0x9de00003,
+	0x8ce00004,
+	0x8cc00000,
+	0x2dc8000d,
+	0xb0d00005,
+	0x8de00005,
+	0x8dd00000,
+	0x8ce00003,
+	0x2dda000c,
+	0xb0dfffe7,
+	0x8de00005,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0d00002,
+	0x17010001,
+	0x400007aa,
+	0x07010000,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30007,
+	0x96e00002,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x87e00007,
+	0x86e00008,
+	0x400007c7,
+	0x8d700000,
+	0x8c600000,
+	0x2dda000c,
+	0xb0d00009,
+	0x97e00000,
+	0x96e00001,
+	0x60000785,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00003,
+	0x0d010007,
+	0x0101000d,
+	0x400007cb,
+	0x17710001,
+	0x8d700000,
+	0x2dda0000,
+	0xb0dfffef,
+	0x01010000,
+	0x86e00002,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00003,
+	0x9de00002,
+	0x400007db,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00003,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffff9,
+	0x8de00003,
+	0x0d01000d,
+	0x8ce00002,
+	0x0c01000c,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0101000d,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30004,
+	0x96e00000,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00004,
+	0x86e00005,
+	0x8de00006,
+	0x2dd90000,
+	0xb0d00011,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x40000801,
+	0x0d010007,
+	0x17d10001,
+	0x0c010006,
+	0x16c10001,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00006,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de00006,
+	0x2ddb0000,
+	0xb0dffff4,
+	0x81e00004,
+	0x86e00000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x07010000,
+	0x40000817,
+	0x1d010001,
+	0x0771000d,
+	0x8de00007,
+	0x9de00006,
+	0x8cd00000,
+	0x2dc80000,
+	0xb0d0000d,
+	0x8de00008,
+	0x9de00000,
+	0x8de00006,
+	0x1dd10001,
+	0x9de00007,
+	0x8de00006,
+	0x8dd00000,
+	0x9de00001,
+	0x6000055e,
+	0x0d010001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dfffec,
+	0x01010007,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee3000b,
+	0x9be00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de0000b,
+	0x8dd00002,
+	0x1ddb0010,
+	0x2dd80000,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x4000087f,
+	0x8de0000b,
+	0x8dd00004,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00009,
+	0x1d0101f4,
+	0x9de00000,
+	0x600005eb,
+	0x0d010001,
+	0x8ce0000b,
+	0x9dc00004,
+	0x8de0000b,
+	0x1c0101f4,
+	0x9cd00003,
+	0x8de0000b,
+	0x8cd00000,
+	0x8dd00004,
+	0x0dc1000d,
+	0x9de0000a,
+	0x8de0000b,
+	0x8dd00005,
+	0x0d01000d,
+	0x9de00008,
+	0x2dd90000,
+	0xb0d00005,
+	0x8de0000a,
+	0x0d01000d,
+	0x8ce00008,
+	0x2dc1000d,
+	0xb0d0001d,
+	0x1d010017,
+	0x9de00000,
+	0x8de0000b,
+	0x8cd00001,
+	0x9ce00001,
+	0x8cd00004,
+	0x9ce00002,
+	0x8dd00003,
+	0x9de00003,
+	0x600007ea,
+	0x0d010001,
+	0x9de00009,
+	0x8de00009,
+	0x2dd20000,
+	0xb0d00008,
+	0x8de0000b,
+	0x1dd10002,
+	0x8cd00000,
+	0x1ccd0010,
+	0x9cd00000,
+	0x310effff,
+	0x111dffff,
+	0x4000087f,
+	0x8de0000b,
+	0x8ce00009,
+	0x9cd00000,
+	0x8de0000b,
+	0x8cd00004,
+	0x9cd00005,
+	0x8de0000b,
+	0x1dd10005,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8dc00000,
+	0x0101000d,
+	0x8be00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1000b,
+	0x50f00000,
+	0x1ee30012,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x8de00012,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00005,
+	0xcd001232,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x4000091a,
+	0x8de00012,
+	0x9de0000b,
+	0x1d010001,
+	0x9de0000c,
+	0x90e00011,
+	0x1d010009,
+	0x9de0000e,
+	0x0d010000,
+	0x9de00010,
+	0x9de0000f,
+	0x1de1000e,
+	0x9de0000d,
+	0x1de1000b,
+	0x9de00000,
+	0x1d01007b,
+	0x9de00001,
+	0x60000cce,
+	0x1de1000b,
+	0x9de00000,
+	0x90e00001,
+	0x1de1000a,
+	0x9de00002,
+	0x60000922,
+	0x0d010001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x4000091a,
+	0x8de00011,
+	0x3dd07fff,
+	0xb0d00005,
+	0xcd001223,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x4000091a,
+	0x8de00011,
+	0x0d01000d,
+	0x1c010019,
+	0x0dd1000c,
+	0x9de00000,
+	0x600005eb,
+	0x0d010001,
+	0x0601000d,
+	0x0d010006,
+	0x2ddb0000,
+	0xb0d00005,
+	0xcd001216,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x4000091a,
+	0x8de00012,
+	0x9de0000b,
+	0x1d010001,
+	0x9de0000c,
+	0x1d610018,
+	0x9de0000d,
+	0x1de1000b,
+	0x9de00000,
+	0x1d01007b,
+	0x9de00001,
+	0x60000cce,
+	0x1de1000b,
+	0x9de00000,
+	0x90e00001,
+	0x1de1000a,
+	0x9de00002,
+	0x60000922,
+	0x0d010001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x4000091a,
+	0x90600014,
+	0x90600015,
+	0x90600016,
+	0x90600017,
+	0x17610019,
+	0x97e00000,
+	0x60000f99,
+	0x0d010001,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0d0002d,
+	0x17710003,
+	0x8d700000,
+	0x3dda0008,
+	0xb0d00003,
+	0x8d700003,
+	0x9d600014,
+	0x400008f8,
+	0x8d700000,
+	0x3dda0001,
+	0xb0d00002,
+	0x1d010001,
+	0x9d600015,
+	0x8de0000a,
+	0x1ddb0004,
+	0x2dd80000,
+	0xb0d0001d,
+	0x90e00009,
+	0x05010000,
+	0x40000912,
+	0x8d700000,
+	0x3dda0008,
+	0xb0d0000c,
+	0x1d710003,
+	0x9de00000,
+	0x600007d2,
+	0x0d010001,
+	0x2dd10005,
+	0xb0d00006,
+	0x1d710003,
+	0x9de00009,
+	0x9de00000,
+	0x600007d2,
+	0x0d010001,
+	0x0501000d,
+	0x97e00000,
+	0x60000f99,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0dfffea,
+	0x8de00009,
+	0x9d600016,
+	0x0d010005,
+	0x9d600017,
+	0x01010006,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10012,
+	0x50f00000,
+	0x1ee3000e,
+	0x93e00003,
+	0x94e00004,
+	0x95e00005,
+	0x96e00006,
+	0x97e00007,
+	0x9be00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x04010000,
+	0x8de00010,
+	0x1c010001,
+	0x9cd00000,
+	0x8de0000f,
+	0x2dd80000,
+	0xb0d00016,
+	0x8de0000e,
+	0x8dd00001,
+	0x3dd0000a,
+	0xb0d00005,
+	0xcd00120a,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x400009e3,
+	0x8de0000e,
+	0x1dd10001,
+	0x84d00000,
+	0x8cd00000,
+	0x1cc00001,
+	0x9cd00000,
+	0x8de0000e,
+	0x9de00000,
+	0x1d400014,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x0601000d,
+	0x8de0000e,
+	0x9de00000,
+	0x1de1000d,
+	0x9de00001,
+	0x600009ee,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x400009e3,
+	0x8de0000f,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de0000e,
+	0x9de00000,
+	0x96e00001,
+	0x97e00002,
+	0x60000d20,
+	0x4000095f,
+	0x06010007,
+	0x8de00010,
+	0x8cd00000,
+	0x8be0000d,
+	0x0b03000b,
+	0x1bb30001,
+	0x1bbb0001,
+	0x0b03000b,
+	0x1bb30001,
+	0x0ccb000b,
+	0x9cd00000,
+	0x8de00010,
+	0x8cd00000,
+	0x8be0000d,
+	0x1bbb0004,
+	0x0ccd000b,
+	0x9cd00000,
+	0x40000995,
+	0x8de0000e,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x8de0000e,
+	0x9de00000,
+	0x1de1000d,
+	0x9de00001,
+	0x600009ee,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x400009e3,
+	0x8de0000e,
+	0x9de00000,
+	0x96e00001,
+	0x97e00002,
+	0x60000d20,
+	0x8de00010,
+	0x8cd00000,
+	0x8be0000d,
+	0x0b03000b,
+	0x1bb30001,
+	0x1bbb0001,
+	0x0b03000b,
+	0x1bb30001,
+	0x0ccb000b,
+	0x9cd00000,
+	0x8de00010,
+	0x8cd00000,
+	0x8be0000d,
+	0x1bbb0004,
+	0x0ccd000b,
+	0x9cd00000,
+	0x8de0000e,
+	0x8dd00000,
+	0x8dd00000,
+	0x3dd8007c,
+	0xb0dfffd6,
+	0x8de0000e,
+	0x9de00000,
+	0x8de0000f,
+	0x2dd80000,
+	0xb0d00002,
+	0x1340001e,
+	0x400009a2,
+	0x03010000,
+	0x93e00001,
+	0x60000ca5,
+	0x0d010001,
+	0x0501000d,
+	0x8de0000e,
+	0x9de00000,
+	0x96e00001,
+	0x95e00002,
+	0x60000d20,
+	0x07010006,
+	0x400009b6,
+	0x8de0000e,
+	0x9de00000,
+	0x97e00001,
+	0x95e00002,
+	0x60000d57,
+	0x97e00000,
+	0x60000f99,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0dffff4,
+	0x8de0000f,
+	0x2dd80000,
+	0xb0d0000c,
+	0x8de0000e,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8dc00000,
+	0x3dd80029,
+	0xb0d00005,
+	0xcd0011fa,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x400009e3,
+	0x0d010000,
+	0x9de0000c,
+	0x8ce0000f,
+	0x2dca000d,
+	0xb0d00015,
+	0x8de0000e,
+	0x8dd00000,
+	0x8dd00000,
+	0x8ce0000c,
+	0x2dd8000c,
+	0xb0d0000f,
+	0x8de0000e,
+	0x8dd00000,
+	0x8dd00000,
+	0x3dda0029,
+	0xb0d00005,
+	0xcd0011ed,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x400009e3,
+	0xcd0011d1,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x400009e3,
+	0x01010006,
+	0x83e00003,
+	0x84e00004,
+	0x85e00005,
+	0x86e00006,
+	0x87e00007,
+	0x8be00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee1000e,
+	0x50f00000,
+	0x1ee3000c,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9be00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x90e0000b,
+	0x8de0000d,
+	0x90d00000,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010006,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de0000a,
+	0x05010000,
+	0x40000a24,
+	0x8de0000c,
+	0x9de00000,
+	0x1de1000b,
+	0x9de00001,
+	0x60000a40,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000a37,
+	0x8de0000d,
+	0x8cd00000,
+	0x8be0000b,
+	0x1bbb0001,
+	0x0ccd000b,
+	0x9cd00000,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0d00007,
+	0x8de0000d,
+	0x8cd00000,
+	0x8be0000b,
+	0x1bbb0004,
+	0x0ccd000b,
+	0x9cd00000,
+	0x40000a23,
+	0x8de0000c,
+	0x9de00000,
+	0x95e00001,
+	0x97e00002,
+	0x60000d20,
+	0x05010007,
+	0x8de0000c,
+	0x8dd00000,
+	0x8dd00000,
+	0x0601000d,
+	0x2dd80000,
+	0xb0d00004,
+	0x3d68007c,
+	0xb0d00002,
+	0x3d6a0029,
+	0xb0dfffd4,
+	0x0d010005,
+	0x2ddb0000,
+	0xb0d00005,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010009,
+	0x9de00001,
+	0x60000ca5,
+	0x81e0000a,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8be00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1000c,
+	0x50f00000,
+	0x1ee3000c,
+	0x96e00003,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de0000c,
+	0x9de00000,
+	0x1de1000b,
+	0x9de00001,
+	0x60000b3f,
+	0x0d010001,
+	0x0601000d,
+	0x0d010006,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000b38,
+	0x8de0000c,
+	0x8dd00000,
+	0x87d00000,
+	0x3d78002a,
+	0xb0d00009,
+	0x3d78002b,
+	0xb0d00007,
+	0x3d78003f,
+	0xb0d00005,
+	0x8de0000d,
+	0x8ce0000b,
+	0x9cd00000,
+	0x01010006,
+	0x40000b38,
+	0x8de0000b,
+	0x1ddb0001,
+	0x2dda0000,
+	0xb0d00007,
+	0x3d78003f,
+	0xb0d00005,
+	0xcd0011b7,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000b38,
+	0x1d01002a,
+	0x9de00009,
+	0x2d78000d,
+	0xb0d00008,
+	0x3d78002b,
+	0xb0d0000a,
+	0x8de00009,
+	0x2d70000d,
+	0xb0d0000d,
+	0x3d78003f,
+	0xb0d00009,
+	0x40000a81,
+	0x8de0000d,
+	0x1c010004,
+	0x9cd00000,
+	0x40000a81,
+	0x8de0000d,
+	0x1c010005,
+	0x9cd00000,
+	0x40000a81,
+	0x8de0000d,
+	0x90d00000,
+	0x3d7a002a,
+	0xb0d0000b,
+	0x8de0000b,
+	0x1ddb0002,
+	0x2dd80000,
+	0xb0d00007,
+	0x8de0000c,
+	0x9de00000,
+	0x1d01000a,
+	0x9de00001,
+	0x96e00002,
+	0x60000ceb,
+	0x40000b22,
+	0x3d7a002a,
+	0xb0d0002d,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010006,
+	0x9de00001,
+	0x96e00002,
+	0x60000ceb,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010007,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x8ce0000c,
+	0x9ce00000,
+	0x96e00001,
+	0x9de00002,
+	0x60000d57,
+	0x8de0000c,
+	0x9de00000,
+	0x96e00001,
+	0x96e00002,
+	0x60000d57,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010006,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x8ce0000c,
+	0x9ce00000,
+	0x96e00001,
+	0x9de00002,
+	0x60000d20,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010009,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x8ce0000c,
+	0x9ce00000,
+	0x96e00001,
+	0x9de00002,
+	0x60000d20,
+	0x40000b22,
+	0x3d7a002b,
+	0xb0d0000b,
+	0x8de0000b,
+	0x1ddb0002,
+	0x2dd80000,
+	0xb0d00007,
+	0x8de0000c,
+	0x9de00000,
+	0x1d01000b,
+	0x9de00001,
+	0x96e00002,
+	0x60000ceb,
+	0x40000b22,
+	0x3d7a002b,
+	0xb0d00030,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010006,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de0000a,
+	0x8de0000c,
+	0x9de00000,
+	0x96e00001,
+	0x8de0000a,
+	0x9de00002,
+	0x60000d20,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010007,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x8ce0000c,
+	0x9ce00000,
+	0x9de00001,
+	0x96e00002,
+	0x60000d20,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010006,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x8ce0000c,
+	0x9ce00000,
+	0x8ce0000a,
+	0x9ce00001,
+	0x9de00002,
+	0x60000d20,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010009,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x8ce0000c,
+	0x9ce00000,
+	0x96e00001,
+	0x9de00002,
+	0x60000d20,
+	0x40000b22,
+	0x3d7a003f,
+	0xb0d00024,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010006,
+	0x9de00001,
+	0x96e00002,
+	0x60000ceb,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010006,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x8ce0000c,
+	0x9ce00000,
+	0x96e00001,
+	0x9de00002,
+	0x60000d20,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010009,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de0000a,
+	0x8de0000c,
+	0x9de00000,
+	0x96e00001,
+	0x8de0000a,
+	0x9de00002,
+	0x60000d20,
+	0x8de0000c,
+	0x9de00000,
+	0x96e00001,
+	0x8de0000a,
+	0x9de00002,
+	0x60000d57,
+	0x8de0000c,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x8de0000c,
+	0x8dd00000,
+	0x8dd00000,
+	0x9de00008,
+	0x3dd8002a,
+	0xb0d00006,
+	0x8de00008,
+	0x3dd8002b,
+	0xb0d00003,
+	0x8de00008,
+	0x3dda003f,
+	0xb0d00005,
+	0xcd0011ac,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000b38,
+	0x01010006,
+	0x86e00003,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1000c,
+	0x50f00000,
+	0x1ee30013,
+	0x94e00003,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9be00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x8de00014,
+	0x90d00000,
+	0x8de00013,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x87c00000,
+	0x1d01003f,
+	0x9de00010,
+	0x2d78000d,
+	0xb0d000cb,
+	0x8de00010,
+	0x2d72000d,
+	0xb0d0000d,
+	0x0d010000,
+	0x9de0000f,
+	0x2d78000d,
+	0xb0d000bf,
+	0x8de0000f,
+	0x2d70000d,
+	0xb0d000e8,
+	0x3d700024,
+	0xb0d000e6,
+	0x3d72002e,
+	0xb0d000e4,
+	0x8d701057,
+	0x50d00000,
+	0x1d01005b,
+	0x9de0000e,
+	0x2d78000d,
+	0xb0d00026,
+	0x3d78005c,
+	0xb0d000ba,
+	0x3d78005e,
+	0xb0d00006,
+	0x8de0000e,
+	0x2d70000d,
+	0xb0d000d7,
+	0x3d78007c,
+	0xb0d000a9,
+	0x40000c45,
+	0x8de00013,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de00012,
+	0x40000c9a,
+	0x8de00013,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de00012,
+	0x40000c9a,
+	0x8de00013,
+	0x9de00000,
+	0x1d010003,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de00012,
+	0x8de00014,
+	0x8cd00000,
+	0x1ccd0003,
+	0x9cd00000,
+	0x40000c9a,
+	0x8de00013,
+	0x8dd00000,
+	0x8dd00000,
+	0x3dda005e,
+	0xb0d0000c,
+	0x8de00013,
+	0x9de00000,
+	0x1d010005,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de00012,
+	0x8de00013,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x40000ba5,
+	0x8de00013,
+	0x9de00000,
+	0x1d010004,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de00012,
+	0x8de00013,
+	0x8dd00000,
+	0x8dd00000,
+	0x0501000d,
+	0x3dd8005d,
+	0xb0d00002,
+	0x3d5a002d,
+	0xb0d0003c,
+	0x8de00013,
+	0x9de00000,
+	0x95e00001,
+	0x60000cce,
+	0x8de00013,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x40000be9,
+	0x3d58002d,
+	0xb0d00005,
+	0x8de00013,
+	0x9de00000,
+	0x95e00001,
+	0x60000cce,
+	0x40000be9,
+	0x8de00013,
+	0x8dd00000,
+	0x8dd00000,
+	0x0501000d,
+	0x3dd8005d,
+	0xb0d00002,
+	0x2d5a0000,
+	0xb0d00006,
+	0x8de00013,
+	0x9de00000,
+	0x1d01002d,
+	0x9de00001,
+	0x60000cce,
+	0x40000be9,
+	0x8de00013,
+	0x8dd00000,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x0dd1000c,
+	0x8dd00000,
+	0x0d01000d,
+	0x0601000d,
+	0x0d010005,
+	0x0401000d,
+	0x2d640004,
+	0xb0d00005,
+	0xcd00119b,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000c9b,
+	0x16600001,
+	0x40000be3,
+	0x8de00013,
+	0x9de00000,
+	0x96e00001,
+	0x60000cce,
+	0x16600001,
+	0x2d640004,
+	0xb0dffff9,
+	0x8de00013,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x8de00013,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8dc00000,
+	0x0501000d,
+	0x2dd80000,
+	0xb0d00002,
+	0x3d5a005d,
+	0xb0dfffc3,
+	0x8de00013,
+	0x9de00000,
+	0x90e00001,
+	0x60000cce,
+	0x3d58005d,
+	0xb0d00005,
+	0xcd00118e,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000c9b,
+	0x8de00014,
+	0x8cd00000,
+	0x1ccd0003,
+	0x9cd00000,
+	0x40000c9a,
+	0x8de00013,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x1de10011,
+	0x9de00002,
+	0x60000922,
+	0x0d010001,
+	0x9de00012,
+	0x8de00012,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000c9b,
+	0x8de00014,
+	0x8cd00000,
+	0x8be00011,
+	0x1bbb0005,
+	0x0ccd000b,
+	0x9cd00000,
+	0x40000c9a,
+	0xcd00116e,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000c9b,
+	0xcd00115a,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000c9b,
+	0x8de00013,
+	0x8dd00000,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0d00005,
+	0xcd00114f,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000c9b,
+	0x8de00013,
+	0x9de00000,
+	0x1d010008,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de00012,
+	0x8de00013,
+	0x9de00000,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8dc00000,
+	0x9de00001,
+	0x60000cce,
+	0x8de00013,
+	0x9de00000,
+	0x90e00001,
+	0x60000cce,
+	0x8de00014,
+	0x8cd00000,
+	0x1ccd0003,
+	0x9cd00000,
+	0x40000c9a,
+	0x8de00013,
+	0x8cd00000,
+	0x3b0effff,
+	0x1bbdffff,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00013,
+	0x8dd00000,
+	0x9de00000,
+	0xcd001143,
+	0x9de00001,
+	0x60000764,
+	0x0d010001,
+	0x9de0000d,
+	0x8de0000d,
+	0x2ddb0000,
+	0xb0d00005,
+	0xcd001129,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000c9b,
+	0x8de0000d,
+	0x8ce00013,
+	0x8cc00000,
+	0x0dd1000c,
+	0x8dd00000,
+	0x9de0000c,
+	0x8de0000d,
+	0x1c010001,
+	0x2dd5000c,
+	0xb0d0000e,
+	0x8de0000c,
+	0x9de0000b,
+	0x3dd8002a,
+	0xb0d00006,
+	0x8de0000b,
+	0x3dd8002b,
+	0xb0d00003,
+	0x8de0000b,
+	0x3dda003f,
+	0xb0d00004,
+	0x8de0000d,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de0000d,
+	0x8de00014,
+	0x8cd00000,
+	0x1ccd0001,
+	0x9cd00000,
+	0x8de0000d,
+	0x1c010001,
+	0x2ddb000c,
+	0xb0d00004,
+	0x8de00014,
+	0x8cd00000,
+	0x1ccd0002,
+	0x9cd00000,
+	0x8de00013,
+	0x9de00000,
+	0x1d010008,
+	0x9de00001,
+	0x60000ca5,
+	0x0d010001,
+	0x9de00012,
+	0x40000c93,
+	0x8de00013,
+	0x9de00000,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8dc00000,
+	0x9de00001,
+	0x60000cce,
+	0x8de0000d,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de0000d,
+	0x8de0000d,
+	0x2ddb0000,
+	0xb0dffff1,
+	0x8de00013,
+	0x9de00000,
+	0x90e00001,
+	0x60000cce,
+	0x81e00012,
+	0x84e00003,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8be00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee10013,
+	0x50f00000,
+	0x1ee30004,
+	0x96e00000,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00004,
+	0x86d00002,
+	0x8de00004,
+	0x8cd00002,
+	0x0c01000c,
+	0x1dd10003,
+	0x0d01000d,
+	0x2dcb000d,
+	0xb0d00007,
+	0x8de00004,
+	0x1dd10006,
+	0x8cd00000,
+	0x1cc00003,
+	0x9cd00000,
+	0x01010006,
+	0x40000cc8,
+	0x07010006,
+	0x0d010007,
+	0x17d10001,
+	0x8ce00005,
+	0x9cd00000,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x8de00004,
+	0x97d00002,
+	0x01010006,
+	0x86e00000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30003,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00003,
+	0x8cd00002,
+	0x0c01000c,
+	0x1dd10003,
+	0x0d01000d,
+	0x2dc9000d,
+	0xb0d00008,
+	0x8de00003,
+	0x1dd10002,
+	0x8cd00000,
+	0x1bc10001,
+	0x9bd00000,
+	0x8de00004,
+	0x9dc00000,
+	0x40000ce6,
+	0x8de00003,
+	0x1dd10006,
+	0x8cd00000,
+	0x1cc00001,
+	0x9cd00000,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00007,
+	0x8cd00002,
+	0x0c01000c,
+	0x1dd10003,
+	0x0d01000d,
+	0x2dcb000d,
+	0xb0d00006,
+	0x8de00007,
+	0x1dd10006,
+	0x8cd00000,
+	0x1cc00003,
+	0x9cd00000,
+	0x40000d1a,
+	0x8de00009,
+	0x1cd10003,
+	0x9ce00000,
+	0x9de00001,
+	0x8ce00007,
+	0x8cc00002,
+	0x0c01000c,
+	0x0d01000d,
+	0x0dc3000d,
+	0x0d01000d,
+	0x0d01000d,
+	0x9de00002,
+	0x600006f5,
+	0x8de00007,
+	0x1dd10002,
+	0x8cd00000,
+	0x1cc10003,
+	0x9cd00000,
+	0x87e00009,
+	0x0d010007,
+	0x17d10001,
+	0x8ce00008,
+	0x9cd00000,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x0d010007,
+	0x17d10001,
+	0x90d00000,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30008,
+	0x94e00001,
+	0x95e00002,
+	0x96e00003,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de00008,
+	0x8cd00002,
+	0x0c01000c,
+	0x1dd10003,
+	0x0d01000d,
+	0x2dcb000d,
+	0xb0d00001,
+	0x40000d4e,
+	0x87e00009,
+	0x40000d33,
+	0x07010006,
+	0x97e00000,
+	0x60000f99,
+	0x0d010001,
+	0x0601000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dffff8,
+	0x8d700000,
+	0x3dda0007,
+	0xb0d00006,
+	0x0d010007,
+	0x8ce0000a,
+	0x0c01000c,
+	0x0dd3000c,
+	0x0401000d,
+	0x40000d48,
+	0x8de0000a,
+	0x0d01000d,
+	0x0c010007,
+	0x0dd3000c,
+	0x0401000d,
+	0x05010004,
+	0x1d5e0008,
+	0x1ddb007f,
+	0x9d700001,
+	0x1d5b00ff,
+	0x9d700002,
+	0x84e00001,
+	0x85e00002,
+	0x86e00003,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00006,
+	0x8cd00002,
+	0x0c01000c,
+	0x1dd10003,
+	0x0d01000d,
+	0x2dc9000d,
+	0xb0d00004,
+	0x8de00007,
+	0x8dd00000,
+	0x3dd80006,
+	0xb0d00001,
+	0x40000d6f,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x1dd10003,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x60000d20,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000e,
+	0x96e00003,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x86e0000f,
+	0x0d010000,
+	0x9de00009,
+	0x8ce0000e,
+	0x0c01000c,
+	0x2dc9000d,
+	0xb0d00004,
+	0x0d010006,
+	0x8ce00009,
+	0x2ddb000c,
+	0xb0d00005,
+	0xcd001110,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000de8,
+	0x8de0000e,
+	0x8dd00018,
+	0x0d01000d,
+	0x0d01000d,
+	0x3dd8007b,
+	0xb0d00005,
+	0xcd0010ff,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000de8,
+	0x8de0000e,
+	0x8dd00016,
+	0x9de00008,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d0000a,
+	0x96e00000,
+	0x8de00008,
+	0x9de00001,
+	0x600007b0,
+	0x0d010001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000de8,
+	0x96e0000b,
+	0x8de0000e,
+	0x9de0000c,
+	0x8de0000e,
+	0x1dd1000a,
+	0x9de0000d,
+	0x8de0000e,
+	0x8dd00015,
+	0x2dd80000,
+	0xb0d00009,
+	0x1de1000a,
+	0x9de00000,
+	0x8de0000e,
+	0x9de00001,
+	0x96e00002,
+	0x60000def,
+	0x0d010001,
+	0x0101000d,
+	0x40000de8,
+	0x8de0000e,
+	0x8dd00014,
+	0x2dd80000,
+	0xb0d0001a,
+	0x07010006,
+	0x40000dd1,
+	0x1de1000a,
+	0x9de00000,
+	0x8de0000e,
+	0x9de00001,
+	0x97e00002,
+	0x60000def,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00002,
+	0x11010001,
+	0x40000de8,
+	0x1d710001,
+	0x9de00000,
+	0x8de0000e,
+	0x8dd00014,
+	0x9de00001,
+	0x6000055e,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0dfffea,
+	0x01010000,
+	0x40000de8,
+	0x07010006,
+	0x40000dde,
+	0x8d700000,
+	0x2dda0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000de8,
+	0x17710001,
+	0x1de1000a,
+	0x9de00000,
+	0x8de0000e,
+	0x9de00001,
+	0x97e00002,
+	0x60000def,
+	0x0d010001,
+	0x2dd80000,
+	0xb0dffff1,
+	0x11010001,
+	0x86e00003,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee1000e,
+	0x50f00000,
+	0x1ee30008,
+	0x95e00002,
+	0x96e00003,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de00008,
+	0x8ce0000a,
+	0x9cd00000,
+	0x8de00009,
+	0x0601000d,
+	0x1c01000a,
+	0x15d1000a,
+	0x0701000c,
+	0x0d010006,
+	0x16d10001,
+	0x90d00000,
+	0x0d010005,
+	0x15d10001,
+	0x90d00000,
+	0x17720001,
+	0x2d720000,
+	0xb0dffff7,
+	0x8de00008,
+	0x9de00000,
+	0x8de00009,
+	0x1dd10019,
+	0x9de00001,
+	0x60000e22,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00009,
+	0x8de00009,
+	0x8ce0000a,
+	0x9cd00000,
+	0x8de00009,
+	0x8ce00008,
+	0x8cc00000,
+	0x9cd0000a,
+	0x11010001,
+	0x40000e1a,
+	0x01010000,
+	0x85e00002,
+	0x86e00003,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30011,
+	0x92e00002,
+	0x93e00003,
+	0x94e00004,
+	0x95e00005,
+	0x96e00006,
+	0x97e00007,
+	0x9be00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x87e00012,
+	0x40000f3e,
+	0x97e00000,
+	0x60000f99,
+	0x0d010001,
+	0x0601000d,
+	0x85700000,
+	0x2d500000,
+	0xb0d00102,
+	0x3d520027,
+	0xb0d00100,
+	0x8d501086,
+	0x50d00000,
+	0x8de00011,
+	0x8cd00000,
+	0x0c01000c,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dc9000d,
+	0xb0d000fc,
+	0x01010000,
+	0x40000f45,
+	0x8de00011,
+	0x8dd00000,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d000f5,
+	0x01010000,
+	0x40000f45,
+	0x8de00011,
+	0x8dd00000,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000f45,
+	0x8de00011,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x40000f3d,
+	0x14710003,
+	0x8d400000,
+	0x8ce00011,
+	0x8cc00000,
+	0x8cc00000,
+	0x2dd8000c,
+	0xb0d00002,
+	0x01010000,
+	0x40000f45,
+	0x8de00011,
+	0x8dd00000,
+	0x9de00000,
+	0x94e00001,
+	0x600007b0,
+	0x0d010001,
+	0x9de0000f,
+	0x8de0000f,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000f45,
+	0x94e00000,
+	0x600007d2,
+	0x0d010001,
+	0x9de00010,
+	0x8de00011,
+	0x8ce00010,
+	0x8bd00000,
+	0x0cc1000b,
+	0x9cd00000,
+	0x40000f3d,
+	0x8de00011,
+	0x8dd00000,
+	0x8dd00000,
+	0x9de00010,
+	0x2dd80000,
+	0xb0d00009,
+	0x1d710003,
+	0x9de00000,
+	0x8de00010,
+	0x9de00001,
+	0x6000055e,
+	0x0d010001,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000f45,
+	0x8de00011,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x40000f3d,
+	0x8de00011,
+	0x8dd00000,
+	0x8dd00000,
+	0x9de0000f,
+	0x2dd80000,
+	0xb0d00009,
+	0x1d710003,
+	0x9de00000,
+	0x8de0000f,
+	0x9de00001,
+	0x6000055e,
+	0x0d010001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x01010000,
+	0x40000f45,
+	0x8de00011,
+	0x8cd00000,
+	0x1cc10001,
+	0x9cd00000,
+	0x40000f3d,
+	0x8d700000,
+	0x1dd20014,
+	0x9de0000e,
+	0x8de00011,
+	0x8dd00000,
+	0x9de0000d,
+	0x8de00011,
+	0x9de00000,
+	0x96e00001,
+	0x60000e22,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00010,
+	0x8de0000e,
+	0x8ce00011,
+	0x8cc00002,
+	0x0dd1000c,
+	0x8dd00000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00006,
+	0x8de0000e,
+	0x8ce00011,
+	0x8cc00002,
+	0x0dd1000c,
+	0x8ce0000d,
+	0x9cd00000,
+	0x11010001,
+	0x40000f45,
+	0x01010000,
+	0x40000f45,
+	0x8d700000,
+	0x1dd2001e,
+	0x9de0000e,
+	0x8de00011,
+	0x8dd00000,
+	0x9de0000d,
+	0x8de00011,
+	0x9de00000,
+	0x96e00001,
+	0x60000e22,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00010,
+	0x8de0000e,
+	0x8ce00011,
+	0x8cc00003,
+	0x0dd1000c,
+	0x8dd00000,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00006,
+	0x8de0000e,
+	0x8ce00011,
+	0x8cc00003,
+	0x0dd1000c,
+	0x8ce0000d,
+	0x9cd00000,
+	0x11010001,
+	0x40000f45,
+	0x01010000,
+	0x40000f45,
+	0x8de00011,
+	0x84d00000,
+	0x8d600000,
+	0x3dd80006,
+	0xb0d00012,
+	0x16710003,
+	0x40000f3d,
+	0x8de00011,
+	0x9de00000,
+	0x1d710003,
+	0x9de00001,
+	0x60000e22,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00002,
+	0x11010001,
+	0x40000f45,
+	0x8de00011,
+	0x94d00000,
+	0x97e00000,
+	0x60000f99,
+	0x0d010001,
+	0x0701000d,
+	0x8d700000,
+	0x3dd80006,
+	0xb0dfffed,
+	0x01010000,
+	0x40000f45,
+	0x8d600000,
+	0x3dda0008,
+	0xb0d00003,
+	0x8d600003,
+	0x9de0000d,
+	0x40000f03,
+	0x90e0000d,
+	0x83e0000d,
+	0x8de00011,
+	0x82d00000,
+	0x8d700000,
+	0x3dda000a,
+	0xb0d00002,
+	0x90e0000c,
+	0x40000f0d,
+	0x1d010001,
+	0x9de0000c,
+	0x8de0000c,
+	0x0d01000d,
+	0x9de0000e,
+	0x8de00011,
+	0x9de00000,
+	0x1d710003,
+	0x9de00001,
+	0x60000f51,
+	0x0d010001,
+	0x1c010001,
+	0x04d1000c,
+	0x40000f31,
+	0x8de00011,
+	0x0c410002,
+	0x3b0effff,
+	0x1bbdffff,
+	0x0cc1000b,
+	0x9cd00000,
+	0x2d380000,
+	0xb0d00005,
+	0x8de00011,
+	0x8dd00000,
+	0x8dd00000,
+	0x2dda0003,
+	0xb0d00009,
+	0x8de00011,
+	0x9de00000,
+	0x96e00001,
+	0x60000e22,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00002,
+	0x11010001,
+	0x40000f45,
+	0x1d010001,
+	0x0443000d,
+	0x8de0000e,
+	0x2d43000d,
+	0xb0dfffe5,
+	0x01010000,
+	0x40000f45,
+	0x11010001,
+	0x40000f45,
+	0xcd0010ed,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x40000f45,
+	0x07010006,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0dffeee,
+	0xcd0010da,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x82e00002,
+	0x83e00003,
+	0x84e00004,
+	0x85e00005,
+	0x86e00006,
+	0x87e00007,
+	0x8be00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee10011,
+	0x50f00000,
+	0x1ee30009,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de0000a,
+	0x87d00000,
+	0x3d700003,
+	0xb0d00035,
+	0x3d720008,
+	0xb0d00033,
+	0x8d8010ab,
+	0x50d00000,
+	0x8de00009,
+	0x8dd00000,
+	0x9de00000,
+	0x600007d2,
+	0x0d010001,
+	0x0101000d,
+	0x40000f93,
+	0x8de0000a,
+	0x8dd00003,
+	0x9de00006,
+	0x90e00007,
+	0x8de00009,
+	0x8dd00000,
+	0x9de00008,
+	0x40000f74,
+	0x8de00007,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00007,
+	0x8de00008,
+	0x1dd10001,
+	0x9de00008,
+	0x8de00008,
+	0x8dd00000,
+	0x8ce00006,
+	0x2dd8000c,
+	0xb0dffff4,
+	0x81e00007,
+	0x40000f93,
+	0x8de00009,
+	0x8dd00000,
+	0x9de00000,
+	0x8de0000a,
+	0x1dd10003,
+	0x9de00001,
+	0x6000080e,
+	0x0d010001,
+	0x0101000d,
+	0x40000f93,
+	0x8de00009,
+	0x8dd00000,
+	0x9de00000,
+	0x8de0000a,
+	0x1dd10003,
+	0x9de00001,
+	0x60000764,
+	0x0d010001,
+	0x0101000d,
+	0x40000f93,
+	0xcd0010b4,
+	0x9de00000,
+	0x60000fb9,
+	0x01010000,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30004,
+	0x96e00000,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00004,
+	0x8cd00001,
+	0x1ccb007f,
+	0x1cca0008,
+	0x8dd00002,
+	0x1ddb00ff,
+	0x07c0000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000fb3,
+	0x8de00004,
+	0x8dd00000,
+	0x3dda0007,
+	0xb0d00003,
+	0x8de00004,
+	0x06d30007,
+	0x40000fb2,
+	0x8de00004,
+	0x0671000d,
+	0x01010006,
+	0x86e00000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8d000fda,
+	0x9de00000,
+	0xcd00124b,
+	0x9de00001,
+	0x8de00005,
+	0x9de00002,
+	0x60000fdf,
+	0x1d010002,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x90e00002,
+	0x600007ea,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x0000027a,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x600007ea,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000055,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000067,
+	0x00000072,
+	0x00000065,
+	0x00000070,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x00000076,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x0000006e,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x00000073,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x00000065,
+	0x00000020,
+	0x00000065,
+	0x00000078,
+	0x00000070,
+	0x00000072,
+	0x0000005d,
+	0x00000020,
+	0x00000065,
+	0x00000078,
+	0x00000070,
+	0x00000072,
+	0x00000065,
+	0x00000073,
+	0x00000073,
+	0x00000069,
+	0x0000006f,
+	0x0000006e,
+	0x00000020,
+	0x0000005b,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000020,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000064,
+	0x0000003a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000000,
+	0x00000073,
+	0x00000074,
+	0x00000064,
+	0x00000069,
+	0x0000006e,
+	0x00000000,
+	0x0000004c,
+	0x00000069,
+	0x0000006e,
+	0x00000065,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x0000006f,
+	0x00000020,
+	0x0000006c,
+	0x0000006f,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000043,
+	0x00000061,
+	0x0000006e,
+	0x00000027,
+	0x00000074,
+	0x00000020,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x0000006e,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x0000002d,
+	0x00000000,
+	0x00000067,
+	0x00000072,
+	0x00000065,
+	0x00000070,
+	0x0000003a,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000063,
+	0x0000006f,
+	0x0000006d,
+	0x00000070,
+	0x00000020,
+	0x00000066,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x00000b79,
+	0x00000c45,
+	0x00000c45,
+	0x00000c45,
+	0x00000c03,
+	0x00000c19,
+	0x00000c1e,
+	0x00000c1e,
+	0x00000c45,
+	0x00000c45,
+	0x00000b81,
+	0x00000f36,
+	0x00000e3a,
+	0x00000e43,
+	0x00000e4a,
+	0x00000e76,
+	0x00000e8c,
+	0x00000ee0,
+	0x00000f3d,
+	0x00000e56,
+	0x00000f3d,
+	0x00000efc,
+	0x00000efc,
+	0x00000f38,
+	0x00000f38,
+	0x00000f38,
+	0x00000f38,
+	0x00000f38,
+	0x00000f38,
+	0x00000f38,
+	0x00000f38,
+	0x00000f38,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000ea2,
+	0x00000f38,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000ec1,
+	0x00000f5e,
+	0x00000f7b,
+	0x00000f85,
+	0x00000f8f,
+	0x00000f8f,
+	0x00000f65,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x00000020,
+	0x00000065,
+	0x00000072,
+	0x00000072,
+	0x0000006f,
+	0x00000072,
+	0x0000003a,
+	0x00000020,
+	0x00000062,
+	0x00000061,
+	0x00000064,
+	0x00000020,
+	0x00000063,
+	0x00000061,
+	0x0000006c,
+	0x0000006c,
+	0x00000020,
+	0x0000006f,
+	0x00000066,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000072,
+	0x00000065,
+	0x00000070,
+	0x00000065,
+	0x00000061,
+	0x00000074,
+	0x00000000,
+	0x00000063,
+	0x0000006f,
+	0x00000072,
+	0x00000072,
+	0x00000075,
+	0x00000070,
+	0x00000074,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000070,
+	0x0000006f,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x00000073,
+	0x00000000,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000065,
+	0x00000078,
+	0x00000070,
+	0x00000020,
+	0x00000063,
+	0x0000006f,
+	0x00000072,
+	0x00000072,
+	0x00000075,
+	0x00000070,
+	0x00000074,
+	0x00000069,
+	0x0000006f,
+	0x0000006e,
+	0x00000000,
+	0x00000063,
+	0x0000006f,
+	0x00000072,
+	0x00000072,
+	0x00000075,
+	0x00000070,
+	0x00000074,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000065,
+	0x00000078,
+	0x00000070,
+	0x00000000,
+	0x0000004e,
+	0x00000055,
+	0x0000004c,
+	0x0000004c,
+	0x00000020,
+	0x00000061,
+	0x00000072,
+	0x00000067,
+	0x00000075,
+	0x0000006d,
+	0x00000065,
+	0x0000006e,
+	0x00000074,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000065,
+	0x00000078,
+	0x00000065,
+	0x00000063,
+	0x00000000,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x00000020,
+	0x00000065,
+	0x00000072,
+	0x00000072,
+	0x0000006f,
+	0x00000072,
+	0x0000003a,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000072,
+	0x00000063,
+	0x00000073,
+	0x00000070,
+	0x0000006e,
+	0x00000020,
+	0x00000030,
+	0x00000000,
+	0x0000005e,
+	0x00000024,
+	0x0000002e,
+	0x0000005b,
+	0x00000028,
+	0x00000029,
+	0x0000007c,
+	0x0000003f,
+	0x0000002b,
+	0x0000002a,
+	0x0000005c,
+	0x00000000,
+	0x00000074,
+	0x00000072,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x0000005c,
+	0x00000000,
+	0x0000003f,
+	0x0000002b,
+	0x0000002a,
+	0x00000020,
+	0x00000066,
+	0x0000006f,
+	0x0000006c,
+	0x0000006c,
+	0x0000006f,
+	0x00000077,
+	0x00000073,
+	0x00000020,
+	0x0000006e,
+	0x0000006f,
+	0x00000074,
+	0x00000068,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000000,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x00000020,
+	0x00000065,
+	0x00000072,
+	0x00000072,
+	0x0000006f,
+	0x00000072,
+	0x0000003a,
+	0x00000020,
+	0x0000005c,
+	0x00000030,
+	0x0000007c,
+	0x00000029,
+	0x00000020,
+	0x00000075,
+	0x0000006e,
+	0x00000065,
+	0x00000078,
+	0x00000070,
+	0x00000065,
+	0x00000063,
+	0x00000074,
+	0x00000065,
+	0x00000064,
+	0x00000000,
+	0x00000075,
+	0x0000006e,
+	0x0000006d,
+	0x00000061,
+	0x00000074,
+	0x00000063,
+	0x00000068,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x0000005b,
+	0x0000005d,
+	0x00000000,
+	0x00000069,
+	0x0000006e,
+	0x00000076,
+	0x00000061,
+	0x0000006c,
+	0x00000069,
+	0x00000064,
+	0x00000020,
+	0x0000005b,
+	0x0000005d,
+	0x00000020,
+	0x00000072,
+	0x00000061,
+	0x0000006e,
+	0x00000067,
+	0x00000065,
+	0x00000000,
+	0x0000006e,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x0000002a,
+	0x0000003f,
+	0x0000002b,
+	0x00000000,
+	0x0000002a,
+	0x0000002b,
+	0x00000020,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x00000072,
+	0x00000061,
+	0x0000006e,
+	0x00000064,
+	0x00000020,
+	0x00000063,
+	0x0000006f,
+	0x00000075,
+	0x0000006c,
+	0x00000064,
+	0x00000020,
+	0x00000062,
+	0x00000065,
+	0x00000020,
+	0x00000065,
+	0x0000006d,
+	0x00000070,
+	0x00000074,
+	0x00000079,
+	0x00000000,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x0000006e,
+	0x00000061,
+	0x0000006c,
+	0x00000020,
+	0x00000065,
+	0x00000072,
+	0x00000072,
+	0x0000006f,
+	0x00000072,
+	0x0000003a,
+	0x00000020,
+	0x0000006a,
+	0x00000075,
+	0x0000006e,
+	0x0000006b,
+	0x00000020,
+	0x0000006f,
+	0x0000006e,
+	0x00000020,
+	0x00000065,
+	0x0000006e,
+	0x00000064,
+	0x00000000,
+	0x00000075,
+	0x0000006e,
+	0x0000006d,
+	0x00000061,
+	0x00000074,
+	0x00000063,
+	0x00000068,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000028,
+	0x00000029,
+	0x00000000,
+	0x00000075,
+	0x0000006e,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x0000006d,
+	0x00000069,
+	0x0000006e,
+	0x00000061,
+	0x00000074,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000028,
+	0x00000029,
+	0x00000000,
+	0x00000074,
+	0x0000006f,
+	0x0000006f,
+	0x00000020,
+	0x0000006d,
+	0x00000061,
+	0x0000006e,
+	0x00000079,
+	0x00000020,
+	0x00000028,
+	0x00000029,
+	0x00000000,
+	0x0000006f,
+	0x00000075,
+	0x00000074,
+	0x00000020,
+	0x0000006f,
+	0x00000066,
+	0x00000020,
+	0x00000073,
+	0x00000070,
+	0x00000061,
+	0x00000063,
+	0x00000065,
+	0x00000000,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000065,
+	0x00000078,
+	0x00000070,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x0000006f,
+	0x00000020,
+	0x00000062,
+	0x00000069,
+	0x00000067,
+	0x00000000,
+	0x0000004e,
+	0x00000055,
+	0x0000004c,
+	0x0000004c,
+	0x00000020,
+	0x00000061,
+	0x00000072,
+	0x00000067,
+	0x00000075,
+	0x0000006d,
+	0x00000065,
+	0x0000006e,
+	0x00000074,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000063,
+	0x0000006f,
+	0x0000006d,
+	0x00000070,
+	0x00000000,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000065,
+	0x00000078,
+	0x00000070,
+	0x00000028,
+	0x00000033,
+	0x00000029,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x800000a0,
+	0x00000081,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x0000038c,
+	0x00000274,
+	0x00000118,
+	0x00000040,
+	0x1ee3001e,
+	0x94e00008,
+	0x95e00009,
+	0x96e0000a,
+	0x97e0000b,
+	0x9ce0000c,
+	0x9de0000d,
+	0x9fe0000e,
+	0x8de0001f,
+	0x86d00001,
+	0x8de0001e,
+	0x3dd80002,
+	0xb0d00002,
+	0x11010001,
+	0x4000043d,
+	0x1d010020,
+	0x9de00000,
+	0x96e00001,
+	0x1de10011,
+	0x9de00002,
+	0x6000049b,
+	0x0d010001,
+	0x9de00010,
+	0x8de00010,
+	0x2dd80000,
+	0xb0d00005,
+	0xcd0004d6,
+	0x9de00000,
+	0x60000446,
+	0x11010001,
+	0x4000043d,
+	0x8de00018,
+	0x0501000d,
+	0x1d010400,
+	0x0c56000d,
+	0x9ce0000f,
+	0x0758000d,
+	0x3d7003e8,
+	0xb0d00002,
+	0x140103e7,
+	0x4000042a,
+	0x04010007,
+	0x07010004,
+	0x1d010001,
+	0x9de00000,
+	0xcd00049d,
+	0x9de00001,
+	0x96e00002,
+	0x8de00012,
+	0x9de00003,
+	0x8de0000f,
+	0x9de00004,
+	0x97e00005,
+	0x8de0001a,
+	0x9de00006,
+	0x8de00013,
+	0x1c0101ff,
+	0x0ddb000c,
+	0x9de00007,
+	0x60000489,
+	0x01010000,
+	0x84e00008,
+	0x85e00009,
+	0x86e0000a,
+	0x87e0000b,
+	0x8ce0000c,
+	0x8de0000d,
+	0x8fe0000e,
+	0x1ee1001e,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000475,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000464,
+	0x0d010001,
+	0x8c000484,
+	0x9ce00000,
+	0xcc0004db,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000489,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0004e3,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x6000049b,
+	0xc10004e3,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000059,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x6000049b,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000046,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x0000004e,
+	0x00000075,
+	0x0000006d,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000053,
+	0x00000069,
+	0x0000007a,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000002e,
+	0x00000025,
+	0x0000002e,
+	0x00000033,
+	0x00000064,
+	0x0000004b,
+	0x00000042,
+	0x0000000a,
+	0x00000042,
+	0x0000006c,
+	0x0000006f,
+	0x00000063,
+	0x0000006b,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000041,
+	0x00000063,
+	0x00000063,
+	0x00000065,
+	0x00000073,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000030,
+	0x00000025,
+	0x0000006f,
+	0x0000000a,
+	0x00000000,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000074,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80000017,
+	0x0000005b,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x000001e8,
+	0x000001dc,
+	0x0000000c,
+	0x00000800,
+	0x1ee3000b,
+	0x94e00003,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x14010001,
+	0x8de0000b,
+	0x3dd60002,
+	0xb0d00002,
+	0x11010001,
+	0x40000448,
+	0xc500047a,
+	0x40000436,
+	0x8de0000c,
+	0x0d41000d,
+	0x86d00000,
+	0x3d440001,
+	0xb0d0001c,
+	0x0d010005,
+	0x15d10001,
+	0x1c010020,
+	0x9cd00000,
+	0x40000431,
+	0x87600000,
+	0x3d7a005c,
+	0xb0d00010,
+	0x1d610001,
+	0x0601000d,
+	0x87d00000,
+	0x1d01006e,
+	0x9de0000a,
+	0x2d78000d,
+	0xb0d00006,
+	0x8de0000a,
+	0x2d70000d,
+	0xb0d00006,
+	0x3d780074,
+	0xb0d00003,
+	0x4000042d,
+	0x1701000a,
+	0x4000042d,
+	0x17010009,
+	0x0d010005,
+	0x15d10001,
+	0x97d00000,
+	0x16610001,
+	0x8d600000,
+	0x2dda0000,
+	0xb0dfffe6,
+	0x90500000,
+	0x14400001,
+	0x8de0000b,
+	0x2d40000d,
+	0xb0dfffd7,
+	0x0d010005,
+	0x15d10001,
+	0x1c01000a,
+	0x9cd00000,
+	0x0d010005,
+	0x15d10001,
+	0x90d00000,
+	0x1d010001,
+	0x9de00000,
+	0xcd000477,
+	0x9de00001,
+	0xcd00047a,
+	0x9de00002,
+	0x60000463,
+	0x01010000,
+	0x84e00003,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1000b,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000016,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000475,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000025,
+	0x00000073,
+	0x80000080,
+	0x0000009a,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x00000364,
+	0x000002d0,
+	0x00000094,
+	0x00000040,
+	0x1ee30217,
+	0x96e00004,
+	0x97e00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x8de00218,
+	0x8dd00001,
+	0x9de00016,
+	0x8de00217,
+	0x3dd60002,
+	0xb0d00002,
+	0x06010000,
+	0x40000444,
+	0x1d010020,
+	0x9de00000,
+	0x8de00016,
+	0x9de00001,
+	0x1de10009,
+	0x9de00002,
+	0x6000048e,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00005,
+	0xcd0004cc,
+	0x9de00000,
+	0x6000045f,
+	0x11010001,
+	0x40000456,
+	0x8de0000b,
+	0x1c01f000,
+	0x0ddb000c,
+	0x1c014000,
+	0x2ddb000c,
+	0xb0d00009,
+	0x8d00049d,
+	0x9de00000,
+	0xcd0004b9,
+	0x9de00001,
+	0x8de00016,
+	0x9de00002,
+	0x600004a2,
+	0x11010001,
+	0x40000456,
+	0x1d010016,
+	0x9de00000,
+	0x90e00001,
+	0x8de00016,
+	0x9de00002,
+	0x6000048e,
+	0x0d010001,
+	0x0601000d,
+	0x2d660000,
+	0xb0d0000d,
+	0xcd0004cc,
+	0x9de00000,
+	0x6000045f,
+	0x11010001,
+	0x40000456,
+	0x1d010018,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x1de10017,
+	0x9de00002,
+	0x97e00003,
+	0x6000048e,
+	0x1d010017,
+	0x9de00000,
+	0x96e00001,
+	0x1de10017,
+	0x9de00002,
+	0x1d010200,
+	0x9de00003,
+	0x6000048e,
+	0x0d010001,
+	0x0701000d,
+	0x2dd20000,
+	0xb0dfffec,
+	0x2d760000,
+	0xb0d00003,
+	0xcd0004b4,
+	0x9de00000,
+	0x6000045f,
+	0x01010000,
+	0x86e00004,
+	0x87e00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10217,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x6000045d,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x6000047d,
+	0x0d010001,
+	0x8c00049d,
+	0x9ce00000,
+	0xcc0004d1,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x600004a2,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0004d9,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x6000048e,
+	0xc10004d9,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000036,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x6000048e,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000072,
+	0x00000065,
+	0x00000061,
+	0x00000064,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000069,
+	0x00000073,
+	0x00000020,
+	0x00000061,
+	0x00000020,
+	0x00000064,
+	0x00000069,
+	0x00000072,
+	0x00000065,
+	0x00000063,
+	0x00000074,
+	0x0000006f,
+	0x00000072,
+	0x00000079,
+	0x0000000a,
+	0x00000000,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x0000006e,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80000021,
+	0x00000005,
+	0x00000017,
+	0x00000000,
+	0x00000070,
+	0x00000077,
+	0x00000064,
+	0x8000001a,
+	0x00000005,
+	0x00000101,
+	0x00000018,
+	0x00000000,
+	0x00000064,
+	0x00000066,
+	0x8000001b,
+	0x00000005,
+	0x00000101,
+	0x00000019,
+	0x00000000,
+	0x00000064,
+	0x00000075,
+	0x8000001b,
+	0x00000005,
+	0x00000101,
+	0x0000001a,
+	0x00000000,
+	0x0000006c,
+	0x0000006e,
+	0x8000001b,
+	0x00000008,
+	0x00000101,
+	0x0000001b,
+	0x00000000,
+	0x00000073,
+	0x0000006e,
+	0x00000061,
+	0x0000006b,
+	0x00000065,
+	0x80000018,
+	0x00000007,
+	0x00000101,
+	0x0000001d,
+	0x00000000,
+	0x00000069,
+	0x0000006e,
+	0x00000069,
+	0x00000074,
+	0x80000019,
+	0x00000005,
+	0x00000101,
+	0x0000001e,
+	0x00000000,
+	0x00000063,
+	0x00000070,
+	0x8000001b,
+	0x00000005,
+	0x00000101,
+	0x0000001f,
+	0x00000000,
+	0x00000072,
+	0x0000006d,
+	0x8000001b,
+	0x0000002b,
+	0x00000101,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x00000120,
+	0x00000110,
+	0x00000010,
+	0x00000000,
+	0x1ee30086,
+	0x97e00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d010034,
+	0x9de00000,
+	0x1d010080,
+	0x9de00001,
+	0x1de10006,
+	0x9de00002,
+	0x6000041e,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x11010001,
+	0x40000419,
+	0x1d010001,
+	0x9de00000,
+	0xcd000444,
+	0x9de00001,
+	0x97e00002,
+	0x60000432,
+	0x01010000,
+	0x87e00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10086,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000015,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x6000041e,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x800000b2,
+	0x0000002f,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x000002a0,
+	0x00000124,
+	0x0000017c,
+	0x00000000,
+	0x1ee30011,
+	0x9de00006,
+	0x9fe00007,
+	0x1d010033,
+	0x9de00000,
+	0xcd0004a6,
+	0x9de00001,
+	0x1de10009,
+	0x9de00002,
+	0x60000423,
+	0x0d010001,
+	0x9de00008,
+	0x8de00008,
+	0x2dd80000,
+	0xb0d00002,
+	0x81e00008,
+	0x4000041f,
+	0x1d010001,
+	0x9de00000,
+	0xcd000449,
+	0x9de00001,
+	0x8de0000b,
+	0x9de00002,
+	0x8de0000c,
+	0x9de00003,
+	0x8de0000e,
+	0x9de00004,
+	0x8de0000f,
+	0x9de00005,
+	0x60000437,
+	0x01010000,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10011,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000070,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000423,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x0000000a,
+	0x00000046,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000053,
+	0x00000079,
+	0x00000073,
+	0x00000074,
+	0x00000065,
+	0x0000006d,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000074,
+	0x00000075,
+	0x00000073,
+	0x0000003a,
+	0x0000000a,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x00000062,
+	0x0000006c,
+	0x0000006f,
+	0x00000063,
+	0x0000006b,
+	0x00000073,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000074,
+	0x00000061,
+	0x0000006c,
+	0x0000002c,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x00000062,
+	0x0000006c,
+	0x0000006f,
+	0x00000063,
+	0x0000006b,
+	0x00000073,
+	0x00000020,
+	0x00000066,
+	0x00000072,
+	0x00000065,
+	0x00000065,
+	0x0000000a,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x0000006f,
+	0x00000064,
+	0x00000065,
+	0x00000073,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000074,
+	0x00000061,
+	0x0000006c,
+	0x0000002c,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x00000069,
+	0x0000006e,
+	0x0000006f,
+	0x00000064,
+	0x00000065,
+	0x00000073,
+	0x00000020,
+	0x00000066,
+	0x00000072,
+	0x00000065,
+	0x00000065,
+	0x0000002e,
+	0x00000020,
+	0x0000000a,
+	0x00000000,
+	0x0000002f,
+	0x80000052,
+	0x000001f9,
+	0x19960503,
+	0x0000059b,
+	0x00001000,
+	0x000012d4,
+	0x00001238,
+	0x0000009c,
+	0x00000044,
+	0x0000002f,
+	0x00000000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00006,
+	0x9de00000,
+	0x8de00005,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x600005c8,
+	0x8de00006,
+	0x9de00000,
+	0xcd000400,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x60000852,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x40000428,
+	0x8de00003,
+	0x8ce00004,
+	0x0dd6000c,
+	0x17d8000a,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x1c700030,
+	0x9cd00000,
+	0x8de00004,
+	0x1dd6000a,
+	0x9de00004,
+	0x8de00004,
+	0x2dda0000,
+	0xb0dffff1,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30009,
+	0x9be00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00009,
+	0x1c011000,
+	0x0bd6000c,
+	0x9be00008,
+	0x0dd8000c,
+	0x9de00007,
+	0x8de00008,
+	0x9de00000,
+	0x1d01000a,
+	0x9de00001,
+	0x8de0000a,
+	0x9de00002,
+	0x60000417,
+	0x8de0000a,
+	0x8dd00000,
+	0x3dda0030,
+	0xb0d00003,
+	0x8de0000a,
+	0x1c010020,
+	0x9cd00000,
+	0x8de0000a,
+	0x1dd10002,
+	0x9de0000a,
+	0x8de0000a,
+	0x1cd10001,
+	0x9ce0000a,
+	0x1c01002e,
+	0x9cd00000,
+	0x8de00007,
+	0x9de00000,
+	0x1d01000a,
+	0x9de00001,
+	0x8de0000a,
+	0x9de00002,
+	0x60000417,
+	0x8de0000a,
+	0x1dd10002,
+	0x9de0000a,
+	0x8de0000a,
+	0x90d00000,
+	0x8be00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30018,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9be00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x05010000,
+	0x8d0008b5,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x400004c2,
+	0x8d0008b5,
+	0x8dd00a84,
+	0x9de0000a,
+	0x2dd80000,
+	0xb0d00042,
+	0x1d010040,
+	0x9de00000,
+	0x8de0000a,
+	0x9de00001,
+	0x60000800,
+	0x0d010001,
+	0x2dd60000,
+	0xb0d0003a,
+	0xcd0008a1,
+	0x9de00000,
+	0x6000068e,
+	0x8d0008b5,
+	0x8cd00000,
+	0x9cd00001,
+	0x06010000,
+	0x40000497,
+	0x1d010020,
+	0x9de00000,
+	0x1d6a0006,
+	0x8c0008b5,
+	0x1cc100e4,
+	0x0dd1000c,
+	0x9de00001,
+	0x1de1000b,
+	0x9de00002,
+	0x60000800,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00002,
+	0x8de00012,
+	0x0551000d,
+	0x16600001,
+	0x8d0008b5,
+	0x8dd00a84,
+	0x2d60000d,
+	0xb0dfffec,
+	0x8d0008b5,
+	0x9de00000,
+	0x600007cf,
+	0x900008b5,
+	0x01010005,
+	0x400004c2,
+	0x8d0008b5,
+	0x8cd00002,
+	0x1b01001f,
+	0x0ccb000b,
+	0x1cca0001,
+	0x1dd100a4,
+	0x07c1000d,
+	0x8d700000,
+	0x2dda0000,
+	0xb0d00008,
+	0x1d01000d,
+	0x8c700001,
+	0x0dd4000c,
+	0x8c0008b5,
+	0x1cc108e4,
+	0x0dd1000c,
+	0x8dd00007,
+	0x0551000d,
+	0x8d0008b5,
+	0x1dd10002,
+	0x8cd00000,
+	0x1b010001,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8d0008b5,
+	0x8cd00003,
+	0x8dd00002,
+	0x0dc3000d,
+	0x2ddb0000,
+	0xb0dfffe2,
+	0x8d0008b5,
+	0x90d00a84,
+	0x01010005,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8be00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee10018,
+	0x50f00000,
+	0x1ee30019,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9ae00006,
+	0x9be00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x05010000,
+	0x8d0008b5,
+	0x9de0000b,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d0000c,
+	0x1d010020,
+	0x8ce0000b,
+	0x8cc00001,
+	0x8be0000b,
+	0x8bb00000,
+	0x0cc3000b,
+	0x0dd3000c,
+	0x2ddb0000,
+	0xb0d00003,
+	0x60000463,
+	0x0d010001,
+	0x0501000d,
+	0x8d0008b5,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x1d010020,
+	0x9de00000,
+	0x8de00019,
+	0x9de00001,
+	0x1de1000c,
+	0x9de00002,
+	0x60000800,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00002,
+	0x8de00013,
+	0x0551000d,
+	0x01010005,
+	0x40000528,
+	0x8d0008b5,
+	0x1dd10a84,
+	0x8cd00000,
+	0x1bc00001,
+	0x9bd00000,
+	0x0601000c,
+	0x1d6a0006,
+	0x8c0008b5,
+	0x1cc100e4,
+	0x0dd1000c,
+	0x9de00000,
+	0x8de00019,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x600005c8,
+	0x8d0008b5,
+	0x1c010005,
+	0x8bd00001,
+	0x1a01001f,
+	0x0bbb000a,
+	0x0cc5000b,
+	0x1dd10004,
+	0x07c1000d,
+	0x1d010020,
+	0x9d700000,
+	0x1d6a0006,
+	0x8c0008b5,
+	0x1cc100e4,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9d700001,
+	0x1d01000d,
+	0x0dd40006,
+	0x8c0008b5,
+	0x1cc108e4,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9d700002,
+	0x90700003,
+	0x96700004,
+	0x8d0008b5,
+	0x1dd10001,
+	0x8cd00000,
+	0x1b010001,
+	0x0cc1000b,
+	0x9cd00000,
+	0x01010005,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8ae00006,
+	0x8be00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee10019,
+	0x50f00000,
+	0x1ee30015,
+	0x94e00004,
+	0x95e00005,
+	0x96e00006,
+	0x97e00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x05010000,
+	0x8de00015,
+	0x9de00000,
+	0x60000613,
+	0x0d010001,
+	0x0401000d,
+	0x0d010004,
+	0x2ddb0000,
+	0xb0d00009,
+	0x8d0005fc,
+	0x9de00000,
+	0xcd000899,
+	0x9de00001,
+	0x8de00015,
+	0x9de00002,
+	0x60000601,
+	0x01010000,
+	0x40000592,
+	0x1d010040,
+	0x9de00000,
+	0x6000071b,
+	0x0d010001,
+	0x0601000d,
+	0x8de00015,
+	0x9de00000,
+	0x96e00001,
+	0x60000402,
+	0x40000575,
+	0x8d700002,
+	0x1c01002e,
+	0x2ddb000c,
+	0xb0d00001,
+	0x40000575,
+	0x96e00000,
+	0x1d710002,
+	0x9de00001,
+	0x1d010040,
+	0x9de00002,
+	0x60000852,
+	0x8d700001,
+	0x1c010004,
+	0x2ddb000c,
+	0xb0d00008,
+	0x60000463,
+	0x0d010001,
+	0x0551000d,
+	0x96e00000,
+	0x60000532,
+	0x0d010001,
+	0x0551000d,
+	0x40000571,
+	0x96e00000,
+	0x600004cb,
+	0x0d010001,
+	0x0551000d,
+	0x8de00015,
+	0x9de00000,
+	0x96e00001,
+	0x60000402,
+	0x94e00000,
+	0x60000639,
+	0x0d010001,
+	0x0701000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dfffda,
+	0x60000463,
+	0x0d010001,
+	0x0551000d,
+	0x0d010005,
+	0x9de00000,
+	0x1de1000b,
+	0x9de00001,
+	0x60000430,
+	0x1d010001,
+	0x9de00000,
+	0xcd000890,
+	0x9de00001,
+	0x1de1000b,
+	0x9de00002,
+	0x8de00015,
+	0x9de00003,
+	0x60000601,
+	0x94e00000,
+	0x6000067b,
+	0x96e00000,
+	0x600007cf,
+	0x01010005,
+	0x84e00004,
+	0x85e00005,
+	0x86e00006,
+	0x87e00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee10015,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0xcd00088e,
+	0x9de00006,
+	0x8de00007,
+	0x3dd40001,
+	0xb0d00003,
+	0x8de00008,
+	0x8dd00001,
+	0x9de00006,
+	0x1d010001,
+	0x9de00000,
+	0x1d010a85,
+	0x9de00001,
+	0x6000081c,
+	0x0d010001,
+	0x9d0008b5,
+	0x8d0008b5,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d0000c,
+	0x1d01003f,
+	0x9de00000,
+	0x8de00005,
+	0x9de00001,
+	0x60000800,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00004,
+	0x8d0008b5,
+	0x9de00000,
+	0x600007cf,
+	0x900008b5,
+	0x8de00006,
+	0x9de00000,
+	0x60000532,
+	0x01010000,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30004,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x9de00003,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x400005db,
+	0x8de00004,
+	0x1cd10001,
+	0x9ce00004,
+	0x8ce00005,
+	0x1bc10001,
+	0x9be00005,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00005,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00006,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00006,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00004,
+	0x90d00000,
+	0x81e00003,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10004,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x000002b3,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000800,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x96e00003,
+	0x97e00004,
+	0x9de00005,
+	0x9fe00006,
+	0x1d010016,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x60000800,
+	0x0d010001,
+	0x0601000d,
+	0x2d660000,
+	0xb0d00002,
+	0x01010000,
+	0x40000633,
+	0x1d01013a,
+	0x9de00000,
+	0x6000071b,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000633,
+	0x96700000,
+	0x90700001,
+	0x90700002,
+	0x01010007,
+	0x86e00003,
+	0x87e00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30009,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x8de00009,
+	0x8dd00002,
+	0x2dd80000,
+	0xb0d00016,
+	0x8de00009,
+	0x8cd00001,
+	0x8dd00002,
+	0x2dc6000d,
+	0xb0d0000b,
+	0x8de00009,
+	0x1dd10001,
+	0x8cd00000,
+	0x1bc00001,
+	0x9bd00000,
+	0x1d01001f,
+	0x0dd4000c,
+	0x8ce00009,
+	0x1cc10004,
+	0x01d1000c,
+	0x40000674,
+	0x8de00009,
+	0x8dd00002,
+	0x3dd6000a,
+	0xb0d00002,
+	0x01010000,
+	0x40000674,
+	0x1d010026,
+	0x9de00000,
+	0x8de00009,
+	0x8cd00000,
+	0x9ce00001,
+	0x1dd10004,
+	0x9de00002,
+	0x1d01000a,
+	0x9de00003,
+	0x60000800,
+	0x0d010001,
+	0x0701000d,
+	0x2d720000,
+	0xb0d00002,
+	0x01010000,
+	0x40000674,
+	0x1d010001,
+	0x8ce00009,
+	0x9dc00001,
+	0x8de00009,
+	0x0c010007,
+	0x1b01001f,
+	0x0cc7000b,
+	0x0c01000c,
+	0x9cd00002,
+	0x8de00009,
+	0x11d10004,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010019,
+	0x9de00000,
+	0x8de00005,
+	0x8dd00000,
+	0x9de00001,
+	0x60000800,
+	0x0d010001,
+	0x9de00004,
+	0x8de00005,
+	0x9de00000,
+	0x600007cf,
+	0x81e00004,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x600005ed,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000841,
+	0x0d010001,
+	0x8c0005fc,
+	0x9ce00000,
+	0xcc0008ad,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000601,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x870006ac,
+	0x400006b6,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x60000803,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x60000803,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x40000715,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d0006ac,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d0006ac,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x600006ad,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x600006c6,
+	0x90700003,
+	0x4000075c,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x600006ee,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x4000075d,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x600006ee,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x4000075d,
+	0x970006ac,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d0006ac,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c0006ac,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x60000803,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x60000798,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x400007c6,
+	0x07010000,
+	0x01010007,
+	0x400007c9,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x600007a3,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x60000798,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x60000763,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x60000763,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d000802,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x40000810,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x81000802,
+	0x40000818,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x60000800,
+	0x0d010001,
+	0x9d000802,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30007,
+	0x95e00001,
+	0x96e00002,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00007,
+	0x8ce00008,
+	0x0dd5000c,
+	0x9de00000,
+	0x6000071b,
+	0x0d010001,
+	0x0601000d,
+	0x0d010006,
+	0x2dd90000,
+	0xb0d0000b,
+	0x8de00007,
+	0x8ce00008,
+	0x05d5000c,
+	0x07010000,
+	0x40000836,
+	0x0d710006,
+	0x90d00000,
+	0x1d010001,
+	0x0771000d,
+	0x2d710005,
+	0xb0dffffa,
+	0x01010006,
+	0x85e00001,
+	0x86e00002,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0008b6,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000800,
+	0xc10008b6,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffffa,
+	0x8de00005,
+	0x3c0effff,
+	0x1ccdffff,
+	0x0dd1000c,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0c010007,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0d01000d,
+	0x9de00004,
+	0x8de00007,
+	0x8ce00004,
+	0x0dd3000c,
+	0x9de00007,
+	0x8de00007,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x01010007,
+	0x40000888,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8ce00006,
+	0x1bc10001,
+	0x9be00006,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00006,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00007,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00007,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00005,
+	0x90d00000,
+	0x01010007,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x0000002e,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000004b,
+	0x00000042,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000065,
+	0x00000072,
+	0x00000072,
+	0x0000003a,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000075,
+	0x00000072,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x0000005f,
+	0x00000065,
+	0x0000006e,
+	0x00000074,
+	0x00000065,
+	0x00000072,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80000045,
+	0x00000044,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x000002c8,
+	0x000001f0,
+	0x000000d8,
+	0x00000040,
+	0x1ee30007,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00007,
+	0x3dd60003,
+	0xb0d00007,
+	0x8d000447,
+	0x9de00000,
+	0xcd00047d,
+	0x9de00001,
+	0x6000044c,
+	0x11010001,
+	0x4000041f,
+	0x1d010024,
+	0x9de00000,
+	0x8de00008,
+	0x8cd00001,
+	0x9ce00001,
+	0x8dd00002,
+	0x9de00002,
+	0x60000438,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00003,
+	0xcd00047c,
+	0x9de00000,
+	0x6000045e,
+	0x01010007,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0004b2,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000438,
+	0xc10004b2,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000065,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000438,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000436,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000425,
+	0x0d010001,
+	0x8c000447,
+	0x9ce00000,
+	0xcc0004aa,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x6000044c,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x00000075,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x0000006c,
+	0x0000006e,
+	0x00000020,
+	0x0000005b,
+	0x00000070,
+	0x00000061,
+	0x00000074,
+	0x00000068,
+	0x0000002f,
+	0x00000074,
+	0x0000006f,
+	0x0000002f,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x00000070,
+	0x00000061,
+	0x00000074,
+	0x00000068,
+	0x0000002f,
+	0x00000074,
+	0x0000006f,
+	0x0000002f,
+	0x00000068,
+	0x00000061,
+	0x00000072,
+	0x00000064,
+	0x0000006c,
+	0x00000069,
+	0x0000006e,
+	0x0000006b,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80000048,
+	0x00000602,
+	0x19960503,
+	0x000007da,
+	0x00001000,
+	0x00001aa8,
+	0x000018dc,
+	0x000001cc,
+	0x000000e0,
+	0x00000000,
+	0x1ee30004,
+	0x97e00001,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010004,
+	0x9de00000,
+	0x600008c7,
+	0x0d010001,
+	0x0701000d,
+	0x8de00004,
+	0x9d700000,
+	0x8de00005,
+	0x9d700001,
+	0x01010007,
+	0x87e00001,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00002,
+	0x9fe00003,
+	0x60000a1d,
+	0x0d010001,
+	0x1dd80030,
+	0x1dd00001,
+	0x9de00005,
+	0x60000a1d,
+	0x0d010001,
+	0x1dd8000e,
+	0x1dd00001,
+	0x9de00004,
+	0x8de00005,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x60000401,
+	0x0d010001,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10006,
+	0x50f00000,
+	0x0000001b,
+	0x0000005b,
+	0x0000003f,
+	0x00000032,
+	0x00000035,
+	0x0000006c,
+	0x00000000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x1d010001,
+	0x9de00000,
+	0xcd000aa7,
+	0x9de00001,
+	0xcd00042c,
+	0x9de00002,
+	0x60000a0a,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x1d010068,
+	0x9d000431,
+	0x1d010001,
+	0x9de00000,
+	0xcd000aa7,
+	0x9de00001,
+	0xcd00042c,
+	0x9de00002,
+	0x60000a0a,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x40000462,
+	0x8de00003,
+	0x8ce00004,
+	0x0dd6000c,
+	0x17d8000a,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x1c700030,
+	0x9cd00000,
+	0x8de00004,
+	0x1dd6000a,
+	0x9de00004,
+	0x8de00004,
+	0x2dda0000,
+	0xb0dffff1,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x0000001b,
+	0x0000005b,
+	0x00000030,
+	0x00000030,
+	0x00000030,
+	0x0000003b,
+	0x00000030,
+	0x00000030,
+	0x00000030,
+	0x00000048,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000000,
+	0x1ee30006,
+	0x97e00003,
+	0x9de00004,
+	0x9fe00005,
+	0xc700046a,
+	0x8de00007,
+	0x9de00000,
+	0x1d010064,
+	0x9de00001,
+	0x1d710002,
+	0x9de00002,
+	0x60000451,
+	0x8de00006,
+	0x9de00000,
+	0x1d010064,
+	0x9de00001,
+	0x1d710006,
+	0x9de00002,
+	0x60000451,
+	0x8de00008,
+	0x9d000477,
+	0x1d010001,
+	0x9de00000,
+	0xcd000475,
+	0x9de00001,
+	0xcd00046a,
+	0x9de00002,
+	0x60000a0a,
+	0x87e00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x0000001b,
+	0x0000005b,
+	0x00000030,
+	0x0000003b,
+	0x00000030,
+	0x00000048,
+	0x0000001b,
+	0x0000005b,
+	0x00000032,
+	0x0000004a,
+	0x00000000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x1d010001,
+	0x9de00000,
+	0xcd000aa7,
+	0x9de00001,
+	0xcd00049a,
+	0x9de00002,
+	0x60000a0a,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30008,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00009,
+	0x9de00000,
+	0x600009ac,
+	0x0d010001,
+	0x0d01000d,
+	0x9de00007,
+	0x1d010019,
+	0x8ce00007,
+	0x1cc60002,
+	0x0dd2000c,
+	0x1dd20001,
+	0x9de00006,
+	0x8de00006,
+	0x9de00000,
+	0x8de00008,
+	0x9de00001,
+	0x1d010020,
+	0x9de00002,
+	0x60000479,
+	0x1d010001,
+	0x9de00000,
+	0xcd000aa7,
+	0x9de00001,
+	0x8de00009,
+	0x9de00002,
+	0x60000a0a,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00002,
+	0x9de00003,
+	0x9fe00004,
+	0x17010007,
+	0x0d010007,
+	0x17d00001,
+	0x9de00000,
+	0xcd000a96,
+	0x9de00001,
+	0x600004b3,
+	0x0d010007,
+	0x17d00001,
+	0x9de00000,
+	0xcd000a81,
+	0x9de00001,
+	0x600004b3,
+	0x97e00000,
+	0xcd000a71,
+	0x9de00001,
+	0x600004b3,
+	0x87e00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee3000a,
+	0x94e00003,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x1d010032,
+	0x9de00000,
+	0x600008c7,
+	0x0d010001,
+	0x0401000d,
+	0x06010004,
+	0x15010030,
+	0x07010000,
+	0x40000506,
+	0x0d010006,
+	0x16d10001,
+	0x1c01002d,
+	0x9cd00000,
+	0x17700001,
+	0x2d700005,
+	0xb0dffff9,
+	0x90600000,
+	0x0d010000,
+	0x9de00000,
+	0x9de00001,
+	0x1d01002d,
+	0x9de00002,
+	0x60000479,
+	0x1d010001,
+	0x9de00000,
+	0xcd000aa7,
+	0x9de00001,
+	0x94e00002,
+	0x60000a0a,
+	0x90e00000,
+	0x1d01000f,
+	0x9de00001,
+	0x1d01002d,
+	0x9de00002,
+	0x60000479,
+	0x1d010001,
+	0x9de00000,
+	0xcd000aa7,
+	0x9de00001,
+	0x94e00002,
+	0x60000a0a,
+	0x17010001,
+	0x90e00000,
+	0x97e00001,
+	0x1d01007c,
+	0x9de00002,
+	0x60000479,
+	0x17700001,
+	0x3d70000f,
+	0xb0dffff8,
+	0x17010001,
+	0x1d010031,
+	0x9de00000,
+	0x97e00001,
+	0x1d01007c,
+	0x9de00002,
+	0x60000479,
+	0x17700001,
+	0x3d70000f,
+	0xb0dffff7,
+	0x94e00000,
+	0x6000097b,
+	0x84e00003,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1000a,
+	0x50f00000,
+	0x1ee30032,
+	0x98e00004,
+	0x99e00005,
+	0x9ae00006,
+	0x9be00007,
+	0x9ce00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010001,
+	0x9de00002,
+	0xcd000abb,
+	0x9de00003,
+	0x600009de,
+	0x1de1000b,
+	0xc9000abb,
+	0x19910027,
+	0x1bd10027,
+	0x19930001,
+	0x1bb30001,
+	0x88900000,
+	0x98b00000,
+	0x2ad1000b,
+	0xb0affffa,
+	0x8de0000e,
+	0x3c0effff,
+	0x1ccdfff5,
+	0x0c01000c,
+	0x0ddb000c,
+	0x9de0000e,
+	0x90e00016,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0x1de1000b,
+	0x9de00003,
+	0x600009de,
+	0x1d010001,
+	0x9d000400,
+	0x88e00004,
+	0x89e00005,
+	0x8ae00006,
+	0x8be00007,
+	0x8ce00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee10032,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x8d000400,
+	0x2dd80000,
+	0xb0d00009,
+	0x1d01002d,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0xcd000abb,
+	0x9de00003,
+	0x600009de,
+	0x60000441,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000a,
+	0x96e00004,
+	0x97e00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x1d010001,
+	0x9de00000,
+	0x90e00001,
+	0x600009de,
+	0x0d010001,
+	0x0d01000d,
+	0x9de00009,
+	0x8de00009,
+	0x9de00000,
+	0x60000a30,
+	0x8de0000a,
+	0x1dd10002,
+	0x9dd00000,
+	0x8de0000a,
+	0x1cd10002,
+	0x9cd00003,
+	0x8de0000a,
+	0x9dd00000,
+	0x8de0000a,
+	0x9dd00001,
+	0x1d010016,
+	0x9de00000,
+	0x1d011102,
+	0x9de00001,
+	0xcd000a5e,
+	0x9de00002,
+	0x1d0101a4,
+	0x9de00003,
+	0x600009de,
+	0x0d010001,
+	0x0601000d,
+	0x1d010023,
+	0x9de00000,
+	0x96e00001,
+	0x1d010002,
+	0x9de00002,
+	0x600009de,
+	0x1d010019,
+	0x9de00000,
+	0x96e00001,
+	0x600009de,
+	0x6000053f,
+	0x60000433,
+	0x07010000,
+	0x1d010031,
+	0x9de00000,
+	0x97e00001,
+	0xcd000573,
+	0x9de00002,
+	0x600009de,
+	0x17700001,
+	0x3d700015,
+	0xb0dffff7,
+	0x86e00004,
+	0x87e00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000a,
+	0x50f00000,
+	0x1ee3000b,
+	0x92e00003,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x05010000,
+	0x60000414,
+	0x0d010001,
+	0x0701000d,
+	0x14710002,
+	0x8de0000b,
+	0x13d10002,
+	0x8de0000b,
+	0x82d00002,
+	0x94200001,
+	0x92400000,
+	0x93400001,
+	0x94300000,
+	0x8d700000,
+	0x9de00000,
+	0x8d700001,
+	0x9de00001,
+	0x1d01006f,
+	0x9de00002,
+	0x60000479,
+	0x15500001,
+	0x3d50000a,
+	0xb0dfffea,
+	0x15010001,
+	0x95e00000,
+	0x1d010001,
+	0x9de00001,
+	0x60000401,
+	0x0d010001,
+	0x0601000d,
+	0x14610002,
+	0x83e0000b,
+	0x8de0000b,
+	0x82d00000,
+	0x94200001,
+	0x92400000,
+	0x93400001,
+	0x94300000,
+	0x8d600000,
+	0x9de00000,
+	0x8d600001,
+	0x9de00001,
+	0x1d010078,
+	0x9de00002,
+	0x60000479,
+	0x15500001,
+	0x3d540003,
+	0xb0dfffe8,
+	0x82e00003,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee1000b,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8d000a05,
+	0x9de00000,
+	0xcd000a55,
+	0x9de00001,
+	0x60000a0a,
+	0x8de00008,
+	0x8dd00000,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x40000628,
+	0x8d000a05,
+	0x9de00000,
+	0xcd000a49,
+	0x9de00001,
+	0x8d700000,
+	0x9de00002,
+	0x8d700001,
+	0x9de00003,
+	0x60000a0a,
+	0x8d700002,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x1d710002,
+	0x0d01000d,
+	0x8ce00008,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0dfffed,
+	0x8d000a05,
+	0x9de00000,
+	0xcd000a47,
+	0x9de00001,
+	0x60000a0a,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00000,
+	0x9de00001,
+	0x9fe00002,
+	0x8de00007,
+	0x8dd00004,
+	0x9de00006,
+	0x8de00008,
+	0x9de00005,
+	0x3dd80071,
+	0xb0d00031,
+	0x1d010073,
+	0x9de00004,
+	0x8ce00005,
+	0x2dc8000d,
+	0xb0d0001e,
+	0x8de00005,
+	0x8ce00004,
+	0x2dd2000c,
+	0xb0d00008,
+	0x8de00008,
+	0x9de00003,
+	0x3dd80061,
+	0xb0d0000f,
+	0x8de00003,
+	0x3dd80064,
+	0xb0d0001a,
+	0x40000676,
+	0x8de00008,
+	0x3dd80077,
+	0xb0d00001,
+	0x40000676,
+	0x8de00006,
+	0x3dda0003,
+	0xb0d00002,
+	0x11010003,
+	0x40000677,
+	0x11010001,
+	0x40000677,
+	0x8de00006,
+	0x3dda0002,
+	0xb0d00002,
+	0x11010002,
+	0x40000677,
+	0x01010000,
+	0x40000677,
+	0x8de00006,
+	0x3dda0001,
+	0xb0d00002,
+	0x11010001,
+	0x40000677,
+	0x11010003,
+	0x40000677,
+	0x8de00006,
+	0x2dda0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000677,
+	0x11010002,
+	0x40000677,
+	0x600007ca,
+	0x81e00006,
+	0x8ce00000,
+	0x8de00001,
+	0x8fe00002,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00003,
+	0x8dd00000,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x40000694,
+	0x8d700000,
+	0x8ce00004,
+	0x2dda000c,
+	0xb0d00006,
+	0x8d700001,
+	0x8ce00005,
+	0x2dda000c,
+	0xb0d00002,
+	0x01010007,
+	0x4000069b,
+	0x8d700002,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x1d710002,
+	0x0d01000d,
+	0x8ce00003,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0dfffec,
+	0x01010000,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30010,
+	0x92e00003,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x8de00010,
+	0x8dd00004,
+	0x9de0000f,
+	0x8de00010,
+	0x8dd00000,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x03d1000c,
+	0x85300000,
+	0x84300001,
+	0x82e0000f,
+	0x2d200000,
+	0xb0d00020,
+	0x3d220003,
+	0xb0d0001e,
+	0x8d200a37,
+	0x50d00000,
+	0x3d5a0001,
+	0xb0d00003,
+	0x310effff,
+	0x111dfffe,
+	0x40000744,
+	0x15520001,
+	0x400006da,
+	0x3d4a0001,
+	0xb0d00003,
+	0x310effff,
+	0x111dfffb,
+	0x40000744,
+	0x14420001,
+	0x400006da,
+	0x3d500030,
+	0xb0d00003,
+	0x310effff,
+	0x111dfffd,
+	0x40000744,
+	0x15500001,
+	0x400006da,
+	0x3d40000e,
+	0xb0d00003,
+	0x310effff,
+	0x111dfffc,
+	0x40000744,
+	0x14400001,
+	0x400006da,
+	0x310effff,
+	0x111dffff,
+	0x40000744,
+	0x8de00010,
+	0x1dd10002,
+	0x9de00000,
+	0x95e00001,
+	0x94e00002,
+	0x6000067c,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0001a,
+	0x8de00010,
+	0x9de00000,
+	0x95e00001,
+	0x94e00002,
+	0x6000067c,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00003,
+	0x310effff,
+	0x111dfffa,
+	0x40000744,
+	0x8de00010,
+	0x8dd00001,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x8d700000,
+	0x9de00000,
+	0x8d700001,
+	0x9de00001,
+	0x1d010020,
+	0x9de00002,
+	0x60000479,
+	0x4000071d,
+	0x60000414,
+	0x0d010001,
+	0x0601000d,
+	0x1d610002,
+	0x9de0000e,
+	0x8de00010,
+	0x1dd10002,
+	0x9de0000d,
+	0x8de00010,
+	0x8dd00002,
+	0x9de0000c,
+	0x8de0000c,
+	0x8ce0000e,
+	0x9cd00001,
+	0x8de0000e,
+	0x8ce0000c,
+	0x9cd00000,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00001,
+	0x8de0000d,
+	0x8ce0000e,
+	0x9cd00000,
+	0x8d600000,
+	0x9de00000,
+	0x8d600001,
+	0x9de00001,
+	0x1d01006f,
+	0x9de00002,
+	0x60000479,
+	0x8d700002,
+	0x8c700003,
+	0x9cd00001,
+	0x8d700003,
+	0x8c700002,
+	0x9cd00000,
+	0x90700002,
+	0x3d0e0000,
+	0x1ddd0002,
+	0x9d700003,
+	0x95700000,
+	0x94700001,
+	0x1d710002,
+	0x9de0000e,
+	0x8de00010,
+	0x9de0000d,
+	0x8de00010,
+	0x8dd00000,
+	0x9de0000c,
+	0x8de0000c,
+	0x8ce0000e,
+	0x9cd00001,
+	0x8de0000e,
+	0x8ce0000c,
+	0x9cd00000,
+	0x8de0000e,
+	0x8ce0000d,
+	0x9cd00001,
+	0x8de0000d,
+	0x8ce0000e,
+	0x9cd00000,
+	0x8d700000,
+	0x9de00000,
+	0x8d700001,
+	0x9de00001,
+	0x1d010078,
+	0x9de00002,
+	0x60000479,
+	0x01010000,
+	0x82e00003,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee10010,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00005,
+	0x9de00000,
+	0x600006a0,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00005,
+	0x1d010006,
+	0x9de00000,
+	0xcd000a3b,
+	0x9de00001,
+	0x600004b3,
+	0x01010007,
+	0x87e00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00003,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x8de00007,
+	0x8dd00000,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x4000077b,
+	0x8d700000,
+	0x9de00000,
+	0x8d700001,
+	0x9de00001,
+	0x1d010078,
+	0x9de00002,
+	0x60000479,
+	0x8d700002,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x1d710002,
+	0x0d01000d,
+	0x8ce00007,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0dfffef,
+	0x8de00007,
+	0x8dd00002,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x40000792,
+	0x8d700000,
+	0x9de00000,
+	0x8d700001,
+	0x9de00001,
+	0x1d01006f,
+	0x9de00002,
+	0x60000479,
+	0x8d700002,
+	0x3c0effff,
+	0x1ccdfffe,
+	0x07d1000c,
+	0x1d710002,
+	0x0d01000d,
+	0x8ce00007,
+	0x1cc10002,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0dfffee,
+	0x87e00003,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30008,
+	0x9de00004,
+	0x9fe00005,
+	0x1d010017,
+	0x9de00000,
+	0x90e00001,
+	0x1de10006,
+	0x9de00002,
+	0x1d010001,
+	0x9de00003,
+	0x600009de,
+	0x0d010001,
+	0x9de00007,
+	0x8de00007,
+	0x2dd40000,
+	0xb0d00002,
+	0x81e00006,
+	0x400007b2,
+	0x01010000,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x9dd00000,
+	0x8de00002,
+	0x9dd00001,
+	0x8de00002,
+	0x1dd10002,
+	0x9dd00000,
+	0x8de00002,
+	0x1cd10002,
+	0x9cd00003,
+	0x8de00002,
+	0x1c010002,
+	0x9cd00004,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x60000573,
+	0x600004a5,
+	0x1d010002,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x600009de,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30010,
+	0x92e00004,
+	0x93e00005,
+	0x94e00006,
+	0x95e00007,
+	0x96e00008,
+	0x97e00009,
+	0x9ce0000a,
+	0x9de0000b,
+	0x9fe0000c,
+	0xc5000ab6,
+	0x14010001,
+	0x12010001,
+	0x13010001,
+	0x1de1000e,
+	0x9de00000,
+	0x90e00001,
+	0x1d010002,
+	0x9de00002,
+	0x600009e0,
+	0x95e00000,
+	0x60000586,
+	0x600004a5,
+	0x95e00000,
+	0x600004f0,
+	0x3d0e0773,
+	0x1ddd5940,
+	0x9de0000f,
+	0x40000849,
+	0x600004d6,
+	0x40000804,
+	0x6000079f,
+	0x0d010001,
+	0x9de0000d,
+	0x8de0000d,
+	0x3dda0020,
+	0xb0d00001,
+	0x40000806,
+	0x8de0000d,
+	0x3dda0071,
+	0xb0d00001,
+	0x600007ca,
+	0x2d3a0000,
+	0xb0dffff3,
+	0x95e00000,
+	0x600007b6,
+	0x600004a5,
+	0x95e00000,
+	0x600004f0,
+	0x95e00000,
+	0x600005c8,
+	0x14010001,
+	0x40000847,
+	0x90e0000d,
+	0x1d01002f,
+	0x9de00000,
+	0x1de1000e,
+	0x9de00001,
+	0x90e00002,
+	0x600009de,
+	0x1d010017,
+	0x9de00000,
+	0x90e00001,
+	0xcd000aaa,
+	0x9de00002,
+	0x1d01000c,
+	0x9de00003,
+	0x600009de,
+	0x0d010001,
+	0x0601000d,
+	0x2d6a0000,
+	0xb0d00007,
+	0x95e00000,
+	0x6000074f,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00002,
+	0x04010000,
+	0x40000849,
+	0x07010000,
+	0x40000845,
+	0x2d780000,
+	0xb0d00005,
+	0x8d700aaa,
+	0x8ce0000d,
+	0x2dda000c,
+	0xb0d00001,
+	0x40000844,
+	0xcd000aaa,
+	0x0d71000d,
+	0x8cd00000,
+	0x9ce0000d,
+	0x95e00000,
+	0x8dd00000,
+	0x9de00001,
+	0x60000639,
+	0x0d010001,
+	0x9d500004,
+	0x95e00000,
+	0x6000074f,
+	0x0d010001,
+	0x0601000d,
+	0x2d680000,
+	0xb0d00002,
+	0x04010000,
+	0x40000847,
+	0x17700001,
+	0x2d700006,
+	0xb0dfffe4,
+	0x2d4a0000,
+	0xb0dfffc6,
+	0x2d2a0000,
+	0xb0dfffac,
+	0x600007ca,
+	0x01010000,
+	0x82e00004,
+	0x83e00005,
+	0x84e00006,
+	0x85e00007,
+	0x86e00008,
+	0x87e00009,
+	0x8ce0000a,
+	0x8de0000b,
+	0x8fe0000c,
+	0x1ee10010,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x87000858,
+	0x40000862,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x600009c5,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x600009c5,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x400008c1,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d000858,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d000858,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000859,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000872,
+	0x90700003,
+	0x40000908,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x6000089a,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x40000909,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x6000089a,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000909,
+	0x97000858,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d000858,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c000858,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x600009c5,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x60000944,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x40000972,
+	0x07010000,
+	0x01010007,
+	0x40000975,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x6000094f,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x60000944,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x6000090f,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x6000090f,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30003,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00003,
+	0x9de00002,
+	0x400009b5,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00003,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffff9,
+	0x8de00003,
+	0x0d01000d,
+	0x8ce00002,
+	0x0c01000c,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0101000d,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d0009c4,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x400009d2,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x810009c4,
+	0x400009da,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x600009de,
+	0x0d010001,
+	0x9d0009c4,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00005,
+	0x2dd90000,
+	0xb0d0000b,
+	0x87e00003,
+	0x0d010007,
+	0x17d10001,
+	0x8ce00004,
+	0x9cd00000,
+	0x8de00005,
+	0x1c010001,
+	0x0dd3000c,
+	0x9de00005,
+	0x2ddb0000,
+	0xb0dffff6,
+	0x81e00003,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x0000009f,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x600009de,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000001,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x3d0e41c6,
+	0x1ddd4e6d,
+	0x8c000a1c,
+	0x0dd5000c,
+	0x1c013039,
+	0x0dd1000c,
+	0x9d000a1c,
+	0x8d000a1c,
+	0x1ddc0010,
+	0x1c017fff,
+	0x0ddb000c,
+	0x0101000d,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30001,
+	0x9de00000,
+	0x8de00001,
+	0x9d000a1c,
+	0x8de00000,
+	0x1ee10001,
+	0x50f00000,
+	0x000006bb,
+	0x000006c2,
+	0x000006c9,
+	0x000006d0,
+	0x00000059,
+	0x0000006f,
+	0x00000075,
+	0x00000020,
+	0x0000006c,
+	0x0000006f,
+	0x00000073,
+	0x00000074,
+	0x00000020,
+	0x0000003a,
+	0x00000028,
+	0x00000000,
+	0x0000000a,
+	0x00000000,
+	0x00000078,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x00000020,
+	0x00000079,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000003b,
+	0x00000020,
+	0x00000000,
+	0x00000070,
+	0x0000006f,
+	0x00000069,
+	0x0000006e,
+	0x00000074,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000000,
+	0x0000002f,
+	0x00000076,
+	0x00000061,
+	0x00000072,
+	0x0000002f,
+	0x0000006c,
+	0x0000006f,
+	0x00000067,
+	0x0000002f,
+	0x00000073,
+	0x0000006e,
+	0x00000061,
+	0x0000006b,
+	0x00000065,
+	0x0000002e,
+	0x0000006c,
+	0x0000006f,
+	0x00000067,
+	0x00000000,
+	0x00000050,
+	0x00000072,
+	0x00000065,
+	0x00000073,
+	0x00000073,
+	0x00000020,
+	0x00000071,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000020,
+	0x00000065,
+	0x00000078,
+	0x00000069,
+	0x00000074,
+	0x00000000,
+	0x00000050,
+	0x00000072,
+	0x00000065,
+	0x00000073,
+	0x00000073,
+	0x00000020,
+	0x00000053,
+	0x00000050,
+	0x00000041,
+	0x00000043,
+	0x00000045,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000072,
+	0x00000074,
+	0x00000000,
+	0x00000055,
+	0x00000073,
+	0x00000065,
+	0x00000020,
+	0x00000057,
+	0x00000041,
+	0x00000053,
+	0x00000044,
+	0x00000020,
+	0x00000074,
+	0x0000006f,
+	0x00000020,
+	0x0000006d,
+	0x0000006f,
+	0x00000076,
+	0x00000065,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x80000050,
+	0x000003de,
+	0x19960503,
+	0x0000077d,
+	0x00001000,
+	0x000014b0,
+	0x000011d4,
+	0x000002dc,
+	0x00000004,
+	0x0000002f,
+	0x00000062,
+	0x00000069,
+	0x0000006e,
+	0x0000002f,
+	0x00000077,
+	0x00000073,
+	0x00000068,
+	0x00000000,
+	0x00000400,
+	0x00000000,
+	0x0000090a,
+	0x00000900,
+	0x00000000,
+	0x1ee30008,
+	0x97e00004,
+	0x9de00005,
+	0x9fe00006,
+	0x1de10007,
+	0x9de00000,
+	0x6000084d,
+	0x1de10007,
+	0x9de00000,
+	0x1d01000b,
+	0x9de00001,
+	0x60000828,
+	0x1d010013,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x90e00002,
+	0x8de00007,
+	0x9de00003,
+	0x6000080b,
+	0x17010001,
+	0x1d010031,
+	0x9de00000,
+	0x97e00001,
+	0x3d0e0000,
+	0x1ddd0001,
+	0x9de00002,
+	0x6000080b,
+	0x17700001,
+	0x3d700015,
+	0xb0dffff6,
+	0x87e00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d010028,
+	0x9de00000,
+	0x1d0101ff,
+	0x9de00001,
+	0xcd0008fb,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x9de00006,
+	0x8de00006,
+	0x2dda0000,
+	0xb0d00002,
+	0x17010001,
+	0x40000445,
+	0x07010000,
+	0x97e00000,
+	0x1d01002c,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x87e00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee3000d,
+	0x92e00004,
+	0x93e00005,
+	0x94e00006,
+	0x95e00007,
+	0x96e00008,
+	0x97e00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x1d010028,
+	0x9de00000,
+	0x1d0101ed,
+	0x9de00001,
+	0xcd0008ea,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x16010001,
+	0x40000467,
+	0x06010000,
+	0x96e00000,
+	0x1d010034,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010028,
+	0x9de00000,
+	0x1d0101ed,
+	0x9de00001,
+	0xcd0008e5,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x15010001,
+	0x4000047b,
+	0x05010000,
+	0x95e00000,
+	0x1d010037,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010028,
+	0x9de00000,
+	0x1d0101ed,
+	0x9de00001,
+	0xcd0008db,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x14010001,
+	0x4000048f,
+	0x04010000,
+	0x94e00000,
+	0x1d01003a,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d01001c,
+	0x9de00000,
+	0x1d0101ed,
+	0x9de00001,
+	0xcd0008d1,
+	0x9de00002,
+	0x1d010301,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x13010001,
+	0x400004a5,
+	0x03010000,
+	0x93e00000,
+	0x1d01003d,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d01001c,
+	0x9de00000,
+	0x1d0101ed,
+	0x9de00001,
+	0xcd0008c7,
+	0x9de00002,
+	0x1d010302,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x12010001,
+	0x400004bb,
+	0x02010000,
+	0x92e00000,
+	0x1d010040,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d01001c,
+	0x9de00000,
+	0x1d0101ed,
+	0x9de00001,
+	0xcd0008be,
+	0x9de00002,
+	0x1d010101,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00003,
+	0x1d010001,
+	0x9de0000c,
+	0x400004d2,
+	0x90e0000c,
+	0x8de0000c,
+	0x9de00000,
+	0x1d010043,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x82e00004,
+	0x83e00005,
+	0x84e00006,
+	0x85e00007,
+	0x86e00008,
+	0x87e00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee1000d,
+	0x50f00000,
+	0x1ee30030,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9de00007,
+	0x9fe00008,
+	0x1d01002d,
+	0x9de00000,
+	0x8de00030,
+	0x9de00001,
+	0x1d010001,
+	0x9de00002,
+	0x1de10009,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x16010001,
+	0x400004f9,
+	0x06010000,
+	0x96e00000,
+	0x1d01004b,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d01003b,
+	0x9de0000c,
+	0x1d012100,
+	0x9de00009,
+	0x90e0000a,
+	0x1d010080,
+	0x9de0000b,
+	0x1d010003,
+	0x9de0000e,
+	0x1d01001c,
+	0x9de0000f,
+	0x1d010008,
+	0x9de00010,
+	0x1d010015,
+	0x9de00011,
+	0x1d010004,
+	0x9de00012,
+	0x1d010011,
+	0x9de00016,
+	0x1d010013,
+	0x9de00017,
+	0x1d01001a,
+	0x9de00018,
+	0x1d010016,
+	0x9de0001d,
+	0x1d010017,
+	0x9de0001c,
+	0x1d010012,
+	0x9de0001a,
+	0x90e00019,
+	0x90e0001e,
+	0x90e00013,
+	0x1d010001,
+	0x9de00014,
+	0x1d01002d,
+	0x9de00000,
+	0x8de00030,
+	0x9de00001,
+	0x1d010002,
+	0x9de00002,
+	0x1de10009,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x15010001,
+	0x40000531,
+	0x05010000,
+	0x95e00000,
+	0x1d010063,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10030,
+	0x50f00000,
+	0x1ee30010,
+	0x92e00004,
+	0x93e00005,
+	0x94e00006,
+	0x95e00007,
+	0x96e00008,
+	0x97e00009,
+	0x9ce0000a,
+	0x9de0000b,
+	0x9fe0000c,
+	0x1d01002e,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x1d01000c,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x2d7a000d,
+	0xb0d00002,
+	0x15010001,
+	0x40000556,
+	0x05010000,
+	0x95e00000,
+	0x1d01006b,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010016,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0xcd0008d1,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0601000d,
+	0x2d6a0000,
+	0xb0d00002,
+	0x14010001,
+	0x4000056a,
+	0x04010000,
+	0x94e00000,
+	0x1d01006d,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010022,
+	0x9de00000,
+	0x96e00001,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x3d7a0001,
+	0xb0d00002,
+	0x13010001,
+	0x4000057b,
+	0x03010000,
+	0x93e00000,
+	0x1d01006f,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010022,
+	0x9de00000,
+	0x96e00001,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x3d7a0002,
+	0xb0d00002,
+	0x12010001,
+	0x4000058c,
+	0x02010000,
+	0x92e00000,
+	0x1d010071,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d01002d,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x1c010012,
+	0x9ce00002,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00003,
+	0x1d010001,
+	0x9de0000f,
+	0x400005a2,
+	0x90e0000f,
+	0x8de0000f,
+	0x9de00000,
+	0x1d010073,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010015,
+	0x9de00000,
+	0x90e00001,
+	0x6000080b,
+	0x0d010001,
+	0x9d00092c,
+	0x90e00000,
+	0x8d00092c,
+	0x9de00001,
+	0x600007c2,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00003,
+	0x1d010001,
+	0x9de0000e,
+	0x400005bb,
+	0x90e0000e,
+	0x8de0000e,
+	0x9de00000,
+	0x1d010076,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x90e00000,
+	0x600004e3,
+	0x1d010016,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0xcd0008c7,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0601000d,
+	0x3d6a0003,
+	0xb0d00003,
+	0x1d010001,
+	0x9de0000d,
+	0x400005d3,
+	0x90e0000d,
+	0x8de0000d,
+	0x9de00000,
+	0x1d01007b,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x96e00000,
+	0x600004e3,
+	0x1d010019,
+	0x9de00000,
+	0x96e00001,
+	0x6000080b,
+	0x82e00004,
+	0x83e00005,
+	0x84e00006,
+	0x85e00007,
+	0x86e00008,
+	0x87e00009,
+	0x8ce0000a,
+	0x8de0000b,
+	0x8fe0000c,
+	0x1ee10010,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00004,
+	0x9de00005,
+	0x9fe00006,
+	0x6000040e,
+	0x40000601,
+	0x1d01000a,
+	0x9de00000,
+	0x3d0effff,
+	0x1dddffff,
+	0x9de00001,
+	0x1de10007,
+	0x9de00002,
+	0x90e00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x3d0effff,
+	0x1dddffff,
+	0x2d7a000d,
+	0xb0d00001,
+	0x40000602,
+	0x400005f1,
+	0x1d010001,
+	0x9de00000,
+	0xcd0008ac,
+	0x9de00001,
+	0x600007e6,
+	0x87e00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10008,
+	0x50f00000,
+	0x0000002f,
+	0x00000076,
+	0x00000061,
+	0x00000072,
+	0x0000002f,
+	0x0000006c,
+	0x0000006f,
+	0x00000067,
+	0x0000002f,
+	0x00000074,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x0000002e,
+	0x0000006c,
+	0x0000006f,
+	0x00000067,
+	0x00000000,
+	0x1ee30011,
+	0x98e00004,
+	0x99e00005,
+	0x9ae00006,
+	0x9be00007,
+	0x9de00008,
+	0x9fe00009,
+	0x1de1000a,
+	0xc9000875,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x88900002,
+	0x8a900003,
+	0x98d00002,
+	0x9ad00003,
+	0x88900004,
+	0x8a900005,
+	0x98d00004,
+	0x9ad00005,
+	0x88900006,
+	0x98d00006,
+	0x1d010005,
+	0x9de00000,
+	0xcd000400,
+	0x9de00001,
+	0x1de1000a,
+	0x9de00002,
+	0xcd00040b,
+	0x9de00003,
+	0x6000080b,
+	0x88e00004,
+	0x89e00005,
+	0x8ae00006,
+	0x8be00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee10011,
+	0x50f00000,
+	0x1ee3004b,
+	0x94e00004,
+	0x95e00005,
+	0x96e00006,
+	0x97e00007,
+	0x9de00008,
+	0x9fe00009,
+	0x1d01000a,
+	0x9de00000,
+	0x8de0004b,
+	0x9de00001,
+	0x1de1004a,
+	0x9de00002,
+	0x90e00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x8de0004a,
+	0x1dde0008,
+	0x15db00ff,
+	0x2d580000,
+	0xb0d00027,
+	0x1d010001,
+	0x9de00000,
+	0xcd00087c,
+	0x9de00001,
+	0x95e00002,
+	0x600007e6,
+	0x1d010016,
+	0x9de00000,
+	0x90e00001,
+	0xcd00060c,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0601000d,
+	0x40000673,
+	0x1d010018,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x1de1000a,
+	0x9de00002,
+	0x97e00003,
+	0x6000080b,
+	0x1d010017,
+	0x9de00000,
+	0x96e00001,
+	0x1de1000a,
+	0x9de00002,
+	0x1d010040,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2dd20000,
+	0xb0dfffec,
+	0x1d010019,
+	0x9de00000,
+	0x96e00001,
+	0x6000080b,
+	0x2d5a0000,
+	0xb0d00002,
+	0x14010001,
+	0x40000688,
+	0x04010000,
+	0x94e00000,
+	0x1d0100aa,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x84e00004,
+	0x85e00005,
+	0x86e00006,
+	0x87e00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee1004b,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d010005,
+	0x9de00000,
+	0xcd000400,
+	0x9de00001,
+	0xcd000409,
+	0x9de00002,
+	0xcd00040b,
+	0x9de00003,
+	0x6000080b,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee3000c,
+	0x92e00004,
+	0x93e00005,
+	0x94e00006,
+	0x95e00007,
+	0x96e00008,
+	0x97e00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x1d01002e,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x1d01000c,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x2d7a000d,
+	0xb0d00002,
+	0x15010001,
+	0x400006bd,
+	0x05010000,
+	0x95e00000,
+	0x1d0100b5,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010016,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0xcd0008c7,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0601000d,
+	0x2d640000,
+	0xb0d00002,
+	0x14010001,
+	0x400006d1,
+	0x04010000,
+	0x94e00000,
+	0x1d0100b8,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d01002d,
+	0x9de00000,
+	0x96e00001,
+	0x1d010012,
+	0x9de00002,
+	0x90e00003,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x13010001,
+	0x400006e5,
+	0x03010000,
+	0x93e00000,
+	0x1d0100bb,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010015,
+	0x9de00000,
+	0x90e00001,
+	0x6000080b,
+	0x0d010001,
+	0x9d00092c,
+	0x96e00000,
+	0x8d00092c,
+	0x9de00001,
+	0x600007c2,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x12010001,
+	0x400006fc,
+	0x02010000,
+	0x92e00000,
+	0x1d0100be,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x01010006,
+	0x82e00004,
+	0x83e00005,
+	0x84e00006,
+	0x85e00007,
+	0x86e00008,
+	0x87e00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee1000c,
+	0x50f00000,
+	0x1ee3000b,
+	0x92e00003,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9de00009,
+	0x9fe0000a,
+	0x1d010035,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x0601000d,
+	0x2d6a0000,
+	0xb0d00055,
+	0x1d010023,
+	0x9de00000,
+	0x8de0000b,
+	0x9de00001,
+	0x90e00002,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x15010001,
+	0x4000072a,
+	0x05010000,
+	0x95e00000,
+	0x1d0100c8,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010023,
+	0x9de00000,
+	0x8de0000b,
+	0x9de00001,
+	0x1d010001,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x3d7a0001,
+	0xb0d00002,
+	0x14010001,
+	0x4000073e,
+	0x04010000,
+	0x94e00000,
+	0x1d0100ca,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010023,
+	0x9de00000,
+	0x8de0000b,
+	0x9de00001,
+	0x1d010002,
+	0x9de00002,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x3d7a0002,
+	0xb0d00002,
+	0x13010001,
+	0x40000752,
+	0x03010000,
+	0x93e00000,
+	0x1d0100cc,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x1d010019,
+	0x9de00000,
+	0x8de0000b,
+	0x9de00001,
+	0x6000080b,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00002,
+	0x12010001,
+	0x40000764,
+	0x02010000,
+	0x92e00000,
+	0x1d0100cf,
+	0x9de00001,
+	0xcd0008ef,
+	0x9de00002,
+	0x600007ae,
+	0x8de0000c,
+	0x70d00000,
+	0x1d010002,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x90e00002,
+	0x6000080b,
+	0x01010006,
+	0x82e00003,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8de00009,
+	0x8fe0000a,
+	0x1ee1000b,
+	0x50f00000,
+	0x1ee30007,
+	0x9de00003,
+	0x9fe00004,
+	0x60000450,
+	0x6000053e,
+	0x60000432,
+	0x1d010004,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00001,
+	0x60000696,
+	0x1d010035,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x2dda0000,
+	0xb0d00018,
+	0x600006a6,
+	0x0d010001,
+	0x9de00006,
+	0x8de00006,
+	0x9de00000,
+	0xcd00061e,
+	0x9de00001,
+	0x6000070d,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x9de00000,
+	0x60000646,
+	0x8de00006,
+	0x9de00000,
+	0xcd000696,
+	0x9de00001,
+	0x6000070d,
+	0x1d010002,
+	0x9de00000,
+	0x0d010000,
+	0x9de00001,
+	0x9de00002,
+	0x6000080b,
+	0x600005eb,
+	0x01010000,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00006,
+	0x2dda0000,
+	0xb0d0000a,
+	0x8d0007e1,
+	0x9de00000,
+	0xcd000911,
+	0x9de00001,
+	0x8de00008,
+	0x9de00002,
+	0x8de00007,
+	0x9de00003,
+	0x600007e6,
+	0x600007f8,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01002d,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x1d01000c,
+	0x9de00002,
+	0x1de10007,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000145,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x6000080b,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30006,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000c,
+	0x9de00000,
+	0x6000080b,
+	0x0d010001,
+	0x1c01000b,
+	0x9ce00000,
+	0x9de00001,
+	0x1d010006,
+	0x9de00002,
+	0x6000080b,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30004,
+	0x9ae00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000822,
+	0x8de00004,
+	0x8cd00000,
+	0x1b010001,
+	0x8ae00005,
+	0x0bba000a,
+	0x0ccd000b,
+	0x9cd00000,
+	0x01010000,
+	0x8ae00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30004,
+	0x9ae00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x4000083f,
+	0x8de00004,
+	0x8cd00000,
+	0x1b010001,
+	0x8ae00005,
+	0x0bba000a,
+	0x0b03000b,
+	0x1bb30001,
+	0x0ccb000b,
+	0x9cd00000,
+	0x01010000,
+	0x8ae00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30001,
+	0x9de00000,
+	0x8de00001,
+	0x90d00000,
+	0x01010000,
+	0x8de00000,
+	0x1ee10001,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0e003f,
+	0x1ccdffff,
+	0x9cd00000,
+	0x01010000,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30003,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x0d01000d,
+	0x1c010015,
+	0x2dd5000c,
+	0xb0d00003,
+	0x310effff,
+	0x111dffff,
+	0x40000870,
+	0x8de00003,
+	0x8dd00000,
+	0x1c010001,
+	0x8be00004,
+	0x0cca000b,
+	0x0ddb000c,
+	0x2dd90000,
+	0xb0d00002,
+	0x11010001,
+	0x40000870,
+	0x01010000,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x00000400,
+	0x000008a9,
+	0x000008a4,
+	0x000008a0,
+	0x0000089e,
+	0x0000060c,
+	0x00000000,
+	0x00000055,
+	0x0000006e,
+	0x00000069,
+	0x00000074,
+	0x00000020,
+	0x00000074,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x00000020,
+	0x00000066,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x0000002c,
+	0x00000020,
+	0x00000065,
+	0x00000078,
+	0x00000069,
+	0x00000074,
+	0x00000020,
+	0x00000073,
+	0x00000074,
+	0x00000061,
+	0x00000074,
+	0x00000075,
+	0x00000073,
+	0x00000020,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x00000000,
+	0x0000003e,
+	0x00000000,
+	0x00000072,
+	0x00000075,
+	0x0000006e,
+	0x00000000,
+	0x00000074,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x00000000,
+	0x0000002d,
+	0x00000063,
+	0x00000000,
+	0x00000053,
+	0x00000068,
+	0x00000075,
+	0x00000074,
+	0x00000074,
+	0x00000069,
+	0x0000006e,
+	0x00000067,
+	0x00000020,
+	0x00000064,
+	0x0000006f,
+	0x00000077,
+	0x0000006e,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x0000000a,
+	0x00000000,
+	0x0000002f,
+	0x00000064,
+	0x00000065,
+	0x00000076,
+	0x0000002f,
+	0x00000073,
+	0x00000064,
+	0x00000061,
+	0x00000000,
+	0x0000002f,
+	0x00000064,
+	0x00000065,
+	0x00000076,
+	0x0000002f,
+	0x00000074,
+	0x00000074,
+	0x00000079,
+	0x00000032,
+	0x00000000,
+	0x0000002f,
+	0x00000064,
+	0x00000065,
+	0x00000076,
+	0x0000002f,
+	0x00000074,
+	0x00000074,
+	0x00000079,
+	0x00000031,
+	0x00000000,
+	0x0000002f,
+	0x00000076,
+	0x00000061,
+	0x00000072,
+	0x0000002f,
+	0x0000006c,
+	0x0000006f,
+	0x00000067,
+	0x0000002f,
+	0x00000000,
+	0x0000002f,
+	0x00000076,
+	0x00000061,
+	0x00000072,
+	0x00000000,
+	0x0000002f,
+	0x00000064,
+	0x00000065,
+	0x00000076,
+	0x00000000,
+	0x00000069,
+	0x0000006e,
+	0x00000069,
+	0x00000074,
+	0x0000002f,
+	0x00000069,
+	0x0000006e,
+	0x00000069,
+	0x00000074,
+	0x0000002e,
+	0x00000063,
+	0x00000000,
+	0x0000002f,
+	0x00000074,
+	0x0000006d,
+	0x00000070,
+	0x00000000,
+	0x00000050,
+	0x00000041,
+	0x00000054,
+	0x00000048,
+	0x0000003d,
+	0x0000002f,
+	0x00000062,
+	0x00000069,
+	0x0000006e,
+	0x00000000,
+	0x00000048,
+	0x0000004f,
+	0x0000004d,
+	0x00000045,
+	0x0000003d,
+	0x0000002f,
+	0x00000000,
+	0x00000061,
+	0x00000073,
+	0x00000073,
+	0x00000065,
+	0x00000072,
+	0x00000074,
+	0x00000069,
+	0x0000006f,
+	0x0000006e,
+	0x00000020,
+	0x00000066,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x00000020,
+	0x00000061,
+	0x00000074,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000025,
+	0x00000064,
+	0x0000000a,
+	0x800000ce,
+	0x00000101,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x0000073c,
+	0x00000638,
+	0x00000104,
+	0x00000440,
+	0x1ee30026,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0x8de00026,
+	0x3dd60003,
+	0xb0d00007,
+	0x8d000504,
+	0x9de00000,
+	0xcd0005ab,
+	0x9de00001,
+	0x60000509,
+	0x11010001,
+	0x400004af,
+	0x8de00027,
+	0x1dd10001,
+	0x9de00027,
+	0x8de00027,
+	0x1cd10001,
+	0x9ce00027,
+	0x84d00000,
+	0x8de00027,
+	0x83d00000,
+	0x1d010016,
+	0x9de00000,
+	0x90e00001,
+	0x94e00002,
+	0x600004b9,
+	0x0d010001,
+	0x0601000d,
+	0x2d660000,
+	0xb0d00004,
+	0x94e00000,
+	0x6000051b,
+	0x11010001,
+	0x400004af,
+	0x1d010021,
+	0x9de00000,
+	0x96e00001,
+	0x1de10019,
+	0x9de00002,
+	0x600004b9,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00002,
+	0x01010007,
+	0x400004af,
+	0x8de0001b,
+	0x1c01f000,
+	0x0ddb000c,
+	0x1c018000,
+	0x2dd9000c,
+	0xb0d00008,
+	0x8d000504,
+	0x9de00000,
+	0xcd000596,
+	0x9de00001,
+	0x94e00002,
+	0x60000509,
+	0x11010001,
+	0x400004af,
+	0x1d010020,
+	0x9de00000,
+	0x93e00001,
+	0x1de1000c,
+	0x9de00002,
+	0x600004b9,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d0002e,
+	0x8de0000e,
+	0x1c01f000,
+	0x0ddb000c,
+	0x1c014000,
+	0x2ddb000c,
+	0xb0d00028,
+	0xcd0005cf,
+	0x9de00000,
+	0x93e00001,
+	0x1d010100,
+	0x9de00002,
+	0x60000556,
+	0xcd0005cf,
+	0x9de00000,
+	0xcd000594,
+	0x9de00001,
+	0x1d010100,
+	0x9de00002,
+	0x600004bb,
+	0x94e00000,
+	0x60000539,
+	0x0d010001,
+	0xcc0005cf,
+	0x9ce00000,
+	0x9de00001,
+	0x1d010100,
+	0x9de00002,
+	0x600004bb,
+	0x1d010016,
+	0x9de00000,
+	0x1d010101,
+	0x9de00001,
+	0xcd0005cf,
+	0x9de00002,
+	0x8de0001b,
+	0x9de00003,
+	0x600004b9,
+	0x0d010001,
+	0x0501000d,
+	0x2d560000,
+	0xb0d00024,
+	0xcd0005cf,
+	0x9de00000,
+	0x6000051b,
+	0x11010001,
+	0x400004af,
+	0x1d010016,
+	0x9de00000,
+	0x1d010101,
+	0x9de00001,
+	0x93e00002,
+	0x8de0001b,
+	0x9de00003,
+	0x600004b9,
+	0x0d010001,
+	0x0501000d,
+	0x2d560000,
+	0xb0d00013,
+	0x93e00000,
+	0x6000051b,
+	0x11010001,
+	0x400004af,
+	0x1d010018,
+	0x9de00000,
+	0x95e00001,
+	0xcd0005cf,
+	0x9de00002,
+	0x97e00003,
+	0x600004b9,
+	0x0d010001,
+	0x0701000d,
+	0x2d720000,
+	0xb0d00004,
+	0xcd00058e,
+	0x9de00000,
+	0x6000051b,
+	0x400004a6,
+	0x1d010017,
+	0x9de00000,
+	0x96e00001,
+	0xcd0005cf,
+	0x9de00002,
+	0x1d010100,
+	0x9de00003,
+	0x600004b9,
+	0x0d010001,
+	0x0701000d,
+	0x2dd20000,
+	0xb0dfffe5,
+	0x1d010019,
+	0x9de00000,
+	0x96e00001,
+	0x600004b9,
+	0x1d010019,
+	0x9de00000,
+	0x95e00001,
+	0x600004b9,
+	0x01010000,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee10026,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffffa,
+	0x8de00005,
+	0x3c0effff,
+	0x1ccdffff,
+	0x0dd1000c,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0c010007,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0d01000d,
+	0x9de00004,
+	0x8de00007,
+	0x8ce00004,
+	0x0dd3000c,
+	0x9de00007,
+	0x8de00007,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x01010007,
+	0x400004f1,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8ce00006,
+	0x1bc10001,
+	0x9be00006,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00006,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00007,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00007,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00005,
+	0x90d00000,
+	0x01010007,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x000000c5,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x600004b9,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x6000057b,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x6000057d,
+	0x0d010001,
+	0x8c000504,
+	0x9ce00000,
+	0xcc0005c7,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000509,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30003,
+	0x97e00000,
+	0x9de00001,
+	0x07010000,
+	0x8de00003,
+	0x9de00002,
+	0x40000548,
+	0x8de00003,
+	0x8dd00000,
+	0x3dda002f,
+	0xb0d00001,
+	0x87e00003,
+	0x8de00003,
+	0x1dd10001,
+	0x9de00003,
+	0x8de00003,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffff4,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00002,
+	0x1d710001,
+	0x9de00002,
+	0x81e00002,
+	0x87e00000,
+	0x8de00001,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x9de00003,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x40000569,
+	0x8de00004,
+	0x1cd10001,
+	0x9ce00004,
+	0x8ce00005,
+	0x1bc10001,
+	0x9be00005,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00005,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00006,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00006,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00004,
+	0x90d00000,
+	0x81e00003,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10004,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0006cf,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x600004b9,
+	0xc10006cf,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000077,
+	0x00000072,
+	0x00000069,
+	0x00000074,
+	0x00000065,
+	0x00000000,
+	0x0000002f,
+	0x00000000,
+	0x0000006e,
+	0x0000006f,
+	0x00000074,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000075,
+	0x0000006c,
+	0x00000061,
+	0x00000072,
+	0x00000020,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000063,
+	0x00000070,
+	0x00000020,
+	0x0000005b,
+	0x0000004f,
+	0x00000050,
+	0x00000054,
+	0x00000049,
+	0x0000004f,
+	0x0000004e,
+	0x0000005d,
+	0x0000002e,
+	0x0000002e,
+	0x0000002e,
+	0x00000020,
+	0x00000053,
+	0x0000004f,
+	0x00000055,
+	0x00000052,
+	0x00000043,
+	0x00000045,
+	0x00000020,
+	0x00000044,
+	0x00000045,
+	0x00000053,
+	0x00000054,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x8000002b,
+	0x0000006b,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x00000358,
+	0x00000268,
+	0x000000f0,
+	0x00000040,
+	0x1ee30015,
+	0x96e00003,
+	0x97e00004,
+	0x9ce00005,
+	0x9de00006,
+	0x9fe00007,
+	0x8de00016,
+	0x1dd10001,
+	0x9de00016,
+	0x86d00000,
+	0x8de00015,
+	0x3dd60002,
+	0xb0d00007,
+	0x8d00046e,
+	0x9de00000,
+	0xcd0004bc,
+	0x9de00001,
+	0x60000473,
+	0x11010001,
+	0x4000043c,
+	0x1d010020,
+	0x9de00000,
+	0x96e00001,
+	0x1de10008,
+	0x9de00002,
+	0x60000498,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00004,
+	0x96e00000,
+	0x60000443,
+	0x11010001,
+	0x4000043c,
+	0x8de0000a,
+	0x1c01f000,
+	0x0ddb000c,
+	0x1c018000,
+	0x2dd9000c,
+	0xb0d00008,
+	0x8d00046e,
+	0x9de00000,
+	0xcd0004a4,
+	0x9de00001,
+	0x96e00002,
+	0x60000473,
+	0x11010001,
+	0x4000043c,
+	0x1d010025,
+	0x9de00000,
+	0x96e00001,
+	0x60000498,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00003,
+	0xcd00049a,
+	0x9de00000,
+	0x60000443,
+	0x01010007,
+	0x86e00003,
+	0x87e00004,
+	0x8ce00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10015,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000496,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000485,
+	0x0d010001,
+	0x8c00046e,
+	0x9ce00000,
+	0xcc0004ce,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000473,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x00000062,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000498,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0004d6,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000498,
+	0xc10004d6,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000072,
+	0x0000006d,
+	0x00000020,
+	0x00000066,
+	0x00000061,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x00000064,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000069,
+	0x00000073,
+	0x00000020,
+	0x0000006e,
+	0x0000006f,
+	0x00000074,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000075,
+	0x0000006c,
+	0x00000061,
+	0x00000072,
+	0x00000020,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x0000000a,
+	0x00000000,
+	0x00000075,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x00000072,
+	0x0000006d,
+	0x00000020,
+	0x0000005b,
+	0x00000046,
+	0x00000049,
+	0x0000004c,
+	0x00000045,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80000024,
+	0x00000004,
+	0x00000020,
+	0x00000000,
+	0x0000006d,
+	0x00000076,
+	0x8000001b,
+	0x00000005,
+	0x00000101,
+	0x00000021,
+	0x00000000,
+	0x0000006c,
+	0x00000073,
+	0x8000001b,
+	0x0000000a,
+	0x00000101,
+	0x00000022,
+	0x00000000,
+	0x00000068,
+	0x00000069,
+	0x00000073,
+	0x00000074,
+	0x0000006f,
+	0x00000072,
+	0x00000079,
+	0x80000016,
+	0x00000001,
+	0x00000101,
+	0x800000a0,
+	0x00000093,
+	0x19960503,
+	0x00000400,
+	0x00001000,
+	0x00000574,
+	0x00000380,
+	0x000001f4,
+	0x00000440,
+	0x1ee30024,
+	0x95e00004,
+	0x96e00005,
+	0x97e00006,
+	0x9ce00007,
+	0x9de00008,
+	0x9fe00009,
+	0x8de00024,
+	0x3dd60003,
+	0xb0d00006,
+	0x8d000496,
+	0x9de00000,
+	0xcd00053d,
+	0x9de00001,
+	0x6000049b,
+	0x40000480,
+	0x8de00025,
+	0x1dd10001,
+	0x9de00025,
+	0x85d00000,
+	0x8de00025,
+	0x1dd10001,
+	0x9de00025,
+	0x86d00000,
+	0x1d010020,
+	0x9de00000,
+	0x95e00001,
+	0x1de1000a,
+	0x9de00002,
+	0x600004de,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00003,
+	0x95e00000,
+	0x600004c0,
+	0x40000480,
+	0x1d010020,
+	0x9de00000,
+	0x96e00001,
+	0x1de10017,
+	0x9de00002,
+	0x600004de,
+	0x0d010001,
+	0x0701000d,
+	0x2d7a0000,
+	0xb0d00036,
+	0x8de00019,
+	0x1c01f000,
+	0x0ddb000c,
+	0x1c018000,
+	0x2dd9000c,
+	0xb0d0002f,
+	0x8d000496,
+	0x9de00000,
+	0xcd000526,
+	0x9de00001,
+	0x6000049b,
+	0x40000480,
+	0x1d010001,
+	0x9de00000,
+	0xcd000511,
+	0x9de00001,
+	0x96e00002,
+	0x6000049b,
+	0x1d010017,
+	0x9de00000,
+	0x90e00001,
+	0xcd00055d,
+	0x9de00002,
+	0x1d010100,
+	0x9de00003,
+	0x600004de,
+	0x0d010001,
+	0x0701000d,
+	0x8d00055d,
+	0x3dda006e,
+	0xb0d00002,
+	0x01010000,
+	0x40000481,
+	0x8d00055d,
+	0x3dda0079,
+	0xb0d0000c,
+	0x1d010025,
+	0x9de00000,
+	0x96e00001,
+	0x600004de,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d0000a,
+	0xcd000502,
+	0x9de00000,
+	0x600004c0,
+	0x40000480,
+	0x1d010001,
+	0x9de00000,
+	0xcd0004f1,
+	0x9de00001,
+	0x6000049b,
+	0x4000043b,
+	0x1d010024,
+	0x9de00000,
+	0x95e00001,
+	0x96e00002,
+	0x600004de,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00004,
+	0xcd0004e7,
+	0x9de00000,
+	0x600004c0,
+	0x40000480,
+	0x1d010025,
+	0x9de00000,
+	0x95e00001,
+	0x600004de,
+	0x0d010001,
+	0x0701000d,
+	0x2d780000,
+	0xb0d00004,
+	0xcd0004e0,
+	0x9de00000,
+	0x600004c0,
+	0x40000480,
+	0x01010000,
+	0x40000481,
+	0x11010001,
+	0x85e00004,
+	0x86e00005,
+	0x87e00006,
+	0x8ce00007,
+	0x8de00008,
+	0x8fe00009,
+	0x1ee10024,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x000000c1,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x600004de,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd00065d,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x600004de,
+	0xc100065d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x600004be,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x600004ad,
+	0x0d010001,
+	0x8c000496,
+	0x9ce00000,
+	0xcc000555,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x6000049b,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x00000075,
+	0x0000006e,
+	0x0000006c,
+	0x00000069,
+	0x0000006e,
+	0x0000006b,
+	0x00000000,
+	0x00000063,
+	0x00000061,
+	0x0000006e,
+	0x00000074,
+	0x00000020,
+	0x0000006c,
+	0x00000069,
+	0x0000006e,
+	0x0000006b,
+	0x00000000,
+	0x00000070,
+	0x0000006c,
+	0x0000007a,
+	0x00000020,
+	0x00000074,
+	0x00000079,
+	0x00000070,
+	0x00000065,
+	0x00000020,
+	0x00000079,
+	0x00000020,
+	0x0000006f,
+	0x00000072,
+	0x00000020,
+	0x0000006e,
+	0x0000000a,
+	0x00000000,
+	0x00000063,
+	0x00000061,
+	0x0000006e,
+	0x00000074,
+	0x00000020,
+	0x0000006f,
+	0x00000076,
+	0x00000065,
+	0x00000072,
+	0x00000077,
+	0x00000072,
+	0x00000069,
+	0x00000074,
+	0x00000065,
+	0x00000000,
+	0x0000006f,
+	0x00000076,
+	0x00000065,
+	0x00000072,
+	0x00000077,
+	0x00000072,
+	0x00000069,
+	0x00000074,
+	0x00000065,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000028,
+	0x00000079,
+	0x0000002f,
+	0x0000006e,
+	0x00000029,
+	0x0000003f,
+	0x00000020,
+	0x00000000,
+	0x00000064,
+	0x00000065,
+	0x00000073,
+	0x00000074,
+	0x00000020,
+	0x0000006e,
+	0x0000006f,
+	0x00000074,
+	0x00000020,
+	0x00000072,
+	0x00000065,
+	0x00000067,
+	0x00000075,
+	0x0000006c,
+	0x00000061,
+	0x00000072,
+	0x00000020,
+	0x00000066,
+	0x00000069,
+	0x0000006c,
+	0x00000065,
+	0x0000000a,
+	0x00000000,
+	0x00000075,
+	0x00000073,
+	0x00000061,
+	0x00000067,
+	0x00000065,
+	0x0000003a,
+	0x00000020,
+	0x0000006d,
+	0x00000076,
+	0x00000020,
+	0x0000005b,
+	0x00000053,
+	0x00000052,
+	0x00000043,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x00000044,
+	0x00000045,
+	0x00000053,
+	0x00000054,
+	0x0000005d,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x8000009d,
+	0x0000049c,
+	0x19960503,
+	0x00000605,
+	0x00001000,
+	0x000015f0,
+	0x000013c8,
+	0x00000228,
+	0x00000240,
+	0x1ee3001e,
+	0x92e00000,
+	0x93e00001,
+	0x94e00002,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x98e00006,
+	0x99e00007,
+	0x9ae00008,
+	0x9be00009,
+	0x9ce0000a,
+	0x9de0000b,
+	0x1de10012,
+	0xc90008f2,
+	0x88900000,
+	0x8a900001,
+	0x98d00000,
+	0x9ad00001,
+	0x88900002,
+	0x8a900003,
+	0x98d00002,
+	0x9ad00003,
+	0x88900004,
+	0x8a900005,
+	0x98d00004,
+	0x9ad00005,
+	0x88900006,
+	0x8a900007,
+	0x98d00006,
+	0x9ad00007,
+	0x88900008,
+	0x8a900009,
+	0x98d00008,
+	0x9ad00009,
+	0x8890000a,
+	0x8a90000b,
+	0x98d0000a,
+	0x9ad0000b,
+	0x90e00011,
+	0x8de0001e,
+	0x3c0e0001,
+	0x1ccd5180,
+	0x0bd7000c,
+	0x0401000b,
+	0x0dd9000c,
+	0x0201000d,
+	0x170107b2,
+	0x40000442,
+	0x0d010000,
+	0x9de0000c,
+	0x1c780190,
+	0x2dc8000d,
+	0xb0d00008,
+	0x1d780004,
+	0x8ce0000c,
+	0x2dda000c,
+	0xb0d00006,
+	0x1d780064,
+	0x8ce0000c,
+	0x2dd8000c,
+	0xb0d00002,
+	0x1442016e,
+	0x40000441,
+	0x1442016d,
+	0x17700001,
+	0x3d46016d,
+	0xb0dfffed,
+	0x15400001,
+	0x0d010000,
+	0x9de0000c,
+	0x1c780190,
+	0x2dc8000d,
+	0xb0d00008,
+	0x1d780004,
+	0x8ce0000c,
+	0x2dda000c,
+	0xb0d00006,
+	0x1d780064,
+	0x8ce0000c,
+	0x2dd8000c,
+	0xb0d00002,
+	0x1d010001,
+	0x9de00011,
+	0x0d010000,
+	0x0301000d,
+	0x0601000d,
+	0x8de00011,
+	0x3dda0001,
+	0xb0d00026,
+	0x40000471,
+	0x3d6a0001,
+	0xb0d00007,
+	0x1d52001d,
+	0x2dd60000,
+	0xb0d00001,
+	0x40000481,
+	0x13300001,
+	0x1552001d,
+	0x40000470,
+	0x1de10012,
+	0x0d61000d,
+	0x8dd00000,
+	0x0d52000d,
+	0x2dd60000,
+	0xb0d00001,
+	0x40000481,
+	0x13300001,
+	0x1de10012,
+	0x0d61000d,
+	0x8dd00000,
+	0x0552000d,
+	0x16600001,
+	0x4000045b,
+	0x40000481,
+	0x1de10012,
+	0x0d61000d,
+	0x8dd00000,
+	0x0d52000d,
+	0x2dd60000,
+	0xb0d00001,
+	0x40000481,
+	0x13300001,
+	0x1de10012,
+	0x0d61000d,
+	0x8dd00000,
+	0x0552000d,
+	0x16600001,
+	0x40000473,
+	0x2d540000,
+	0xb0d00003,
+	0x13300001,
+	0x95e00010,
+	0x40000492,
+	0x3d3a0002,
+	0xb0d00006,
+	0x8de00011,
+	0x3dda0001,
+	0xb0d00003,
+	0x1d01001d,
+	0x9de00010,
+	0x40000492,
+	0x1de10011,
+	0x0d31000d,
+	0x8dd00000,
+	0x9de00010,
+	0x1d010e10,
+	0x0c26000d,
+	0x9ce0000f,
+	0x0d28000d,
+	0x1c01003c,
+	0x0bd6000c,
+	0x9be0000e,
+	0x0dd8000c,
+	0x9de0000d,
+	0x8de0001f,
+	0x8ce00010,
+	0x9cd00000,
+	0x8de0001f,
+	0x93d00001,
+	0x8de0001f,
+	0x97d00002,
+	0x8de0001f,
+	0x8ce0000f,
+	0x9cd00003,
+	0x8de0001f,
+	0x8ce0000e,
+	0x9cd00004,
+	0x8de0001f,
+	0x8ce0000d,
+	0x9cd00005,
+	0x01010000,
+	0x82e00000,
+	0x83e00001,
+	0x84e00002,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x88e00006,
+	0x89e00007,
+	0x8ae00008,
+	0x8be00009,
+	0x8ce0000a,
+	0x8de0000b,
+	0x1ee1001e,
+	0x50f00000,
+	0x00000000,
+	0x0000096f,
+	0x00000000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0xc70004ba,
+	0x400004cb,
+	0x8d700000,
+	0x8ce00003,
+	0x2ddb000c,
+	0xb0d00002,
+	0x81700001,
+	0x400004cf,
+	0x17710002,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0dffff6,
+	0x01010000,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x0000002d,
+	0x00000078,
+	0x00000077,
+	0x00000072,
+	0x00000000,
+	0x1ee3002d,
+	0x92e00009,
+	0x93e0000a,
+	0x94e0000b,
+	0x95e0000c,
+	0x96e0000d,
+	0x97e0000e,
+	0x9be0000f,
+	0x9ce00010,
+	0x9de00011,
+	0x9fe00012,
+	0xc500097c,
+	0x1d010020,
+	0x9de00000,
+	0x8de0002d,
+	0x9de00001,
+	0x1de10020,
+	0x9de00002,
+	0x60000702,
+	0x0d010001,
+	0x9de00018,
+	0x8de00018,
+	0x2dd80000,
+	0xb0d00001,
+	0x40000571,
+	0x84e00022,
+	0x0d010005,
+	0x9de00015,
+	0x15d10001,
+	0x8ce00022,
+	0x1b01f000,
+	0x0ccb000b,
+	0x1b014000,
+	0x2dcb000b,
+	0xb0d00002,
+	0x12010064,
+	0x400004ff,
+	0x1201002d,
+	0x8de00015,
+	0x92d00000,
+	0x16010100,
+	0x13010003,
+	0x17010003,
+	0x0d010005,
+	0x9de00013,
+	0x15d10001,
+	0x0c010006,
+	0x0ccb0004,
+	0x2dc90000,
+	0xb0d00003,
+	0x8d7004d4,
+	0x9de00014,
+	0x40000510,
+	0x1d01002d,
+	0x9de00014,
+	0x8de00014,
+	0x8ce00013,
+	0x9dc00000,
+	0x166e0001,
+	0x17720001,
+	0x2d720000,
+	0xb0dfffed,
+	0x13320001,
+	0x2d320000,
+	0xb0dfffe9,
+	0x90500000,
+	0x8de00024,
+	0x9de00000,
+	0x600004be,
+	0x0d010001,
+	0x9de00017,
+	0x8de00025,
+	0x9de00000,
+	0x600004be,
+	0x0d010001,
+	0x9de00016,
+	0x1d010001,
+	0x9de00000,
+	0xcd000961,
+	0x9de00001,
+	0xcd00097c,
+	0x9de00002,
+	0x8de00023,
+	0x9de00003,
+	0x8de00017,
+	0x9de00004,
+	0x8de00016,
+	0x9de00005,
+	0x600008a4,
+	0x8de00027,
+	0x9de00019,
+	0x8de0002e,
+	0x1ddb0004,
+	0x2dd80000,
+	0xb0d0001a,
+	0x8de00019,
+	0x1c0103ff,
+	0x0ddb000c,
+	0x9de00014,
+	0x8de00014,
+	0x1c0103e8,
+	0x2dd1000c,
+	0xb0d00003,
+	0x1d0103e7,
+	0x9de00013,
+	0x40000545,
+	0x8de00014,
+	0x9de00013,
+	0x8de00013,
+	0x9de00014,
+	0x1d010001,
+	0x9de00000,
+	0xcd000955,
+	0x9de00001,
+	0x8de00019,
+	0x1ddc000a,
+	0x9de00002,
+	0x8de00014,
+	0x9de00003,
+	0x600008a4,
+	0x40000559,
+	0x1d010001,
+	0x9de00000,
+	0xcd000950,
+	0x9de00001,
+	0x8de00019,
+	0x9de00002,
+	0x600008a4,
+	0x8de0002a,
+	0x9de00000,
+	0x1de1001a,
+	0x9de00001,
+	0x60000400,
+	0x1d010001,
+	0x9de00000,
+	0xcd00092e,
+	0x9de00001,
+	0x8de0001a,
+	0x9de00002,
+	0x8de0001b,
+	0x9de00003,
+	0x8de0001c,
+	0x9de00004,
+	0x8de0001d,
+	0x9de00005,
+	0x8de0001e,
+	0x9de00006,
+	0x8de0001f,
+	0x9de00007,
+	0x8de0002d,
+	0x9de00008,
+	0x600008a4,
+	0x82e00009,
+	0x83e0000a,
+	0x84e0000b,
+	0x85e0000c,
+	0x86e0000d,
+	0x87e0000e,
+	0x8be0000f,
+	0x8ce00010,
+	0x8de00011,
+	0x8fe00012,
+	0x1ee1002d,
+	0x50f00000,
+	0x1ee3003e,
+	0x93e00004,
+	0x94e00005,
+	0x95e00006,
+	0x96e00007,
+	0x97e00008,
+	0x9ce00009,
+	0x9de0000a,
+	0x9fe0000b,
+	0xc400092c,
+	0x8de0003e,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00002,
+	0xcd00092a,
+	0x9de0003e,
+	0x8de0003e,
+	0x9de00000,
+	0x60000651,
+	0x0d010001,
+	0x0601000d,
+	0x0d010006,
+	0x2ddb0000,
+	0xb0d00041,
+	0xcd000922,
+	0x9de00000,
+	0x60000704,
+	0x11010001,
+	0x400005e9,
+	0x8d700002,
+	0x1c01002e,
+	0x2ddb000c,
+	0xb0d00005,
+	0x8de0003f,
+	0x1ddb0001,
+	0x2dda0000,
+	0xb0d00001,
+	0x400005d6,
+	0x8de0003f,
+	0x1ddb0002,
+	0x2dd80000,
+	0xb0d0001b,
+	0x1de1000c,
+	0x9de00000,
+	0x8de0003e,
+	0x9de00001,
+	0x1d010032,
+	0x9de00002,
+	0x600006dd,
+	0x1de1000c,
+	0x9de00000,
+	0xcd00092c,
+	0x9de00001,
+	0x1d010032,
+	0x9de00002,
+	0x600008b6,
+	0x1de1000c,
+	0x9de00000,
+	0x1d710002,
+	0x9de00001,
+	0x1d010032,
+	0x9de00002,
+	0x600008b6,
+	0x1de1000c,
+	0x9de00000,
+	0x8de0003f,
+	0x9de00001,
+	0x600004d9,
+	0x400005d6,
+	0x8d700001,
+	0x1c010004,
+	0x2ddb000c,
+	0xb0d00006,
+	0x8d700002,
+	0x1c01002e,
+	0x2dd9000c,
+	0xb0d00002,
+	0x03010004,
+	0x400005cd,
+	0xc3000921,
+	0x05010003,
+	0x1d010001,
+	0x9de00000,
+	0xcd00091a,
+	0x9de00001,
+	0x95e00002,
+	0x1d710002,
+	0x9de00003,
+	0x600008a4,
+	0x96e00000,
+	0x60000677,
+	0x0d010001,
+	0x0701000d,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0dfffbd,
+	0x8de0003f,
+	0x1ddb0002,
+	0x2dda0000,
+	0xb0d00005,
+	0x1d010001,
+	0x9de00000,
+	0xcd000918,
+	0x9de00001,
+	0x600008a4,
+	0x96e00000,
+	0x600006b9,
+	0x01010000,
+	0x83e00004,
+	0x84e00005,
+	0x85e00006,
+	0x86e00007,
+	0x87e00008,
+	0x8ce00009,
+	0x8de0000a,
+	0x8fe0000b,
+	0x1ee1003e,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00003,
+	0x9fe00004,
+	0x8d00089f,
+	0x9de00000,
+	0xcd0008fe,
+	0x9de00001,
+	0x600008a4,
+	0x1d010002,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0x90e00002,
+	0x60000702,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee3000d,
+	0x94e00002,
+	0x95e00003,
+	0x96e00004,
+	0x97e00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0xcd00092a,
+	0x9de0000c,
+	0x06010000,
+	0x1d010001,
+	0x0501000d,
+	0x8de0000e,
+	0x87d00001,
+	0x0d010007,
+	0x9de0000a,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00021,
+	0x8de0000a,
+	0x17d10001,
+	0x8de0000a,
+	0x8dd00000,
+	0x3dda002d,
+	0xb0d0001b,
+	0x15500001,
+	0x40000637,
+	0x84700000,
+	0x1d010068,
+	0x9de00009,
+	0x2d48000d,
+	0xb0d0000d,
+	0x8de00009,
+	0x2d42000d,
+	0xb0d00003,
+	0x3d480061,
+	0xb0d00004,
+	0x40000635,
+	0x3d48006c,
+	0xb0d00003,
+	0x40000635,
+	0x166d0001,
+	0x40000636,
+	0x166d0002,
+	0x40000636,
+	0x166d0004,
+	0x40000636,
+	0x600005f3,
+	0x17710001,
+	0x8d700000,
+	0x2dda0000,
+	0xb0dfffe7,
+	0x8de0000d,
+	0x2d56000d,
+	0xb0d00004,
+	0x8de0000e,
+	0x0d51000d,
+	0x8dd00000,
+	0x9de0000c,
+	0x8de0000c,
+	0x9de00000,
+	0x96e00001,
+	0x6000057d,
+	0x0d010001,
+	0x9de0000b,
+	0x81e0000b,
+	0x84e00002,
+	0x85e00003,
+	0x86e00004,
+	0x87e00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee1000d,
+	0x50f00000,
+	0x1ee30007,
+	0x96e00003,
+	0x97e00004,
+	0x9de00005,
+	0x9fe00006,
+	0x1d010016,
+	0x9de00000,
+	0x1d010002,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x60000702,
+	0x0d010001,
+	0x0601000d,
+	0x2d660000,
+	0xb0d00002,
+	0x01010000,
+	0x40000671,
+	0x1d01013a,
+	0x9de00000,
+	0x60000791,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x40000671,
+	0x96700000,
+	0x90700001,
+	0x90700002,
+	0x01010007,
+	0x86e00003,
+	0x87e00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x1ee30009,
+	0x97e00004,
+	0x9be00005,
+	0x9ce00006,
+	0x9de00007,
+	0x9fe00008,
+	0x8de00009,
+	0x8dd00002,
+	0x2dd80000,
+	0xb0d00016,
+	0x8de00009,
+	0x8cd00001,
+	0x8dd00002,
+	0x2dc6000d,
+	0xb0d0000b,
+	0x8de00009,
+	0x1dd10001,
+	0x8cd00000,
+	0x1bc00001,
+	0x9bd00000,
+	0x1d01001f,
+	0x0dd4000c,
+	0x8ce00009,
+	0x1cc10004,
+	0x01d1000c,
+	0x400006b2,
+	0x8de00009,
+	0x8dd00002,
+	0x3dd6000a,
+	0xb0d00002,
+	0x01010000,
+	0x400006b2,
+	0x1d010026,
+	0x9de00000,
+	0x8de00009,
+	0x8cd00000,
+	0x9ce00001,
+	0x1dd10004,
+	0x9de00002,
+	0x1d01000a,
+	0x9de00003,
+	0x60000702,
+	0x0d010001,
+	0x0701000d,
+	0x2d720000,
+	0xb0d00002,
+	0x01010000,
+	0x400006b2,
+	0x1d010001,
+	0x8ce00009,
+	0x9dc00001,
+	0x8de00009,
+	0x0c010007,
+	0x1b01001f,
+	0x0cc7000b,
+	0x0c01000c,
+	0x9cd00002,
+	0x8de00009,
+	0x11d10004,
+	0x87e00004,
+	0x8be00005,
+	0x8ce00006,
+	0x8de00007,
+	0x8fe00008,
+	0x1ee10009,
+	0x50f00000,
+	0x1ee30005,
+	0x9de00002,
+	0x9fe00003,
+	0x1d010019,
+	0x9de00000,
+	0x8de00005,
+	0x8dd00000,
+	0x9de00001,
+	0x60000702,
+	0x0d010001,
+	0x9de00004,
+	0x8de00005,
+	0x9de00000,
+	0x60000845,
+	0x81e00004,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10005,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd0009fc,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000702,
+	0xc10009fc,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30004,
+	0x9be00000,
+	0x9ce00001,
+	0x9de00002,
+	0x8de00004,
+	0x9de00003,
+	0x8de00006,
+	0x1c010001,
+	0x0dd1000c,
+	0x9de00006,
+	0x400006f0,
+	0x8de00004,
+	0x1cd10001,
+	0x9ce00004,
+	0x8ce00005,
+	0x1bc10001,
+	0x9be00005,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00005,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00006,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00006,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00004,
+	0x90d00000,
+	0x81e00003,
+	0x8be00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10004,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x60000890,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x600006cc,
+	0x0d010001,
+	0x8c00089f,
+	0x9ce00000,
+	0xcc000974,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x600008a4,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x1ee30003,
+	0x97e00000,
+	0x9ce00001,
+	0x9de00002,
+	0x87000722,
+	0x4000072c,
+	0x8de00003,
+	0x97d00000,
+	0x87700001,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d00007,
+	0x8d700003,
+	0x2dd80000,
+	0xb0dffff7,
+	0x8d700000,
+	0x8ce00004,
+	0x2dd1000c,
+	0xb0dffff3,
+	0x01010007,
+	0x87e00000,
+	0x8ce00001,
+	0x8de00002,
+	0x1ee10003,
+	0x50f00000,
+	0x1ee30004,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x8de00005,
+	0x8ce00004,
+	0x1bc10005,
+	0x07d1000b,
+	0x8cc00000,
+	0x0dc3000d,
+	0x1c010005,
+	0x0dd3000c,
+	0x9d700000,
+	0x8de00004,
+	0x8dd00001,
+	0x9d700001,
+	0x8de00004,
+	0x9d700002,
+	0x1d010001,
+	0x9d700003,
+	0x1d710005,
+	0x9d700004,
+	0x8de00004,
+	0x8ce00005,
+	0x9cd00000,
+	0x8de00004,
+	0x97d00001,
+	0x8d700001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8d700001,
+	0x97d00002,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10004,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x90e00000,
+	0x60000877,
+	0x0d010001,
+	0x0701000d,
+	0x8de00007,
+	0x1c010005,
+	0x0dd1000c,
+	0x0d01000d,
+	0x9de00000,
+	0x60000877,
+	0x0d010001,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0d01000d,
+	0x2dd60000,
+	0xb0d00002,
+	0x01010000,
+	0x4000078b,
+	0x8de00007,
+	0x9d700000,
+	0x90700001,
+	0x8de00006,
+	0x9d700002,
+	0x1d710005,
+	0x9d700004,
+	0x8de00006,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00002,
+	0x8de00006,
+	0x97d00001,
+	0x90700003,
+	0x01010007,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30008,
+	0x97e00002,
+	0x9ce00003,
+	0x9de00004,
+	0x9fe00005,
+	0x8de00008,
+	0x1c010001,
+	0x0dd3000c,
+	0x1ddc0002,
+	0x1dda0002,
+	0x1c010004,
+	0x0dd1000c,
+	0x9de00007,
+	0x8d000722,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00024,
+	0x8d000722,
+	0x9de00006,
+	0x1de10006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000723,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2dd90000,
+	0xb0d0000c,
+	0x8d700000,
+	0x8ce00007,
+	0x0dd3000c,
+	0x1c010009,
+	0x2dd1000c,
+	0xb0d00004,
+	0x97e00000,
+	0x8de00007,
+	0x9de00001,
+	0x6000073c,
+	0x90700003,
+	0x400007d2,
+	0x8de00006,
+	0x9de00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000764,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d0000e,
+	0x01010000,
+	0x400007d3,
+	0x90e00000,
+	0x8de00007,
+	0x9de00001,
+	0x60000764,
+	0x0d010001,
+	0x0701000d,
+	0x0d010007,
+	0x2ddb0000,
+	0xb0d00002,
+	0x01010000,
+	0x400007d3,
+	0x97000722,
+	0x11710005,
+	0x87e00002,
+	0x8ce00003,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10008,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00000,
+	0x9ae00001,
+	0x9be00002,
+	0x9ce00003,
+	0x9de00004,
+	0x8de00006,
+	0x87d00001,
+	0x0d010007,
+	0x9de00005,
+	0x2dd90000,
+	0xb0d00021,
+	0x8d700003,
+	0x2dd80000,
+	0xb0d0001e,
+	0x8de00006,
+	0x8cd00004,
+	0x0c01000c,
+	0x0c01000c,
+	0x0c01000c,
+	0x8dd00000,
+	0x0dc1000d,
+	0x8ce00005,
+	0x0c01000c,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00012,
+	0x8de00006,
+	0x8cd00000,
+	0x8b700000,
+	0x1a010005,
+	0x0bb1000a,
+	0x0cc1000b,
+	0x9cd00000,
+	0x8de00006,
+	0x8c700001,
+	0x9cd00001,
+	0x8de00006,
+	0x8dd00001,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d00003,
+	0x8de00006,
+	0x8cd00001,
+	0x9dc00002,
+	0x81e00006,
+	0x87e00000,
+	0x8ae00001,
+	0x8be00002,
+	0x8ce00003,
+	0x8de00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30002,
+	0x9ce00000,
+	0x9de00001,
+	0x8de00002,
+	0x3c0effff,
+	0x1ccdfffb,
+	0x01d1000c,
+	0x8ce00000,
+	0x8de00001,
+	0x1ee10002,
+	0x50f00000,
+	0x1ee30006,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8d000722,
+	0x0d01000d,
+	0x2dd90000,
+	0xb0d0001c,
+	0x8de00006,
+	0x0d01000d,
+	0x9de00005,
+	0x8c000722,
+	0x0c01000c,
+	0x2dd5000c,
+	0xb0d00015,
+	0x90e00000,
+	0x60000877,
+	0x0d010001,
+	0x0d01000d,
+	0x8ce00005,
+	0x2dc7000d,
+	0xb0d0000e,
+	0x8de00006,
+	0x9de00000,
+	0x6000080e,
+	0x0c010001,
+	0x0d01000d,
+	0x8cc00004,
+	0x0c01000c,
+	0x2ddb000c,
+	0xb0d00002,
+	0x17010001,
+	0x4000083c,
+	0x07010000,
+	0x01010007,
+	0x4000083f,
+	0x01010000,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30007,
+	0x97e00001,
+	0x9ce00002,
+	0x9de00003,
+	0x9fe00004,
+	0x8de00007,
+	0x9de00000,
+	0x60000819,
+	0x0d010001,
+	0x2dd80000,
+	0xb0d00020,
+	0x8de00007,
+	0x9de00000,
+	0x6000080e,
+	0x0d010001,
+	0x0701000d,
+	0x1d010001,
+	0x9d700003,
+	0x8d700002,
+	0x9de00006,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00009,
+	0x8de00006,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00005,
+	0x8d700002,
+	0x9de00000,
+	0x600007d9,
+	0x0d010001,
+	0x0701000d,
+	0x8d700001,
+	0x9de00005,
+	0x0c01000d,
+	0x2dc90000,
+	0xb0d00006,
+	0x8de00005,
+	0x8dd00003,
+	0x2dd80000,
+	0xb0d00002,
+	0x97e00000,
+	0x600007d9,
+	0x87e00001,
+	0x8ce00002,
+	0x8de00003,
+	0x8fe00004,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x1ee30004,
+	0x9de00002,
+	0x9fe00003,
+	0x8d000876,
+	0x0d01000d,
+	0x2ddb0000,
+	0xb0d00001,
+	0x40000884,
+	0x8de00004,
+	0x2dda0000,
+	0xb0d00002,
+	0x81000876,
+	0x4000088c,
+	0x1d010032,
+	0x9de00000,
+	0x8de00004,
+	0x9de00001,
+	0x60000702,
+	0x0d010001,
+	0x9d000876,
+	0x0101000d,
+	0x8de00002,
+	0x8fe00003,
+	0x1ee10004,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x000000d7,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000702,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x1ee30005,
+	0x97e00000,
+	0x9be00001,
+	0x9ce00002,
+	0x9de00003,
+	0x87e00005,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8dd00000,
+	0x2dda0000,
+	0xb0dffffa,
+	0x8de00005,
+	0x3c0effff,
+	0x1ccdffff,
+	0x0dd1000c,
+	0x9de00005,
+	0x8de00005,
+	0x0d01000d,
+	0x0c010007,
+	0x0dd3000c,
+	0x0d01000d,
+	0x0d01000d,
+	0x9de00004,
+	0x8de00007,
+	0x8ce00004,
+	0x0dd3000c,
+	0x9de00007,
+	0x8de00007,
+	0x2ddb0000,
+	0xb0d0000a,
+	0x01010007,
+	0x400008ec,
+	0x8de00005,
+	0x1cd10001,
+	0x9ce00005,
+	0x8ce00006,
+	0x1bc10001,
+	0x9be00006,
+	0x8cc00000,
+	0x9cd00000,
+	0x8de00006,
+	0x8dd00000,
+	0x2dd80000,
+	0xb0d00006,
+	0x8de00007,
+	0x1c010001,
+	0x0cd3000c,
+	0x9ce00007,
+	0x2ddb0000,
+	0xb0dfffee,
+	0x8de00005,
+	0x90d00000,
+	0x01010007,
+	0x87e00000,
+	0x8be00001,
+	0x8ce00002,
+	0x8de00003,
+	0x1ee10005,
+	0x50f00000,
+	0x0000001f,
+	0x0000001c,
+	0x0000001f,
+	0x0000001e,
+	0x0000001f,
+	0x0000001e,
+	0x0000001f,
+	0x0000001f,
+	0x0000001e,
+	0x0000001f,
+	0x0000001e,
+	0x0000001f,
+	0x0000006c,
+	0x00000073,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x0000006c,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x00000061,
+	0x0000005d,
+	0x00000020,
+	0x0000005b,
+	0x0000002d,
+	0x00000068,
+	0x0000005d,
+	0x00000020,
+	0x00000046,
+	0x0000004f,
+	0x0000004c,
+	0x00000044,
+	0x00000045,
+	0x00000052,
+	0x0000000a,
+	0x00000000,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000020,
+	0x00000000,
+	0x00000000,
+	0x0000006f,
+	0x00000070,
+	0x00000065,
+	0x0000006e,
+	0x00000064,
+	0x00000069,
+	0x00000072,
+	0x00000000,
+	0x0000002e,
+	0x00000000,
+	0x0000002f,
+	0x00000000,
+	0x00000025,
+	0x00000030,
+	0x00000032,
+	0x00000064,
+	0x0000002f,
+	0x00000025,
+	0x00000030,
+	0x00000032,
+	0x00000064,
+	0x0000002f,
+	0x00000025,
+	0x00000030,
+	0x00000034,
+	0x00000064,
+	0x00000020,
+	0x00000025,
+	0x00000030,
+	0x00000032,
+	0x00000064,
+	0x0000003a,
+	0x00000025,
+	0x00000030,
+	0x00000032,
+	0x00000064,
+	0x0000003a,
+	0x00000025,
+	0x00000030,
+	0x00000032,
+	0x00000064,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x00000000,
+	0x00000025,
+	0x00000035,
+	0x00000064,
+	0x00000020,
+	0x00000000,
+	0x00000025,
+	0x00000032,
+	0x00000064,
+	0x0000002e,
+	0x00000025,
+	0x0000002e,
+	0x00000033,
+	0x00000064,
+	0x0000004b,
+	0x00000042,
+	0x00000020,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000025,
+	0x00000032,
+	0x00000064,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x00000020,
+	0x00000000,
+	0x00000072,
+	0x0000006f,
+	0x0000006f,
+	0x00000074,
+	0x00000000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x8000007e,
+	0x00000068,
+	0x19960503,
+	0x0000040a,
+	0x00001000,
+	0x00000274,
+	0x00000254,
+	0x00000020,
+	0x00000240,
+	0x0000002f,
+	0x0000002e,
+	0x00000068,
+	0x00000069,
+	0x00000073,
+	0x00000074,
+	0x0000006f,
+	0x00000072,
+	0x00000079,
+	0x00000000,
+	0x1ee30008,
+	0x96e00004,
+	0x97e00005,
+	0x9de00006,
+	0x9fe00007,
+	0x1d010016,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0xcd000400,
+	0x9de00002,
+	0x60000482,
+	0x0d010001,
+	0x0601000d,
+	0x2d660000,
+	0xb0d0000d,
+	0xcd000400,
+	0x9de00000,
+	0x60000440,
+	0x11010001,
+	0x40000438,
+	0x1d010018,
+	0x9de00000,
+	0x1d010001,
+	0x9de00001,
+	0xcd00049d,
+	0x9de00002,
+	0x97e00003,
+	0x60000482,
+	0x1d010017,
+	0x9de00000,
+	0x96e00001,
+	0xcd00049d,
+	0x9de00002,
+	0x1d010080,
+	0x9de00003,
+	0x60000482,
+	0x0d010001,
+	0x0701000d,
+	0x2dd20000,
+	0xb0dfffec,
+	0x1d010019,
+	0x9de00000,
+	0x96e00001,
+	0x60000482,
+	0x01010000,
+	0x86e00004,
+	0x87e00005,
+	0x8de00006,
+	0x8fe00007,
+	0x1ee10008,
+	0x50f00000,
+	0x11e10000,
+	0x50f00000,
+	0x1ee30007,
+	0x9ce00004,
+	0x9de00005,
+	0x9fe00006,
+	0x6000043e,
+	0x0d010001,
+	0x0d01000d,
+	0x1ddc000a,
+	0x1dda000a,
+	0x1c010001,
+	0x0dd1000c,
+	0x0d01000d,
+	0x8dd00000,
+	0x0d01000d,
+	0x9de00000,
+	0x60000484,
+	0x0d010001,
+	0x8c00046b,
+	0x9ce00000,
+	0xcc000495,
+	0x9ce00001,
+	0x8ce00007,
+	0x9ce00002,
+	0x9de00003,
+	0x60000470,
+	0x8ce00004,
+	0x8de00005,
+	0x8fe00006,
+	0x1ee10007,
+	0x50f00000,
+	0x00000000,
+	0x00000000,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000001,
+	0x00000800,
+	0x80000004,
+	0x00000002,
+	0x00000002,
+	0x00000800,
+	0x80000003,
+	0x0000002c,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000f,
+	0x9de00000,
+	0x8de00006,
+	0x9de00001,
+	0x8de00007,
+	0x9de00002,
+	0x1de10008,
+	0x9de00003,
+	0x60000482,
+	0x0d010001,
+	0x0101000d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x200d0000,
+	0x50f00000,
+	0x1ee30006,
+	0x9de00004,
+	0x9fe00005,
+	0x1d01000e,
+	0x9de00000,
+	0x1d010010,
+	0x9de00001,
+	0xcd00051d,
+	0x9de00002,
+	0x8de00006,
+	0x9de00003,
+	0x60000482,
+	0xc100051d,
+	0x8de00004,
+	0x8fe00005,
+	0x1ee10006,
+	0x50f00000,
+	0x00000025,
+	0x00000073,
+	0x0000003a,
+	0x00000020,
+	0x00000025,
+	0x00000073,
+	0x0000000a,
+	0x80002b5d,
+};
+
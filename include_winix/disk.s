@@ -0,0 +1,24659 @@
+.global	DISK_RAW_SIZE
+DISK_RAW_SIZE:
+	.word	0xa000
+.global	DISK_RLE_LEN
+DISK_RLE_LEN:
+	.word	0x6047
+.global	DISK_RLE
+DISK_RLE:
+	.word	0x1d
+	.word	0xabcdefff
+	.word	0x75
+	.word	0x22
+	.word	0x2b
+	.word	0x1d
+	.word	0x400
+	.word	0x40
+	.word	0x1
+	.word	0x0
+	.word	0x400
+	.word	0x1
+	.word	0x400
+	.word	0x2
+	.word	0x400
+	.word	0x3
+	.word	0x1000
+	.word	0x8
+	.word	0x57
+	.word	0x49
+	.word	0x4e
+	.word	0x49
+	.word	0x58
+	.word	0x5f
+	.word	0x52
+	.word	0x4f
+	.word	0x4f
+	.word	0x54
+	.word	0x46
+	.word	0x53
+	.word	0x800000e3
+	.word	0x4
+	.word	0xffffffff
+	.word	0xffffffff
+	.word	0xffffffff
+	.word	0xfffff800
+	.word	0x800000fc
+	.word	0x2
+	.word	0xffffffff
+	.word	0xe0000000
+	.word	0x8000010e
+	.word	0x9
+	.word	0x41ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x400
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x7
+	.word	0x80000007
+	.word	0xc
+	.word	0x41ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x1000
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x8
+	.word	0x29
+	.word	0x52
+	.word	0x6b
+	.word	0x80000004
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x338
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x9
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x2a8
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0xa
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x194
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0xb
+	.word	0x80000007
+	.word	0xd
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x102c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0xc
+	.word	0xd
+	.word	0xe
+	.word	0xf
+	.word	0x10
+	.word	0x80000003
+	.word	0x10
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x4e0c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x11
+	.word	0x12
+	.word	0x13
+	.word	0x14
+	.word	0x15
+	.word	0x16
+	.word	0x8
+	.word	0x9
+	.word	0x80000005
+	.word	0xb
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x17
+	.word	0x18
+	.word	0x19
+	.word	0x1a
+	.word	0x1b
+	.word	0x1c
+	.word	0x1d
+	.word	0x1e
+	.word	0x80000005
+	.word	0x17
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x1f
+	.word	0x20
+	.word	0x21
+	.word	0x22
+	.word	0x23
+	.word	0x24
+	.word	0x0
+	.word	0x0
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0xe18
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x25
+	.word	0x26
+	.word	0x27
+	.word	0x28
+	.word	0x80000004
+	.word	0xf
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x32b4
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x2a
+	.word	0x2b
+	.word	0x2c
+	.word	0x2d
+	.word	0x2e
+	.word	0x2f
+	.word	0xc
+	.word	0x80000006
+	.word	0x1a
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x30
+	.word	0x31
+	.word	0x32
+	.word	0x33
+	.word	0x34
+	.word	0x35
+	.word	0x36
+	.word	0x0
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x1900
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x37
+	.word	0x38
+	.word	0x39
+	.word	0x3a
+	.word	0x3b
+	.word	0x3c
+	.word	0xe
+	.word	0x80000006
+	.word	0x4
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x3d
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x5c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x3e
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x2c8
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x3f
+	.word	0x80000007
+	.word	0x10
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x3984
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x40
+	.word	0x41
+	.word	0x42
+	.word	0x43
+	.word	0x44
+	.word	0x45
+	.word	0x12
+	.word	0x13
+	.word	0x80000005
+	.word	0xb
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x46
+	.word	0x47
+	.word	0x48
+	.word	0x49
+	.word	0x4a
+	.word	0x4b
+	.word	0x4c
+	.word	0x4d
+	.word	0x80000005
+	.word	0x4
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x4e
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x3a8
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x4f
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x204
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x50
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x380
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x51
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x13c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x53
+	.word	0x80000007
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x2bc
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x54
+	.word	0x80000007
+	.word	0xd
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x12f0
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x55
+	.word	0x56
+	.word	0x57
+	.word	0x58
+	.word	0x59
+	.word	0x80000003
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x2e4
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x5a
+	.word	0x80000007
+	.word	0xf
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x1ac4
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x5b
+	.word	0x5c
+	.word	0x5d
+	.word	0x5e
+	.word	0x5f
+	.word	0x60
+	.word	0x1c
+	.word	0x80000006
+	.word	0x4
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x61
+	.word	0x80000007
+	.word	0x1a
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x14cc
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x62
+	.word	0x63
+	.word	0x64
+	.word	0x65
+	.word	0x66
+	.word	0x67
+	.word	0x0
+	.word	0x0
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x758
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x68
+	.word	0x69
+	.word	0x80000006
+	.word	0x9
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x374
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6a
+	.word	0x80000007
+	.word	0xa
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x590
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6c
+	.word	0x6d
+	.word	0x80000006
+	.word	0x19
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x160c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6e
+	.word	0x6f
+	.word	0x70
+	.word	0x71
+	.word	0x72
+	.word	0x73
+	.word	0x0
+	.word	0x0
+	.word	0x81ed
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x290
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x6ad5229c
+	.word	0x74
+	.word	0x800001d7
+	.word	0x3
+	.word	0x1
+	.word	0x4
+	.word	0x2e
+	.word	0x8000001d
+	.word	0x4
+	.word	0x1
+	.word	0x4
+	.word	0x2e
+	.word	0x2e
+	.word	0x8000001c
+	.word	0x5
+	.word	0x2
+	.word	0x4
+	.word	0x62
+	.word	0x69
+	.word	0x6e
+	.word	0x8000001a
+	.word	0x1
+	.word	0x101
+	.word	0x800000a0
+	.word	0x3
+	.word	0x2
+	.word	0x4
+	.word	0x2e
+	.word	0x8000001d
+	.word	0x4
+	.word	0x1
+	.word	0x4
+	.word	0x2e
+	.word	0x2e
+	.word	0x8000001c
+	.word	0x8
+	.word	0x3
+	.word	0x0
+	.word	0x75
+	.word	0x70
+	.word	0x74
+	.word	0x69
+	.word	0x6d
+	.word	0x65
+	.word	0x80000017
+	.word	0x8
+	.word	0x101
+	.word	0x4
+	.word	0x0
+	.word	0x6d
+	.word	0x6b
+	.word	0x64
+	.word	0x69
+	.word	0x72
+	.word	0x80000018
+	.word	0x8
+	.word	0x101
+	.word	0x5
+	.word	0x0
+	.word	0x74
+	.word	0x6f
+	.word	0x75
+	.word	0x63
+	.word	0x68
+	.word	0x80000018
+	.word	0x7
+	.word	0x101
+	.word	0x6
+	.word	0x0
+	.word	0x6e
+	.word	0x69
+	.word	0x63
+	.word	0x65
+	.word	0x80000019
+	.word	0x6
+	.word	0x101
+	.word	0x7
+	.word	0x0
+	.word	0x77
+	.word	0x73
+	.word	0x68
+	.word	0x8000001a
+	.word	0x5
+	.word	0x101
+	.word	0xa
+	.word	0x0
+	.word	0x77
+	.word	0x63
+	.word	0x8000001b
+	.word	0x56
+	.word	0x101
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x31c
+	.word	0x1c4
+	.word	0x158
+	.word	0x0
+	.word	0x1ee30015
+	.word	0x93e00007
+	.word	0x94e00008
+	.word	0x95e00009
+	.word	0x96e0000a
+	.word	0x97e0000b
+	.word	0x9be0000c
+	.word	0x9ce0000d
+	.word	0x9de0000e
+	.word	0x9fe0000f
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0x1de10011
+	.word	0x9de00001
+	.word	0x6000046f
+	.word	0xd010001
+	.word	0x301000d
+	.word	0x1d010010
+	.word	0x9de00000
+	.word	0x1d010003
+	.word	0x9de00001
+	.word	0x6000046f
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x4360007
+	.word	0x1d01003c
+	.word	0x546000d
+	.word	0x656000d
+	.word	0x1c010018
+	.word	0xb66000c
+	.word	0x9be00010
+	.word	0x448000d
+	.word	0x558000d
+	.word	0x668000c
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0004a7
+	.word	0x9de00001
+	.word	0x8de00010
+	.word	0x9de00002
+	.word	0x96e00003
+	.word	0x95e00004
+	.word	0x94e00005
+	.word	0xd380007
+	.word	0x9de00006
+	.word	0x6000045d
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000471
+	.word	0x9de00001
+	.word	0x8de00011
+	.word	0xc010007
+	.word	0xbd7000c
+	.word	0x9be00002
+	.word	0xdd9000c
+	.word	0x9de00003
+	.word	0x8de00012
+	.word	0xdd7000c
+	.word	0x9de00004
+	.word	0x8de00012
+	.word	0xdd9000c
+	.word	0x9de00005
+	.word	0x6000045d
+	.word	0x1010000
+	.word	0x83e00007
+	.word	0x84e00008
+	.word	0x85e00009
+	.word	0x86e0000a
+	.word	0x87e0000b
+	.word	0x8be0000c
+	.word	0x8ce0000d
+	.word	0x8de0000e
+	.word	0x8fe0000f
+	.word	0x1ee10015
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x69
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x6000046f
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x75
+	.word	0x73
+	.word	0x65
+	.word	0x72
+	.word	0x20
+	.word	0x74
+	.word	0x69
+	.word	0x6d
+	.word	0x65
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x2e
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x73
+	.word	0x65
+	.word	0x63
+	.word	0x6f
+	.word	0x6e
+	.word	0x64
+	.word	0x73
+	.word	0x2c
+	.word	0x20
+	.word	0x73
+	.word	0x79
+	.word	0x73
+	.word	0x74
+	.word	0x65
+	.word	0x6d
+	.word	0x20
+	.word	0x74
+	.word	0x69
+	.word	0x6d
+	.word	0x65
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x2e
+	.word	0x25
+	.word	0x30
+	.word	0x32
+	.word	0x64
+	.word	0x20
+	.word	0x73
+	.word	0x65
+	.word	0x63
+	.word	0x6f
+	.word	0x6e
+	.word	0x64
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x55
+	.word	0x70
+	.word	0x74
+	.word	0x69
+	.word	0x6d
+	.word	0x65
+	.word	0x20
+	.word	0x69
+	.word	0x73
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x64
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x68
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x6d
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x2e
+	.word	0x25
+	.word	0x30
+	.word	0x32
+	.word	0x64
+	.word	0x73
+	.word	0xa
+	.word	0x80000033
+	.word	0x35
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x28c
+	.word	0x200
+	.word	0x8c
+	.word	0x40
+	.word	0x1ee30006
+	.word	0x97e00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00006
+	.word	0x3dd60002
+	.word	0xb0d00007
+	.word	0x8d000438
+	.word	0x9de00000
+	.word	0xcd000486
+	.word	0x9de00001
+	.word	0x6000043d
+	.word	0x11010001
+	.word	0x40000424
+	.word	0x1d010028
+	.word	0x9de00000
+	.word	0x1d0101ed
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x8dd00001
+	.word	0x9de00002
+	.word	0x60000429
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d760000
+	.word	0xb0d00005
+	.word	0xcd000480
+	.word	0x9de00000
+	.word	0x60000462
+	.word	0x11010001
+	.word	0x40000424
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0x60000429
+	.word	0x1010000
+	.word	0x87e00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x65
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000429
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0004a3
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000429
+	.word	0xc10004a3
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000460
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x6000044f
+	.word	0xd010001
+	.word	0x8c000438
+	.word	0x9ce00000
+	.word	0xcc00049b
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x6000043d
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x6d
+	.word	0x6b
+	.word	0x64
+	.word	0x69
+	.word	0x72
+	.word	0x0
+	.word	0x6d
+	.word	0x69
+	.word	0x73
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x20
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x72
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80000057
+	.word	0x2d
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x178
+	.word	0x124
+	.word	0x54
+	.word	0x0
+	.word	0x1ee30007
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00007
+	.word	0x3dd60002
+	.word	0xb0d00007
+	.word	0x8d000430
+	.word	0x9de00000
+	.word	0xcd000449
+	.word	0x9de00001
+	.word	0x60000435
+	.word	0x11010001
+	.word	0x4000041f
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010102
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x8dd00001
+	.word	0x9de00002
+	.word	0x1d0101ed
+	.word	0x9de00003
+	.word	0x60000447
+	.word	0xd010001
+	.word	0x9de00006
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x60000447
+	.word	0x1010000
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x28
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000447
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x6d
+	.word	0x69
+	.word	0x73
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x20
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x72
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0xa
+	.word	0x8000009c
+	.word	0x2ac
+	.word	0x19960503
+	.word	0x411
+	.word	0x1000
+	.word	0x1010
+	.word	0xd00
+	.word	0x310
+	.word	0x40
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d0006af
+	.word	0x9de00000
+	.word	0xcd0007c8
+	.word	0x9de00001
+	.word	0x600006b4
+	.word	0x8d0006af
+	.word	0x9de00000
+	.word	0xcd000791
+	.word	0x9de00001
+	.word	0x600006b4
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee3004c
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x1601000a
+	.word	0x5010000
+	.word	0x17010001
+	.word	0x40000458
+	.word	0x8de0004d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0xcd00078e
+	.word	0x9de00001
+	.word	0x6000071b
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00022
+	.word	0x1d700001
+	.word	0x8ce0004c
+	.word	0x2dd6000c
+	.word	0xb0d0001e
+	.word	0x1d700001
+	.word	0x8ce0004d
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x1de1004b
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x600005d6
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x8de0004b
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000c
+	.word	0x8d0006af
+	.word	0x9de00000
+	.word	0xcd000776
+	.word	0x9de00001
+	.word	0x1d700001
+	.word	0x8ce0004d
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x600006b4
+	.word	0x11010001
+	.word	0x400004d3
+	.word	0x17700001
+	.word	0x40000457
+	.word	0x8de0004d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0xcd000773
+	.word	0x9de00001
+	.word	0x6000071b
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x40000457
+	.word	0x60000400
+	.word	0x11010001
+	.word	0x400004d3
+	.word	0x17700001
+	.word	0x8de0004c
+	.word	0x2d76000d
+	.word	0xb0d00006
+	.word	0x8de0004d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x3dd8002d
+	.word	0xb0dfffbb
+	.word	0x8de0004c
+	.word	0x2d70000d
+	.word	0xb0d00003
+	.word	0x60000400
+	.word	0x11010001
+	.word	0x400004d3
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x90d00000
+	.word	0x96e00000
+	.word	0x6000052d
+	.word	0xd010001
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d00010
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x2dd90000
+	.word	0xb0d00005
+	.word	0xcd00076e
+	.word	0x9de00000
+	.word	0x600006c6
+	.word	0x11010001
+	.word	0x400004d3
+	.word	0xd010000
+	.word	0x9de0000a
+	.word	0x2d58000d
+	.word	0xb0d0000e
+	.word	0x8de0000a
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x60000572
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0xcd00075b
+	.word	0x9de00000
+	.word	0x600006c6
+	.word	0x11010001
+	.word	0x400004d3
+	.word	0x8de0004d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x1d01002f
+	.word	0x9de00001
+	.word	0x600006e4
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0000a
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x8de0004d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x600004ec
+	.word	0x400004be
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0xcd000755
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x600004ec
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x8de0004d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x6000059a
+	.word	0x60000703
+	.word	0xd010001
+	.word	0x1c010005
+	.word	0x9ce00000
+	.word	0x1ce1000b
+	.word	0x9ce00001
+	.word	0x8ce0004d
+	.word	0xc71000c
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000513
+	.word	0x8d0006af
+	.word	0x9de00000
+	.word	0xcd000740
+	.word	0x9de00001
+	.word	0x8de0004d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x600006b4
+	.word	0x11010001
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1004c
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd000804
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000513
+	.word	0xc1000804
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0x9de00003
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x400004ff
+	.word	0x8de00004
+	.word	0x1cd10001
+	.word	0x9ce00004
+	.word	0x8ce00005
+	.word	0x1bc10001
+	.word	0x9be00005
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00006
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00004
+	.word	0x90d00000
+	.word	0x81e00003
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01003b
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x60000513
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d760000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000528
+	.word	0x11720014
+	.word	0x87e00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x90d00000
+	.word	0xd010000
+	.word	0x9de00000
+	.word	0x9de00001
+	.word	0x60000515
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x2d7a000d
+	.word	0xb0d0000e
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x4000056c
+	.word	0x8de00008
+	.word	0x770000d
+	.word	0x3d0effff
+	.word	0x1dddffec
+	.word	0x2d76000d
+	.word	0xb0d00002
+	.word	0x370effff
+	.word	0x177dffec
+	.word	0x3d740013
+	.word	0xb0d00001
+	.word	0x17010013
+	.word	0x1d01003a
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x97e00003
+	.word	0x60000513
+	.word	0xd010001
+	.word	0x2dd60000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x4000056c
+	.word	0x1010007
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00009
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00011
+	.word	0x8de00006
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000d
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x1c010016
+	.word	0x9cd00000
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000595
+	.word	0x1d01003c
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x60000513
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffffa
+	.word	0x8de00005
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0xdd1000c
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xc010007
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x9de00004
+	.word	0x8de00007
+	.word	0x8ce00004
+	.word	0xdd3000c
+	.word	0x9de00007
+	.word	0x8de00007
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x1010007
+	.word	0x400005d0
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8ce00006
+	.word	0x1bc10001
+	.word	0x9be00006
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00007
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00007
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00005
+	.word	0x90d00000
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee3000d
+	.word	0x93e00000
+	.word	0x94e00001
+	.word	0x95e00002
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x16010001
+	.word	0x7010000
+	.word	0x400005e6
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000c
+	.word	0x1cd20009
+	.word	0x3dc00005
+	.word	0xb0d00003
+	.word	0x8de0000c
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x400005f2
+	.word	0x5010000
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002b
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x40000606
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002d
+	.word	0xb0d00005
+	.word	0x360effff
+	.word	0x166dffff
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000f
+	.word	0x2dda0000
+	.word	0xb0d00022
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda0030
+	.word	0xb0d0001c
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd00061
+	.word	0x14d20041
+	.word	0x4000061b
+	.word	0x8de0000d
+	.word	0x84d00001
+	.word	0x3d4a0078
+	.word	0xb0d00006
+	.word	0x1d010010
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10002
+	.word	0x9de0000d
+	.word	0x4000062b
+	.word	0x1d010008
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x4000062b
+	.word	0x1d01000a
+	.word	0x9de0000f
+	.word	0x8de0000f
+	.word	0x9de0000b
+	.word	0x3dd00002
+	.word	0xb0d00003
+	.word	0x8de0000b
+	.word	0x3dd40024
+	.word	0xb0d00048
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x40000697
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20030
+	.word	0xd01000d
+	.word	0x1c01000a
+	.word	0x2dd7000c
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x14d20030
+	.word	0x40000656
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20061
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd00041
+	.word	0x13d20061
+	.word	0x40000654
+	.word	0x8de0000d
+	.word	0x83d00000
+	.word	0x1d320041
+	.word	0x14d0000a
+	.word	0x8de0000f
+	.word	0x2d40000d
+	.word	0xb0d00001
+	.word	0x4000068f
+	.word	0x3d0e7fff
+	.word	0x1dddffff
+	.word	0xdd20004
+	.word	0x8ce0000f
+	.word	0xdd6000c
+	.word	0x2d74000d
+	.word	0xb0d00013
+	.word	0x3d6a0001
+	.word	0xb0d00003
+	.word	0x330e7fff
+	.word	0x133dffff
+	.word	0x40000668
+	.word	0x330e8000
+	.word	0x133d0000
+	.word	0x7010003
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x1c010022
+	.word	0x9cd00000
+	.word	0x40000677
+	.word	0x8de0000f
+	.word	0xd74000d
+	.word	0x7d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000a
+	.word	0x1cd20030
+	.word	0xc01000c
+	.word	0x1b01000a
+	.word	0x2dc1000b
+	.word	0xb0dfffb9
+	.word	0x1d010006
+	.word	0x9de00009
+	.word	0x8ce0000a
+	.word	0x1cc20061
+	.word	0xc01000c
+	.word	0x2dc1000d
+	.word	0xb0dfffb2
+	.word	0x8de0000a
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x8ce00009
+	.word	0x2dd1000c
+	.word	0xb0dfffac
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1640007
+	.word	0x83e00000
+	.word	0x84e00001
+	.word	0x85e00002
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000d
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x14f
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000513
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x600004db
+	.word	0xd010001
+	.word	0x8c0006af
+	.word	0x9ce00000
+	.word	0xcc0007fc
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x600006b4
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x400006ec
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de00004
+	.word	0x2dd80000
+	.word	0xb0d00004
+	.word	0x8de00006
+	.word	0x8ce00004
+	.word	0x2dca000d
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x6010007
+	.word	0x400006fa
+	.word	0x6010000
+	.word	0xd010006
+	.word	0x101000d
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x8d000702
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x60000511
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c0103ff
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x9d000702
+	.word	0x81000702
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x4000072c
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x2dd8000c
+	.word	0xb0d00001
+	.word	0x40000737
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00004
+	.word	0x1dd10001
+	.word	0x9de00004
+	.word	0xd010000
+	.word	0x9de00002
+	.word	0x8ce00003
+	.word	0x8cc00000
+	.word	0x2dc8000d
+	.word	0xb0d00005
+	.word	0x8de00004
+	.word	0x8dd00000
+	.word	0x8ce00002
+	.word	0x2dda000c
+	.word	0xb0dfffe8
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x1d2000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x6e
+	.word	0x69
+	.word	0x63
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x63
+	.word	0x61
+	.word	0x6e
+	.word	0x6e
+	.word	0x6f
+	.word	0x74
+	.word	0x20
+	.word	0x72
+	.word	0x75
+	.word	0x6e
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x2f
+	.word	0x62
+	.word	0x69
+	.word	0x6e
+	.word	0x2f
+	.word	0x0
+	.word	0x73
+	.word	0x63
+	.word	0x68
+	.word	0x65
+	.word	0x64
+	.word	0x5f
+	.word	0x73
+	.word	0x65
+	.word	0x74
+	.word	0x73
+	.word	0x63
+	.word	0x68
+	.word	0x65
+	.word	0x64
+	.word	0x75
+	.word	0x6c
+	.word	0x65
+	.word	0x72
+	.word	0x0
+	.word	0x6e
+	.word	0x69
+	.word	0x63
+	.word	0x65
+	.word	0x0
+	.word	0x2d
+	.word	0x73
+	.word	0x0
+	.word	0x49
+	.word	0x6e
+	.word	0x76
+	.word	0x61
+	.word	0x6c
+	.word	0x69
+	.word	0x64
+	.word	0x20
+	.word	0x61
+	.word	0x64
+	.word	0x6a
+	.word	0x75
+	.word	0x73
+	.word	0x74
+	.word	0x6d
+	.word	0x65
+	.word	0x6e
+	.word	0x74
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x2d
+	.word	0x6e
+	.word	0x0
+	.word	0x20
+	.word	0x20
+	.word	0x2d
+	.word	0x73
+	.word	0x20
+	.word	0x20
+	.word	0x72
+	.word	0x75
+	.word	0x6e
+	.word	0x20
+	.word	0x74
+	.word	0x68
+	.word	0x65
+	.word	0x20
+	.word	0x63
+	.word	0x6f
+	.word	0x6d
+	.word	0x6d
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x20
+	.word	0x74
+	.word	0x68
+	.word	0x65
+	.word	0x20
+	.word	0x70
+	.word	0x72
+	.word	0x6f
+	.word	0x70
+	.word	0x6f
+	.word	0x72
+	.word	0x74
+	.word	0x69
+	.word	0x6f
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x20
+	.word	0x73
+	.word	0x68
+	.word	0x61
+	.word	0x72
+	.word	0x65
+	.word	0x20
+	.word	0x63
+	.word	0x6c
+	.word	0x61
+	.word	0x73
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x75
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x6e
+	.word	0x69
+	.word	0x63
+	.word	0x65
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x6e
+	.word	0x20
+	.word	0x61
+	.word	0x64
+	.word	0x6a
+	.word	0x75
+	.word	0x73
+	.word	0x74
+	.word	0x6d
+	.word	0x65
+	.word	0x6e
+	.word	0x74
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x73
+	.word	0x5d
+	.word	0x20
+	.word	0x63
+	.word	0x6f
+	.word	0x6d
+	.word	0x6d
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x20
+	.word	0x5b
+	.word	0x61
+	.word	0x72
+	.word	0x67
+	.word	0x73
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x800000f6
+	.word	0x809
+	.word	0x19960503
+	.word	0x68d
+	.word	0x1000
+	.word	0x4df0
+	.word	0x462c
+	.word	0x7c4
+	.word	0x698
+	.word	0x1ee30014
+	.word	0x92e00003
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9be00009
+	.word	0x9ce0000a
+	.word	0x9de0000b
+	.word	0x9fe0000c
+	.word	0x6010000
+	.word	0x8de00015
+	.word	0x9de00000
+	.word	0x8de00014
+	.word	0x9de00001
+	.word	0x1d010064
+	.word	0x9de00002
+	.word	0x60000bb0
+	.word	0x8de00015
+	.word	0x701000d
+	.word	0xc010000
+	.word	0x9cd00076
+	.word	0x9cd00096
+	.word	0x9cd00095
+	.word	0x8de00015
+	.word	0xc010000
+	.word	0x9cd00098
+	.word	0x9cd00064
+	.word	0x9cd00097
+	.word	0x8de00015
+	.word	0x90d00065
+	.word	0x8de00015
+	.word	0xc010000
+	.word	0x9cd0009a
+	.word	0x9cd00099
+	.word	0x40000543
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de00013
+	.word	0x1cd20009
+	.word	0x3dc00005
+	.word	0xb0d00003
+	.word	0x8de00013
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x40000431
+	.word	0x5010000
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0dffff1
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0d00001
+	.word	0x40000549
+	.word	0x84700000
+	.word	0x1d01005c
+	.word	0x9de00012
+	.word	0x2d48000d
+	.word	0xb0d00067
+	.word	0x8de00012
+	.word	0x2d42000d
+	.word	0xb0d00010
+	.word	0x1d010022
+	.word	0x9de00011
+	.word	0x2d48000d
+	.word	0xb0d00079
+	.word	0x3d480026
+	.word	0xb0d0005a
+	.word	0x3d480027
+	.word	0xb0d00066
+	.word	0x8de00011
+	.word	0x2d40000d
+	.word	0xb0d00096
+	.word	0x3d48003c
+	.word	0xb0d00020
+	.word	0x3d48003e
+	.word	0xb0d00034
+	.word	0x400004e1
+	.word	0x1d010060
+	.word	0x9de00010
+	.word	0x2d48000d
+	.word	0xb0d0007b
+	.word	0x8de00010
+	.word	0x2d40000d
+	.word	0xb0d0008a
+	.word	0x3d48007c
+	.word	0xb0d00001
+	.word	0x400004e1
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0xd010006
+	.word	0x16d00001
+	.word	0x8ce00015
+	.word	0x1cc10076
+	.word	0xdd1000c
+	.word	0x90d00000
+	.word	0x8de00015
+	.word	0x1dd10064
+	.word	0x8cd00000
+	.word	0x1cc00001
+	.word	0x9cd00000
+	.word	0x8de00015
+	.word	0x1dd10065
+	.word	0xdc1000d
+	.word	0x96d00000
+	.word	0x40000543
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0x40000472
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de0000f
+	.word	0x1cd20009
+	.word	0x3dc00005
+	.word	0xb0d00003
+	.word	0x8de0000f
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x4000047d
+	.word	0x3010000
+	.word	0xd010003
+	.word	0x2ddb0000
+	.word	0xb0dffff1
+	.word	0x8de00015
+	.word	0x97d00095
+	.word	0x400004e9
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0x8d700000
+	.word	0x3dda003e
+	.word	0xb0d00006
+	.word	0x8de00015
+	.word	0x1c010001
+	.word	0x9cd00097
+	.word	0x17710001
+	.word	0x4000048f
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de0000e
+	.word	0x1cd20009
+	.word	0x3dc00005
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x12010001
+	.word	0x4000049a
+	.word	0x2010000
+	.word	0xd010002
+	.word	0x2ddb0000
+	.word	0xb0dffff1
+	.word	0x8de00015
+	.word	0x97d00096
+	.word	0x400004e9
+	.word	0x8de00015
+	.word	0x1c010001
+	.word	0x9cd00098
+	.word	0x400004e9
+	.word	0xd010006
+	.word	0x16d00001
+	.word	0x1c710001
+	.word	0x701000c
+	.word	0x8be00015
+	.word	0x1bb10076
+	.word	0xdd1000b
+	.word	0x9cd00000
+	.word	0x17710001
+	.word	0x400004e9
+	.word	0xd010006
+	.word	0x16d00001
+	.word	0x1c710001
+	.word	0x701000c
+	.word	0x8be00015
+	.word	0x1bb10076
+	.word	0xdd1000b
+	.word	0x9cd00000
+	.word	0x400004b8
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x3dda0027
+	.word	0xb0dffffc
+	.word	0x90700000
+	.word	0x400004e9
+	.word	0xd010006
+	.word	0x16d00001
+	.word	0xc010007
+	.word	0x17c10001
+	.word	0x8be00015
+	.word	0x1bb10076
+	.word	0xdd1000b
+	.word	0x9cd00000
+	.word	0x400004c7
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x3dda0022
+	.word	0xb0dffffc
+	.word	0x1d710001
+	.word	0x701000d
+	.word	0x90d00000
+	.word	0x17710001
+	.word	0x40000543
+	.word	0xd010006
+	.word	0x16d00001
+	.word	0xc010007
+	.word	0x17c10001
+	.word	0x8be00015
+	.word	0x1bb10076
+	.word	0xdd1000b
+	.word	0x9cd00000
+	.word	0x400004d9
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x3dda0060
+	.word	0xb0dffffc
+	.word	0x1d710001
+	.word	0x701000d
+	.word	0x90d00000
+	.word	0x17710001
+	.word	0x40000543
+	.word	0xd010006
+	.word	0x16d00001
+	.word	0x8ce00015
+	.word	0x1cc10076
+	.word	0xdd1000c
+	.word	0x97d00000
+	.word	0x400004e9
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de0000f
+	.word	0x2dd80000
+	.word	0xb0d00023
+	.word	0x8de0000f
+	.word	0x1dd20009
+	.word	0x3dd00005
+	.word	0xb0d00003
+	.word	0x8de0000f
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x400004f7
+	.word	0x3010000
+	.word	0xd010003
+	.word	0x2ddb0000
+	.word	0xb0d00016
+	.word	0x8d700000
+	.word	0x9de0000e
+	.word	0x3dd8007c
+	.word	0xb0d00012
+	.word	0x8de0000e
+	.word	0x3dd8003c
+	.word	0xb0d0000f
+	.word	0x8de0000e
+	.word	0x3dd8003e
+	.word	0xb0d0000c
+	.word	0x8de0000e
+	.word	0x3dd80027
+	.word	0xb0d00009
+	.word	0x8de0000e
+	.word	0x3dd8003d
+	.word	0xb0d00006
+	.word	0x8de0000e
+	.word	0x3dd80022
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x3dda0060
+	.word	0xb0dfffd8
+	.word	0x8d700000
+	.word	0x3dda003d
+	.word	0xb0d00029
+	.word	0x2010000
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0x8de00015
+	.word	0x1c620001
+	.word	0x1bd10076
+	.word	0xcc1000b
+	.word	0x8cc00000
+	.word	0x9cd00099
+	.word	0xd010006
+	.word	0x16d00001
+	.word	0x8ce00015
+	.word	0x1cc10076
+	.word	0xdd1000c
+	.word	0x97d00000
+	.word	0x8de00015
+	.word	0x1c620001
+	.word	0x1bd10076
+	.word	0xcc1000b
+	.word	0x8cc00000
+	.word	0x9cd0009a
+	.word	0x8d700000
+	.word	0x3dda0022
+	.word	0xb0d00001
+	.word	0x82700000
+	.word	0x8d700000
+	.word	0x3dda0027
+	.word	0xb0d00001
+	.word	0x82700000
+	.word	0x17710001
+	.word	0x40000534
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de0000d
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0x8de0000d
+	.word	0x2dda0002
+	.word	0xb0dffff8
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0d00001
+	.word	0x40000549
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0x3d66001d
+	.word	0xb0d00004
+	.word	0x8de00015
+	.word	0x8dd00064
+	.word	0x3dd00008
+	.word	0xb0dffedd
+	.word	0x8de00015
+	.word	0x1dd10076
+	.word	0xd61000d
+	.word	0x90d00000
+	.word	0x8de00015
+	.word	0x1dd10077
+	.word	0xd61000d
+	.word	0x90d00000
+	.word	0x2d640000
+	.word	0xb0d00005
+	.word	0x8de00015
+	.word	0x1dd10064
+	.word	0x8cd00000
+	.word	0x1cc00001
+	.word	0x9cd00000
+	.word	0x2d6a0000
+	.word	0xb0d00005
+	.word	0x8de00015
+	.word	0x9dd00076
+	.word	0x8de00015
+	.word	0x8dd00076
+	.word	0x90d00000
+	.word	0x8de00015
+	.word	0x96d00075
+	.word	0x1010000
+	.word	0x82e00003
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8be00009
+	.word	0x8ce0000a
+	.word	0x8de0000b
+	.word	0x8fe0000c
+	.word	0x1ee10014
+	.word	0x50f00000
+	.word	0x1ee3000e
+	.word	0x93e00003
+	.word	0x94e00004
+	.word	0x95e00005
+	.word	0x96e00006
+	.word	0x97e00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x87e0000e
+	.word	0x86e0000f
+	.word	0x8d700000
+	.word	0x3dda0022
+	.word	0xb0d00002
+	.word	0x17710001
+	.word	0x400005c2
+	.word	0x8d700000
+	.word	0x3dda0027
+	.word	0xb0d00041
+	.word	0x17710001
+	.word	0x400005c2
+	.word	0x8d700000
+	.word	0x9de0000d
+	.word	0x3dd80022
+	.word	0xb0d00003
+	.word	0x8de0000d
+	.word	0x3dda0027
+	.word	0xb0d00001
+	.word	0x90700000
+	.word	0x8d700000
+	.word	0x3dda0024
+	.word	0xb0d0002e
+	.word	0x1d710001
+	.word	0x701000d
+	.word	0x301000d
+	.word	0x40000593
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de0000c
+	.word	0x2dd80000
+	.word	0xb0d0000d
+	.word	0x1d01001a
+	.word	0x9de0000b
+	.word	0x8ce0000c
+	.word	0x1cc20041
+	.word	0xc01000c
+	.word	0x2dc1000d
+	.word	0xb0dffff4
+	.word	0x8de0000c
+	.word	0x1dd20061
+	.word	0xd01000d
+	.word	0x8ce0000b
+	.word	0x2dd1000c
+	.word	0xb0dfffee
+	.word	0x84700000
+	.word	0x90700000
+	.word	0x93e00000
+	.word	0x600010b5
+	.word	0xd010001
+	.word	0x501000d
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x94700000
+	.word	0x400005c2
+	.word	0x90600000
+	.word	0x96e00000
+	.word	0x95e00001
+	.word	0x8de00010
+	.word	0xd01000d
+	.word	0x9de00002
+	.word	0x6000154f
+	.word	0x95e00000
+	.word	0x60000b96
+	.word	0xd010001
+	.word	0x6d10006
+	.word	0x94700000
+	.word	0x400005c2
+	.word	0xd010006
+	.word	0x16d10001
+	.word	0xc010007
+	.word	0x17c10001
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0dfffbe
+	.word	0x90600000
+	.word	0x1010000
+	.word	0x83e00003
+	.word	0x84e00004
+	.word	0x85e00005
+	.word	0x86e00006
+	.word	0x87e00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee1000e
+	.word	0x50f00000
+	.word	0x2e
+	.word	0x68
+	.word	0x69
+	.word	0x73
+	.word	0x74
+	.word	0x6f
+	.word	0x72
+	.word	0x79
+	.word	0x0
+	.word	0x57
+	.word	0x49
+	.word	0x4e
+	.word	0x49
+	.word	0x58
+	.word	0x3e
+	.word	0x20
+	.word	0x0
+	.word	0x0
+	.word	0x924
+	.word	0x1753
+	.word	0xa39
+	.word	0x174d
+	.word	0xa4c
+	.word	0x1745
+	.word	0xad7
+	.word	0x1740
+	.word	0x941
+	.word	0x173b
+	.word	0xa6c
+	.word	0x1737
+	.word	0xa5f
+	.word	0x1732
+	.word	0xb3b
+	.word	0x172d
+	.word	0x9bd
+	.word	0x1728
+	.word	0x9bd
+	.word	0x1726
+	.word	0x9a1
+	.word	0x1723
+	.word	0xa2a
+	.word	0x171d
+	.word	0xb6a
+	.word	0x171a
+	.word	0xa07
+	.word	0x1714
+	.word	0x0
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010015
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x9d0018e5
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x1d010014
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x60000601
+	.word	0x90e00000
+	.word	0x8d0018e5
+	.word	0x9de00001
+	.word	0x60000c23
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x40000627
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d010045
+	.word	0x9de00001
+	.word	0xcd001705
+	.word	0x9de00002
+	.word	0x60000d8c
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010001
+	.word	0x9de00002
+	.word	0xcd0018bc
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0x1d010001
+	.word	0x9d0005e2
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x3d0e0000
+	.word	0x1ddd0001
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x1d010012
+	.word	0x9de00001
+	.word	0x3d0e0000
+	.word	0x1ddd0001
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d012101
+	.word	0x9de00001
+	.word	0x8de00009
+	.word	0x9de00002
+	.word	0x1d0101b6
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d760000
+	.word	0xb0d0000f
+	.word	0x60000b94
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd03000d
+	.word	0x1dd30001
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x101000d
+	.word	0x40000687
+	.word	0x8de0000a
+	.word	0x9de00000
+	.word	0x60000b96
+	.word	0xd010001
+	.word	0x1c010018
+	.word	0x9ce00000
+	.word	0x97e00001
+	.word	0x8ce0000a
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x9de00008
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0x60000bae
+	.word	0x81e00008
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee3006c
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x60000601
+	.word	0x8de0006c
+	.word	0x3dd40002
+	.word	0xb0d0002a
+	.word	0x8de0006d
+	.word	0x8dd00001
+	.word	0x9de00000
+	.word	0xcd001702
+	.word	0x9de00001
+	.word	0x60001058
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00021
+	.word	0x90e00008
+	.word	0x17010002
+	.word	0x400006b7
+	.word	0x1de10008
+	.word	0x9de00000
+	.word	0x8de0006d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x1d010064
+	.word	0x9de00002
+	.word	0x6000154f
+	.word	0x8de0006c
+	.word	0x1dd20001
+	.word	0x2d76000d
+	.word	0xb0d00007
+	.word	0x1de10008
+	.word	0x9de00000
+	.word	0xcd001700
+	.word	0x9de00001
+	.word	0x1d010064
+	.word	0x9de00002
+	.word	0x6000154f
+	.word	0x17700001
+	.word	0x8de0006c
+	.word	0x2d70000d
+	.word	0xb0dfffe8
+	.word	0x1de10008
+	.word	0x9de00000
+	.word	0x600008b9
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x400006fc
+	.word	0x6000060e
+	.word	0x6000063d
+	.word	0x400006ef
+	.word	0xcd0005da
+	.word	0x9de00000
+	.word	0x60001020
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x400006f0
+	.word	0x97e00000
+	.word	0x60000b96
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d680000
+	.word	0xb0d00007
+	.word	0x8d700000
+	.word	0x9de0006b
+	.word	0x3dd80023
+	.word	0xb0d00003
+	.word	0x8de0006b
+	.word	0x3dda000a
+	.word	0xb0d00001
+	.word	0x400006ef
+	.word	0x8d700000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x97e00000
+	.word	0x60000db8
+	.word	0xcd0005d1
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0x60000654
+	.word	0x1d620001
+	.word	0xdd10007
+	.word	0x8dd00000
+	.word	0x3dda000a
+	.word	0xb0d00003
+	.word	0x1d620001
+	.word	0xdd10007
+	.word	0x90d00000
+	.word	0x97e00000
+	.word	0x600008b9
+	.word	0x97e00000
+	.word	0x60001492
+	.word	0x400006c3
+	.word	0x8d0005e2
+	.word	0x2dd80000
+	.word	0xb0d00008
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0xcd0018bc
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0x1010000
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1006c
+	.word	0x50f00000
+	.word	0x1ee30015
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00015
+	.word	0x9de00000
+	.word	0xcd0016fa
+	.word	0x9de00001
+	.word	0x8de00016
+	.word	0xd01000d
+	.word	0x9de00002
+	.word	0x60000bb0
+	.word	0x8de00015
+	.word	0x9de00000
+	.word	0x8de00017
+	.word	0x9de00001
+	.word	0x8de00016
+	.word	0xd01000d
+	.word	0x9de00002
+	.word	0x6000154f
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x8de00015
+	.word	0x9de00001
+	.word	0x1de10007
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x9de00014
+	.word	0x8de00014
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x81e00014
+	.word	0x4000072f
+	.word	0x8de00009
+	.word	0x1c018000
+	.word	0xddb000c
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x7010000
+	.word	0x4000072e
+	.word	0x370effff
+	.word	0x177dffff
+	.word	0x1010007
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10015
+	.word	0x50f00000
+	.word	0x1ee30065
+	.word	0x97e00006
+	.word	0x9be00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x8de00066
+	.word	0x8ce00065
+	.word	0x1cc10065
+	.word	0xdd1000c
+	.word	0x87d00000
+	.word	0x1d010003
+	.word	0x9de0002b
+	.word	0x1de1000d
+	.word	0x9de00000
+	.word	0x1d01001e
+	.word	0x9de00001
+	.word	0x8de00065
+	.word	0x1dd10076
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x60000702
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d0000d
+	.word	0x8d000c0c
+	.word	0x9de00000
+	.word	0xcd0016e4
+	.word	0x9de00001
+	.word	0x8de00065
+	.word	0x1dd10076
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x60000c11
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000830
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x60000cdf
+	.word	0x8de00066
+	.word	0x2dda0000
+	.word	0xb0d0000f
+	.word	0x8de00065
+	.word	0x8dd00095
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0000a
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x8ce00065
+	.word	0x8cc00095
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x90e00004
+	.word	0x60000cf5
+	.word	0x8de00065
+	.word	0x9de0000b
+	.word	0x8ce00066
+	.word	0x8bd00064
+	.word	0x1bb20001
+	.word	0x2dca000b
+	.word	0xb0d0001e
+	.word	0x8de0000b
+	.word	0x8dd00096
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00019
+	.word	0x1d010101
+	.word	0x9de0000c
+	.word	0x8de00065
+	.word	0x8dd00097
+	.word	0x2dd80000
+	.word	0xb0d00004
+	.word	0x8de0000c
+	.word	0x1ddd2000
+	.word	0x9de0000c
+	.word	0x4000078a
+	.word	0x8de0000c
+	.word	0x1ddd1000
+	.word	0x9de0000c
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x8de00065
+	.word	0x8dd00096
+	.word	0x9de00002
+	.word	0x8de0000c
+	.word	0x9de00003
+	.word	0x1d0101b4
+	.word	0x9de00004
+	.word	0x60000cf5
+	.word	0x8de00065
+	.word	0x8dd00064
+	.word	0x3dd40001
+	.word	0xb0d00030
+	.word	0x8de00066
+	.word	0x1dd00001
+	.word	0x8ce00065
+	.word	0x8cc00064
+	.word	0x2dd6000c
+	.word	0xb0d00014
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x8ce00067
+	.word	0x8cc00001
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x60000d21
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x8de00067
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x60000d0c
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x8de00067
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x60000d0c
+	.word	0x8de00066
+	.word	0x2dd40000
+	.word	0xb0d00013
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x8de00068
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x60000d21
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x8de00068
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x60000d0c
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x8de00068
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x60000d0c
+	.word	0x1de10060
+	.word	0x9de00000
+	.word	0x60000d36
+	.word	0x1de1002e
+	.word	0x9de00000
+	.word	0x60001273
+	.word	0x1de1002e
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x6000123b
+	.word	0x1de1002e
+	.word	0x9de00000
+	.word	0x1d010012
+	.word	0x9de00001
+	.word	0x6000123b
+	.word	0x1de10060
+	.word	0x9de00000
+	.word	0x1de1002e
+	.word	0x9de00001
+	.word	0x60000d64
+	.word	0x1de10060
+	.word	0x9de00000
+	.word	0x8d0018e4
+	.word	0x9de00001
+	.word	0x60000d59
+	.word	0x8d0018e4
+	.word	0x2dda0000
+	.word	0xb0d00007
+	.word	0x1de10060
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x60000d7c
+	.word	0x8de0002b
+	.word	0x1ddd0008
+	.word	0x9de0002b
+	.word	0x1de10060
+	.word	0x9de00000
+	.word	0x8de0002b
+	.word	0x9de00001
+	.word	0x60000d46
+	.word	0x8d0005e2
+	.word	0x2dd80000
+	.word	0xb0d00008
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0xcd0018bc
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0x60000be7
+	.word	0xd010001
+	.word	0x1ce1002c
+	.word	0x9ce00000
+	.word	0x1ce1000d
+	.word	0x9ce00001
+	.word	0x1ce1002f
+	.word	0x9ce00002
+	.word	0x1ce10060
+	.word	0x9ce00003
+	.word	0x8ce00065
+	.word	0x1cc10076
+	.word	0xc71000c
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x60000c55
+	.word	0xd010001
+	.word	0x9de0002d
+	.word	0x1de10060
+	.word	0x9de00000
+	.word	0x60000d44
+	.word	0x1de1002f
+	.word	0x9de00000
+	.word	0x60000ced
+	.word	0x8de0002d
+	.word	0x2dd80000
+	.word	0xb0d00011
+	.word	0x60000b94
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8ce0002d
+	.word	0xc01000c
+	.word	0x9cd00000
+	.word	0xcd0016de
+	.word	0x9de00000
+	.word	0x60001097
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000830
+	.word	0x8d0018e4
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x8de0002c
+	.word	0x9d0018e4
+	.word	0x81e0002c
+	.word	0x87e00006
+	.word	0x8be00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee10065
+	.word	0x50f00000
+	.word	0x1ee30018
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x6010000
+	.word	0x8de00018
+	.word	0x8dd00075
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x400008af
+	.word	0xd010000
+	.word	0x9d0018e4
+	.word	0x701000d
+	.word	0x4000087c
+	.word	0x1d7a0001
+	.word	0x1ce1000d
+	.word	0x5d1000c
+	.word	0x8de00018
+	.word	0x8dd00064
+	.word	0x1dd20001
+	.word	0x2d76000d
+	.word	0xb0d0000e
+	.word	0x1d01001b
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x401000d
+	.word	0x2d480000
+	.word	0xb0d00006
+	.word	0xcd0016d9
+	.word	0x9de00000
+	.word	0x60001097
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x400008af
+	.word	0x8de00018
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0x95e00002
+	.word	0x96e00003
+	.word	0x60000735
+	.word	0xd010001
+	.word	0x301000d
+	.word	0x8de00018
+	.word	0x1dd1006d
+	.word	0xd71000d
+	.word	0x93d00000
+	.word	0xd010006
+	.word	0x2dd90000
+	.word	0xb0d0000a
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8d600000
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8d600001
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0x6010005
+	.word	0x17700001
+	.word	0x8de00018
+	.word	0x8dd00064
+	.word	0x2d70000d
+	.word	0xb0dfffcb
+	.word	0x7010000
+	.word	0x400008a4
+	.word	0x8de00018
+	.word	0x1dd1006d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d00001
+	.word	0x400008a3
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x8de00018
+	.word	0x1dd1006d
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x1de10017
+	.word	0x9de00002
+	.word	0x1d010002
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x401000d
+	.word	0x8de00017
+	.word	0x1ddb007f
+	.word	0x9de0000c
+	.word	0x3dd80011
+	.word	0xb0d00003
+	.word	0x8de0000c
+	.word	0x3dda0012
+	.word	0xb0d00002
+	.word	0x8d0018e4
+	.word	0x9d0018e3
+	.word	0x17700001
+	.word	0x8de00018
+	.word	0x8dd00064
+	.word	0x2d70000d
+	.word	0xb0dfffda
+	.word	0x90e00000
+	.word	0x8d0018e5
+	.word	0x9de00001
+	.word	0x60000c23
+	.word	0x8de00017
+	.word	0x1dde0008
+	.word	0x11db00ff
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee10018
+	.word	0x50f00000
+	.word	0x1ee300a8
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x7010000
+	.word	0x8de000a8
+	.word	0x9de00000
+	.word	0x1de1000d
+	.word	0x9de00001
+	.word	0x60000400
+	.word	0xd010000
+	.word	0x9de0000b
+	.word	0x8ce000a6
+	.word	0xc01000c
+	.word	0x2dc9000d
+	.word	0xb0d0002a
+	.word	0x8de000a7
+	.word	0xd01000d
+	.word	0x8ce0000b
+	.word	0x2dd9000c
+	.word	0xb0d00025
+	.word	0x1d010064
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x9de0000c
+	.word	0x8de000a7
+	.word	0x9de00000
+	.word	0x8de0000c
+	.word	0x9de00001
+	.word	0x1d010064
+	.word	0x9de00002
+	.word	0x6000056e
+	.word	0x8de0000c
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00010
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0016cb
+	.word	0x9de00001
+	.word	0x8de000a6
+	.word	0x9de00002
+	.word	0x8de0000c
+	.word	0x9de00003
+	.word	0x60000c11
+	.word	0x8de000a6
+	.word	0x9de00000
+	.word	0x8de0000c
+	.word	0x9de00001
+	.word	0x1d010001
+	.word	0x9de00002
+	.word	0x60000e5d
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x60001492
+	.word	0x1010000
+	.word	0x4000091d
+	.word	0xc70005e3
+	.word	0x400008f8
+	.word	0x17710002
+	.word	0xd010000
+	.word	0x9de0000a
+	.word	0xc010007
+	.word	0x2dc9000d
+	.word	0xb0d0000e
+	.word	0x8d700001
+	.word	0x9de00009
+	.word	0xc01000d
+	.word	0x8be0000a
+	.word	0x2dc9000b
+	.word	0xb0d00008
+	.word	0x8de00083
+	.word	0x9de00000
+	.word	0x8de00009
+	.word	0x9de00001
+	.word	0x60001058
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0dfffec
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00009
+	.word	0x8de00082
+	.word	0x9de00000
+	.word	0x1de10083
+	.word	0x9de00001
+	.word	0x8d700000
+	.word	0x70d00000
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x4000091d
+	.word	0x1de1000d
+	.word	0x9de00000
+	.word	0x60000837
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee100a8
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000be7
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x40000933
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0016c7
+	.word	0x9de00001
+	.word	0x97e00002
+	.word	0x60000c11
+	.word	0xd010006
+	.word	0x16d10001
+	.word	0x8dd00000
+	.word	0x701000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dffff3
+	.word	0x1010000
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee3000a
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00008
+	.word	0x1d010001
+	.word	0x9de00007
+	.word	0x8de0000a
+	.word	0x3dd60002
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0016b1
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x11010001
+	.word	0x4000099c
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x8dd00000
+	.word	0x3dda002d
+	.word	0xb0d0001c
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x1dd10001
+	.word	0x9de00000
+	.word	0x1de10009
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x600012a3
+	.word	0xd010001
+	.word	0x9de00008
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000b
+	.word	0x8d000c0c
+	.word	0x9de00000
+	.word	0xcd00169c
+	.word	0x9de00001
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x1dd10001
+	.word	0x9de00002
+	.word	0x60000c11
+	.word	0x11010001
+	.word	0x4000099c
+	.word	0x1d010002
+	.word	0x9de00007
+	.word	0x8de00007
+	.word	0x8ce0000b
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x1de10009
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x600012a3
+	.word	0xd010001
+	.word	0x9de00006
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000a
+	.word	0x8d000c0c
+	.word	0x9de00000
+	.word	0xcd00169c
+	.word	0x9de00001
+	.word	0x8de0000b
+	.word	0x8dd00002
+	.word	0x9de00002
+	.word	0x60000c11
+	.word	0x11010001
+	.word	0x4000099c
+	.word	0x1d01000b
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0xcd001696
+	.word	0x9de00000
+	.word	0x60001097
+	.word	0x1010000
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee1000a
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00005
+	.word	0x3dd60002
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x400009b8
+	.word	0x1d01001d
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00003
+	.word	0xcd001695
+	.word	0x9de00000
+	.word	0x60001097
+	.word	0x1010007
+	.word	0x87e00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0xc70005e3
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001681
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x400009d1
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00167a
+	.word	0x9de00001
+	.word	0x8d700001
+	.word	0x9de00002
+	.word	0x60000c11
+	.word	0x17710002
+	.word	0xd010000
+	.word	0x9de00007
+	.word	0xc010007
+	.word	0x2dc9000d
+	.word	0xb0d00005
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x8ce00007
+	.word	0x2ddb000c
+	.word	0xb0dfffee
+	.word	0x1010000
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x6c
+	.word	0x73
+	.word	0x20
+	.word	0x2d
+	.word	0x6c
+	.word	0x61
+	.word	0x68
+	.word	0x20
+	.word	0x2f
+	.word	0x62
+	.word	0x69
+	.word	0x6e
+	.word	0x20
+	.word	0x7c
+	.word	0x20
+	.word	0x67
+	.word	0x72
+	.word	0x65
+	.word	0x70
+	.word	0x20
+	.word	0x73
+	.word	0x6e
+	.word	0x61
+	.word	0x6b
+	.word	0x65
+	.word	0x20
+	.word	0x7c
+	.word	0x20
+	.word	0x77
+	.word	0x63
+	.word	0x20
+	.word	0x7c
+	.word	0x20
+	.word	0x63
+	.word	0x61
+	.word	0x74
+	.word	0x0
+	.word	0x1ee30005
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x7010000
+	.word	0xcd0009e2
+	.word	0x9de00000
+	.word	0x600008b9
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2dd80000
+	.word	0xb0d00001
+	.word	0x40000a18
+	.word	0x17700001
+	.word	0x3d70000a
+	.word	0xb0dffff5
+	.word	0x1010000
+	.word	0x86e00001
+	.word	0x87e00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1b
+	.word	0x5b
+	.word	0x30
+	.word	0x3b
+	.word	0x30
+	.word	0x48
+	.word	0x1b
+	.word	0x5b
+	.word	0x32
+	.word	0x4a
+	.word	0x0
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001677
+	.word	0x9de00001
+	.word	0xcd000a1f
+	.word	0x9de00002
+	.word	0x60000c11
+	.word	0x1010000
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00164c
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x1d01000d
+	.word	0x9de00000
+	.word	0x1d010004
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001631
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x1d01000d
+	.word	0x9de00000
+	.word	0x1d010005
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d01000d
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0x1010000
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x1c010001
+	.word	0x9ce00000
+	.word	0xcc00162d
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x60000c11
+	.word	0x1010000
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000e
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x98e00002
+	.word	0x99e00003
+	.word	0x9ae00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x16010001
+	.word	0x40000aca
+	.word	0x1de10009
+	.word	0x1c010005
+	.word	0xcc40006
+	.word	0x8be0000e
+	.word	0x9c1000b
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x88900002
+	.word	0x8a900003
+	.word	0x98d00002
+	.word	0x9ad00003
+	.word	0x88900004
+	.word	0x98d00004
+	.word	0x7010006
+	.word	0x40000aaf
+	.word	0x1d010005
+	.word	0xdd40007
+	.word	0x8ce0000e
+	.word	0xbd1000c
+	.word	0x9be00008
+	.word	0x1dd20005
+	.word	0x9d1000c
+	.word	0x8de00008
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x88900002
+	.word	0x8a900003
+	.word	0x98d00002
+	.word	0x9ad00003
+	.word	0x88900004
+	.word	0x98d00004
+	.word	0x17720001
+	.word	0x2d740000
+	.word	0xb0d00009
+	.word	0x1d010005
+	.word	0xdd40007
+	.word	0x1dd20005
+	.word	0x8ce0000e
+	.word	0xdd1000c
+	.word	0x8dd00003
+	.word	0x8ce0000c
+	.word	0x2dd0000c
+	.word	0xb0dfffe2
+	.word	0x1d010005
+	.word	0xdd40007
+	.word	0x8ce0000e
+	.word	0xdd1000c
+	.word	0x19e10009
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x88900002
+	.word	0x8a900003
+	.word	0x98d00002
+	.word	0x9ad00003
+	.word	0x88900004
+	.word	0x98d00004
+	.word	0x16600001
+	.word	0x8de0000f
+	.word	0x2d60000d
+	.word	0xb0dfffbe
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x88e00002
+	.word	0x89e00003
+	.word	0x8ae00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x1ee1000e
+	.word	0x50f00000
+	.word	0x1ee3000d
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9be00009
+	.word	0x9ce0000a
+	.word	0x9de0000b
+	.word	0x9fe0000c
+	.word	0x8de0000d
+	.word	0x3dd60002
+	.word	0xb0d00008
+	.word	0x1d01000d
+	.word	0x9de00000
+	.word	0x1d010003
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x40000b33
+	.word	0x8de0000e
+	.word	0x8dd00001
+	.word	0x9de00000
+	.word	0xcd00162a
+	.word	0x9de00001
+	.word	0x60001058
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x8d000c0c
+	.word	0x9de00000
+	.word	0xcd001618
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x11010001
+	.word	0x40000b33
+	.word	0x1d01000d
+	.word	0x9de00000
+	.word	0x1d010009
+	.word	0x9de00001
+	.word	0xcd00177c
+	.word	0x9de00002
+	.word	0x1d010040
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d660000
+	.word	0xb0d00005
+	.word	0xcd001740
+	.word	0x9de00000
+	.word	0x60001097
+	.word	0x11010001
+	.word	0x40000b33
+	.word	0xcd00177c
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000a80
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0015e9
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x7010000
+	.word	0x40000b2b
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0015cd
+	.word	0x9de00001
+	.word	0x1d010005
+	.word	0xdd40007
+	.word	0x8cd0177c
+	.word	0xc01000c
+	.word	0x1b010001
+	.word	0xcc3000b
+	.word	0x9ce00002
+	.word	0x8cd0177f
+	.word	0x9ce00003
+	.word	0x8cd01780
+	.word	0x9ce00004
+	.word	0x8cd0177d
+	.word	0x9ce00005
+	.word	0x8dd0177e
+	.word	0x9de00006
+	.word	0x60000c11
+	.word	0x17700001
+	.word	0x2d700006
+	.word	0xb0dfffe9
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001591
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x1010000
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8be00009
+	.word	0x8ce0000a
+	.word	0x8de0000b
+	.word	0x8fe0000c
+	.word	0x1ee1000d
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00006
+	.word	0x8de00007
+	.word	0x3dd40001
+	.word	0xb0d00018
+	.word	0x8de00008
+	.word	0x8dd00001
+	.word	0x9de00000
+	.word	0x1de10005
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x600012a3
+	.word	0xd010001
+	.word	0x9de00006
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000a
+	.word	0x8d000c0c
+	.word	0x9de00000
+	.word	0xcd00169c
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x8dd00001
+	.word	0x9de00002
+	.word	0x60000c11
+	.word	0x11010001
+	.word	0x40000b66
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00158b
+	.word	0x9de00001
+	.word	0x60000c11
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x60000bae
+	.word	0x11010001
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x90e00000
+	.word	0x8d0018e3
+	.word	0x9de00001
+	.word	0x60000c23
+	.word	0x1d01000b
+	.word	0x9de00000
+	.word	0x8d0018e3
+	.word	0xd03000d
+	.word	0x9de00001
+	.word	0x1d010013
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d0000c
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x8d0018e3
+	.word	0xd03000d
+	.word	0x9de00001
+	.word	0x1de10007
+	.word	0x9de00002
+	.word	0x1d010002
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x90e00000
+	.word	0x8d0018e5
+	.word	0x9de00001
+	.word	0x60000c23
+	.word	0x1010007
+	.word	0x87e00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00003
+	.word	0x9de00002
+	.word	0x40000b9f
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffff9
+	.word	0x8de00003
+	.word	0xd01000d
+	.word	0x8ce00002
+	.word	0xc01000c
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0x101000d
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0x9de00003
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x40000bc3
+	.word	0x8de00004
+	.word	0x1cd10001
+	.word	0x9ce00004
+	.word	0x8ce00005
+	.word	0x1bc10001
+	.word	0x9be00005
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00006
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00004
+	.word	0x90d00000
+	.word	0x81e00003
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0018e6
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xc10018e6
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x8d000be6
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x60000b94
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c0103ff
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x9d000be6
+	.word	0x81000be6
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x24
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x1d01000c
+	.word	0x9de00002
+	.word	0x1de10007
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x80000006
+	.word	0xb40
+	.word	0xbff
+	.word	0xc05
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00005
+	.word	0x2dd90000
+	.word	0xb0d0000b
+	.word	0x87e00003
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce00004
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de00005
+	.word	0x2ddb0000
+	.word	0xb0dffff6
+	.word	0x81e00003
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30044
+	.word	0x98e00003
+	.word	0x99e00004
+	.word	0x9ae00005
+	.word	0x9be00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010039
+	.word	0x9de00002
+	.word	0x60000c3d
+	.word	0x8de00045
+	.word	0x9de0000b
+	.word	0x8de00048
+	.word	0x9de0000c
+	.word	0x8de00049
+	.word	0x9de0000d
+	.word	0x8de00046
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0000a
+	.word	0x1de1000e
+	.word	0x89e00046
+	.word	0x19910031
+	.word	0x1bd10031
+	.word	0x19930001
+	.word	0x1bb30001
+	.word	0x88900000
+	.word	0x98b00000
+	.word	0x2ad1000b
+	.word	0xb0affffa
+	.word	0x8de00047
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x1de1003f
+	.word	0x89e00047
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x88900002
+	.word	0x8a900003
+	.word	0x98d00002
+	.word	0x9ad00003
+	.word	0x88900004
+	.word	0x98d00004
+	.word	0x1d010039
+	.word	0x9de00000
+	.word	0x1de1000b
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x9de0000a
+	.word	0x8de0000a
+	.word	0x2dd60000
+	.word	0xb0d0000b
+	.word	0x60000b94
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x101000d
+	.word	0x40000ca4
+	.word	0x8de00044
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00044
+	.word	0x8ce0000a
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x88e00003
+	.word	0x89e00004
+	.word	0x8ae00005
+	.word	0x8be00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee10044
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0xd010000
+	.word	0x9de00004
+	.word	0x8ce00007
+	.word	0x2dc0000d
+	.word	0xb0d00004
+	.word	0x8de00008
+	.word	0x8ce00004
+	.word	0x2dd6000c
+	.word	0xb0d00002
+	.word	0x11010009
+	.word	0x40000cd9
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x3dd00008
+	.word	0xb0d00002
+	.word	0x1101000c
+	.word	0x40000cd9
+	.word	0x8de00005
+	.word	0x8cd00000
+	.word	0x1bc00001
+	.word	0x9bd00000
+	.word	0x1d010006
+	.word	0xdd4000c
+	.word	0x8ce00005
+	.word	0x1cc10001
+	.word	0x7d1000c
+	.word	0x8de00006
+	.word	0x9d700000
+	.word	0x8de00007
+	.word	0x9d700001
+	.word	0x8de00008
+	.word	0x9d700002
+	.word	0x8de00009
+	.word	0x9d700003
+	.word	0x8de0000a
+	.word	0x9d700004
+	.word	0x8de0000b
+	.word	0x9d700005
+	.word	0x1010000
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010031
+	.word	0x9de00002
+	.word	0x60000c3d
+	.word	0x1010000
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30001
+	.word	0x9de00000
+	.word	0x8de00001
+	.word	0x90d00000
+	.word	0x1010000
+	.word	0x8de00000
+	.word	0x1ee10001
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de00009
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x8de0000b
+	.word	0x9de00004
+	.word	0x8de0000c
+	.word	0x9de00005
+	.word	0x8de0000d
+	.word	0x9de00006
+	.word	0x60000cad
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de00009
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0xd010000
+	.word	0x9de00003
+	.word	0x90e00004
+	.word	0x9de00005
+	.word	0x90e00006
+	.word	0x60000cad
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de00009
+	.word	0x9de00000
+	.word	0x1d010003
+	.word	0x9de00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x8de0000b
+	.word	0x9de00003
+	.word	0x90e00004
+	.word	0x90e00005
+	.word	0x90e00006
+	.word	0x60000cad
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010005
+	.word	0x9de00002
+	.word	0x60000c3d
+	.word	0x1010000
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1010000
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00003
+	.word	0x3c0effff
+	.word	0x1ccdfff0
+	.word	0xddb000c
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x11010016
+	.word	0x40000d55
+	.word	0x8de00002
+	.word	0x8ce00003
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x8ce00003
+	.word	0x9cd00001
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x8ce00003
+	.word	0x8cc00000
+	.word	0x9cd00002
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x8ce00003
+	.word	0x8cc00000
+	.word	0x9cd00003
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00003
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x11010009
+	.word	0x40000d88
+	.word	0x8de00002
+	.word	0x8ce00003
+	.word	0x9cd00004
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00006
+	.word	0x2dda0000
+	.word	0xb0d0000a
+	.word	0x8d000c0c
+	.word	0x9de00000
+	.word	0xcd001757
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x60000c11
+	.word	0x60000ea3
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0xc10018f6
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x8d0018f6
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00001
+	.word	0x40000db4
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x9d0018f6
+	.word	0x900018f7
+	.word	0x900018f8
+	.word	0x1d01000a
+	.word	0x9d0018f9
+	.word	0x900018fa
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x60000da2
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x60000e3b
+	.word	0xd010001
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8d0018f8
+	.word	0x8c0018f9
+	.word	0x2dd0000c
+	.word	0xb0d0000d
+	.word	0x8d0018f9
+	.word	0x1dda0001
+	.word	0x9d0018f9
+	.word	0x8d0018f6
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x8c0018f9
+	.word	0xc01000c
+	.word	0xdd5000c
+	.word	0x9de00001
+	.word	0x60001112
+	.word	0xd010001
+	.word	0x9d0018f6
+	.word	0x8d0018f8
+	.word	0x8c0018f6
+	.word	0xdd1000c
+	.word	0x97d00000
+	.word	0x8d0018f7
+	.word	0x1dd00001
+	.word	0x9d0018f7
+	.word	0x8d0018f8
+	.word	0x1dd00001
+	.word	0x9d0018f8
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00003
+	.word	0x9de00002
+	.word	0x2dd00000
+	.word	0xb0d00004
+	.word	0x8d0018f8
+	.word	0x8ce00002
+	.word	0x2dc0000d
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000dfb
+	.word	0x8de00003
+	.word	0x8c0018f6
+	.word	0xdd1000c
+	.word	0x81d00000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8d0018f7
+	.word	0x2dd20000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000e0e
+	.word	0x8d0018f7
+	.word	0x1dd20001
+	.word	0x9d0018f7
+	.word	0x8d0018f7
+	.word	0x8c0018f6
+	.word	0xdd1000c
+	.word	0x81d00000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8d0018f7
+	.word	0x8c0018f8
+	.word	0x1cc20001
+	.word	0x2dd0000c
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000e23
+	.word	0x8d0018f7
+	.word	0x1dd00001
+	.word	0x9d0018f7
+	.word	0x8d0018f7
+	.word	0x8c0018f6
+	.word	0xdd1000c
+	.word	0x81d00000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8d0018f7
+	.word	0x2dd00000
+	.word	0xb0d00004
+	.word	0x8d0018f7
+	.word	0x8c0018f8
+	.word	0x2dd0000c
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000e37
+	.word	0x8d0018f7
+	.word	0x8c0018f6
+	.word	0xdd1000c
+	.word	0x81d00000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x60000b96
+	.word	0xd010001
+	.word	0x1c010001
+	.word	0x6d1000c
+	.word	0x96e00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000e56
+	.word	0x97e00000
+	.word	0x8de00008
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000bb0
+	.word	0x1010007
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de0000a
+	.word	0x2dda0000
+	.word	0xb0d00009
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x600010b5
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000e9c
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x60000b96
+	.word	0xd010001
+	.word	0x8ce00009
+	.word	0x9ce00000
+	.word	0x60000b96
+	.word	0xc010001
+	.word	0xdd1000c
+	.word	0x1c010002
+	.word	0xdd1000c
+	.word	0x601000d
+	.word	0xd010006
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000e9c
+	.word	0x97e00000
+	.word	0x8de00008
+	.word	0x9de00001
+	.word	0xd010006
+	.word	0x9de00002
+	.word	0x60000bb0
+	.word	0x97e00000
+	.word	0xcd001772
+	.word	0x9de00001
+	.word	0xd010006
+	.word	0x9de00002
+	.word	0x6000154f
+	.word	0x97e00000
+	.word	0x8de00009
+	.word	0x9de00001
+	.word	0xd010006
+	.word	0x9de00002
+	.word	0x6000154f
+	.word	0x97e00000
+	.word	0x60001199
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x1c01000b
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x1d010006
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x40000ebe
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de00004
+	.word	0x2dd80000
+	.word	0xb0d00004
+	.word	0x8de00006
+	.word	0x8ce00004
+	.word	0x2dca000d
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x6010007
+	.word	0x40000ecc
+	.word	0x6010000
+	.word	0xd010006
+	.word	0x101000d
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x0
+	.word	0x18fb
+	.word	0x0
+	.word	0x1ee30008
+	.word	0x9be00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010001
+	.word	0x9de00002
+	.word	0x8d000ed5
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0x8d000ed5
+	.word	0x1dd10003
+	.word	0x8cd00000
+	.word	0x3b0effff
+	.word	0x1bbdfff5
+	.word	0xb01000b
+	.word	0xccb000b
+	.word	0x9cd00000
+	.word	0x8d000ed5
+	.word	0x1c010001
+	.word	0x9cd0000b
+	.word	0x8d000ed5
+	.word	0x90d0000a
+	.word	0x1d010001
+	.word	0x9d000ed4
+	.word	0x8be00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d010008
+	.word	0x9de00006
+	.word	0x8d000c36
+	.word	0x1dd20001
+	.word	0x9d000c36
+	.word	0x8d000c37
+	.word	0x1dd20001
+	.word	0x9d000c37
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x8d000c3c
+	.word	0x9de00003
+	.word	0x60001514
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9de00000
+	.word	0x9fe00001
+	.word	0x40000f15
+	.word	0x60000ef9
+	.word	0x8d000c37
+	.word	0x2dd20000
+	.word	0xb0dffffc
+	.word	0x8de00000
+	.word	0x8fe00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x94e00004
+	.word	0x95e00005
+	.word	0x96e00006
+	.word	0x97e00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x60000f10
+	.word	0xd010000
+	.word	0x9d000c36
+	.word	0x9d000c37
+	.word	0x8de0000b
+	.word	0xd01000d
+	.word	0xcc000e12
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d0000a
+	.word	0x8d000ed6
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d00005
+	.word	0x60000e27
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x90000ed6
+	.word	0x40000f4a
+	.word	0x8de0000b
+	.word	0xd01000d
+	.word	0xcc000dff
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00008
+	.word	0x8d000ed6
+	.word	0x3dda0001
+	.word	0xb0d00005
+	.word	0x60000e27
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x90000ed6
+	.word	0x40000f4a
+	.word	0x8de0000b
+	.word	0x70d00000
+	.word	0xd010001
+	.word	0x501000d
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0d0000c
+	.word	0x8de0000b
+	.word	0xd01000d
+	.word	0xcc000dff
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00003
+	.word	0x340effff
+	.word	0x144dffff
+	.word	0x40000f57
+	.word	0x14010001
+	.word	0x94000ed6
+	.word	0x40000f79
+	.word	0x86500000
+	.word	0x96e00000
+	.word	0x60000b96
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0xd73000d
+	.word	0xdd10006
+	.word	0x8dd00000
+	.word	0x3dda000a
+	.word	0xb0d00005
+	.word	0x1d010001
+	.word	0xd73000d
+	.word	0x701000d
+	.word	0xdd10006
+	.word	0x90d00000
+	.word	0x96e00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x97e00002
+	.word	0x8d000c3c
+	.word	0x9de00003
+	.word	0x60001514
+	.word	0x8d000c35
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1d010080
+	.word	0x9de00002
+	.word	0x60000bb0
+	.word	0xd010007
+	.word	0x9d000c37
+	.word	0x9d000c36
+	.word	0x84e00004
+	.word	0x85e00005
+	.word	0x86e00006
+	.word	0x87e00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x60000da0
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700002
+	.word	0x9d700001
+	.word	0x87e00000
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x90e0000a
+	.word	0xd010000
+	.word	0x9d000c36
+	.word	0x9d000c37
+	.word	0x9d000c39
+	.word	0x9d000c3a
+	.word	0x1d010080
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x9d000c35
+	.word	0x40001012
+	.word	0x1de1000a
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x8d000c3b
+	.word	0x9de00003
+	.word	0x600014fb
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x2d7a000d
+	.word	0xb0d0000f
+	.word	0x60000b94
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x1c010004
+	.word	0x2ddb000c
+	.word	0xb0d00001
+	.word	0x40001012
+	.word	0x1010007
+	.word	0x40001019
+	.word	0x8de0000a
+	.word	0x8c000ed5
+	.word	0x8cc00009
+	.word	0xc01000c
+	.word	0x2dda000c
+	.word	0xb0d00003
+	.word	0x1d010001
+	.word	0x9d000c3a
+	.word	0x40001013
+	.word	0x8de0000a
+	.word	0x8c000ed5
+	.word	0x8cc00007
+	.word	0xc01000c
+	.word	0x2dda000c
+	.word	0xb0d00005
+	.word	0x8d000c36
+	.word	0x2dd40000
+	.word	0xb0d00041
+	.word	0x60000ef9
+	.word	0x40001012
+	.word	0x8de0000a
+	.word	0x8c000ed5
+	.word	0x8cc00008
+	.word	0xc01000c
+	.word	0x2dda000c
+	.word	0xb0d00002
+	.word	0x60000f10
+	.word	0x40001012
+	.word	0x8de0000a
+	.word	0x3dda0010
+	.word	0xb0d00004
+	.word	0xcd000dff
+	.word	0x9de00000
+	.word	0x60000f1c
+	.word	0x40001012
+	.word	0x8de0000a
+	.word	0x3dda000e
+	.word	0xb0d00004
+	.word	0xcd000e12
+	.word	0x9de00000
+	.word	0x60000f1c
+	.word	0x40001012
+	.word	0x8d000c37
+	.word	0x3dd00080
+	.word	0xb0d00001
+	.word	0x40001013
+	.word	0x8de0000a
+	.word	0x3dda000d
+	.word	0xb0d00002
+	.word	0x1d01000a
+	.word	0x9de0000a
+	.word	0x8de0000a
+	.word	0x9de00009
+	.word	0x1cd20020
+	.word	0xc01000c
+	.word	0x1b01005f
+	.word	0x2dc1000b
+	.word	0xb0d00003
+	.word	0x8de00009
+	.word	0x3dda000a
+	.word	0xb0d00012
+	.word	0x8d000c36
+	.word	0x1dd00001
+	.word	0x9d000c36
+	.word	0x8d000c37
+	.word	0x1cd00001
+	.word	0x9c000c37
+	.word	0x8c000c35
+	.word	0xdd1000c
+	.word	0x8ce0000a
+	.word	0x9cd00000
+	.word	0x1de1000a
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x8d000c3c
+	.word	0x9de00003
+	.word	0x60001514
+	.word	0x8de0000a
+	.word	0x3dda000a
+	.word	0xb0d00001
+	.word	0x40001013
+	.word	0x40000fa2
+	.word	0x60000f82
+	.word	0x8d000c37
+	.word	0x8c000c35
+	.word	0xdd1000c
+	.word	0x90d00000
+	.word	0x1010000
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8d000ed4
+	.word	0x2dda0000
+	.word	0xb0d00001
+	.word	0x60000ed7
+	.word	0x8de00009
+	.word	0x9d000c38
+	.word	0x8d000c38
+	.word	0x9de00000
+	.word	0x60000b96
+	.word	0xd010001
+	.word	0x8c000c38
+	.word	0x9ce00000
+	.word	0x1c010001
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0xcd000c05
+	.word	0x9de00003
+	.word	0x60001514
+	.word	0x8d000ed4
+	.word	0x2dd80000
+	.word	0xb0d00008
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x8d000ed5
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0x60000f90
+	.word	0xd010001
+	.word	0x9de00008
+	.word	0xd010000
+	.word	0x9de00007
+	.word	0x8c000c3a
+	.word	0x2dc8000d
+	.word	0xb0d00004
+	.word	0x8d000c37
+	.word	0x8ce00007
+	.word	0x2dd8000c
+	.word	0xb0d00003
+	.word	0x8de00008
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40001053
+	.word	0x81000c35
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x40001069
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x2dd8000c
+	.word	0xb0d00001
+	.word	0x40001074
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00004
+	.word	0x1dd10001
+	.word	0x9de00004
+	.word	0xd010000
+	.word	0x9de00002
+	.word	0x8ce00003
+	.word	0x8cc00000
+	.word	0x2dc8000d
+	.word	0xb0d00005
+	.word	0x8de00004
+	.word	0x8dd00000
+	.word	0x8ce00002
+	.word	0x2dda000c
+	.word	0xb0dfffe8
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x1d2000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d00107d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x4000108b
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x8100107d
+	.word	0x40001093
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x9d00107d
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000b94
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000bd5
+	.word	0xd010001
+	.word	0x8c000c0c
+	.word	0x9ce00000
+	.word	0xcc001774
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000c11
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x95e00000
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00007
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400010e6
+	.word	0x60000be7
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x400010de
+	.word	0x87e00007
+	.word	0x400010c9
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de00006
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0xd010006
+	.word	0x16d10001
+	.word	0x8dd00000
+	.word	0x8ce00006
+	.word	0x2dc8000d
+	.word	0xb0dffff5
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0d00003
+	.word	0x8d600000
+	.word	0x3dd8003d
+	.word	0xb0d00001
+	.word	0x400010de
+	.word	0x1d610001
+	.word	0xd01000d
+	.word	0x101000d
+	.word	0x400010e6
+	.word	0xd010005
+	.word	0x15d10001
+	.word	0x8dd00000
+	.word	0x601000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dfffe1
+	.word	0x1010000
+	.word	0x85e00000
+	.word	0x86e00001
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x95e00000
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x86d00004
+	.word	0x8de00007
+	.word	0x85d00004
+	.word	0x7010000
+	.word	0x40001100
+	.word	0xd710005
+	.word	0xc710006
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x1d010001
+	.word	0x771000d
+	.word	0x1d7a0002
+	.word	0x9de00005
+	.word	0x8ce00006
+	.word	0x8cc00000
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de00007
+	.word	0x8dd00000
+	.word	0x8ce00005
+	.word	0x2dc1000d
+	.word	0xb0dfffef
+	.word	0x85e00000
+	.word	0x86e00001
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000c
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de0000c
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00006
+	.word	0x8de0000d
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x40001192
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x60001466
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d0006a
+	.word	0x8de0000d
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de0000a
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x6000145b
+	.word	0xd010001
+	.word	0x9de0000b
+	.word	0x8de0000b
+	.word	0x8dd00000
+	.word	0x8ce0000a
+	.word	0x2dd1000c
+	.word	0xb0d0000d
+	.word	0x8de0000b
+	.word	0x8dd00000
+	.word	0x8ce0000a
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d0004f
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x9de00001
+	.word	0x60001389
+	.word	0x4000118f
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x9de00009
+	.word	0x8de00009
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00027
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00023
+	.word	0x8de0000b
+	.word	0x8bd00000
+	.word	0x8dd00004
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0xdd1000b
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00018
+	.word	0x1d010005
+	.word	0xdb1000d
+	.word	0x8ce00006
+	.word	0x8cc00000
+	.word	0xdd1000c
+	.word	0x8ce0000a
+	.word	0x2dd1000c
+	.word	0xb0d00010
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x60001426
+	.word	0x8de0000b
+	.word	0x8dd00000
+	.word	0x8ce0000a
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00020
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x9de00001
+	.word	0x60001389
+	.word	0x4000118f
+	.word	0x8de0000a
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x9de00008
+	.word	0x8de00008
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40001192
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x6000145b
+	.word	0xd010001
+	.word	0x9de00007
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600010ee
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x60001492
+	.word	0x81e00008
+	.word	0x40001192
+	.word	0x81e0000c
+	.word	0x40001192
+	.word	0x1010000
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee1000c
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee3000b
+	.word	0x94e00002
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9be00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x8de0000b
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40001231
+	.word	0x60000be7
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x1d01003d
+	.word	0x9de00001
+	.word	0x60000eb6
+	.word	0xd010001
+	.word	0x601000d
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0002c
+	.word	0x90600000
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00025
+	.word	0x400011d7
+	.word	0x85e0000b
+	.word	0xd010005
+	.word	0x9de0000a
+	.word	0x8cd00000
+	.word	0x2dc80000
+	.word	0xb0d00009
+	.word	0x8de0000a
+	.word	0x15d10001
+	.word	0xd010004
+	.word	0x14d10001
+	.word	0x8ce0000a
+	.word	0x8cc00000
+	.word	0x8dd00000
+	.word	0x2dc8000d
+	.word	0xb0dffff2
+	.word	0x8d500000
+	.word	0x2dda0000
+	.word	0xb0d00003
+	.word	0x8d400000
+	.word	0x3dd8003d
+	.word	0xb0d00002
+	.word	0x17710001
+	.word	0x400011d7
+	.word	0x1d01003d
+	.word	0x9d600000
+	.word	0x8de0000b
+	.word	0x9d700000
+	.word	0x1010000
+	.word	0x40001231
+	.word	0x8d700000
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x401000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dfffdc
+	.word	0x1d01003d
+	.word	0x9d600000
+	.word	0x87000be6
+	.word	0x8d001198
+	.word	0x2dda0000
+	.word	0xb0d00029
+	.word	0x4010000
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x14400001
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dffff9
+	.word	0x1d01000a
+	.word	0x1c010001
+	.word	0xb46000d
+	.word	0xdd4000b
+	.word	0x1dd0000a
+	.word	0xd01000d
+	.word	0xdc5000d
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40001231
+	.word	0x94001198
+	.word	0x85000be6
+	.word	0x97000be6
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0xc010005
+	.word	0x15c10001
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0xd01000c
+	.word	0x2ddb0000
+	.word	0xb0dffff7
+	.word	0x87000be6
+	.word	0x40001225
+	.word	0x8d001198
+	.word	0x1dd8000a
+	.word	0x2dda0000
+	.word	0xb0d00014
+	.word	0x8d000be6
+	.word	0x9de00000
+	.word	0x1d01000a
+	.word	0x1c010001
+	.word	0x8b001198
+	.word	0xbb6000d
+	.word	0xdd4000b
+	.word	0x1dd0000a
+	.word	0xd01000d
+	.word	0xdc5000d
+	.word	0x9de00001
+	.word	0x60001112
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40001231
+	.word	0x97000be6
+	.word	0x8d001198
+	.word	0x1dd20001
+	.word	0xdd10007
+	.word	0x8ce0000b
+	.word	0x9cd00000
+	.word	0x8d001198
+	.word	0xdd10007
+	.word	0x90d00000
+	.word	0x8d001198
+	.word	0x1dd00001
+	.word	0x9d001198
+	.word	0x1010000
+	.word	0x84e00002
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8be00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9ae00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40001250
+	.word	0x8de00004
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0x8ae00005
+	.word	0xbba000a
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ae00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9ae00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x4000126d
+	.word	0x8de00004
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0x8ae00005
+	.word	0xbba000a
+	.word	0xb03000b
+	.word	0x1bb30001
+	.word	0xccb000b
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ae00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30001
+	.word	0x9de00000
+	.word	0x8de00001
+	.word	0x90d00000
+	.word	0x1010000
+	.word	0x8de00000
+	.word	0x1ee10001
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0e003f
+	.word	0x1ccdffff
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x4000129e
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x1c010001
+	.word	0x8be00004
+	.word	0xcca000b
+	.word	0xddb000c
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x4000129e
+	.word	0x1010000
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee3000d
+	.word	0x93e00000
+	.word	0x94e00001
+	.word	0x95e00002
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x16010001
+	.word	0x7010000
+	.word	0x400012b3
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000c
+	.word	0x1cd20009
+	.word	0x3dc00005
+	.word	0xb0d00003
+	.word	0x8de0000c
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x400012bf
+	.word	0x5010000
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002b
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x400012d3
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002d
+	.word	0xb0d00005
+	.word	0x360effff
+	.word	0x166dffff
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000f
+	.word	0x2dda0000
+	.word	0xb0d00022
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda0030
+	.word	0xb0d0001c
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd00061
+	.word	0x14d20041
+	.word	0x400012e8
+	.word	0x8de0000d
+	.word	0x84d00001
+	.word	0x3d4a0078
+	.word	0xb0d00006
+	.word	0x1d010010
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10002
+	.word	0x9de0000d
+	.word	0x400012f8
+	.word	0x1d010008
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x400012f8
+	.word	0x1d01000a
+	.word	0x9de0000f
+	.word	0x8de0000f
+	.word	0x9de0000b
+	.word	0x3dd00002
+	.word	0xb0d00003
+	.word	0x8de0000b
+	.word	0x3dd40024
+	.word	0xb0d00048
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x40001364
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20030
+	.word	0xd01000d
+	.word	0x1c01000a
+	.word	0x2dd7000c
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x14d20030
+	.word	0x40001323
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20061
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd00041
+	.word	0x13d20061
+	.word	0x40001321
+	.word	0x8de0000d
+	.word	0x83d00000
+	.word	0x1d320041
+	.word	0x14d0000a
+	.word	0x8de0000f
+	.word	0x2d40000d
+	.word	0xb0d00001
+	.word	0x4000135c
+	.word	0x3d0e7fff
+	.word	0x1dddffff
+	.word	0xdd20004
+	.word	0x8ce0000f
+	.word	0xdd6000c
+	.word	0x2d74000d
+	.word	0xb0d00013
+	.word	0x3d6a0001
+	.word	0xb0d00003
+	.word	0x330e7fff
+	.word	0x133dffff
+	.word	0x40001335
+	.word	0x330e8000
+	.word	0x133d0000
+	.word	0x7010003
+	.word	0x60000b94
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x1c010022
+	.word	0x9cd00000
+	.word	0x40001344
+	.word	0x8de0000f
+	.word	0xd74000d
+	.word	0x7d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000a
+	.word	0x1cd20030
+	.word	0xc01000c
+	.word	0x1b01000a
+	.word	0x2dc1000b
+	.word	0xb0dfffb9
+	.word	0x1d010006
+	.word	0x9de00009
+	.word	0x8ce0000a
+	.word	0x1cc20061
+	.word	0xc01000c
+	.word	0x2dc1000d
+	.word	0xb0dfffb2
+	.word	0x8de0000a
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x8ce00009
+	.word	0x2dd1000c
+	.word	0xb0dfffac
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1640007
+	.word	0x83e00000
+	.word	0x84e00001
+	.word	0x85e00002
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000d
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8700136f
+	.word	0x40001379
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x6000107e
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x6000107e
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400013d8
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d00136f
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d00136f
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60001370
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60001389
+	.word	0x90700003
+	.word	0x4000141f
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600013b1
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x40001420
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600013b1
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40001420
+	.word	0x9700136f
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d00136f
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c00136f
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x6000107e
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x6000145b
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40001489
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x4000148c
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60001466
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x6000145b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x60001426
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x60001426
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x1d010006
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010007
+	.word	0x400014f5
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010102
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x9d700001
+	.word	0x8d700001
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d00001
+	.word	0x400014f2
+	.word	0x1d0101f4
+	.word	0x9de00000
+	.word	0x600013de
+	.word	0xd010001
+	.word	0x9d700004
+	.word	0x8d700004
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x400014ef
+	.word	0x1d0101f4
+	.word	0x9d700003
+	.word	0x1010007
+	.word	0x400014f5
+	.word	0x8d700004
+	.word	0x9de00000
+	.word	0x60001492
+	.word	0x97e00000
+	.word	0x60001492
+	.word	0x1010000
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00009
+	.word	0x8ce0000a
+	.word	0xdd5000c
+	.word	0x9de00007
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00009
+	.word	0x8ce0000a
+	.word	0xdd5000c
+	.word	0x9de00007
+	.word	0x1d010018
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x60000bae
+	.word	0xd010001
+	.word	0x9de00004
+	.word	0x8de00005
+	.word	0x8dd00004
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00004
+	.word	0x8de00005
+	.word	0x8dd00004
+	.word	0x9de00000
+	.word	0x60001492
+	.word	0x8de00005
+	.word	0x8dd00002
+	.word	0x1ddb0800
+	.word	0x1ddf0800
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x60001492
+	.word	0x81e00004
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffffa
+	.word	0x8de00005
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0xdd1000c
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xc010007
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x9de00004
+	.word	0x8de00007
+	.word	0x8ce00004
+	.word	0xdd3000c
+	.word	0x9de00007
+	.word	0x8de00007
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x1010007
+	.word	0x40001585
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8ce00006
+	.word	0x1bc10001
+	.word	0x9be00006
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00007
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00007
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00005
+	.word	0x90d00000
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x42
+	.word	0x79
+	.word	0x65
+	.word	0x21
+	.word	0xa
+	.word	0x0
+	.word	0x72
+	.word	0x65
+	.word	0x73
+	.word	0x6f
+	.word	0x6c
+	.word	0x76
+	.word	0x65
+	.word	0x20
+	.word	0x63
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x73
+	.word	0x69
+	.word	0x74
+	.word	0x65
+	.word	0x73
+	.word	0x20
+	.word	0x77
+	.word	0x69
+	.word	0x74
+	.word	0x68
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x6f
+	.word	0x6c
+	.word	0x73
+	.word	0x2f
+	.word	0x6b
+	.word	0x64
+	.word	0x62
+	.word	0x67
+	.word	0x2e
+	.word	0x70
+	.word	0x79
+	.word	0x20
+	.word	0x77
+	.word	0x69
+	.word	0x6e
+	.word	0x69
+	.word	0x78
+	.word	0x20
+	.word	0x3c
+	.word	0x63
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x73
+	.word	0x69
+	.word	0x74
+	.word	0x65
+	.word	0x3e
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0xa
+	.word	0x0
+	.word	0x30
+	.word	0x78
+	.word	0x25
+	.word	0x30
+	.word	0x35
+	.word	0x78
+	.word	0x20
+	.word	0x20
+	.word	0x25
+	.word	0x37
+	.word	0x64
+	.word	0x20
+	.word	0x20
+	.word	0x25
+	.word	0x37
+	.word	0x64
+	.word	0x20
+	.word	0x20
+	.word	0x25
+	.word	0x37
+	.word	0x64
+	.word	0x20
+	.word	0x20
+	.word	0x25
+	.word	0x37
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x63
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x73
+	.word	0x69
+	.word	0x74
+	.word	0x65
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x6c
+	.word	0x69
+	.word	0x76
+	.word	0x65
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x70
+	.word	0x65
+	.word	0x61
+	.word	0x6b
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x6f
+	.word	0x63
+	.word	0x73
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x20
+	.word	0x66
+	.word	0x72
+	.word	0x65
+	.word	0x65
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x55
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x73
+	.word	0x6c
+	.word	0x61
+	.word	0x62
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x70
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x2d
+	.word	0x70
+	.word	0x0
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x79
+	.word	0x73
+	.word	0x63
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x74
+	.word	0x72
+	.word	0x61
+	.word	0x63
+	.word	0x6b
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x64
+	.word	0x69
+	.word	0x73
+	.word	0x61
+	.word	0x62
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x50
+	.word	0x72
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x73
+	.word	0x79
+	.word	0x73
+	.word	0x63
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x74
+	.word	0x72
+	.word	0x61
+	.word	0x63
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x20
+	.word	0x53
+	.word	0x65
+	.word	0x72
+	.word	0x69
+	.word	0x61
+	.word	0x6c
+	.word	0x20
+	.word	0x50
+	.word	0x6f
+	.word	0x72
+	.word	0x74
+	.word	0x20
+	.word	0x32
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x0
+	.word	0x20
+	.word	0x2a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x41
+	.word	0x76
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x61
+	.word	0x62
+	.word	0x6c
+	.word	0x65
+	.word	0x20
+	.word	0x43
+	.word	0x6f
+	.word	0x6d
+	.word	0x6d
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x0
+	.word	0x6b
+	.word	0x69
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x0
+	.word	0x49
+	.word	0x6e
+	.word	0x76
+	.word	0x61
+	.word	0x6c
+	.word	0x69
+	.word	0x64
+	.word	0x20
+	.word	0x6e
+	.word	0x75
+	.word	0x6d
+	.word	0x62
+	.word	0x65
+	.word	0x72
+	.word	0x20
+	.word	0x27
+	.word	0x25
+	.word	0x73
+	.word	0x27
+	.word	0xa
+	.word	0x0
+	.word	0x6b
+	.word	0x69
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x3c
+	.word	0x2d
+	.word	0x73
+	.word	0x69
+	.word	0x67
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x3e
+	.word	0x20
+	.word	0x5b
+	.word	0x70
+	.word	0x69
+	.word	0x64
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x73
+	.word	0x65
+	.word	0x74
+	.word	0x65
+	.word	0x6e
+	.word	0x76
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x3d
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x70
+	.word	0x69
+	.word	0x70
+	.word	0x65
+	.word	0x0
+	.word	0x73
+	.word	0x70
+	.word	0x61
+	.word	0x77
+	.word	0x6e
+	.word	0x0
+	.word	0x55
+	.word	0x6e
+	.word	0x6b
+	.word	0x6e
+	.word	0x6f
+	.word	0x77
+	.word	0x6e
+	.word	0x20
+	.word	0x63
+	.word	0x6f
+	.word	0x6d
+	.word	0x6d
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x20
+	.word	0x27
+	.word	0x25
+	.word	0x73
+	.word	0x27
+	.word	0xa
+	.word	0x0
+	.word	0x2f
+	.word	0x62
+	.word	0x69
+	.word	0x6e
+	.word	0x2f
+	.word	0x0
+	.word	0x20
+	.word	0x0
+	.word	0x2d
+	.word	0x63
+	.word	0x0
+	.word	0x75
+	.word	0x73
+	.word	0x65
+	.word	0x72
+	.word	0x2f
+	.word	0x77
+	.word	0x73
+	.word	0x68
+	.word	0x2f
+	.word	0x77
+	.word	0x73
+	.word	0x68
+	.word	0x2e
+	.word	0x63
+	.word	0x0
+	.word	0x73
+	.word	0x74
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x0
+	.word	0x66
+	.word	0x67
+	.word	0x0
+	.word	0x63
+	.word	0x6c
+	.word	0x65
+	.word	0x61
+	.word	0x72
+	.word	0x0
+	.word	0x63
+	.word	0x64
+	.word	0x0
+	.word	0x3f
+	.word	0x0
+	.word	0x68
+	.word	0x65
+	.word	0x6c
+	.word	0x70
+	.word	0x0
+	.word	0x65
+	.word	0x78
+	.word	0x69
+	.word	0x74
+	.word	0x0
+	.word	0x66
+	.word	0x72
+	.word	0x65
+	.word	0x65
+	.word	0x0
+	.word	0x70
+	.word	0x69
+	.word	0x64
+	.word	0x0
+	.word	0x6b
+	.word	0x69
+	.word	0x6c
+	.word	0x6c
+	.word	0x0
+	.word	0x73
+	.word	0x6c
+	.word	0x61
+	.word	0x62
+	.word	0x0
+	.word	0x75
+	.word	0x6e
+	.word	0x74
+	.word	0x72
+	.word	0x61
+	.word	0x63
+	.word	0x65
+	.word	0x0
+	.word	0x74
+	.word	0x72
+	.word	0x61
+	.word	0x63
+	.word	0x65
+	.word	0x0
+	.word	0x65
+	.word	0x6e
+	.word	0x76
+	.word	0x0
+	.word	0x61
+	.word	0x73
+	.word	0x73
+	.word	0x65
+	.word	0x72
+	.word	0x74
+	.word	0x69
+	.word	0x6f
+	.word	0x6e
+	.word	0x20
+	.word	0x66
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x61
+	.word	0x74
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x3d
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x8000007e
+	.word	0x7
+	.word	0x19960503
+	.word	0x453
+	.word	0x1000
+	.word	0xdfc
+	.word	0xce4
+	.word	0x118
+	.word	0x18
+	.word	0x80000003
+	.word	0x150
+	.word	0x1ee30006
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x6010000
+	.word	0xd010000
+	.word	0x9d000784
+	.word	0x9d000783
+	.word	0x9d000782
+	.word	0x40000427
+	.word	0x8d000782
+	.word	0x1dd00001
+	.word	0x9d000782
+	.word	0x3d780020
+	.word	0xb0d00004
+	.word	0x3d780009
+	.word	0xb0d00002
+	.word	0x3d7a000a
+	.word	0xb0d00007
+	.word	0x2d680000
+	.word	0xb0d00003
+	.word	0x8d000783
+	.word	0x1dd00001
+	.word	0x9d000783
+	.word	0x6010000
+	.word	0x40000420
+	.word	0x16010001
+	.word	0x3d78000a
+	.word	0xb0d00002
+	.word	0x3d7a000c
+	.word	0xb0d00003
+	.word	0x8d000784
+	.word	0x1dd00001
+	.word	0x9d000784
+	.word	0xcd000550
+	.word	0x9de00000
+	.word	0x60000574
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2dd20000
+	.word	0xb0dfffe1
+	.word	0x8d000781
+	.word	0x8c000784
+	.word	0xdd0000c
+	.word	0x9d000781
+	.word	0x8d000780
+	.word	0x8c000783
+	.word	0xdd0000c
+	.word	0x9d000780
+	.word	0x8d00077f
+	.word	0x8c000782
+	.word	0xdd0000c
+	.word	0x9d00077f
+	.word	0x86e00001
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d00055d
+	.word	0x9de00000
+	.word	0xcd000762
+	.word	0x9de00001
+	.word	0x60000562
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x60000737
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee3000e
+	.word	0x94e00003
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x1d010001
+	.word	0x8ce0000e
+	.word	0x1cc20001
+	.word	0x9ce0000d
+	.word	0x701000d
+	.word	0x8de0000f
+	.word	0x86d00001
+	.word	0xd010006
+	.word	0x9de0000b
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d0002a
+	.word	0x8de0000b
+	.word	0x16d10001
+	.word	0x8de0000b
+	.word	0x8dd00000
+	.word	0x3dda002d
+	.word	0xb0d00024
+	.word	0x8de0000d
+	.word	0x1dd20001
+	.word	0x9de0000d
+	.word	0x17700001
+	.word	0x4000048e
+	.word	0x84600000
+	.word	0x1d01006c
+	.word	0x9de0000a
+	.word	0x2d48000d
+	.word	0xb0d00009
+	.word	0x8de0000a
+	.word	0x2d42000d
+	.word	0xb0d00003
+	.word	0x3d480063
+	.word	0xb0d0000c
+	.word	0x4000048c
+	.word	0x3d480077
+	.word	0xb0d00005
+	.word	0x4000048c
+	.word	0x8d000400
+	.word	0x1dd00001
+	.word	0x9d000400
+	.word	0x4000048d
+	.word	0x8d000401
+	.word	0x1dd00001
+	.word	0x9d000401
+	.word	0x4000048d
+	.word	0x8d000402
+	.word	0x1dd00001
+	.word	0x9d000402
+	.word	0x4000048d
+	.word	0x60000441
+	.word	0x16610001
+	.word	0x8d600000
+	.word	0x2dda0000
+	.word	0xb0dfffe1
+	.word	0xd010000
+	.word	0x9de0000a
+	.word	0x8c000400
+	.word	0x2dca000d
+	.word	0xb0d0000c
+	.word	0x8d000401
+	.word	0x8ce0000a
+	.word	0x2dda000c
+	.word	0xb0d00008
+	.word	0x8d000402
+	.word	0x8ce0000a
+	.word	0x2dda000c
+	.word	0xb0d00004
+	.word	0x1d010001
+	.word	0x9d000400
+	.word	0x9d000401
+	.word	0x9d000402
+	.word	0x8de0000d
+	.word	0x3dd00002
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x400004a8
+	.word	0x4010000
+	.word	0x94e0000c
+	.word	0x8de0000e
+	.word	0x2d70000d
+	.word	0xb0d00071
+	.word	0x60000403
+	.word	0x8d000400
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000784
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x8d000401
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000783
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x8d000402
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000782
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075a
+	.word	0x9de00001
+	.word	0x60000562
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x60000737
+	.word	0x4000051d
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x60000737
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x8de0000f
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x60000737
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d0000b
+	.word	0x8d00055d
+	.word	0x9de00000
+	.word	0xcd000746
+	.word	0x9de00001
+	.word	0x8de0000f
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x17700001
+	.word	0x4000051d
+	.word	0x60000403
+	.word	0x8d000400
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000784
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x8d000401
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000783
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x8d000402
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000782
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000741
+	.word	0x9de00001
+	.word	0x8de0000f
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x17700001
+	.word	0x8de0000e
+	.word	0x2d70000d
+	.word	0xb0dfffb7
+	.word	0x8de0000c
+	.word	0x2dd80000
+	.word	0xb0d00023
+	.word	0x8d000400
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000781
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x8d000401
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d000780
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x8d000402
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00075d
+	.word	0x9de00001
+	.word	0x8d00077f
+	.word	0x9de00002
+	.word	0x60000562
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000739
+	.word	0x9de00001
+	.word	0x60000562
+	.word	0x1010000
+	.word	0x84e00003
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1000e
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x21c
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000737
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x9be00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de0000b
+	.word	0x8dd00002
+	.word	0x1ddb0010
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x400005c3
+	.word	0x8de0000b
+	.word	0x8dd00004
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00009
+	.word	0x1d0101f4
+	.word	0x9de00000
+	.word	0x60000652
+	.word	0xd010001
+	.word	0x8ce0000b
+	.word	0x9dc00004
+	.word	0x8de0000b
+	.word	0x1c0101f4
+	.word	0x9cd00003
+	.word	0x8de0000b
+	.word	0x8cd00000
+	.word	0x8dd00004
+	.word	0xdc1000d
+	.word	0x9de0000a
+	.word	0x8de0000b
+	.word	0x8dd00005
+	.word	0xd01000d
+	.word	0x9de00008
+	.word	0x2dd90000
+	.word	0xb0d00005
+	.word	0x8de0000a
+	.word	0xd01000d
+	.word	0x8ce00008
+	.word	0x2dc1000d
+	.word	0xb0d0001d
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x8cd00001
+	.word	0x9ce00001
+	.word	0x8cd00004
+	.word	0x9ce00002
+	.word	0x8dd00003
+	.word	0x9de00003
+	.word	0x60000737
+	.word	0xd010001
+	.word	0x9de00009
+	.word	0x8de00009
+	.word	0x2dd20000
+	.word	0xb0d00008
+	.word	0x8de0000b
+	.word	0x1dd10002
+	.word	0x8cd00000
+	.word	0x1ccd0010
+	.word	0x9cd00000
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x400005c3
+	.word	0x8de0000b
+	.word	0x8ce00009
+	.word	0x9cd00000
+	.word	0x8de0000b
+	.word	0x8cd00004
+	.word	0x9cd00005
+	.word	0x8de0000b
+	.word	0x1dd10005
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8dc00000
+	.word	0x101000d
+	.word	0x8be00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d0005c9
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x400005d7
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x810005c9
+	.word	0x400005df
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x60000737
+	.word	0xd010001
+	.word	0x9d0005c9
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x870005e3
+	.word	0x400005ed
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x600005ca
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x600005ca
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x4000064c
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d0005e3
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d0005e3
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600005e4
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600005fd
+	.word	0x90700003
+	.word	0x40000693
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000625
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x40000694
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000625
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000694
+	.word	0x970005e3
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d0005e3
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c0005e3
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x600005ca
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x600006cf
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x400006fd
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x40000700
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x600006da
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x600006cf
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x6000069a
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x6000069a
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x74
+	.word	0x61
+	.word	0x6c
+	.word	0xa
+	.word	0x0
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x77
+	.word	0x63
+	.word	0x3a
+	.word	0x20
+	.word	0x63
+	.word	0x61
+	.word	0x6e
+	.word	0x6e
+	.word	0x6f
+	.word	0x74
+	.word	0x20
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x6e
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x20
+	.word	0xa
+	.word	0x0
+	.word	0x20
+	.word	0x25
+	.word	0x36
+	.word	0x64
+	.word	0x0
+	.word	0x55
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x77
+	.word	0x63
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x6c
+	.word	0x77
+	.word	0x63
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x6e
+	.word	0x61
+	.word	0x6d
+	.word	0x65
+	.word	0x20
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0x5d
+	.word	0xa
+	.word	0x8000007b
+	.word	0x6
+	.word	0xb
+	.word	0x0
+	.word	0x74
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x80000019
+	.word	0x7
+	.word	0x101
+	.word	0xd
+	.word	0x0
+	.word	0x74
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x80000019
+	.word	0x5
+	.word	0x101
+	.word	0xf
+	.word	0x0
+	.word	0x70
+	.word	0x73
+	.word	0x8000001b
+	.word	0x8
+	.word	0x101
+	.word	0x10
+	.word	0x0
+	.word	0x72
+	.word	0x6d
+	.word	0x64
+	.word	0x69
+	.word	0x72
+	.word	0x80000018
+	.word	0x7
+	.word	0x101
+	.word	0x11
+	.word	0x0
+	.word	0x67
+	.word	0x72
+	.word	0x65
+	.word	0x70
+	.word	0x80000019
+	.word	0x7
+	.word	0x101
+	.word	0x14
+	.word	0x0
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x74
+	.word	0x80000019
+	.word	0x7
+	.word	0x101
+	.word	0x15
+	.word	0x0
+	.word	0x65
+	.word	0x63
+	.word	0x68
+	.word	0x6f
+	.word	0x80000019
+	.word	0x6
+	.word	0x101
+	.word	0x16
+	.word	0x0
+	.word	0x63
+	.word	0x61
+	.word	0x74
+	.word	0x8000001a
+	.word	0x2a
+	.word	0x101
+	.word	0x19960503
+	.word	0x427
+	.word	0x1000
+	.word	0x3298
+	.word	0x29a4
+	.word	0x8f4
+	.word	0x9c
+	.word	0x5ed
+	.word	0x107a
+	.word	0x1
+	.word	0x5a7
+	.word	0x1074
+	.word	0x1
+	.word	0x7eb
+	.word	0x106a
+	.word	0x1
+	.word	0x651
+	.word	0x1065
+	.word	0x1
+	.word	0x6b5
+	.word	0x105f
+	.word	0x1
+	.word	0x767
+	.word	0x1059
+	.word	0x1
+	.word	0x8bd
+	.word	0x1053
+	.word	0x1
+	.word	0x51e
+	.word	0x104c
+	.word	0x1
+	.word	0x943
+	.word	0x1047
+	.word	0x1
+	.word	0x8a0
+	.word	0x1041
+	.word	0x0
+	.word	0x481
+	.word	0x103d
+	.word	0x0
+	.word	0x464
+	.word	0x80000005
+	.word	0x687
+	.word	0x1ee30009
+	.word	0x97e00002
+	.word	0x9be00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de0000a
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x8de00009
+	.word	0x1dd20001
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x1dd10001
+	.word	0x9de00001
+	.word	0x60000464
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x4000045d
+	.word	0xc7000400
+	.word	0x4000043f
+	.word	0x17710003
+	.word	0xd010000
+	.word	0x9de00008
+	.word	0xc010007
+	.word	0x2dc9000d
+	.word	0xb0d0000f
+	.word	0x8d700001
+	.word	0x9de00007
+	.word	0xc01000d
+	.word	0x8be00008
+	.word	0x2dc9000b
+	.word	0xb0d00009
+	.word	0x8de0000a
+	.word	0x8dd00001
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000e44
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0dfffeb
+	.word	0x8de00009
+	.word	0x1dd20001
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x1dd10001
+	.word	0x9de00001
+	.word	0x8d700000
+	.word	0x70d00000
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x87e00002
+	.word	0x8be00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0xc7000400
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001025
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x40000477
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00101e
+	.word	0x9de00001
+	.word	0x8d700001
+	.word	0x9de00002
+	.word	0x60000abd
+	.word	0x17710003
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dffff4
+	.word	0x1010000
+	.word	0x87e00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000c
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0xc7000400
+	.word	0x90e0000b
+	.word	0x400004ac
+	.word	0x8d700002
+	.word	0x2dd80000
+	.word	0xb0d0001d
+	.word	0x1d010001
+	.word	0x8c700001
+	.word	0x9ce0000a
+	.word	0x9de00000
+	.word	0x1de1000a
+	.word	0x9de00001
+	.word	0x8d700000
+	.word	0x70d00000
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00100b
+	.word	0x9de00001
+	.word	0x8d700001
+	.word	0x9de00002
+	.word	0x96e00003
+	.word	0x60000abd
+	.word	0x2d6a0000
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x400004a5
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d01006a
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x17710003
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dfffdb
+	.word	0x1010000
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1000c
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d0010bc
+	.word	0x8ce00005
+	.word	0xdd0000c
+	.word	0x9d0010bc
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000fe8
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x600009ff
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000fdc
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d0010bc
+	.word	0x8ce00005
+	.word	0xdd0000c
+	.word	0x9d0010bc
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000fce
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x600009ff
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000fc2
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d0010bc
+	.word	0x8ce00005
+	.word	0xdd0000c
+	.word	0x9d0010bc
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000fb4
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x600009ff
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000fa8
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d0010bc
+	.word	0x8ce00005
+	.word	0xdd0000c
+	.word	0x9d0010bc
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000f99
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000f8c
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee3000e
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x900010bc
+	.word	0x1de1000c
+	.word	0x9de00000
+	.word	0x60000b07
+	.word	0x90e0000d
+	.word	0xcd0004b9
+	.word	0x9de0000b
+	.word	0x1d010008
+	.word	0x9de00000
+	.word	0x1d01000a
+	.word	0x9de00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0xcd0004d3
+	.word	0x9de0000b
+	.word	0x1d010008
+	.word	0x9de00000
+	.word	0x1d01000c
+	.word	0x9de00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0xcd0004ed
+	.word	0x9de0000b
+	.word	0x1d010008
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0xcd000507
+	.word	0x9de0000b
+	.word	0x1d010008
+	.word	0x9de00000
+	.word	0x1d01000f
+	.word	0x9de00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x1de1000a
+	.word	0x9de00000
+	.word	0x60000b0f
+	.word	0x1d010013
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x1de10009
+	.word	0x9de00002
+	.word	0x8de0000a
+	.word	0x9de00003
+	.word	0x600009fd
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x600009ff
+	.word	0x8d0010bc
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40000566
+	.word	0x7010000
+	.word	0x97e00000
+	.word	0x1d0100ac
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1d010012
+	.word	0x9de00000
+	.word	0x1de1000a
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0x1de1000a
+	.word	0x9de00000
+	.word	0x1d01000a
+	.word	0x9de00001
+	.word	0x60000b1b
+	.word	0xd010001
+	.word	0x9de00000
+	.word	0x1d0100b0
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8d0010bc
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x40000583
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d0100b1
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000f5b
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x1d010011
+	.word	0x9de00000
+	.word	0x8de00009
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0x8d0010bc
+	.word	0x3dda0027
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x40000599
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d0100b6
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1010000
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000e
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x7010000
+	.word	0x90e00007
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x1d010008
+	.word	0x9de00001
+	.word	0x3d0e0000
+	.word	0x1ddd0001
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x1d010001
+	.word	0x8ce00007
+	.word	0x7d6000c
+	.word	0x9de00000
+	.word	0xcd000f45
+	.word	0x9de00001
+	.word	0x97e00002
+	.word	0x60000abd
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x1d010008
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600009fd
+	.word	0x1010000
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x8de00003
+	.word	0x9de00000
+	.word	0x600005cb
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x1d010003
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x1d010035
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30010
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x98e00007
+	.word	0x99e00008
+	.word	0x9ae00009
+	.word	0x9be0000a
+	.word	0x9de0000b
+	.word	0x9fe0000c
+	.word	0x1de1000e
+	.word	0xc9000e69
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x7010000
+	.word	0x7010000
+	.word	0x1de1000e
+	.word	0xd71000d
+	.word	0x8dd00000
+	.word	0x70d00000
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d6a0000
+	.word	0xb0d0000f
+	.word	0x1d01000d
+	.word	0x9de00000
+	.word	0x1d010008
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000f1e
+	.word	0x9de00001
+	.word	0x97e00002
+	.word	0x60000abd
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0x600005cb
+	.word	0x40000634
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x9de00001
+	.word	0x1de1000d
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x8de0000d
+	.word	0x1ddb007f
+	.word	0x9de00000
+	.word	0x1d0100df
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de0000d
+	.word	0x1ddb007f
+	.word	0x3dda000b
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x4000062e
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d0100e0
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x17700001
+	.word	0x3d700002
+	.word	0xb0dfffc8
+	.word	0x1010000
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x88e00007
+	.word	0x89e00008
+	.word	0x8ae00009
+	.word	0x8be0000a
+	.word	0x8de0000b
+	.word	0x8fe0000c
+	.word	0x1ee10010
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000f02
+	.word	0x9de00001
+	.word	0x8de00005
+	.word	0x9de00002
+	.word	0x60000abd
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x3d0e0000
+	.word	0x1ddd0001
+	.word	0x9de0000a
+	.word	0x1d010035
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x9de00008
+	.word	0x2dda0000
+	.word	0xb0d0001b
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x1d01000b
+	.word	0x9de00001
+	.word	0xcd000643
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000eff
+	.word	0x9de00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x60000abd
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x1d01000b
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600009fd
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x4000069f
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x9de00001
+	.word	0x1de10009
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x8de00009
+	.word	0x1ddb007f
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x4000068b
+	.word	0x7010000
+	.word	0x97e00000
+	.word	0x1d0100f7
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de00009
+	.word	0x1dde0008
+	.word	0x1ddb00ff
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x40000699
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d0100f8
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1010000
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000ee6
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x1d010001
+	.word	0x9d0006a6
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee3001d
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x1d010035
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00078
+	.word	0x90e00016
+	.word	0x1d0103e8
+	.word	0x9de00015
+	.word	0x1de10017
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010004
+	.word	0x9de00002
+	.word	0x60000df8
+	.word	0x900006a6
+	.word	0x8de0001d
+	.word	0x3dd40001
+	.word	0xb0d00019
+	.word	0x8de0001e
+	.word	0x8dd00001
+	.word	0x9de00000
+	.word	0x1de1001b
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x60000d19
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x9de00016
+	.word	0x8de0001b
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000a
+	.word	0x8d000ab8
+	.word	0x9de00000
+	.word	0xcd000ed2
+	.word	0x9de00001
+	.word	0x8de0001e
+	.word	0x8dd00001
+	.word	0x9de00002
+	.word	0x60000abd
+	.word	0x11010001
+	.word	0x4000075f
+	.word	0x8de00016
+	.word	0x9de00019
+	.word	0x8de00015
+	.word	0x9de0001a
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x1d01000e
+	.word	0x9de00001
+	.word	0xcd0006a7
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x1d010037
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1de10017
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1de1000a
+	.word	0x9de00002
+	.word	0x1d01000a
+	.word	0x9de00003
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x9de00014
+	.word	0x8de00014
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x4000070c
+	.word	0x7010000
+	.word	0x97e00000
+	.word	0x1d010121
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x60000e42
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x1c010004
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x40000721
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d010122
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8d0006a6
+	.word	0x3dda0001
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x4000072d
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d010123
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x4000075e
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x9de00001
+	.word	0x1de1001c
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x8de0001c
+	.word	0x1ddb007f
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x4000074a
+	.word	0x7010000
+	.word	0x97e00000
+	.word	0x1d010127
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de0001c
+	.word	0x1dde0008
+	.word	0x1ddb00ff
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x40000758
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d010128
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1010000
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1001d
+	.word	0x50f00000
+	.word	0x1ee30015
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x98e00006
+	.word	0x99e00007
+	.word	0x9ae00008
+	.word	0x9be00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x1d011388
+	.word	0x9de0000d
+	.word	0x1de10011
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010004
+	.word	0x9de00002
+	.word	0x60000df8
+	.word	0x1de1000e
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010003
+	.word	0x9de00002
+	.word	0x60000df8
+	.word	0x900006a6
+	.word	0x1d010035
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d0001d
+	.word	0x8de0000d
+	.word	0x9de00014
+	.word	0x1de10011
+	.word	0x19e10013
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0xcd0006a7
+	.word	0x9de0000e
+	.word	0x1d010002
+	.word	0x9de00010
+	.word	0x1d010008
+	.word	0x9de00000
+	.word	0x1d01000e
+	.word	0x9de00001
+	.word	0x1de1000e
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x1d010037
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1de10011
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x400007a0
+	.word	0x400007cc
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x9de00001
+	.word	0x1de1000c
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x8d0006a6
+	.word	0x3dda0001
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x400007b1
+	.word	0x7010000
+	.word	0x97e00000
+	.word	0x1d010142
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de0000c
+	.word	0x1ddb007f
+	.word	0x9de00000
+	.word	0x1d010143
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de0000c
+	.word	0x1ddb007f
+	.word	0x3dda000e
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x400007c6
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d010144
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1010000
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x88e00006
+	.word	0x89e00007
+	.word	0x8ae00008
+	.word	0x8be00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee10015
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000eb3
+	.word	0x9de00001
+	.word	0x8de00006
+	.word	0x9de00002
+	.word	0x60000abd
+	.word	0x8d0010a6
+	.word	0x8ce00006
+	.word	0xdd0000c
+	.word	0x9d0010a6
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30011
+	.word	0x92e00004
+	.word	0x93e00005
+	.word	0x94e00006
+	.word	0x95e00007
+	.word	0x96e00008
+	.word	0x97e00009
+	.word	0x9ce0000a
+	.word	0x9de0000b
+	.word	0x9fe0000c
+	.word	0x13010002
+	.word	0x12010001
+	.word	0x90e00010
+	.word	0x900010a6
+	.word	0x8de00011
+	.word	0x3dd40001
+	.word	0xb0d00018
+	.word	0x8de00012
+	.word	0x8dd00001
+	.word	0x9de00000
+	.word	0x1de1000e
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x60000d19
+	.word	0xd010001
+	.word	0x301000d
+	.word	0x8de0000e
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000a
+	.word	0x8d000ab8
+	.word	0x9de00000
+	.word	0xcd000ed2
+	.word	0x9de00001
+	.word	0x8de00012
+	.word	0x8dd00001
+	.word	0x9de00002
+	.word	0x60000abd
+	.word	0x11010001
+	.word	0x40000895
+	.word	0x1d010015
+	.word	0xc010003
+	.word	0xdd5000c
+	.word	0x9de00000
+	.word	0x60000c12
+	.word	0xd010001
+	.word	0x9de0000f
+	.word	0x8de0000f
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x40000885
+	.word	0x1d010001
+	.word	0xc010003
+	.word	0xdd5000c
+	.word	0x9de00000
+	.word	0x60000c12
+	.word	0xd010001
+	.word	0x401000d
+	.word	0xd010004
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x40000882
+	.word	0x86e0000f
+	.word	0x7010000
+	.word	0x40000857
+	.word	0x1d010038
+	.word	0x9de00000
+	.word	0x60000c12
+	.word	0xd010001
+	.word	0xc710004
+	.word	0x9dc00000
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00040
+	.word	0xd710004
+	.word	0x8dd00000
+	.word	0x9d600010
+	.word	0x1d010038
+	.word	0x9d600012
+	.word	0xcd0010a7
+	.word	0x9d600014
+	.word	0xd010002
+	.word	0x8ce00010
+	.word	0xcc0000d
+	.word	0x9ce00010
+	.word	0x96e00000
+	.word	0xcc0007d7
+	.word	0x9ce00001
+	.word	0x1c010001
+	.word	0x9ce00002
+	.word	0x12d00001
+	.word	0x9de00003
+	.word	0x60000a4a
+	.word	0x16610015
+	.word	0xd010000
+	.word	0x9de0000d
+	.word	0x2d78000d
+	.word	0xb0d00007
+	.word	0x1d780032
+	.word	0x8ce0000d
+	.word	0x2dda000c
+	.word	0xb0d00003
+	.word	0x1d010021
+	.word	0x9de00000
+	.word	0x60000b8e
+	.word	0x17700001
+	.word	0x2d700003
+	.word	0xb0dfffd5
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x60000b8e
+	.word	0x86e0000f
+	.word	0x7010000
+	.word	0x40000866
+	.word	0xcd0010a7
+	.word	0x9de00000
+	.word	0xd010006
+	.word	0x16d10015
+	.word	0x9de00001
+	.word	0x60000b78
+	.word	0x17700001
+	.word	0x2d700003
+	.word	0xb0dffff7
+	.word	0x8d0010a6
+	.word	0x8ce00010
+	.word	0x2dda000c
+	.word	0xb0d00003
+	.word	0x1d010001
+	.word	0x9de0000d
+	.word	0x40000870
+	.word	0x90e0000d
+	.word	0x8de0000d
+	.word	0x9de00000
+	.word	0x1d01018b
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x5010000
+	.word	0x4000087e
+	.word	0xd510004
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x60000cc6
+	.word	0x15500001
+	.word	0x2d500007
+	.word	0xb0dffff9
+	.word	0x94e00000
+	.word	0x60000cc6
+	.word	0x8de0000f
+	.word	0x9de00000
+	.word	0x60000cc6
+	.word	0x60000e42
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x1c01000c
+	.word	0x2ddb000c
+	.word	0xb0d00003
+	.word	0xcd000eac
+	.word	0x9de00000
+	.word	0x60000e24
+	.word	0x1010000
+	.word	0x82e00004
+	.word	0x83e00005
+	.word	0x84e00006
+	.word	0x85e00007
+	.word	0x86e00008
+	.word	0x87e00009
+	.word	0x8ce0000a
+	.word	0x8de0000b
+	.word	0x8fe0000c
+	.word	0x1ee10011
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1de10005
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x60000df8
+	.word	0x1d010001
+	.word	0x9de00005
+	.word	0x400008b7
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000eaa
+	.word	0x9de00001
+	.word	0x60000abd
+	.word	0x1d01002f
+	.word	0x9de00000
+	.word	0x1de10005
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600009fd
+	.word	0x400008ac
+	.word	0x1010000
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30013
+	.word	0x92e00003
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0x1de1000f
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d690000
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x400008d3
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d0101ab
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de0000f
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x400008df
+	.word	0x4010000
+	.word	0x94e00000
+	.word	0x1d0101ac
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de00010
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x400008eb
+	.word	0x3010000
+	.word	0x93e00000
+	.word	0x1d0101ad
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0x3d0e0000
+	.word	0x1ddd0001
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0xd01000d
+	.word	0x2d7b000d
+	.word	0xb0d0000e
+	.word	0x60000e42
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x1c01000e
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x12010001
+	.word	0x4000090d
+	.word	0x2010000
+	.word	0x92e00000
+	.word	0x1d0101af
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1de1000d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x60000df8
+	.word	0x3d0e05f5
+	.word	0x1ddde100
+	.word	0x9de0000e
+	.word	0x1d01002f
+	.word	0x9de00000
+	.word	0x1de1000d
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600009fd
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d790000
+	.word	0xb0d00005
+	.word	0x2d750006
+	.word	0xb0d00003
+	.word	0x1d010001
+	.word	0x9de0000c
+	.word	0x40000930
+	.word	0x90e0000c
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d0101b5
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1010000
+	.word	0x82e00003
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee10013
+	.word	0x50f00000
+	.word	0x1ee3007c
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x98e00009
+	.word	0x99e0000a
+	.word	0x9ae0000b
+	.word	0x9be0000c
+	.word	0x9ce0000d
+	.word	0x9de0000e
+	.word	0x9fe0000f
+	.word	0x1de10010
+	.word	0xc9000e6b
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x88900002
+	.word	0x8a900003
+	.word	0x98d00002
+	.word	0x9ad00003
+	.word	0x1d01001b
+	.word	0x9de00000
+	.word	0x1de1007a
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40000965
+	.word	0x7010000
+	.word	0x97e00000
+	.word	0x1d0101be
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1d010035
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00021
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de0007a
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0x1d010023
+	.word	0x9de00000
+	.word	0x8de0007b
+	.word	0x9de00001
+	.word	0x1d010001
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de0007b
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0x60000a93
+	.word	0xd010001
+	.word	0x1c010005
+	.word	0x9ce00000
+	.word	0xcc000ea1
+	.word	0x9ce00001
+	.word	0x1ce10010
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x600009fd
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600009fd
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x9de00001
+	.word	0x1de10079
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x600009fd
+	.word	0x8de00079
+	.word	0x1ddb007f
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x400009a2
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d0101c8
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x8de00079
+	.word	0x1dde0008
+	.word	0x1ddb00ff
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x400009b0
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d0101c9
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1de10015
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010064
+	.word	0x9de00002
+	.word	0x60000df8
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x8de0007a
+	.word	0x9de00001
+	.word	0x1de10015
+	.word	0x9de00002
+	.word	0x1d010064
+	.word	0x9de00003
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x9de00014
+	.word	0x8de00014
+	.word	0x3dda0004
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x400009cd
+	.word	0x4010000
+	.word	0x94e00000
+	.word	0x1d0101cd
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1de10015
+	.word	0x9de00000
+	.word	0xcd000e6f
+	.word	0x9de00001
+	.word	0x60000e44
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x400009de
+	.word	0x3010000
+	.word	0x93e00000
+	.word	0x1d0101ce
+	.word	0x9de00001
+	.word	0xcd000ff6
+	.word	0x9de00002
+	.word	0x60000e10
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de0007a
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de0007b
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0x1010000
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x88e00009
+	.word	0x89e0000a
+	.word	0x8ae0000b
+	.word	0x8be0000c
+	.word	0x8ce0000d
+	.word	0x8de0000e
+	.word	0x8fe0000f
+	.word	0x1ee1007c
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x1c01000b
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00006
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d000a14
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x40000a22
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x81000a14
+	.word	0x40000a2a
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x9d000a14
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00005
+	.word	0x8dd00014
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00006
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x8de00005
+	.word	0x8dd00014
+	.word	0x9de00000
+	.word	0x60000b61
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600009fd
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee3000a
+	.word	0x97e00003
+	.word	0x9be00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x1de1000d
+	.word	0x9de00009
+	.word	0x8de0000a
+	.word	0x9de00008
+	.word	0xc010000
+	.word	0xb01000d
+	.word	0x2db9000c
+	.word	0xb0d0000a
+	.word	0x8de00008
+	.word	0x8dd00010
+	.word	0xd01000d
+	.word	0x2dd9000c
+	.word	0xb0d00005
+	.word	0x8de00008
+	.word	0x8dd00012
+	.word	0x1c010032
+	.word	0x2dd7000c
+	.word	0xb0d00001
+	.word	0x40000a8b
+	.word	0x8de0000a
+	.word	0xcc000b72
+	.word	0x9cd0000f
+	.word	0x8de0000a
+	.word	0xcc000a2e
+	.word	0xc01000c
+	.word	0x9cd00007
+	.word	0x8de0000a
+	.word	0x8cd00012
+	.word	0x8bd00010
+	.word	0xcc1000b
+	.word	0x3b0effff
+	.word	0x1bbdffff
+	.word	0x7c1000b
+	.word	0x8ce0000c
+	.word	0x1cc00003
+	.word	0x773000c
+	.word	0x97d0000d
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce0000b
+	.word	0xc01000c
+	.word	0x9cd00000
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce0000c
+	.word	0xc01000c
+	.word	0x9cd00000
+	.word	0x97e00000
+	.word	0x8de00009
+	.word	0x9de00001
+	.word	0x8de0000c
+	.word	0xd01000d
+	.word	0x9de00002
+	.word	0x60000cf7
+	.word	0x8de0000c
+	.word	0x7d10007
+	.word	0x8de0000a
+	.word	0xd01000d
+	.word	0x9d700000
+	.word	0x87e00003
+	.word	0x8be00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1000a
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x8d000a92
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x60000e42
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c0103ff
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0x9d000a92
+	.word	0x81000a92
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x5e8
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9ae00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000ae4
+	.word	0x8de00004
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0x8ae00005
+	.word	0xbba000a
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ae00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9ae00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000b01
+	.word	0x8de00004
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0x8ae00005
+	.word	0xbba000a
+	.word	0xb03000b
+	.word	0x1bb30001
+	.word	0xccb000b
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ae00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30001
+	.word	0x9de00000
+	.word	0x8de00001
+	.word	0x90d00000
+	.word	0x1010000
+	.word	0x8de00000
+	.word	0x1ee10001
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0e003f
+	.word	0x1ccdffff
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000b32
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x1c010001
+	.word	0x8be00004
+	.word	0xcca000b
+	.word	0xddb000c
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000b32
+	.word	0x1010000
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0010bd
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x600009fd
+	.word	0xc10010bd
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x91e00000
+	.word	0x92e00001
+	.word	0x81e00002
+	.word	0x82e00000
+	.word	0x92100000
+	.word	0x82e00001
+	.word	0x92100001
+	.word	0x93100002
+	.word	0x94100003
+	.word	0x95100004
+	.word	0x96100005
+	.word	0x97100006
+	.word	0x98100007
+	.word	0x99100008
+	.word	0x9a100009
+	.word	0x9b10000a
+	.word	0x9c10000b
+	.word	0x9d10000c
+	.word	0x9f10000f
+	.word	0x1ee10002
+	.word	0x9e10000d
+	.word	0x81effffe
+	.word	0x82efffff
+	.word	0x50f00000
+	.word	0x8de00000
+	.word	0x81d00000
+	.word	0x82d00001
+	.word	0x83d00002
+	.word	0x84d00003
+	.word	0x85d00004
+	.word	0x86d00005
+	.word	0x87d00006
+	.word	0x88d00007
+	.word	0x89d00008
+	.word	0x8ad00009
+	.word	0x8bd0000a
+	.word	0x8cd0000b
+	.word	0x8fd0000f
+	.word	0x8ed0000d
+	.word	0x8dd0000c
+	.word	0x50f00000
+	.word	0x82e00000
+	.word	0x83e00001
+	.word	0x1ee10002
+	.word	0x70200000
+	.word	0xee10003
+	.word	0x50800000
+	.word	0x1ee30001
+	.word	0x91e00000
+	.word	0x81e00001
+	.word	0x92100001
+	.word	0x82e00000
+	.word	0x92100000
+	.word	0x93100002
+	.word	0x94100003
+	.word	0x95100004
+	.word	0x96100005
+	.word	0x97100006
+	.word	0x98100007
+	.word	0x99100008
+	.word	0x9a100009
+	.word	0x9b10000a
+	.word	0x9c10000b
+	.word	0x9d10000c
+	.word	0x9f10000f
+	.word	0x1ee10001
+	.word	0x9e10000d
+	.word	0x1ee10001
+	.word	0x40000b61
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001080
+	.word	0x9de00001
+	.word	0x8de00005
+	.word	0x9de00002
+	.word	0x60000abd
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x81e00005
+	.word	0x40000b9f
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x87000ba3
+	.word	0x40000bad
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x60000a15
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000a15
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000c0c
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d000ba3
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d000ba3
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000ba4
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000bbd
+	.word	0x90700003
+	.word	0x40000c53
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000be5
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x40000c54
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000be5
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000c54
+	.word	0x97000ba3
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d000ba3
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c000ba3
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x60000a15
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x60000c8f
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40000cbd
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x40000cc0
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000c9a
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000c8f
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x60000c5a
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x60000c5a
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00004
+	.word	0x86e00005
+	.word	0x8de00006
+	.word	0x2dd90000
+	.word	0xb0d00011
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x40000d0c
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0xc010006
+	.word	0x16c10001
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de00006
+	.word	0x2ddb0000
+	.word	0xb0dffff4
+	.word	0x81e00004
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee3000d
+	.word	0x93e00000
+	.word	0x94e00001
+	.word	0x95e00002
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x16010001
+	.word	0x7010000
+	.word	0x40000d29
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000c
+	.word	0x1cd20009
+	.word	0x3dc00005
+	.word	0xb0d00003
+	.word	0x8de0000c
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x40000d35
+	.word	0x5010000
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002b
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x40000d49
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002d
+	.word	0xb0d00005
+	.word	0x360effff
+	.word	0x166dffff
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000f
+	.word	0x2dda0000
+	.word	0xb0d00022
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda0030
+	.word	0xb0d0001c
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd00061
+	.word	0x14d20041
+	.word	0x40000d5e
+	.word	0x8de0000d
+	.word	0x84d00001
+	.word	0x3d4a0078
+	.word	0xb0d00006
+	.word	0x1d010010
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10002
+	.word	0x9de0000d
+	.word	0x40000d6e
+	.word	0x1d010008
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x40000d6e
+	.word	0x1d01000a
+	.word	0x9de0000f
+	.word	0x8de0000f
+	.word	0x9de0000b
+	.word	0x3dd00002
+	.word	0xb0d00003
+	.word	0x8de0000b
+	.word	0x3dd40024
+	.word	0xb0d00048
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x40000dda
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20030
+	.word	0xd01000d
+	.word	0x1c01000a
+	.word	0x2dd7000c
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x14d20030
+	.word	0x40000d99
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20061
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd00041
+	.word	0x13d20061
+	.word	0x40000d97
+	.word	0x8de0000d
+	.word	0x83d00000
+	.word	0x1d320041
+	.word	0x14d0000a
+	.word	0x8de0000f
+	.word	0x2d40000d
+	.word	0xb0d00001
+	.word	0x40000dd2
+	.word	0x3d0e7fff
+	.word	0x1dddffff
+	.word	0xdd20004
+	.word	0x8ce0000f
+	.word	0xdd6000c
+	.word	0x2d74000d
+	.word	0xb0d00013
+	.word	0x3d6a0001
+	.word	0xb0d00003
+	.word	0x330e7fff
+	.word	0x133dffff
+	.word	0x40000dab
+	.word	0x330e8000
+	.word	0x133d0000
+	.word	0x7010003
+	.word	0x60000e42
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x1c010022
+	.word	0x9cd00000
+	.word	0x40000dba
+	.word	0x8de0000f
+	.word	0xd74000d
+	.word	0x7d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000a
+	.word	0x1cd20030
+	.word	0xc01000c
+	.word	0x1b01000a
+	.word	0x2dc1000b
+	.word	0xb0dfffb9
+	.word	0x1d010006
+	.word	0x9de00009
+	.word	0x8ce0000a
+	.word	0x1cc20061
+	.word	0xc01000c
+	.word	0x2dc1000d
+	.word	0xb0dfffb2
+	.word	0x8de0000a
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x8ce00009
+	.word	0x2dd1000c
+	.word	0xb0dfffac
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1640007
+	.word	0x83e00000
+	.word	0x84e00001
+	.word	0x85e00002
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000d
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x600009fd
+	.word	0xd010001
+	.word	0x1c01000b
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x1d010006
+	.word	0x9de00002
+	.word	0x600009fd
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00005
+	.word	0x2dd90000
+	.word	0xb0d0000b
+	.word	0x87e00003
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce00004
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de00005
+	.word	0x2ddb0000
+	.word	0xb0dffff6
+	.word	0x81e00003
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00006
+	.word	0x2dda0000
+	.word	0xb0d0000a
+	.word	0x8d000ab8
+	.word	0x9de00000
+	.word	0xcd001083
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x60000abd
+	.word	0x60000de5
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000e42
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000b37
+	.word	0xd010001
+	.word	0x8c000ab8
+	.word	0x9ce00000
+	.word	0xcc00109e
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000abd
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x40000e55
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x2dd8000c
+	.word	0xb0d00001
+	.word	0x40000e60
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00004
+	.word	0x1dd10001
+	.word	0x9de00004
+	.word	0xd010000
+	.word	0x9de00002
+	.word	0x8ce00003
+	.word	0x8cc00000
+	.word	0x2dc8000d
+	.word	0xb0d00005
+	.word	0x8de00004
+	.word	0x8dd00000
+	.word	0x8ce00002
+	.word	0x2dda000c
+	.word	0xb0dfffe8
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x1d2000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x5d5
+	.word	0x5e1
+	.word	0xea1
+	.word	0xe9e
+	.word	0xe74
+	.word	0x0
+	.word	0x64
+	.word	0x65
+	.word	0x66
+	.word	0xa
+	.word	0x0
+	.word	0x65
+	.word	0x63
+	.word	0x68
+	.word	0x6f
+	.word	0x20
+	.word	0x61
+	.word	0x62
+	.word	0x63
+	.word	0x5c
+	.word	0x6e
+	.word	0x64
+	.word	0x65
+	.word	0x66
+	.word	0x5c
+	.word	0x6e
+	.word	0x67
+	.word	0x68
+	.word	0x6e
+	.word	0x20
+	.word	0x7c
+	.word	0x20
+	.word	0x74
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x20
+	.word	0x2d
+	.word	0x6e
+	.word	0x20
+	.word	0x32
+	.word	0x20
+	.word	0x7c
+	.word	0x20
+	.word	0x67
+	.word	0x72
+	.word	0x65
+	.word	0x70
+	.word	0x20
+	.word	0x64
+	.word	0x65
+	.word	0x66
+	.word	0x0
+	.word	0x2d
+	.word	0x63
+	.word	0x0
+	.word	0x2f
+	.word	0x62
+	.word	0x69
+	.word	0x6e
+	.word	0x2f
+	.word	0x77
+	.word	0x73
+	.word	0x68
+	.word	0x0
+	.word	0x61
+	.word	0x0
+	.word	0x6d
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x6f
+	.word	0x63
+	.word	0x0
+	.word	0x48
+	.word	0x65
+	.word	0x6c
+	.word	0x6c
+	.word	0x6f
+	.word	0x20
+	.word	0x57
+	.word	0x6f
+	.word	0x72
+	.word	0x6c
+	.word	0x64
+	.word	0x21
+	.word	0x20
+	.word	0x49
+	.word	0x27
+	.word	0x6d
+	.word	0x20
+	.word	0x63
+	.word	0x6f
+	.word	0x72
+	.word	0x6f
+	.word	0x75
+	.word	0x74
+	.word	0x69
+	.word	0x6e
+	.word	0x65
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x49
+	.word	0x6e
+	.word	0x76
+	.word	0x61
+	.word	0x6c
+	.word	0x69
+	.word	0x64
+	.word	0x20
+	.word	0x6e
+	.word	0x75
+	.word	0x6d
+	.word	0x62
+	.word	0x65
+	.word	0x72
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x61
+	.word	0x6c
+	.word	0x61
+	.word	0x72
+	.word	0x6d
+	.word	0x20
+	.word	0x68
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x6c
+	.word	0x65
+	.word	0x72
+	.word	0x20
+	.word	0x74
+	.word	0x72
+	.word	0x69
+	.word	0x67
+	.word	0x67
+	.word	0x65
+	.word	0x72
+	.word	0x65
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x0
+	.word	0x73
+	.word	0x69
+	.word	0x67
+	.word	0x73
+	.word	0x65
+	.word	0x67
+	.word	0x76
+	.word	0x20
+	.word	0x68
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x6c
+	.word	0x65
+	.word	0x72
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x76
+	.word	0x6f
+	.word	0x6b
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x47
+	.word	0x65
+	.word	0x6e
+	.word	0x65
+	.word	0x72
+	.word	0x61
+	.word	0x74
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x63
+	.word	0x6b
+	.word	0x20
+	.word	0x6f
+	.word	0x76
+	.word	0x65
+	.word	0x72
+	.word	0x66
+	.word	0x6c
+	.word	0x6f
+	.word	0x77
+	.word	0x20
+	.word	0x66
+	.word	0x6f
+	.word	0x72
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0xa
+	.word	0x0
+	.word	0x64
+	.word	0x69
+	.word	0x76
+	.word	0x69
+	.word	0x64
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x66
+	.word	0x6f
+	.word	0x6f
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x62
+	.word	0x79
+	.word	0x20
+	.word	0x30
+	.word	0xa
+	.word	0x0
+	.word	0x73
+	.word	0x69
+	.word	0x67
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x20
+	.word	0x68
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x6c
+	.word	0x65
+	.word	0x72
+	.word	0x20
+	.word	0x75
+	.word	0x73
+	.word	0x72
+	.word	0x31
+	.word	0x20
+	.word	0x73
+	.word	0x68
+	.word	0x6f
+	.word	0x75
+	.word	0x6c
+	.word	0x64
+	.word	0x20
+	.word	0x62
+	.word	0x65
+	.word	0x20
+	.word	0x63
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x61
+	.word	0x66
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x20
+	.word	0x74
+	.word	0x68
+	.word	0x69
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x54
+	.word	0x45
+	.word	0x52
+	.word	0x4d
+	.word	0x20
+	.word	0x65
+	.word	0x6e
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x54
+	.word	0x45
+	.word	0x52
+	.word	0x4d
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x72
+	.word	0x74
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x49
+	.word	0x4e
+	.word	0x54
+	.word	0x20
+	.word	0x65
+	.word	0x6e
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x49
+	.word	0x4e
+	.word	0x54
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x72
+	.word	0x74
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x55
+	.word	0x52
+	.word	0x32
+	.word	0x20
+	.word	0x65
+	.word	0x6e
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x55
+	.word	0x52
+	.word	0x32
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x72
+	.word	0x74
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x55
+	.word	0x52
+	.word	0x31
+	.word	0x20
+	.word	0x65
+	.word	0x6e
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x53
+	.word	0x49
+	.word	0x47
+	.word	0x55
+	.word	0x52
+	.word	0x31
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x72
+	.word	0x74
+	.word	0xa
+	.word	0x0
+	.word	0x75
+	.word	0x73
+	.word	0x65
+	.word	0x72
+	.word	0x2f
+	.word	0x63
+	.word	0x6f
+	.word	0x6d
+	.word	0x6d
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x73
+	.word	0x2f
+	.word	0x74
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x2e
+	.word	0x63
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x74
+	.word	0x75
+	.word	0x72
+	.word	0x6e
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x2d
+	.word	0x2d
+	.word	0x2d
+	.word	0xa
+	.word	0xa
+	.word	0x0
+	.word	0x20
+	.word	0x2a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x41
+	.word	0x76
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x61
+	.word	0x62
+	.word	0x6c
+	.word	0x65
+	.word	0x20
+	.word	0x54
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x20
+	.word	0x4f
+	.word	0x70
+	.word	0x74
+	.word	0x69
+	.word	0x6f
+	.word	0x6e
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x72
+	.word	0x75
+	.word	0x6e
+	.word	0x0
+	.word	0x77
+	.word	0x68
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x0
+	.word	0x70
+	.word	0x69
+	.word	0x70
+	.word	0x65
+	.word	0x0
+	.word	0x73
+	.word	0x69
+	.word	0x67
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x0
+	.word	0x74
+	.word	0x69
+	.word	0x6d
+	.word	0x65
+	.word	0x73
+	.word	0x0
+	.word	0x74
+	.word	0x69
+	.word	0x6d
+	.word	0x65
+	.word	0x72
+	.word	0x0
+	.word	0x65
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x72
+	.word	0x0
+	.word	0x6e
+	.word	0x75
+	.word	0x6c
+	.word	0x6c
+	.word	0x0
+	.word	0x63
+	.word	0x6f
+	.word	0x72
+	.word	0x6f
+	.word	0x75
+	.word	0x74
+	.word	0x69
+	.word	0x6e
+	.word	0x65
+	.word	0x0
+	.word	0x66
+	.word	0x6c
+	.word	0x6f
+	.word	0x61
+	.word	0x74
+	.word	0x0
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x63
+	.word	0x6b
+	.word	0x0
+	.word	0x25
+	.word	0x63
+	.word	0x0
+	.word	0x61
+	.word	0x73
+	.word	0x73
+	.word	0x65
+	.word	0x72
+	.word	0x74
+	.word	0x69
+	.word	0x6f
+	.word	0x6e
+	.word	0x20
+	.word	0x66
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x61
+	.word	0x74
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80000054
+	.word	0x40c
+	.word	0x19960503
+	.word	0x47d
+	.word	0x1000
+	.word	0x18e4
+	.word	0x17d8
+	.word	0x10c
+	.word	0x40
+	.word	0x1ee3000f
+	.word	0x92e00004
+	.word	0x93e00005
+	.word	0x94e00006
+	.word	0x95e00007
+	.word	0x96e00008
+	.word	0x97e00009
+	.word	0x9ce0000a
+	.word	0x9de0000b
+	.word	0x9fe0000c
+	.word	0x90e0000e
+	.word	0x90e0000d
+	.word	0x4010000
+	.word	0x7010000
+	.word	0x5010000
+	.word	0x1d010001
+	.word	0x8ce00010
+	.word	0xc01000c
+	.word	0xdd5000c
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x40000432
+	.word	0x12300001
+	.word	0x8de00010
+	.word	0x2d40000d
+	.word	0xb0d00004
+	.word	0xd710006
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x6000096e
+	.word	0xd010002
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0xc710006
+	.word	0x9dc00000
+	.word	0xd710006
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x8de0000e
+	.word	0x9de00001
+	.word	0xd010002
+	.word	0x9de00002
+	.word	0x60000520
+	.word	0x1d700001
+	.word	0x8ce00010
+	.word	0x7d8000c
+	.word	0x14400001
+	.word	0x1de1000e
+	.word	0x9de00000
+	.word	0x1de1000d
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x8de0000f
+	.word	0x9de00003
+	.word	0x60000611
+	.word	0xd010001
+	.word	0x301000d
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0dfffd7
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x6000096e
+	.word	0x8de00010
+	.word	0x2d46000d
+	.word	0xb0d00012
+	.word	0x5010000
+	.word	0x4000045a
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000a36
+	.word	0x9de00001
+	.word	0xd510006
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x60000814
+	.word	0xd510006
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x6000096e
+	.word	0x15500001
+	.word	0x2d500004
+	.word	0xb0dffff1
+	.word	0x40000470
+	.word	0x5010000
+	.word	0x4000046d
+	.word	0xd700005
+	.word	0x8ce00010
+	.word	0xdd8000c
+	.word	0xdd10006
+	.word	0x82d00000
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000a36
+	.word	0x9de00001
+	.word	0x92e00002
+	.word	0x60000814
+	.word	0x92e00000
+	.word	0x6000096e
+	.word	0x15500001
+	.word	0x8de00010
+	.word	0x2d50000d
+	.word	0xb0dfffef
+	.word	0x96e00000
+	.word	0x6000096e
+	.word	0x82e00004
+	.word	0x83e00005
+	.word	0x84e00006
+	.word	0x85e00007
+	.word	0x86e00008
+	.word	0x87e00009
+	.word	0x8ce0000a
+	.word	0x8de0000b
+	.word	0x8fe0000c
+	.word	0x1ee1000f
+	.word	0x50f00000
+	.word	0x1ee3004f
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0xc7000802
+	.word	0x6010000
+	.word	0x1501000a
+	.word	0x4010000
+	.word	0x16010001
+	.word	0x400004e5
+	.word	0x8de00050
+	.word	0xd61000d
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0xcd000a33
+	.word	0x9de00001
+	.word	0x60000826
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d0001e
+	.word	0x1d600001
+	.word	0x8ce00050
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x1de1004e
+	.word	0x9de00001
+	.word	0x1d01000a
+	.word	0x9de00002
+	.word	0x60000545
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x8de0004e
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d0000c
+	.word	0x8d00080f
+	.word	0x9de00000
+	.word	0xcd000a16
+	.word	0x9de00001
+	.word	0x1d600001
+	.word	0x8ce00050
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0x9de00002
+	.word	0x60000814
+	.word	0x11010001
+	.word	0x40000516
+	.word	0x16600001
+	.word	0x400004e4
+	.word	0x8de00050
+	.word	0xd61000d
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0xcd000a13
+	.word	0x9de00001
+	.word	0x60000826
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x400004e4
+	.word	0x8de00050
+	.word	0xd61000d
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0xcd000a11
+	.word	0x9de00001
+	.word	0x60000731
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00018
+	.word	0x600009f4
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x600007f1
+	.word	0xd010001
+	.word	0x8c00080f
+	.word	0x9ce00000
+	.word	0xcc0009f6
+	.word	0x9ce00001
+	.word	0x8ce00050
+	.word	0x8cc00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000814
+	.word	0x11010001
+	.word	0x40000516
+	.word	0x16600001
+	.word	0x8de0004f
+	.word	0x2d60000d
+	.word	0xb0dfffa4
+	.word	0x97e00000
+	.word	0x95e00001
+	.word	0x60000400
+	.word	0x2d480000
+	.word	0xb0d00028
+	.word	0x1de1004c
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x600007bd
+	.word	0x3d0e0773
+	.word	0x1ddd5940
+	.word	0x9de0004d
+	.word	0x40000514
+	.word	0x1d01002f
+	.word	0x9de00000
+	.word	0x1de1004c
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600007d5
+	.word	0x40000507
+	.word	0x1de1000c
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0xd010003
+	.word	0x9de00002
+	.word	0xcd000808
+	.word	0x9de00003
+	.word	0x60000782
+	.word	0x1de1000c
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x97e00003
+	.word	0x60000769
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x301000d
+	.word	0x2dd20000
+	.word	0xb0dfffea
+	.word	0x400004f7
+	.word	0x1010000
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee1004f
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0x9de00003
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x40000533
+	.word	0x8de00004
+	.word	0x1cd10001
+	.word	0x9ce00004
+	.word	0x8ce00005
+	.word	0x1bc10001
+	.word	0x9be00005
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00006
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00004
+	.word	0x90d00000
+	.word	0x81e00003
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee3000d
+	.word	0x93e00000
+	.word	0x94e00001
+	.word	0x95e00002
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x16010001
+	.word	0x7010000
+	.word	0x40000555
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000c
+	.word	0x1cd20009
+	.word	0x3dc00005
+	.word	0xb0d00003
+	.word	0x8de0000c
+	.word	0x3dda0020
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x40000561
+	.word	0x5010000
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002b
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x40000575
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda002d
+	.word	0xb0d00005
+	.word	0x360effff
+	.word	0x166dffff
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000f
+	.word	0x2dda0000
+	.word	0xb0d00022
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x3dda0030
+	.word	0xb0d0001c
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00001
+	.word	0x1dd00061
+	.word	0x14d20041
+	.word	0x4000058a
+	.word	0x8de0000d
+	.word	0x84d00001
+	.word	0x3d4a0078
+	.word	0xb0d00006
+	.word	0x1d010010
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10002
+	.word	0x9de0000d
+	.word	0x4000059a
+	.word	0x1d010008
+	.word	0x9de0000f
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x4000059a
+	.word	0x1d01000a
+	.word	0x9de0000f
+	.word	0x8de0000f
+	.word	0x9de0000b
+	.word	0x3dd00002
+	.word	0xb0d00003
+	.word	0x8de0000b
+	.word	0x3dd40024
+	.word	0xb0d00048
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x40000606
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20030
+	.word	0xd01000d
+	.word	0x1c01000a
+	.word	0x2dd7000c
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x14d20030
+	.word	0x400005c5
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd20061
+	.word	0xd01000d
+	.word	0x1c01001a
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x1dd00041
+	.word	0x13d20061
+	.word	0x400005c3
+	.word	0x8de0000d
+	.word	0x83d00000
+	.word	0x1d320041
+	.word	0x14d0000a
+	.word	0x8de0000f
+	.word	0x2d40000d
+	.word	0xb0d00001
+	.word	0x400005fe
+	.word	0x3d0e7fff
+	.word	0x1dddffff
+	.word	0xdd20004
+	.word	0x8ce0000f
+	.word	0xdd6000c
+	.word	0x2d74000d
+	.word	0xb0d00013
+	.word	0x3d6a0001
+	.word	0xb0d00003
+	.word	0x330e7fff
+	.word	0x133dffff
+	.word	0x400005d7
+	.word	0x330e8000
+	.word	0x133d0000
+	.word	0x7010003
+	.word	0x600009f4
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x1c010022
+	.word	0x9cd00000
+	.word	0x400005e6
+	.word	0x8de0000f
+	.word	0xd74000d
+	.word	0x7d00004
+	.word	0x8de0000d
+	.word	0x1dd10001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x8dd00000
+	.word	0x9de0000a
+	.word	0x1cd20030
+	.word	0xc01000c
+	.word	0x1b01000a
+	.word	0x2dc1000b
+	.word	0xb0dfffb9
+	.word	0x1d010006
+	.word	0x9de00009
+	.word	0x8ce0000a
+	.word	0x1cc20061
+	.word	0xc01000c
+	.word	0x2dc1000d
+	.word	0xb0dfffb2
+	.word	0x8de0000a
+	.word	0x1dd20041
+	.word	0xd01000d
+	.word	0x8ce00009
+	.word	0x2dd1000c
+	.word	0xb0dfffac
+	.word	0x8de0000e
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x1640007
+	.word	0x83e00000
+	.word	0x84e00001
+	.word	0x85e00002
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000d
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x96e00002
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0xd010000
+	.word	0x9de00007
+	.word	0x8ce00008
+	.word	0xc01000c
+	.word	0x2dc9000d
+	.word	0xb0d0000a
+	.word	0x8de00009
+	.word	0xd01000d
+	.word	0x8ce00007
+	.word	0x2dd9000c
+	.word	0xb0d00005
+	.word	0x8de0000b
+	.word	0xd01000d
+	.word	0x8ce00007
+	.word	0x2ddb000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000680
+	.word	0x8de00008
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00012
+	.word	0x8de00009
+	.word	0x1c010078
+	.word	0x9cd00000
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0x8ce00008
+	.word	0x9dc00000
+	.word	0x8de00008
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000680
+	.word	0x6010000
+	.word	0x40000669
+	.word	0x1d010001
+	.word	0xd61000d
+	.word	0x8ce00009
+	.word	0x8cc00000
+	.word	0x2dd1000c
+	.word	0xb0d00015
+	.word	0x8de00009
+	.word	0x8cd00000
+	.word	0x1cca0001
+	.word	0x9cd00000
+	.word	0x8de00008
+	.word	0x8cd00000
+	.word	0x9ce00000
+	.word	0x8ce00009
+	.word	0x8cc00000
+	.word	0x9ce00001
+	.word	0x600006ab
+	.word	0xc010001
+	.word	0x9cd00000
+	.word	0x8de00008
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000680
+	.word	0xd010006
+	.word	0x1c010001
+	.word	0x6d1000c
+	.word	0x8ce00008
+	.word	0x8cc00000
+	.word	0xdd1000c
+	.word	0x97d00000
+	.word	0x8de0000a
+	.word	0x2d7a000d
+	.word	0xb0d00001
+	.word	0x40000672
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x6000099f
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0dfffd1
+	.word	0x2d6b0000
+	.word	0xb0d00007
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x2d7a000d
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000680
+	.word	0x8de00008
+	.word	0x8dd00000
+	.word	0xd61000d
+	.word	0x90d00000
+	.word	0x1010006
+	.word	0x86e00002
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x95e00000
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x86d00004
+	.word	0x8de00007
+	.word	0x85d00004
+	.word	0x7010000
+	.word	0x40000699
+	.word	0xd710005
+	.word	0xc710006
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x1d010001
+	.word	0x771000d
+	.word	0x1d7a0002
+	.word	0x9de00005
+	.word	0x8ce00006
+	.word	0x8cc00000
+	.word	0x2dd7000c
+	.word	0xb0d00005
+	.word	0x8de00007
+	.word	0x8dd00000
+	.word	0x8ce00005
+	.word	0x2dc1000d
+	.word	0xb0dfffef
+	.word	0x85e00000
+	.word	0x86e00001
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000c
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de0000c
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00006
+	.word	0x8de0000d
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x4000072b
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x60000942
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d0006a
+	.word	0x8de0000d
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de0000a
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x60000937
+	.word	0xd010001
+	.word	0x9de0000b
+	.word	0x8de0000b
+	.word	0x8dd00000
+	.word	0x8ce0000a
+	.word	0x2dd1000c
+	.word	0xb0d0000d
+	.word	0x8de0000b
+	.word	0x8dd00000
+	.word	0x8ce0000a
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d0004f
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x9de00001
+	.word	0x60000865
+	.word	0x40000728
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x9de00009
+	.word	0x8de00009
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00027
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00023
+	.word	0x8de0000b
+	.word	0x8bd00000
+	.word	0x8dd00004
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0xdd1000b
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00018
+	.word	0x1d010005
+	.word	0xdb1000d
+	.word	0x8ce00006
+	.word	0x8cc00000
+	.word	0xdd1000c
+	.word	0x8ce0000a
+	.word	0x2dd1000c
+	.word	0xb0d00010
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x60000902
+	.word	0x8de0000b
+	.word	0x8dd00000
+	.word	0x8ce0000a
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00020
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x9de00001
+	.word	0x60000865
+	.word	0x40000728
+	.word	0x8de0000a
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0x9de00008
+	.word	0x8de00008
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x4000072b
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x60000937
+	.word	0xd010001
+	.word	0x9de00007
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000687
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x6000096e
+	.word	0x81e00008
+	.word	0x4000072b
+	.word	0x81e0000c
+	.word	0x4000072b
+	.word	0x1010000
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee1000c
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x1d010006
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010007
+	.word	0x40000763
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010102
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x600007d5
+	.word	0xd010001
+	.word	0x9d700001
+	.word	0x8d700001
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d00001
+	.word	0x40000760
+	.word	0x1d0101f4
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0x9d700004
+	.word	0x8d700004
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x4000075d
+	.word	0x1d0101f4
+	.word	0x9d700003
+	.word	0x1010007
+	.word	0x40000763
+	.word	0x8d700004
+	.word	0x9de00000
+	.word	0x6000096e
+	.word	0x97e00000
+	.word	0x6000096e
+	.word	0x1010000
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00009
+	.word	0x8ce0000a
+	.word	0xdd5000c
+	.word	0x9de00007
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x600007d5
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00009
+	.word	0x8ce0000a
+	.word	0xdd5000c
+	.word	0x9de00007
+	.word	0x1d010018
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x600007d5
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x8dd00001
+	.word	0x9de00001
+	.word	0x600007d5
+	.word	0xd010001
+	.word	0x9de00004
+	.word	0x8de00005
+	.word	0x8dd00004
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00004
+	.word	0x8de00005
+	.word	0x8dd00004
+	.word	0x9de00000
+	.word	0x6000096e
+	.word	0x8de00005
+	.word	0x8dd00002
+	.word	0x1ddb0800
+	.word	0x1ddf0800
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x6000096e
+	.word	0x81e00004
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00005
+	.word	0x2dd90000
+	.word	0xb0d0000b
+	.word	0x87e00003
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce00004
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de00005
+	.word	0x2ddb0000
+	.word	0xb0dffff6
+	.word	0x81e00003
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d0007d7
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x400007e5
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x810007d7
+	.word	0x400007ed
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x600007d5
+	.word	0xd010001
+	.word	0x9d0007d7
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd000a39
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x600007d5
+	.word	0xc1000a39
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x224
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x600007d5
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x40000837
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x2dd8000c
+	.word	0xb0d00001
+	.word	0x40000842
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00004
+	.word	0x1dd10001
+	.word	0x9de00004
+	.word	0xd010000
+	.word	0x9de00002
+	.word	0x8ce00003
+	.word	0x8cc00000
+	.word	0x2dc8000d
+	.word	0xb0d00005
+	.word	0x8de00004
+	.word	0x8dd00000
+	.word	0x8ce00002
+	.word	0x2dda000c
+	.word	0xb0dfffe8
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x1d2000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8700084b
+	.word	0x40000855
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x600007d8
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x600007d8
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400008b4
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d00084b
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d00084b
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x6000084c
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000865
+	.word	0x90700003
+	.word	0x400008fb
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x6000088d
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x400008fc
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x6000088d
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400008fc
+	.word	0x9700084b
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d00084b
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c00084b
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x600007d8
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x60000937
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40000965
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x40000968
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000942
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000937
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x60000902
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x60000902
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x9be00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de0000b
+	.word	0x8dd00002
+	.word	0x1ddb0010
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x400009ee
+	.word	0x8de0000b
+	.word	0x8dd00004
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00009
+	.word	0x1d0101f4
+	.word	0x9de00000
+	.word	0x600008ba
+	.word	0xd010001
+	.word	0x8ce0000b
+	.word	0x9dc00004
+	.word	0x8de0000b
+	.word	0x1c0101f4
+	.word	0x9cd00003
+	.word	0x8de0000b
+	.word	0x8cd00000
+	.word	0x8dd00004
+	.word	0xdc1000d
+	.word	0x9de0000a
+	.word	0x8de0000b
+	.word	0x8dd00005
+	.word	0xd01000d
+	.word	0x9de00008
+	.word	0x2dd90000
+	.word	0xb0d00005
+	.word	0x8de0000a
+	.word	0xd01000d
+	.word	0x8ce00008
+	.word	0x2dc1000d
+	.word	0xb0d0001d
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x8cd00001
+	.word	0x9ce00001
+	.word	0x8cd00004
+	.word	0x9ce00002
+	.word	0x8dd00003
+	.word	0x9de00003
+	.word	0x600007d5
+	.word	0xd010001
+	.word	0x9de00009
+	.word	0x8de00009
+	.word	0x2dd20000
+	.word	0xb0d00008
+	.word	0x8de0000b
+	.word	0x1dd10002
+	.word	0x8cd00000
+	.word	0x1ccd0010
+	.word	0x9cd00000
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x400009ee
+	.word	0x8de0000b
+	.word	0x8ce00009
+	.word	0x9cd00000
+	.word	0x8de0000b
+	.word	0x8cd00004
+	.word	0x9cd00005
+	.word	0x8de0000b
+	.word	0x1dd10005
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8dc00000
+	.word	0x101000d
+	.word	0x8be00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x45
+	.word	0x72
+	.word	0x72
+	.word	0x6f
+	.word	0x72
+	.word	0x20
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x6e
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x2c
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x72
+	.word	0x0
+	.word	0x2d
+	.word	0x66
+	.word	0x0
+	.word	0x49
+	.word	0x6e
+	.word	0x76
+	.word	0x61
+	.word	0x6c
+	.word	0x69
+	.word	0x64
+	.word	0x20
+	.word	0x6e
+	.word	0x75
+	.word	0x6d
+	.word	0x62
+	.word	0x65
+	.word	0x72
+	.word	0x20
+	.word	0x6f
+	.word	0x66
+	.word	0x20
+	.word	0x6c
+	.word	0x69
+	.word	0x6e
+	.word	0x65
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x2d
+	.word	0x6e
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x800000c1
+	.word	0x17
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x40
+	.word	0x40
+	.word	0x0
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d01000d
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x6000040e
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x800000e9
+	.word	0x60
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x2ac
+	.word	0x1f0
+	.word	0xbc
+	.word	0x40
+	.word	0x1ee30006
+	.word	0x97e00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x1dd10001
+	.word	0x9de00007
+	.word	0x8dd00000
+	.word	0x9de00005
+	.word	0x8de00006
+	.word	0x3dd60002
+	.word	0xb0d00007
+	.word	0x8d000463
+	.word	0x9de00000
+	.word	0xcd000489
+	.word	0x9de00001
+	.word	0x60000468
+	.word	0x11010001
+	.word	0x40000420
+	.word	0x1d010038
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x9de00001
+	.word	0x6000047a
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00003
+	.word	0xcd00047c
+	.word	0x9de00000
+	.word	0x60000438
+	.word	0x1010007
+	.word	0x87e00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0004ab
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x6000047a
+	.word	0xc10004ab
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000425
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000427
+	.word	0xd010001
+	.word	0x8c000463
+	.word	0x9ce00000
+	.word	0xcc0004a3
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000468
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x42
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x6000047a
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x72
+	.word	0x6d
+	.word	0x64
+	.word	0x69
+	.word	0x72
+	.word	0x20
+	.word	0x66
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0x0
+	.word	0x75
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x72
+	.word	0x6d
+	.word	0x64
+	.word	0x69
+	.word	0x72
+	.word	0x20
+	.word	0x5b
+	.word	0x44
+	.word	0x49
+	.word	0x52
+	.word	0x45
+	.word	0x43
+	.word	0x54
+	.word	0x4f
+	.word	0x52
+	.word	0x59
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x8000004f
+	.word	0xbd7
+	.word	0x19960503
+	.word	0x404
+	.word	0x1000
+	.word	0x3968
+	.word	0x2fc4
+	.word	0x9a4
+	.word	0x8
+	.word	0x1
+	.word	0x1
+	.word	0x0
+	.word	0x0
+	.word	0x1ee3000b
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de0000c
+	.word	0x17d10001
+	.word	0x8de0000b
+	.word	0x9d00125a
+	.word	0x8de0000c
+	.word	0x8dd00000
+	.word	0x9d00125b
+	.word	0x40000437
+	.word	0x8d00125a
+	.word	0x1dd20001
+	.word	0x9d00125a
+	.word	0x8d700000
+	.word	0x85d00001
+	.word	0x1d01006e
+	.word	0x9de00009
+	.word	0x2d58000d
+	.word	0xb0d0000f
+	.word	0x8de00009
+	.word	0x2d52000d
+	.word	0xb0d00003
+	.word	0x3d580065
+	.word	0xb0d00012
+	.word	0x40000435
+	.word	0x3d580073
+	.word	0xb0d0000b
+	.word	0x3d580076
+	.word	0xb0d00001
+	.word	0x40000435
+	.word	0x90000401
+	.word	0x1d010001
+	.word	0x9d000402
+	.word	0x40000436
+	.word	0x8d000403
+	.word	0x1dd00001
+	.word	0x9d000403
+	.word	0x40000436
+	.word	0xd010000
+	.word	0x9d000402
+	.word	0x9d000401
+	.word	0x40000436
+	.word	0x17710001
+	.word	0x40000440
+	.word	0x6000051a
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de00009
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00004
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x3dd8002d
+	.word	0xb0dfffd3
+	.word	0x8d700000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x6000051a
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x60000885
+	.word	0xd010001
+	.word	0x601000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x8d000fda
+	.word	0x9de00000
+	.word	0xcd001065
+	.word	0x9de00001
+	.word	0x60000fdf
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600007ea
+	.word	0x8d700000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00030
+	.word	0x90e00000
+	.word	0x96e00001
+	.word	0x6000049a
+	.word	0x40000491
+	.word	0x8d700000
+	.word	0x9de00000
+	.word	0xcd001063
+	.word	0x9de00001
+	.word	0x600006d0
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00005
+	.word	0xcd001063
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x6000049a
+	.word	0x4000048c
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x600007ea
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x8d700000
+	.word	0x9de00002
+	.word	0x600007ea
+	.word	0xd010001
+	.word	0x9de0000a
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0d0000a
+	.word	0x8d000fda
+	.word	0x9de00000
+	.word	0xcd001054
+	.word	0x9de00001
+	.word	0x8d700000
+	.word	0x9de00002
+	.word	0x60000fdf
+	.word	0x1d010002
+	.word	0x9d000400
+	.word	0x4000048c
+	.word	0x8d700000
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x6000049a
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dfffd0
+	.word	0x81000400
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x1ee30070
+	.word	0x93e00003
+	.word	0x94e00004
+	.word	0x95e00005
+	.word	0x96e00006
+	.word	0x97e00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x6010000
+	.word	0x400004df
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x1d01000a
+	.word	0x9de00001
+	.word	0x6000055e
+	.word	0xd010001
+	.word	0x401000d
+	.word	0x16600001
+	.word	0xd010004
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x8d000fda
+	.word	0x9de00000
+	.word	0xcd00103f
+	.word	0x9de00001
+	.word	0x8de00070
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x83e00070
+	.word	0x400004bb
+	.word	0xc3001039
+	.word	0x93e00002
+	.word	0x60000fdf
+	.word	0x400004bf
+	.word	0x90400000
+	.word	0x8de00071
+	.word	0x9de00000
+	.word	0x1de1000b
+	.word	0x9de00001
+	.word	0x60000d74
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d0000e
+	.word	0x8d000401
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00070
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x600004f4
+	.word	0x8d000400
+	.word	0x3dd80002
+	.word	0xb0d0000b
+	.word	0x90000400
+	.word	0x400004df
+	.word	0x8d000402
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00070
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x600004f4
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x1d010065
+	.word	0x9de00001
+	.word	0x6000052b
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0x2dda000c
+	.word	0xb0dfffbb
+	.word	0x83e00003
+	.word	0x84e00004
+	.word	0x85e00005
+	.word	0x86e00006
+	.word	0x87e00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee10070
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0000a
+	.word	0x8d00125a
+	.word	0x3dd40003
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001035
+	.word	0x9de00001
+	.word	0x8de00005
+	.word	0x9de00002
+	.word	0x60000fdf
+	.word	0x8d000403
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd001031
+	.word	0x9de00001
+	.word	0x8de00006
+	.word	0x9de00002
+	.word	0x60000fdf
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00102d
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x60000fdf
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d000fda
+	.word	0x9de00000
+	.word	0xcd000ff1
+	.word	0x9de00001
+	.word	0x60000fdf
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600007ea
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x86e00006
+	.word	0x40000554
+	.word	0xcd000fcd
+	.word	0x9de00000
+	.word	0x60000830
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00006
+	.word	0x1cd10001
+	.word	0x9ce00006
+	.word	0x97d00000
+	.word	0x2d760000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000557
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0xc010006
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0x8ce00007
+	.word	0x1cc20001
+	.word	0x2dd8000c
+	.word	0xb0d00002
+	.word	0x3d7a000a
+	.word	0xb0d00008
+	.word	0x8de00006
+	.word	0x90d00000
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0xc010006
+	.word	0xdd3000c
+	.word	0x101000d
+	.word	0x40000557
+	.word	0x40000533
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x86e00001
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x40000566
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x9de00004
+	.word	0x2dd80000
+	.word	0xb0d00004
+	.word	0x8de00006
+	.word	0x8ce00004
+	.word	0x2dca000d
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x6010007
+	.word	0x40000574
+	.word	0x6010000
+	.word	0xd010006
+	.word	0x101000d
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8700057c
+	.word	0x40000586
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x6000074b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x6000074b
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400005e5
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d00057c
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d00057c
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x6000057d
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000596
+	.word	0x90700003
+	.word	0x4000062c
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600005be
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x4000062d
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600005be
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x4000062d
+	.word	0x9700057c
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d00057c
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c00057c
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x6000074b
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x60000668
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40000696
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x40000699
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000673
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000668
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x60000633
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x60000633
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x400006e1
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x2dd8000c
+	.word	0xb0d00001
+	.word	0x400006ec
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00004
+	.word	0x1dd10001
+	.word	0x9de00004
+	.word	0xd010000
+	.word	0x9de00002
+	.word	0x8ce00003
+	.word	0x8cc00000
+	.word	0x2dc8000d
+	.word	0xb0d00005
+	.word	0x8de00004
+	.word	0x8dd00000
+	.word	0x8ce00002
+	.word	0x2dda000c
+	.word	0xb0dfffe8
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x1d2000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x87e0000c
+	.word	0x86e0000b
+	.word	0xd010007
+	.word	0xc010006
+	.word	0x2dd9000c
+	.word	0xb0d00003
+	.word	0x8de0000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x81e0000b
+	.word	0x40000742
+	.word	0xd010006
+	.word	0x9de0000a
+	.word	0xc010007
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x8de0000a
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0x8ce0000d
+	.word	0xc01000c
+	.word	0x2dd6000c
+	.word	0xb0d0000e
+	.word	0x8de0000d
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x501000d
+	.word	0x4000071d
+	.word	0xd510006
+	.word	0xc510007
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x15520001
+	.word	0x2d560000
+	.word	0xb0dffff9
+	.word	0x81e0000b
+	.word	0x40000742
+	.word	0xd010007
+	.word	0x9de00009
+	.word	0xc010006
+	.word	0x2dd5000c
+	.word	0xb0d00014
+	.word	0x8de00009
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0x8ce0000d
+	.word	0xc01000c
+	.word	0x2dd6000c
+	.word	0xb0d0000d
+	.word	0x5010000
+	.word	0x40000735
+	.word	0xd510006
+	.word	0xc510007
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x1d010001
+	.word	0x551000d
+	.word	0x8de0000d
+	.word	0x2d51000d
+	.word	0xb0dffff7
+	.word	0x81e0000b
+	.word	0x40000742
+	.word	0x8de0000b
+	.word	0x9de00000
+	.word	0x8de0000c
+	.word	0x9de00001
+	.word	0x8de0000d
+	.word	0x9de00002
+	.word	0x600007ec
+	.word	0x81e0000b
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d00074a
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x40000758
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x8100074a
+	.word	0x40000760
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x600007ea
+	.word	0xd010001
+	.word	0x9d00074a
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x7010000
+	.word	0x4000077b
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x6000055e
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x1010007
+	.word	0x40000780
+	.word	0x8de00005
+	.word	0x1dd10001
+	.word	0x9de00005
+	.word	0x1d010001
+	.word	0x771000d
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dfffeb
+	.word	0x1010007
+	.word	0x87e00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x40000798
+	.word	0x8de00004
+	.word	0x8dd00000
+	.word	0x8ce00005
+	.word	0x8cc00000
+	.word	0x2dd8000c
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400007ab
+	.word	0x8de00004
+	.word	0x1dd10001
+	.word	0x9de00004
+	.word	0x8de00005
+	.word	0x1dd10001
+	.word	0x9de00005
+	.word	0xd010000
+	.word	0x9de00003
+	.word	0x8ce00004
+	.word	0x8cc00000
+	.word	0x2dc8000d
+	.word	0xb0d00005
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x8ce00003
+	.word	0x2dda000c
+	.word	0xb0dfffe7
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x400007aa
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x96e00002
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x87e00007
+	.word	0x86e00008
+	.word	0x400007c7
+	.word	0x8d700000
+	.word	0x8c600000
+	.word	0x2dda000c
+	.word	0xb0d00009
+	.word	0x97e00000
+	.word	0x96e00001
+	.word	0x60000785
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0xd010007
+	.word	0x101000d
+	.word	0x400007cb
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0dfffef
+	.word	0x1010000
+	.word	0x86e00002
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00003
+	.word	0x9de00002
+	.word	0x400007db
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffff9
+	.word	0x8de00003
+	.word	0xd01000d
+	.word	0x8ce00002
+	.word	0xc01000c
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0x101000d
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00004
+	.word	0x86e00005
+	.word	0x8de00006
+	.word	0x2dd90000
+	.word	0xb0d00011
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x40000801
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0xc010006
+	.word	0x16c10001
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de00006
+	.word	0x2ddb0000
+	.word	0xb0dffff4
+	.word	0x81e00004
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x7010000
+	.word	0x40000817
+	.word	0x1d010001
+	.word	0x771000d
+	.word	0x8de00007
+	.word	0x9de00006
+	.word	0x8cd00000
+	.word	0x2dc80000
+	.word	0xb0d0000d
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x1dd10001
+	.word	0x9de00007
+	.word	0x8de00006
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x6000055e
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dfffec
+	.word	0x1010007
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x9be00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de0000b
+	.word	0x8dd00002
+	.word	0x1ddb0010
+	.word	0x2dd80000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x4000087f
+	.word	0x8de0000b
+	.word	0x8dd00004
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00009
+	.word	0x1d0101f4
+	.word	0x9de00000
+	.word	0x600005eb
+	.word	0xd010001
+	.word	0x8ce0000b
+	.word	0x9dc00004
+	.word	0x8de0000b
+	.word	0x1c0101f4
+	.word	0x9cd00003
+	.word	0x8de0000b
+	.word	0x8cd00000
+	.word	0x8dd00004
+	.word	0xdc1000d
+	.word	0x9de0000a
+	.word	0x8de0000b
+	.word	0x8dd00005
+	.word	0xd01000d
+	.word	0x9de00008
+	.word	0x2dd90000
+	.word	0xb0d00005
+	.word	0x8de0000a
+	.word	0xd01000d
+	.word	0x8ce00008
+	.word	0x2dc1000d
+	.word	0xb0d0001d
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x8cd00001
+	.word	0x9ce00001
+	.word	0x8cd00004
+	.word	0x9ce00002
+	.word	0x8dd00003
+	.word	0x9de00003
+	.word	0x600007ea
+	.word	0xd010001
+	.word	0x9de00009
+	.word	0x8de00009
+	.word	0x2dd20000
+	.word	0xb0d00008
+	.word	0x8de0000b
+	.word	0x1dd10002
+	.word	0x8cd00000
+	.word	0x1ccd0010
+	.word	0x9cd00000
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x4000087f
+	.word	0x8de0000b
+	.word	0x8ce00009
+	.word	0x9cd00000
+	.word	0x8de0000b
+	.word	0x8cd00004
+	.word	0x9cd00005
+	.word	0x8de0000b
+	.word	0x1dd10005
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8dc00000
+	.word	0x101000d
+	.word	0x8be00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x1ee30012
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de00012
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00005
+	.word	0xcd001232
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x4000091a
+	.word	0x8de00012
+	.word	0x9de0000b
+	.word	0x1d010001
+	.word	0x9de0000c
+	.word	0x90e00011
+	.word	0x1d010009
+	.word	0x9de0000e
+	.word	0xd010000
+	.word	0x9de00010
+	.word	0x9de0000f
+	.word	0x1de1000e
+	.word	0x9de0000d
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x1d01007b
+	.word	0x9de00001
+	.word	0x60000cce
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1de1000a
+	.word	0x9de00002
+	.word	0x60000922
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x4000091a
+	.word	0x8de00011
+	.word	0x3dd07fff
+	.word	0xb0d00005
+	.word	0xcd001223
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x4000091a
+	.word	0x8de00011
+	.word	0xd01000d
+	.word	0x1c010019
+	.word	0xdd1000c
+	.word	0x9de00000
+	.word	0x600005eb
+	.word	0xd010001
+	.word	0x601000d
+	.word	0xd010006
+	.word	0x2ddb0000
+	.word	0xb0d00005
+	.word	0xcd001216
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x4000091a
+	.word	0x8de00012
+	.word	0x9de0000b
+	.word	0x1d010001
+	.word	0x9de0000c
+	.word	0x1d610018
+	.word	0x9de0000d
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x1d01007b
+	.word	0x9de00001
+	.word	0x60000cce
+	.word	0x1de1000b
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1de1000a
+	.word	0x9de00002
+	.word	0x60000922
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x4000091a
+	.word	0x90600014
+	.word	0x90600015
+	.word	0x90600016
+	.word	0x90600017
+	.word	0x17610019
+	.word	0x97e00000
+	.word	0x60000f99
+	.word	0xd010001
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0d0002d
+	.word	0x17710003
+	.word	0x8d700000
+	.word	0x3dda0008
+	.word	0xb0d00003
+	.word	0x8d700003
+	.word	0x9d600014
+	.word	0x400008f8
+	.word	0x8d700000
+	.word	0x3dda0001
+	.word	0xb0d00002
+	.word	0x1d010001
+	.word	0x9d600015
+	.word	0x8de0000a
+	.word	0x1ddb0004
+	.word	0x2dd80000
+	.word	0xb0d0001d
+	.word	0x90e00009
+	.word	0x5010000
+	.word	0x40000912
+	.word	0x8d700000
+	.word	0x3dda0008
+	.word	0xb0d0000c
+	.word	0x1d710003
+	.word	0x9de00000
+	.word	0x600007d2
+	.word	0xd010001
+	.word	0x2dd10005
+	.word	0xb0d00006
+	.word	0x1d710003
+	.word	0x9de00009
+	.word	0x9de00000
+	.word	0x600007d2
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x97e00000
+	.word	0x60000f99
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0dfffea
+	.word	0x8de00009
+	.word	0x9d600016
+	.word	0xd010005
+	.word	0x9d600017
+	.word	0x1010006
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10012
+	.word	0x50f00000
+	.word	0x1ee3000e
+	.word	0x93e00003
+	.word	0x94e00004
+	.word	0x95e00005
+	.word	0x96e00006
+	.word	0x97e00007
+	.word	0x9be00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x4010000
+	.word	0x8de00010
+	.word	0x1c010001
+	.word	0x9cd00000
+	.word	0x8de0000f
+	.word	0x2dd80000
+	.word	0xb0d00016
+	.word	0x8de0000e
+	.word	0x8dd00001
+	.word	0x3dd0000a
+	.word	0xb0d00005
+	.word	0xcd00120a
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x400009e3
+	.word	0x8de0000e
+	.word	0x1dd10001
+	.word	0x84d00000
+	.word	0x8cd00000
+	.word	0x1cc00001
+	.word	0x9cd00000
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x1d400014
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x1de1000d
+	.word	0x9de00001
+	.word	0x600009ee
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400009e3
+	.word	0x8de0000f
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x60000d20
+	.word	0x4000095f
+	.word	0x6010007
+	.word	0x8de00010
+	.word	0x8cd00000
+	.word	0x8be0000d
+	.word	0xb03000b
+	.word	0x1bb30001
+	.word	0x1bbb0001
+	.word	0xb03000b
+	.word	0x1bb30001
+	.word	0xccb000b
+	.word	0x9cd00000
+	.word	0x8de00010
+	.word	0x8cd00000
+	.word	0x8be0000d
+	.word	0x1bbb0004
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0x40000995
+	.word	0x8de0000e
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x1de1000d
+	.word	0x9de00001
+	.word	0x600009ee
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400009e3
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x97e00002
+	.word	0x60000d20
+	.word	0x8de00010
+	.word	0x8cd00000
+	.word	0x8be0000d
+	.word	0xb03000b
+	.word	0x1bb30001
+	.word	0x1bbb0001
+	.word	0xb03000b
+	.word	0x1bb30001
+	.word	0xccb000b
+	.word	0x9cd00000
+	.word	0x8de00010
+	.word	0x8cd00000
+	.word	0x8be0000d
+	.word	0x1bbb0004
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0x8de0000e
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x3dd8007c
+	.word	0xb0dfffd6
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x8de0000f
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x1340001e
+	.word	0x400009a2
+	.word	0x3010000
+	.word	0x93e00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x95e00002
+	.word	0x60000d20
+	.word	0x7010006
+	.word	0x400009b6
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0x95e00002
+	.word	0x60000d57
+	.word	0x97e00000
+	.word	0x60000f99
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0dffff4
+	.word	0x8de0000f
+	.word	0x2dd80000
+	.word	0xb0d0000c
+	.word	0x8de0000e
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8dc00000
+	.word	0x3dd80029
+	.word	0xb0d00005
+	.word	0xcd0011fa
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x400009e3
+	.word	0xd010000
+	.word	0x9de0000c
+	.word	0x8ce0000f
+	.word	0x2dca000d
+	.word	0xb0d00015
+	.word	0x8de0000e
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x8ce0000c
+	.word	0x2dd8000c
+	.word	0xb0d0000f
+	.word	0x8de0000e
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x3dda0029
+	.word	0xb0d00005
+	.word	0xcd0011ed
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x400009e3
+	.word	0xcd0011d1
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x400009e3
+	.word	0x1010006
+	.word	0x83e00003
+	.word	0x84e00004
+	.word	0x85e00005
+	.word	0x86e00006
+	.word	0x87e00007
+	.word	0x8be00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee1000e
+	.word	0x50f00000
+	.word	0x1ee3000c
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9be00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x90e0000b
+	.word	0x8de0000d
+	.word	0x90d00000
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010006
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de0000a
+	.word	0x5010000
+	.word	0x40000a24
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1de1000b
+	.word	0x9de00001
+	.word	0x60000a40
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000a37
+	.word	0x8de0000d
+	.word	0x8cd00000
+	.word	0x8be0000b
+	.word	0x1bbb0001
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0d00007
+	.word	0x8de0000d
+	.word	0x8cd00000
+	.word	0x8be0000b
+	.word	0x1bbb0004
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0x40000a23
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x97e00002
+	.word	0x60000d20
+	.word	0x5010007
+	.word	0x8de0000c
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x601000d
+	.word	0x2dd80000
+	.word	0xb0d00004
+	.word	0x3d68007c
+	.word	0xb0d00002
+	.word	0x3d6a0029
+	.word	0xb0dfffd4
+	.word	0xd010005
+	.word	0x2ddb0000
+	.word	0xb0d00005
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010009
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0x81e0000a
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8be00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1000c
+	.word	0x50f00000
+	.word	0x1ee3000c
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1de1000b
+	.word	0x9de00001
+	.word	0x60000b3f
+	.word	0xd010001
+	.word	0x601000d
+	.word	0xd010006
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000b38
+	.word	0x8de0000c
+	.word	0x8dd00000
+	.word	0x87d00000
+	.word	0x3d78002a
+	.word	0xb0d00009
+	.word	0x3d78002b
+	.word	0xb0d00007
+	.word	0x3d78003f
+	.word	0xb0d00005
+	.word	0x8de0000d
+	.word	0x8ce0000b
+	.word	0x9cd00000
+	.word	0x1010006
+	.word	0x40000b38
+	.word	0x8de0000b
+	.word	0x1ddb0001
+	.word	0x2dda0000
+	.word	0xb0d00007
+	.word	0x3d78003f
+	.word	0xb0d00005
+	.word	0xcd0011b7
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000b38
+	.word	0x1d01002a
+	.word	0x9de00009
+	.word	0x2d78000d
+	.word	0xb0d00008
+	.word	0x3d78002b
+	.word	0xb0d0000a
+	.word	0x8de00009
+	.word	0x2d70000d
+	.word	0xb0d0000d
+	.word	0x3d78003f
+	.word	0xb0d00009
+	.word	0x40000a81
+	.word	0x8de0000d
+	.word	0x1c010004
+	.word	0x9cd00000
+	.word	0x40000a81
+	.word	0x8de0000d
+	.word	0x1c010005
+	.word	0x9cd00000
+	.word	0x40000a81
+	.word	0x8de0000d
+	.word	0x90d00000
+	.word	0x3d7a002a
+	.word	0xb0d0000b
+	.word	0x8de0000b
+	.word	0x1ddb0002
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d01000a
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000ceb
+	.word	0x40000b22
+	.word	0x3d7a002a
+	.word	0xb0d0002d
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010006
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000ceb
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010007
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x8ce0000c
+	.word	0x9ce00000
+	.word	0x96e00001
+	.word	0x9de00002
+	.word	0x60000d57
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x96e00002
+	.word	0x60000d57
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010006
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x8ce0000c
+	.word	0x9ce00000
+	.word	0x96e00001
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010009
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x8ce0000c
+	.word	0x9ce00000
+	.word	0x96e00001
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x40000b22
+	.word	0x3d7a002b
+	.word	0xb0d0000b
+	.word	0x8de0000b
+	.word	0x1ddb0002
+	.word	0x2dd80000
+	.word	0xb0d00007
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d01000b
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000ceb
+	.word	0x40000b22
+	.word	0x3d7a002b
+	.word	0xb0d00030
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010006
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de0000a
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010007
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x8ce0000c
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000d20
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010006
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x8ce0000c
+	.word	0x9ce00000
+	.word	0x8ce0000a
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010009
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x8ce0000c
+	.word	0x9ce00000
+	.word	0x96e00001
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x40000b22
+	.word	0x3d7a003f
+	.word	0xb0d00024
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010006
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000ceb
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010006
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x8ce0000c
+	.word	0x9ce00000
+	.word	0x96e00001
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010009
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de0000a
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x60000d57
+	.word	0x8de0000c
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x8de0000c
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x9de00008
+	.word	0x3dd8002a
+	.word	0xb0d00006
+	.word	0x8de00008
+	.word	0x3dd8002b
+	.word	0xb0d00003
+	.word	0x8de00008
+	.word	0x3dda003f
+	.word	0xb0d00005
+	.word	0xcd0011ac
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000b38
+	.word	0x1010006
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1000c
+	.word	0x50f00000
+	.word	0x1ee30013
+	.word	0x94e00003
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9be00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x8de00014
+	.word	0x90d00000
+	.word	0x8de00013
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x87c00000
+	.word	0x1d01003f
+	.word	0x9de00010
+	.word	0x2d78000d
+	.word	0xb0d000cb
+	.word	0x8de00010
+	.word	0x2d72000d
+	.word	0xb0d0000d
+	.word	0xd010000
+	.word	0x9de0000f
+	.word	0x2d78000d
+	.word	0xb0d000bf
+	.word	0x8de0000f
+	.word	0x2d70000d
+	.word	0xb0d000e8
+	.word	0x3d700024
+	.word	0xb0d000e6
+	.word	0x3d72002e
+	.word	0xb0d000e4
+	.word	0x8d701057
+	.word	0x50d00000
+	.word	0x1d01005b
+	.word	0x9de0000e
+	.word	0x2d78000d
+	.word	0xb0d00026
+	.word	0x3d78005c
+	.word	0xb0d000ba
+	.word	0x3d78005e
+	.word	0xb0d00006
+	.word	0x8de0000e
+	.word	0x2d70000d
+	.word	0xb0d000d7
+	.word	0x3d78007c
+	.word	0xb0d000a9
+	.word	0x40000c45
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x40000c9a
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x40000c9a
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010003
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x8de00014
+	.word	0x8cd00000
+	.word	0x1ccd0003
+	.word	0x9cd00000
+	.word	0x40000c9a
+	.word	0x8de00013
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x3dda005e
+	.word	0xb0d0000c
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010005
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x8de00013
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x40000ba5
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010004
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x8de00013
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x501000d
+	.word	0x3dd8005d
+	.word	0xb0d00002
+	.word	0x3d5a002d
+	.word	0xb0d0003c
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x60000cce
+	.word	0x8de00013
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x40000be9
+	.word	0x3d58002d
+	.word	0xb0d00005
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x60000cce
+	.word	0x40000be9
+	.word	0x8de00013
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x501000d
+	.word	0x3dd8005d
+	.word	0xb0d00002
+	.word	0x2d5a0000
+	.word	0xb0d00006
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d01002d
+	.word	0x9de00001
+	.word	0x60000cce
+	.word	0x40000be9
+	.word	0x8de00013
+	.word	0x8dd00000
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x601000d
+	.word	0xd010005
+	.word	0x401000d
+	.word	0x2d640004
+	.word	0xb0d00005
+	.word	0xcd00119b
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000c9b
+	.word	0x16600001
+	.word	0x40000be3
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000cce
+	.word	0x16600001
+	.word	0x2d640004
+	.word	0xb0dffff9
+	.word	0x8de00013
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x8de00013
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8dc00000
+	.word	0x501000d
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x3d5a005d
+	.word	0xb0dfffc3
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x60000cce
+	.word	0x3d58005d
+	.word	0xb0d00005
+	.word	0xcd00118e
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000c9b
+	.word	0x8de00014
+	.word	0x8cd00000
+	.word	0x1ccd0003
+	.word	0x9cd00000
+	.word	0x40000c9a
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x1de10011
+	.word	0x9de00002
+	.word	0x60000922
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x8de00012
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000c9b
+	.word	0x8de00014
+	.word	0x8cd00000
+	.word	0x8be00011
+	.word	0x1bbb0005
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0x40000c9a
+	.word	0xcd00116e
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000c9b
+	.word	0xcd00115a
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000c9b
+	.word	0x8de00013
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0d00005
+	.word	0xcd00114f
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000c9b
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010008
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8dc00000
+	.word	0x9de00001
+	.word	0x60000cce
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x60000cce
+	.word	0x8de00014
+	.word	0x8cd00000
+	.word	0x1ccd0003
+	.word	0x9cd00000
+	.word	0x40000c9a
+	.word	0x8de00013
+	.word	0x8cd00000
+	.word	0x3b0effff
+	.word	0x1bbdffff
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00013
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0xcd001143
+	.word	0x9de00001
+	.word	0x60000764
+	.word	0xd010001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x2ddb0000
+	.word	0xb0d00005
+	.word	0xcd001129
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000c9b
+	.word	0x8de0000d
+	.word	0x8ce00013
+	.word	0x8cc00000
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0x9de0000c
+	.word	0x8de0000d
+	.word	0x1c010001
+	.word	0x2dd5000c
+	.word	0xb0d0000e
+	.word	0x8de0000c
+	.word	0x9de0000b
+	.word	0x3dd8002a
+	.word	0xb0d00006
+	.word	0x8de0000b
+	.word	0x3dd8002b
+	.word	0xb0d00003
+	.word	0x8de0000b
+	.word	0x3dda003f
+	.word	0xb0d00004
+	.word	0x8de0000d
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de0000d
+	.word	0x8de00014
+	.word	0x8cd00000
+	.word	0x1ccd0001
+	.word	0x9cd00000
+	.word	0x8de0000d
+	.word	0x1c010001
+	.word	0x2ddb000c
+	.word	0xb0d00004
+	.word	0x8de00014
+	.word	0x8cd00000
+	.word	0x1ccd0002
+	.word	0x9cd00000
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x1d010008
+	.word	0x9de00001
+	.word	0x60000ca5
+	.word	0xd010001
+	.word	0x9de00012
+	.word	0x40000c93
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8dc00000
+	.word	0x9de00001
+	.word	0x60000cce
+	.word	0x8de0000d
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x2ddb0000
+	.word	0xb0dffff1
+	.word	0x8de00013
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x60000cce
+	.word	0x81e00012
+	.word	0x84e00003
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8be00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee10013
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00004
+	.word	0x86d00002
+	.word	0x8de00004
+	.word	0x8cd00002
+	.word	0xc01000c
+	.word	0x1dd10003
+	.word	0xd01000d
+	.word	0x2dcb000d
+	.word	0xb0d00007
+	.word	0x8de00004
+	.word	0x1dd10006
+	.word	0x8cd00000
+	.word	0x1cc00003
+	.word	0x9cd00000
+	.word	0x1010006
+	.word	0x40000cc8
+	.word	0x7010006
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0x8de00004
+	.word	0x97d00002
+	.word	0x1010006
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00003
+	.word	0x8cd00002
+	.word	0xc01000c
+	.word	0x1dd10003
+	.word	0xd01000d
+	.word	0x2dc9000d
+	.word	0xb0d00008
+	.word	0x8de00003
+	.word	0x1dd10002
+	.word	0x8cd00000
+	.word	0x1bc10001
+	.word	0x9bd00000
+	.word	0x8de00004
+	.word	0x9dc00000
+	.word	0x40000ce6
+	.word	0x8de00003
+	.word	0x1dd10006
+	.word	0x8cd00000
+	.word	0x1cc00001
+	.word	0x9cd00000
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00007
+	.word	0x8cd00002
+	.word	0xc01000c
+	.word	0x1dd10003
+	.word	0xd01000d
+	.word	0x2dcb000d
+	.word	0xb0d00006
+	.word	0x8de00007
+	.word	0x1dd10006
+	.word	0x8cd00000
+	.word	0x1cc00003
+	.word	0x9cd00000
+	.word	0x40000d1a
+	.word	0x8de00009
+	.word	0x1cd10003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8ce00007
+	.word	0x8cc00002
+	.word	0xc01000c
+	.word	0xd01000d
+	.word	0xdc3000d
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x9de00002
+	.word	0x600006f5
+	.word	0x8de00007
+	.word	0x1dd10002
+	.word	0x8cd00000
+	.word	0x1cc10003
+	.word	0x9cd00000
+	.word	0x87e00009
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce00008
+	.word	0x9cd00000
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x90d00000
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x94e00001
+	.word	0x95e00002
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de00008
+	.word	0x8cd00002
+	.word	0xc01000c
+	.word	0x1dd10003
+	.word	0xd01000d
+	.word	0x2dcb000d
+	.word	0xb0d00001
+	.word	0x40000d4e
+	.word	0x87e00009
+	.word	0x40000d33
+	.word	0x7010006
+	.word	0x97e00000
+	.word	0x60000f99
+	.word	0xd010001
+	.word	0x601000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dffff8
+	.word	0x8d700000
+	.word	0x3dda0007
+	.word	0xb0d00006
+	.word	0xd010007
+	.word	0x8ce0000a
+	.word	0xc01000c
+	.word	0xdd3000c
+	.word	0x401000d
+	.word	0x40000d48
+	.word	0x8de0000a
+	.word	0xd01000d
+	.word	0xc010007
+	.word	0xdd3000c
+	.word	0x401000d
+	.word	0x5010004
+	.word	0x1d5e0008
+	.word	0x1ddb007f
+	.word	0x9d700001
+	.word	0x1d5b00ff
+	.word	0x9d700002
+	.word	0x84e00001
+	.word	0x85e00002
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00006
+	.word	0x8cd00002
+	.word	0xc01000c
+	.word	0x1dd10003
+	.word	0xd01000d
+	.word	0x2dc9000d
+	.word	0xb0d00004
+	.word	0x8de00007
+	.word	0x8dd00000
+	.word	0x3dd80006
+	.word	0xb0d00001
+	.word	0x40000d6f
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x1dd10003
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x60000d20
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000e
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x86e0000f
+	.word	0xd010000
+	.word	0x9de00009
+	.word	0x8ce0000e
+	.word	0xc01000c
+	.word	0x2dc9000d
+	.word	0xb0d00004
+	.word	0xd010006
+	.word	0x8ce00009
+	.word	0x2ddb000c
+	.word	0xb0d00005
+	.word	0xcd001110
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000de8
+	.word	0x8de0000e
+	.word	0x8dd00018
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x3dd8007b
+	.word	0xb0d00005
+	.word	0xcd0010ff
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000de8
+	.word	0x8de0000e
+	.word	0x8dd00016
+	.word	0x9de00008
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d0000a
+	.word	0x96e00000
+	.word	0x8de00008
+	.word	0x9de00001
+	.word	0x600007b0
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000de8
+	.word	0x96e0000b
+	.word	0x8de0000e
+	.word	0x9de0000c
+	.word	0x8de0000e
+	.word	0x1dd1000a
+	.word	0x9de0000d
+	.word	0x8de0000e
+	.word	0x8dd00015
+	.word	0x2dd80000
+	.word	0xb0d00009
+	.word	0x1de1000a
+	.word	0x9de00000
+	.word	0x8de0000e
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000def
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x40000de8
+	.word	0x8de0000e
+	.word	0x8dd00014
+	.word	0x2dd80000
+	.word	0xb0d0001a
+	.word	0x7010006
+	.word	0x40000dd1
+	.word	0x1de1000a
+	.word	0x9de00000
+	.word	0x8de0000e
+	.word	0x9de00001
+	.word	0x97e00002
+	.word	0x60000def
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000de8
+	.word	0x1d710001
+	.word	0x9de00000
+	.word	0x8de0000e
+	.word	0x8dd00014
+	.word	0x9de00001
+	.word	0x6000055e
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0dfffea
+	.word	0x1010000
+	.word	0x40000de8
+	.word	0x7010006
+	.word	0x40000dde
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000de8
+	.word	0x17710001
+	.word	0x1de1000a
+	.word	0x9de00000
+	.word	0x8de0000e
+	.word	0x9de00001
+	.word	0x97e00002
+	.word	0x60000def
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0dffff1
+	.word	0x11010001
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee1000e
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x95e00002
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de00008
+	.word	0x8ce0000a
+	.word	0x9cd00000
+	.word	0x8de00009
+	.word	0x601000d
+	.word	0x1c01000a
+	.word	0x15d1000a
+	.word	0x701000c
+	.word	0xd010006
+	.word	0x16d10001
+	.word	0x90d00000
+	.word	0xd010005
+	.word	0x15d10001
+	.word	0x90d00000
+	.word	0x17720001
+	.word	0x2d720000
+	.word	0xb0dffff7
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x8de00009
+	.word	0x1dd10019
+	.word	0x9de00001
+	.word	0x60000e22
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00009
+	.word	0x8de00009
+	.word	0x8ce0000a
+	.word	0x9cd00000
+	.word	0x8de00009
+	.word	0x8ce00008
+	.word	0x8cc00000
+	.word	0x9cd0000a
+	.word	0x11010001
+	.word	0x40000e1a
+	.word	0x1010000
+	.word	0x85e00002
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30011
+	.word	0x92e00002
+	.word	0x93e00003
+	.word	0x94e00004
+	.word	0x95e00005
+	.word	0x96e00006
+	.word	0x97e00007
+	.word	0x9be00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x87e00012
+	.word	0x40000f3e
+	.word	0x97e00000
+	.word	0x60000f99
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x85700000
+	.word	0x2d500000
+	.word	0xb0d00102
+	.word	0x3d520027
+	.word	0xb0d00100
+	.word	0x8d501086
+	.word	0x50d00000
+	.word	0x8de00011
+	.word	0x8cd00000
+	.word	0xc01000c
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dc9000d
+	.word	0xb0d000fc
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d000f5
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x40000f3d
+	.word	0x14710003
+	.word	0x8d400000
+	.word	0x8ce00011
+	.word	0x8cc00000
+	.word	0x8cc00000
+	.word	0x2dd8000c
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x94e00001
+	.word	0x600007b0
+	.word	0xd010001
+	.word	0x9de0000f
+	.word	0x8de0000f
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x94e00000
+	.word	0x600007d2
+	.word	0xd010001
+	.word	0x9de00010
+	.word	0x8de00011
+	.word	0x8ce00010
+	.word	0x8bd00000
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x40000f3d
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x9de00010
+	.word	0x2dd80000
+	.word	0xb0d00009
+	.word	0x1d710003
+	.word	0x9de00000
+	.word	0x8de00010
+	.word	0x9de00001
+	.word	0x6000055e
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x40000f3d
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x9de0000f
+	.word	0x2dd80000
+	.word	0xb0d00009
+	.word	0x1d710003
+	.word	0x9de00000
+	.word	0x8de0000f
+	.word	0x9de00001
+	.word	0x6000055e
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x8cd00000
+	.word	0x1cc10001
+	.word	0x9cd00000
+	.word	0x40000f3d
+	.word	0x8d700000
+	.word	0x1dd20014
+	.word	0x9de0000e
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x9de0000d
+	.word	0x8de00011
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000e22
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00010
+	.word	0x8de0000e
+	.word	0x8ce00011
+	.word	0x8cc00002
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00006
+	.word	0x8de0000e
+	.word	0x8ce00011
+	.word	0x8cc00002
+	.word	0xdd1000c
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x11010001
+	.word	0x40000f45
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8d700000
+	.word	0x1dd2001e
+	.word	0x9de0000e
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x9de0000d
+	.word	0x8de00011
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000e22
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00010
+	.word	0x8de0000e
+	.word	0x8ce00011
+	.word	0x8cc00003
+	.word	0xdd1000c
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00006
+	.word	0x8de0000e
+	.word	0x8ce00011
+	.word	0x8cc00003
+	.word	0xdd1000c
+	.word	0x8ce0000d
+	.word	0x9cd00000
+	.word	0x11010001
+	.word	0x40000f45
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x84d00000
+	.word	0x8d600000
+	.word	0x3dd80006
+	.word	0xb0d00012
+	.word	0x16710003
+	.word	0x40000f3d
+	.word	0x8de00011
+	.word	0x9de00000
+	.word	0x1d710003
+	.word	0x9de00001
+	.word	0x60000e22
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000f45
+	.word	0x8de00011
+	.word	0x94d00000
+	.word	0x97e00000
+	.word	0x60000f99
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700000
+	.word	0x3dd80006
+	.word	0xb0dfffed
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x8d600000
+	.word	0x3dda0008
+	.word	0xb0d00003
+	.word	0x8d600003
+	.word	0x9de0000d
+	.word	0x40000f03
+	.word	0x90e0000d
+	.word	0x83e0000d
+	.word	0x8de00011
+	.word	0x82d00000
+	.word	0x8d700000
+	.word	0x3dda000a
+	.word	0xb0d00002
+	.word	0x90e0000c
+	.word	0x40000f0d
+	.word	0x1d010001
+	.word	0x9de0000c
+	.word	0x8de0000c
+	.word	0xd01000d
+	.word	0x9de0000e
+	.word	0x8de00011
+	.word	0x9de00000
+	.word	0x1d710003
+	.word	0x9de00001
+	.word	0x60000f51
+	.word	0xd010001
+	.word	0x1c010001
+	.word	0x4d1000c
+	.word	0x40000f31
+	.word	0x8de00011
+	.word	0xc410002
+	.word	0x3b0effff
+	.word	0x1bbdffff
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x2d380000
+	.word	0xb0d00005
+	.word	0x8de00011
+	.word	0x8dd00000
+	.word	0x8dd00000
+	.word	0x2dda0003
+	.word	0xb0d00009
+	.word	0x8de00011
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000e22
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000f45
+	.word	0x1d010001
+	.word	0x443000d
+	.word	0x8de0000e
+	.word	0x2d43000d
+	.word	0xb0dfffe5
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x11010001
+	.word	0x40000f45
+	.word	0xcd0010ed
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x40000f45
+	.word	0x7010006
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0dffeee
+	.word	0xcd0010da
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x82e00002
+	.word	0x83e00003
+	.word	0x84e00004
+	.word	0x85e00005
+	.word	0x86e00006
+	.word	0x87e00007
+	.word	0x8be00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee10011
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de0000a
+	.word	0x87d00000
+	.word	0x3d700003
+	.word	0xb0d00035
+	.word	0x3d720008
+	.word	0xb0d00033
+	.word	0x8d8010ab
+	.word	0x50d00000
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x600007d2
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x40000f93
+	.word	0x8de0000a
+	.word	0x8dd00003
+	.word	0x9de00006
+	.word	0x90e00007
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x9de00008
+	.word	0x40000f74
+	.word	0x8de00007
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8de00008
+	.word	0x1dd10001
+	.word	0x9de00008
+	.word	0x8de00008
+	.word	0x8dd00000
+	.word	0x8ce00006
+	.word	0x2dd8000c
+	.word	0xb0dffff4
+	.word	0x81e00007
+	.word	0x40000f93
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x1dd10003
+	.word	0x9de00001
+	.word	0x6000080e
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x40000f93
+	.word	0x8de00009
+	.word	0x8dd00000
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x1dd10003
+	.word	0x9de00001
+	.word	0x60000764
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x40000f93
+	.word	0xcd0010b4
+	.word	0x9de00000
+	.word	0x60000fb9
+	.word	0x1010000
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x96e00000
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00004
+	.word	0x8cd00001
+	.word	0x1ccb007f
+	.word	0x1cca0008
+	.word	0x8dd00002
+	.word	0x1ddb00ff
+	.word	0x7c0000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000fb3
+	.word	0x8de00004
+	.word	0x8dd00000
+	.word	0x3dda0007
+	.word	0xb0d00003
+	.word	0x8de00004
+	.word	0x6d30007
+	.word	0x40000fb2
+	.word	0x8de00004
+	.word	0x671000d
+	.word	0x1010006
+	.word	0x86e00000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d000fda
+	.word	0x9de00000
+	.word	0xcd00124b
+	.word	0x9de00001
+	.word	0x8de00005
+	.word	0x9de00002
+	.word	0x60000fdf
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600007ea
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x27a
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x600007ea
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x55
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x67
+	.word	0x72
+	.word	0x65
+	.word	0x70
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x76
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x6e
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x73
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x65
+	.word	0x20
+	.word	0x65
+	.word	0x78
+	.word	0x70
+	.word	0x72
+	.word	0x5d
+	.word	0x20
+	.word	0x65
+	.word	0x78
+	.word	0x70
+	.word	0x72
+	.word	0x65
+	.word	0x73
+	.word	0x73
+	.word	0x69
+	.word	0x6f
+	.word	0x6e
+	.word	0x20
+	.word	0x5b
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x20
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x64
+	.word	0x3a
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x0
+	.word	0x73
+	.word	0x74
+	.word	0x64
+	.word	0x69
+	.word	0x6e
+	.word	0x0
+	.word	0x4c
+	.word	0x69
+	.word	0x6e
+	.word	0x65
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x6f
+	.word	0x20
+	.word	0x6c
+	.word	0x6f
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x43
+	.word	0x61
+	.word	0x6e
+	.word	0x27
+	.word	0x74
+	.word	0x20
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x6e
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x2d
+	.word	0x0
+	.word	0x67
+	.word	0x72
+	.word	0x65
+	.word	0x70
+	.word	0x3a
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x63
+	.word	0x6f
+	.word	0x6d
+	.word	0x70
+	.word	0x20
+	.word	0x66
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0xb79
+	.word	0xc45
+	.word	0xc45
+	.word	0xc45
+	.word	0xc03
+	.word	0xc19
+	.word	0xc1e
+	.word	0xc1e
+	.word	0xc45
+	.word	0xc45
+	.word	0xb81
+	.word	0xf36
+	.word	0xe3a
+	.word	0xe43
+	.word	0xe4a
+	.word	0xe76
+	.word	0xe8c
+	.word	0xee0
+	.word	0xf3d
+	.word	0xe56
+	.word	0xf3d
+	.word	0xefc
+	.word	0xefc
+	.word	0xf38
+	.word	0xf38
+	.word	0xf38
+	.word	0xf38
+	.word	0xf38
+	.word	0xf38
+	.word	0xf38
+	.word	0xf38
+	.word	0xf38
+	.word	0xea2
+	.word	0xea2
+	.word	0xea2
+	.word	0xea2
+	.word	0xea2
+	.word	0xea2
+	.word	0xea2
+	.word	0xea2
+	.word	0xea2
+	.word	0xf38
+	.word	0xec1
+	.word	0xec1
+	.word	0xec1
+	.word	0xec1
+	.word	0xec1
+	.word	0xec1
+	.word	0xec1
+	.word	0xec1
+	.word	0xec1
+	.word	0xf5e
+	.word	0xf7b
+	.word	0xf85
+	.word	0xf8f
+	.word	0xf8f
+	.word	0xf65
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x20
+	.word	0x65
+	.word	0x72
+	.word	0x72
+	.word	0x6f
+	.word	0x72
+	.word	0x3a
+	.word	0x20
+	.word	0x62
+	.word	0x61
+	.word	0x64
+	.word	0x20
+	.word	0x63
+	.word	0x61
+	.word	0x6c
+	.word	0x6c
+	.word	0x20
+	.word	0x6f
+	.word	0x66
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x72
+	.word	0x65
+	.word	0x70
+	.word	0x65
+	.word	0x61
+	.word	0x74
+	.word	0x0
+	.word	0x63
+	.word	0x6f
+	.word	0x72
+	.word	0x72
+	.word	0x75
+	.word	0x70
+	.word	0x74
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x70
+	.word	0x6f
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x73
+	.word	0x0
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x65
+	.word	0x78
+	.word	0x70
+	.word	0x20
+	.word	0x63
+	.word	0x6f
+	.word	0x72
+	.word	0x72
+	.word	0x75
+	.word	0x70
+	.word	0x74
+	.word	0x69
+	.word	0x6f
+	.word	0x6e
+	.word	0x0
+	.word	0x63
+	.word	0x6f
+	.word	0x72
+	.word	0x72
+	.word	0x75
+	.word	0x70
+	.word	0x74
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x65
+	.word	0x78
+	.word	0x70
+	.word	0x0
+	.word	0x4e
+	.word	0x55
+	.word	0x4c
+	.word	0x4c
+	.word	0x20
+	.word	0x61
+	.word	0x72
+	.word	0x67
+	.word	0x75
+	.word	0x6d
+	.word	0x65
+	.word	0x6e
+	.word	0x74
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x65
+	.word	0x78
+	.word	0x65
+	.word	0x63
+	.word	0x0
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x20
+	.word	0x65
+	.word	0x72
+	.word	0x72
+	.word	0x6f
+	.word	0x72
+	.word	0x3a
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x72
+	.word	0x63
+	.word	0x73
+	.word	0x70
+	.word	0x6e
+	.word	0x20
+	.word	0x30
+	.word	0x0
+	.word	0x5e
+	.word	0x24
+	.word	0x2e
+	.word	0x5b
+	.word	0x28
+	.word	0x29
+	.word	0x7c
+	.word	0x3f
+	.word	0x2b
+	.word	0x2a
+	.word	0x5c
+	.word	0x0
+	.word	0x74
+	.word	0x72
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x5c
+	.word	0x0
+	.word	0x3f
+	.word	0x2b
+	.word	0x2a
+	.word	0x20
+	.word	0x66
+	.word	0x6f
+	.word	0x6c
+	.word	0x6c
+	.word	0x6f
+	.word	0x77
+	.word	0x73
+	.word	0x20
+	.word	0x6e
+	.word	0x6f
+	.word	0x74
+	.word	0x68
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x0
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x20
+	.word	0x65
+	.word	0x72
+	.word	0x72
+	.word	0x6f
+	.word	0x72
+	.word	0x3a
+	.word	0x20
+	.word	0x5c
+	.word	0x30
+	.word	0x7c
+	.word	0x29
+	.word	0x20
+	.word	0x75
+	.word	0x6e
+	.word	0x65
+	.word	0x78
+	.word	0x70
+	.word	0x65
+	.word	0x63
+	.word	0x74
+	.word	0x65
+	.word	0x64
+	.word	0x0
+	.word	0x75
+	.word	0x6e
+	.word	0x6d
+	.word	0x61
+	.word	0x74
+	.word	0x63
+	.word	0x68
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x5b
+	.word	0x5d
+	.word	0x0
+	.word	0x69
+	.word	0x6e
+	.word	0x76
+	.word	0x61
+	.word	0x6c
+	.word	0x69
+	.word	0x64
+	.word	0x20
+	.word	0x5b
+	.word	0x5d
+	.word	0x20
+	.word	0x72
+	.word	0x61
+	.word	0x6e
+	.word	0x67
+	.word	0x65
+	.word	0x0
+	.word	0x6e
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x2a
+	.word	0x3f
+	.word	0x2b
+	.word	0x0
+	.word	0x2a
+	.word	0x2b
+	.word	0x20
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x72
+	.word	0x61
+	.word	0x6e
+	.word	0x64
+	.word	0x20
+	.word	0x63
+	.word	0x6f
+	.word	0x75
+	.word	0x6c
+	.word	0x64
+	.word	0x20
+	.word	0x62
+	.word	0x65
+	.word	0x20
+	.word	0x65
+	.word	0x6d
+	.word	0x70
+	.word	0x74
+	.word	0x79
+	.word	0x0
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x6e
+	.word	0x61
+	.word	0x6c
+	.word	0x20
+	.word	0x65
+	.word	0x72
+	.word	0x72
+	.word	0x6f
+	.word	0x72
+	.word	0x3a
+	.word	0x20
+	.word	0x6a
+	.word	0x75
+	.word	0x6e
+	.word	0x6b
+	.word	0x20
+	.word	0x6f
+	.word	0x6e
+	.word	0x20
+	.word	0x65
+	.word	0x6e
+	.word	0x64
+	.word	0x0
+	.word	0x75
+	.word	0x6e
+	.word	0x6d
+	.word	0x61
+	.word	0x74
+	.word	0x63
+	.word	0x68
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x28
+	.word	0x29
+	.word	0x0
+	.word	0x75
+	.word	0x6e
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x6d
+	.word	0x69
+	.word	0x6e
+	.word	0x61
+	.word	0x74
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x28
+	.word	0x29
+	.word	0x0
+	.word	0x74
+	.word	0x6f
+	.word	0x6f
+	.word	0x20
+	.word	0x6d
+	.word	0x61
+	.word	0x6e
+	.word	0x79
+	.word	0x20
+	.word	0x28
+	.word	0x29
+	.word	0x0
+	.word	0x6f
+	.word	0x75
+	.word	0x74
+	.word	0x20
+	.word	0x6f
+	.word	0x66
+	.word	0x20
+	.word	0x73
+	.word	0x70
+	.word	0x61
+	.word	0x63
+	.word	0x65
+	.word	0x0
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x65
+	.word	0x78
+	.word	0x70
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x6f
+	.word	0x20
+	.word	0x62
+	.word	0x69
+	.word	0x67
+	.word	0x0
+	.word	0x4e
+	.word	0x55
+	.word	0x4c
+	.word	0x4c
+	.word	0x20
+	.word	0x61
+	.word	0x72
+	.word	0x67
+	.word	0x75
+	.word	0x6d
+	.word	0x65
+	.word	0x6e
+	.word	0x74
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x63
+	.word	0x6f
+	.word	0x6d
+	.word	0x70
+	.word	0x0
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x65
+	.word	0x78
+	.word	0x70
+	.word	0x28
+	.word	0x33
+	.word	0x29
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x800000a0
+	.word	0x81
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x38c
+	.word	0x274
+	.word	0x118
+	.word	0x40
+	.word	0x1ee3001e
+	.word	0x94e00008
+	.word	0x95e00009
+	.word	0x96e0000a
+	.word	0x97e0000b
+	.word	0x9ce0000c
+	.word	0x9de0000d
+	.word	0x9fe0000e
+	.word	0x8de0001f
+	.word	0x86d00001
+	.word	0x8de0001e
+	.word	0x3dd80002
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x4000043d
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de10011
+	.word	0x9de00002
+	.word	0x6000049b
+	.word	0xd010001
+	.word	0x9de00010
+	.word	0x8de00010
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0xcd0004d6
+	.word	0x9de00000
+	.word	0x60000446
+	.word	0x11010001
+	.word	0x4000043d
+	.word	0x8de00018
+	.word	0x501000d
+	.word	0x1d010400
+	.word	0xc56000d
+	.word	0x9ce0000f
+	.word	0x758000d
+	.word	0x3d7003e8
+	.word	0xb0d00002
+	.word	0x140103e7
+	.word	0x4000042a
+	.word	0x4010007
+	.word	0x7010004
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00049d
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x8de00012
+	.word	0x9de00003
+	.word	0x8de0000f
+	.word	0x9de00004
+	.word	0x97e00005
+	.word	0x8de0001a
+	.word	0x9de00006
+	.word	0x8de00013
+	.word	0x1c0101ff
+	.word	0xddb000c
+	.word	0x9de00007
+	.word	0x60000489
+	.word	0x1010000
+	.word	0x84e00008
+	.word	0x85e00009
+	.word	0x86e0000a
+	.word	0x87e0000b
+	.word	0x8ce0000c
+	.word	0x8de0000d
+	.word	0x8fe0000e
+	.word	0x1ee1001e
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000475
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000464
+	.word	0xd010001
+	.word	0x8c000484
+	.word	0x9ce00000
+	.word	0xcc0004db
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000489
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0004e3
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x6000049b
+	.word	0xc10004e3
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x59
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x6000049b
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x46
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x4e
+	.word	0x75
+	.word	0x6d
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x53
+	.word	0x69
+	.word	0x7a
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x2e
+	.word	0x25
+	.word	0x2e
+	.word	0x33
+	.word	0x64
+	.word	0x4b
+	.word	0x42
+	.word	0xa
+	.word	0x42
+	.word	0x6c
+	.word	0x6f
+	.word	0x63
+	.word	0x6b
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x41
+	.word	0x63
+	.word	0x63
+	.word	0x65
+	.word	0x73
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x30
+	.word	0x25
+	.word	0x6f
+	.word	0xa
+	.word	0x0
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x74
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80000017
+	.word	0x5b
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x1e8
+	.word	0x1dc
+	.word	0xc
+	.word	0x800
+	.word	0x1ee3000b
+	.word	0x94e00003
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x14010001
+	.word	0x8de0000b
+	.word	0x3dd60002
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000448
+	.word	0xc500047a
+	.word	0x40000436
+	.word	0x8de0000c
+	.word	0xd41000d
+	.word	0x86d00000
+	.word	0x3d440001
+	.word	0xb0d0001c
+	.word	0xd010005
+	.word	0x15d10001
+	.word	0x1c010020
+	.word	0x9cd00000
+	.word	0x40000431
+	.word	0x87600000
+	.word	0x3d7a005c
+	.word	0xb0d00010
+	.word	0x1d610001
+	.word	0x601000d
+	.word	0x87d00000
+	.word	0x1d01006e
+	.word	0x9de0000a
+	.word	0x2d78000d
+	.word	0xb0d00006
+	.word	0x8de0000a
+	.word	0x2d70000d
+	.word	0xb0d00006
+	.word	0x3d780074
+	.word	0xb0d00003
+	.word	0x4000042d
+	.word	0x1701000a
+	.word	0x4000042d
+	.word	0x17010009
+	.word	0xd010005
+	.word	0x15d10001
+	.word	0x97d00000
+	.word	0x16610001
+	.word	0x8d600000
+	.word	0x2dda0000
+	.word	0xb0dfffe6
+	.word	0x90500000
+	.word	0x14400001
+	.word	0x8de0000b
+	.word	0x2d40000d
+	.word	0xb0dfffd7
+	.word	0xd010005
+	.word	0x15d10001
+	.word	0x1c01000a
+	.word	0x9cd00000
+	.word	0xd010005
+	.word	0x15d10001
+	.word	0x90d00000
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000477
+	.word	0x9de00001
+	.word	0xcd00047a
+	.word	0x9de00002
+	.word	0x60000463
+	.word	0x1010000
+	.word	0x84e00003
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x16
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000475
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x25
+	.word	0x73
+	.word	0x80000080
+	.word	0x9a
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x364
+	.word	0x2d0
+	.word	0x94
+	.word	0x40
+	.word	0x1ee30217
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de00218
+	.word	0x8dd00001
+	.word	0x9de00016
+	.word	0x8de00217
+	.word	0x3dd60002
+	.word	0xb0d00002
+	.word	0x6010000
+	.word	0x40000444
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x8de00016
+	.word	0x9de00001
+	.word	0x1de10009
+	.word	0x9de00002
+	.word	0x6000048e
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00005
+	.word	0xcd0004cc
+	.word	0x9de00000
+	.word	0x6000045f
+	.word	0x11010001
+	.word	0x40000456
+	.word	0x8de0000b
+	.word	0x1c01f000
+	.word	0xddb000c
+	.word	0x1c014000
+	.word	0x2ddb000c
+	.word	0xb0d00009
+	.word	0x8d00049d
+	.word	0x9de00000
+	.word	0xcd0004b9
+	.word	0x9de00001
+	.word	0x8de00016
+	.word	0x9de00002
+	.word	0x600004a2
+	.word	0x11010001
+	.word	0x40000456
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x8de00016
+	.word	0x9de00002
+	.word	0x6000048e
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d660000
+	.word	0xb0d0000d
+	.word	0xcd0004cc
+	.word	0x9de00000
+	.word	0x6000045f
+	.word	0x11010001
+	.word	0x40000456
+	.word	0x1d010018
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x1de10017
+	.word	0x9de00002
+	.word	0x97e00003
+	.word	0x6000048e
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de10017
+	.word	0x9de00002
+	.word	0x1d010200
+	.word	0x9de00003
+	.word	0x6000048e
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2dd20000
+	.word	0xb0dfffec
+	.word	0x2d760000
+	.word	0xb0d00003
+	.word	0xcd0004b4
+	.word	0x9de00000
+	.word	0x6000045f
+	.word	0x1010000
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10217
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x6000045d
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x6000047d
+	.word	0xd010001
+	.word	0x8c00049d
+	.word	0x9ce00000
+	.word	0xcc0004d1
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x600004a2
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0004d9
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x6000048e
+	.word	0xc10004d9
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x36
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x6000048e
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x72
+	.word	0x65
+	.word	0x61
+	.word	0x64
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x69
+	.word	0x73
+	.word	0x20
+	.word	0x61
+	.word	0x20
+	.word	0x64
+	.word	0x69
+	.word	0x72
+	.word	0x65
+	.word	0x63
+	.word	0x74
+	.word	0x6f
+	.word	0x72
+	.word	0x79
+	.word	0xa
+	.word	0x0
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x6e
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80000021
+	.word	0x5
+	.word	0x17
+	.word	0x0
+	.word	0x70
+	.word	0x77
+	.word	0x64
+	.word	0x8000001a
+	.word	0x5
+	.word	0x101
+	.word	0x18
+	.word	0x0
+	.word	0x64
+	.word	0x66
+	.word	0x8000001b
+	.word	0x5
+	.word	0x101
+	.word	0x19
+	.word	0x0
+	.word	0x64
+	.word	0x75
+	.word	0x8000001b
+	.word	0x5
+	.word	0x101
+	.word	0x1a
+	.word	0x0
+	.word	0x6c
+	.word	0x6e
+	.word	0x8000001b
+	.word	0x8
+	.word	0x101
+	.word	0x1b
+	.word	0x0
+	.word	0x73
+	.word	0x6e
+	.word	0x61
+	.word	0x6b
+	.word	0x65
+	.word	0x80000018
+	.word	0x7
+	.word	0x101
+	.word	0x1d
+	.word	0x0
+	.word	0x69
+	.word	0x6e
+	.word	0x69
+	.word	0x74
+	.word	0x80000019
+	.word	0x5
+	.word	0x101
+	.word	0x1e
+	.word	0x0
+	.word	0x63
+	.word	0x70
+	.word	0x8000001b
+	.word	0x5
+	.word	0x101
+	.word	0x1f
+	.word	0x0
+	.word	0x72
+	.word	0x6d
+	.word	0x8000001b
+	.word	0x2b
+	.word	0x101
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x120
+	.word	0x110
+	.word	0x10
+	.word	0x0
+	.word	0x1ee30086
+	.word	0x97e00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d010034
+	.word	0x9de00000
+	.word	0x1d010080
+	.word	0x9de00001
+	.word	0x1de10006
+	.word	0x9de00002
+	.word	0x6000041e
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000419
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000444
+	.word	0x9de00001
+	.word	0x97e00002
+	.word	0x60000432
+	.word	0x1010000
+	.word	0x87e00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10086
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x15
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x6000041e
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x800000b2
+	.word	0x2f
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x2a0
+	.word	0x124
+	.word	0x17c
+	.word	0x0
+	.word	0x1ee30011
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x1d010033
+	.word	0x9de00000
+	.word	0xcd0004a6
+	.word	0x9de00001
+	.word	0x1de10009
+	.word	0x9de00002
+	.word	0x60000423
+	.word	0xd010001
+	.word	0x9de00008
+	.word	0x8de00008
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x81e00008
+	.word	0x4000041f
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000449
+	.word	0x9de00001
+	.word	0x8de0000b
+	.word	0x9de00002
+	.word	0x8de0000c
+	.word	0x9de00003
+	.word	0x8de0000e
+	.word	0x9de00004
+	.word	0x8de0000f
+	.word	0x9de00005
+	.word	0x60000437
+	.word	0x1010000
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10011
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x70
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000423
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0xa
+	.word	0x46
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x53
+	.word	0x79
+	.word	0x73
+	.word	0x74
+	.word	0x65
+	.word	0x6d
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x74
+	.word	0x75
+	.word	0x73
+	.word	0x3a
+	.word	0xa
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x62
+	.word	0x6c
+	.word	0x6f
+	.word	0x63
+	.word	0x6b
+	.word	0x73
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x74
+	.word	0x61
+	.word	0x6c
+	.word	0x2c
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x62
+	.word	0x6c
+	.word	0x6f
+	.word	0x63
+	.word	0x6b
+	.word	0x73
+	.word	0x20
+	.word	0x66
+	.word	0x72
+	.word	0x65
+	.word	0x65
+	.word	0xa
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x6f
+	.word	0x64
+	.word	0x65
+	.word	0x73
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x74
+	.word	0x61
+	.word	0x6c
+	.word	0x2c
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x69
+	.word	0x6e
+	.word	0x6f
+	.word	0x64
+	.word	0x65
+	.word	0x73
+	.word	0x20
+	.word	0x66
+	.word	0x72
+	.word	0x65
+	.word	0x65
+	.word	0x2e
+	.word	0x20
+	.word	0xa
+	.word	0x0
+	.word	0x2f
+	.word	0x80000052
+	.word	0x1f9
+	.word	0x19960503
+	.word	0x59b
+	.word	0x1000
+	.word	0x12d4
+	.word	0x1238
+	.word	0x9c
+	.word	0x44
+	.word	0x2f
+	.word	0x0
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x600005c8
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0xcd000400
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x60000852
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x40000428
+	.word	0x8de00003
+	.word	0x8ce00004
+	.word	0xdd6000c
+	.word	0x17d8000a
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x1c700030
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x1dd6000a
+	.word	0x9de00004
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0dffff1
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x9be00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00009
+	.word	0x1c011000
+	.word	0xbd6000c
+	.word	0x9be00008
+	.word	0xdd8000c
+	.word	0x9de00007
+	.word	0x8de00008
+	.word	0x9de00000
+	.word	0x1d01000a
+	.word	0x9de00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x60000417
+	.word	0x8de0000a
+	.word	0x8dd00000
+	.word	0x3dda0030
+	.word	0xb0d00003
+	.word	0x8de0000a
+	.word	0x1c010020
+	.word	0x9cd00000
+	.word	0x8de0000a
+	.word	0x1dd10002
+	.word	0x9de0000a
+	.word	0x8de0000a
+	.word	0x1cd10001
+	.word	0x9ce0000a
+	.word	0x1c01002e
+	.word	0x9cd00000
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x1d01000a
+	.word	0x9de00001
+	.word	0x8de0000a
+	.word	0x9de00002
+	.word	0x60000417
+	.word	0x8de0000a
+	.word	0x1dd10002
+	.word	0x9de0000a
+	.word	0x8de0000a
+	.word	0x90d00000
+	.word	0x8be00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30018
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9be00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x5010000
+	.word	0x8d0008b5
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400004c2
+	.word	0x8d0008b5
+	.word	0x8dd00a84
+	.word	0x9de0000a
+	.word	0x2dd80000
+	.word	0xb0d00042
+	.word	0x1d010040
+	.word	0x9de00000
+	.word	0x8de0000a
+	.word	0x9de00001
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x2dd60000
+	.word	0xb0d0003a
+	.word	0xcd0008a1
+	.word	0x9de00000
+	.word	0x6000068e
+	.word	0x8d0008b5
+	.word	0x8cd00000
+	.word	0x9cd00001
+	.word	0x6010000
+	.word	0x40000497
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x1d6a0006
+	.word	0x8c0008b5
+	.word	0x1cc100e4
+	.word	0xdd1000c
+	.word	0x9de00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x8de00012
+	.word	0x551000d
+	.word	0x16600001
+	.word	0x8d0008b5
+	.word	0x8dd00a84
+	.word	0x2d60000d
+	.word	0xb0dfffec
+	.word	0x8d0008b5
+	.word	0x9de00000
+	.word	0x600007cf
+	.word	0x900008b5
+	.word	0x1010005
+	.word	0x400004c2
+	.word	0x8d0008b5
+	.word	0x8cd00002
+	.word	0x1b01001f
+	.word	0xccb000b
+	.word	0x1cca0001
+	.word	0x1dd100a4
+	.word	0x7c1000d
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0d00008
+	.word	0x1d01000d
+	.word	0x8c700001
+	.word	0xdd4000c
+	.word	0x8c0008b5
+	.word	0x1cc108e4
+	.word	0xdd1000c
+	.word	0x8dd00007
+	.word	0x551000d
+	.word	0x8d0008b5
+	.word	0x1dd10002
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8d0008b5
+	.word	0x8cd00003
+	.word	0x8dd00002
+	.word	0xdc3000d
+	.word	0x2ddb0000
+	.word	0xb0dfffe2
+	.word	0x8d0008b5
+	.word	0x90d00a84
+	.word	0x1010005
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8be00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee10018
+	.word	0x50f00000
+	.word	0x1ee30019
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9ae00006
+	.word	0x9be00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x5010000
+	.word	0x8d0008b5
+	.word	0x9de0000b
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d0000c
+	.word	0x1d010020
+	.word	0x8ce0000b
+	.word	0x8cc00001
+	.word	0x8be0000b
+	.word	0x8bb00000
+	.word	0xcc3000b
+	.word	0xdd3000c
+	.word	0x2ddb0000
+	.word	0xb0d00003
+	.word	0x60000463
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x8d0008b5
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x8de00019
+	.word	0x9de00001
+	.word	0x1de1000c
+	.word	0x9de00002
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x8de00013
+	.word	0x551000d
+	.word	0x1010005
+	.word	0x40000528
+	.word	0x8d0008b5
+	.word	0x1dd10a84
+	.word	0x8cd00000
+	.word	0x1bc00001
+	.word	0x9bd00000
+	.word	0x601000c
+	.word	0x1d6a0006
+	.word	0x8c0008b5
+	.word	0x1cc100e4
+	.word	0xdd1000c
+	.word	0x9de00000
+	.word	0x8de00019
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x600005c8
+	.word	0x8d0008b5
+	.word	0x1c010005
+	.word	0x8bd00001
+	.word	0x1a01001f
+	.word	0xbbb000a
+	.word	0xcc5000b
+	.word	0x1dd10004
+	.word	0x7c1000d
+	.word	0x1d010020
+	.word	0x9d700000
+	.word	0x1d6a0006
+	.word	0x8c0008b5
+	.word	0x1cc100e4
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9d700001
+	.word	0x1d01000d
+	.word	0xdd40006
+	.word	0x8c0008b5
+	.word	0x1cc108e4
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9d700002
+	.word	0x90700003
+	.word	0x96700004
+	.word	0x8d0008b5
+	.word	0x1dd10001
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x1010005
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8ae00006
+	.word	0x8be00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee10019
+	.word	0x50f00000
+	.word	0x1ee30015
+	.word	0x94e00004
+	.word	0x95e00005
+	.word	0x96e00006
+	.word	0x97e00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x5010000
+	.word	0x8de00015
+	.word	0x9de00000
+	.word	0x60000613
+	.word	0xd010001
+	.word	0x401000d
+	.word	0xd010004
+	.word	0x2ddb0000
+	.word	0xb0d00009
+	.word	0x8d0005fc
+	.word	0x9de00000
+	.word	0xcd000899
+	.word	0x9de00001
+	.word	0x8de00015
+	.word	0x9de00002
+	.word	0x60000601
+	.word	0x1010000
+	.word	0x40000592
+	.word	0x1d010040
+	.word	0x9de00000
+	.word	0x6000071b
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x8de00015
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000402
+	.word	0x40000575
+	.word	0x8d700002
+	.word	0x1c01002e
+	.word	0x2ddb000c
+	.word	0xb0d00001
+	.word	0x40000575
+	.word	0x96e00000
+	.word	0x1d710002
+	.word	0x9de00001
+	.word	0x1d010040
+	.word	0x9de00002
+	.word	0x60000852
+	.word	0x8d700001
+	.word	0x1c010004
+	.word	0x2ddb000c
+	.word	0xb0d00008
+	.word	0x60000463
+	.word	0xd010001
+	.word	0x551000d
+	.word	0x96e00000
+	.word	0x60000532
+	.word	0xd010001
+	.word	0x551000d
+	.word	0x40000571
+	.word	0x96e00000
+	.word	0x600004cb
+	.word	0xd010001
+	.word	0x551000d
+	.word	0x8de00015
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000402
+	.word	0x94e00000
+	.word	0x60000639
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dfffda
+	.word	0x60000463
+	.word	0xd010001
+	.word	0x551000d
+	.word	0xd010005
+	.word	0x9de00000
+	.word	0x1de1000b
+	.word	0x9de00001
+	.word	0x60000430
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000890
+	.word	0x9de00001
+	.word	0x1de1000b
+	.word	0x9de00002
+	.word	0x8de00015
+	.word	0x9de00003
+	.word	0x60000601
+	.word	0x94e00000
+	.word	0x6000067b
+	.word	0x96e00000
+	.word	0x600007cf
+	.word	0x1010005
+	.word	0x84e00004
+	.word	0x85e00005
+	.word	0x86e00006
+	.word	0x87e00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee10015
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0xcd00088e
+	.word	0x9de00006
+	.word	0x8de00007
+	.word	0x3dd40001
+	.word	0xb0d00003
+	.word	0x8de00008
+	.word	0x8dd00001
+	.word	0x9de00006
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0x1d010a85
+	.word	0x9de00001
+	.word	0x6000081c
+	.word	0xd010001
+	.word	0x9d0008b5
+	.word	0x8d0008b5
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d0000c
+	.word	0x1d01003f
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x9de00001
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00004
+	.word	0x8d0008b5
+	.word	0x9de00000
+	.word	0x600007cf
+	.word	0x900008b5
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x60000532
+	.word	0x1010000
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0x9de00003
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x400005db
+	.word	0x8de00004
+	.word	0x1cd10001
+	.word	0x9ce00004
+	.word	0x8ce00005
+	.word	0x1bc10001
+	.word	0x9be00005
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00006
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00004
+	.word	0x90d00000
+	.word	0x81e00003
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x2b3
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d660000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000633
+	.word	0x1d01013a
+	.word	0x9de00000
+	.word	0x6000071b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000633
+	.word	0x96700000
+	.word	0x90700001
+	.word	0x90700002
+	.word	0x1010007
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de00009
+	.word	0x8dd00002
+	.word	0x2dd80000
+	.word	0xb0d00016
+	.word	0x8de00009
+	.word	0x8cd00001
+	.word	0x8dd00002
+	.word	0x2dc6000d
+	.word	0xb0d0000b
+	.word	0x8de00009
+	.word	0x1dd10001
+	.word	0x8cd00000
+	.word	0x1bc00001
+	.word	0x9bd00000
+	.word	0x1d01001f
+	.word	0xdd4000c
+	.word	0x8ce00009
+	.word	0x1cc10004
+	.word	0x1d1000c
+	.word	0x40000674
+	.word	0x8de00009
+	.word	0x8dd00002
+	.word	0x3dd6000a
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000674
+	.word	0x1d010026
+	.word	0x9de00000
+	.word	0x8de00009
+	.word	0x8cd00000
+	.word	0x9ce00001
+	.word	0x1dd10004
+	.word	0x9de00002
+	.word	0x1d01000a
+	.word	0x9de00003
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d720000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000674
+	.word	0x1d010001
+	.word	0x8ce00009
+	.word	0x9dc00001
+	.word	0x8de00009
+	.word	0xc010007
+	.word	0x1b01001f
+	.word	0xcc7000b
+	.word	0xc01000c
+	.word	0x9cd00002
+	.word	0x8de00009
+	.word	0x11d10004
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x9de00004
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x600007cf
+	.word	0x81e00004
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x600005ed
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000841
+	.word	0xd010001
+	.word	0x8c0005fc
+	.word	0x9ce00000
+	.word	0xcc0008ad
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000601
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x870006ac
+	.word	0x400006b6
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x60000803
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000803
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000715
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d0006ac
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d0006ac
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600006ad
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600006c6
+	.word	0x90700003
+	.word	0x4000075c
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600006ee
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x4000075d
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x600006ee
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x4000075d
+	.word	0x970006ac
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d0006ac
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c0006ac
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x60000803
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x60000798
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x400007c6
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x400007c9
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x600007a3
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000798
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x60000763
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x60000763
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d000802
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x40000810
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x81000802
+	.word	0x40000818
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x60000800
+	.word	0xd010001
+	.word	0x9d000802
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x95e00001
+	.word	0x96e00002
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00007
+	.word	0x8ce00008
+	.word	0xdd5000c
+	.word	0x9de00000
+	.word	0x6000071b
+	.word	0xd010001
+	.word	0x601000d
+	.word	0xd010006
+	.word	0x2dd90000
+	.word	0xb0d0000b
+	.word	0x8de00007
+	.word	0x8ce00008
+	.word	0x5d5000c
+	.word	0x7010000
+	.word	0x40000836
+	.word	0xd710006
+	.word	0x90d00000
+	.word	0x1d010001
+	.word	0x771000d
+	.word	0x2d710005
+	.word	0xb0dffffa
+	.word	0x1010006
+	.word	0x85e00001
+	.word	0x86e00002
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0008b6
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000800
+	.word	0xc10008b6
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffffa
+	.word	0x8de00005
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0xdd1000c
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xc010007
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x9de00004
+	.word	0x8de00007
+	.word	0x8ce00004
+	.word	0xdd3000c
+	.word	0x9de00007
+	.word	0x8de00007
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x1010007
+	.word	0x40000888
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8ce00006
+	.word	0x1bc10001
+	.word	0x9be00006
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00007
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00007
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00005
+	.word	0x90d00000
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x2e
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x4b
+	.word	0x42
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x65
+	.word	0x72
+	.word	0x72
+	.word	0x3a
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x75
+	.word	0x72
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x5f
+	.word	0x65
+	.word	0x6e
+	.word	0x74
+	.word	0x65
+	.word	0x72
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80000045
+	.word	0x44
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x2c8
+	.word	0x1f0
+	.word	0xd8
+	.word	0x40
+	.word	0x1ee30007
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00007
+	.word	0x3dd60003
+	.word	0xb0d00007
+	.word	0x8d000447
+	.word	0x9de00000
+	.word	0xcd00047d
+	.word	0x9de00001
+	.word	0x6000044c
+	.word	0x11010001
+	.word	0x4000041f
+	.word	0x1d010024
+	.word	0x9de00000
+	.word	0x8de00008
+	.word	0x8cd00001
+	.word	0x9ce00001
+	.word	0x8dd00002
+	.word	0x9de00002
+	.word	0x60000438
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00003
+	.word	0xcd00047c
+	.word	0x9de00000
+	.word	0x6000045e
+	.word	0x1010007
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0004b2
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000438
+	.word	0xc10004b2
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x65
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000438
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000436
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000425
+	.word	0xd010001
+	.word	0x8c000447
+	.word	0x9ce00000
+	.word	0xcc0004aa
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x6000044c
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x75
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x6c
+	.word	0x6e
+	.word	0x20
+	.word	0x5b
+	.word	0x70
+	.word	0x61
+	.word	0x74
+	.word	0x68
+	.word	0x2f
+	.word	0x74
+	.word	0x6f
+	.word	0x2f
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x70
+	.word	0x61
+	.word	0x74
+	.word	0x68
+	.word	0x2f
+	.word	0x74
+	.word	0x6f
+	.word	0x2f
+	.word	0x68
+	.word	0x61
+	.word	0x72
+	.word	0x64
+	.word	0x6c
+	.word	0x69
+	.word	0x6e
+	.word	0x6b
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80000048
+	.word	0x602
+	.word	0x19960503
+	.word	0x7da
+	.word	0x1000
+	.word	0x1aa8
+	.word	0x18dc
+	.word	0x1cc
+	.word	0xe0
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x97e00001
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010004
+	.word	0x9de00000
+	.word	0x600008c7
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00004
+	.word	0x9d700000
+	.word	0x8de00005
+	.word	0x9d700001
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x60000a1d
+	.word	0xd010001
+	.word	0x1dd80030
+	.word	0x1dd00001
+	.word	0x9de00005
+	.word	0x60000a1d
+	.word	0xd010001
+	.word	0x1dd8000e
+	.word	0x1dd00001
+	.word	0x9de00004
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x60000401
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1b
+	.word	0x5b
+	.word	0x3f
+	.word	0x32
+	.word	0x35
+	.word	0x6c
+	.word	0x0
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000aa7
+	.word	0x9de00001
+	.word	0xcd00042c
+	.word	0x9de00002
+	.word	0x60000a0a
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1d010068
+	.word	0x9d000431
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000aa7
+	.word	0x9de00001
+	.word	0xcd00042c
+	.word	0x9de00002
+	.word	0x60000a0a
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x40000462
+	.word	0x8de00003
+	.word	0x8ce00004
+	.word	0xdd6000c
+	.word	0x17d8000a
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x1c700030
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x1dd6000a
+	.word	0x9de00004
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0dffff1
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1b
+	.word	0x5b
+	.word	0x30
+	.word	0x30
+	.word	0x30
+	.word	0x3b
+	.word	0x30
+	.word	0x30
+	.word	0x30
+	.word	0x48
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x0
+	.word	0x1ee30006
+	.word	0x97e00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0xc700046a
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x1d010064
+	.word	0x9de00001
+	.word	0x1d710002
+	.word	0x9de00002
+	.word	0x60000451
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x1d010064
+	.word	0x9de00001
+	.word	0x1d710006
+	.word	0x9de00002
+	.word	0x60000451
+	.word	0x8de00008
+	.word	0x9d000477
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000475
+	.word	0x9de00001
+	.word	0xcd00046a
+	.word	0x9de00002
+	.word	0x60000a0a
+	.word	0x87e00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1b
+	.word	0x5b
+	.word	0x30
+	.word	0x3b
+	.word	0x30
+	.word	0x48
+	.word	0x1b
+	.word	0x5b
+	.word	0x32
+	.word	0x4a
+	.word	0x0
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000aa7
+	.word	0x9de00001
+	.word	0xcd00049a
+	.word	0x9de00002
+	.word	0x60000a0a
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00009
+	.word	0x9de00000
+	.word	0x600009ac
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x9de00007
+	.word	0x1d010019
+	.word	0x8ce00007
+	.word	0x1cc60002
+	.word	0xdd2000c
+	.word	0x1dd20001
+	.word	0x9de00006
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00008
+	.word	0x9de00001
+	.word	0x1d010020
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000aa7
+	.word	0x9de00001
+	.word	0x8de00009
+	.word	0x9de00002
+	.word	0x60000a0a
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x17010007
+	.word	0xd010007
+	.word	0x17d00001
+	.word	0x9de00000
+	.word	0xcd000a96
+	.word	0x9de00001
+	.word	0x600004b3
+	.word	0xd010007
+	.word	0x17d00001
+	.word	0x9de00000
+	.word	0xcd000a81
+	.word	0x9de00001
+	.word	0x600004b3
+	.word	0x97e00000
+	.word	0xcd000a71
+	.word	0x9de00001
+	.word	0x600004b3
+	.word	0x87e00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee3000a
+	.word	0x94e00003
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x600008c7
+	.word	0xd010001
+	.word	0x401000d
+	.word	0x6010004
+	.word	0x15010030
+	.word	0x7010000
+	.word	0x40000506
+	.word	0xd010006
+	.word	0x16d10001
+	.word	0x1c01002d
+	.word	0x9cd00000
+	.word	0x17700001
+	.word	0x2d700005
+	.word	0xb0dffff9
+	.word	0x90600000
+	.word	0xd010000
+	.word	0x9de00000
+	.word	0x9de00001
+	.word	0x1d01002d
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000aa7
+	.word	0x9de00001
+	.word	0x94e00002
+	.word	0x60000a0a
+	.word	0x90e00000
+	.word	0x1d01000f
+	.word	0x9de00001
+	.word	0x1d01002d
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000aa7
+	.word	0x9de00001
+	.word	0x94e00002
+	.word	0x60000a0a
+	.word	0x17010001
+	.word	0x90e00000
+	.word	0x97e00001
+	.word	0x1d01007c
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x17700001
+	.word	0x3d70000f
+	.word	0xb0dffff8
+	.word	0x17010001
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0x1d01007c
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x17700001
+	.word	0x3d70000f
+	.word	0xb0dffff7
+	.word	0x94e00000
+	.word	0x6000097b
+	.word	0x84e00003
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1000a
+	.word	0x50f00000
+	.word	0x1ee30032
+	.word	0x98e00004
+	.word	0x99e00005
+	.word	0x9ae00006
+	.word	0x9be00007
+	.word	0x9ce00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010001
+	.word	0x9de00002
+	.word	0xcd000abb
+	.word	0x9de00003
+	.word	0x600009de
+	.word	0x1de1000b
+	.word	0xc9000abb
+	.word	0x19910027
+	.word	0x1bd10027
+	.word	0x19930001
+	.word	0x1bb30001
+	.word	0x88900000
+	.word	0x98b00000
+	.word	0x2ad1000b
+	.word	0xb0affffa
+	.word	0x8de0000e
+	.word	0x3c0effff
+	.word	0x1ccdfff5
+	.word	0xc01000c
+	.word	0xddb000c
+	.word	0x9de0000e
+	.word	0x90e00016
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x1de1000b
+	.word	0x9de00003
+	.word	0x600009de
+	.word	0x1d010001
+	.word	0x9d000400
+	.word	0x88e00004
+	.word	0x89e00005
+	.word	0x8ae00006
+	.word	0x8be00007
+	.word	0x8ce00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee10032
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8d000400
+	.word	0x2dd80000
+	.word	0xb0d00009
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0xcd000abb
+	.word	0x9de00003
+	.word	0x600009de
+	.word	0x60000441
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000a
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x600009de
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x9de00009
+	.word	0x8de00009
+	.word	0x9de00000
+	.word	0x60000a30
+	.word	0x8de0000a
+	.word	0x1dd10002
+	.word	0x9dd00000
+	.word	0x8de0000a
+	.word	0x1cd10002
+	.word	0x9cd00003
+	.word	0x8de0000a
+	.word	0x9dd00000
+	.word	0x8de0000a
+	.word	0x9dd00001
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d011102
+	.word	0x9de00001
+	.word	0xcd000a5e
+	.word	0x9de00002
+	.word	0x1d0101a4
+	.word	0x9de00003
+	.word	0x600009de
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x1d010023
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x600009de
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x600009de
+	.word	0x6000053f
+	.word	0x60000433
+	.word	0x7010000
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0xcd000573
+	.word	0x9de00002
+	.word	0x600009de
+	.word	0x17700001
+	.word	0x3d700015
+	.word	0xb0dffff7
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000a
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x92e00003
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x5010000
+	.word	0x60000414
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x14710002
+	.word	0x8de0000b
+	.word	0x13d10002
+	.word	0x8de0000b
+	.word	0x82d00002
+	.word	0x94200001
+	.word	0x92400000
+	.word	0x93400001
+	.word	0x94300000
+	.word	0x8d700000
+	.word	0x9de00000
+	.word	0x8d700001
+	.word	0x9de00001
+	.word	0x1d01006f
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x15500001
+	.word	0x3d50000a
+	.word	0xb0dfffea
+	.word	0x15010001
+	.word	0x95e00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x60000401
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x14610002
+	.word	0x83e0000b
+	.word	0x8de0000b
+	.word	0x82d00000
+	.word	0x94200001
+	.word	0x92400000
+	.word	0x93400001
+	.word	0x94300000
+	.word	0x8d600000
+	.word	0x9de00000
+	.word	0x8d600001
+	.word	0x9de00001
+	.word	0x1d010078
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x15500001
+	.word	0x3d540003
+	.word	0xb0dfffe8
+	.word	0x82e00003
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8d000a05
+	.word	0x9de00000
+	.word	0xcd000a55
+	.word	0x9de00001
+	.word	0x60000a0a
+	.word	0x8de00008
+	.word	0x8dd00000
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x40000628
+	.word	0x8d000a05
+	.word	0x9de00000
+	.word	0xcd000a49
+	.word	0x9de00001
+	.word	0x8d700000
+	.word	0x9de00002
+	.word	0x8d700001
+	.word	0x9de00003
+	.word	0x60000a0a
+	.word	0x8d700002
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x1d710002
+	.word	0xd01000d
+	.word	0x8ce00008
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0dfffed
+	.word	0x8d000a05
+	.word	0x9de00000
+	.word	0xcd000a47
+	.word	0x9de00001
+	.word	0x60000a0a
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x9fe00002
+	.word	0x8de00007
+	.word	0x8dd00004
+	.word	0x9de00006
+	.word	0x8de00008
+	.word	0x9de00005
+	.word	0x3dd80071
+	.word	0xb0d00031
+	.word	0x1d010073
+	.word	0x9de00004
+	.word	0x8ce00005
+	.word	0x2dc8000d
+	.word	0xb0d0001e
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x2dd2000c
+	.word	0xb0d00008
+	.word	0x8de00008
+	.word	0x9de00003
+	.word	0x3dd80061
+	.word	0xb0d0000f
+	.word	0x8de00003
+	.word	0x3dd80064
+	.word	0xb0d0001a
+	.word	0x40000676
+	.word	0x8de00008
+	.word	0x3dd80077
+	.word	0xb0d00001
+	.word	0x40000676
+	.word	0x8de00006
+	.word	0x3dda0003
+	.word	0xb0d00002
+	.word	0x11010003
+	.word	0x40000677
+	.word	0x11010001
+	.word	0x40000677
+	.word	0x8de00006
+	.word	0x3dda0002
+	.word	0xb0d00002
+	.word	0x11010002
+	.word	0x40000677
+	.word	0x1010000
+	.word	0x40000677
+	.word	0x8de00006
+	.word	0x3dda0001
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000677
+	.word	0x11010003
+	.word	0x40000677
+	.word	0x8de00006
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000677
+	.word	0x11010002
+	.word	0x40000677
+	.word	0x600007ca
+	.word	0x81e00006
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x8fe00002
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x40000694
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dda000c
+	.word	0xb0d00006
+	.word	0x8d700001
+	.word	0x8ce00005
+	.word	0x2dda000c
+	.word	0xb0d00002
+	.word	0x1010007
+	.word	0x4000069b
+	.word	0x8d700002
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x1d710002
+	.word	0xd01000d
+	.word	0x8ce00003
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0dfffec
+	.word	0x1010000
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30010
+	.word	0x92e00003
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x8de00010
+	.word	0x8dd00004
+	.word	0x9de0000f
+	.word	0x8de00010
+	.word	0x8dd00000
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x3d1000c
+	.word	0x85300000
+	.word	0x84300001
+	.word	0x82e0000f
+	.word	0x2d200000
+	.word	0xb0d00020
+	.word	0x3d220003
+	.word	0xb0d0001e
+	.word	0x8d200a37
+	.word	0x50d00000
+	.word	0x3d5a0001
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dfffe
+	.word	0x40000744
+	.word	0x15520001
+	.word	0x400006da
+	.word	0x3d4a0001
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dfffb
+	.word	0x40000744
+	.word	0x14420001
+	.word	0x400006da
+	.word	0x3d500030
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dfffd
+	.word	0x40000744
+	.word	0x15500001
+	.word	0x400006da
+	.word	0x3d40000e
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dfffc
+	.word	0x40000744
+	.word	0x14400001
+	.word	0x400006da
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000744
+	.word	0x8de00010
+	.word	0x1dd10002
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x94e00002
+	.word	0x6000067c
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0001a
+	.word	0x8de00010
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x94e00002
+	.word	0x6000067c
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dfffa
+	.word	0x40000744
+	.word	0x8de00010
+	.word	0x8dd00001
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x8d700000
+	.word	0x9de00000
+	.word	0x8d700001
+	.word	0x9de00001
+	.word	0x1d010020
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x4000071d
+	.word	0x60000414
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x1d610002
+	.word	0x9de0000e
+	.word	0x8de00010
+	.word	0x1dd10002
+	.word	0x9de0000d
+	.word	0x8de00010
+	.word	0x8dd00002
+	.word	0x9de0000c
+	.word	0x8de0000c
+	.word	0x8ce0000e
+	.word	0x9cd00001
+	.word	0x8de0000e
+	.word	0x8ce0000c
+	.word	0x9cd00000
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00001
+	.word	0x8de0000d
+	.word	0x8ce0000e
+	.word	0x9cd00000
+	.word	0x8d600000
+	.word	0x9de00000
+	.word	0x8d600001
+	.word	0x9de00001
+	.word	0x1d01006f
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x8d700002
+	.word	0x8c700003
+	.word	0x9cd00001
+	.word	0x8d700003
+	.word	0x8c700002
+	.word	0x9cd00000
+	.word	0x90700002
+	.word	0x3d0e0000
+	.word	0x1ddd0002
+	.word	0x9d700003
+	.word	0x95700000
+	.word	0x94700001
+	.word	0x1d710002
+	.word	0x9de0000e
+	.word	0x8de00010
+	.word	0x9de0000d
+	.word	0x8de00010
+	.word	0x8dd00000
+	.word	0x9de0000c
+	.word	0x8de0000c
+	.word	0x8ce0000e
+	.word	0x9cd00001
+	.word	0x8de0000e
+	.word	0x8ce0000c
+	.word	0x9cd00000
+	.word	0x8de0000e
+	.word	0x8ce0000d
+	.word	0x9cd00001
+	.word	0x8de0000d
+	.word	0x8ce0000e
+	.word	0x9cd00000
+	.word	0x8d700000
+	.word	0x9de00000
+	.word	0x8d700001
+	.word	0x9de00001
+	.word	0x1d010078
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x1010000
+	.word	0x82e00003
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee10010
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x600006a0
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00005
+	.word	0x1d010006
+	.word	0x9de00000
+	.word	0xcd000a3b
+	.word	0x9de00001
+	.word	0x600004b3
+	.word	0x1010007
+	.word	0x87e00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00003
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x8de00007
+	.word	0x8dd00000
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x4000077b
+	.word	0x8d700000
+	.word	0x9de00000
+	.word	0x8d700001
+	.word	0x9de00001
+	.word	0x1d010078
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x8d700002
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x1d710002
+	.word	0xd01000d
+	.word	0x8ce00007
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0dfffef
+	.word	0x8de00007
+	.word	0x8dd00002
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x40000792
+	.word	0x8d700000
+	.word	0x9de00000
+	.word	0x8d700001
+	.word	0x9de00001
+	.word	0x1d01006f
+	.word	0x9de00002
+	.word	0x60000479
+	.word	0x8d700002
+	.word	0x3c0effff
+	.word	0x1ccdfffe
+	.word	0x7d1000c
+	.word	0x1d710002
+	.word	0xd01000d
+	.word	0x8ce00007
+	.word	0x1cc10002
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0dfffee
+	.word	0x87e00003
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1de10006
+	.word	0x9de00002
+	.word	0x1d010001
+	.word	0x9de00003
+	.word	0x600009de
+	.word	0xd010001
+	.word	0x9de00007
+	.word	0x8de00007
+	.word	0x2dd40000
+	.word	0xb0d00002
+	.word	0x81e00006
+	.word	0x400007b2
+	.word	0x1010000
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x9dd00000
+	.word	0x8de00002
+	.word	0x9dd00001
+	.word	0x8de00002
+	.word	0x1dd10002
+	.word	0x9dd00000
+	.word	0x8de00002
+	.word	0x1cd10002
+	.word	0x9cd00003
+	.word	0x8de00002
+	.word	0x1c010002
+	.word	0x9cd00004
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x60000573
+	.word	0x600004a5
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x600009de
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30010
+	.word	0x92e00004
+	.word	0x93e00005
+	.word	0x94e00006
+	.word	0x95e00007
+	.word	0x96e00008
+	.word	0x97e00009
+	.word	0x9ce0000a
+	.word	0x9de0000b
+	.word	0x9fe0000c
+	.word	0xc5000ab6
+	.word	0x14010001
+	.word	0x12010001
+	.word	0x13010001
+	.word	0x1de1000e
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x600009e0
+	.word	0x95e00000
+	.word	0x60000586
+	.word	0x600004a5
+	.word	0x95e00000
+	.word	0x600004f0
+	.word	0x3d0e0773
+	.word	0x1ddd5940
+	.word	0x9de0000f
+	.word	0x40000849
+	.word	0x600004d6
+	.word	0x40000804
+	.word	0x6000079f
+	.word	0xd010001
+	.word	0x9de0000d
+	.word	0x8de0000d
+	.word	0x3dda0020
+	.word	0xb0d00001
+	.word	0x40000806
+	.word	0x8de0000d
+	.word	0x3dda0071
+	.word	0xb0d00001
+	.word	0x600007ca
+	.word	0x2d3a0000
+	.word	0xb0dffff3
+	.word	0x95e00000
+	.word	0x600007b6
+	.word	0x600004a5
+	.word	0x95e00000
+	.word	0x600004f0
+	.word	0x95e00000
+	.word	0x600005c8
+	.word	0x14010001
+	.word	0x40000847
+	.word	0x90e0000d
+	.word	0x1d01002f
+	.word	0x9de00000
+	.word	0x1de1000e
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x600009de
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0xcd000aaa
+	.word	0x9de00002
+	.word	0x1d01000c
+	.word	0x9de00003
+	.word	0x600009de
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d6a0000
+	.word	0xb0d00007
+	.word	0x95e00000
+	.word	0x6000074f
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x4010000
+	.word	0x40000849
+	.word	0x7010000
+	.word	0x40000845
+	.word	0x2d780000
+	.word	0xb0d00005
+	.word	0x8d700aaa
+	.word	0x8ce0000d
+	.word	0x2dda000c
+	.word	0xb0d00001
+	.word	0x40000844
+	.word	0xcd000aaa
+	.word	0xd71000d
+	.word	0x8cd00000
+	.word	0x9ce0000d
+	.word	0x95e00000
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x60000639
+	.word	0xd010001
+	.word	0x9d500004
+	.word	0x95e00000
+	.word	0x6000074f
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d680000
+	.word	0xb0d00002
+	.word	0x4010000
+	.word	0x40000847
+	.word	0x17700001
+	.word	0x2d700006
+	.word	0xb0dfffe4
+	.word	0x2d4a0000
+	.word	0xb0dfffc6
+	.word	0x2d2a0000
+	.word	0xb0dfffac
+	.word	0x600007ca
+	.word	0x1010000
+	.word	0x82e00004
+	.word	0x83e00005
+	.word	0x84e00006
+	.word	0x85e00007
+	.word	0x86e00008
+	.word	0x87e00009
+	.word	0x8ce0000a
+	.word	0x8de0000b
+	.word	0x8fe0000c
+	.word	0x1ee10010
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x87000858
+	.word	0x40000862
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x600009c5
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x600009c5
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400008c1
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d000858
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d000858
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000859
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000872
+	.word	0x90700003
+	.word	0x40000908
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x6000089a
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x40000909
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x6000089a
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000909
+	.word	0x97000858
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d000858
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c000858
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x600009c5
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x60000944
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40000972
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x40000975
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x6000094f
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000944
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x6000090f
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x6000090f
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00003
+	.word	0x9de00002
+	.word	0x400009b5
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffff9
+	.word	0x8de00003
+	.word	0xd01000d
+	.word	0x8ce00002
+	.word	0xc01000c
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0x101000d
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d0009c4
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x400009d2
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x810009c4
+	.word	0x400009da
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x600009de
+	.word	0xd010001
+	.word	0x9d0009c4
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00005
+	.word	0x2dd90000
+	.word	0xb0d0000b
+	.word	0x87e00003
+	.word	0xd010007
+	.word	0x17d10001
+	.word	0x8ce00004
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x9de00005
+	.word	0x2ddb0000
+	.word	0xb0dffff6
+	.word	0x81e00003
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x9f
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x600009de
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x3d0e41c6
+	.word	0x1ddd4e6d
+	.word	0x8c000a1c
+	.word	0xdd5000c
+	.word	0x1c013039
+	.word	0xdd1000c
+	.word	0x9d000a1c
+	.word	0x8d000a1c
+	.word	0x1ddc0010
+	.word	0x1c017fff
+	.word	0xddb000c
+	.word	0x101000d
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30001
+	.word	0x9de00000
+	.word	0x8de00001
+	.word	0x9d000a1c
+	.word	0x8de00000
+	.word	0x1ee10001
+	.word	0x50f00000
+	.word	0x6bb
+	.word	0x6c2
+	.word	0x6c9
+	.word	0x6d0
+	.word	0x59
+	.word	0x6f
+	.word	0x75
+	.word	0x20
+	.word	0x6c
+	.word	0x6f
+	.word	0x73
+	.word	0x74
+	.word	0x20
+	.word	0x3a
+	.word	0x28
+	.word	0x0
+	.word	0xa
+	.word	0x0
+	.word	0x78
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x20
+	.word	0x79
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0x3b
+	.word	0x20
+	.word	0x0
+	.word	0x70
+	.word	0x6f
+	.word	0x69
+	.word	0x6e
+	.word	0x74
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x0
+	.word	0x2f
+	.word	0x76
+	.word	0x61
+	.word	0x72
+	.word	0x2f
+	.word	0x6c
+	.word	0x6f
+	.word	0x67
+	.word	0x2f
+	.word	0x73
+	.word	0x6e
+	.word	0x61
+	.word	0x6b
+	.word	0x65
+	.word	0x2e
+	.word	0x6c
+	.word	0x6f
+	.word	0x67
+	.word	0x0
+	.word	0x50
+	.word	0x72
+	.word	0x65
+	.word	0x73
+	.word	0x73
+	.word	0x20
+	.word	0x71
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x20
+	.word	0x65
+	.word	0x78
+	.word	0x69
+	.word	0x74
+	.word	0x0
+	.word	0x50
+	.word	0x72
+	.word	0x65
+	.word	0x73
+	.word	0x73
+	.word	0x20
+	.word	0x53
+	.word	0x50
+	.word	0x41
+	.word	0x43
+	.word	0x45
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x72
+	.word	0x74
+	.word	0x0
+	.word	0x55
+	.word	0x73
+	.word	0x65
+	.word	0x20
+	.word	0x57
+	.word	0x41
+	.word	0x53
+	.word	0x44
+	.word	0x20
+	.word	0x74
+	.word	0x6f
+	.word	0x20
+	.word	0x6d
+	.word	0x6f
+	.word	0x76
+	.word	0x65
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x80000050
+	.word	0x3de
+	.word	0x19960503
+	.word	0x77d
+	.word	0x1000
+	.word	0x14b0
+	.word	0x11d4
+	.word	0x2dc
+	.word	0x4
+	.word	0x2f
+	.word	0x62
+	.word	0x69
+	.word	0x6e
+	.word	0x2f
+	.word	0x77
+	.word	0x73
+	.word	0x68
+	.word	0x0
+	.word	0x400
+	.word	0x0
+	.word	0x90a
+	.word	0x900
+	.word	0x0
+	.word	0x1ee30008
+	.word	0x97e00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x1de10007
+	.word	0x9de00000
+	.word	0x6000084d
+	.word	0x1de10007
+	.word	0x9de00000
+	.word	0x1d01000b
+	.word	0x9de00001
+	.word	0x60000828
+	.word	0x1d010013
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0x17010001
+	.word	0x1d010031
+	.word	0x9de00000
+	.word	0x97e00001
+	.word	0x3d0e0000
+	.word	0x1ddd0001
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0x17700001
+	.word	0x3d700015
+	.word	0xb0dffff6
+	.word	0x87e00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d010028
+	.word	0x9de00000
+	.word	0x1d0101ff
+	.word	0x9de00001
+	.word	0xcd0008fb
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x9de00006
+	.word	0x8de00006
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x40000445
+	.word	0x7010000
+	.word	0x97e00000
+	.word	0x1d01002c
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x87e00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee3000d
+	.word	0x92e00004
+	.word	0x93e00005
+	.word	0x94e00006
+	.word	0x95e00007
+	.word	0x96e00008
+	.word	0x97e00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x1d010028
+	.word	0x9de00000
+	.word	0x1d0101ed
+	.word	0x9de00001
+	.word	0xcd0008ea
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x40000467
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d010034
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010028
+	.word	0x9de00000
+	.word	0x1d0101ed
+	.word	0x9de00001
+	.word	0xcd0008e5
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x4000047b
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d010037
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010028
+	.word	0x9de00000
+	.word	0x1d0101ed
+	.word	0x9de00001
+	.word	0xcd0008db
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x4000048f
+	.word	0x4010000
+	.word	0x94e00000
+	.word	0x1d01003a
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d01001c
+	.word	0x9de00000
+	.word	0x1d0101ed
+	.word	0x9de00001
+	.word	0xcd0008d1
+	.word	0x9de00002
+	.word	0x1d010301
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x400004a5
+	.word	0x3010000
+	.word	0x93e00000
+	.word	0x1d01003d
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d01001c
+	.word	0x9de00000
+	.word	0x1d0101ed
+	.word	0x9de00001
+	.word	0xcd0008c7
+	.word	0x9de00002
+	.word	0x1d010302
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x12010001
+	.word	0x400004bb
+	.word	0x2010000
+	.word	0x92e00000
+	.word	0x1d010040
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d01001c
+	.word	0x9de00000
+	.word	0x1d0101ed
+	.word	0x9de00001
+	.word	0xcd0008be
+	.word	0x9de00002
+	.word	0x1d010101
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00003
+	.word	0x1d010001
+	.word	0x9de0000c
+	.word	0x400004d2
+	.word	0x90e0000c
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x1d010043
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x82e00004
+	.word	0x83e00005
+	.word	0x84e00006
+	.word	0x85e00007
+	.word	0x86e00008
+	.word	0x87e00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee1000d
+	.word	0x50f00000
+	.word	0x1ee30030
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x8de00030
+	.word	0x9de00001
+	.word	0x1d010001
+	.word	0x9de00002
+	.word	0x1de10009
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x16010001
+	.word	0x400004f9
+	.word	0x6010000
+	.word	0x96e00000
+	.word	0x1d01004b
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d01003b
+	.word	0x9de0000c
+	.word	0x1d012100
+	.word	0x9de00009
+	.word	0x90e0000a
+	.word	0x1d010080
+	.word	0x9de0000b
+	.word	0x1d010003
+	.word	0x9de0000e
+	.word	0x1d01001c
+	.word	0x9de0000f
+	.word	0x1d010008
+	.word	0x9de00010
+	.word	0x1d010015
+	.word	0x9de00011
+	.word	0x1d010004
+	.word	0x9de00012
+	.word	0x1d010011
+	.word	0x9de00016
+	.word	0x1d010013
+	.word	0x9de00017
+	.word	0x1d01001a
+	.word	0x9de00018
+	.word	0x1d010016
+	.word	0x9de0001d
+	.word	0x1d010017
+	.word	0x9de0001c
+	.word	0x1d010012
+	.word	0x9de0001a
+	.word	0x90e00019
+	.word	0x90e0001e
+	.word	0x90e00013
+	.word	0x1d010001
+	.word	0x9de00014
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x8de00030
+	.word	0x9de00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x1de10009
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x40000531
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d010063
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10030
+	.word	0x50f00000
+	.word	0x1ee30010
+	.word	0x92e00004
+	.word	0x93e00005
+	.word	0x94e00006
+	.word	0x95e00007
+	.word	0x96e00008
+	.word	0x97e00009
+	.word	0x9ce0000a
+	.word	0x9de0000b
+	.word	0x9fe0000c
+	.word	0x1d01002e
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x2d7a000d
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x40000556
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d01006b
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0xcd0008d1
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d6a0000
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x4000056a
+	.word	0x4010000
+	.word	0x94e00000
+	.word	0x1d01006d
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010022
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d7a0001
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x4000057b
+	.word	0x3010000
+	.word	0x93e00000
+	.word	0x1d01006f
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010022
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d7a0002
+	.word	0xb0d00002
+	.word	0x12010001
+	.word	0x4000058c
+	.word	0x2010000
+	.word	0x92e00000
+	.word	0x1d010071
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x1c010012
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00003
+	.word	0x1d010001
+	.word	0x9de0000f
+	.word	0x400005a2
+	.word	0x90e0000f
+	.word	0x8de0000f
+	.word	0x9de00000
+	.word	0x1d010073
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010015
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x9d00092c
+	.word	0x90e00000
+	.word	0x8d00092c
+	.word	0x9de00001
+	.word	0x600007c2
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00003
+	.word	0x1d010001
+	.word	0x9de0000e
+	.word	0x400005bb
+	.word	0x90e0000e
+	.word	0x8de0000e
+	.word	0x9de00000
+	.word	0x1d010076
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x90e00000
+	.word	0x600004e3
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0xcd0008c7
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x3d6a0003
+	.word	0xb0d00003
+	.word	0x1d010001
+	.word	0x9de0000d
+	.word	0x400005d3
+	.word	0x90e0000d
+	.word	0x8de0000d
+	.word	0x9de00000
+	.word	0x1d01007b
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x96e00000
+	.word	0x600004e3
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x6000080b
+	.word	0x82e00004
+	.word	0x83e00005
+	.word	0x84e00006
+	.word	0x85e00007
+	.word	0x86e00008
+	.word	0x87e00009
+	.word	0x8ce0000a
+	.word	0x8de0000b
+	.word	0x8fe0000c
+	.word	0x1ee10010
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x6000040e
+	.word	0x40000601
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x9de00001
+	.word	0x1de10007
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d0effff
+	.word	0x1dddffff
+	.word	0x2d7a000d
+	.word	0xb0d00001
+	.word	0x40000602
+	.word	0x400005f1
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0008ac
+	.word	0x9de00001
+	.word	0x600007e6
+	.word	0x87e00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x2f
+	.word	0x76
+	.word	0x61
+	.word	0x72
+	.word	0x2f
+	.word	0x6c
+	.word	0x6f
+	.word	0x67
+	.word	0x2f
+	.word	0x74
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x2e
+	.word	0x6c
+	.word	0x6f
+	.word	0x67
+	.word	0x0
+	.word	0x1ee30011
+	.word	0x98e00004
+	.word	0x99e00005
+	.word	0x9ae00006
+	.word	0x9be00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x1de1000a
+	.word	0xc9000875
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x88900002
+	.word	0x8a900003
+	.word	0x98d00002
+	.word	0x9ad00003
+	.word	0x88900004
+	.word	0x8a900005
+	.word	0x98d00004
+	.word	0x9ad00005
+	.word	0x88900006
+	.word	0x98d00006
+	.word	0x1d010005
+	.word	0x9de00000
+	.word	0xcd000400
+	.word	0x9de00001
+	.word	0x1de1000a
+	.word	0x9de00002
+	.word	0xcd00040b
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0x88e00004
+	.word	0x89e00005
+	.word	0x8ae00006
+	.word	0x8be00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee10011
+	.word	0x50f00000
+	.word	0x1ee3004b
+	.word	0x94e00004
+	.word	0x95e00005
+	.word	0x96e00006
+	.word	0x97e00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x1d01000a
+	.word	0x9de00000
+	.word	0x8de0004b
+	.word	0x9de00001
+	.word	0x1de1004a
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de0004a
+	.word	0x1dde0008
+	.word	0x15db00ff
+	.word	0x2d580000
+	.word	0xb0d00027
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00087c
+	.word	0x9de00001
+	.word	0x95e00002
+	.word	0x600007e6
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0xcd00060c
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x40000673
+	.word	0x1d010018
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x1de1000a
+	.word	0x9de00002
+	.word	0x97e00003
+	.word	0x6000080b
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de1000a
+	.word	0x9de00002
+	.word	0x1d010040
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2dd20000
+	.word	0xb0dfffec
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x6000080b
+	.word	0x2d5a0000
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x40000688
+	.word	0x4010000
+	.word	0x94e00000
+	.word	0x1d0100aa
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x84e00004
+	.word	0x85e00005
+	.word	0x86e00006
+	.word	0x87e00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee1004b
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d010005
+	.word	0x9de00000
+	.word	0xcd000400
+	.word	0x9de00001
+	.word	0xcd000409
+	.word	0x9de00002
+	.word	0xcd00040b
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee3000c
+	.word	0x92e00004
+	.word	0x93e00005
+	.word	0x94e00006
+	.word	0x95e00007
+	.word	0x96e00008
+	.word	0x97e00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x1d01002e
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x2d7a000d
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x400006bd
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d0100b5
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0xcd0008c7
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d640000
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x400006d1
+	.word	0x4010000
+	.word	0x94e00000
+	.word	0x1d0100b8
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1d010012
+	.word	0x9de00002
+	.word	0x90e00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x400006e5
+	.word	0x3010000
+	.word	0x93e00000
+	.word	0x1d0100bb
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010015
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x9d00092c
+	.word	0x96e00000
+	.word	0x8d00092c
+	.word	0x9de00001
+	.word	0x600007c2
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x12010001
+	.word	0x400006fc
+	.word	0x2010000
+	.word	0x92e00000
+	.word	0x1d0100be
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1010006
+	.word	0x82e00004
+	.word	0x83e00005
+	.word	0x84e00006
+	.word	0x85e00007
+	.word	0x86e00008
+	.word	0x87e00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee1000c
+	.word	0x50f00000
+	.word	0x1ee3000b
+	.word	0x92e00003
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9de00009
+	.word	0x9fe0000a
+	.word	0x1d010035
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d6a0000
+	.word	0xb0d00055
+	.word	0x1d010023
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x15010001
+	.word	0x4000072a
+	.word	0x5010000
+	.word	0x95e00000
+	.word	0x1d0100c8
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010023
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x9de00001
+	.word	0x1d010001
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d7a0001
+	.word	0xb0d00002
+	.word	0x14010001
+	.word	0x4000073e
+	.word	0x4010000
+	.word	0x94e00000
+	.word	0x1d0100ca
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010023
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x9de00001
+	.word	0x1d010002
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x3d7a0002
+	.word	0xb0d00002
+	.word	0x13010001
+	.word	0x40000752
+	.word	0x3010000
+	.word	0x93e00000
+	.word	0x1d0100cc
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de0000b
+	.word	0x9de00001
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00002
+	.word	0x12010001
+	.word	0x40000764
+	.word	0x2010000
+	.word	0x92e00000
+	.word	0x1d0100cf
+	.word	0x9de00001
+	.word	0xcd0008ef
+	.word	0x9de00002
+	.word	0x600007ae
+	.word	0x8de0000c
+	.word	0x70d00000
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x6000080b
+	.word	0x1010006
+	.word	0x82e00003
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8de00009
+	.word	0x8fe0000a
+	.word	0x1ee1000b
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x60000450
+	.word	0x6000053e
+	.word	0x60000432
+	.word	0x1d010004
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00001
+	.word	0x60000696
+	.word	0x1d010035
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x2dda0000
+	.word	0xb0d00018
+	.word	0x600006a6
+	.word	0xd010001
+	.word	0x9de00006
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0xcd00061e
+	.word	0x9de00001
+	.word	0x6000070d
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x60000646
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0xcd000696
+	.word	0x9de00001
+	.word	0x6000070d
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0xd010000
+	.word	0x9de00001
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0x600005eb
+	.word	0x1010000
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00006
+	.word	0x2dda0000
+	.word	0xb0d0000a
+	.word	0x8d0007e1
+	.word	0x9de00000
+	.word	0xcd000911
+	.word	0x9de00001
+	.word	0x8de00008
+	.word	0x9de00002
+	.word	0x8de00007
+	.word	0x9de00003
+	.word	0x600007e6
+	.word	0x600007f8
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01002d
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x1d01000c
+	.word	0x9de00002
+	.word	0x1de10007
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x145
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000c
+	.word	0x9de00000
+	.word	0x6000080b
+	.word	0xd010001
+	.word	0x1c01000b
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x1d010006
+	.word	0x9de00002
+	.word	0x6000080b
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9ae00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000822
+	.word	0x8de00004
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0x8ae00005
+	.word	0xbba000a
+	.word	0xccd000b
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ae00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9ae00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x4000083f
+	.word	0x8de00004
+	.word	0x8cd00000
+	.word	0x1b010001
+	.word	0x8ae00005
+	.word	0xbba000a
+	.word	0xb03000b
+	.word	0x1bb30001
+	.word	0xccb000b
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ae00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30001
+	.word	0x9de00000
+	.word	0x8de00001
+	.word	0x90d00000
+	.word	0x1010000
+	.word	0x8de00000
+	.word	0x1ee10001
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0e003f
+	.word	0x1ccdffff
+	.word	0x9cd00000
+	.word	0x1010000
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0xd01000d
+	.word	0x1c010015
+	.word	0x2dd5000c
+	.word	0xb0d00003
+	.word	0x310effff
+	.word	0x111dffff
+	.word	0x40000870
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x1c010001
+	.word	0x8be00004
+	.word	0xcca000b
+	.word	0xddb000c
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x11010001
+	.word	0x40000870
+	.word	0x1010000
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x400
+	.word	0x8a9
+	.word	0x8a4
+	.word	0x8a0
+	.word	0x89e
+	.word	0x60c
+	.word	0x0
+	.word	0x55
+	.word	0x6e
+	.word	0x69
+	.word	0x74
+	.word	0x20
+	.word	0x74
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x20
+	.word	0x66
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0x2c
+	.word	0x20
+	.word	0x65
+	.word	0x78
+	.word	0x69
+	.word	0x74
+	.word	0x20
+	.word	0x73
+	.word	0x74
+	.word	0x61
+	.word	0x74
+	.word	0x75
+	.word	0x73
+	.word	0x20
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x0
+	.word	0x3e
+	.word	0x0
+	.word	0x72
+	.word	0x75
+	.word	0x6e
+	.word	0x0
+	.word	0x74
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x0
+	.word	0x2d
+	.word	0x63
+	.word	0x0
+	.word	0x53
+	.word	0x68
+	.word	0x75
+	.word	0x74
+	.word	0x74
+	.word	0x69
+	.word	0x6e
+	.word	0x67
+	.word	0x20
+	.word	0x64
+	.word	0x6f
+	.word	0x77
+	.word	0x6e
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0xa
+	.word	0x0
+	.word	0x2f
+	.word	0x64
+	.word	0x65
+	.word	0x76
+	.word	0x2f
+	.word	0x73
+	.word	0x64
+	.word	0x61
+	.word	0x0
+	.word	0x2f
+	.word	0x64
+	.word	0x65
+	.word	0x76
+	.word	0x2f
+	.word	0x74
+	.word	0x74
+	.word	0x79
+	.word	0x32
+	.word	0x0
+	.word	0x2f
+	.word	0x64
+	.word	0x65
+	.word	0x76
+	.word	0x2f
+	.word	0x74
+	.word	0x74
+	.word	0x79
+	.word	0x31
+	.word	0x0
+	.word	0x2f
+	.word	0x76
+	.word	0x61
+	.word	0x72
+	.word	0x2f
+	.word	0x6c
+	.word	0x6f
+	.word	0x67
+	.word	0x2f
+	.word	0x0
+	.word	0x2f
+	.word	0x76
+	.word	0x61
+	.word	0x72
+	.word	0x0
+	.word	0x2f
+	.word	0x64
+	.word	0x65
+	.word	0x76
+	.word	0x0
+	.word	0x69
+	.word	0x6e
+	.word	0x69
+	.word	0x74
+	.word	0x2f
+	.word	0x69
+	.word	0x6e
+	.word	0x69
+	.word	0x74
+	.word	0x2e
+	.word	0x63
+	.word	0x0
+	.word	0x2f
+	.word	0x74
+	.word	0x6d
+	.word	0x70
+	.word	0x0
+	.word	0x50
+	.word	0x41
+	.word	0x54
+	.word	0x48
+	.word	0x3d
+	.word	0x2f
+	.word	0x62
+	.word	0x69
+	.word	0x6e
+	.word	0x0
+	.word	0x48
+	.word	0x4f
+	.word	0x4d
+	.word	0x45
+	.word	0x3d
+	.word	0x2f
+	.word	0x0
+	.word	0x61
+	.word	0x73
+	.word	0x73
+	.word	0x65
+	.word	0x72
+	.word	0x74
+	.word	0x69
+	.word	0x6f
+	.word	0x6e
+	.word	0x20
+	.word	0x66
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0x20
+	.word	0x61
+	.word	0x74
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x25
+	.word	0x64
+	.word	0xa
+	.word	0x800000ce
+	.word	0x101
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x73c
+	.word	0x638
+	.word	0x104
+	.word	0x440
+	.word	0x1ee30026
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0x8de00026
+	.word	0x3dd60003
+	.word	0xb0d00007
+	.word	0x8d000504
+	.word	0x9de00000
+	.word	0xcd0005ab
+	.word	0x9de00001
+	.word	0x60000509
+	.word	0x11010001
+	.word	0x400004af
+	.word	0x8de00027
+	.word	0x1dd10001
+	.word	0x9de00027
+	.word	0x8de00027
+	.word	0x1cd10001
+	.word	0x9ce00027
+	.word	0x84d00000
+	.word	0x8de00027
+	.word	0x83d00000
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0x94e00002
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d660000
+	.word	0xb0d00004
+	.word	0x94e00000
+	.word	0x6000051b
+	.word	0x11010001
+	.word	0x400004af
+	.word	0x1d010021
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de10019
+	.word	0x9de00002
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00002
+	.word	0x1010007
+	.word	0x400004af
+	.word	0x8de0001b
+	.word	0x1c01f000
+	.word	0xddb000c
+	.word	0x1c018000
+	.word	0x2dd9000c
+	.word	0xb0d00008
+	.word	0x8d000504
+	.word	0x9de00000
+	.word	0xcd000596
+	.word	0x9de00001
+	.word	0x94e00002
+	.word	0x60000509
+	.word	0x11010001
+	.word	0x400004af
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x93e00001
+	.word	0x1de1000c
+	.word	0x9de00002
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d0002e
+	.word	0x8de0000e
+	.word	0x1c01f000
+	.word	0xddb000c
+	.word	0x1c014000
+	.word	0x2ddb000c
+	.word	0xb0d00028
+	.word	0xcd0005cf
+	.word	0x9de00000
+	.word	0x93e00001
+	.word	0x1d010100
+	.word	0x9de00002
+	.word	0x60000556
+	.word	0xcd0005cf
+	.word	0x9de00000
+	.word	0xcd000594
+	.word	0x9de00001
+	.word	0x1d010100
+	.word	0x9de00002
+	.word	0x600004bb
+	.word	0x94e00000
+	.word	0x60000539
+	.word	0xd010001
+	.word	0xcc0005cf
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x1d010100
+	.word	0x9de00002
+	.word	0x600004bb
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010101
+	.word	0x9de00001
+	.word	0xcd0005cf
+	.word	0x9de00002
+	.word	0x8de0001b
+	.word	0x9de00003
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x2d560000
+	.word	0xb0d00024
+	.word	0xcd0005cf
+	.word	0x9de00000
+	.word	0x6000051b
+	.word	0x11010001
+	.word	0x400004af
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010101
+	.word	0x9de00001
+	.word	0x93e00002
+	.word	0x8de0001b
+	.word	0x9de00003
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x501000d
+	.word	0x2d560000
+	.word	0xb0d00013
+	.word	0x93e00000
+	.word	0x6000051b
+	.word	0x11010001
+	.word	0x400004af
+	.word	0x1d010018
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0xcd0005cf
+	.word	0x9de00002
+	.word	0x97e00003
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d720000
+	.word	0xb0d00004
+	.word	0xcd00058e
+	.word	0x9de00000
+	.word	0x6000051b
+	.word	0x400004a6
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0xcd0005cf
+	.word	0x9de00002
+	.word	0x1d010100
+	.word	0x9de00003
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2dd20000
+	.word	0xb0dfffe5
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x600004b9
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x600004b9
+	.word	0x1010000
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee10026
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffffa
+	.word	0x8de00005
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0xdd1000c
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xc010007
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x9de00004
+	.word	0x8de00007
+	.word	0x8ce00004
+	.word	0xdd3000c
+	.word	0x9de00007
+	.word	0x8de00007
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x1010007
+	.word	0x400004f1
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8ce00006
+	.word	0x1bc10001
+	.word	0x9be00006
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00007
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00007
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00005
+	.word	0x90d00000
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0xc5
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x600004b9
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x6000057b
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x6000057d
+	.word	0xd010001
+	.word	0x8c000504
+	.word	0x9ce00000
+	.word	0xcc0005c7
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000509
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9de00001
+	.word	0x7010000
+	.word	0x8de00003
+	.word	0x9de00002
+	.word	0x40000548
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x3dda002f
+	.word	0xb0d00001
+	.word	0x87e00003
+	.word	0x8de00003
+	.word	0x1dd10001
+	.word	0x9de00003
+	.word	0x8de00003
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffff4
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x1d710001
+	.word	0x9de00002
+	.word	0x81e00002
+	.word	0x87e00000
+	.word	0x8de00001
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0x9de00003
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x40000569
+	.word	0x8de00004
+	.word	0x1cd10001
+	.word	0x9ce00004
+	.word	0x8ce00005
+	.word	0x1bc10001
+	.word	0x9be00005
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00006
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00004
+	.word	0x90d00000
+	.word	0x81e00003
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0006cf
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x600004b9
+	.word	0xc10006cf
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x77
+	.word	0x72
+	.word	0x69
+	.word	0x74
+	.word	0x65
+	.word	0x0
+	.word	0x2f
+	.word	0x0
+	.word	0x6e
+	.word	0x6f
+	.word	0x74
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x75
+	.word	0x6c
+	.word	0x61
+	.word	0x72
+	.word	0x20
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x63
+	.word	0x70
+	.word	0x20
+	.word	0x5b
+	.word	0x4f
+	.word	0x50
+	.word	0x54
+	.word	0x49
+	.word	0x4f
+	.word	0x4e
+	.word	0x5d
+	.word	0x2e
+	.word	0x2e
+	.word	0x2e
+	.word	0x20
+	.word	0x53
+	.word	0x4f
+	.word	0x55
+	.word	0x52
+	.word	0x43
+	.word	0x45
+	.word	0x20
+	.word	0x44
+	.word	0x45
+	.word	0x53
+	.word	0x54
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x8000002b
+	.word	0x6b
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x358
+	.word	0x268
+	.word	0xf0
+	.word	0x40
+	.word	0x1ee30015
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9ce00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x8de00016
+	.word	0x1dd10001
+	.word	0x9de00016
+	.word	0x86d00000
+	.word	0x8de00015
+	.word	0x3dd60002
+	.word	0xb0d00007
+	.word	0x8d00046e
+	.word	0x9de00000
+	.word	0xcd0004bc
+	.word	0x9de00001
+	.word	0x60000473
+	.word	0x11010001
+	.word	0x4000043c
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de10008
+	.word	0x9de00002
+	.word	0x60000498
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00004
+	.word	0x96e00000
+	.word	0x60000443
+	.word	0x11010001
+	.word	0x4000043c
+	.word	0x8de0000a
+	.word	0x1c01f000
+	.word	0xddb000c
+	.word	0x1c018000
+	.word	0x2dd9000c
+	.word	0xb0d00008
+	.word	0x8d00046e
+	.word	0x9de00000
+	.word	0xcd0004a4
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x60000473
+	.word	0x11010001
+	.word	0x4000043c
+	.word	0x1d010025
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000498
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00003
+	.word	0xcd00049a
+	.word	0x9de00000
+	.word	0x60000443
+	.word	0x1010007
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8ce00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10015
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000496
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000485
+	.word	0xd010001
+	.word	0x8c00046e
+	.word	0x9ce00000
+	.word	0xcc0004ce
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000473
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x62
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000498
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0004d6
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000498
+	.word	0xc10004d6
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x72
+	.word	0x6d
+	.word	0x20
+	.word	0x66
+	.word	0x61
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0x64
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x69
+	.word	0x73
+	.word	0x20
+	.word	0x6e
+	.word	0x6f
+	.word	0x74
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x75
+	.word	0x6c
+	.word	0x61
+	.word	0x72
+	.word	0x20
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0xa
+	.word	0x0
+	.word	0x75
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x72
+	.word	0x6d
+	.word	0x20
+	.word	0x5b
+	.word	0x46
+	.word	0x49
+	.word	0x4c
+	.word	0x45
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80000024
+	.word	0x4
+	.word	0x20
+	.word	0x0
+	.word	0x6d
+	.word	0x76
+	.word	0x8000001b
+	.word	0x5
+	.word	0x101
+	.word	0x21
+	.word	0x0
+	.word	0x6c
+	.word	0x73
+	.word	0x8000001b
+	.word	0xa
+	.word	0x101
+	.word	0x22
+	.word	0x0
+	.word	0x68
+	.word	0x69
+	.word	0x73
+	.word	0x74
+	.word	0x6f
+	.word	0x72
+	.word	0x79
+	.word	0x80000016
+	.word	0x1
+	.word	0x101
+	.word	0x800000a0
+	.word	0x93
+	.word	0x19960503
+	.word	0x400
+	.word	0x1000
+	.word	0x574
+	.word	0x380
+	.word	0x1f4
+	.word	0x440
+	.word	0x1ee30024
+	.word	0x95e00004
+	.word	0x96e00005
+	.word	0x97e00006
+	.word	0x9ce00007
+	.word	0x9de00008
+	.word	0x9fe00009
+	.word	0x8de00024
+	.word	0x3dd60003
+	.word	0xb0d00006
+	.word	0x8d000496
+	.word	0x9de00000
+	.word	0xcd00053d
+	.word	0x9de00001
+	.word	0x6000049b
+	.word	0x40000480
+	.word	0x8de00025
+	.word	0x1dd10001
+	.word	0x9de00025
+	.word	0x85d00000
+	.word	0x8de00025
+	.word	0x1dd10001
+	.word	0x9de00025
+	.word	0x86d00000
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x1de1000a
+	.word	0x9de00002
+	.word	0x600004de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00003
+	.word	0x95e00000
+	.word	0x600004c0
+	.word	0x40000480
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x1de10017
+	.word	0x9de00002
+	.word	0x600004de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d7a0000
+	.word	0xb0d00036
+	.word	0x8de00019
+	.word	0x1c01f000
+	.word	0xddb000c
+	.word	0x1c018000
+	.word	0x2dd9000c
+	.word	0xb0d0002f
+	.word	0x8d000496
+	.word	0x9de00000
+	.word	0xcd000526
+	.word	0x9de00001
+	.word	0x6000049b
+	.word	0x40000480
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000511
+	.word	0x9de00001
+	.word	0x96e00002
+	.word	0x6000049b
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x90e00001
+	.word	0xcd00055d
+	.word	0x9de00002
+	.word	0x1d010100
+	.word	0x9de00003
+	.word	0x600004de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d00055d
+	.word	0x3dda006e
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000481
+	.word	0x8d00055d
+	.word	0x3dda0079
+	.word	0xb0d0000c
+	.word	0x1d010025
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x600004de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d0000a
+	.word	0xcd000502
+	.word	0x9de00000
+	.word	0x600004c0
+	.word	0x40000480
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd0004f1
+	.word	0x9de00001
+	.word	0x6000049b
+	.word	0x4000043b
+	.word	0x1d010024
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x96e00002
+	.word	0x600004de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00004
+	.word	0xcd0004e7
+	.word	0x9de00000
+	.word	0x600004c0
+	.word	0x40000480
+	.word	0x1d010025
+	.word	0x9de00000
+	.word	0x95e00001
+	.word	0x600004de
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d780000
+	.word	0xb0d00004
+	.word	0xcd0004e0
+	.word	0x9de00000
+	.word	0x600004c0
+	.word	0x40000480
+	.word	0x1010000
+	.word	0x40000481
+	.word	0x11010001
+	.word	0x85e00004
+	.word	0x86e00005
+	.word	0x87e00006
+	.word	0x8ce00007
+	.word	0x8de00008
+	.word	0x8fe00009
+	.word	0x1ee10024
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0xc1
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x600004de
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd00065d
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x600004de
+	.word	0xc100065d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x600004be
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x600004ad
+	.word	0xd010001
+	.word	0x8c000496
+	.word	0x9ce00000
+	.word	0xcc000555
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x6000049b
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x75
+	.word	0x6e
+	.word	0x6c
+	.word	0x69
+	.word	0x6e
+	.word	0x6b
+	.word	0x0
+	.word	0x63
+	.word	0x61
+	.word	0x6e
+	.word	0x74
+	.word	0x20
+	.word	0x6c
+	.word	0x69
+	.word	0x6e
+	.word	0x6b
+	.word	0x0
+	.word	0x70
+	.word	0x6c
+	.word	0x7a
+	.word	0x20
+	.word	0x74
+	.word	0x79
+	.word	0x70
+	.word	0x65
+	.word	0x20
+	.word	0x79
+	.word	0x20
+	.word	0x6f
+	.word	0x72
+	.word	0x20
+	.word	0x6e
+	.word	0xa
+	.word	0x0
+	.word	0x63
+	.word	0x61
+	.word	0x6e
+	.word	0x74
+	.word	0x20
+	.word	0x6f
+	.word	0x76
+	.word	0x65
+	.word	0x72
+	.word	0x77
+	.word	0x72
+	.word	0x69
+	.word	0x74
+	.word	0x65
+	.word	0x0
+	.word	0x6f
+	.word	0x76
+	.word	0x65
+	.word	0x72
+	.word	0x77
+	.word	0x72
+	.word	0x69
+	.word	0x74
+	.word	0x65
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x28
+	.word	0x79
+	.word	0x2f
+	.word	0x6e
+	.word	0x29
+	.word	0x3f
+	.word	0x20
+	.word	0x0
+	.word	0x64
+	.word	0x65
+	.word	0x73
+	.word	0x74
+	.word	0x20
+	.word	0x6e
+	.word	0x6f
+	.word	0x74
+	.word	0x20
+	.word	0x72
+	.word	0x65
+	.word	0x67
+	.word	0x75
+	.word	0x6c
+	.word	0x61
+	.word	0x72
+	.word	0x20
+	.word	0x66
+	.word	0x69
+	.word	0x6c
+	.word	0x65
+	.word	0xa
+	.word	0x0
+	.word	0x75
+	.word	0x73
+	.word	0x61
+	.word	0x67
+	.word	0x65
+	.word	0x3a
+	.word	0x20
+	.word	0x6d
+	.word	0x76
+	.word	0x20
+	.word	0x5b
+	.word	0x53
+	.word	0x52
+	.word	0x43
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x44
+	.word	0x45
+	.word	0x53
+	.word	0x54
+	.word	0x5d
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x8000009d
+	.word	0x49c
+	.word	0x19960503
+	.word	0x605
+	.word	0x1000
+	.word	0x15f0
+	.word	0x13c8
+	.word	0x228
+	.word	0x240
+	.word	0x1ee3001e
+	.word	0x92e00000
+	.word	0x93e00001
+	.word	0x94e00002
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x98e00006
+	.word	0x99e00007
+	.word	0x9ae00008
+	.word	0x9be00009
+	.word	0x9ce0000a
+	.word	0x9de0000b
+	.word	0x1de10012
+	.word	0xc90008f2
+	.word	0x88900000
+	.word	0x8a900001
+	.word	0x98d00000
+	.word	0x9ad00001
+	.word	0x88900002
+	.word	0x8a900003
+	.word	0x98d00002
+	.word	0x9ad00003
+	.word	0x88900004
+	.word	0x8a900005
+	.word	0x98d00004
+	.word	0x9ad00005
+	.word	0x88900006
+	.word	0x8a900007
+	.word	0x98d00006
+	.word	0x9ad00007
+	.word	0x88900008
+	.word	0x8a900009
+	.word	0x98d00008
+	.word	0x9ad00009
+	.word	0x8890000a
+	.word	0x8a90000b
+	.word	0x98d0000a
+	.word	0x9ad0000b
+	.word	0x90e00011
+	.word	0x8de0001e
+	.word	0x3c0e0001
+	.word	0x1ccd5180
+	.word	0xbd7000c
+	.word	0x401000b
+	.word	0xdd9000c
+	.word	0x201000d
+	.word	0x170107b2
+	.word	0x40000442
+	.word	0xd010000
+	.word	0x9de0000c
+	.word	0x1c780190
+	.word	0x2dc8000d
+	.word	0xb0d00008
+	.word	0x1d780004
+	.word	0x8ce0000c
+	.word	0x2dda000c
+	.word	0xb0d00006
+	.word	0x1d780064
+	.word	0x8ce0000c
+	.word	0x2dd8000c
+	.word	0xb0d00002
+	.word	0x1442016e
+	.word	0x40000441
+	.word	0x1442016d
+	.word	0x17700001
+	.word	0x3d46016d
+	.word	0xb0dfffed
+	.word	0x15400001
+	.word	0xd010000
+	.word	0x9de0000c
+	.word	0x1c780190
+	.word	0x2dc8000d
+	.word	0xb0d00008
+	.word	0x1d780004
+	.word	0x8ce0000c
+	.word	0x2dda000c
+	.word	0xb0d00006
+	.word	0x1d780064
+	.word	0x8ce0000c
+	.word	0x2dd8000c
+	.word	0xb0d00002
+	.word	0x1d010001
+	.word	0x9de00011
+	.word	0xd010000
+	.word	0x301000d
+	.word	0x601000d
+	.word	0x8de00011
+	.word	0x3dda0001
+	.word	0xb0d00026
+	.word	0x40000471
+	.word	0x3d6a0001
+	.word	0xb0d00007
+	.word	0x1d52001d
+	.word	0x2dd60000
+	.word	0xb0d00001
+	.word	0x40000481
+	.word	0x13300001
+	.word	0x1552001d
+	.word	0x40000470
+	.word	0x1de10012
+	.word	0xd61000d
+	.word	0x8dd00000
+	.word	0xd52000d
+	.word	0x2dd60000
+	.word	0xb0d00001
+	.word	0x40000481
+	.word	0x13300001
+	.word	0x1de10012
+	.word	0xd61000d
+	.word	0x8dd00000
+	.word	0x552000d
+	.word	0x16600001
+	.word	0x4000045b
+	.word	0x40000481
+	.word	0x1de10012
+	.word	0xd61000d
+	.word	0x8dd00000
+	.word	0xd52000d
+	.word	0x2dd60000
+	.word	0xb0d00001
+	.word	0x40000481
+	.word	0x13300001
+	.word	0x1de10012
+	.word	0xd61000d
+	.word	0x8dd00000
+	.word	0x552000d
+	.word	0x16600001
+	.word	0x40000473
+	.word	0x2d540000
+	.word	0xb0d00003
+	.word	0x13300001
+	.word	0x95e00010
+	.word	0x40000492
+	.word	0x3d3a0002
+	.word	0xb0d00006
+	.word	0x8de00011
+	.word	0x3dda0001
+	.word	0xb0d00003
+	.word	0x1d01001d
+	.word	0x9de00010
+	.word	0x40000492
+	.word	0x1de10011
+	.word	0xd31000d
+	.word	0x8dd00000
+	.word	0x9de00010
+	.word	0x1d010e10
+	.word	0xc26000d
+	.word	0x9ce0000f
+	.word	0xd28000d
+	.word	0x1c01003c
+	.word	0xbd6000c
+	.word	0x9be0000e
+	.word	0xdd8000c
+	.word	0x9de0000d
+	.word	0x8de0001f
+	.word	0x8ce00010
+	.word	0x9cd00000
+	.word	0x8de0001f
+	.word	0x93d00001
+	.word	0x8de0001f
+	.word	0x97d00002
+	.word	0x8de0001f
+	.word	0x8ce0000f
+	.word	0x9cd00003
+	.word	0x8de0001f
+	.word	0x8ce0000e
+	.word	0x9cd00004
+	.word	0x8de0001f
+	.word	0x8ce0000d
+	.word	0x9cd00005
+	.word	0x1010000
+	.word	0x82e00000
+	.word	0x83e00001
+	.word	0x84e00002
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x88e00006
+	.word	0x89e00007
+	.word	0x8ae00008
+	.word	0x8be00009
+	.word	0x8ce0000a
+	.word	0x8de0000b
+	.word	0x1ee1001e
+	.word	0x50f00000
+	.word	0x0
+	.word	0x96f
+	.word	0x0
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0xc70004ba
+	.word	0x400004cb
+	.word	0x8d700000
+	.word	0x8ce00003
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x81700001
+	.word	0x400004cf
+	.word	0x17710002
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0dffff6
+	.word	0x1010000
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x2d
+	.word	0x78
+	.word	0x77
+	.word	0x72
+	.word	0x0
+	.word	0x1ee3002d
+	.word	0x92e00009
+	.word	0x93e0000a
+	.word	0x94e0000b
+	.word	0x95e0000c
+	.word	0x96e0000d
+	.word	0x97e0000e
+	.word	0x9be0000f
+	.word	0x9ce00010
+	.word	0x9de00011
+	.word	0x9fe00012
+	.word	0xc500097c
+	.word	0x1d010020
+	.word	0x9de00000
+	.word	0x8de0002d
+	.word	0x9de00001
+	.word	0x1de10020
+	.word	0x9de00002
+	.word	0x60000702
+	.word	0xd010001
+	.word	0x9de00018
+	.word	0x8de00018
+	.word	0x2dd80000
+	.word	0xb0d00001
+	.word	0x40000571
+	.word	0x84e00022
+	.word	0xd010005
+	.word	0x9de00015
+	.word	0x15d10001
+	.word	0x8ce00022
+	.word	0x1b01f000
+	.word	0xccb000b
+	.word	0x1b014000
+	.word	0x2dcb000b
+	.word	0xb0d00002
+	.word	0x12010064
+	.word	0x400004ff
+	.word	0x1201002d
+	.word	0x8de00015
+	.word	0x92d00000
+	.word	0x16010100
+	.word	0x13010003
+	.word	0x17010003
+	.word	0xd010005
+	.word	0x9de00013
+	.word	0x15d10001
+	.word	0xc010006
+	.word	0xccb0004
+	.word	0x2dc90000
+	.word	0xb0d00003
+	.word	0x8d7004d4
+	.word	0x9de00014
+	.word	0x40000510
+	.word	0x1d01002d
+	.word	0x9de00014
+	.word	0x8de00014
+	.word	0x8ce00013
+	.word	0x9dc00000
+	.word	0x166e0001
+	.word	0x17720001
+	.word	0x2d720000
+	.word	0xb0dfffed
+	.word	0x13320001
+	.word	0x2d320000
+	.word	0xb0dfffe9
+	.word	0x90500000
+	.word	0x8de00024
+	.word	0x9de00000
+	.word	0x600004be
+	.word	0xd010001
+	.word	0x9de00017
+	.word	0x8de00025
+	.word	0x9de00000
+	.word	0x600004be
+	.word	0xd010001
+	.word	0x9de00016
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000961
+	.word	0x9de00001
+	.word	0xcd00097c
+	.word	0x9de00002
+	.word	0x8de00023
+	.word	0x9de00003
+	.word	0x8de00017
+	.word	0x9de00004
+	.word	0x8de00016
+	.word	0x9de00005
+	.word	0x600008a4
+	.word	0x8de00027
+	.word	0x9de00019
+	.word	0x8de0002e
+	.word	0x1ddb0004
+	.word	0x2dd80000
+	.word	0xb0d0001a
+	.word	0x8de00019
+	.word	0x1c0103ff
+	.word	0xddb000c
+	.word	0x9de00014
+	.word	0x8de00014
+	.word	0x1c0103e8
+	.word	0x2dd1000c
+	.word	0xb0d00003
+	.word	0x1d0103e7
+	.word	0x9de00013
+	.word	0x40000545
+	.word	0x8de00014
+	.word	0x9de00013
+	.word	0x8de00013
+	.word	0x9de00014
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000955
+	.word	0x9de00001
+	.word	0x8de00019
+	.word	0x1ddc000a
+	.word	0x9de00002
+	.word	0x8de00014
+	.word	0x9de00003
+	.word	0x600008a4
+	.word	0x40000559
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000950
+	.word	0x9de00001
+	.word	0x8de00019
+	.word	0x9de00002
+	.word	0x600008a4
+	.word	0x8de0002a
+	.word	0x9de00000
+	.word	0x1de1001a
+	.word	0x9de00001
+	.word	0x60000400
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00092e
+	.word	0x9de00001
+	.word	0x8de0001a
+	.word	0x9de00002
+	.word	0x8de0001b
+	.word	0x9de00003
+	.word	0x8de0001c
+	.word	0x9de00004
+	.word	0x8de0001d
+	.word	0x9de00005
+	.word	0x8de0001e
+	.word	0x9de00006
+	.word	0x8de0001f
+	.word	0x9de00007
+	.word	0x8de0002d
+	.word	0x9de00008
+	.word	0x600008a4
+	.word	0x82e00009
+	.word	0x83e0000a
+	.word	0x84e0000b
+	.word	0x85e0000c
+	.word	0x86e0000d
+	.word	0x87e0000e
+	.word	0x8be0000f
+	.word	0x8ce00010
+	.word	0x8de00011
+	.word	0x8fe00012
+	.word	0x1ee1002d
+	.word	0x50f00000
+	.word	0x1ee3003e
+	.word	0x93e00004
+	.word	0x94e00005
+	.word	0x95e00006
+	.word	0x96e00007
+	.word	0x97e00008
+	.word	0x9ce00009
+	.word	0x9de0000a
+	.word	0x9fe0000b
+	.word	0xc400092c
+	.word	0x8de0003e
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0xcd00092a
+	.word	0x9de0003e
+	.word	0x8de0003e
+	.word	0x9de00000
+	.word	0x60000651
+	.word	0xd010001
+	.word	0x601000d
+	.word	0xd010006
+	.word	0x2ddb0000
+	.word	0xb0d00041
+	.word	0xcd000922
+	.word	0x9de00000
+	.word	0x60000704
+	.word	0x11010001
+	.word	0x400005e9
+	.word	0x8d700002
+	.word	0x1c01002e
+	.word	0x2ddb000c
+	.word	0xb0d00005
+	.word	0x8de0003f
+	.word	0x1ddb0001
+	.word	0x2dda0000
+	.word	0xb0d00001
+	.word	0x400005d6
+	.word	0x8de0003f
+	.word	0x1ddb0002
+	.word	0x2dd80000
+	.word	0xb0d0001b
+	.word	0x1de1000c
+	.word	0x9de00000
+	.word	0x8de0003e
+	.word	0x9de00001
+	.word	0x1d010032
+	.word	0x9de00002
+	.word	0x600006dd
+	.word	0x1de1000c
+	.word	0x9de00000
+	.word	0xcd00092c
+	.word	0x9de00001
+	.word	0x1d010032
+	.word	0x9de00002
+	.word	0x600008b6
+	.word	0x1de1000c
+	.word	0x9de00000
+	.word	0x1d710002
+	.word	0x9de00001
+	.word	0x1d010032
+	.word	0x9de00002
+	.word	0x600008b6
+	.word	0x1de1000c
+	.word	0x9de00000
+	.word	0x8de0003f
+	.word	0x9de00001
+	.word	0x600004d9
+	.word	0x400005d6
+	.word	0x8d700001
+	.word	0x1c010004
+	.word	0x2ddb000c
+	.word	0xb0d00006
+	.word	0x8d700002
+	.word	0x1c01002e
+	.word	0x2dd9000c
+	.word	0xb0d00002
+	.word	0x3010004
+	.word	0x400005cd
+	.word	0xc3000921
+	.word	0x5010003
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd00091a
+	.word	0x9de00001
+	.word	0x95e00002
+	.word	0x1d710002
+	.word	0x9de00003
+	.word	0x600008a4
+	.word	0x96e00000
+	.word	0x60000677
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0dfffbd
+	.word	0x8de0003f
+	.word	0x1ddb0002
+	.word	0x2dda0000
+	.word	0xb0d00005
+	.word	0x1d010001
+	.word	0x9de00000
+	.word	0xcd000918
+	.word	0x9de00001
+	.word	0x600008a4
+	.word	0x96e00000
+	.word	0x600006b9
+	.word	0x1010000
+	.word	0x83e00004
+	.word	0x84e00005
+	.word	0x85e00006
+	.word	0x86e00007
+	.word	0x87e00008
+	.word	0x8ce00009
+	.word	0x8de0000a
+	.word	0x8fe0000b
+	.word	0x1ee1003e
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d00089f
+	.word	0x9de00000
+	.word	0xcd0008fe
+	.word	0x9de00001
+	.word	0x600008a4
+	.word	0x1d010002
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0x90e00002
+	.word	0x60000702
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee3000d
+	.word	0x94e00002
+	.word	0x95e00003
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0xcd00092a
+	.word	0x9de0000c
+	.word	0x6010000
+	.word	0x1d010001
+	.word	0x501000d
+	.word	0x8de0000e
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de0000a
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00021
+	.word	0x8de0000a
+	.word	0x17d10001
+	.word	0x8de0000a
+	.word	0x8dd00000
+	.word	0x3dda002d
+	.word	0xb0d0001b
+	.word	0x15500001
+	.word	0x40000637
+	.word	0x84700000
+	.word	0x1d010068
+	.word	0x9de00009
+	.word	0x2d48000d
+	.word	0xb0d0000d
+	.word	0x8de00009
+	.word	0x2d42000d
+	.word	0xb0d00003
+	.word	0x3d480061
+	.word	0xb0d00004
+	.word	0x40000635
+	.word	0x3d48006c
+	.word	0xb0d00003
+	.word	0x40000635
+	.word	0x166d0001
+	.word	0x40000636
+	.word	0x166d0002
+	.word	0x40000636
+	.word	0x166d0004
+	.word	0x40000636
+	.word	0x600005f3
+	.word	0x17710001
+	.word	0x8d700000
+	.word	0x2dda0000
+	.word	0xb0dfffe7
+	.word	0x8de0000d
+	.word	0x2d56000d
+	.word	0xb0d00004
+	.word	0x8de0000e
+	.word	0xd51000d
+	.word	0x8dd00000
+	.word	0x9de0000c
+	.word	0x8de0000c
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x6000057d
+	.word	0xd010001
+	.word	0x9de0000b
+	.word	0x81e0000b
+	.word	0x84e00002
+	.word	0x85e00003
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee1000d
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x96e00003
+	.word	0x97e00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010002
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x60000702
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d660000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000671
+	.word	0x1d01013a
+	.word	0x9de00000
+	.word	0x60000791
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x40000671
+	.word	0x96700000
+	.word	0x90700001
+	.word	0x90700002
+	.word	0x1010007
+	.word	0x86e00003
+	.word	0x87e00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x1ee30009
+	.word	0x97e00004
+	.word	0x9be00005
+	.word	0x9ce00006
+	.word	0x9de00007
+	.word	0x9fe00008
+	.word	0x8de00009
+	.word	0x8dd00002
+	.word	0x2dd80000
+	.word	0xb0d00016
+	.word	0x8de00009
+	.word	0x8cd00001
+	.word	0x8dd00002
+	.word	0x2dc6000d
+	.word	0xb0d0000b
+	.word	0x8de00009
+	.word	0x1dd10001
+	.word	0x8cd00000
+	.word	0x1bc00001
+	.word	0x9bd00000
+	.word	0x1d01001f
+	.word	0xdd4000c
+	.word	0x8ce00009
+	.word	0x1cc10004
+	.word	0x1d1000c
+	.word	0x400006b2
+	.word	0x8de00009
+	.word	0x8dd00002
+	.word	0x3dd6000a
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400006b2
+	.word	0x1d010026
+	.word	0x9de00000
+	.word	0x8de00009
+	.word	0x8cd00000
+	.word	0x9ce00001
+	.word	0x1dd10004
+	.word	0x9de00002
+	.word	0x1d01000a
+	.word	0x9de00003
+	.word	0x60000702
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2d720000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400006b2
+	.word	0x1d010001
+	.word	0x8ce00009
+	.word	0x9dc00001
+	.word	0x8de00009
+	.word	0xc010007
+	.word	0x1b01001f
+	.word	0xcc7000b
+	.word	0xc01000c
+	.word	0x9cd00002
+	.word	0x8de00009
+	.word	0x11d10004
+	.word	0x87e00004
+	.word	0x8be00005
+	.word	0x8ce00006
+	.word	0x8de00007
+	.word	0x8fe00008
+	.word	0x1ee10009
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x9de00001
+	.word	0x60000702
+	.word	0xd010001
+	.word	0x9de00004
+	.word	0x8de00005
+	.word	0x9de00000
+	.word	0x60000845
+	.word	0x81e00004
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd0009fc
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000702
+	.word	0xc10009fc
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x9be00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x8de00004
+	.word	0x9de00003
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0x9de00006
+	.word	0x400006f0
+	.word	0x8de00004
+	.word	0x1cd10001
+	.word	0x9ce00004
+	.word	0x8ce00005
+	.word	0x1bc10001
+	.word	0x9be00005
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00005
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00006
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00006
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00004
+	.word	0x90d00000
+	.word	0x81e00003
+	.word	0x8be00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x60000890
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x600006cc
+	.word	0xd010001
+	.word	0x8c00089f
+	.word	0x9ce00000
+	.word	0xcc000974
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x600008a4
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30003
+	.word	0x97e00000
+	.word	0x9ce00001
+	.word	0x9de00002
+	.word	0x87000722
+	.word	0x4000072c
+	.word	0x8de00003
+	.word	0x97d00000
+	.word	0x87700001
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d00007
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0dffff7
+	.word	0x8d700000
+	.word	0x8ce00004
+	.word	0x2dd1000c
+	.word	0xb0dffff3
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8ce00001
+	.word	0x8de00002
+	.word	0x1ee10003
+	.word	0x50f00000
+	.word	0x1ee30004
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x8de00005
+	.word	0x8ce00004
+	.word	0x1bc10005
+	.word	0x7d1000b
+	.word	0x8cc00000
+	.word	0xdc3000d
+	.word	0x1c010005
+	.word	0xdd3000c
+	.word	0x9d700000
+	.word	0x8de00004
+	.word	0x8dd00001
+	.word	0x9d700001
+	.word	0x8de00004
+	.word	0x9d700002
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00004
+	.word	0x8ce00005
+	.word	0x9cd00000
+	.word	0x8de00004
+	.word	0x97d00001
+	.word	0x8d700001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8d700001
+	.word	0x97d00002
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x90e00000
+	.word	0x60000877
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8de00007
+	.word	0x1c010005
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000877
+	.word	0xd010001
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x2dd60000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x4000078b
+	.word	0x8de00007
+	.word	0x9d700000
+	.word	0x90700001
+	.word	0x8de00006
+	.word	0x9d700002
+	.word	0x1d710005
+	.word	0x9d700004
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00002
+	.word	0x8de00006
+	.word	0x97d00001
+	.word	0x90700003
+	.word	0x1010007
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30008
+	.word	0x97e00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x8de00008
+	.word	0x1c010001
+	.word	0xdd3000c
+	.word	0x1ddc0002
+	.word	0x1dda0002
+	.word	0x1c010004
+	.word	0xdd1000c
+	.word	0x9de00007
+	.word	0x8d000722
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00024
+	.word	0x8d000722
+	.word	0x9de00006
+	.word	0x1de10006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000723
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2dd90000
+	.word	0xb0d0000c
+	.word	0x8d700000
+	.word	0x8ce00007
+	.word	0xdd3000c
+	.word	0x1c010009
+	.word	0x2dd1000c
+	.word	0xb0d00004
+	.word	0x97e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x6000073c
+	.word	0x90700003
+	.word	0x400007d2
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000764
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d0000e
+	.word	0x1010000
+	.word	0x400007d3
+	.word	0x90e00000
+	.word	0x8de00007
+	.word	0x9de00001
+	.word	0x60000764
+	.word	0xd010001
+	.word	0x701000d
+	.word	0xd010007
+	.word	0x2ddb0000
+	.word	0xb0d00002
+	.word	0x1010000
+	.word	0x400007d3
+	.word	0x97000722
+	.word	0x11710005
+	.word	0x87e00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00000
+	.word	0x9ae00001
+	.word	0x9be00002
+	.word	0x9ce00003
+	.word	0x9de00004
+	.word	0x8de00006
+	.word	0x87d00001
+	.word	0xd010007
+	.word	0x9de00005
+	.word	0x2dd90000
+	.word	0xb0d00021
+	.word	0x8d700003
+	.word	0x2dd80000
+	.word	0xb0d0001e
+	.word	0x8de00006
+	.word	0x8cd00004
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x8dd00000
+	.word	0xdc1000d
+	.word	0x8ce00005
+	.word	0xc01000c
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00012
+	.word	0x8de00006
+	.word	0x8cd00000
+	.word	0x8b700000
+	.word	0x1a010005
+	.word	0xbb1000a
+	.word	0xcc1000b
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8c700001
+	.word	0x9cd00001
+	.word	0x8de00006
+	.word	0x8dd00001
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d00003
+	.word	0x8de00006
+	.word	0x8cd00001
+	.word	0x9dc00002
+	.word	0x81e00006
+	.word	0x87e00000
+	.word	0x8ae00001
+	.word	0x8be00002
+	.word	0x8ce00003
+	.word	0x8de00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30002
+	.word	0x9ce00000
+	.word	0x9de00001
+	.word	0x8de00002
+	.word	0x3c0effff
+	.word	0x1ccdfffb
+	.word	0x1d1000c
+	.word	0x8ce00000
+	.word	0x8de00001
+	.word	0x1ee10002
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8d000722
+	.word	0xd01000d
+	.word	0x2dd90000
+	.word	0xb0d0001c
+	.word	0x8de00006
+	.word	0xd01000d
+	.word	0x9de00005
+	.word	0x8c000722
+	.word	0xc01000c
+	.word	0x2dd5000c
+	.word	0xb0d00015
+	.word	0x90e00000
+	.word	0x60000877
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x8ce00005
+	.word	0x2dc7000d
+	.word	0xb0d0000e
+	.word	0x8de00006
+	.word	0x9de00000
+	.word	0x6000080e
+	.word	0xc010001
+	.word	0xd01000d
+	.word	0x8cc00004
+	.word	0xc01000c
+	.word	0x2ddb000c
+	.word	0xb0d00002
+	.word	0x17010001
+	.word	0x4000083c
+	.word	0x7010000
+	.word	0x1010007
+	.word	0x4000083f
+	.word	0x1010000
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x97e00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x9fe00004
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x60000819
+	.word	0xd010001
+	.word	0x2dd80000
+	.word	0xb0d00020
+	.word	0x8de00007
+	.word	0x9de00000
+	.word	0x6000080e
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x1d010001
+	.word	0x9d700003
+	.word	0x8d700002
+	.word	0x9de00006
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00009
+	.word	0x8de00006
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00005
+	.word	0x8d700002
+	.word	0x9de00000
+	.word	0x600007d9
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x8d700001
+	.word	0x9de00005
+	.word	0xc01000d
+	.word	0x2dc90000
+	.word	0xb0d00006
+	.word	0x8de00005
+	.word	0x8dd00003
+	.word	0x2dd80000
+	.word	0xb0d00002
+	.word	0x97e00000
+	.word	0x600007d9
+	.word	0x87e00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x8fe00004
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x1ee30004
+	.word	0x9de00002
+	.word	0x9fe00003
+	.word	0x8d000876
+	.word	0xd01000d
+	.word	0x2ddb0000
+	.word	0xb0d00001
+	.word	0x40000884
+	.word	0x8de00004
+	.word	0x2dda0000
+	.word	0xb0d00002
+	.word	0x81000876
+	.word	0x4000088c
+	.word	0x1d010032
+	.word	0x9de00000
+	.word	0x8de00004
+	.word	0x9de00001
+	.word	0x60000702
+	.word	0xd010001
+	.word	0x9d000876
+	.word	0x101000d
+	.word	0x8de00002
+	.word	0x8fe00003
+	.word	0x1ee10004
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0xd7
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000702
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x1ee30005
+	.word	0x97e00000
+	.word	0x9be00001
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x87e00005
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8dd00000
+	.word	0x2dda0000
+	.word	0xb0dffffa
+	.word	0x8de00005
+	.word	0x3c0effff
+	.word	0x1ccdffff
+	.word	0xdd1000c
+	.word	0x9de00005
+	.word	0x8de00005
+	.word	0xd01000d
+	.word	0xc010007
+	.word	0xdd3000c
+	.word	0xd01000d
+	.word	0xd01000d
+	.word	0x9de00004
+	.word	0x8de00007
+	.word	0x8ce00004
+	.word	0xdd3000c
+	.word	0x9de00007
+	.word	0x8de00007
+	.word	0x2ddb0000
+	.word	0xb0d0000a
+	.word	0x1010007
+	.word	0x400008ec
+	.word	0x8de00005
+	.word	0x1cd10001
+	.word	0x9ce00005
+	.word	0x8ce00006
+	.word	0x1bc10001
+	.word	0x9be00006
+	.word	0x8cc00000
+	.word	0x9cd00000
+	.word	0x8de00006
+	.word	0x8dd00000
+	.word	0x2dd80000
+	.word	0xb0d00006
+	.word	0x8de00007
+	.word	0x1c010001
+	.word	0xcd3000c
+	.word	0x9ce00007
+	.word	0x2ddb0000
+	.word	0xb0dfffee
+	.word	0x8de00005
+	.word	0x90d00000
+	.word	0x1010007
+	.word	0x87e00000
+	.word	0x8be00001
+	.word	0x8ce00002
+	.word	0x8de00003
+	.word	0x1ee10005
+	.word	0x50f00000
+	.word	0x1f
+	.word	0x1c
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+	.word	0x6c
+	.word	0x73
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x6c
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x61
+	.word	0x5d
+	.word	0x20
+	.word	0x5b
+	.word	0x2d
+	.word	0x68
+	.word	0x5d
+	.word	0x20
+	.word	0x46
+	.word	0x4f
+	.word	0x4c
+	.word	0x44
+	.word	0x45
+	.word	0x52
+	.word	0xa
+	.word	0x0
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x20
+	.word	0x0
+	.word	0x0
+	.word	0x6f
+	.word	0x70
+	.word	0x65
+	.word	0x6e
+	.word	0x64
+	.word	0x69
+	.word	0x72
+	.word	0x0
+	.word	0x2e
+	.word	0x0
+	.word	0x2f
+	.word	0x0
+	.word	0x25
+	.word	0x30
+	.word	0x32
+	.word	0x64
+	.word	0x2f
+	.word	0x25
+	.word	0x30
+	.word	0x32
+	.word	0x64
+	.word	0x2f
+	.word	0x25
+	.word	0x30
+	.word	0x34
+	.word	0x64
+	.word	0x20
+	.word	0x25
+	.word	0x30
+	.word	0x32
+	.word	0x64
+	.word	0x3a
+	.word	0x25
+	.word	0x30
+	.word	0x32
+	.word	0x64
+	.word	0x3a
+	.word	0x25
+	.word	0x30
+	.word	0x32
+	.word	0x64
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x0
+	.word	0x25
+	.word	0x35
+	.word	0x64
+	.word	0x20
+	.word	0x0
+	.word	0x25
+	.word	0x32
+	.word	0x64
+	.word	0x2e
+	.word	0x25
+	.word	0x2e
+	.word	0x33
+	.word	0x64
+	.word	0x4b
+	.word	0x42
+	.word	0x20
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x25
+	.word	0x32
+	.word	0x64
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0x20
+	.word	0x0
+	.word	0x72
+	.word	0x6f
+	.word	0x6f
+	.word	0x74
+	.word	0x0
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x8000007e
+	.word	0x68
+	.word	0x19960503
+	.word	0x40a
+	.word	0x1000
+	.word	0x274
+	.word	0x254
+	.word	0x20
+	.word	0x240
+	.word	0x2f
+	.word	0x2e
+	.word	0x68
+	.word	0x69
+	.word	0x73
+	.word	0x74
+	.word	0x6f
+	.word	0x72
+	.word	0x79
+	.word	0x0
+	.word	0x1ee30008
+	.word	0x96e00004
+	.word	0x97e00005
+	.word	0x9de00006
+	.word	0x9fe00007
+	.word	0x1d010016
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0xcd000400
+	.word	0x9de00002
+	.word	0x60000482
+	.word	0xd010001
+	.word	0x601000d
+	.word	0x2d660000
+	.word	0xb0d0000d
+	.word	0xcd000400
+	.word	0x9de00000
+	.word	0x60000440
+	.word	0x11010001
+	.word	0x40000438
+	.word	0x1d010018
+	.word	0x9de00000
+	.word	0x1d010001
+	.word	0x9de00001
+	.word	0xcd00049d
+	.word	0x9de00002
+	.word	0x97e00003
+	.word	0x60000482
+	.word	0x1d010017
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0xcd00049d
+	.word	0x9de00002
+	.word	0x1d010080
+	.word	0x9de00003
+	.word	0x60000482
+	.word	0xd010001
+	.word	0x701000d
+	.word	0x2dd20000
+	.word	0xb0dfffec
+	.word	0x1d010019
+	.word	0x9de00000
+	.word	0x96e00001
+	.word	0x60000482
+	.word	0x1010000
+	.word	0x86e00004
+	.word	0x87e00005
+	.word	0x8de00006
+	.word	0x8fe00007
+	.word	0x1ee10008
+	.word	0x50f00000
+	.word	0x11e10000
+	.word	0x50f00000
+	.word	0x1ee30007
+	.word	0x9ce00004
+	.word	0x9de00005
+	.word	0x9fe00006
+	.word	0x6000043e
+	.word	0xd010001
+	.word	0xd01000d
+	.word	0x1ddc000a
+	.word	0x1dda000a
+	.word	0x1c010001
+	.word	0xdd1000c
+	.word	0xd01000d
+	.word	0x8dd00000
+	.word	0xd01000d
+	.word	0x9de00000
+	.word	0x60000484
+	.word	0xd010001
+	.word	0x8c00046b
+	.word	0x9ce00000
+	.word	0xcc000495
+	.word	0x9ce00001
+	.word	0x8ce00007
+	.word	0x9ce00002
+	.word	0x9de00003
+	.word	0x60000470
+	.word	0x8ce00004
+	.word	0x8de00005
+	.word	0x8fe00006
+	.word	0x1ee10007
+	.word	0x50f00000
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x1
+	.word	0x800
+	.word	0x80000004
+	.word	0x2
+	.word	0x2
+	.word	0x800
+	.word	0x80000003
+	.word	0x2c
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000f
+	.word	0x9de00000
+	.word	0x8de00006
+	.word	0x9de00001
+	.word	0x8de00007
+	.word	0x9de00002
+	.word	0x1de10008
+	.word	0x9de00003
+	.word	0x60000482
+	.word	0xd010001
+	.word	0x101000d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x200d0000
+	.word	0x50f00000
+	.word	0x1ee30006
+	.word	0x9de00004
+	.word	0x9fe00005
+	.word	0x1d01000e
+	.word	0x9de00000
+	.word	0x1d010010
+	.word	0x9de00001
+	.word	0xcd00051d
+	.word	0x9de00002
+	.word	0x8de00006
+	.word	0x9de00003
+	.word	0x60000482
+	.word	0xc100051d
+	.word	0x8de00004
+	.word	0x8fe00005
+	.word	0x1ee10006
+	.word	0x50f00000
+	.word	0x25
+	.word	0x73
+	.word	0x3a
+	.word	0x20
+	.word	0x25
+	.word	0x73
+	.word	0xa
+	.word	0x80002b5d
+.bss
+.global	DISK_RAW
+DISK_RAW:
+	.space	40960
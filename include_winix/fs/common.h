@@ -15,6 +15,10 @@
 #define DISK_SIZE               (DISK_PAGE_NR * BLOCK_SIZE)
 #define DISK_SIZE_DWORD         (DISK_PAGE_NR * BLOCK_SIZE_DWORD)
 
+/* number of blocks or inodes tracked by one block of bitmap */
+#define BITMAP_BITS_PER_BLOCK   (BLOCK_SIZE_DWORD * 32)
+#define DIV_ROUND_UP(n, d)      (((n) + (d) - 1) / (d))
+
 #define INODE_NUM   496
 #define NR_TZONES   8
 
@@ -39,7 +43,25 @@
 extern unsigned int start_unix_time;
 #define get_unix_time()         (start_unix_time + (get_uptime() / HZ))
 
-extern char DISK_RAW[DISK_SIZE];
+/*
+ * Disk image records produced by fsutil, see disk_rle_expand().
+ * Runs of zero words shorter than DISK_RLE_MIN_RUN are stored as literals
+ */
+#define DISK_RLE_ZERO_RUN       (0x80000000)
+#define DISK_RLE_MIN_RUN        (3)
+
+/*
+ * The disk size is decided when the image is made, DISK_SIZE is only the
+ * default. DISK_RAW_SIZE is the actual size of DISK_RAW in chars
+ */
+#ifdef FSUTIL
+extern char *DISK_RAW;
+#else
+extern char DISK_RAW[];
+extern unsigned int DISK_RLE[];
+extern unsigned int DISK_RLE_LEN;
+#endif
+extern unsigned int DISK_RAW_SIZE;
 
 #endif
 
@@ -10,6 +10,7 @@
 #include <kernel/proc.h>
 #include <stddef.h>
 #include <fs/type.h>
+#include <fs/super.h>
 #include <stdbool.h>
 
 int sys_open(struct proc *who, const char *path,int flags, mode_t mode);
@@ -47,7 +48,11 @@ int fill_dirent(inode_t* ino, struct winix_dirent* curr, const char* string);
 bool has_file_access(struct proc* who, struct inode* ino, mode_t mode);
 int get_inode_by_path(struct proc* who, const char *path, struct inode** inode);
 int alloc_block(inode_t *ino, struct device* id);
-int makefs( char* disk_raw, size_t disk_size_words);
+int makefs(char* disk_raw, const struct fs_geometry* geometry);
+int disk_rle_expand(unsigned int *dst, size_t dst_len, const unsigned int *src, size_t src_len);
+#ifdef FSUTIL
+int disk_rle_compress(unsigned int *dst, size_t dst_len, const unsigned int *src, size_t src_len);
+#endif
 void init_fs();
 int init_filp_by_inode(struct filp* filp, struct inode* inode);
 int init_inode_non_disk(struct inode* ino, ino_t num, struct device* dev, struct superblock* sb);
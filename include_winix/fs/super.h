@@ -28,6 +28,12 @@ struct superblock {
     char32_t s_name[SUPERBLOCK_NAME_LEN];
 };
 
+/* parameters given to makefs() */
+struct fs_geometry {
+    size_t disk_size;           /* in chars, rounded down to whole blocks */
+    unsigned int inode_ratio;   /* disk chars per inode, 0 for 3% of the disk */
+};
+
 void arch_superblock(struct superblock* sb);
 void dearch_superblock(struct superblock* sb);
 
@@ -14,12 +14,22 @@
 #ifndef _K_CLOCK_H_
 #define _K_CLOCK_H_ 1
 
+// The hardware timer runs at TIMER_FREQ, and goes off every TICK_COUNTS
+// timer counts
+#define TIMER_FREQ          2400
+#define TICK_COUNTS         (TIMER_FREQ / HZ)
+
 // System uptime, in ticks.
 clock_t get_uptime();
+// Timer counts from now until offset counts into tick, negative once passed.
+int get_hrtime_until(clock_t tick, int offset);
+int new_hrtimer(int procnr_from, struct timer* curr, clock_t counts, clock_t slack, timerhandler_t watchdog);
 
 extern clock_t next_timeout;
 
 void clock_handler();
+void stop_tick();
+void restart_tick();
 void sys_alarm(struct proc *who, struct message *m);
 extern void deliver_alarm(int procnr, clock_t time);
 void wakeup_process(int procnr, clock_t time);
@@ -29,8 +29,14 @@ void preempt_currproc();
 void reset_irq_count();
 
 #define in_interrupt()  (irq_count())
+#ifdef FSUTIL
+// no timer to mask on the host
+#define enable_interrupt()
+#define disable_interrupt()
+#else
 #define enable_interrupt()  RexTimer->Ctrl = 3
 #define disable_interrupt() RexTimer->Ctrl = 0
+#endif
 #define EXCEPTION_STACK_SIZE    (PAGE_LEN - 1)
 void register_irq(int irq, expt_handler_t handler);
 void trigger_gpf(struct proc* who);
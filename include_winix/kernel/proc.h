@@ -21,12 +21,14 @@
 #include <sys/ucontext.h>
 #include <winix/type.h>
 #include <winix/comm.h>
+#include <sys/ipc.h>
 #include <winix/timer.h>
 #include <winix/kwramp.h>
 #include <fs/type.h>
 #include <fs/inode.h>
 #include <fs/filp.h>
 #include <winix/welf.h>
+#include <sys/sched.h>
 #include <stdbool.h>
 
 // Init
@@ -40,17 +42,29 @@
 #define PARALLEL                    -1
 #define SYSTEM                      0
 
-// Number of User procs
+// Number of User procs in the process table at boot
 #define NUM_PROCS               	9
 
-// Total number of procs
+// Total number of procs at boot
 #define NUM_PROCS_AND_TASKS         (NUM_TASKS + NUM_PROCS)
 
+// Once the boot table is used up, user procs are added PROC_CHUNK at a
+// time, see grow_proc_table()
+#define PROC_CHUNK                  8
+#define MAX_PROC_CHUNKS             32
+#define MAX_PROCS                   (NUM_PROCS + PROC_CHUNK * MAX_PROC_CHUNKS)
+
+// Buckets of the pid and process group hash tables, a power of two
+#define PID_HASH_SIZE               64
+#define PID_HASH(pid)               ((pid) & (PID_HASH_SIZE - 1))
+
 // Scheduling
-#define NUM_QUEUES              	5
-#define MAX_PRIORITY            	4
+#define NUM_QUEUES              	6
+#define MAX_PRIORITY            	5
 #define MIN_PRIORITY            	0
 #define DEFAULT_PRIORITY            3
+#define USER_MAX_PRIORITY           4           /* only reached by waking up with sleep credit */
+#define USER_MIN_PRIORITY           1           /* the queues below are left to IDLE and PARALLEL */
 
 // Max string len for a process name 
 //(including NULL terminator)
@@ -101,6 +115,7 @@
 #define DIRECT_SYSCALL              0x0004      /* Direct Syscall mode */
 #define PROC_SIGAL_HANDLER          0x0008      /* process is in signal handler */
 #define PROC_NO_GPF                 0x0010      /* Do not generate GPF info for this process */
+#define PROC_SLEEPING               0x0020      /* blocked receiving or waiting, see age_proc() */
 
 
 struct k_context{
@@ -134,6 +149,8 @@ typedef struct proc {
     ptr_t* heap_top;                // 
     ptr_t* heap_break;             	// Heap_break is also the physical address of the curr
     ptr_t* heap_bottom;         	// Bottom of the process image
+    ptr_t* heap_end;                // End of the reserved heap, each page past heap_bottom
+                                    // is claimed on first touch
 
     size_t rbase_offset;
     size_t text_size;
@@ -149,13 +166,24 @@ typedef struct proc {
     struct proc *next_sender;     	// Link to next sender in the queue
 
     /* Pending messages, used by winix_notify */
-    unsigned int notify_pending;	// bitmap for masking list of pending messages by system proc
+    struct list_head notify_q;      // user procs whose notification is not yet received
+    struct list_head notify_link;   // link in the notify_q of the destination
+    int notify_dest;                // destination notify_link is queued on
+    struct message notify_mesg;     // copy of the queued notification
 
     /* Scheduling */
     struct proc *next;            	// Next pointer
     int priority;                	// Priority
     int quantum;                	// Timeslice length
     int ticks_left;                	// Timeslice remaining
+    unsigned int sched_epoch;       // Epoch the priority was last aged in, see age_proc()
+    clock_t sleep_start;            // When the process last blocked
+    int sleep_credit;               // Ticks slept and not yet paid back in priority
+    int sched_policy;               // SCHED_OTHER or SCHED_STRIDE
+    int nice;                       // -NZERO to NZERO - 1
+    unsigned int stride;            // Pass advanced per tick under SCHED_STRIDE
+    unsigned int pass;              // Virtual time under SCHED_STRIDE
+    clock_t sched_charged;          // Part of time_used already charged, see charge_proc()
 
     /* Accounting */
     clock_t time_used;            	// CPU time used
@@ -177,6 +205,11 @@ typedef struct proc {
     int woptions;                   // waiting options
     int parent;                    	// proc_index of parent
     int thread_parent;              // proc_index of parent whom share the memory except stack
+    int nr_threads;                 // threads sharing the memory of this process
+    struct list_head children;      // children of this process, linked by sibling
+    struct list_head sibling;       // link in the children of the parent, or free slots
+    struct list_head pid_link;      // link in pid_hash, see link_proc()
+    struct list_head pgrp_link;     // link in pgrp_hash, by procgrp
     int flags;                	    // information flags
     clock_t syscall_start_time;
 
@@ -191,7 +224,11 @@ typedef struct proc {
 
     /* Alarm */
     struct timer timer;
-    clock_t timer_interval;
+    clock_t timer_interval;         // in timer counts, see TIMER_FREQ
+    clock_t timer_slack;            // in timer counts, see prctl(2)
+
+    /* Syscall rings */
+    vptr_t* uring;                  // struct uring registered by uring_setup(2)
 
     /* File System */
     mode_t umask;
@@ -213,11 +250,16 @@ extern struct proc *curr_syscall_caller;
 
 extern struct proc *proc_table;
 extern struct proc *ready_q[NUM_QUEUES][2];
+extern struct proc *stride_q;
+extern unsigned int ready_map;
 extern struct proc *block_q[2];
+extern int nr_proc_slots;
+extern struct list_head pid_hash[PID_HASH_SIZE];
+extern struct list_head pgrp_hash[PID_HASH_SIZE];
 
 #define SYSTEM_TASK                     (proc_table)
 
-#define IS_PROCN_OK(i)                  ((i)> -NUM_TASKS && (i) <= NUM_PROCS)
+#define IS_PROCN_OK(i)                  ((i)> -NUM_TASKS && (i) <= nr_proc_slots)
 #define IS_PRIORITY_OK(priority)        (0 <= (priority) && (priority) < NUM_QUEUES)
 #define IS_KERNEL_PROC(p)               ((p)->ctx.rbase == NULL)
 #define IS_KERNELN(n)                   ((n)<= 0 && (n)> -NUM_TASKS)
@@ -243,25 +285,31 @@ extern struct proc *block_q[2];
 
 
 // proc_table points at index zero of the process table, so proc_table + INIT
-// simply starts at init
+// simply starts at init. Slots past the boot table are in chunks, which
+// next_proc_slot() steps into
 #define foreach_proc(curr)\
-for(curr = proc_table + INIT; curr <= proc_table + NUM_PROCS ; curr++)\
+for(curr = proc_table + INIT; curr; curr = next_proc_slot(curr))\
     if(IS_INUSE(curr))
 
 #define foreach_ktask(curr)\
     for(curr = proc_table - NUM_TASKS + 1 ; curr <= proc_table ; curr++)\
 
 #define foreach_proc_and_task(curr)\
-for(curr = proc_table - NUM_TASKS + 1; curr <= proc_table + NUM_PROCS; curr++)\
+for(curr = proc_table - NUM_TASKS + 1; curr; curr = next_proc_slot(curr))\
     if(IS_INUSE(curr))
 
 #define foreach_blocked_proc(curr)\
-for(curr = proc_table + 1; curr <= proc_table + NUM_PROCS; curr++)\
+for(curr = proc_table + 1; curr; curr = next_proc_slot(curr))\
     if(IS_INUSE(curr) && curr->state > 0)
 
 #define foreach_child(curr, parent_proc)\
-for(curr = proc_table + 1; curr <= proc_table + NUM_PROCS; curr++)\
-    if(IS_INUSE(curr) && (curr)->parent == (parent_proc)->proc_nr)
+    list_for_each_entry(struct proc, curr, &(parent_proc)->children, sibling)
+
+// members of process group pgid, and other groups sharing its hash chain
+// are skipped
+#define foreach_pgrp_member(curr, pgid)\
+    list_for_each_entry(struct proc, curr, &pgrp_hash[PID_HASH(pgid)], pgrp_link)\
+        if((curr)->procgrp == (pgid))
 
 
 void* get_pc_ptr(struct proc* who);
@@ -274,11 +322,18 @@ reg_t* alloc_stack(struct proc *who);
 void set_proc(struct proc *p, void (*entry)(), const char *name);
 struct proc *start_user_proc(size_t *lines, size_t length, size_t entry, int priority, const char *name);
 struct proc *get_free_proc_slot();
+struct proc *next_proc_slot(struct proc* curr);
+void release_proc_slot(struct proc *p);
 void enqueue_schedule(struct proc* p);
+void enqueue_schedule_head(struct proc* p);
 reg_t* alloc_kstack(struct proc *who, int size);
 int proc_memctl(struct proc* who ,vptr_t* page_addr, bool has_access);
 pid_t get_next_pid();
 struct proc* get_proc_by_pid(pid_t pid);
+void link_proc(struct proc* child, struct proc* parent);
+void unlink_proc(struct proc* who);
+void set_proc_pgrp(struct proc* who, pid_t pgid);
+void reparent_children(struct proc* who, struct proc* new_parent);
 struct proc *get_proc(int proc_nr);
 struct proc *get_non_zombie_proc(int proc_nr);
 void kreport_all_procs(struct filp*);
@@ -289,7 +344,8 @@ void release_zombie(struct proc*p);
 int copyto_user_stack(struct proc *who, void *src, size_t len);
 vptr_t* copyto_user_heap(struct proc* who, void *src, size_t len);
 int build_initial_stack(struct proc* who, char** argv, char** env, struct proc* srcproc);
-int exec_welf(struct proc* who, const char* path, char *argv[], char *envp[], bool is_new);
+int exec_welf(struct proc* who, const char* path, char *argv[], char *envp[], struct proc* from);
+int copy_pcb(struct proc* parent, struct proc* child);
 int release_proc_mem(struct proc *who);
 bool peek_mem_welf(struct winix_elf* elf, int stack_size, int heap_size);
 int alloc_mem_welf(struct proc* who, struct winix_elf* elf, int stack_size, int heap_size);
@@ -297,11 +353,11 @@ void task_exit();
 void exit_proc(struct proc *who, int status, int signum);
 int check_waiting(struct proc* who);
 int dequeue_schedule( struct proc *h);
+struct proc *dequeue_highest();
 int copy_from_user(struct proc* who, void *dest, vptr_t *src, size_t len);
 int copy_to_user(struct proc* who, vptr_t *dest, void *src, size_t len);
 bool validate_welf(struct winix_elf* elf);
 
-#define release_proc_slot(p)        release_zombie(p)
 #define exit_signal(who, signum)    exit_proc(who, 128, signum)
 
 #endif
@@ -1,10 +1,31 @@
 #ifndef _K_SCHED_H_
 #define _K_SCHED_H_ 1
 
-#define REBALANCE_TIMEOUT   (36)
+#define REBALANCE_TIMEOUT   (HZ * 2)
+
+// quantum of user processes doubles at each lower priority,
+// DEFAULT_USER_QUANTUM at DEFAULT_PRIORITY
+#define LEVEL_QUANTUM(priority) ((DEFAULT_USER_QUANTUM << DEFAULT_PRIORITY) >> (priority))
+
+// sleep credit is capped, so a long sleep is not a licence to hog the cpu
+#define MAX_SLEEP_CREDIT    (LEVEL_QUANTUM(USER_MIN_PRIORITY) * 2)
+
+// SCHED_STRIDE processes advance their pass by STRIDE1 / weight for each
+// tick they run, the SCHED_OTHER class as a whole weighs as much as one
+// nice 0 process
+#define STRIDE1             (1 << 22)
+#define NICE_0_WEIGHT       1024
+
+// wraparound safe comparison of passes
+#define PASS_BEFORE(a, b)   ((int)((a) - (b)) < 0)
 
 void init_sched();
 void rebalance_queues(int proc_nr, clock_t time);
+void age_proc(struct proc* who);
+void set_user_priority(struct proc* who, int priority);
+void set_nice(struct proc* who, int nice);
+void set_sched_policy(struct proc* who, int policy);
+void yield_stride(struct proc* who);
 void sched();
 struct proc *pick_proc();
 void set_bill_ptr(struct proc* who);
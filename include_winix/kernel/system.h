@@ -35,6 +35,7 @@ void init_syscall_table();
 bool is_in_syscall(struct proc* who);
 ptr_t* sys_sbrk(struct proc *who, int size);
 void set_syscall_mesg_exception(int operation, ptr_t* sp, struct message *m, struct proc* who);
+int resolve_syscall_args(int operation, struct message *m, struct proc* who);
 int set_syscall_reply(struct proc* who, int ret, int syscall_num);
 int curr_syscall_num();
 int sys_kill(struct proc* who, pid_t pid, int signum);
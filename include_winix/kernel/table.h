@@ -88,6 +88,14 @@ int do_tfork(struct proc* who, struct message* m);
 int do_sched_yield(struct proc* who, struct message* m);
 int do_setitimer(struct proc* who, struct message* m);
 int do_rmdir(struct proc* who, struct message* m);
+int do_spawn(struct proc* who, struct message* m);
+int do_setpriority(struct proc* who, struct message* m);
+int do_getpriority(struct proc* who, struct message* m);
+int do_sched_setscheduler(struct proc* who, struct message* m);
+int do_sched_getscheduler(struct proc* who, struct message* m);
+int do_prctl(struct proc* who, struct message* m);
+int do_uring_setup(struct proc* who, struct message* m);
+int do_uring_enter(struct proc* who, struct message* m);
 
 
 #endif
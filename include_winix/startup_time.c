@@ -0,0 +1,2 @@
+unsigned int start_unix_time=1792352924;
+
@@ -0,0 +1,3 @@
+.global	start_unix_time
+start_unix_time:
+	.word	0x6ad5229c
@@ -0,0 +1,18 @@
+#ifndef _SYS_PRCTL_H_
+#define _SYS_PRCTL_H_ 1
+
+#include <sys/syscall.h>
+
+/* how late, in nanoseconds, the timers of the process may go off */
+#define PR_SET_TIMERSLACK   29
+#define PR_GET_TIMERSLACK   30
+
+int prctl(int option, unsigned long arg);
+
+#if defined(__wramp__) & !defined(LINTING) && !defined(_SYSTEM)
+
+#define prctl(option, arg)                  wramp_syscall(PRCTL, option, arg)
+
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef _SYS_RESOURCE_H_
+#define _SYS_RESOURCE_H_ 1
+
+#include <sys/types.h>
+#include <sys/syscall.h>
+
+#define PRIO_PROCESS        0
+#define PRIO_PGRP           1
+#define PRIO_USER           2
+
+/* nice values range from -NZERO to NZERO - 1 */
+#define NZERO               20
+
+int getpriority(int which, int who);
+int setpriority(int which, int who, int prio);
+
+#if defined(__wramp__) & !defined(LINTING) && !defined(_SYSTEM)
+
+#define setpriority(which, who, prio)       wramp_syscall(SETPRIORITY, which, who, prio)
+
+#endif
+
+#endif
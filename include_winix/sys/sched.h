@@ -0,0 +1,12 @@
+#ifndef _SYS_SCHED_H_
+#define _SYS_SCHED_H_ 1
+
+/* scheduling policies */
+#define SCHED_OTHER         0   /* multi-level feedback queue, the default */
+#define SCHED_STRIDE        1   /* proportional share, weighted by the nice value */
+
+struct sched_param{
+    int sched_priority;         /* must be 0, no policy has static priorities */
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef _SYS_SPAWN_H_
+#define _SYS_SPAWN_H_ 1
+
+#include <sys/types.h>
+#include <signal.h>
+
+#define SPAWN_ACTIONS_MAX       (8)
+
+/* file actions applied to the child, in the order they are added */
+#define SPAWN_OPEN              1
+#define SPAWN_CLOSE             2
+#define SPAWN_DUP2              3
+
+#define POSIX_SPAWN_SETPGROUP   0x01
+#define POSIX_SPAWN_SETSIGDEF   0x02
+#define POSIX_SPAWN_SETSIGMASK  0x04
+#define POSIX_SPAWN_TCSETPGROUP 0x08
+
+struct spawn_action{
+    int type;
+    int fd;
+    int newfd;              // target of dup2
+    const char *path;       // path of open, must stay valid until spawned
+    int flags;
+    mode_t mode;
+};
+
+typedef struct{
+    int nr_actions;
+    struct spawn_action actions[SPAWN_ACTIONS_MAX];
+} posix_spawn_file_actions_t;
+
+typedef struct{
+    int flags;
+    pid_t pgroup;           // 0 puts the child in a new group of its own
+    sigset_t sigdefault;
+    sigset_t sigmask;
+    int tty_fd;             // tty whose foreground group becomes pgroup
+} posix_spawnattr_t;
+
+/**
+ * Argument of the SPAWN syscall, built by posix_spawn()
+ */
+struct spawn_request{
+    const char *path;
+    char *const *argv;
+    char *const *envp;
+    posix_spawn_file_actions_t actions;
+    posix_spawnattr_t attr;
+};
+
+#endif
@@ -16,7 +16,7 @@
 #ifndef _SYSCALL_H_
 #define _SYSCALL_H_ 1
 
-#define _NSYSCALL               57
+#define _NSYSCALL               65
 /**
  * System Call Numbers
  **/
@@ -77,6 +77,14 @@
 #define SCHED_YIELD     54
 #define SETITIMER       55
 #define RMDIR           56
+#define SPAWN           57
+#define SETPRIORITY     58
+#define GETPRIORITY     59
+#define SCHED_SETSCHEDULER  60
+#define SCHED_GETSCHEDULER  61
+#define PRCTL           62
+#define URING_SETUP     63
+#define URING_ENTER     64
 
 
 #define WINFO_PS                1
@@ -87,6 +95,18 @@
 #define WINFO_DEBUG_IPC         6
 #define WINFO_DEBUG_SCHEDULING  7
 #define WINFO_NO_GPF            8
+#define WINFO_KMALLOC_SITES     9
+
+/**
+ * kmalloc usage of one call site, returned by WINFO_KMALLOC_SITES
+ */
+struct kmalloc_site{
+    void *ra;           // return address of the kmalloc call
+    int nr_allocs;
+    int nr_frees;
+    int live;           // words currently allocated
+    int peak;           // highest value of live
+};
 
 int wramp_syscall(int num, ...);
 void *ptr_wramp_syscall(int num, ...);
@@ -0,0 +1,67 @@
+#ifndef _SYS_URING_H_
+#define _SYS_URING_H_ 1
+
+#include <sys/syscall.h>
+
+/* entries of each ring, a power of two */
+#define URING_ENTRIES       32
+#define URING_MASK          (URING_ENTRIES - 1)
+
+/**
+ * a system call queued on the submission ring. opcode is the syscall
+ * number, and args are passed the way wramp_syscall() passes them.
+ * Only read, write, lseek, close, stat and fstat can be queued
+ */
+struct uring_sqe{
+    int opcode;
+    unsigned long args[3];
+    int user_data;          // copied to the completion
+};
+
+/**
+ * the result of a submission, the return value of the syscall,
+ * or a negative errno
+ */
+struct uring_cqe{
+    int res;
+    int user_data;
+};
+
+/**
+ * submission and completion rings shared by a process and the kernel.
+ * The process fills the sqe at sq_tail and advances sq_tail, uring_enter(2)
+ * runs the sqes from sq_head and adds their completions at cq_tail.
+ * The process advances cq_head once it has read a completion
+ */
+struct uring{
+    unsigned int sq_head, sq_tail;
+    unsigned int cq_head, cq_tail;
+    struct uring_sqe sqes[URING_ENTRIES];
+    struct uring_cqe cqes[URING_ENTRIES];
+};
+
+#define uring_sq_space(ring)        (URING_ENTRIES - ((ring)->sq_tail - (ring)->sq_head))
+#define uring_cq_ready(ring)        ((ring)->cq_tail - (ring)->cq_head)
+#define uring_next_sqe(ring)        (&(ring)->sqes[(ring)->sq_tail & URING_MASK])
+#define uring_next_cqe(ring)        (&(ring)->cqes[(ring)->cq_head & URING_MASK])
+
+#define uring_prep(sqe, op, arg0, arg1, arg2, data)\
+do{\
+    (sqe)->opcode = (op);\
+    (sqe)->args[0] = (unsigned long)(arg0);\
+    (sqe)->args[1] = (unsigned long)(arg1);\
+    (sqe)->args[2] = (unsigned long)(arg2);\
+    (sqe)->user_data = (data);\
+}while(0)
+
+int uring_setup(struct uring* ring);
+int uring_enter(unsigned int to_submit);
+
+#if defined(__wramp__) & !defined(LINTING) && !defined(_SYSTEM)
+
+#define uring_setup(ring)                   wramp_syscall(URING_SETUP, ring)
+#define uring_enter(to_submit)              wramp_syscall(URING_ENTER, to_submit)
+
+#endif
+
+#endif
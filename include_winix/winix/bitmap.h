@@ -23,6 +23,18 @@ struct bit_pattern{
     int size;
 };
 
+/**
+ * bitmap with a summary level, see hbitmap_init()
+ */
+struct hbitmap{
+    unsigned int *map;
+    int map_len;
+    unsigned int *full;     // bit set if the map word is all 1s
+    unsigned int *empty;    // bit set if the map word is all 0s
+};
+
+#define HBITMAP_SUMMARY_LEN(map_len)    (((map_len) + 31) / 32)
+
 #define set_bit(map,i)      ((map) |= (1 << (i)))
 #define unset_bit(map,i)    ((map) &= ~(1 << (i)))
 
@@ -38,7 +50,16 @@ int bitmap_set_nbits(unsigned int *map, int map_len,int start, int len);
 int bitmap_clear_bit(unsigned int *map, int map_len,int start);
 int bitmap_clear_nbits(unsigned int *map, int map_len,int start, int len);
 int bitmap_xor(unsigned int *map1, unsigned int *map2, int size_len);
+int bitmap_first_set(unsigned int word);
 int count_bits(unsigned int *map, int map_len, int flags);
+int hbitmap_init(struct hbitmap *hmap, unsigned int *map, int map_len,
+                    unsigned int *full, unsigned int *empty);
+int hbitmap_search_from(struct hbitmap *hmap, int start, int num);
+int hbitmap_search_reverse(struct hbitmap *hmap, int num);
+int hbitmap_set_bit(struct hbitmap *hmap, int start);
+int hbitmap_clear_bit(struct hbitmap *hmap, int start);
+int hbitmap_set_nbits(struct hbitmap *hmap, int start, int len);
+int hbitmap_clear_nbits(struct hbitmap *hmap, int start, int len);
 void _kreport_bitmap(unsigned int *p, int len, int (*func) (const char *, ...));
 #define kreport_bitmap(p, len) _kreport_bitmap(p, len, kprintf)
 
@@ -0,0 +1,33 @@
+/**
+ * Binary buddy page allocator
+*/
+#ifndef _W_BUDDY_H_
+#define _W_BUDDY_H_ 1
+
+#include <winix/list.h>
+#include <winix/bitmap.h>
+
+#define BUDDY_NR_ORDERS     16
+#define BUDDY_NOT_FREE      (-1)
+
+struct buddy_page{
+    struct list_head list;
+    int order;              // order of the free block headed by this page, or BUDDY_NOT_FREE
+};
+
+struct buddy_pool{
+    struct buddy_page *pages;
+    int nr_pages;
+    int max_order;
+    struct hbitmap *map;    // page bitmap, 1 if the page is used
+    struct list_head free_area[BUDDY_NR_ORDERS];
+    int nr_free[BUDDY_NR_ORDERS];
+};
+
+int buddy_init(struct buddy_pool *pool, struct buddy_page *pages, int nr_pages, struct hbitmap *map);
+int buddy_peek(struct buddy_pool *pool, int num, int flags);
+int buddy_alloc(struct buddy_pool *pool, int num, int flags);
+int buddy_alloc_at(struct buddy_pool *pool, int start, int num);
+int buddy_free(struct buddy_pool *pool, int start, int num);
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * Deferred page copies for fork
+*/
+#ifndef _W_COW_H_
+#define _W_COW_H_ 1
+
+#include <stdbool.h>
+
+#define COW_NONE        (-1)
+
+struct cow_table{
+    int *src;           // page whose content this page still waits for, or COW_NONE
+    int *refs;          // number of pages waiting for a copy of this page
+    int nr_pages;
+    void (*copy)(int dest, int src);
+};
+
+int cow_init(struct cow_table *table, int *src, int *refs, int nr_pages, void (*copy)(int dest, int src));
+int cow_share(struct cow_table *table, int dest, int src, int num);
+int cow_resolve(struct cow_table *table, int page);
+int cow_release(struct cow_table *table, int page);
+bool cow_is_pending(struct cow_table *table, int page);
+
+#endif
@@ -63,11 +63,11 @@ void INIT_LIST_HEAD(struct list_head *list);
  */
 void __list_add(struct list_head *new, struct list_head *prev, struct list_head *next);
 #define   __list_add(new, prevl, nextl) do{\
-\
-	(nextl)->prev = new;\
-	(new)->next = nextl;\
-	(new)->prev = prevl;\
-	WRITE_ONCE((prevl)->next, new);\
+	struct list_head *__new = (new), *__prev = (prevl), *__next = (nextl);\
+	__next->prev = __new;\
+	__new->next = __next;\
+	__new->prev = __prev;\
+	WRITE_ONCE(__prev->next, __new);\
 }while(0)
 
 /**
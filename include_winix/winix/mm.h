@@ -31,9 +31,14 @@ int release_pages(ptr_t* page, int num);
 int user_release_pages(struct proc* who, ptr_t* page, int len);
 ptr_t* user_get_free_pages(struct proc* who, int length, int flags);
 bool is_vaddr_ok(vptr_t* addr, size_t len, struct proc* who);
+bool is_pages_free_from(ptr_t* addr, int size);
 void add_free_mem(void* addr, size_t size);
 void kprint_slab();
+int get_free_pages_from(ptr_t* addr, int size);
 int user_get_free_pages_from(struct proc* who, ptr_t* addr, int size);
+bool resolve_user_page(struct proc* who, ptr_t* paddr);
+int resolve_user_pages(struct proc* who, vptr_t* addr, size_t len);
+int defer_copy_pages(ptr_t* dest, ptr_t* src, int len);
 
 #define is_vaddr_accessible(addr, who)  is_vaddr_ok((vptr_t*)addr, sizeof(vptr_t*), who)
 #define free_page(page)                 release_pages((page),PAGE_LEN)
@@ -15,8 +15,32 @@
 #define _W_SLAB_H_ 1
 
 #include <winix/gfp.h>
+#include <winix/list.h>
 #include <stddef.h>
 
+#define KMEM_CACHE_NR       16
+
+/**
+ * cache of fixed size objects, carved out of one page slabs
+ */
+struct kmem_cache{
+    const char *name;
+    size_t size;                    // object size
+    int objs_per_slab;
+    int nr_slabs;
+    int nr_active;                  // objects in use
+    struct list_head slabs_partial;
+    struct list_head slabs_full;
+    struct list_head slabs_free;
+};
+
+struct kmem_cache *kmem_cache_create(const char *name, size_t size);
+void *kmem_cache_alloc(struct kmem_cache *cache);
+void kmem_cache_free(struct kmem_cache *cache, void *ptr);
+
+struct kmalloc_site;
+int get_kmalloc_sites(struct kmalloc_site *buf, int len);
+
 void* kmalloc(size_t nitimes, size_t size);
 void kfree(void *ptr);
 
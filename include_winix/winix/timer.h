@@ -21,20 +21,31 @@
 typedef void (*timerhandler_t)(int,clock_t);
 
 #define TIMER_INUSE         1
-#define TIMER_NEVER       (LONG_MAX)  
+#define TIMER_HIRES         2   /* due offset timer counts into tick time_out */
+#define TIMER_NEVER       ((clock_t)LONG_MAX)
 
 struct timer{
     int proc_nr;
     clock_t time_out;
+    int offset;
+    clock_t hr_tick;        // due hr_offset timer counts into tick hr_tick,
+    int hr_offset;          // before slack is applied
     struct timer *next;
+    struct timer *prev;
+    int wheel_slot;         // slot of the timer wheel, see winix/timer.c
     timerhandler_t handler;
     int flags;
 };
 
+void init_timer();
 int new_timer(int from, struct timer* curr, clock_t timeout, timerhandler_t watchdog);
 void insert_timer(struct timer *timer);
-struct timer* dequeue_alarm();
+struct timer* dequeue_alarm(clock_t now);
 void remove_timer(struct timer *timer);
+void insert_split(struct timer *timer);
+int next_split();
+struct timer* dequeue_split(int elapsed);
+void slack_deadline(clock_t* tick, int* offset, clock_t slack);
 
 #endif
 
@@ -0,0 +1,1082 @@
+.global	shell_path
+shell_path:
+	.asciiz	"/bin/wsh"
+.global	shell_argv
+shell_argv:
+	.word	shell_path
+	.word	0x0
+.global	initial_env
+initial_env:
+	.word	L.3
+	.word	L.4
+	.word	0x0
+.global	block_signals
+.text
+block_signals:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$13, $sp, 7
+	sw	$13, 0($sp)
+	jal	sigfillset
+	addui	$13, $sp, 7
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	jal	sigdelset
+	addui	$13, $0, 19
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	lw	$13, 7($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addui	$7, $0, 1
+L.6:
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x1
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+L.7:
+	addi	$7, $7, 1
+	slti	$13, $7, 21
+	bnez	$13, L.6
+L.5:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	init_system
+init_system:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 40
+	sw	$13, 0($sp)
+	addui	$13, $0, 511
+	sw	$13, 1($sp)
+	la	$13, L.11
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.14
+	addui	$7, $0, 1
+	j	L.15
+L.14:
+	addu	$7, $0, $0
+L.15:
+	sw	$7, 0($sp)
+	addui	$13, $0, 44
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+L.10:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	init_dev
+init_dev:
+	subui	$sp, $sp, 13
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addui	$13, $0, 40
+	sw	$13, 0($sp)
+	addui	$13, $0, 493
+	sw	$13, 1($sp)
+	la	$13, L.17
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.19
+	addui	$6, $0, 1
+	j	L.20
+L.19:
+	addu	$6, $0, $0
+L.20:
+	sw	$6, 0($sp)
+	addui	$13, $0, 52
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 40
+	sw	$13, 0($sp)
+	addui	$13, $0, 493
+	sw	$13, 1($sp)
+	la	$13, L.21
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.23
+	addui	$5, $0, 1
+	j	L.24
+L.23:
+	addu	$5, $0, $0
+L.24:
+	sw	$5, 0($sp)
+	addui	$13, $0, 55
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 40
+	sw	$13, 0($sp)
+	addui	$13, $0, 493
+	sw	$13, 1($sp)
+	la	$13, L.25
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.27
+	addui	$4, $0, 1
+	j	L.28
+L.27:
+	addu	$4, $0, $0
+L.28:
+	sw	$4, 0($sp)
+	addui	$13, $0, 58
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 28
+	sw	$13, 0($sp)
+	addui	$13, $0, 493
+	sw	$13, 1($sp)
+	la	$13, L.29
+	sw	$13, 2($sp)
+	addui	$13, $0, 769
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.31
+	addui	$3, $0, 1
+	j	L.32
+L.31:
+	addu	$3, $0, $0
+L.32:
+	sw	$3, 0($sp)
+	addui	$13, $0, 61
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 28
+	sw	$13, 0($sp)
+	addui	$13, $0, 493
+	sw	$13, 1($sp)
+	la	$13, L.33
+	sw	$13, 2($sp)
+	addui	$13, $0, 770
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.35
+	addui	$2, $0, 1
+	j	L.36
+L.35:
+	addu	$2, $0, $0
+L.36:
+	sw	$2, 0($sp)
+	addui	$13, $0, 64
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 28
+	sw	$13, 0($sp)
+	addui	$13, $0, 493
+	sw	$13, 1($sp)
+	la	$13, L.37
+	sw	$13, 2($sp)
+	addui	$13, $0, 257
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.39
+	addui	$13, $0, 1
+	sw	$13, 12($sp)
+	j	L.40
+L.39:
+	sw	$0, 12($sp)
+L.40:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 67
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+L.16:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	init_termios
+init_termios:
+	subui	$sp, $sp, 48
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	lw	$13, 48($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	addui	$13, $sp, 9
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.43
+	addui	$6, $0, 1
+	j	L.44
+L.43:
+	addu	$6, $0, $0
+L.44:
+	sw	$6, 0($sp)
+	addui	$13, $0, 75
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 59
+	sw	$13, 12($sp)
+	addui	$13, $0, 8448
+	sw	$13, 9($sp)
+	sw	$0, 10($sp)
+	addui	$13, $0, 128
+	sw	$13, 11($sp)
+	addui	$13, $0, 3
+	sw	$13, 14($sp)
+	addui	$13, $0, 28
+	sw	$13, 15($sp)
+	addui	$13, $0, 8
+	sw	$13, 16($sp)
+	addui	$13, $0, 21
+	sw	$13, 17($sp)
+	addui	$13, $0, 4
+	sw	$13, 18($sp)
+	addui	$13, $0, 17
+	sw	$13, 22($sp)
+	addui	$13, $0, 19
+	sw	$13, 23($sp)
+	addui	$13, $0, 26
+	sw	$13, 24($sp)
+	addui	$13, $0, 22
+	sw	$13, 29($sp)
+	addui	$13, $0, 23
+	sw	$13, 28($sp)
+	addui	$13, $0, 18
+	sw	$13, 26($sp)
+	sw	$0, 25($sp)
+	sw	$0, 30($sp)
+	sw	$0, 19($sp)
+	addui	$13, $0, 1
+	sw	$13, 20($sp)
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	lw	$13, 48($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	addui	$13, $sp, 9
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.78
+	addui	$5, $0, 1
+	j	L.79
+L.78:
+	addu	$5, $0, $0
+L.79:
+	sw	$5, 0($sp)
+	addui	$13, $0, 99
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+L.41:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 48
+	jr	$ra
+.global	init_tty
+init_tty:
+	subui	$sp, $sp, 16
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	addui	$13, $0, 46
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $0, 12
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $7, $13
+	bnez	$13, L.82
+	addui	$5, $0, 1
+	j	L.83
+L.82:
+	addu	$5, $0, $0
+L.83:
+	sw	$5, 0($sp)
+	addui	$13, $0, 107
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	la	$13, L.29
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sne	$13, $6, $0
+	bnez	$13, L.85
+	addui	$4, $0, 1
+	j	L.86
+L.85:
+	addu	$4, $0, $0
+L.86:
+	sw	$4, 0($sp)
+	addui	$13, $0, 109
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 34
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	snei	$13, $7, 1
+	bnez	$13, L.88
+	addui	$3, $0, 1
+	j	L.89
+L.88:
+	addu	$3, $0, $0
+L.89:
+	sw	$3, 0($sp)
+	addui	$13, $0, 111
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 34
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	snei	$13, $7, 2
+	bnez	$13, L.91
+	addui	$2, $0, 1
+	j	L.92
+L.91:
+	addu	$2, $0, $0
+L.92:
+	sw	$2, 0($sp)
+	addui	$13, $0, 113
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	addui	$12, $0, 18
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.94
+	addui	$13, $0, 1
+	sw	$13, 15($sp)
+	j	L.95
+L.94:
+	sw	$0, 15($sp)
+L.95:
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 115
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 21
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, pgid($0)
+	sw	$0, 0($sp)
+	lw	$13, pgid($0)
+	sw	$13, 1($sp)
+	jal	tcsetpgrp
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.97
+	addui	$13, $0, 1
+	sw	$13, 14($sp)
+	j	L.98
+L.97:
+	sw	$0, 14($sp)
+L.98:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 118
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	sw	$0, 0($sp)
+	jal	init_termios
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	la	$13, L.33
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	snei	$13, $6, 3
+	bnez	$13, L.100
+	addui	$13, $0, 1
+	sw	$13, 13($sp)
+	j	L.101
+L.100:
+	sw	$0, 13($sp)
+L.101:
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 123
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	sw	$6, 0($sp)
+	jal	init_termios
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+L.80:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.global	start_init_routine
+start_init_routine:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	jal	block_signals
+	j	L.104
+L.103:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	addui	$13, $sp, 7
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sne	$13, $7, $13
+	bnez	$13, L.106
+	j	L.105
+L.106:
+L.104:
+	j	L.103
+L.105:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.108
+	sw	$13, 1($sp)
+	jal	dprintf
+L.102:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	testlog_path
+testlog_path:
+	.asciiz	"/var/log/test.log"
+.data
+L.110:
+	.word	shell_path
+	.word	L.111
+	.word	L.112
+	.word	L.113
+	.word	L.114
+	.word	testlog_path
+	.word	0x0
+.global	run_unit_test
+.text
+run_unit_test:
+	subui	$sp, $sp, 17
+	sw	$8, 4($sp)
+	sw	$9, 5($sp)
+	sw	$10, 6($sp)
+	sw	$11, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$13, $sp, 10
+	la	$9, L.110
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	lw	$10, 5($9)
+	sw	$8, 4($13)
+	sw	$10, 5($13)
+	lw	$8, 6($9)
+	sw	$8, 6($13)
+	addui	$13, $0, 5
+	sw	$13, 0($sp)
+	la	$13, shell_path
+	sw	$13, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	la	$13, initial_env
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+L.109:
+	lw	$8, 4($sp)
+	lw	$9, 5($sp)
+	lw	$10, 6($sp)
+	lw	$11, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	wait_for_unit_test
+wait_for_unit_test:
+	subui	$sp, $sp, 75
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lw	$13, 75($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 74
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 74($sp)
+	srai	$13, $13, 8
+	andi	$5, $13, 255
+	seq	$13, $5, $0
+	bnez	$13, L.116
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.118
+	sw	$13, 1($sp)
+	sw	$5, 2($sp)
+	jal	dprintf
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	la	$13, testlog_path
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	j	L.120
+L.119:
+	addui	$13, $0, 24
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	wramp_syscall
+L.120:
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	addui	$13, $0, 64
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sgt	$13, $13, $0
+	bnez	$13, L.119
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+L.116:
+	sne	$13, $5, $0
+	bnez	$13, L.123
+	addui	$4, $0, 1
+	j	L.124
+L.123:
+	addu	$4, $0, $0
+L.124:
+	sw	$4, 0($sp)
+	addui	$13, $0, 170
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+L.115:
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 75
+	jr	$ra
+.global	run_shell
+run_shell:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 5
+	sw	$13, 0($sp)
+	la	$13, shell_path
+	sw	$13, 1($sp)
+	la	$13, shell_argv
+	sw	$13, 2($sp)
+	la	$13, initial_env
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+L.125:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	init_tty2_environment
+init_tty2_environment:
+	subui	$sp, $sp, 12
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addui	$13, $0, 46
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $0, 12
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $7, $13
+	bnez	$13, L.128
+	addui	$5, $0, 1
+	j	L.129
+L.128:
+	addu	$5, $0, $0
+L.129:
+	sw	$5, 0($sp)
+	addui	$13, $0, 181
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	la	$13, L.33
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sle	$13, $6, $0
+	bnez	$13, L.131
+	addui	$4, $0, 1
+	j	L.132
+L.131:
+	addu	$4, $0, $0
+L.132:
+	sw	$4, 0($sp)
+	addui	$13, $0, 184
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $0, 18
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.134
+	addui	$3, $0, 1
+	j	L.135
+L.134:
+	addu	$3, $0, $0
+L.135:
+	sw	$3, 0($sp)
+	addui	$13, $0, 187
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 21
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, pgid($0)
+	sw	$6, 0($sp)
+	lw	$13, pgid($0)
+	sw	$13, 1($sp)
+	jal	tcsetpgrp
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.137
+	addui	$2, $0, 1
+	j	L.138
+L.137:
+	addu	$2, $0, $0
+L.138:
+	sw	$2, 0($sp)
+	addui	$13, $0, 190
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addu	$1, $0, $6
+L.126:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	run_in_tty2
+run_in_tty2:
+	subui	$sp, $sp, 11
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sne	$13, $6, $0
+	bnez	$13, L.140
+	addui	$13, $0, 35
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.143
+	addui	$5, $0, 1
+	j	L.144
+L.143:
+	addu	$5, $0, $0
+L.144:
+	sw	$5, 0($sp)
+	addui	$13, $0, 200
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 35
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	snei	$13, $7, 1
+	bnez	$13, L.146
+	addui	$4, $0, 1
+	j	L.147
+L.146:
+	addu	$4, $0, $0
+L.147:
+	sw	$4, 0($sp)
+	addui	$13, $0, 202
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 35
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	snei	$13, $7, 2
+	bnez	$13, L.149
+	addui	$3, $0, 1
+	j	L.150
+L.149:
+	addu	$3, $0, $0
+L.150:
+	sw	$3, 0($sp)
+	addui	$13, $0, 204
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.152
+	addui	$2, $0, 1
+	j	L.153
+L.152:
+	addu	$2, $0, $0
+L.153:
+	sw	$2, 0($sp)
+	addui	$13, $0, 207
+	sw	$13, 1($sp)
+	la	$13, L.13
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 12($sp)
+	jalr	$13
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.140:
+	addu	$1, $0, $6
+L.139:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	main
+main:
+	subui	$sp, $sp, 7
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	jal	init_dev
+	jal	init_tty
+	jal	init_system
+	addui	$13, $0, 4
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.155
+	jal	run_shell
+L.155:
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.157
+	jal	init_tty2_environment
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	la	$13, run_unit_test
+	sw	$13, 1($sp)
+	jal	run_in_tty2
+	addu	$13, $0, $1
+	sw	$13, 5($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	wait_for_unit_test
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	la	$13, run_shell
+	sw	$13, 1($sp)
+	jal	run_in_tty2
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+L.157:
+	jal	start_init_routine
+	addu	$1, $0, $0
+L.154:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.bss
+.global	pgid
+pgid:
+	.space	1
+.extern	errlist 40
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.data
+L.118:
+	.asciiz	"Unit test failed, exit status %d\n"
+L.114:
+	.asciiz	">"
+L.113:
+	.asciiz	"run"
+L.112:
+	.asciiz	"test"
+L.111:
+	.asciiz	"-c"
+L.108:
+	.asciiz	"Shutting down...\n"
+L.37:
+	.asciiz	"/dev/sda"
+L.33:
+	.asciiz	"/dev/tty2"
+L.29:
+	.asciiz	"/dev/tty1"
+L.25:
+	.asciiz	"/var/log/"
+L.21:
+	.asciiz	"/var"
+L.17:
+	.asciiz	"/dev"
+L.13:
+	.asciiz	"init/init.c"
+L.11:
+	.asciiz	"/tmp"
+L.4:
+	.asciiz	"PATH=/bin"
+L.3:
+	.asciiz	"HOME=/"
@@ -27,12 +27,26 @@ PUBLIC clock_t next_timeout = 0;
 
 PRIVATE struct proc* bill_ptr;
 
+// The timer counts down at TIMER_FREQ, and is reloaded from its load register
+// once it reaches zero, which raises IRQ2
+// the timer counter is 16 bits wide
+#define MAX_IDLE_TICKS      (0xffff / TICK_COUNTS)
+
+// Uptime of the timer interrupt that ends the current idle period,
+// 0 while the timer ticks at HZ
+PRIVATE clock_t idle_deadline = 0;
+
+// Offset into the current tick at which the timer goes off next. This is
+// TICK_COUNTS unless a high resolution timer is due part way through the tick
+PRIVATE int count_base = TICK_COUNTS;
+
 void do_ticks(){
-    while(next_timeout <= system_uptime){
-        struct timer* next_timer = dequeue_alarm();
-        if(next_timer){
-            next_timer->handler(next_timer->proc_nr,next_timer->time_out);
-        }
+    struct timer* next_timer;
+
+    if(next_timeout > system_uptime)
+        return;
+    while((next_timer = dequeue_alarm(system_uptime))){
+        next_timer->handler(next_timer->proc_nr,next_timer->time_out);
     }
 }
 
@@ -44,6 +58,145 @@ clock_t get_uptime(){
     return system_uptime;
 }
 
+/**
+ * Timer counts elapsed in the current tick, see TIMER_FREQ
+ **/
+PRIVATE int get_tick_elapsed(){
+    int elapsed = count_base - RexTimer->Count;
+
+    return elapsed < 0 ? 0 : elapsed;
+}
+
+/**
+ * Timer counts from now until offset counts into the given tick, negative
+ * if that has passed. Times are kept as a tick and an offset rather than
+ * counts since boot, which would wrap after about 20 days
+ **/
+int get_hrtime_until(clock_t tick, int offset){
+    return (int)(tick - system_uptime) * TICK_COUNTS + offset - get_tick_elapsed();
+}
+
+/**
+ * Program the timer to go off when the first high resolution timer of the
+ * current tick is due, unless the tick ends first
+ **/
+PRIVATE void program_split(){
+    int target = next_split();
+    int elapsed;
+
+    if(target < 0)
+        return;
+    elapsed = count_base - RexTimer->Count;
+    if(target <= elapsed)
+        target = elapsed + 1;
+    // the timer goes off before then anyway
+    if(target >= count_base)
+        return;
+    RexTimer->Count = target - elapsed;
+    count_base = target;
+}
+
+PRIVATE void run_split_timers(int elapsed){
+    struct timer* next_timer;
+
+    while((next_timer = dequeue_split(elapsed))){
+        next_timer->handler(next_timer->proc_nr, next_timer->time_out);
+    }
+}
+
+/**
+ * Set a timer that goes off counts timer counts from now, the time is
+ * only rounded to the timer clock rather than to the next tick. It may go
+ * off up to slack counts late, to share the interrupt of other timers
+ * @param procnr_from
+ * @param curr
+ * @param counts
+ * @param slack
+ * @param watchdog
+ * @return 0 on success
+ */
+int new_hrtimer(int procnr_from, struct timer* curr, clock_t counts, clock_t slack, timerhandler_t watchdog){
+    if(counts <= 0 || (curr->flags & TIMER_INUSE))
+        return -EINVAL;
+
+    counts += get_tick_elapsed();
+    curr->hr_tick = system_uptime + counts / TICK_COUNTS;
+    curr->hr_offset = counts % TICK_COUNTS;
+    curr->time_out = curr->hr_tick;
+    curr->offset = curr->hr_offset;
+    slack_deadline(&curr->time_out, &curr->offset, slack);
+    curr->flags |= TIMER_INUSE | TIMER_HIRES;
+    curr->handler = watchdog;
+    curr->proc_nr = procnr_from;
+    curr->next = NULL;
+
+    if(curr->time_out > system_uptime){
+        insert_timer(curr);
+    }else{
+        disable_interrupt();
+        insert_split(curr);
+        program_split();
+        enable_interrupt();
+    }
+    return 0;
+}
+
+/**
+ * Stop the periodic tick while IDLE is the only runnable process. The timer
+ * is programmed to go off once at the next timer deadline instead, after
+ * which it reloads one tick and goes on ticking at HZ.
+ * 
+ * Side Effects:
+ *   the count register of the timer is set to the time until next_timeout
+ **/
+void stop_tick(){
+    clock_t ticks;
+
+    if(idle_deadline || next_timeout <= system_uptime || next_split() >= 0)
+        return;
+    ticks = next_timeout - system_uptime;
+    if(ticks > MAX_IDLE_TICKS)
+        ticks = MAX_IDLE_TICKS;
+    if(ticks <= 1)
+        return;
+
+    // the current tick is partly gone, it is kept as the first one
+    disable_interrupt();
+    RexTimer->Count += (ticks - 1) * TICK_COUNTS;
+    enable_interrupt();
+    idle_deadline = system_uptime + ticks;
+}
+
+/**
+ * Called on entry to every exception while the tick is stopped. The ticks
+ * that passed since the tick was stopped are worked out from the count
+ * left until the deadline, and the timer is set to tick again.
+ *
+ * NOTE: this method is called during exception context
+ *
+ * Side Effects:
+ *   system_uptime, and the time_used of IDLE, are brought up to date
+ **/
+void restart_tick(){
+    clock_t remaining, now;
+    int count;
+
+    if(!idle_deadline)
+        return;
+
+    // if IRQ2 is pending, the timer has just reloaded one tick, and
+    // clock_handler() counts that last tick
+    count = RexTimer->Count;
+    if(count <= 0)
+        count = TICK_COUNTS;
+    remaining = (count + TICK_COUNTS - 1) / TICK_COUNTS;
+    now = idle_deadline - remaining;
+    curr_scheduling_proc->time_used += now - system_uptime;
+    system_uptime = now;
+    RexTimer->Count = (count - 1) % TICK_COUNTS + 1;
+    idle_deadline = 0;
+}
+
 /**
  * Timer (IRQ2)
  *
@@ -52,13 +205,27 @@ clock_t get_uptime(){
  * This method is called for every timer interrupt
  * 
  * Side Effects:
- *   system_uptime is incremented
+ *   system_uptime is incremented, unless the interrupt was set for a high
+ *   resolution timer part way through the tick
  *   if there is an immediate timer, relevant handler is called
  *   scheduler is called (i.e. this handler does not return)
  **/
 void clock_handler(){
+    int elapsed;
+
     RexTimer->Iack = 0;
 
+    if(count_base < TICK_COUNTS){
+        // a high resolution timer is due part way through the tick, the
+        // timer is set to go off again at the end of the tick
+        elapsed = count_base;
+        count_base = TICK_COUNTS;
+        RexTimer->Count = TICK_COUNTS - elapsed;
+        run_split_timers(elapsed);
+        program_split();
+        sched();
+    }
+
     // Increment uptime, and check if there is any alarm
     system_uptime++;
 
@@ -69,6 +236,9 @@ void clock_handler(){
     if(curr_scheduling_proc->flags & BILLABLE){
         bill_ptr->sys_time_used++;
     }
+    // high resolution timers left over from the last tick are overdue
+    run_split_timers(TICK_COUNTS);
     do_ticks();
+    program_split();
     sched();
 }
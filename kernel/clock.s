@@ -0,0 +1,501 @@
+system_uptime:
+	.word	0x0
+.global	next_timeout
+next_timeout:
+	.word	0x0
+idle_deadline:
+	.word	0x0
+count_base:
+	.word	0x28
+.global	do_ticks
+.text
+do_ticks:
+	subui	$sp, $sp, 6
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, next_timeout($0)
+	lw	$12, system_uptime($0)
+	sleu	$13, $13, $12
+	bnez	$13, L.13
+	j	L.9
+L.12:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	lw	$13, 8($7)
+	jalr	$13
+L.13:
+	lw	$13, system_uptime($0)
+	sw	$13, 0($sp)
+	jal	dequeue_alarm
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.12
+L.9:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	set_bill_ptr
+set_bill_ptr:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$13, bill_ptr($0)
+L.15:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	get_uptime
+get_uptime:
+	lw	$1, system_uptime($0)
+L.16:
+	jr	$ra
+get_tick_elapsed:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, count_base($0)
+	lhi	$12, 0x7
+	ori	$12, $12, 0x2002
+	lw	$12, 0($12)
+	sub	$7, $13, $12
+	sge	$13, $7, $0
+	bnez	$13, L.19
+	addu	$6, $0, $0
+	j	L.20
+L.19:
+	addu	$6, $0, $7
+L.20:
+	addu	$1, $0, $6
+L.17:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	get_hrtime_until
+get_hrtime_until:
+	subui	$sp, $sp, 5
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	jal	get_tick_elapsed
+	addu	$13, $0, $1
+	addui	$12, $0, 40
+	lw	$11, 5($sp)
+	lw	$10, system_uptime($0)
+	subu	$11, $11, $10
+	addu	$11, $0, $11
+	mult	$12, $12, $11
+	lw	$11, 6($sp)
+	add	$12, $12, $11
+	sub	$1, $12, $13
+L.21:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+program_split:
+	subui	$sp, $sp, 5
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	jal	next_split
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.23
+	j	L.22
+L.23:
+	lw	$13, count_base($0)
+	lhi	$12, 0x7
+	ori	$12, $12, 0x2002
+	lw	$12, 0($12)
+	sub	$6, $13, $12
+	sgt	$13, $7, $6
+	bnez	$13, L.25
+	addi	$7, $6, 1
+L.25:
+	lw	$13, count_base($0)
+	slt	$13, $7, $13
+	bnez	$13, L.27
+	j	L.22
+L.27:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2002
+	sub	$12, $7, $6
+	sw	$12, 0($13)
+	sw	$7, count_base($0)
+L.22:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+run_split_timers:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	j	L.31
+L.30:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	lw	$13, 8($7)
+	jalr	$13
+L.31:
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	dequeue_split
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.30
+L.29:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	new_hrtimer
+new_hrtimer:
+	subui	$sp, $sp, 8
+	sw	$10, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.36
+	lw	$13, 9($sp)
+	lw	$13, 9($13)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.34
+L.36:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.33
+L.34:
+	jal	get_tick_elapsed
+	addu	$13, $0, $1
+	lw	$12, 10($sp)
+	addu	$13, $0, $13
+	addu	$13, $12, $13
+	sw	$13, 10($sp)
+	lw	$13, 9($sp)
+	lw	$12, system_uptime($0)
+	lw	$11, 10($sp)
+	addui	$10, $0, 40
+	divu	$11, $11, $10
+	addu	$12, $12, $11
+	sw	$12, 3($13)
+	lw	$13, 9($sp)
+	lw	$12, 10($sp)
+	addui	$11, $0, 40
+	remu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 4($13)
+	lw	$13, 9($sp)
+	lw	$12, 3($13)
+	sw	$12, 1($13)
+	lw	$13, 9($sp)
+	lw	$12, 4($13)
+	sw	$12, 2($13)
+	lw	$13, 9($sp)
+	addui	$12, $13, 1
+	sw	$12, 0($sp)
+	addui	$13, $13, 2
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	jal	slack_deadline
+	lw	$13, 9($sp)
+	addui	$13, $13, 9
+	lw	$12, 0($13)
+	ori	$12, $12, 3
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	lw	$12, 12($sp)
+	sw	$12, 8($13)
+	lw	$13, 9($sp)
+	lw	$12, 8($sp)
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	sw	$0, 5($13)
+	lw	$13, 9($sp)
+	lw	$13, 1($13)
+	lw	$12, system_uptime($0)
+	sleu	$13, $13, $12
+	bnez	$13, L.37
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	insert_timer
+	j	L.38
+L.37:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	sw	$0, 0($13)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	insert_split
+	jal	program_split
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	addui	$12, $0, 3
+	sw	$12, 0($13)
+L.38:
+	addu	$1, $0, $0
+L.33:
+	lw	$10, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	stop_tick
+stop_tick:
+	subui	$sp, $sp, 6
+	sw	$7, 0($sp)
+	sw	$10, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, idle_deadline($0)
+	sneu	$13, $13, $0
+	bnez	$13, L.43
+	lw	$13, next_timeout($0)
+	lw	$12, system_uptime($0)
+	sleu	$13, $13, $12
+	bnez	$13, L.43
+	jal	next_split
+	addu	$13, $0, $1
+	slt	$13, $13, $0
+	bnez	$13, L.40
+L.43:
+	j	L.39
+L.40:
+	lw	$13, next_timeout($0)
+	lw	$12, system_uptime($0)
+	subu	$7, $13, $12
+	addui	$13, $0, 1638
+	sleu	$13, $7, $13
+	bnez	$13, L.44
+	addui	$7, $0, 1638
+L.44:
+	addui	$13, $0, 1
+	sgtu	$13, $7, $13
+	bnez	$13, L.46
+	j	L.39
+L.46:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	sw	$0, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2002
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addui	$11, $0, 40
+	addui	$10, $0, 1
+	subu	$10, $7, $10
+	multu	$11, $11, $10
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	addui	$12, $0, 3
+	sw	$12, 0($13)
+	lw	$13, system_uptime($0)
+	addu	$13, $13, $7
+	sw	$13, idle_deadline($0)
+L.39:
+	lw	$7, 0($sp)
+	lw	$10, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	restart_tick
+restart_tick:
+	subui	$sp, $sp, 6
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, idle_deadline($0)
+	sneu	$13, $13, $0
+	bnez	$13, L.49
+	j	L.48
+L.49:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2002
+	lw	$7, 0($13)
+	sgt	$13, $7, $0
+	bnez	$13, L.51
+	addui	$7, $0, 40
+L.51:
+	addui	$13, $0, 40
+	addi	$12, $7, 40
+	subi	$12, $12, 1
+	div	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 5($sp)
+	lw	$13, idle_deadline($0)
+	lw	$12, 5($sp)
+	subu	$6, $13, $12
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 92
+	lw	$12, 0($13)
+	lw	$11, system_uptime($0)
+	subu	$11, $6, $11
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	sw	$6, system_uptime($0)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2002
+	subi	$12, $7, 1
+	remi	$12, $12, 40
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	sw	$0, idle_deadline($0)
+L.48:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	clock_handler
+clock_handler:
+	subui	$sp, $sp, 6
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2003
+	sw	$0, 0($13)
+	lw	$13, count_base($0)
+	sgei	$13, $13, 40
+	bnez	$13, L.54
+	lw	$13, count_base($0)
+	sw	$13, 5($sp)
+	addui	$13, $0, 40
+	sw	$13, count_base($0)
+	lhi	$12, 0x7
+	ori	$12, $12, 0x2002
+	lw	$11, 5($sp)
+	sub	$13, $13, $11
+	sw	$13, 0($12)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	run_split_timers
+	jal	program_split
+	jal	sched
+L.54:
+	addui	$13, $0, 1
+	lw	$12, system_uptime($0)
+	addu	$12, $12, $13
+	sw	$12, system_uptime($0)
+	lw	$12, curr_scheduling_proc($0)
+	addui	$12, $12, 92
+	lw	$11, 0($12)
+	addu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 83
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 131($13)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.56
+	lw	$13, bill_ptr($0)
+	addui	$13, $13, 93
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+L.56:
+	addui	$13, $0, 40
+	sw	$13, 0($sp)
+	jal	run_split_timers
+	jal	do_ticks
+	jal	program_split
+	jal	sched
+L.53:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.bss
+bill_ptr:
+	.space	1
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -27,6 +27,13 @@ PRIVATE int* _expt_stack_ptr;
 // Number of exception sources
 #define NUM_HANDLERS 16
 
+// Load and store instructions: opcode, Rd, Rs and a signed 20 bit offset
+#define OPCODE_LW           0x8
+#define OPCODE_SW           0x9
+#define INS_OPCODE(ins)     (((ins) >> 28) & 0xf)
+#define INS_RS(ins)         (((ins) >> 20) & 0xf)
+#define INS_OFFSET(ins)     (((ins) & 0x80000) ? ((ins) | 0xfff00000) : ((ins) & 0xfffff))
+
 // Handler prototypes
 PRIVATE void button_handler();
 PRIVATE void parallel_handler();
@@ -241,15 +248,64 @@ void trigger_gpf(struct proc* who){
     send_sig(curr_scheduling_proc, SIGSEGV);
 }
 
+/**
+ * value of a general purpose register of a user process
+ * @param  who 
+ * @param  reg 
+ * @return     
+ */
+PRIVATE unsigned long user_reg(struct proc* who, int reg){
+    if(reg == 0)
+        return 0;
+    if(reg == 14)
+        return (unsigned long)who->ctx.m.sp;
+    if(reg == 15)
+        return (unsigned long)who->ctx.m.ra;
+    return (unsigned long)who->ctx.m.regs[reg - 1];
+}
+
+/**
+ * A forked image is copied page by page on first access (see copy_mm()).
+ * Find the page the faulting instruction was fetching or accessing, and
+ * resolve it if it was waiting for its copy. Like syscall, a fault leaves
+ * $ear past the faulting instruction, so $ear is stepped back to run the
+ * instruction again on return.
+ * @param  who 
+ * @return     true if the fault was resolved
+ */
+PRIVATE bool resolve_gpf(struct proc* who){
+    vptr_t* vpc;
+    unsigned int ins;
+    unsigned long addr;
+
+    if(!IS_USER_PROC(who))
+        return false;
+    vpc = (vptr_t*)get_pc_ptr(who) - 1;
+    if(!resolve_user_page(who, get_physical_addr(vpc, who))){
+        if(!is_vaddr_ok(vpc, 1, who))
+            return false;
+        ins = *get_physical_addr(vpc, who);
+        if(INS_OPCODE(ins) != OPCODE_LW && INS_OPCODE(ins) != OPCODE_SW)
+            return false;
+        addr = user_reg(who, INS_RS(ins)) + INS_OFFSET(ins);
+        if(!resolve_user_page(who, get_physical_addr(addr, who)))
+            return false;
+    }
+    who->ctx.m.pc = (void (*)())(unsigned long)vpc;
+    return true;
+}
+
 /**
  * General Protection Fault.
  *
  * Side Effects:
- *   Current process is killed.
+ *   Current process is killed, unless the fault was on a page still
+ *   waiting for its fork copy.
  *   Scheduler is called (i.e. this handler does not return).
  **/
 PRIVATE void gpf_handler() {
-    trigger_gpf(curr_scheduling_proc);
+    if(!resolve_gpf(curr_scheduling_proc))
+        trigger_gpf(curr_scheduling_proc);
     sched();
 }
 
@@ -275,14 +331,25 @@ PRIVATE void syscall_handler() {
         m = USER_TMP_MESSAGE(curr_scheduling_proc);
         curr_scheduling_proc->flags |= DIRECT_SYSCALL;
         m->type = operation;
+        m->m1_p1 = m->m1_p2 = m->m1_p3 = NULL;
         dest = SYSTEM;
         sp++;
         set_syscall_mesg_exception(operation, sp, m, curr_scheduling_proc);
+        if((ret = resolve_syscall_args(m->type, m, curr_scheduling_proc))){
+            curr_scheduling_proc->flags &= ~DIRECT_SYSCALL;
+            (void)set_syscall_reply(curr_scheduling_proc, ret, m->type);
+            goto end;
+        }
         operation = WINIX_SENDREC;
         direct_syscall = true;
         
     }else{ // traditional IPC mode
         dest = *(sp+1);                // Destination is second parameter on the stack
+        if(IS_USER_PROC(curr_scheduling_proc) && 
+            !is_vaddr_ok((vptr_t *)*((unsigned long*)(sp + 2)), sizeof(struct message), curr_scheduling_proc)){
+            send_sig(curr_scheduling_proc, SIGSEGV);
+            goto end;
+        }
         m = (struct message *)get_physical_addr(*((unsigned long*)(sp+ 2)), curr_scheduling_proc);  // Message is the third parameter
     }
 
@@ -363,6 +430,8 @@ PRIVATE void no_handler() {
 PRIVATE void exception_handler(int estat) {
     int i;
     _irq_count = 0;
+    // catch up on the ticks skipped while idle, before any handler looks at the time
+    restart_tick();
     // Loop through $estat and call all relevant handlers.
     for(i = NUM_HANDLERS; i >= 0; i--) {
         if(estat & (1 << i)) {
@@ -388,6 +457,6 @@ void init_exceptions() {
     _expt_stack_ptr += EXCEPTION_STACK_SIZE;
 
     wramp_set_handler(exception_handler);
-    RexTimer->Load = 2400 / HZ; // currently 60 Hz
+    RexTimer->Load = TICK_COUNTS; // currently 60 Hz
     enable_interrupt();
 }
@@ -0,0 +1,1082 @@
+handlers:
+	.word	no_handler
+	.word	no_handler
+	.word	no_handler
+	.word	no_handler
+	.word	no_handler
+	.word	button_handler
+	.word	clock_handler
+	.word	parallel_handler
+	.word	serial1_handler
+	.word	serial2_handler
+	.word	no_handler
+	.word	no_handler
+	.word	gpf_handler
+	.word	syscall_handler
+	.word	break_handler
+	.word	arith_handler
+_irq_count:
+	.word	0x0
+.global	irq_count
+.text
+irq_count:
+	lw	$1, _irq_count($0)
+L.9:
+	jr	$ra
+.global	register_irq
+register_irq:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	sw	$13, 2($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.13
+	lw	$13, 2($sp)
+	slti	$13, $13, 15
+	bnez	$13, L.11
+L.13:
+	j	L.10
+L.11:
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	sw	$12, handlers($13)
+L.10:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	preempt_currproc
+preempt_currproc:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, curr_scheduling_proc($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule
+	sw	$0, curr_scheduling_proc($0)
+L.15:
+L.14:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	reset_irq_count
+reset_irq_count:
+	sw	$0, _irq_count($0)
+L.17:
+	jr	$ra
+.global	get_exception_stack_top
+get_exception_stack_top:
+	addu	$1, $0, $0
+L.18:
+	jr	$ra
+.global	get_exception_stack_bottom
+get_exception_stack_bottom:
+	lw	$1, _expt_stack_ptr($0)
+L.19:
+	jr	$ra
+.global	get_exception_m
+get_exception_m:
+	la	$1, _message
+L.20:
+	jr	$ra
+button_handler:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0xf000
+	sw	$0, 0($13)
+L.21:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+parallel_handler:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3005
+	sw	$0, 0($13)
+L.22:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+serial1_handler:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x4
+	sw	$0, 0($13)
+L.23:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+serial2_handler:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x1004
+	sw	$0, 0($13)
+L.24:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	_traceback_stack
+_traceback_stack:
+	subui	$sp, $sp, 15
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	lw	$6, 16($sp)
+	addu	$4, $0, $0
+	addu	$13, $0, $6
+	lw	$12, 17($sp)
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.26
+	la	$13, L.28
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	lw	$13, 17($sp)
+	sw	$13, 2($sp)
+	jal	kwarn
+	j	L.25
+L.26:
+	lw	$13, 15($sp)
+	lw	$12, 23($13)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	subu	$3, $12, $11
+	lw	$13, 29($13)
+	addu	$2, $13, $3
+	la	$13, L.29
+	sw	$13, 0($sp)
+	jal	kprintf
+	j	L.31
+L.30:
+	lw	$7, 0($6)
+	lw	$13, 15($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$5, $13, $7
+	lw	$13, 0($5)
+	lhi	$12, 0x10
+	ori	$12, $12, 0x0
+	sleu	$13, $13, $12
+	bnez	$13, L.33
+	addu	$13, $0, $7
+	sw	$13, 13($sp)
+	addu	$12, $0, $3
+	sgtu	$13, $12, $13
+	bnez	$13, L.33
+	addu	$13, $0, $2
+	lw	$12, 13($sp)
+	sgtu	$13, $12, $13
+	bnez	$13, L.33
+	la	$13, L.35
+	sw	$13, 0($sp)
+	addu	$13, $0, $7
+	sw	$13, 1($sp)
+	lw	$13, 0($5)
+	sw	$13, 2($sp)
+	jal	kprintf
+	addi	$4, $4, 1
+L.33:
+	addui	$6, $6, 1
+L.31:
+	addu	$13, $0, $6
+	lw	$12, 17($sp)
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.36
+	slti	$13, $4, 10
+	bnez	$13, L.30
+L.36:
+	lw	$13, 15($sp)
+	addui	$13, $13, 94
+	sw	$13, 0($sp)
+	jal	basename
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+	la	$13, L.37
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	jal	kprintf
+L.25:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	traceback_stack
+traceback_stack:
+	subui	$sp, $sp, 9
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	addu	$13, $0, $13
+	lw	$12, curr_scheduling_proc($0)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.39
+	jal	irq_count
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.39
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x6
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	j	L.38
+L.39:
+	lw	$13, 9($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$11, 13($13)
+	addu	$12, $12, $11
+	sw	$12, 8($sp)
+	lw	$12, 32($13)
+	lw	$11, 22($13)
+	addu	$12, $12, $11
+	sw	$12, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	_traceback_stack
+L.38:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	traceback_exception_stack
+traceback_exception_stack:
+	subui	$sp, $sp, 7
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	jal	irq_count
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.42
+	j	L.41
+L.42:
+	la	$13, L.44
+	sw	$13, 0($sp)
+	jal	kprintf
+	jal	get_sp
+	addu	$13, $0, $1
+	jal	get_exception_stack_bottom
+	addu	$12, $0, $1
+	lw	$11, proc_table($0)
+	sw	$11, 0($sp)
+	sw	$13, 1($sp)
+	sw	$12, 2($sp)
+	jal	_traceback_stack
+L.41:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	traceback_current_stack
+traceback_current_stack:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	jal	irq_count
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.46
+	jal	traceback_exception_stack
+	j	L.47
+L.46:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	traceback_stack
+L.47:
+L.45:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	kreport_proc_sigsegv
+kreport_proc_sigsegv:
+	subui	$sp, $sp, 9
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 170($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.49
+	j	L.48
+L.49:
+	lw	$13, 9($sp)
+	lw	$13, 131($13)
+	andi	$13, $13, 16
+	seq	$13, $13, $0
+	bnez	$13, L.51
+	j	L.48
+L.51:
+	lw	$13, 9($sp)
+	lw	$12, 13($13)
+	sw	$12, 0($sp)
+	addui	$12, $0, 1
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.53
+	la	$13, L.55
+	sw	$13, 0($sp)
+	jal	kprintf
+L.53:
+	la	$13, L.56
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	addui	$12, $13, 94
+	sw	$12, 1($sp)
+	lw	$13, 114($13)
+	sw	$13, 2($sp)
+	jal	kprintf
+	la	$13, L.57
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	sw	$12, 1($sp)
+	lw	$13, 22($13)
+	addu	$11, $0, $13
+	sw	$11, 2($sp)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	kprintf
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	get_pc_ptr
+	addu	$12, $0, $1
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$13, $13, $12
+	sw	$13, 8($sp)
+	la	$13, L.58
+	sw	$13, 0($sp)
+	jal	kprintf
+	la	$13, L.59
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	lw	$12, 15($13)
+	addu	$12, $0, $12
+	sw	$12, 1($sp)
+	lw	$12, 13($13)
+	addu	$12, $0, $12
+	sw	$12, 2($sp)
+	lw	$13, 14($13)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	kprintf
+	la	$13, L.60
+	sw	$13, 0($sp)
+	jal	kprintf
+	la	$13, L.59
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$11, 13($13)
+	addu	$11, $12, $11
+	addu	$11, $0, $11
+	sw	$11, 2($sp)
+	lw	$13, 14($13)
+	addu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	kprintf
+	la	$13, L.61
+	sw	$13, 0($sp)
+	jal	kprintf
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	la	$13, kprintf
+	sw	$13, 2($sp)
+	jal	_kreport_bitmap
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	traceback_stack
+L.48:
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	trigger_gpf
+trigger_gpf:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 133($13)
+	sw	$13, 7($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffd
+	sle	$13, $13, $12
+	bnez	$13, L.65
+	lw	$13, nr_proc_slots($0)
+	lw	$12, 7($sp)
+	sgt	$13, $12, $13
+	bnez	$13, L.65
+	addui	$7, $0, 1
+	j	L.66
+L.65:
+	addu	$7, $0, $0
+L.66:
+	sw	$7, 0($sp)
+	addui	$13, $0, 240
+	sw	$13, 1($sp)
+	la	$13, L.64
+	sw	$13, 2($sp)
+	jal	_assert
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.67
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	kreport_proc_sigsegv
+	la	$13, L.69
+	sw	$13, 0($sp)
+	la	$13, L.64
+	sw	$13, 1($sp)
+	jal	_panic
+L.67:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	jal	send_sig
+L.62:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+user_reg:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.71
+	addu	$1, $0, $0
+	j	L.70
+L.71:
+	lw	$13, 3($sp)
+	snei	$13, $13, 14
+	bnez	$13, L.73
+	lw	$13, 2($sp)
+	lw	$13, 13($13)
+	addu	$1, $0, $13
+	j	L.70
+L.73:
+	lw	$13, 3($sp)
+	snei	$13, $13, 15
+	bnez	$13, L.75
+	lw	$13, 2($sp)
+	lw	$13, 14($13)
+	addu	$1, $0, $13
+	j	L.70
+L.75:
+	lw	$13, 3($sp)
+	subi	$13, $13, 1
+	lw	$12, 2($sp)
+	addu	$13, $13, $12
+	lw	$1, 0($13)
+L.70:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+resolve_gpf:
+	subui	$sp, $sp, 12
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 12($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.78
+	addu	$1, $0, $0
+	j	L.77
+L.78:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	get_pc_ptr
+	addu	$13, $0, $1
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	addu	$7, $13, $12
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$13, $13, $7
+	sw	$13, 1($sp)
+	jal	resolve_user_page
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.80
+	sw	$7, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.82
+	addu	$1, $0, $0
+	j	L.77
+L.82:
+	lw	$13, 12($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$13, $13, $7
+	lw	$13, 0($13)
+	addu	$6, $0, $13
+	srli	$13, $6, 28
+	addui	$12, $0, 15
+	and	$13, $13, $12
+	sw	$13, 10($sp)
+	addui	$12, $0, 8
+	sequ	$13, $13, $12
+	bnez	$13, L.84
+	addui	$13, $0, 9
+	lw	$12, 10($sp)
+	sequ	$13, $12, $13
+	bnez	$13, L.84
+	addu	$1, $0, $0
+	j	L.77
+L.84:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	srli	$13, $6, 20
+	addui	$12, $0, 15
+	and	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	user_reg
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	lhi	$12, 0x8
+	ori	$12, $12, 0x0
+	and	$12, $6, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.87
+	lhi	$13, 0xfff0
+	ori	$13, $13, 0x0
+	or	$5, $6, $13
+	j	L.88
+L.87:
+	lhi	$13, 0xf
+	ori	$13, $13, 0xffff
+	and	$5, $6, $13
+L.88:
+	lw	$13, 9($sp)
+	addu	$13, $13, $5
+	sw	$13, 11($sp)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 11($sp)
+	addu	$12, $0, $12
+	addu	$13, $13, $12
+	sw	$13, 1($sp)
+	jal	resolve_user_page
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.89
+	addu	$1, $0, $0
+	j	L.77
+L.89:
+L.80:
+	lw	$13, 12($sp)
+	addu	$12, $0, $7
+	addu	$12, $0, $12
+	sw	$12, 15($13)
+	addui	$1, $0, 1
+L.77:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+gpf_handler:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	resolve_gpf
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.92
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	trigger_gpf
+L.92:
+	jal	sched
+L.91:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+syscall_handler:
+	subui	$sp, $sp, 15
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	sw	$0, 13($sp)
+	lw	$13, curr_scheduling_proc($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.95
+	j	L.97
+L.95:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$13, 13($13)
+	addu	$5, $12, $13
+	lw	$6, 0($5)
+	sle	$13, $6, $0
+	bnez	$13, L.98
+	sgei	$13, $6, 65
+	bnez	$13, L.98
+	lw	$13, curr_scheduling_proc($0)
+	lw	$12, 22($13)
+	addui	$7, $12, 16
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 4
+	sw	$12, 0($13)
+	sw	$6, 1($7)
+	addu	$13, $0, $0
+	sw	$13, 7($7)
+	sw	$13, 6($7)
+	sw	$13, 5($7)
+	sw	$0, 12($sp)
+	addui	$5, $5, 1
+	sw	$6, 0($sp)
+	sw	$5, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 3($sp)
+	jal	set_syscall_mesg_exception
+	lw	$13, 1($7)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 2($sp)
+	jal	resolve_syscall_args
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.100
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffb
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	lw	$13, 1($7)
+	sw	$13, 2($sp)
+	jal	set_syscall_reply
+	j	L.97
+L.100:
+	lhi	$6, 0x1337
+	ori	$6, $6, 0x3
+	addui	$13, $0, 1
+	sw	$13, 13($sp)
+	j	L.99
+L.98:
+	lw	$13, 1($5)
+	sw	$13, 12($sp)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 11($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.102
+	lw	$13, 2($5)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.102
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	jal	send_sig
+	j	L.97
+L.102:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 2($5)
+	addu	$12, $0, $12
+	addu	$7, $13, $12
+L.99:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 133($13)
+	sw	$13, 0($7)
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x1
+	slt	$13, $6, $13
+	bnez	$13, L.104
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x6
+	sgt	$13, $6, $13
+	bnez	$13, L.104
+	lw	$13, L.113-322371585($6)
+	jr	$13
+.data
+L.113:
+	.word	L.107
+	.word	L.110
+	.word	L.106
+	.word	L.111
+	.word	L.104
+	.word	L.112
+.text
+L.106:
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 2
+	sw	$12, 0($13)
+L.107:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	do_send
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+	lw	$13, 14($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.105
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffd
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.105
+L.110:
+	sw	$7, 0($sp)
+	jal	do_receive
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+	j	L.105
+L.111:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	do_notify
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+	j	L.105
+L.112:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	traceback_stack
+	j	L.105
+L.104:
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffea
+	sw	$13, 14($sp)
+L.105:
+	addu	$13, $0, $0
+	sw	$13, 11($sp)
+	lw	$12, 13($sp)
+	seq	$13, $12, $13
+	bnez	$13, L.117
+	lw	$13, 14($sp)
+	lw	$12, 11($sp)
+	sge	$13, $13, $12
+	bnez	$13, L.115
+L.117:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$12, 14($sp)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+L.115:
+L.97:
+	jal	sched
+L.94:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+break_handler:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	la	$13, L.119
+	sw	$13, 0($sp)
+	jal	klog
+L.118:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+arith_handler:
+	subui	$sp, $sp, 7
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	la	$13, L.121
+	sw	$13, 0($sp)
+	lw	$13, curr_scheduling_proc($0)
+	addui	$12, $13, 94
+	sw	$12, 1($sp)
+	lw	$12, 114($13)
+	sw	$12, 2($sp)
+	lw	$13, 15($13)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	klog
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	jal	send_sig
+	jal	sched
+L.120:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+no_handler:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	la	$13, L.123
+	sw	$13, 0($sp)
+	la	$13, L.64
+	sw	$13, 1($sp)
+	jal	_panic
+L.122:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+exception_handler:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	sw	$0, _irq_count($0)
+	jal	restart_tick
+	addui	$7, $0, 16
+L.125:
+	lw	$13, 4($sp)
+	addui	$12, $0, 1
+	sll	$12, $12, $7
+	and	$13, $13, $12
+	seq	$13, $13, $0
+	bnez	$13, L.129
+	lw	$13, _irq_count($0)
+	addi	$13, $13, 1
+	sw	$13, _irq_count($0)
+	lw	$13, handlers($7)
+	jalr	$13
+L.129:
+L.126:
+	subi	$7, $7, 1
+	sge	$13, $7, $0
+	bnez	$13, L.125
+L.124:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	init_exceptions
+init_exceptions:
+	subui	$sp, $sp, 4
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	sw	$0, _expt_stack_ptr($0)
+	lw	$13, _expt_stack_ptr($0)
+	lhi	$12, 0x1234
+	ori	$12, $12, 0x5678
+	sw	$12, 0($13)
+	lw	$13, _expt_stack_ptr($0)
+	addui	$12, $0, 1023
+	addu	$13, $13, $12
+	sw	$13, _expt_stack_ptr($0)
+	la	$13, exception_handler
+	sw	$13, 0($sp)
+	jal	wramp_set_handler
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2001
+	addui	$12, $0, 40
+	sw	$12, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	addui	$12, $0, 3
+	sw	$12, 0($13)
+L.131:
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.bss
+_expt_stack_ptr:
+	.space	1
+_message:
+	.space	8
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.123:
+	.asciiz	"Unhandled Exception"
+L.121:
+	.asciiz	"Arith Exception: \"%s (%d)\" PC=0x%08lx.\r\n"
+L.119:
+	.asciiz	"break"
+L.69:
+	.asciiz	"kernel crashed"
+L.64:
+	.asciiz	"kernel/exception.c"
+L.61:
+	.asciiz	"Memory: "
+L.60:
+	.asciiz	"Physical "
+L.59:
+	.asciiz	"$pc 0x%04lx, $sp 0x%04lx $ra 0x%04lx\n"
+L.58:
+	.asciiz	"Virtual  "
+L.57:
+	.asciiz	"Rbase=0x%lx, Stack Top=0x%lx, vStack Top=0x%lx\n"
+L.56:
+	.asciiz	"\nGeneral Protection Fault: \"%s (%d)\"\n"
+L.55:
+	.asciiz	"\nStack Overflow"
+L.44:
+	.asciiz	"traceback_exception_stack\n"
+L.37:
+	.asciiz	"HINT: type `python3 tools/kdbg.py %s <vir address>` to debug\n"
+L.35:
+	.asciiz	"  - Virtual Addr: 0x%lx, Instruction: 0x%lx\n"
+L.29:
+	.asciiz	"Call Stack:\n"
+L.28:
+	.asciiz	"sp %p past %p\n"
@@ -0,0 +1,8 @@
+.global	idle_main
+.text
+idle_main:
+L.6:
+L.7:
+	j	L.6
+L.5:
+	jr	$ra
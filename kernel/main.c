@@ -37,6 +37,7 @@ int main() {
     
     init_mem_table();
     init_proc();
+    init_timer();
     init_sched();
     init_syscall_table();
     
@@ -65,11 +66,14 @@ void init_kernel_tasks(){
 void start_init(){
     int ret;
     struct proc* init = proc_table + INIT;
+    // init is not given out by get_free_proc_slot()
+    list_del(&init->sibling);
     proc_set_default(init);
     init->state = STATE_RUNNABLE;
     init->flags = IN_USE;
     init->pid = INIT;
-    ret = exec_welf(init, INIT_PATH, init_argv, NULL, true);
+    link_proc(init, SYSTEM_TASK);
+    ret = exec_welf(init, INIT_PATH, init_argv, NULL, NULL);
     if(ret != 0 && ret != DONTREPLY){
         kerror("%d\n", ret);
         PANIC("init");
@@ -0,0 +1,215 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	la	$13, BSS_END
+	addu	$13, $0, $13
+	la	$12, BSS_BEGIN
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 6($sp)
+	la	$13, BSS_BEGIN
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	memset
+	jal	init_dev
+	jal	init_fs
+	jal	init_tty
+	jal	init_drivers
+	jal	init_mem_table
+	jal	init_proc
+	jal	init_timer
+	jal	init_sched
+	jal	init_syscall_table
+	jal	init_kernel_tasks
+	jal	start_init
+	jal	init_exceptions
+	jal	sched
+	addu	$1, $0, $0
+L.9:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	init_kernel_tasks
+init_kernel_tasks:
+	subui	$sp, $sp, 10
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addu	$7, $0, $0
+	j	L.14
+L.11:
+	addui	$13, $0, 21
+	mult	$13, $13, $7
+	la	$12, boot_table
+	addu	$5, $13, $12
+	sw	$5, 0($sp)
+	jal	start_kernel_proc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sequ	$13, $13, $0
+	bnez	$13, L.17
+	addui	$4, $0, 1
+	j	L.18
+L.17:
+	addu	$4, $0, $0
+L.18:
+	sw	$4, 0($sp)
+	addui	$13, $0, 61
+	sw	$13, 1($sp)
+	la	$13, L.16
+	sw	$13, 2($sp)
+	jal	_assert
+L.12:
+	addi	$7, $7, 1
+L.14:
+	addu	$13, $0, $7
+	addui	$12, $0, 3
+	sltu	$13, $13, $12
+	bnez	$13, L.11
+	la	$13, boot_table
+	sw	$13, 0($sp)
+	addui	$13, $0, 63
+	sw	$13, 1($sp)
+	jal	add_free_mem
+L.10:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	start_init
+start_init:
+	subui	$sp, $sp, 10
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, proc_table($0)
+	addui	$7, $13, 236
+L.20:
+L.23:
+L.26:
+	lw	$13, 125($7)
+	lw	$12, 126($7)
+	sw	$12, 1($13)
+	lw	$13, 126($7)
+	lw	$12, 125($7)
+	sw	$12, 0($13)
+L.27:
+L.24:
+	sw	$0, 125($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 126($7)
+L.21:
+	sw	$7, 0($sp)
+	jal	proc_set_default
+	sw	$0, 19($7)
+	addui	$13, $0, 1
+	sw	$13, 131($7)
+	addui	$13, $0, 1
+	sw	$13, 114($7)
+	sw	$7, 0($sp)
+	lw	$13, proc_table($0)
+	sw	$13, 1($sp)
+	jal	link_proc
+	sw	$7, 0($sp)
+	la	$13, INIT_PATH
+	sw	$13, 1($sp)
+	la	$13, init_argv
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	sw	$0, 4($sp)
+	jal	exec_welf
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $6, $0
+	bnez	$13, L.29
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfc1b
+	seq	$13, $6, $13
+	bnez	$13, L.29
+	la	$13, L.31
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	kerror
+	la	$13, L.32
+	sw	$13, 0($sp)
+	la	$13, L.16
+	sw	$13, 1($sp)
+	jal	_panic
+L.29:
+L.19:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.32:
+	.asciiz	"init"
+L.31:
+	.asciiz	"%d\n"
+L.16:
+	.asciiz	"kernel/main.c"
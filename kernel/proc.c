@@ -14,6 +14,7 @@
 
 #include <kernel/kernel.h>
 #include <kernel/table.h>
+#include <kernel/sched.h>
 #include <winix/mm.h>
 #include <winix/srec.h>
 #include <winix/welf.h>
@@ -28,9 +29,29 @@ PRIVATE struct proc _proc_table[NUM_PROCS + NUM_TASKS];
 // Pointer to proc table, public system wise
 PUBLIC struct proc *proc_table;
 
+// User procs past the boot table, PROC_CHUNK procs each
+PRIVATE struct proc *proc_chunks[MAX_PROC_CHUNKS];
+
+// Number of user proc slots, the highest valid proc_nr
+PUBLIC int nr_proc_slots;
+
+// Slots not in use, linked by sibling
+PRIVATE struct list_head free_procs;
+
 // Scheduling queues
 PUBLIC struct proc *ready_q[NUM_QUEUES][2];
 
+// Bit i (in bitmap order) is set if ready_q[MAX_PRIORITY - i] is not empty,
+// so the first set bit gives the highest non-empty queue
+PUBLIC unsigned int ready_map;
+
+// SCHED_STRIDE processes ready to run, lowest pass first
+PUBLIC struct proc *stride_q;
+
+// User processes hashed by pid and by process group, see link_proc()
+PUBLIC struct list_head pid_hash[PID_HASH_SIZE];
+PUBLIC struct list_head pgrp_hash[PID_HASH_SIZE];
+
 // The currently-running process
 PUBLIC struct proc *curr_scheduling_proc;
 
@@ -49,6 +70,7 @@ PUBLIC struct proc *curr_syscall_caller;
  * Data segment
  * Bss segment
  * Heap data                        <- heap_bottom
+ * Reserved heap                    <- heap_end
  *              
  * In the struct proc, rbase points to the first page for which 
  * the process does not have access. This is because NULL points to 0, which is 
@@ -56,7 +78,9 @@ PUBLIC struct proc *curr_syscall_caller;
  * as inaccessible, derefercing NULL will triger page fault.
  * 
  * Heap_bottom points to the end of the process image where memory can be accessed.
- * Heap can be extended by extending heap_bottom.
+ * brk() only reserves pages up to heap_end, each page past heap_bottom is
+ * claimed and zeroed when the process first touches it, so the pages of the
+ * reserved heap claimed so far are only known from the protection table.
  * 
  * Stack_top points to the start of the memory where memory can be accessed
  */
@@ -68,7 +92,7 @@ PUBLIC struct proc *curr_syscall_caller;
 **/
 void kreport_all_procs(struct filp* file) {
     struct proc *curr;
-    filp_kprint(file, "PID PPID PG RBASE      PC         STACK      HEAP       PROTECTION    FLAG NAME    \n");
+    filp_kprint(file, "PID PPID PG RBASE      PC         STACK      HEAP       PROTECTION    RSS VSZ FLAG NI  CLS TIME  NAME    \n");
 
     foreach_proc(curr){
         kreport_proc(curr, file);
@@ -80,7 +104,11 @@ void kreport_all_procs(struct filp* file) {
 **/
 void kreport_proc(struct proc* curr, struct filp* file) {
     int ptable_idx = PADDR_TO_PAGED(curr->ctx.rbase)/32;
-    filp_kprint(file, "%-3d %-4d %-2d 0x%08lx 0x%08lx 0x%08lx 0x%08lx %d 0x%08lx 0x%03x %s\n",
+    // resident pages are the pages the process has touched, reserved heap 
+    // and pages still waiting for their fork copy are not counted
+    int rss = count_bits((unsigned int *)curr->ctx.ptable, PTABLE_LEN, ONE_BITS);
+    int vsz = PADDR_TO_NUM_PAGES(curr->heap_end + 1 - curr->mem_start) + PADDR_TO_NUM_PAGES(curr->stack_size);
+    filp_kprint(file, "%-3d %-4d %-2d 0x%08lx 0x%08lx 0x%08lx 0x%08lx %d 0x%08lx %-3d %-3d 0x%03x %-3d %-3s %-5d %s\n",
             curr->pid,
             get_proc(curr->parent)->pid,
             curr->procgrp,
@@ -90,7 +118,12 @@ void kreport_proc(struct proc* curr, struct filp* file) {
             (uintptr_t)curr->heap_break,
             ptable_idx,
             curr->ctx.ptable[ptable_idx],
+            rss,
+            vsz,
             curr->state,
+            curr->nice,
+            curr->sched_policy == SCHED_STRIDE ? "STR" : "TS",
+            curr->time_used,
             curr->name);
 }
 
@@ -118,7 +151,7 @@ struct proc* get_proc_by_pid(pid_t pid){
     struct proc* curr;
     if(pid == 0)
         return SYSTEM_TASK;
-    foreach_proc(curr){
+    list_for_each_entry(struct proc, curr, &pid_hash[PID_HASH(pid)], pid_link){
         if(curr->pid == pid){
             return curr;
         }
@@ -126,6 +159,107 @@ struct proc* get_proc_by_pid(pid_t pid){
     return NULL;
 }
 
+/**
+ * make child a child of parent, and hash it by its pid and process group,
+ * so that get_proc_by_pid(), foreach_child() and foreach_pgrp_member()
+ * can find it. Called once the child is set up by fork(2) and friends
+ * @param child 
+ * @param parent 
+ */
+void link_proc(struct proc* child, struct proc* parent){
+    child->parent = parent->proc_nr;
+    list_add_tail(&child->sibling, &parent->children);
+    list_add(&child->pid_link, &pid_hash[PID_HASH(child->pid)]);
+    list_add(&child->pgrp_link, &pgrp_hash[PID_HASH(child->procgrp)]);
+}
+
+/**
+ * undo link_proc(), the process can no longer be found by its pid
+ * @param who 
+ */
+void unlink_proc(struct proc* who){
+    list_del_init(&who->sibling);
+    list_del_init(&who->pid_link);
+    list_del_init(&who->pgrp_link);
+}
+
+/**
+ * move the process to process group pgid
+ * @param who 
+ * @param pgid 
+ */
+void set_proc_pgrp(struct proc* who, pid_t pgid){
+    who->procgrp = pgid;
+    if(!list_empty(&who->pgrp_link))
+        list_move(&who->pgrp_link, &pgrp_hash[PID_HASH(pgid)]);
+}
+
+/**
+ * the children of who are adopted by new_parent
+ * @param who 
+ * @param new_parent 
+ */
+void reparent_children(struct proc* who, struct proc* new_parent){
+    struct proc *child, *next;
+
+    if(who == new_parent)
+        return;
+    list_for_each_entry_safe(struct proc, child, next, &who->children, sibling){
+        child->parent = new_parent->proc_nr;
+        list_move_tail(&child->sibling, &new_parent->children);
+    }
+}
+
+/**
+ * the slot of proc_nr, which must be valid
+ * @param proc_nr 
+ * @return 
+ */
+PRIVATE struct proc* proc_slot(int proc_nr){
+    if(proc_nr <= NUM_PROCS)
+        return proc_table + proc_nr;
+    proc_nr -= NUM_PROCS + 1;
+    return proc_chunks[proc_nr / PROC_CHUNK] + proc_nr % PROC_CHUNK;
+}
+
+/**
+ * the slot after curr in the process table, used by foreach_proc()
+ * @param curr 
+ * @return          the next slot, or NULL if curr is the last one
+ */
+struct proc* next_proc_slot(struct proc* curr){
+    int proc_nr = curr->proc_nr + 1;
+    if(proc_nr <= NUM_PROCS)
+        return curr + 1;
+    return proc_nr <= nr_proc_slots ? proc_slot(proc_nr) : NULL;
+}
+
+/**
+ * add PROC_CHUNK slots to the process table, allocated from free pages.
+ * Chunks are never given back, but are reused after init_proc()
+ * @return  0 on success, or -EAGAIN if the table can't grow
+ */
+PRIVATE int grow_proc_table(){
+    int chunk = (nr_proc_slots - NUM_PROCS) / PROC_CHUNK;
+    struct proc* p;
+    int i;
+
+    if(chunk >= MAX_PROC_CHUNKS)
+        return -EAGAIN;
+    if(!proc_chunks[chunk]){
+        proc_chunks[chunk] = (struct proc*)get_free_pages(PROC_CHUNK * sizeof(struct proc), GFP_HIGH);
+        if(!proc_chunks[chunk])
+            return -EAGAIN;
+    }
+    for(i = 0; i < PROC_CHUNK; i++){
+        p = proc_chunks[chunk] + i;
+        p->proc_nr = ++nr_proc_slots;
+        proc_set_default(p);
+        list_add_tail(&p->sibling, &free_procs);
+    }
+    return 0;
+}
+
 /**
  * Gets a pointer to a process.
  *
@@ -137,7 +271,7 @@ struct proc* get_proc_by_pid(pid_t pid){
 struct proc *get_proc(int proc_nr) {
     struct proc* who;
     if (IS_PROCN_OK(proc_nr))
-        if(IS_INUSE(who = proc_table + proc_nr))
+        if(IS_INUSE(who = proc_slot(proc_nr)))
             return who;
     return NULL;
 }
@@ -220,6 +354,44 @@ struct proc *dequeue(struct proc **q) {
     return p;
 }
 
+PRIVATE void update_ready_map(int priority){
+    int bit = MAX_PRIORITY - priority;
+    if(ready_q[priority][HEAD])
+        bitmap_set_bit(&ready_map, 1, bit);
+    else
+        bitmap_clear_bit(&ready_map, 1, bit);
+}
+
+/**
+ * insert the process into stride_q by pass, before the processes
+ * of the same pass if at_head is set
+ * @param p 
+ * @param at_head 
+ */
+PRIVATE void enqueue_stride(struct proc* p, bool at_head){
+    struct proc **pp = &stride_q;
+
+    while(*pp && (PASS_BEFORE((*pp)->pass, p->pass) || 
+                (!at_head && (*pp)->pass == p->pass))){
+        pp = &(*pp)->next;
+    }
+    p->next = *pp;
+    *pp = p;
+}
+
+PRIVATE int dequeue_stride(struct proc* h){
+    struct proc **pp = &stride_q;
+
+    while(*pp && *pp != h){
+        pp = &(*pp)->next;
+    }
+    if(*pp == NULL)
+        return -EINVAL;
+    *pp = h->next;
+    h->next = NULL;
+    return 0;
+}
+
 /**
  * remove the process from the scheduling queue
  * @param  h process to be removed
@@ -230,6 +402,9 @@ int dequeue_schedule( struct proc *h) {
     struct proc *prev = NULL;
     struct proc ** q = ready_q[h->priority];
 
+    if(h->sched_policy == SCHED_STRIDE)
+        return dequeue_stride(h);
+
     curr = q[HEAD];
 
     while (curr != h && curr != NULL) {
@@ -242,22 +417,64 @@ int dequeue_schedule( struct proc *h) {
 
     if (prev == NULL) {
         q[HEAD] = curr->next;
-        if(curr->next == NULL){
-            q[TAIL] = NULL;
-        }
     } else {
         prev->next = curr->next;
     }
+    if (q[TAIL] == curr){
+        q[TAIL] = prev;
+    }
+    curr->next = NULL;
+    update_ready_map(h->priority);
     return 0;
 }
 
+/**
+ * remove the process at the head of the highest non-empty
+ * scheduling queue
+ * @return   the process, or NULL if all queues are empty
+ */
+struct proc *dequeue_highest() {
+    struct proc *p;
+    int priority;
+    int bit = bitmap_first_set(ready_map);
+
+    if (bit < 0)
+        return NULL;
+    priority = MAX_PRIORITY - bit;
+    p = dequeue(ready_q[priority]);
+    update_ready_map(priority);
+    return p;
+}
+
 /**
  * enqueue the process to the scheduling queue
  * according to its priority
  * @param p 
  */
 void enqueue_schedule(struct proc* p) {
+    age_proc(p);
+    if(p->sched_policy == SCHED_STRIDE){
+        enqueue_stride(p, false);
+        return;
+    }
     enqueue_tail(ready_q[p->priority], p);
+    update_ready_map(p->priority);
+}
+
+/**
+ * enqueue the process to the head of the scheduling queue, so it
+ * runs next among processes of the same priority. SCHED_STRIDE
+ * processes are kept in pass order, it goes first among equal passes
+ * @param p 
+ */
+void enqueue_schedule_head(struct proc* p) {
+    age_proc(p);
+    if(p->sched_policy == SCHED_STRIDE){
+        enqueue_stride(p, true);
+        return;
+    }
+    enqueue_head(ready_q[p->priority], p);
+    update_ready_map(p->priority);
 }
 
 /**
@@ -277,30 +494,38 @@ void zombify(struct proc *p){
  */
 void release_zombie(struct proc *p){
     if(p->state & STATE_ZOMBIE){
-        p->flags = 0;
-        p->pid = 0;
-        p->state = -1;
+        release_proc_slot(p);
     }
 }
 
 /**
- * get a free struct proc from the system proc table
+ * give the slot of the process back to the proc table
+ * @param p 
+ */
+void release_proc_slot(struct proc *p){
+    unlink_proc(p);
+    p->flags = 0;
+    p->pid = 0;
+    p->state = -1;
+    list_add(&p->sibling, &free_procs);
+}
+
+/**
+ * get a free struct proc from the system proc table, the table
+ * grows if every slot is in use
  * @return pointer to the free slot, or NULL
  */
 struct proc *get_free_proc_slot() {
-    int i;
     struct proc *who;
-    for(i = INIT; i <= NUM_PROCS; i++){
-        who = &proc_table[i];
-        if(!IS_INUSE(who)){
-            proc_set_default(who);
-            who->state = STATE_RUNNABLE;
-            who->flags = IN_USE;
-            who->pid = get_next_pid();
-            return who;
-        }
-    }
-    return NULL;
+    if(list_empty(&free_procs) && grow_proc_table())
+        return NULL;
+    who = list_first_entry(&free_procs, struct proc, sibling);
+    list_del(&who->sibling);
+    proc_set_default(who);
+    who->state = STATE_RUNNABLE;
+    who->flags = IN_USE;
+    who->pid = get_next_pid();
+    return who;
 }
 
 /**
@@ -319,7 +544,15 @@ void proc_set_default(struct proc *p) {
     p->quantum = DEFAULT_USER_QUANTUM;
     p->ctx.ptable = p->protection_table;
     p->timer.proc_nr = p->proc_nr;
+    INIT_LIST_HEAD(&p->children);
+    INIT_LIST_HEAD(&p->sibling);
+    INIT_LIST_HEAD(&p->pid_link);
+    INIT_LIST_HEAD(&p->pgrp_link);
+    INIT_LIST_HEAD(&p->notify_q);
+    INIT_LIST_HEAD(&p->notify_link);
     p->priority = DEFAULT_PRIORITY;
+    p->sched_policy = SCHED_OTHER;
+    p->stride = STRIDE1 / NICE_0_WEIGHT;
     p->umask = 022;
 }
 
@@ -496,6 +729,7 @@ int alloc_mem_welf(struct proc* who, struct winix_elf* elf, int stack_size, int
     who->heap_top = bss_start + elf->bss_size;
     who->heap_break = who->heap_top;
     who->heap_bottom = who->heap_break + heap_size + data_residual - 1;
+    who->heap_end = who->heap_bottom;
     memset(who->heap_top, 0, heap_size);
 
     who->data_size = elf->data_size;
@@ -577,17 +811,27 @@ void init_proc() {
     for (i = 0; i < NUM_QUEUES; i++) {
         ready_q[i][HEAD]  = ready_q[i][TAIL] = NULL;
     }
+    ready_map = 0;
+    stride_q = NULL;
+    for (i = 0; i < PID_HASH_SIZE; i++) {
+        INIT_LIST_HEAD(&pid_hash[i]);
+        INIT_LIST_HEAD(&pgrp_hash[i]);
+    }
 
     procnr_offset = NUM_TASKS - 1;
+    INIT_LIST_HEAD(&free_procs);
     // Add all proc structs to the free list
     for ( i = 0; i < NUM_PROCS + NUM_TASKS; i++) {
         p = &_proc_table[i];
         proc_set_default(p);
         preset_pnr = i - procnr_offset;
         p->proc_nr = preset_pnr;
+        if(preset_pnr >= INIT)
+            list_add_tail(&p->sibling, &free_procs);
     }
 
     proc_table = _proc_table + procnr_offset;
+    nr_proc_slots = NUM_PROCS;
     curr_scheduling_proc = NULL;
 }
 
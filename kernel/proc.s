@@ -0,0 +1,2306 @@
+.global	kreport_all_procs
+.text
+kreport_all_procs:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	la	$13, L.10
+	sw	$13, 1($sp)
+	jal	filp_kprint
+	lw	$13, proc_table($0)
+	addui	$7, $13, 236
+	j	L.14
+L.11:
+	lw	$13, 131($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.15
+	sw	$7, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	jal	kreport_proc
+L.15:
+L.12:
+	sw	$7, 0($sp)
+	jal	next_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.14:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.11
+L.9:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	kreport_proc
+kreport_proc:
+	subui	$sp, $sp, 28
+	sw	$6, 18($sp)
+	sw	$7, 19($sp)
+	sw	$9, 20($sp)
+	sw	$10, 21($sp)
+	sw	$11, 22($sp)
+	sw	$12, 23($sp)
+	sw	$13, 24($sp)
+	sw	$ra, 25($sp)
+	lw	$13, 28($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	srli	$13, $13, 5
+	addu	$7, $0, $13
+	lw	$13, 28($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	count_bits
+	addu	$13, $0, $1
+	sw	$13, 27($sp)
+	lw	$13, 28($sp)
+	lw	$12, 27($13)
+	addui	$12, $12, 1
+	addu	$12, $0, $12
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	lw	$12, 28($sp)
+	lw	$12, 32($12)
+	addu	$12, $0, $12
+	sw	$12, 0($sp)
+	jal	align_page
+	addu	$12, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$12, $0, $12
+	srli	$12, $12, 10
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 26($sp)
+	lw	$13, 28($sp)
+	lw	$13, 120($13)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	lw	$12, 28($sp)
+	sw	$12, 0($sp)
+	jal	get_pc_ptr
+	addu	$11, $0, $1
+	lw	$10, 29($sp)
+	sw	$10, 0($sp)
+	la	$10, L.18
+	sw	$10, 1($sp)
+	lw	$10, 28($sp)
+	lw	$9, 114($10)
+	sw	$9, 2($sp)
+	lw	$13, 114($13)
+	sw	$13, 3($sp)
+	lw	$13, 115($10)
+	sw	$13, 4($sp)
+	lw	$13, 16($10)
+	addu	$13, $0, $13
+	sw	$13, 5($sp)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 6($sp)
+	lw	$12, 13($10)
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	lw	$13, 25($10)
+	addu	$13, $0, $13
+	sw	$13, 8($sp)
+	sw	$7, 9($sp)
+	lw	$13, 17($10)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 10($sp)
+	lw	$13, 27($sp)
+	sw	$13, 11($sp)
+	lw	$13, 26($sp)
+	sw	$13, 12($sp)
+	lw	$13, 19($10)
+	sw	$13, 13($sp)
+	lw	$13, 88($10)
+	sw	$13, 14($sp)
+	lw	$13, 87($10)
+	snei	$13, $13, 1
+	bnez	$13, L.22
+	la	$6, L.19
+	j	L.23
+L.22:
+	la	$6, L.20
+L.23:
+	sw	$6, 15($sp)
+	lw	$13, 28($sp)
+	lw	$12, 92($13)
+	sw	$12, 16($sp)
+	addui	$13, $13, 94
+	sw	$13, 17($sp)
+	jal	filp_kprint
+L.17:
+	lw	$6, 18($sp)
+	lw	$7, 19($sp)
+	lw	$9, 20($sp)
+	lw	$10, 21($sp)
+	lw	$11, 22($sp)
+	lw	$12, 23($sp)
+	lw	$13, 24($sp)
+	lw	$ra, 25($sp)
+	addui	$sp, $sp, 28
+	jr	$ra
+L.25:
+	.word	0x2
+.global	get_next_pid
+.text
+get_next_pid:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, L.25($0)
+	lhi	$12, 0x7fff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.26
+	addui	$13, $0, 2
+	sw	$13, L.25($0)
+L.26:
+	lw	$13, L.25($0)
+	addi	$12, $13, 1
+	sw	$12, L.25($0)
+	addu	$1, $0, $13
+L.24:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	get_proc_by_pid
+get_proc_by_pid:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.29
+	lw	$1, proc_table($0)
+	j	L.28
+L.29:
+	lw	$13, 4($sp)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	lw	$13, pid_hash($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff81
+	addu	$7, $13, $12
+	j	L.34
+L.31:
+	lw	$13, 114($7)
+	lw	$12, 4($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.35
+	addu	$1, $0, $7
+	j	L.28
+L.35:
+L.32:
+	lw	$13, 127($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff81
+	addu	$7, $13, $12
+L.34:
+	addui	$13, $7, 127
+	addu	$13, $0, $13
+	lw	$12, 4($sp)
+	andi	$12, $12, 63
+	slli	$12, $12, 1
+	la	$11, pid_hash
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.31
+	addu	$1, $0, $0
+L.28:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	link_proc
+link_proc:
+	subui	$sp, $sp, 5
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	lw	$12, 6($sp)
+	lw	$12, 133($12)
+	sw	$12, 120($13)
+L.38:
+L.41:
+	lw	$13, 5($sp)
+	addui	$7, $13, 125
+	lw	$13, 6($sp)
+	lw	$6, 124($13)
+	lw	$13, 6($sp)
+	addui	$5, $13, 123
+	sw	$7, 1($5)
+	sw	$5, 0($7)
+	sw	$6, 1($7)
+	sw	$7, 0($6)
+L.42:
+L.39:
+L.44:
+L.47:
+	lw	$13, 5($sp)
+	addui	$7, $13, 127
+	lw	$13, 5($sp)
+	lw	$13, 114($13)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	la	$12, pid_hash
+	addu	$6, $13, $12
+	lw	$13, 5($sp)
+	lw	$13, 114($13)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	lw	$5, pid_hash($13)
+	sw	$7, 1($5)
+	sw	$5, 0($7)
+	sw	$6, 1($7)
+	sw	$7, 0($6)
+L.48:
+L.45:
+L.50:
+L.53:
+	lw	$13, 5($sp)
+	addui	$7, $13, 129
+	lw	$13, 5($sp)
+	lw	$13, 115($13)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	la	$12, pgrp_hash
+	addu	$6, $13, $12
+	lw	$13, 5($sp)
+	lw	$13, 115($13)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	lw	$5, pgrp_hash($13)
+	sw	$7, 1($5)
+	sw	$5, 0($7)
+	sw	$6, 1($7)
+	sw	$7, 0($6)
+L.54:
+L.51:
+L.37:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	unlink_proc
+unlink_proc:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+L.57:
+L.60:
+L.63:
+	lw	$13, 2($sp)
+	lw	$12, 125($13)
+	lw	$13, 126($13)
+	sw	$13, 1($12)
+	lw	$13, 2($sp)
+	lw	$12, 126($13)
+	lw	$13, 125($13)
+	sw	$13, 0($12)
+L.64:
+L.61:
+L.66:
+	lw	$13, 2($sp)
+	addui	$13, $13, 125
+	sw	$13, 0($13)
+	lw	$13, 2($sp)
+	addui	$12, $13, 125
+	sw	$12, 126($13)
+L.67:
+L.58:
+L.69:
+L.72:
+L.75:
+	lw	$13, 2($sp)
+	lw	$12, 127($13)
+	lw	$13, 128($13)
+	sw	$13, 1($12)
+	lw	$13, 2($sp)
+	lw	$12, 128($13)
+	lw	$13, 127($13)
+	sw	$13, 0($12)
+L.76:
+L.73:
+L.78:
+	lw	$13, 2($sp)
+	addui	$13, $13, 127
+	sw	$13, 0($13)
+	lw	$13, 2($sp)
+	addui	$12, $13, 127
+	sw	$12, 128($13)
+L.79:
+L.70:
+L.81:
+L.84:
+L.87:
+	lw	$13, 2($sp)
+	lw	$12, 129($13)
+	lw	$13, 130($13)
+	sw	$13, 1($12)
+	lw	$13, 2($sp)
+	lw	$12, 130($13)
+	lw	$13, 129($13)
+	sw	$13, 0($12)
+L.88:
+L.85:
+L.90:
+	lw	$13, 2($sp)
+	addui	$13, $13, 129
+	sw	$13, 0($13)
+	lw	$13, 2($sp)
+	addui	$12, $13, 129
+	sw	$12, 130($13)
+L.91:
+L.82:
+L.56:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	set_proc_pgrp
+set_proc_pgrp:
+	subui	$sp, $sp, 5
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	lw	$12, 6($sp)
+	sw	$12, 115($13)
+	lw	$13, 5($sp)
+	addui	$13, $13, 129
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.94
+L.96:
+L.99:
+L.102:
+	lw	$13, 5($sp)
+	lw	$12, 129($13)
+	lw	$13, 130($13)
+	sw	$13, 1($12)
+	lw	$13, 5($sp)
+	lw	$12, 130($13)
+	lw	$13, 129($13)
+	sw	$13, 0($12)
+L.103:
+L.100:
+L.105:
+L.108:
+	lw	$13, 5($sp)
+	addui	$7, $13, 129
+	lw	$13, 6($sp)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	la	$12, pgrp_hash
+	addu	$6, $13, $12
+	lw	$13, 6($sp)
+	andi	$13, $13, 63
+	slli	$13, $13, 1
+	lw	$5, pgrp_hash($13)
+	sw	$7, 1($5)
+	sw	$5, 0($7)
+	sw	$6, 1($7)
+	sw	$7, 0($6)
+L.109:
+L.106:
+L.97:
+L.94:
+L.93:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	reparent_children
+reparent_children:
+	subui	$sp, $sp, 7
+	sw	$3, 0($sp)
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.112
+	j	L.111
+L.112:
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xff83
+	lw	$12, 7($sp)
+	lw	$12, 123($12)
+	addu	$7, $12, $13
+	lw	$12, 125($7)
+	addu	$6, $12, $13
+	j	L.117
+L.114:
+	lw	$13, 8($sp)
+	lw	$13, 133($13)
+	sw	$13, 120($7)
+L.118:
+L.121:
+L.124:
+	lw	$13, 125($7)
+	lw	$12, 126($7)
+	sw	$12, 1($13)
+	lw	$13, 126($7)
+	lw	$12, 125($7)
+	sw	$12, 0($13)
+L.125:
+L.122:
+L.127:
+L.130:
+	addui	$5, $7, 125
+	lw	$13, 8($sp)
+	lw	$4, 124($13)
+	lw	$13, 8($sp)
+	addui	$3, $13, 123
+	sw	$5, 1($3)
+	sw	$3, 0($5)
+	sw	$4, 1($5)
+	sw	$5, 0($4)
+L.131:
+L.128:
+L.119:
+L.115:
+	addu	$7, $0, $6
+	lw	$13, 125($6)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff83
+	addu	$6, $13, $12
+L.117:
+	addui	$13, $7, 125
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	addui	$12, $12, 123
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.114
+L.111:
+	lw	$3, 0($sp)
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+proc_slot:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	sgti	$13, $13, 9
+	bnez	$13, L.134
+	addui	$13, $0, 236
+	lw	$12, 4($sp)
+	mult	$13, $13, $12
+	lw	$12, proc_table($0)
+	addu	$1, $13, $12
+	j	L.133
+L.134:
+	lw	$13, 4($sp)
+	subi	$13, $13, 10
+	sw	$13, 4($sp)
+	lw	$13, 4($sp)
+	addui	$12, $0, 8
+	addui	$11, $0, 236
+	rem	$10, $13, $12
+	mult	$11, $11, $10
+	div	$13, $13, $12
+	lw	$13, proc_chunks($13)
+	addu	$1, $11, $13
+L.133:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	next_proc_slot
+next_proc_slot:
+	subui	$sp, $sp, 5
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 133($13)
+	addi	$7, $13, 1
+	sgti	$13, $7, 9
+	bnez	$13, L.137
+	lw	$13, 5($sp)
+	addui	$1, $13, 236
+	j	L.136
+L.137:
+	lw	$13, nr_proc_slots($0)
+	sgt	$13, $7, $13
+	bnez	$13, L.140
+	sw	$7, 0($sp)
+	jal	proc_slot
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	j	L.141
+L.140:
+	addu	$6, $0, $0
+L.141:
+	addu	$1, $0, $6
+L.136:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+grow_proc_table:
+	subui	$sp, $sp, 11
+	sw	$2, 2($sp)
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, nr_proc_slots($0)
+	subi	$13, $13, 9
+	divi	$5, $13, 8
+	slti	$13, $5, 32
+	bnez	$13, L.143
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff5
+	j	L.142
+L.143:
+	lw	$13, proc_chunks($5)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.145
+	addui	$13, $0, 1888
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	get_free_pages
+	addu	$13, $0, $1
+	sw	$13, proc_chunks($5)
+	lw	$13, proc_chunks($5)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.147
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff5
+	j	L.142
+L.147:
+L.145:
+	addu	$6, $0, $0
+L.149:
+	addui	$13, $0, 236
+	mult	$13, $13, $6
+	lw	$12, proc_chunks($5)
+	addu	$7, $13, $12
+	lw	$13, nr_proc_slots($0)
+	addi	$13, $13, 1
+	sw	$13, nr_proc_slots($0)
+	sw	$13, 133($7)
+	sw	$7, 0($sp)
+	jal	proc_set_default
+L.153:
+L.156:
+	addui	$4, $7, 125
+	lw	$3, free_procs+1($0)
+	la	$2, free_procs
+	sw	$4, 1($2)
+	sw	$2, 0($4)
+	sw	$3, 1($4)
+	sw	$4, 0($3)
+L.157:
+L.154:
+L.150:
+	addi	$6, $6, 1
+	slti	$13, $6, 8
+	bnez	$13, L.149
+	addu	$1, $0, $0
+L.142:
+	lw	$2, 2($sp)
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	get_proc
+get_proc:
+	subui	$sp, $sp, 6
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 6($sp)
+	sw	$13, 4($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffd
+	sle	$13, $13, $12
+	bnez	$13, L.161
+	lw	$13, nr_proc_slots($0)
+	lw	$12, 4($sp)
+	sgt	$13, $12, $13
+	bnez	$13, L.161
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	proc_slot
+	addu	$13, $0, $1
+	sw	$13, 5($sp)
+	lw	$13, 131($13)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.163
+	lw	$1, 5($sp)
+	j	L.160
+L.163:
+L.161:
+	addu	$1, $0, $0
+L.160:
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	get_non_zombie_proc
+get_non_zombie_proc:
+	subui	$sp, $sp, 5
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.166
+	lw	$13, 19($7)
+	addu	$13, $0, $13
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.166
+	addu	$1, $0, $7
+	j	L.165
+L.166:
+	addu	$1, $0, $0
+L.165:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	enqueue_tail
+enqueue_tail:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	sw	$13, 7($sp)
+	lw	$12, 80($13)
+	addu	$12, $0, $12
+	sneu	$13, $12, $0
+	bnez	$13, L.171
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	addu	$12, $0, $12
+	sequ	$13, $13, $12
+	bnez	$13, L.171
+	addui	$7, $0, 1
+	j	L.172
+L.171:
+	addu	$7, $0, $0
+L.172:
+	sw	$7, 0($sp)
+	addui	$13, $0, 300
+	sw	$13, 1($sp)
+	la	$13, L.170
+	sw	$13, 2($sp)
+	jal	_assert
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.173
+	lw	$13, 8($sp)
+	lw	$12, 9($sp)
+	sw	$12, 1($13)
+	sw	$12, 0($13)
+	j	L.174
+L.173:
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	lw	$12, 9($sp)
+	sw	$12, 80($13)
+	lw	$13, 8($sp)
+	lw	$12, 9($sp)
+	sw	$12, 1($13)
+L.174:
+	lw	$13, 9($sp)
+	sw	$0, 80($13)
+L.168:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	enqueue_head
+enqueue_head:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	sw	$13, 7($sp)
+	lw	$12, 80($13)
+	addu	$12, $0, $12
+	sneu	$13, $12, $0
+	bnez	$13, L.177
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	addu	$12, $0, $12
+	sequ	$13, $13, $12
+	bnez	$13, L.177
+	addui	$7, $0, 1
+	j	L.178
+L.177:
+	addu	$7, $0, $0
+L.178:
+	sw	$7, 0($sp)
+	addui	$13, $0, 319
+	sw	$13, 1($sp)
+	la	$13, L.170
+	sw	$13, 2($sp)
+	jal	_assert
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.179
+	lw	$13, 9($sp)
+	sw	$0, 80($13)
+	lw	$13, 8($sp)
+	lw	$12, 9($sp)
+	sw	$12, 1($13)
+	sw	$12, 0($13)
+	j	L.180
+L.179:
+	lw	$13, 9($sp)
+	lw	$12, 8($sp)
+	lw	$12, 0($12)
+	sw	$12, 80($13)
+	lw	$13, 8($sp)
+	lw	$12, 9($sp)
+	sw	$12, 0($13)
+L.180:
+L.175:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	dequeue
+dequeue:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 3($sp)
+	lw	$7, 0($13)
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.182
+	addu	$1, $0, $0
+	j	L.181
+L.182:
+	lw	$13, 3($sp)
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.184
+	lw	$13, 3($sp)
+	addu	$12, $0, $0
+	sw	$12, 1($13)
+	sw	$12, 0($13)
+	j	L.185
+L.184:
+	lw	$13, 3($sp)
+	lw	$12, 80($7)
+	sw	$12, 0($13)
+L.185:
+	sw	$0, 80($7)
+	addu	$1, $0, $7
+L.181:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+update_ready_map:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 5
+	lw	$12, 7($sp)
+	sub	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 7($sp)
+	slli	$13, $13, 1
+	lw	$13, ready_q($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.187
+	la	$13, ready_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_set_bit
+	j	L.188
+L.187:
+	la	$13, ready_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_clear_bit
+L.188:
+L.186:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+enqueue_stride:
+	subui	$sp, $sp, 7
+	sw	$7, 0($sp)
+	sw	$10, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	la	$7, stride_q
+	j	L.191
+L.190:
+	lw	$13, 0($7)
+	addui	$7, $13, 80
+L.191:
+	lw	$13, 0($7)
+	sw	$13, 6($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.194
+	lw	$13, 6($sp)
+	lw	$13, 90($13)
+	sw	$13, 5($sp)
+	lw	$12, 7($sp)
+	lw	$12, 90($12)
+	addu	$11, $0, $0
+	subu	$10, $13, $12
+	addu	$10, $0, $10
+	slt	$13, $10, $11
+	bnez	$13, L.190
+	lw	$13, 8($sp)
+	sne	$13, $13, $11
+	bnez	$13, L.194
+	lw	$13, 5($sp)
+	sequ	$13, $13, $12
+	bnez	$13, L.190
+L.194:
+	lw	$13, 7($sp)
+	lw	$12, 0($7)
+	sw	$12, 80($13)
+	lw	$13, 7($sp)
+	sw	$13, 0($7)
+L.189:
+	lw	$7, 0($sp)
+	lw	$10, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+dequeue_stride:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	la	$7, stride_q
+	j	L.197
+L.196:
+	lw	$13, 0($7)
+	addui	$7, $13, 80
+L.197:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.199
+	lw	$13, 4($sp)
+	addu	$13, $0, $13
+	lw	$12, 3($sp)
+	sneu	$13, $12, $13
+	bnez	$13, L.196
+L.199:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.200
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.195
+L.200:
+	lw	$13, 4($sp)
+	lw	$13, 80($13)
+	sw	$13, 0($7)
+	lw	$13, 4($sp)
+	sw	$0, 80($13)
+	addu	$1, $0, $0
+L.195:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	dequeue_schedule
+dequeue_schedule:
+	subui	$sp, $sp, 8
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addu	$6, $0, $0
+	lw	$13, 8($sp)
+	lw	$13, 81($13)
+	slli	$13, $13, 1
+	la	$12, ready_q
+	addu	$5, $13, $12
+	lw	$13, 8($sp)
+	lw	$13, 87($13)
+	snei	$13, $13, 1
+	bnez	$13, L.203
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	dequeue_stride
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.202
+L.203:
+	lw	$7, 0($5)
+	j	L.206
+L.205:
+	addu	$6, $0, $7
+	lw	$7, 80($7)
+L.206:
+	addu	$13, $0, $7
+	sw	$13, 7($sp)
+	lw	$12, 8($sp)
+	addu	$12, $0, $12
+	sequ	$13, $13, $12
+	bnez	$13, L.208
+	lw	$13, 7($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.205
+L.208:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.209
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.202
+L.209:
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.211
+	lw	$13, 80($7)
+	sw	$13, 0($5)
+	j	L.212
+L.211:
+	lw	$13, 80($7)
+	sw	$13, 80($6)
+L.212:
+	lw	$13, 1($5)
+	addu	$13, $0, $13
+	addu	$12, $0, $7
+	sneu	$13, $13, $12
+	bnez	$13, L.213
+	sw	$6, 1($5)
+L.213:
+	sw	$0, 80($7)
+	lw	$13, 8($sp)
+	lw	$13, 81($13)
+	sw	$13, 0($sp)
+	jal	update_ready_map
+	addu	$1, $0, $0
+L.202:
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	dequeue_highest
+dequeue_highest:
+	subui	$sp, $sp, 7
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, ready_map($0)
+	sw	$13, 0($sp)
+	jal	bitmap_first_set
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.216
+	addu	$1, $0, $0
+	j	L.215
+L.216:
+	addui	$13, $0, 5
+	sub	$7, $13, $6
+	slli	$13, $7, 1
+	la	$12, ready_q
+	addu	$13, $13, $12
+	sw	$13, 0($sp)
+	jal	dequeue
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	sw	$7, 0($sp)
+	jal	update_ready_map
+	lw	$1, 6($sp)
+L.215:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	enqueue_schedule
+enqueue_schedule:
+	subui	$sp, $sp, 6
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	age_proc
+	lw	$13, 6($sp)
+	lw	$13, 87($13)
+	snei	$13, $13, 1
+	bnez	$13, L.219
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	enqueue_stride
+	j	L.218
+L.219:
+	lw	$13, 6($sp)
+	lw	$12, 81($13)
+	slli	$12, $12, 1
+	la	$11, ready_q
+	addu	$12, $12, $11
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	jal	enqueue_tail
+	lw	$13, 6($sp)
+	lw	$13, 81($13)
+	sw	$13, 0($sp)
+	jal	update_ready_map
+L.218:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	enqueue_schedule_head
+enqueue_schedule_head:
+	subui	$sp, $sp, 6
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	age_proc
+	lw	$13, 6($sp)
+	lw	$13, 87($13)
+	snei	$13, $13, 1
+	bnez	$13, L.222
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	enqueue_stride
+	j	L.221
+L.222:
+	lw	$13, 6($sp)
+	lw	$12, 81($13)
+	slli	$12, $12, 1
+	la	$11, ready_q
+	addu	$12, $12, $11
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	jal	enqueue_head
+	lw	$13, 6($sp)
+	lw	$13, 81($13)
+	sw	$13, 0($sp)
+	jal	update_ready_map
+L.221:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	zombify
+zombify:
+	subui	$sp, $sp, 5
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	lhi	$11, 0x8000
+	ori	$11, $11, 0x0
+	or	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	dequeue_schedule
+L.224:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	release_zombie
+release_zombie:
+	subui	$sp, $sp, 4
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	lw	$13, 19($13)
+	addu	$13, $0, $13
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.226
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	jal	release_proc_slot
+L.226:
+L.225:
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	release_proc_slot
+release_proc_slot:
+	subui	$sp, $sp, 7
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	jal	unlink_proc
+	lw	$13, 7($sp)
+	sw	$0, 131($13)
+	lw	$13, 7($sp)
+	sw	$0, 114($13)
+	lw	$13, 7($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 19($13)
+L.229:
+L.232:
+	lw	$13, 7($sp)
+	addui	$7, $13, 125
+	la	$6, free_procs
+	lw	$5, free_procs($0)
+	sw	$7, 1($5)
+	sw	$5, 0($7)
+	sw	$6, 1($7)
+	sw	$7, 0($6)
+L.233:
+L.230:
+L.228:
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	get_free_proc_slot
+get_free_proc_slot:
+	subui	$sp, $sp, 5
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, free_procs
+	lw	$12, free_procs($0)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.236
+	jal	grow_proc_table
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.236
+	addu	$1, $0, $0
+	j	L.235
+L.236:
+	lw	$13, free_procs($0)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff83
+	addu	$7, $13, $12
+L.238:
+L.241:
+L.244:
+	lw	$13, 125($7)
+	lw	$12, 126($7)
+	sw	$12, 1($13)
+	lw	$13, 126($7)
+	lw	$12, 125($7)
+	sw	$12, 0($13)
+L.245:
+L.242:
+	sw	$0, 125($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 126($7)
+L.239:
+	sw	$7, 0($sp)
+	jal	proc_set_default
+	sw	$0, 19($7)
+	addui	$13, $0, 1
+	sw	$13, 131($7)
+	jal	get_next_pid
+	addu	$13, $0, $1
+	sw	$13, 114($7)
+	addu	$1, $0, $7
+L.235:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	proc_set_default
+proc_set_default:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$13, 133($13)
+	sw	$13, 6($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 236
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 7($sp)
+	lw	$12, 6($sp)
+	sw	$12, 133($13)
+	lw	$13, 7($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 19($13)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	addui	$13, $0, 13
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 7($sp)
+	addui	$12, $0, 4089
+	sw	$12, 18($13)
+	lw	$13, 7($sp)
+	addui	$12, $0, 8
+	sw	$12, 82($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 33
+	sw	$12, 17($13)
+	lw	$13, 7($sp)
+	lw	$12, 133($13)
+	sw	$12, 200($13)
+L.248:
+	lw	$13, 7($sp)
+	addui	$13, $13, 123
+	sw	$13, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 123
+	sw	$12, 124($13)
+L.249:
+L.251:
+	lw	$13, 7($sp)
+	addui	$13, $13, 125
+	sw	$13, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 125
+	sw	$12, 126($13)
+L.252:
+L.254:
+	lw	$13, 7($sp)
+	addui	$13, $13, 127
+	sw	$13, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 127
+	sw	$12, 128($13)
+L.255:
+L.257:
+	lw	$13, 7($sp)
+	addui	$13, $13, 129
+	sw	$13, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 129
+	sw	$12, 130($13)
+L.258:
+L.260:
+	lw	$13, 7($sp)
+	addui	$13, $13, 67
+	sw	$13, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 67
+	sw	$12, 68($13)
+L.261:
+L.263:
+	lw	$13, 7($sp)
+	addui	$13, $13, 69
+	sw	$13, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 69
+	sw	$12, 70($13)
+L.264:
+	lw	$13, 7($sp)
+	addui	$12, $0, 3
+	sw	$12, 81($13)
+	lw	$13, 7($sp)
+	sw	$0, 87($13)
+	lw	$13, 7($sp)
+	addui	$12, $0, 4096
+	sw	$12, 89($13)
+	lw	$13, 7($sp)
+	addui	$12, $0, 18
+	sw	$12, 213($13)
+L.247:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	alloc_kstack
+alloc_kstack:
+	subui	$sp, $sp, 7
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 1023
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.267
+	addui	$13, $0, 1
+	lw	$12, 8($sp)
+	addu	$12, $0, $12
+	multu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	get_free_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.268
+L.267:
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	kmalloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.268:
+	lw	$13, 8($sp)
+	addu	$13, $13, $7
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	lhi	$13, 0x1234
+	ori	$13, $13, 0x5678
+	sw	$13, 0($7)
+	lw	$13, 7($sp)
+	sw	$7, 22($13)
+	lw	$1, 6($sp)
+L.266:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	set_proc
+set_proc:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$12, 7($sp)
+	sw	$12, 15($13)
+	lw	$13, 6($sp)
+	addui	$13, $13, 94
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 15
+	sw	$13, 2($sp)
+	jal	strlcpy
+L.269:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	kset_ptable
+kset_ptable:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.271
+	lw	$13, 5($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	jal	bitmap_fill
+	lw	$13, 5($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	bitmap_clear_bit
+L.271:
+L.270:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	start_kernel_proc
+start_kernel_proc:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$13, $0, 236
+	lw	$12, 7($sp)
+	lw	$12, 17($12)
+	mult	$13, $13, $12
+	lw	$12, proc_table($0)
+	addu	$7, $13, $12
+	sw	$7, 0($sp)
+	jal	proc_set_default
+	addui	$13, $7, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 1
+	sw	$12, 0($13)
+	sw	$7, 0($sp)
+	lw	$13, 7($sp)
+	lw	$12, 16($13)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	jal	set_proc
+	sw	$7, 0($sp)
+	jal	kset_ptable
+	lw	$13, 7($sp)
+	lw	$13, 18($13)
+	sw	$13, 82($7)
+	sw	$7, 0($sp)
+	lw	$13, 7($sp)
+	lw	$13, 20($13)
+	sw	$13, 1($sp)
+	jal	alloc_kstack
+	addu	$13, $0, $1
+	sw	$13, 13($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x400
+	sw	$13, 21($7)
+	sw	$13, 23($7)
+	la	$13, TEXT_END
+	addu	$13, $0, $13
+	la	$12, TEXT_BEGIN
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	sw	$13, 29($7)
+	lw	$13, 7($sp)
+	lw	$13, 20($13)
+	addu	$13, $0, $13
+	sw	$13, 32($7)
+	lw	$13, 7($sp)
+	lw	$13, 19($13)
+	sw	$13, 81($7)
+	sw	$0, 114($7)
+	sw	$0, 19($7)
+	sw	$7, 0($sp)
+	jal	enqueue_schedule
+	addu	$1, $0, $7
+L.273:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	proc_memctl
+proc_memctl:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 10($sp)
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 8($sp)
+	lw	$13, 11($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.276
+	la	$7, bitmap_set_bit
+	j	L.277
+L.276:
+	la	$7, bitmap_clear_bit
+L.277:
+	sw	$7, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	lw	$13, 7($sp)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.274:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	validate_welf
+validate_welf:
+	subui	$sp, $sp, 3
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0x1996
+	ori	$12, $12, 0x503
+	sequ	$13, $13, $12
+	bnez	$13, L.279
+	addu	$1, $0, $0
+	j	L.278
+L.279:
+	lw	$13, 3($sp)
+	lw	$12, 3($13)
+	lw	$11, 4($13)
+	lw	$13, 5($13)
+	addu	$13, $11, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.281
+	addu	$1, $0, $0
+	j	L.278
+L.281:
+	addui	$1, $0, 1
+L.278:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	peek_mem_welf
+peek_mem_welf:
+	subui	$sp, $sp, 8
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	lw	$12, 3($13)
+	lw	$13, 6($13)
+	addu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$13, 9($sp)
+	lw	$12, 7($sp)
+	add	$13, $13, $12
+	lw	$12, 10($sp)
+	add	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	peek_free_pages
+	addu	$13, $0, $1
+	slt	$13, $13, $0
+	bnez	$13, L.285
+	addui	$7, $0, 1
+	j	L.286
+L.285:
+	addu	$7, $0, $0
+L.286:
+	addu	$1, $0, $7
+L.283:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	alloc_mem_welf
+alloc_mem_welf:
+	subui	$sp, $sp, 14
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$10, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 15($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sw	$13, 13($sp)
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	validate_welf
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.288
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.287
+L.288:
+	lw	$13, 15($sp)
+	lw	$12, 3($13)
+	lw	$13, 6($13)
+	addu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 17($sp)
+	add	$13, $6, $13
+	sw	$13, 12($sp)
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	user_get_free_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.290
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.287
+L.290:
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	subu	$12, $7, $12
+	sw	$12, 16($13)
+	lw	$13, 14($sp)
+	sw	$7, 21($13)
+	lw	$13, 14($sp)
+	sw	$7, 23($13)
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	lw	$12, 16($sp)
+	sw	$12, 1($sp)
+	addui	$12, $0, 2
+	sw	$12, 2($sp)
+	jal	user_get_free_pages
+	addu	$12, $0, $1
+	sw	$12, 22($13)
+	lw	$13, 14($sp)
+	lw	$13, 22($13)
+	lhi	$12, 0x1234
+	ori	$12, $12, 0x5678
+	sw	$12, 0($13)
+	lw	$13, 14($sp)
+	lw	$12, 16($sp)
+	lw	$11, 22($13)
+	addu	$12, $12, $11
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$12, $12, $11
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	subu	$12, $12, $11
+	sw	$12, 13($13)
+	lw	$13, 14($sp)
+	lw	$13, 22($13)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 16($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 15($sp)
+	lw	$12, 3($13)
+	addu	$5, $12, $7
+	sw	$5, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 6($13)
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 15($sp)
+	addui	$12, $13, 6
+	lw	$13, 3($13)
+	lw	$11, 0($12)
+	addu	$13, $13, $11
+	addu	$13, $0, $13
+	sub	$13, $6, $13
+	sw	$13, 11($sp)
+	lw	$13, 14($sp)
+	lw	$12, 0($12)
+	addu	$12, $12, $5
+	sw	$12, 24($13)
+	lw	$13, 14($sp)
+	lw	$12, 24($13)
+	sw	$12, 25($13)
+	lw	$13, 14($sp)
+	lw	$12, 11($sp)
+	lw	$11, 17($sp)
+	lw	$10, 25($13)
+	addu	$11, $11, $10
+	addu	$12, $12, $11
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$12, $12, $11
+	sw	$12, 26($13)
+	lw	$13, 14($sp)
+	lw	$12, 26($13)
+	sw	$12, 27($13)
+	lw	$13, 14($sp)
+	lw	$13, 24($13)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 17($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 14($sp)
+	lw	$12, 15($sp)
+	lw	$12, 5($12)
+	sw	$12, 30($13)
+	lw	$13, 14($sp)
+	lw	$12, 15($sp)
+	lw	$12, 4($12)
+	sw	$12, 29($13)
+	lw	$13, 14($sp)
+	lw	$12, 15($sp)
+	lw	$12, 6($12)
+	sw	$12, 31($13)
+	lw	$13, 14($sp)
+	lw	$12, 15($sp)
+	lw	$12, 2($12)
+	sw	$12, 28($13)
+	lw	$13, 14($sp)
+	lw	$12, 16($sp)
+	addu	$12, $0, $12
+	sw	$12, 32($13)
+	addu	$1, $0, $0
+L.287:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$10, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.global	copy_from_user
+copy_from_user:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.293
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.292
+L.293:
+	lw	$13, 7($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 9($sp)
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 10($sp)
+	addu	$1, $0, $13
+L.292:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	copy_to_user
+copy_to_user:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.296
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.295
+L.296:
+	lw	$13, 7($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 10($sp)
+	addu	$1, $0, $13
+L.295:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	copyto_user_stack
+copyto_user_stack:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$13, 13($13)
+	addu	$7, $12, $13
+	lw	$13, 9($sp)
+	subu	$7, $7, $13
+	sw	$7, 0($sp)
+	lw	$12, 8($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 7($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	subu	$12, $7, $12
+	sw	$12, 13($13)
+	addu	$1, $0, $0
+L.298:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	copyto_user_heap
+copyto_user_heap:
+	subui	$sp, $sp, 8
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$12, 25($13)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	sw	$13, 7($sp)
+	lw	$13, 8($sp)
+	lw	$12, 10($sp)
+	lw	$11, 25($13)
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	lw	$13, 26($13)
+	addu	$13, $0, $13
+	sltu	$13, $12, $13
+	bnez	$13, L.300
+	addu	$1, $0, $0
+	j	L.299
+L.300:
+	lw	$13, 8($sp)
+	lw	$13, 25($13)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 8($sp)
+	addui	$13, $13, 25
+	lw	$12, 10($sp)
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$1, 7($sp)
+L.299:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	task_exit
+task_exit:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	zombify
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x5
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+L.302:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	init_proc
+init_proc:
+	subui	$sp, $sp, 11
+	sw	$2, 1($sp)
+	sw	$3, 2($sp)
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addu	$7, $0, $0
+L.304:
+	slli	$13, $7, 1
+	addu	$12, $0, $0
+	sw	$12, ready_q+1($13)
+	sw	$12, ready_q($13)
+L.305:
+	addi	$7, $7, 1
+	slti	$13, $7, 6
+	bnez	$13, L.304
+	sw	$0, ready_map($0)
+	sw	$0, stride_q($0)
+	addu	$7, $0, $0
+L.309:
+L.313:
+	slli	$13, $7, 1
+	la	$12, pid_hash
+	addu	$13, $13, $12
+	sw	$13, 0($13)
+	slli	$13, $7, 1
+	la	$12, pid_hash
+	addu	$12, $13, $12
+	sw	$12, pid_hash+1($13)
+L.314:
+L.317:
+	slli	$13, $7, 1
+	la	$12, pgrp_hash
+	addu	$13, $13, $12
+	sw	$13, 0($13)
+	slli	$13, $7, 1
+	la	$12, pgrp_hash
+	addu	$12, $13, $12
+	sw	$12, pgrp_hash+1($13)
+L.318:
+L.310:
+	addi	$7, $7, 1
+	slti	$13, $7, 64
+	bnez	$13, L.309
+	addui	$4, $0, 2
+L.321:
+	la	$13, free_procs
+	sw	$13, free_procs($0)
+	sw	$13, free_procs+1($0)
+L.322:
+	addu	$7, $0, $0
+L.325:
+	addui	$13, $0, 236
+	mult	$13, $13, $7
+	la	$12, _proc_table
+	addu	$6, $13, $12
+	sw	$6, 0($sp)
+	jal	proc_set_default
+	sub	$5, $7, $4
+	sw	$5, 133($6)
+	slti	$13, $5, 1
+	bnez	$13, L.329
+L.331:
+L.334:
+	addui	$3, $6, 125
+	lw	$2, free_procs+1($0)
+	la	$13, free_procs
+	sw	$13, 10($sp)
+	lw	$13, 10($sp)
+	sw	$3, 1($13)
+	lw	$13, 10($sp)
+	sw	$13, 0($3)
+	sw	$2, 1($3)
+	sw	$3, 0($2)
+L.335:
+L.332:
+L.329:
+L.326:
+	addi	$7, $7, 1
+	slti	$13, $7, 12
+	bnez	$13, L.325
+	addui	$13, $0, 236
+	mult	$13, $13, $4
+	la	$12, _proc_table
+	addu	$13, $13, $12
+	sw	$13, proc_table($0)
+	addui	$13, $0, 9
+	sw	$13, nr_proc_slots($0)
+	sw	$0, curr_scheduling_proc($0)
+L.303:
+	lw	$2, 1($sp)
+	lw	$3, 2($sp)
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.bss
+free_procs:
+	.space	2
+proc_chunks:
+	.space	32
+_proc_table:
+	.space	2832
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.global	pgrp_hash
+pgrp_hash:
+	.space	128
+.global	pid_hash
+pid_hash:
+	.space	128
+.global	nr_proc_slots
+nr_proc_slots:
+	.space	1
+.extern	block_q 2
+.global	ready_map
+ready_map:
+	.space	1
+.global	stride_q
+stride_q:
+	.space	1
+.global	ready_q
+ready_q:
+	.space	12
+.global	proc_table
+proc_table:
+	.space	1
+.global	curr_syscall_caller
+curr_syscall_caller:
+	.space	1
+.global	curr_scheduling_proc
+curr_scheduling_proc:
+	.space	1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.170:
+	.asciiz	"kernel/proc.c"
+L.20:
+	.asciiz	"TS"
+L.19:
+	.asciiz	"STR"
+L.18:
+	.asciiz	"%-3d %-4d %-2d 0x%08lx 0x%08lx 0x%08lx 0x%08lx %d 0x%08lx %-3d %-3d 0x%03x %-3d %-3s %-5d %s\n"
+L.10:
+	.asciiz	"PID PPID PG RBASE      PC         STACK      HEAP       PROTECTION    RSS VSZ FLAG NI  CLS TIME  NAME    \n"
@@ -12,59 +12,234 @@
  * 
 */
 #include <kernel/kernel.h>
+#include <kernel/clock.h>
 #include <kernel/sched.h>
 #include <winix/ksignal.h>
 #include <winix/timer.h>
+#include <winix/bitmap.h>
+#include <sys/resource.h>
 
 PRIVATE struct timer sched_timer;
 
+// advanced every REBALANCE_TIMEOUT timer interrupts
+PRIVATE unsigned int sched_epoch;
+
+// pass of the SCHED_OTHER class, and the pass of the last user process
+// picked, which processes joining the competition start from
+PRIVATE unsigned int other_pass;
+PRIVATE unsigned int sched_vtime;
+
+// weight of each nice value, every step is about 10% of cpu
+PRIVATE const int nice_weights[2 * NZERO] = {
+ /* -20 */     88761,     71755,     56483,     46273,     36291,
+ /* -15 */     29154,     23254,     18705,     14949,     11916,
+ /* -10 */      9548,      7620,      6100,      4904,      3906,
+ /*  -5 */      3121,      2501,      1991,      1586,      1277,
+ /*   0 */      1024,       820,       655,       526,       423,
+ /*   5 */       335,       272,       215,       172,       137,
+ /*  10 */       110,        87,        70,        56,        45,
+ /*  15 */        36,        29,        23,        18,        15,
+};
+
 void init_sched(){
     memset(&sched_timer, 0, sizeof(struct timer));
+    other_pass = sched_vtime = 0;
     new_timer(SYSTEM, &sched_timer, REBALANCE_TIMEOUT, rebalance_queues);
 }
 
 /**
  * This method is called every REBALANCE_TIMEOUT timer interrupts
- * It effectly moves every processes in the ready queues
- * to the top priority ready queue, refer to Multi-fedback
- * queue scheduling for more details
+ * It starts a new epoch, which effectly moves every user process
+ * back to the DEFAULT_PRIORITY ready queue, refer to Multi-fedback
+ * queue scheduling for more details. Processes are aged lazily by
+ * age_proc(), except those waiting on the lower ready queues, which
+ * would otherwise stay behind until they next run
  *  
  **/
 void rebalance_queues(int proc_nr, clock_t time){
-    struct proc* curr;
-    foreach_proc(curr){
-        curr->priority = DEFAULT_PRIORITY;
-    }
+    struct proc* p;
+    int i;
 
+    sched_epoch++;
+    for(i = DEFAULT_PRIORITY - 1; i >= USER_MIN_PRIORITY; i--){
+        while((p = ready_q[i][HEAD])){
+            dequeue_schedule(p);
+            enqueue_schedule(p);
+        }
+    }
     new_timer(SYSTEM, &sched_timer, REBALANCE_TIMEOUT, rebalance_queues);
 }
 
+/**
+ * set the priority of a user process, along with the quantum of that level
+ * @param who 
+ * @param priority 
+ */
+void set_user_priority(struct proc* who, int priority){
+    who->priority = priority;
+    who->quantum = LEVEL_QUANTUM(priority);
+    who->ticks_left = who->quantum;
+}
+
+/**
+ * Adjust the priority of a user process before it is put on a ready queue
+ * or its priority is changed.
+ * 
+ * If an epoch has passed since it was last aged, the process goes back to
+ * DEFAULT_PRIORITY, which is what rebalance_queues() used to do to every
+ * process at the end of each epoch.
+ * 
+ * If the process is waking up from a receive or wait, the ticks it slept are
+ * added to its sleep credit. Each time the credit covers the quantum of the
+ * level above, the process is moved up a level with a fresh quantum, up to
+ * USER_MAX_PRIORITY, which is above every process that has not slept. As the
+ * remaining quantum is kept across sleeps and the credit is cleared on
+ * demotion, a process that sleeps just before its quantum runs out gains
+ * nothing over a cpu bound one.
+ * @param who 
+ */
+void age_proc(struct proc* who){
+    int credit;
+
+    if(who->sched_policy == SCHED_STRIDE){
+        // a process does not keep the pass it fell behind by while asleep
+        if(PASS_BEFORE(who->pass, sched_vtime))
+            who->pass = sched_vtime;
+        who->flags &= ~PROC_SLEEPING;
+        return;
+    }
+
+    if(who->sched_epoch != sched_epoch){
+        who->sched_epoch = sched_epoch;
+        if(IS_USER_PROC(who)){
+            set_user_priority(who, DEFAULT_PRIORITY);
+            who->sleep_credit = 0;
+        }
+    }
+
+    if(who->flags & PROC_SLEEPING){
+        who->flags &= ~PROC_SLEEPING;
+        credit = who->sleep_credit + (get_uptime() - who->sleep_start);
+        who->sleep_credit = credit < MAX_SLEEP_CREDIT ? credit : MAX_SLEEP_CREDIT;
+
+        while(who->priority < USER_MAX_PRIORITY &&
+                who->sleep_credit >= LEVEL_QUANTUM(who->priority + 1)){
+            who->sleep_credit -= LEVEL_QUANTUM(who->priority + 1);
+            set_user_priority(who, who->priority + 1);
+        }
+    }
+}
+
+/**
+ * set the nice value of a process, which weighs it under SCHED_STRIDE
+ * @param who 
+ * @param nice 
+ */
+void set_nice(struct proc* who, int nice){
+    if(nice < -NZERO)
+        nice = -NZERO;
+    if(nice > NZERO - 1)
+        nice = NZERO - 1;
+    who->nice = nice;
+    who->stride = STRIDE1 / nice_weights[nice + NZERO];
+}
+
+/**
+ * move a user process to another scheduling class, the process must
+ * not be on a ready queue
+ * @param who 
+ * @param policy 
+ */
+void set_sched_policy(struct proc* who, int policy){
+    who->sched_policy = policy;
+    who->flags &= ~PROC_SLEEPING;
+    if(policy == SCHED_STRIDE){
+        who->pass = sched_vtime;
+        who->quantum = DEFAULT_USER_QUANTUM;
+        who->ticks_left = who->quantum;
+    }else{
+        who->sched_epoch = sched_epoch;
+        who->sleep_credit = 0;
+        set_user_priority(who, DEFAULT_PRIORITY);
+    }
+}
+
+/**
+ * charge the ticks a user process ran since it was last charged to its
+ * pass, or to the pass of the SCHED_OTHER class. This is done once the
+ * process blocks or uses up its quantum, so that it keeps the lowest
+ * pass for the rest of the quantum
+ * @param who 
+ */
+PRIVATE void charge_proc(struct proc* who){
+    clock_t used = who->time_used - who->sched_charged;
+
+    who->sched_charged = who->time_used;
+    if(!IS_USER_PROC(who) || !used)
+        return;
+    if(who->sched_policy == SCHED_STRIDE)
+        who->pass += used * who->stride;
+    else
+        other_pass += used * (STRIDE1 / NICE_0_WEIGHT);
+}
+
+/**
+ * a SCHED_STRIDE process gives up the rest of its quantum. It is charged
+ * what it ran and queued by its pass behind the processes of the same
+ * pass, and it starts a fresh quantum the next time it runs
+ * @param who 
+ */
+void yield_stride(struct proc* who){
+    charge_proc(who);
+    who->ticks_left = 0;
+    if(dequeue_schedule(who) == 0)
+        enqueue_schedule(who);
+}
+
 /**
  * Chooses a process to run.
  *
+ * The kernel tasks keep absolute priority over user processes. Among
+ * user processes, the cpu is shared between every SCHED_STRIDE process
+ * and the SCHED_OTHER class as a whole, in proportion to their weights,
+ * by running the one with the lowest pass. Within the SCHED_OTHER class
+ * the highest priority ready queue goes first.
+ *
  * Returns:
  *   The process that is runnable with the highest priority.
  *   NULL if no processes are runnable (should never happen).
  *
  * Side Effects:
- *   A proc is removed from a ready_q.
+ *   A proc is removed from a ready_q or the stride_q.
  **/
 struct proc *pick_proc() {
-    int i;
     struct proc* mp;
+    int bit = bitmap_first_set(ready_map);
+    int priority = bit < 0 ? -1 : MAX_PRIORITY - bit;
 
-    // Find the highest-priority non-empty queue
-    for (i = MAX_PRIORITY; i >= MIN_PRIORITY; i--){
-        if((mp = dequeue(ready_q[i]))){
+    if(stride_q && priority <= USER_MAX_PRIORITY){
+        if(PASS_BEFORE(other_pass, sched_vtime))
+            other_pass = sched_vtime;
+        if(priority < USER_MIN_PRIORITY || PASS_BEFORE(stride_q->pass, other_pass)){
+            mp = stride_q;
+            dequeue_schedule(mp);
+            if(PASS_BEFORE(sched_vtime, mp->pass))
+                sched_vtime = mp->pass;
             return mp;
         }
     }
 
+    // Find the highest-priority non-empty queue through ready_map
+    if((mp = dequeue_highest())){
+        if(IS_USER_PROC(mp) && PASS_BEFORE(sched_vtime, other_pass))
+            sched_vtime = other_pass;
+        return mp;
+    }
+
     PANIC("No procs left");
     return NULL;
 }
 
-
 /**
  * The Scheduler.
  *
@@ -83,20 +258,35 @@ void sched() {
 
     if (curr_scheduling_proc && !curr_scheduling_proc->state) {
 
-        if (curr_scheduling_proc->ticks_left > 0) {
-            enqueue_head(ready_q[curr_scheduling_proc->priority], curr_scheduling_proc);
+        // a process in the stride class has no epoch, it runs to the end of its quantum
+        if (curr_scheduling_proc->ticks_left > 0 && (curr_scheduling_proc->sched_policy == SCHED_STRIDE
+                || curr_scheduling_proc->sched_epoch == sched_epoch)) {
+            enqueue_schedule_head(curr_scheduling_proc);
         }
         else {
             // move the proc down to the lower ready queue, unless this proc
             // if already at the lowest ready queue, for every REBALANCE_TIMEOUT timer interrupts
-            // rebalance_queue is called which bumps every processes in the top
-            // ready queue
-            if(IS_USER_PROC(curr_scheduling_proc) && curr_scheduling_proc->priority > MIN_PRIORITY ){
-                curr_scheduling_proc->priority--;
+            // rebalance_queue starts a new epoch which bumps every processes in the top
+            // ready queue, and the current one queues up behind them
+            charge_proc(curr_scheduling_proc);
+            age_proc(curr_scheduling_proc);
+            if(IS_USER_PROC(curr_scheduling_proc) && curr_scheduling_proc->sched_policy == SCHED_OTHER
+                    && curr_scheduling_proc->ticks_left <= 0){
+                if(curr_scheduling_proc->priority > USER_MIN_PRIORITY)
+                    set_user_priority(curr_scheduling_proc, curr_scheduling_proc->priority - 1);
+                curr_scheduling_proc->sleep_credit = 0;
             }
-            enqueue_tail(ready_q[curr_scheduling_proc->priority], curr_scheduling_proc);
+            enqueue_schedule(curr_scheduling_proc);
             
         }
+    }else if (curr_scheduling_proc) {
+        charge_proc(curr_scheduling_proc);
+        if(IS_USER_PROC(curr_scheduling_proc) && curr_scheduling_proc->sched_policy == SCHED_OTHER &&
+                curr_scheduling_proc->state & (STATE_RECEIVING | STATE_WAITING)){
+            // blocked, credited by age_proc() when it wakes up
+            curr_scheduling_proc->flags |= PROC_SLEEPING;
+            curr_scheduling_proc->sleep_start = get_uptime();
+        }
     }
 
     do{
@@ -116,6 +306,10 @@ void sched() {
         curr_scheduling_proc->ticks_left = curr_scheduling_proc->quantum;
     }
 
+    // nothing to preempt the idle task, sleep until the next timer is due
+    if (IS_IDLE(curr_scheduling_proc))
+        stop_tick();
+
     // irq count is increased for each exception being called, and cleared on exiting
     // exception
     reset_irq_count();
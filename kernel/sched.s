@@ -0,0 +1,753 @@
+.data
+nice_weights:
+	.word	0x15ab9
+	.word	0x1184b
+	.word	0xdca3
+	.word	0xb4c1
+	.word	0x8dc3
+	.word	0x71e2
+	.word	0x5ad6
+	.word	0x4911
+	.word	0x3a65
+	.word	0x2e8c
+	.word	0x254c
+	.word	0x1dc4
+	.word	0x17d4
+	.word	0x1328
+	.word	0xf42
+	.word	0xc31
+	.word	0x9c5
+	.word	0x7c7
+	.word	0x632
+	.word	0x4fd
+	.word	0x400
+	.word	0x334
+	.word	0x28f
+	.word	0x20e
+	.word	0x1a7
+	.word	0x14f
+	.word	0x110
+	.word	0xd7
+	.word	0xac
+	.word	0x89
+	.word	0x6e
+	.word	0x57
+	.word	0x46
+	.word	0x38
+	.word	0x2d
+	.word	0x24
+	.word	0x1d
+	.word	0x17
+	.word	0x12
+	.word	0xf
+.global	init_sched
+.text
+init_sched:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	la	$13, sched_timer
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$13, $0, $0
+	sw	$13, sched_vtime($0)
+	sw	$13, other_pass($0)
+	sw	$0, 0($sp)
+	la	$13, sched_timer
+	sw	$13, 1($sp)
+	addui	$13, $0, 120
+	sw	$13, 2($sp)
+	la	$13, rebalance_queues
+	sw	$13, 3($sp)
+	jal	new_timer
+L.9:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	rebalance_queues
+rebalance_queues:
+	subui	$sp, $sp, 9
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, sched_epoch($0)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	sw	$13, sched_epoch($0)
+	addui	$6, $0, 2
+	j	L.16
+L.15:
+	sw	$7, 0($sp)
+	jal	dequeue_schedule
+	sw	$7, 0($sp)
+	jal	enqueue_schedule
+L.16:
+	slli	$13, $6, 1
+	lw	$13, ready_q($13)
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.15
+L.12:
+	subi	$6, $6, 1
+	sgei	$13, $6, 1
+	bnez	$13, L.16
+	sw	$0, 0($sp)
+	la	$13, sched_timer
+	sw	$13, 1($sp)
+	addui	$13, $0, 120
+	sw	$13, 2($sp)
+	la	$13, rebalance_queues
+	sw	$13, 3($sp)
+	jal	new_timer
+L.10:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	set_user_priority
+set_user_priority:
+	subui	$sp, $sp, 3
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	sw	$12, 81($13)
+	lw	$13, 3($sp)
+	addui	$12, $0, 64
+	lw	$11, 4($sp)
+	sra	$12, $12, $11
+	sw	$12, 82($13)
+	lw	$13, 3($sp)
+	lw	$12, 82($13)
+	sw	$12, 83($13)
+L.18:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	age_proc
+age_proc:
+	subui	$sp, $sp, 10
+	sw	$7, 2($sp)
+	sw	$10, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	lw	$13, 87($13)
+	snei	$13, $13, 1
+	bnez	$13, L.20
+	lw	$13, 10($sp)
+	lw	$13, 90($13)
+	lw	$12, sched_vtime($0)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.22
+	lw	$13, 10($sp)
+	lw	$12, sched_vtime($0)
+	sw	$12, 90($13)
+L.22:
+	lw	$13, 10($sp)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffdf
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.19
+L.20:
+	lw	$13, 10($sp)
+	lw	$13, 84($13)
+	lw	$12, sched_epoch($0)
+	sequ	$13, $13, $12
+	bnez	$13, L.24
+	lw	$13, 10($sp)
+	lw	$12, sched_epoch($0)
+	sw	$12, 84($13)
+	lw	$13, 10($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.26
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	sw	$13, 1($sp)
+	jal	set_user_priority
+	lw	$13, 10($sp)
+	sw	$0, 86($13)
+L.26:
+L.24:
+	lw	$13, 10($sp)
+	lw	$13, 131($13)
+	andi	$13, $13, 32
+	seq	$13, $13, $0
+	bnez	$13, L.28
+	lw	$13, 10($sp)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffdf
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, 10($sp)
+	lw	$11, 10($sp)
+	lw	$11, 86($11)
+	addu	$11, $0, $11
+	lw	$10, 85($12)
+	subu	$13, $13, $10
+	addu	$13, $11, $13
+	addu	$13, $0, $13
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	sgei	$13, $13, 64
+	bnez	$13, L.31
+	lw	$7, 9($sp)
+	j	L.32
+L.31:
+	addui	$7, $0, 64
+L.32:
+	sw	$7, 86($12)
+	j	L.34
+L.33:
+	lw	$13, 10($sp)
+	addui	$12, $13, 86
+	lw	$11, 0($12)
+	addui	$10, $0, 64
+	lw	$13, 81($13)
+	addi	$13, $13, 1
+	sra	$13, $10, $13
+	sub	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 81($13)
+	addi	$13, $13, 1
+	sw	$13, 1($sp)
+	jal	set_user_priority
+L.34:
+	lw	$13, 10($sp)
+	sw	$13, 8($sp)
+	lw	$12, 81($13)
+	sgei	$13, $12, 4
+	bnez	$13, L.36
+	lw	$13, 8($sp)
+	lw	$13, 86($13)
+	addui	$11, $0, 64
+	addi	$12, $12, 1
+	sra	$12, $11, $12
+	sge	$13, $13, $12
+	bnez	$13, L.33
+L.36:
+L.28:
+L.19:
+	lw	$7, 2($sp)
+	lw	$10, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	set_nice
+set_nice:
+	subui	$sp, $sp, 3
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffec
+	sge	$13, $13, $12
+	bnez	$13, L.38
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffec
+	sw	$13, 4($sp)
+L.38:
+	lw	$13, 4($sp)
+	slei	$13, $13, 19
+	bnez	$13, L.40
+	addui	$13, $0, 19
+	sw	$13, 4($sp)
+L.40:
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	sw	$12, 88($13)
+	lw	$13, 3($sp)
+	lhi	$12, 0x40
+	ori	$12, $12, 0x0
+	lw	$11, 4($sp)
+	lw	$11, nice_weights+20($11)
+	div	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 89($13)
+L.37:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	set_sched_policy
+set_sched_policy:
+	subui	$sp, $sp, 6
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$12, 7($sp)
+	sw	$12, 87($13)
+	lw	$13, 6($sp)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffdf
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	snei	$13, $13, 1
+	bnez	$13, L.44
+	lw	$13, 6($sp)
+	lw	$12, sched_vtime($0)
+	sw	$12, 90($13)
+	lw	$13, 6($sp)
+	addui	$12, $0, 8
+	sw	$12, 82($13)
+	lw	$13, 6($sp)
+	lw	$12, 82($13)
+	sw	$12, 83($13)
+	j	L.45
+L.44:
+	lw	$13, 6($sp)
+	lw	$12, sched_epoch($0)
+	sw	$12, 84($13)
+	lw	$13, 6($sp)
+	sw	$0, 86($13)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	sw	$13, 1($sp)
+	jal	set_user_priority
+L.45:
+L.43:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+charge_proc:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	lw	$12, 92($13)
+	lw	$13, 91($13)
+	subu	$7, $12, $13
+	lw	$13, 4($sp)
+	lw	$12, 92($13)
+	sw	$12, 91($13)
+	lw	$13, 4($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.49
+	sneu	$13, $7, $0
+	bnez	$13, L.47
+L.49:
+	j	L.46
+L.47:
+	lw	$13, 4($sp)
+	lw	$13, 87($13)
+	snei	$13, $13, 1
+	bnez	$13, L.50
+	lw	$13, 4($sp)
+	addui	$12, $13, 90
+	lw	$11, 0($12)
+	lw	$13, 89($13)
+	multu	$13, $7, $13
+	addu	$13, $11, $13
+	sw	$13, 0($12)
+	j	L.51
+L.50:
+	lw	$13, other_pass($0)
+	slli	$12, $7, 12
+	addu	$13, $13, $12
+	sw	$13, other_pass($0)
+L.51:
+L.46:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	yield_stride
+yield_stride:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, 3($sp)
+	sw	$13, 0($sp)
+	jal	charge_proc
+	lw	$13, 3($sp)
+	sw	$0, 83($13)
+	lw	$13, 3($sp)
+	sw	$13, 0($sp)
+	jal	dequeue_schedule
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.53
+	lw	$13, 3($sp)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule
+L.53:
+L.52:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	pick_proc
+pick_proc:
+	subui	$sp, $sp, 9
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, ready_map($0)
+	sw	$13, 0($sp)
+	jal	bitmap_first_set
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.57
+	lhi	$5, 0xffff
+	ori	$5, $5, 0xffff
+	j	L.58
+L.57:
+	addui	$13, $0, 5
+	sub	$5, $13, $6
+L.58:
+	sw	$5, 8($sp)
+	lw	$13, stride_q($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.59
+	lw	$13, 8($sp)
+	sgti	$13, $13, 4
+	bnez	$13, L.59
+	lw	$13, other_pass($0)
+	lw	$12, sched_vtime($0)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.61
+	lw	$13, sched_vtime($0)
+	sw	$13, other_pass($0)
+L.61:
+	lw	$13, 8($sp)
+	slti	$13, $13, 1
+	bnez	$13, L.65
+	lw	$13, stride_q($0)
+	lw	$13, 90($13)
+	lw	$12, other_pass($0)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.63
+L.65:
+	lw	$7, stride_q($0)
+	sw	$7, 0($sp)
+	jal	dequeue_schedule
+	lw	$13, sched_vtime($0)
+	lw	$12, 90($7)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.66
+	lw	$13, 90($7)
+	sw	$13, sched_vtime($0)
+L.66:
+	addu	$1, $0, $7
+	j	L.55
+L.63:
+L.59:
+	jal	dequeue_highest
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.68
+	lw	$13, 16($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.70
+	lw	$13, sched_vtime($0)
+	lw	$12, other_pass($0)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.70
+	lw	$13, other_pass($0)
+	sw	$13, sched_vtime($0)
+L.70:
+	addu	$1, $0, $7
+	j	L.55
+L.68:
+	la	$13, L.72
+	sw	$13, 0($sp)
+	la	$13, L.73
+	sw	$13, 1($sp)
+	jal	_panic
+	addu	$1, $0, $0
+L.55:
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	sched
+sched:
+	subui	$sp, $sp, 10
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 9($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.75
+	lw	$13, 9($sp)
+	lw	$13, 19($13)
+	sne	$13, $13, $0
+	bnez	$13, L.75
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 8($sp)
+	lw	$12, 83($13)
+	sle	$13, $12, $0
+	bnez	$13, L.77
+	lw	$13, 8($sp)
+	lw	$13, 87($13)
+	seqi	$13, $13, 1
+	bnez	$13, L.79
+	lw	$13, 8($sp)
+	lw	$13, 84($13)
+	lw	$12, sched_epoch($0)
+	sneu	$13, $13, $12
+	bnez	$13, L.77
+L.79:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule_head
+	j	L.76
+L.77:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	charge_proc
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	age_proc
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 7($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.80
+	addu	$13, $0, $0
+	sw	$13, 6($sp)
+	lw	$12, 7($sp)
+	lw	$12, 87($12)
+	sne	$13, $12, $13
+	bnez	$13, L.80
+	lw	$13, 7($sp)
+	lw	$13, 83($13)
+	lw	$12, 6($sp)
+	sgt	$13, $13, $12
+	bnez	$13, L.80
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 81($13)
+	slei	$13, $13, 1
+	bnez	$13, L.82
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	lw	$13, 81($13)
+	subi	$13, $13, 1
+	sw	$13, 1($sp)
+	jal	set_user_priority
+L.82:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$0, 86($13)
+L.80:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule
+	j	L.76
+L.75:
+	lw	$13, curr_scheduling_proc($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.84
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	charge_proc
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 8($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.86
+	addu	$13, $0, $0
+	sw	$13, 7($sp)
+	lw	$12, 8($sp)
+	lw	$12, 87($12)
+	sne	$13, $12, $13
+	bnez	$13, L.86
+	lw	$13, 8($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 6
+	lw	$12, 7($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.86
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 32
+	sw	$12, 0($13)
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, curr_scheduling_proc($0)
+	sw	$13, 85($12)
+L.86:
+L.84:
+L.76:
+L.88:
+	jal	pick_proc
+	addu	$13, $0, $1
+	sw	$13, curr_scheduling_proc($0)
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	jal	is_sigpending
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.91
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	handle_sig
+L.91:
+L.89:
+	lw	$13, curr_scheduling_proc($0)
+	sw	$13, 8($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.88
+	lw	$13, 8($sp)
+	lw	$13, 19($13)
+	sne	$13, $13, $0
+	bnez	$13, L.88
+	jal	is_debugging_sched
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.93
+	la	$13, L.95
+	sw	$13, 0($sp)
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 133($13)
+	sw	$13, 1($sp)
+	jal	kprintf2
+L.93:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 83($13)
+	sgt	$13, $13, $0
+	bnez	$13, L.96
+	lw	$13, curr_scheduling_proc($0)
+	lw	$12, 82($13)
+	sw	$12, 83($13)
+L.96:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 133($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	sne	$13, $13, $12
+	bnez	$13, L.98
+	jal	stop_tick
+L.98:
+	jal	reset_irq_count
+	jal	wramp_load_context
+L.74:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.bss
+sched_vtime:
+	.space	1
+other_pass:
+	.space	1
+sched_epoch:
+	.space	1
+sched_timer:
+	.space	10
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.95:
+	.asciiz	"|%d| "
+L.73:
+	.asciiz	"kernel/sched.c"
+L.72:
+	.asciiz	"No procs left"
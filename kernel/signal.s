@@ -0,0 +1,585 @@
+.text
+build_signal_ctx:
+	subui	$sp, $sp, 10
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 21
+	sw	$13, 2($sp)
+	jal	copyto_user_stack
+	addui	$13, $0, 9
+	sw	$13, 7($sp)
+	lhi	$13, 0x1ee1
+	ori	$13, $13, 0x1
+	sw	$13, 8($sp)
+	lhi	$13, 0x200d
+	ori	$13, $13, 0x0
+	sw	$13, 9($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 7
+	sw	$13, 1($sp)
+	addui	$13, $0, 3
+	sw	$13, 2($sp)
+	jal	copyto_user_stack
+	lw	$13, 10($sp)
+	lw	$12, 13($13)
+	addui	$12, $12, 1
+	sw	$12, 14($13)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	copyto_user_stack
+	lw	$13, 10($sp)
+	lw	$12, 135($13)
+	sw	$12, 136($13)
+	lw	$13, 10($sp)
+	addui	$12, $0, 3
+	lw	$11, 11($sp)
+	mult	$12, $12, $11
+	addui	$11, $13, 137
+	addu	$12, $12, $11
+	lw	$12, 1($12)
+	sw	$12, 135($13)
+	lw	$13, 10($sp)
+	addui	$12, $0, 3
+	lw	$11, 11($sp)
+	mult	$12, $12, $11
+	addui	$11, $13, 137
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	sw	$12, 15($13)
+	lw	$13, 10($sp)
+	sw	$0, 19($13)
+	lw	$13, 10($sp)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 8
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.9:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+sys_sig_handler:
+	subui	$sp, $sp, 11
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$13, $0, 3
+	lw	$12, 12($sp)
+	mult	$13, $13, $12
+	lw	$12, 11($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 10($sp)
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.13
+	lw	$13, 12($sp)
+	sw	$13, 9($sp)
+	seqi	$13, $13, 17
+	bnez	$13, L.24
+	lw	$13, 9($sp)
+	seqi	$13, $13, 18
+	bnez	$13, L.24
+	lw	$13, 9($sp)
+	seqi	$13, $13, 19
+	bnez	$13, L.17
+	j	L.15
+L.17:
+	lw	$13, 11($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 16
+	seq	$13, $13, $0
+	bnez	$13, L.14
+	lw	$13, 11($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffef
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 11($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, 11($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffd
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfffc
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	set_syscall_reply
+L.20:
+	lw	$13, 11($sp)
+	lw	$13, 19($13)
+	sne	$13, $13, $0
+	bnez	$13, L.14
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule
+	j	L.14
+L.24:
+	lw	$13, 11($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 16
+	sw	$12, 0($13)
+	lw	$13, 11($sp)
+	lw	$12, 12($sp)
+	sw	$12, 113($13)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	dequeue_schedule
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	check_waiting
+	j	L.14
+L.15:
+	la	$13, L.25
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	addui	$12, $13, 94
+	sw	$12, 2($sp)
+	lw	$13, 114($13)
+	sw	$13, 3($sp)
+	jal	klog
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 128
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	exit_proc
+	j	L.14
+L.13:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 1
+	sneu	$13, $13, $12
+	bnez	$13, L.26
+	lw	$13, 12($sp)
+	sw	$13, 8($sp)
+	addui	$12, $0, 6
+	seq	$13, $13, $12
+	bnez	$13, L.30
+	lw	$13, 8($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.28
+L.39:
+	lw	$13, 12($sp)
+	seqi	$13, $13, 20
+	bnez	$13, L.31
+	j	L.28
+L.30:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 128
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	exit_proc
+	j	L.29
+L.31:
+	lw	$13, 11($sp)
+	lw	$13, 123($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff83
+	addu	$13, $13, $12
+	sw	$13, 9($sp)
+	j	L.35
+L.32:
+	lw	$13, 9($sp)
+	lw	$13, 19($13)
+	addu	$13, $0, $13
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.36
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	release_zombie
+	j	L.29
+L.36:
+L.33:
+	lw	$13, 9($sp)
+	lw	$13, 125($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff83
+	addu	$13, $13, $12
+	sw	$13, 9($sp)
+L.35:
+	lw	$13, 9($sp)
+	addui	$13, $13, 125
+	addu	$13, $0, $13
+	lw	$12, 11($sp)
+	addui	$12, $12, 123
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.32
+	j	L.29
+L.28:
+	la	$13, L.38
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	addui	$12, $13, 94
+	sw	$12, 2($sp)
+	lw	$13, 114($13)
+	sw	$13, 3($sp)
+	jal	klog
+L.29:
+L.26:
+L.14:
+	addu	$1, $0, $0
+L.12:
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	handle_sig
+handle_sig:
+	subui	$sp, $sp, 8
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$13, $0, 3
+	lw	$12, 9($sp)
+	mult	$13, $13, $12
+	lw	$12, 8($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	lw	$6, 0($13)
+	lw	$13, 8($sp)
+	addui	$13, $13, 134
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	sigdelset
+	addu	$13, $0, $6
+	sw	$13, 7($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.43
+	addui	$13, $0, 1
+	lw	$12, 7($sp)
+	sneu	$13, $12, $13
+	bnez	$13, L.41
+L.43:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	sys_sig_handler
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.40
+L.41:
+	addui	$13, $0, 3
+	lw	$12, 9($sp)
+	mult	$13, $13, $12
+	lw	$12, 8($sp)
+	addui	$12, $12, 137
+	addu	$7, $13, $12
+	lw	$13, 2($7)
+	andi	$13, $13, 4
+	seq	$13, $13, $0
+	bnez	$13, L.44
+	addui	$13, $7, 1
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	sigaddset
+	j	L.45
+L.44:
+	addui	$13, $7, 1
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	sigdelset
+L.45:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	build_signal_ctx
+	lw	$13, 2($7)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.46
+	sw	$0, 0($7)
+L.46:
+	addu	$1, $0, $0
+L.40:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	send_sig
+send_sig:
+	subui	$sp, $sp, 16
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 16($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.49
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.48
+L.49:
+	lw	$13, 16($sp)
+	addui	$13, $13, 135
+	sw	$13, 0($sp)
+	lw	$13, 17($sp)
+	sw	$13, 1($sp)
+	jal	sigismember
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.51
+	lw	$13, 17($sp)
+	sw	$13, 15($sp)
+	seqi	$13, $13, 9
+	bnez	$13, L.53
+	lw	$13, 15($sp)
+	seqi	$13, $13, 17
+	bnez	$13, L.53
+	sw	$0, 14($sp)
+	addui	$13, $0, 3
+	lw	$12, 17($sp)
+	mult	$13, $13, $12
+	lw	$12, 16($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	addui	$12, $0, 1
+	sequ	$13, $13, $12
+	bnez	$13, L.55
+	lw	$13, 16($sp)
+	addui	$13, $13, 134
+	sw	$13, 0($sp)
+	lw	$13, 17($sp)
+	sw	$13, 1($sp)
+	jal	sigaddset
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+L.55:
+	lw	$1, 14($sp)
+	j	L.48
+L.53:
+L.51:
+	lw	$13, 16($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 4
+	seq	$13, $13, $0
+	bnez	$13, L.57
+	sw	$0, 9($sp)
+	lw	$13, 16($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffb
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	sw	$0, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfffc
+	sw	$13, 1($sp)
+	lw	$13, 16($sp)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 8
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+L.57:
+	lw	$13, 16($sp)
+	addui	$13, $13, 134
+	sw	$13, 0($sp)
+	lw	$13, 17($sp)
+	sw	$13, 1($sp)
+	jal	sigaddset
+	addu	$1, $0, $0
+L.48:
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.global	is_sigpending
+is_sigpending:
+	subui	$sp, $sp, 8
+	sw	$4, 0($sp)
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	lw	$5, 134($13)
+	lw	$13, 8($sp)
+	lw	$4, 135($13)
+	sequ	$13, $5, $0
+	bnez	$13, L.61
+	sequ	$13, $5, $4
+	bnez	$13, L.61
+	addui	$7, $0, 1
+L.63:
+	addui	$13, $0, 1
+	sll	$6, $13, $7
+	addu	$13, $0, $6
+	sw	$13, 7($sp)
+	addu	$12, $0, $0
+	and	$11, $5, $13
+	sequ	$13, $11, $12
+	bnez	$13, L.67
+	lw	$13, 7($sp)
+	and	$13, $4, $13
+	sneu	$13, $13, $12
+	bnez	$13, L.67
+	addu	$1, $0, $7
+	j	L.60
+L.67:
+L.64:
+	addi	$7, $7, 1
+	slti	$13, $7, 21
+	bnez	$13, L.63
+L.61:
+	addu	$1, $0, $0
+L.60:
+	lw	$4, 0($sp)
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	handle_pendingsig
+handle_pendingsig:
+	subui	$sp, $sp, 9
+	sw	$7, 2($sp)
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	sw	$0, 0($13)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	is_sigpending
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.70
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	handle_sig
+	addu	$13, $0, $0
+	sw	$13, 8($sp)
+	lw	$12, 10($sp)
+	seq	$13, $12, $13
+	bnez	$13, L.72
+	lw	$13, 9($sp)
+	sw	$13, 7($sp)
+	lw	$12, 19($13)
+	lw	$11, 8($sp)
+	sne	$13, $12, $11
+	bnez	$13, L.72
+	lw	$13, 7($sp)
+	lw	$13, 131($13)
+	andi	$13, $13, 8
+	lw	$12, 8($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.72
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule
+L.72:
+L.70:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	addui	$12, $0, 3
+	sw	$12, 0($13)
+	addu	$1, $0, $7
+L.69:
+	lw	$7, 2($sp)
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.38:
+	.asciiz	"Signal %d ignored by process \"%s [%d]\"\n"
+L.25:
+	.asciiz	"Signal %d: terminate process \"%s [%d]\"\n"
@@ -0,0 +1,11 @@
+/**
+ * Wall clock of the host, kept apart from the kernel headers
+ * whose clock_t is not the one of <time.h>
+*/
+#include <time.h>
+
+unsigned long host_time_ns(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000UL + now.tv_nsec;
+}
@@ -0,0 +1,165 @@
+/**
+ * Mock kernel for the host scheduler simulator, every symbol the
+ * scheduler, timer and IPC code need besides themselves
+*/
+#include <kernel/kernel.h>
+#include <kernel/clock.h>
+#include <kernel/exception.h>
+#include <kernel/table.h>
+#include <winix/ksignal.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include "sim.h"
+
+unsigned int TEXT_BEGIN, DATA_BEGIN, BSS_BEGIN;
+unsigned int TEXT_END, DATA_END, BSS_END;
+
+const char *syscall_str[_NSYSCALL];
+
+unsigned long nr_switches;
+PRIVATE struct proc* last_loaded;
+
+/**
+ * synthetic tick source, stands in for kernel/clock.c
+ */
+PRIVATE clock_t system_uptime;
+PUBLIC clock_t next_timeout = TIMER_NEVER;
+
+void sim_clock_reset(){
+    system_uptime = 0;
+    next_timeout = TIMER_NEVER;
+    nr_switches = 0;
+    last_loaded = NULL;
+}
+
+clock_t get_uptime(){
+    return system_uptime;
+}
+
+void do_ticks(){
+    struct timer* next_timer;
+
+    if(next_timeout > system_uptime)
+        return;
+    while((next_timer = dequeue_alarm(system_uptime))){
+        next_timer->handler(next_timer->proc_nr,next_timer->time_out);
+    }
+}
+
+/**
+ * the same accounting clock_handler() does for each timer interrupt,
+ * minus the call to sched()
+ */
+void sim_clock_tick(){
+    system_uptime++;
+    curr_scheduling_proc->time_used++;
+    curr_scheduling_proc->ticks_left--;
+    do_ticks();
+}
+
+/**
+ * the simulator keeps ticking while idle, so that every policy
+ * is measured over the same number of ticks
+ */
+void stop_tick(){
+}
+
+void restart_tick(){
+}
+
+/**
+ * mock context switch, sched() returns to the simulator instead
+ */
+void wramp_load_context(){
+    if(curr_scheduling_proc != last_loaded){
+        nr_switches++;
+        last_loaded = curr_scheduling_proc;
+    }
+    sim_switch(curr_scheduling_proc);
+}
+
+void reset_irq_count(){
+}
+
+int is_debugging_ipc(){
+    return 0;
+}
+
+int is_debugging_sched(){
+    return 0;
+}
+
+int is_sigpending(struct proc* who){
+    return 0;
+}
+
+int handle_sig(struct proc* who, int signum){
+    return 0;
+}
+
+int set_syscall_reply(struct proc* who, int ret, int syscall_num){
+    who->ctx.m.regs[0] = ret;
+    return 0;
+}
+
+int wramp_syscall(int num, ...){
+    return -ENOSYS;
+}
+
+void* kmalloc(size_t nitimes, size_t size){
+    return calloc(nitimes, size);
+}
+
+void kfree(void *ptr){
+    free(ptr);
+}
+
+int align_page(int len){
+    return (len + PAGE_LEN - 1) / PAGE_LEN;
+}
+
+int peek_free_pages(int length, int flags){
+    return -ENOMEM;
+}
+
+ptr_t* user_get_free_pages(struct proc* who, int length, int flags){
+    return NULL;
+}
+
+bool is_vaddr_ok(vptr_t* addr, size_t len, struct proc* who){
+    return true;
+}
+
+void* get_pc_ptr(struct proc* who){
+    return NULL;
+}
+
+int kprintf2(const char *format, ...){
+    int ret;
+    va_list args;
+    va_start(args, format);
+    ret = vprintf(format, args);
+    va_end(args);
+    return ret;
+}
+
+int filp_kprint(struct filp* dev, const char* format, ...){
+    int ret;
+    va_list args;
+    va_start(args, format);
+    ret = vprintf(format, args);
+    va_end(args);
+    return ret;
+}
+
+void _assert(int expression, int line, char* filename) {
+    if(!expression) {
+        fprintf(stderr, "\nAssert Failed at line %d in %s\n",line,filename);
+        abort();
+    }
+}
+
+void _panic(const char* str, const char* file) {
+    fprintf(stderr, "\nPanic in %s: %s\n", file, str);
+    abort();
+}
@@ -0,0 +1,517 @@
+/**
+ * Host scheduler simulator
+ *
+ * Replays workload scripts against the real scheduler, timer and IPC
+ * code under each scheduling policy, and reports wakeup latency,
+ * throughput and fairness. One loop iteration of the simulator is one
+ * timer interrupt; the current process runs the operations of its
+ * script until it blocks or reaches a run operation, which uses the
+ * cpu until the next tick.
+ *
+ * Usage: schedsim [-v] [-p policy] workload...
+ *   -v     also report every group of processes
+*/
+#include <kernel/kernel.h>
+#include <kernel/clock.h>
+#include <kernel/sched.h>
+#include <kernel/table.h>
+#include <winix/timer.h>
+#include <sys/resource.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+struct sim_policy{
+    const char *name;
+    void (*setup)(struct proc* who, struct sim_group* group);    // called on each process before it is queued
+};
+
+struct sim_result{
+    double latency_avg;
+    clock_t latency_max;
+    double throughput;
+    double fairness;
+    double switches;
+    double sched_ns;
+};
+
+PRIVATE void mlfq_setup(struct proc* who, struct sim_group* group){
+}
+
+/**
+ * every process in the stride class, weighted by the nice value of its group
+ */
+PRIVATE void stride_setup(struct proc* who, struct sim_group* group){
+    set_nice(who, group->nice);
+    set_sched_policy(who, SCHED_STRIDE);
+}
+
+/**
+ * the nice value and scheduling class given by the script
+ */
+PRIVATE void script_setup(struct proc* who, struct sim_group* group){
+    set_nice(who, group->nice);
+    set_sched_policy(who, group->policy);
+}
+
+PRIVATE struct sim_policy policies[] = {
+    {"mlfq",        mlfq_setup},
+    {"stride",      stride_setup},
+    {"script",      script_setup},
+};
+
+PRIVATE struct sim_proc sim_procs[MAX_PROCS];
+PRIVATE struct sim_proc* sim_proc_table[MAX_PROCS + 1];   // indexed by proc_nr
+PRIVATE int nr_sim_procs;
+
+PRIVATE unsigned long nr_sched;
+PRIVATE unsigned long sched_ns;
+
+PRIVATE void sim_idle_main(){
+}
+
+PRIVATE struct boot_image idle_task = {"idle", sim_idle_main, IDLE, 1, MIN_PRIORITY, 50};
+
+PRIVATE struct sim_proc* get_sim_proc(struct proc* who){
+    if(IS_USER_PROC(who) && who->proc_nr > 0 && who->proc_nr <= MAX_PROCS)
+        return sim_proc_table[who->proc_nr];
+    return NULL;
+}
+
+/**
+ * called by the mock context switch, a process that was woken up is
+ * now being run
+ * @param who
+ */
+void sim_switch(struct proc* who){
+    struct sim_proc* sp = get_sim_proc(who);
+    clock_t latency;
+
+    if(sp && sp->woken){
+        latency = get_uptime() - sp->woken_at;
+        sp->latency_sum += latency;
+        if(latency > sp->latency_max)
+            sp->latency_max = latency;
+        sp->wakeups++;
+        sp->woken = false;
+    }
+}
+
+/**
+ * note the time every blocked process becomes runnable, this is
+ * called before every sched()
+ */
+PRIVATE void track_wakeups(){
+    struct sim_proc* sp;
+    int i;
+
+    for(i = 0; i < nr_sim_procs; i++){
+        sp = &sim_procs[i];
+        if(sp->proc->state){
+            sp->blocked = true;
+        }else if(sp->blocked){
+            sp->blocked = false;
+            sp->woken = true;
+            sp->woken_at = get_uptime();
+        }
+    }
+}
+
+PRIVATE void sim_sched(){
+    unsigned long start;
+
+    track_wakeups();
+    start = host_time_ns();
+    sched();
+    sched_ns += host_time_ns() - start;
+    nr_sched++;
+}
+
+/**
+ * timer handler of OP_SLEEP, the system task replies to the sleeping
+ * process just as _wakeup_process() does for nanosleep(2)
+ */
+PRIVATE void sim_wakeup(int proc_nr, clock_t time){
+    struct message m;
+    memset(&m, 0, sizeof(m));
+    m.type = NANOSLEEP;
+    do_notify(SYSTEM, proc_nr, &m);
+}
+
+/**
+ * run the operations of the current process up to its next OP_RUN,
+ * switching to the next process whenever the current one blocks
+ */
+PRIVATE void step(){
+    struct sim_proc* sp;
+    struct sim_op* op;
+    struct proc* who;
+    struct sim_proc* peer;
+
+    while((sp = get_sim_proc(curr_scheduling_proc))){
+        who = sp->proc;
+        op = &sp->group->ops[sp->pc];
+        if(op->type == OP_RUN){
+            if(sp->remaining <= 0)
+                sp->remaining = op->arg;
+            return;
+        }
+
+        // an operation is done once it is started, blocking or not
+        sp->pc = (sp->pc + 1) % sp->group->nr_ops;
+        switch(op->type){
+            case OP_SLEEP:
+                who->message = &sp->msg;
+                who->state |= STATE_RECEIVING;
+                new_timer(who->proc_nr, &who->timer, op->arg, sim_wakeup);
+                break;
+            case OP_SEND:
+                peer = sim_procs + op->arg + sp->index % sim_procs[op->arg].group->count;
+                sp->msg.type = 0;
+                do_send(who, peer->proc->proc_nr, &sp->msg);
+                break;
+            case OP_RECV:
+                do_receive(&sp->msg);
+                break;
+            case OP_LOOP:
+                sp->loops++;
+                break;
+        }
+        if(who->state)
+            sim_sched();
+    }
+}
+
+PRIVATE void tick(){
+    struct sim_proc* sp = get_sim_proc(curr_scheduling_proc);
+
+    sim_clock_tick();
+    if(sp && --sp->remaining <= 0)
+        sp->pc = (sp->pc + 1) % sp->group->nr_ops;
+    sim_sched();
+}
+
+/**
+ * give the processes of the workload a fresh kernel
+ */
+PRIVATE void boot(struct sim_workload* wl, struct sim_policy* policy){
+    struct sim_group* group;
+    struct sim_proc* sp;
+    struct proc* who;
+    int i, j;
+
+    // drop the timers of the last run, sched_timer is always pending
+    sim_clock_reset();
+    init_timer();
+    init_proc();
+    init_sched();
+    start_kernel_proc(&idle_task);
+
+    memset(sim_procs, 0, sizeof(sim_procs));
+    memset(sim_proc_table, 0, sizeof(sim_proc_table));
+    nr_sim_procs = 0;
+    nr_sched = sched_ns = 0;
+
+    for(i = 0; i < wl->nr_groups; i++){
+        group = &wl->groups[i];
+        for(j = 0; j < group->count; j++){
+            who = get_free_proc_slot();
+            ASSERT(who != NULL);
+            strlcpy(who->name, group->name, PROC_NAME_LEN);
+            // any base address makes it a user process
+            who->ctx.rbase = (reg_t *)PAGE_LEN;
+            policy->setup(who, group);
+
+            sp = &sim_procs[nr_sim_procs++];
+            sp->proc = who;
+            sp->group = group;
+            sp->index = j;
+            sim_proc_table[who->proc_nr] = sp;
+            enqueue_schedule(who);
+        }
+    }
+    sim_sched();
+}
+
+/**
+ * Jain's fairness index of the cpu time of every group, the
+ * lowest one is reported. 1 means every process of a group got
+ * the same share of cpu
+ */
+PRIVATE double fairness(struct sim_workload* wl){
+    double sum, sum_sq, x, index, worst = 1;
+    int i, j;
+
+    for(i = 0; i < wl->nr_groups; i++){
+        sum = sum_sq = 0;
+        for(j = 0; j < nr_sim_procs; j++){
+            if(sim_procs[j].group != &wl->groups[i])
+                continue;
+            x = sim_procs[j].proc->time_used;
+            sum += x;
+            sum_sq += x * x;
+        }
+        index = sum_sq ? (sum * sum) / (wl->groups[i].count * sum_sq) : 1;
+        if(index < worst)
+            worst = index;
+    }
+    return worst;
+}
+
+PRIVATE void run_workload(struct sim_workload* wl, struct sim_policy* policy, struct sim_result* res){
+    unsigned long wakeups = 0, latency = 0, loops = 0;
+    struct sim_proc* sp;
+    clock_t now;
+    int i;
+
+    boot(wl, policy);
+    for(now = 0; now < wl->duration; now++){
+        step();
+        tick();
+    }
+
+    memset(res, 0, sizeof(*res));
+    for(i = 0; i < nr_sim_procs; i++){
+        sp = &sim_procs[i];
+        wakeups += sp->wakeups;
+        latency += sp->latency_sum;
+        loops += sp->loops;
+        if(sp->latency_max > res->latency_max)
+            res->latency_max = sp->latency_max;
+    }
+    res->latency_avg = wakeups ? (double)latency / wakeups : 0;
+    res->throughput = loops * 1000.0 / wl->duration;
+    res->fairness = fairness(wl);
+    res->switches = nr_switches * 1000.0 / wl->duration;
+    res->sched_ns = nr_sched ? (double)sched_ns / nr_sched : 0;
+}
+
+/**
+ * cpu share, wakeup latency and throughput of each group of the last run
+ */
+PRIVATE void report_groups(struct sim_workload* wl){
+    unsigned long wakeups, latency, loops, cpu;
+    clock_t latency_max;
+    struct sim_proc* sp;
+    int i, j;
+
+    for(i = 0; i < wl->nr_groups; i++){
+        wakeups = latency = loops = cpu = latency_max = 0;
+        for(j = 0; j < nr_sim_procs; j++){
+            sp = &sim_procs[j];
+            if(sp->group != &wl->groups[i])
+                continue;
+            wakeups += sp->wakeups;
+            latency += sp->latency_sum;
+            loops += sp->loops;
+            cpu += sp->proc->time_used;
+            if(sp->latency_max > latency_max)
+                latency_max = sp->latency_max;
+        }
+        printf("  %-19s %8.2f %8ld %8.1f %5.1f%% cpu\n", wl->groups[i].name,
+            wakeups ? (double)latency / wakeups : 0, (long)latency_max,
+            loops * 1000.0 / wl->duration, cpu * 100.0 / wl->duration);
+    }
+}
+
+PRIVATE struct sim_group* find_group(struct sim_workload* wl, const char* name){
+    int i;
+    for(i = 0; i < wl->nr_groups; i++){
+        if(strcmp(wl->groups[i].name, name) == 0)
+            return &wl->groups[i];
+    }
+    return NULL;
+}
+
+PRIVATE int parse_op(struct sim_op* op, char* str, char* target){
+    char name[SIM_NAME_LEN];
+    int arg;
+
+    if(sscanf(str, " run %d", &arg) == 1 && arg > 0){
+        op->type = OP_RUN;
+    }else if(sscanf(str, " sleep %d", &arg) == 1 && arg > 0){
+        op->type = OP_SLEEP;
+    }else if(sscanf(str, " send %31s", name) == 1){
+        op->type = OP_SEND;
+        strlcpy(target, name, SIM_NAME_LEN);
+        arg = 0;
+    }else if(sscanf(str, " %31s", name) == 1 && strcmp(name, "recv") == 0){
+        op->type = OP_RECV;
+        arg = 0;
+    }else if(sscanf(str, " %31s", name) == 1 && strcmp(name, "loop") == 0){
+        op->type = OP_LOOP;
+        arg = 0;
+    }else{
+        return -EINVAL;
+    }
+    op->arg = arg;
+    return 0;
+}
+
+PRIVATE int parse_group(struct sim_group* group, char* str){
+    char word[SIM_NAME_LEN];
+    int count, len;
+
+    if(sscanf(str, " proc %31s %d%n", group->name, &count, &len) != 2 || count <= 0)
+        return -EINVAL;
+    group->count = count;
+    group->policy = SCHED_OTHER;
+    str += len;
+    while(sscanf(str, " %31s%n", word, &len) == 1){
+        str += len;
+        if(strcmp(word, "stride") == 0){
+            group->policy = SCHED_STRIDE;
+        }else if(strcmp(word, "nice") == 0 && sscanf(str, " %d%n", &group->nice, &len) == 1){
+            str += len;
+            if(group->nice < -NZERO || group->nice >= NZERO)
+                return -EINVAL;
+        }else{
+            return -EINVAL;
+        }
+    }
+    return 0;
+}
+
+/**
+ * parse a workload script, each line is one of
+ *   duration TICKS
+ *   proc NAME COUNT [nice N] [stride]: OP; OP; ...
+ * where OP is run TICKS, sleep TICKS, send NAME, recv or loop,
+ * and # starts a comment. The nice value and class of a group are
+ * only used by the script policy, and nice by the stride policy
+ * @return 0 on success
+ */
+PRIVATE int load_workload(struct sim_workload* wl, const char* path){
+    static char targets[SIM_GROUPS_MAX][SIM_OPS_MAX][SIM_NAME_LEN];
+    char line[256], *ops, *str, *base;
+    struct sim_group* group, *peer;
+    int lineno = 0, nr_procs = 0, count, i, j;
+    bool has_run;
+    long duration;
+    FILE* file;
+
+    if(!(file = fopen(path, "r"))){
+        perror(path);
+        return -ENOENT;
+    }
+    memset(wl, 0, sizeof(*wl));
+    memset(targets, 0, sizeof(targets));
+    base = strrchr(path, '/');
+    strlcpy(wl->name, base ? base + 1 : path, SIM_NAME_LEN);
+    if((str = strrchr(wl->name, '.')))
+        *str = '\0';
+    wl->duration = 10000;
+
+    while(fgets(line, sizeof(line), file)){
+        lineno++;
+        if((str = strchr(line, '#')))
+            *str = '\0';
+        if(sscanf(line, " duration %ld", &duration) == 1){
+            if(duration <= 0)
+                goto err;
+            wl->duration = duration;
+            continue;
+        }
+        if(!(ops = strchr(line, ':'))){
+            if(strspn(line, " \t\r\n") != strlen(line))
+                goto err;
+            continue;
+        }
+        *ops++ = '\0';
+        if(wl->nr_groups >= SIM_GROUPS_MAX)
+            goto err;
+        group = &wl->groups[wl->nr_groups];
+        if(parse_group(group, line))
+            goto err;
+        nr_procs += group->count;
+        if(nr_procs > MAX_PROCS)
+            goto err;
+
+        has_run = false;
+        for(str = strtok(ops, ";\r\n"); str; str = strtok(NULL, ";\r\n")){
+            if(strspn(str, " \t") == strlen(str))
+                continue;
+            if(group->nr_ops >= SIM_OPS_MAX)
+                goto err;
+            if(parse_op(&group->ops[group->nr_ops], str, targets[wl->nr_groups][group->nr_ops]))
+                goto err;
+            has_run |= group->ops[group->nr_ops].type == OP_RUN;
+            group->nr_ops++;
+        }
+        // every process must use the cpu at some point, or a tick would never end
+        if(!has_run)
+            goto err;
+        wl->nr_groups++;
+    }
+    fclose(file);
+
+    for(i = 0; i < wl->nr_groups; i++){
+        group = &wl->groups[i];
+        for(j = 0; j < group->nr_ops; j++){
+            if(group->ops[j].type != OP_SEND)
+                continue;
+            if(!(peer = find_group(wl, targets[i][j]))){
+                fprintf(stderr, "%s: unknown proc %s\n", path, targets[i][j]);
+                return -EINVAL;
+            }
+            // index of the first process of the group
+            for(count = 0; peer != wl->groups; peer--)
+                count += peer[-1].count;
+            group->ops[j].arg = count;
+        }
+    }
+    return wl->nr_groups ? 0 : -EINVAL;
+
+err:
+    fprintf(stderr, "%s:%d: invalid line\n", path, lineno);
+    fclose(file);
+    return -EINVAL;
+}
+
+PRIVATE void usage(){
+    int i;
+    fprintf(stderr, "usage: schedsim [-v] [-p policy] workload...\npolicies:");
+    for(i = 0; i < ARRAY_SIZE(policies); i++)
+        fprintf(stderr, " %s", policies[i].name);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+int main(int argc, char** argv){
+    static struct sim_workload wl;
+    struct sim_result res;
+    const char* only = NULL;
+    bool verbose = false;
+    int i, j, ret = 0;
+
+    for(i = 1; i < argc && argv[i][0] == '-'; i++){
+        if(strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            only = argv[++i];
+        else if(strcmp(argv[i], "-v") == 0)
+            verbose = true;
+        else
+            usage();
+    }
+    if(i == argc)
+        usage();
+
+    printf("%-10s %-10s %8s %8s %8s %6s %8s %9s\n",
+        "workload", "policy", "lat_avg", "lat_max", "thru/1k", "fair", "sw/1k", "ns/sched");
+    for(; i < argc; i++){
+        if(load_workload(&wl, argv[i])){
+            ret = 1;
+            continue;
+        }
+        for(j = 0; j < ARRAY_SIZE(policies); j++){
+            if(only && strcmp(only, policies[j].name))
+                continue;
+            run_workload(&wl, &policies[j], &res);
+            printf("%-10s %-10s %8.2f %8ld %8.1f %6.3f %8.1f %9.1f\n",
+                wl.name, policies[j].name, res.latency_avg, (long)res.latency_max,
+                res.throughput, res.fairness, res.switches, res.sched_ns);
+            if(verbose)
+                report_groups(&wl);
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,74 @@
+/**
+ * Host scheduler simulator
+ *
+ * The real scheduler, timer and IPC code are linked against a mock
+ * context switch and a synthetic tick source, and driven by workload
+ * scripts, see kernel/sim/workloads
+*/
+#ifndef _SIM_SIM_H_
+#define _SIM_SIM_H_ 1
+
+#include <kernel/kernel.h>
+
+#define SIM_OPS_MAX         16
+#define SIM_GROUPS_MAX      NUM_PROCS
+#define SIM_NAME_LEN        32
+
+// operations of a workload script
+#define OP_RUN              1   /* use the cpu for arg ticks */
+#define OP_SLEEP            2   /* block for arg ticks, like nanosleep(2) */
+#define OP_SEND             3   /* send to the process of group arg */
+#define OP_RECV             4   /* receive from anyone */
+#define OP_LOOP             5   /* start over, counted as one unit of work */
+
+struct sim_op{
+    int type;
+    int arg;
+};
+
+struct sim_group{
+    char name[SIM_NAME_LEN];
+    int count;
+    int nice;                   // nice value and scheduling class, see nice(1)
+    int policy;
+    int nr_ops;
+    struct sim_op ops[SIM_OPS_MAX];
+};
+
+struct sim_workload{
+    char name[SIM_NAME_LEN];
+    clock_t duration;
+    int nr_groups;
+    struct sim_group groups[SIM_GROUPS_MAX];
+};
+
+struct sim_proc{
+    struct proc* proc;
+    struct sim_group* group;
+    int index;                  // index within the group
+    int pc;                     // next op
+    int remaining;              // ticks left of the current OP_RUN
+    struct message msg;
+
+    bool blocked;
+    bool woken;                 // woken up and not run yet
+    clock_t woken_at;
+    unsigned long loops;
+    unsigned long wakeups;
+    unsigned long latency_sum;
+    clock_t latency_max;
+};
+
+// mock.c
+extern unsigned long nr_switches;
+void sim_clock_reset();
+void sim_clock_tick();
+void do_ticks();
+
+// host_clock.c
+unsigned long host_time_ns();
+
+// schedsim.c
+void sim_switch(struct proc* who);
+
+#endif
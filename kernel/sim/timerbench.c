@@ -0,0 +1,260 @@
+/**
+ * Host timer benchmark
+ *
+ * Keeps thousands of timers pending in winix/timer.c, the way nanosleep,
+ * alarm and interval timers do, and compares the cost of setting,
+ * cancelling and running them against the sorted list the timer module
+ * used before. Every timer is checked to go off on the tick it is due.
+ * With slack, timers are lined up as slack_deadline() does for prctl(2),
+ * and fewer ticks have timers to run.
+ *
+ * Usage: timerbench [-n timers] [-t ticks] [-s slack ticks]
+*/
+#include <kernel/kernel.h>
+#include <kernel/clock.h>
+#include <winix/timer.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+// timers cancelled and set again on every tick, like setitimer(2)
+#define RESETS_PER_TICK     4
+
+struct bench_impl{
+    const char *name;
+    void (*init)();
+    void (*insert)(struct timer *timer);
+    void (*remove)(struct timer *timer);
+    struct timer* (*dequeue)(clock_t now);
+};
+
+struct bench_result{
+    unsigned long fired;
+    unsigned long busy_ticks;           // ticks that ran timers
+    unsigned long checksum;
+    unsigned long insert_ns, nr_insert;
+    unsigned long remove_ns, nr_remove;
+    unsigned long tick_ns;
+};
+
+PRIVATE clock_t uptime;
+PUBLIC clock_t next_timeout = TIMER_NEVER;
+
+PRIVATE struct timer* timers;
+PRIVATE unsigned long* nr_armed;    // per timer, seeds its next timeout
+PRIVATE struct bench_impl* impl;
+PRIVATE struct bench_result* result;
+PRIVATE unsigned long rand_state;
+PRIVATE clock_t slack;
+
+clock_t get_uptime(){
+    return uptime;
+}
+
+void _assert(int expression, int line, char* filename) {
+    if(!expression) {
+        fprintf(stderr, "\nAssert Failed at line %d in %s\n",line,filename);
+        abort();
+    }
+}
+
+void _panic(const char* str, const char* file) {
+    fprintf(stderr, "\nPanic in %s: %s\n", file, str);
+    abort();
+}
+
+/**
+ * the old pending_timers list, kept sorted by timeout with an insertion sort
+ */
+PRIVATE struct timer *pending_timers;
+
+PRIVATE void list_init(){
+    pending_timers = NULL;
+    next_timeout = TIMER_NEVER;
+}
+
+PRIVATE void list_insert(struct timer *timer){
+    struct timer *prev = NULL;
+    struct timer *curr = pending_timers;
+
+    while(curr && curr->time_out <= timer->time_out){
+        prev = curr;
+        curr = curr->next;
+    }
+    timer->next = curr;
+    if(prev){
+        prev->next = timer;
+    }else{
+        pending_timers = timer;
+        next_timeout = timer->time_out;
+    }
+}
+
+PRIVATE void list_remove(struct timer *timer){
+    struct timer *prev = NULL;
+    struct timer *curr = pending_timers;
+
+    if(!(timer->flags & TIMER_INUSE))
+        return;
+    while(curr && curr != timer){
+        prev = curr;
+        curr = curr->next;
+    }
+    if(prev){
+        prev->next = curr->next;
+    }else{
+        pending_timers = pending_timers->next;
+        next_timeout = pending_timers ? pending_timers->time_out : TIMER_NEVER;
+    }
+    timer->flags &= ~TIMER_INUSE;
+}
+
+PRIVATE struct timer* list_dequeue(clock_t now){
+    struct timer* mq = pending_timers;
+
+    if(!mq || mq->time_out > now)
+        return NULL;
+    pending_timers = mq->next;
+    next_timeout = pending_timers ? pending_timers->time_out : TIMER_NEVER;
+    mq->flags &= ~TIMER_INUSE;
+    return mq;
+}
+
+PRIVATE struct bench_impl impls[] = {
+    {"wheel",   init_timer, insert_timer,   remove_timer,   dequeue_alarm},
+    {"list",    list_init,  list_insert,    list_remove,    list_dequeue},
+};
+
+PRIVATE unsigned long next_rand(unsigned long *state){
+    *state = *state * 6364136223846793005UL + 1442695040888963407UL;
+    return *state >> 33;
+}
+
+/**
+ * mostly short sleeps, some timers of a few seconds, and a few alarms
+ * up to an hour away. The timeouts of each timer only depend on how many
+ * times it was set, and not on the order timers of the same tick go off
+ * in, which the two implementations do not agree on
+ */
+PRIVATE clock_t random_timeout(int index){
+    unsigned long state = ((unsigned long)index << 32) + nr_armed[index]++;
+    unsigned long r;
+
+    next_rand(&state);
+    r = next_rand(&state) % 100;
+    if(r < 70)
+        return 1 + next_rand(&state) % HZ;
+    if(r < 95)
+        return 1 + next_rand(&state) % (HZ * 10);
+    return 1 + next_rand(&state) % (HZ * 3600);
+}
+
+PRIVATE void arm(struct timer* timer){
+    unsigned long start;
+
+    timer->flags |= TIMER_INUSE;
+    timer->time_out = uptime + random_timeout(timer->proc_nr);
+    timer->offset = 0;
+    slack_deadline(&timer->time_out, &timer->offset, slack);
+    start = host_time_ns();
+    impl->insert(timer);
+    result->insert_ns += host_time_ns() - start;
+    result->nr_insert++;
+}
+
+PRIVATE void expire(int index, clock_t time_out){
+    struct timer* timer = &timers[index];
+
+    ASSERT(time_out == uptime);
+    result->fired++;
+    result->checksum += (index + 1) * time_out;
+    arm(timer);
+}
+
+PRIVATE void run(int nr_timers, clock_t nr_ticks){
+    struct timer* timer;
+    unsigned long start, tick_start, callback_ns;
+    clock_t now;
+    int i;
+
+    memset(timers, 0, nr_timers * sizeof(struct timer));
+    memset(nr_armed, 0, nr_timers * sizeof(unsigned long));
+    memset(result, 0, sizeof(*result));
+    rand_state = 1;
+    uptime = 0;
+    impl->init();
+
+    for(i = 0; i < nr_timers; i++){
+        timers[i].proc_nr = i;
+        timers[i].handler = expire;
+        arm(&timers[i]);
+    }
+
+    for(now = 1; now <= nr_ticks; now++){
+        uptime = now;
+
+        // the re-arming done by expire() is counted as inserts
+        tick_start = host_time_ns();
+        callback_ns = result->insert_ns;
+        if(next_timeout <= uptime){
+            if((timer = impl->dequeue(uptime)))
+                result->busy_ticks++;
+            for(; timer; timer = impl->dequeue(uptime))
+                timer->handler(timer->proc_nr, timer->time_out);
+        }
+        result->tick_ns += host_time_ns() - tick_start - (result->insert_ns - callback_ns);
+
+        for(i = 0; i < RESETS_PER_TICK; i++){
+            timer = &timers[next_rand(&rand_state) % nr_timers];
+            start = host_time_ns();
+            impl->remove(timer);
+            result->remove_ns += host_time_ns() - start;
+            result->nr_remove++;
+            arm(timer);
+        }
+    }
+}
+
+int main(int argc, char** argv){
+    struct bench_result results[ARRAY_SIZE(impls)];
+    int nr_timers = 4096;
+    clock_t nr_ticks = HZ * 600;
+    int i, ret = 0;
+
+    for(i = 1; i < argc; i++){
+        if(strcmp(argv[i], "-n") == 0 && i + 1 < argc){
+            nr_timers = atoi(argv[++i]);
+        }else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+            nr_ticks = atol(argv[++i]);
+        }else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc){
+            slack = atol(argv[++i]) * TICK_COUNTS;
+        }else{
+            fprintf(stderr, "usage: timerbench [-n timers] [-t ticks] [-s slack ticks]\n");
+            return 1;
+        }
+    }
+    if(nr_timers <= 0 || nr_ticks <= 0)
+        return 1;
+    timers = calloc(nr_timers, sizeof(struct timer));
+    nr_armed = calloc(nr_timers, sizeof(unsigned long));
+
+    printf("%d timers, %ld ticks, %ld ticks of slack\n", nr_timers, (long)nr_ticks,
+        (long)(slack / TICK_COUNTS));
+    printf("%-8s %10s %10s %10s %10s %10s\n", "impl", "fired", "busy", "ns/insert", "ns/cancel", "ns/tick");
+    for(i = 0; i < ARRAY_SIZE(impls); i++){
+        impl = &impls[i];
+        result = &results[i];
+        run(nr_timers, nr_ticks);
+        printf("%-8s %10lu %10lu %10.1f %10.1f %10.1f\n", impl->name, result->fired, result->busy_ticks,
+            (double)result->insert_ns / result->nr_insert,
+            (double)result->remove_ns / result->nr_remove,
+            (double)result->tick_ns / nr_ticks);
+        if(i && (result->fired != results[0].fired || result->checksum != results[0].checksum)){
+            fprintf(stderr, "%s and %s went off differently\n", impl->name, impls[0].name);
+            ret = 1;
+        }
+    }
+    free(timers);
+    free(nr_armed);
+    return ret;
+}
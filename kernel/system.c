@@ -130,12 +130,16 @@ void set_syscall_mesg_exception(int operation, ptr_t* osp, struct message *m, st
     switch (operation)
     {
     case LSEEK:
+    case SETPRIORITY:
         m->m1_i3 = *(sp + 2);
         /* FALLTHRU */
     case EXIT:
     case KILL:
     case SETPGID:
     case DUP2:
+    case GETPRIORITY:
+    case SCHED_SETSCHEDULER:
+    case PRCTL:
         m->m1_i2 = *(sp + 1);
         /* FALLTHRU */
     case ALARM:
@@ -146,6 +150,8 @@ void set_syscall_mesg_exception(int operation, ptr_t* osp, struct message *m, st
     case DUP:
     case UMASK:
     case SBRK:
+    case SCHED_GETSCHEDULER:
+    case URING_ENTER:
         m->m1_i1 = *sp;
         break;
 
@@ -187,6 +193,8 @@ void set_syscall_mesg_exception(int operation, ptr_t* osp, struct message *m, st
     case CHDIR:
     case UNLINK:
     case RMDIR:
+    case SPAWN:
+    case URING_SETUP:
         m->m1_p1 = (void*)*sp;
         break;
 
@@ -213,6 +221,48 @@ void set_syscall_mesg_exception(int operation, ptr_t* osp, struct message *m, st
     }
 }
 
+/**
+ * Pages of a forked image are copied on first access, which the kernel does
+ * not fault on. Resolve the pages behind the pointer arguments of a syscall
+ * before the handler reads or writes them. One page from each pointer covers
+ * paths and every structure passed to the kernel, buffers use their length
+ * @param operation 
+ * @param m         
+ * @param who       
+ * @return          0, or -EFAULT if a page could not be resolved
+ */
+int resolve_syscall_args(int operation, struct message *m, struct proc* who){
+    size_t len = PAGE_LEN;
+    int ret = 0;
+
+    switch (operation)
+    {
+    case FCNTL:
+    case IOCTL:
+        // m1_p1 points to the physical user stack
+        return 0;
+
+    case READ:
+    case WRITE:
+        len = m->m1_i2 > 0 ? m->m1_i2 : 0;
+        break;
+
+    case GETDENT:
+        len = m->m1_i2 > 0 ? m->m1_i2 * sizeof(struct dirent) : 0;
+        break;
+
+    default:
+        break;
+    }
+    if(m->m1_p1)
+        ret = resolve_user_pages(who, m->m1_p1, len);
+    if(m->m1_p2 && !ret)
+        ret = resolve_user_pages(who, m->m1_p2, PAGE_LEN);
+    if(m->m1_p3 && !ret)
+        ret = resolve_user_pages(who, m->m1_p3, PAGE_LEN);
+    return ret;
+}
+
 int set_syscall_reply(struct proc* who, int reply, int syscall_num){
     if(reply < 0){
         *(USER_ERRNO(who)) = -reply;
@@ -347,6 +397,14 @@ void init_syscall_table(){
     SYSCALL_MAP(SCHED_YIELD, do_sched_yield);
     SYSCALL_MAP(SETITIMER, do_setitimer);
     SYSCALL_MAP(RMDIR, do_rmdir);
+    SYSCALL_MAP(SPAWN, do_spawn);
+    SYSCALL_MAP(SETPRIORITY, do_setpriority);
+    SYSCALL_MAP(GETPRIORITY, do_getpriority);
+    SYSCALL_MAP(SCHED_SETSCHEDULER, do_sched_setscheduler);
+    SYSCALL_MAP(SCHED_GETSCHEDULER, do_sched_getscheduler);
+    SYSCALL_MAP(PRCTL, do_prctl);
+    SYSCALL_MAP(URING_SETUP, do_uring_setup);
+    SYSCALL_MAP(URING_ENTER, do_uring_enter);
 }
 
 
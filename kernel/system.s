@@ -0,0 +1,1547 @@
+.global	trace_syscall
+trace_syscall:
+	.word	0x0
+.global	system_main
+.text
+system_main:
+	subui	$sp, $sp, 11
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	la	$7, _message
+	jal	kreport_sysinfo
+	la	$13, recv_ctx
+	sw	$13, 0($sp)
+	jal	getcontext
+	j	L.11
+L.10:
+	sw	$7, 0($sp)
+	jal	winix_receive
+	lw	$13, 0($7)
+	sw	$13, curr_caller_proc_nr($0)
+	lw	$13, curr_caller_proc_nr($0)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	sw	$13, curr_caller($0)
+	lw	$13, curr_caller($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.13
+	j	L.11
+L.13:
+	jal	syscall_region_begin
+	addui	$13, $0, 1
+	lw	$12, 1($7)
+	slt	$13, $12, $13
+	bnez	$13, L.15
+	sgti	$13, $12, 65
+	bnez	$13, L.15
+	lw	$13, 1($7)
+	lw	$5, syscall_table($13)
+	j	L.16
+L.15:
+	la	$5, no_syscall
+L.16:
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.17
+	la	$5, syscall_not_implemented
+L.17:
+	lw	$13, curr_caller($0)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jalr	$5
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfc1a
+	seq	$13, $6, $13
+	bnez	$13, L.20
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfc1b
+	seq	$13, $6, $13
+	bnez	$13, L.20
+	j	L.19
+L.19:
+	lw	$13, curr_syscall($0)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	lw	$13, curr_caller_proc_nr($0)
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	syscall_reply2
+L.20:
+	lw	$13, curr_caller($0)
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfc1b
+	seq	$13, $6, $13
+	bnez	$13, L.25
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfc1a
+	sne	$13, $6, $13
+	bnez	$13, L.23
+L.25:
+	addui	$4, $0, 1
+	j	L.24
+L.23:
+	addu	$4, $0, $0
+L.24:
+	sw	$4, 1($sp)
+	jal	handle_pendingsig
+	jal	syscall_region_end
+L.11:
+	j	L.10
+L.9:
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	kreport_sysinfo
+kreport_sysinfo:
+	subui	$sp, $sp, 9
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addui	$13, $0, 257
+	sw	$13, 0($sp)
+	jal	get_dev
+	addu	$13, $0, $1
+	sw	$13, 0($sp)
+	jal	get_sb
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	jal	peek_next_free_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	slli	$13, $13, 10
+	addu	$7, $0, $13
+	jal	peek_last_free_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	slli	$13, $13, 10
+	addu	$6, $0, $13
+	la	$13, L.27
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	addui	$13, $0, 6
+	sw	$13, 2($sp)
+	jal	kprintf
+	la	$13, L.27
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	addui	$13, $0, 6
+	sw	$13, 2($sp)
+	jal	kprintf2
+	la	$13, L.28
+	sw	$13, 0($sp)
+	la	$13, TEXT_BEGIN
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	la	$13, TEXT_END
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	kprintf
+	la	$13, L.29
+	sw	$13, 0($sp)
+	la	$13, DATA_BEGIN
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	la	$13, DATA_END
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	kprintf
+	la	$13, L.30
+	sw	$13, 0($sp)
+	la	$13, BSS_BEGIN
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	la	$13, BSS_END
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	kprintf
+	la	$13, L.31
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	sw	$6, 2($sp)
+	jal	kprintf
+	la	$13, L.32
+	sw	$13, 0($sp)
+	lw	$13, 1($5)
+	sw	$13, 1($sp)
+	lw	$13, 3($5)
+	sw	$13, 2($sp)
+	jal	kprintf
+	la	$13, L.33
+	sw	$13, 0($sp)
+	sub	$13, $6, $7
+	addu	$13, $0, $13
+	addui	$12, $0, 1024
+	addu	$13, $13, $12
+	srli	$13, $13, 10
+	sw	$13, 1($sp)
+	jal	kprintf
+L.26:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	syscall_region_begin
+syscall_region_begin:
+	subui	$sp, $sp, 8
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, curr_caller($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.37
+	addui	$7, $0, 1
+	j	L.38
+L.37:
+	addu	$7, $0, $0
+L.38:
+	sw	$7, 0($sp)
+	addui	$13, $0, 98
+	sw	$13, 1($sp)
+	la	$13, L.36
+	sw	$13, 2($sp)
+	jal	_assert
+	lw	$13, curr_caller($0)
+	sw	$13, 0($sp)
+	jal	set_bill_ptr
+	lw	$13, proc_table($0)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 2
+	sw	$12, 0($13)
+	lw	$13, _message+1($0)
+	sw	$13, curr_syscall($0)
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, curr_caller($0)
+	sw	$13, 132($12)
+	lw	$13, curr_caller($0)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 2
+	sw	$12, 0($13)
+	lw	$13, curr_caller($0)
+	sw	$13, curr_syscall_caller($0)
+	lw	$13, curr_caller_proc_nr($0)
+	seq	$13, $13, $0
+	bnez	$13, L.41
+	addui	$6, $0, 1
+	j	L.42
+L.41:
+	addu	$6, $0, $0
+L.42:
+	sw	$6, 0($sp)
+	addui	$13, $0, 117
+	sw	$13, 1($sp)
+	la	$13, L.36
+	sw	$13, 2($sp)
+	jal	_assert
+L.34:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	syscall_region_end
+syscall_region_end:
+	subui	$sp, $sp, 7
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, proc_table($0)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffd
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	la	$13, _message
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 8
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$13, $0, $0
+	sw	$13, curr_caller_proc_nr($0)
+	sw	$13, curr_syscall($0)
+L.43:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	set_syscall_mesg_exception
+set_syscall_mesg_exception:
+	subui	$sp, $sp, 4
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	sw	$13, 2($sp)
+	slti	$13, $13, 1
+	bnez	$13, L.46
+	lw	$13, 2($sp)
+	sgti	$13, $13, 64
+	bnez	$13, L.46
+	lw	$13, 2($sp)
+	lw	$13, L.56-1($13)
+	jr	$13
+.data
+L.56:
+	.word	L.53
+	.word	L.48
+	.word	L.46
+	.word	L.46
+	.word	L.51
+	.word	L.53
+	.word	L.49
+	.word	L.54
+	.word	L.46
+	.word	L.50
+	.word	L.48
+	.word	L.46
+	.word	L.50
+	.word	L.50
+	.word	L.54
+	.word	L.49
+	.word	L.49
+	.word	L.53
+	.word	L.50
+	.word	L.48
+	.word	L.49
+	.word	L.50
+	.word	L.50
+	.word	L.50
+	.word	L.49
+	.word	L.50
+	.word	L.53
+	.word	L.50
+	.word	L.53
+	.word	L.50
+	.word	L.50
+	.word	L.52
+	.word	L.50
+	.word	L.49
+	.word	L.48
+	.word	L.52
+	.word	L.53
+	.word	L.50
+	.word	L.50
+	.word	L.50
+	.word	L.46
+	.word	L.47
+	.word	L.49
+	.word	L.55
+	.word	L.55
+	.word	L.46
+	.word	L.52
+	.word	L.46
+	.word	L.50
+	.word	L.49
+	.word	L.52
+	.word	L.50
+	.word	L.46
+	.word	L.46
+	.word	L.54
+	.word	L.53
+	.word	L.53
+	.word	L.47
+	.word	L.48
+	.word	L.48
+	.word	L.49
+	.word	L.48
+	.word	L.53
+	.word	L.49
+.text
+L.47:
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 2($12)
+	addu	$12, $0, $12
+	sw	$12, 4($13)
+L.48:
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 1($12)
+	addu	$12, $0, $12
+	sw	$12, 3($13)
+L.49:
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	sw	$12, 2($13)
+	j	L.46
+L.50:
+	lw	$13, 3($sp)
+	addui	$12, $13, 1
+	sw	$12, 3($sp)
+	lw	$12, 6($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 2($12)
+	lw	$13, 3($sp)
+	addui	$12, $13, 1
+	sw	$12, 3($sp)
+	lw	$12, 6($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 5($12)
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	sw	$12, 3($13)
+	j	L.46
+L.51:
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 2($12)
+	addu	$12, $0, $12
+	sw	$12, 7($13)
+L.52:
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 1($12)
+	addu	$12, $0, $12
+	sw	$12, 6($13)
+L.53:
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	sw	$12, 5($13)
+	j	L.46
+L.54:
+	lw	$13, 3($sp)
+	addui	$12, $13, 1
+	sw	$12, 3($sp)
+	lw	$12, 6($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 2($12)
+	lw	$13, 3($sp)
+	addui	$12, $13, 1
+	sw	$12, 3($sp)
+	lw	$12, 6($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 5($12)
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	sw	$12, 6($13)
+	j	L.46
+L.55:
+	lw	$13, 3($sp)
+	addui	$12, $13, 1
+	sw	$12, 3($sp)
+	lw	$12, 6($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 2($12)
+	lw	$13, 3($sp)
+	addui	$12, $13, 1
+	sw	$12, 3($sp)
+	lw	$12, 6($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 3($12)
+	lw	$13, 6($sp)
+	lw	$12, 3($sp)
+	sw	$12, 5($13)
+L.46:
+L.44:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	resolve_syscall_args
+resolve_syscall_args:
+	subui	$sp, $sp, 13
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addui	$13, $0, 1024
+	sw	$13, 12($sp)
+	addu	$7, $0, $0
+	lw	$13, 13($sp)
+	sw	$13, 11($sp)
+	addui	$12, $0, 38
+	seq	$13, $13, $12
+	bnez	$13, L.66
+	lw	$13, 11($sp)
+	sgt	$13, $13, $12
+	bnez	$13, L.71
+L.70:
+	lw	$13, 13($sp)
+	sw	$13, 10($sp)
+	seqi	$13, $13, 23
+	bnez	$13, L.62
+	lw	$13, 10($sp)
+	seqi	$13, $13, 24
+	bnez	$13, L.62
+	j	L.60
+L.71:
+	lw	$13, 13($sp)
+	sw	$13, 9($sp)
+	seqi	$13, $13, 44
+	bnez	$13, L.61
+	lw	$13, 9($sp)
+	seqi	$13, $13, 45
+	bnez	$13, L.61
+	j	L.60
+L.61:
+	addu	$1, $0, $0
+	j	L.58
+L.62:
+	lw	$13, 14($sp)
+	lw	$13, 3($13)
+	sle	$13, $13, $0
+	bnez	$13, L.64
+	lw	$13, 14($sp)
+	lw	$6, 3($13)
+	j	L.65
+L.64:
+	addu	$6, $0, $0
+L.65:
+	addu	$13, $0, $6
+	sw	$13, 12($sp)
+	j	L.60
+L.66:
+	lw	$13, 14($sp)
+	lw	$13, 3($13)
+	sle	$13, $13, $0
+	bnez	$13, L.68
+	addui	$13, $0, 31
+	lw	$12, 14($sp)
+	lw	$12, 3($12)
+	addu	$12, $0, $12
+	multu	$5, $13, $12
+	j	L.69
+L.68:
+	addu	$5, $0, $0
+L.69:
+	sw	$5, 12($sp)
+L.60:
+	lw	$13, 14($sp)
+	lw	$13, 5($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.72
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	lw	$13, 5($13)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.72:
+	lw	$13, 14($sp)
+	lw	$13, 6($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.74
+	sne	$13, $7, $0
+	bnez	$13, L.74
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	lw	$13, 6($13)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.74:
+	lw	$13, 14($sp)
+	lw	$13, 7($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.76
+	sne	$13, $7, $0
+	bnez	$13, L.76
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	lw	$13, 7($13)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.76:
+	addu	$1, $0, $7
+L.58:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	set_syscall_reply
+set_syscall_reply:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.79
+	lw	$13, 3($sp)
+	lw	$13, 22($13)
+	lw	$12, 4($sp)
+	subu	$12, $0, $12
+	sw	$12, 1($13)
+	lw	$13, 5($sp)
+	snei	$13, $13, 52
+	bnez	$13, L.82
+	addu	$7, $0, $0
+	j	L.83
+L.82:
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffff
+L.83:
+	sw	$7, 4($sp)
+L.79:
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lw	$1, 4($sp)
+L.78:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	no_syscall
+no_syscall:
+	subui	$sp, $sp, 7
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	la	$13, L.85
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	addui	$12, $13, 94
+	sw	$12, 1($sp)
+	lw	$13, 114($13)
+	sw	$13, 2($sp)
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	sw	$13, 3($sp)
+	jal	klog
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffda
+L.84:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	syscall_not_implemented
+syscall_not_implemented:
+	subui	$sp, $sp, 7
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	la	$13, L.87
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	addui	$12, $13, 94
+	sw	$12, 1($sp)
+	lw	$13, 114($13)
+	sw	$13, 2($sp)
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	sw	$13, 3($sp)
+	jal	kerror
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffda
+L.86:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	get_ipc_mesg
+get_ipc_mesg:
+	la	$1, _message
+L.88:
+	jr	$ra
+.global	curr_proc_nr
+curr_proc_nr:
+	lw	$1, curr_caller_proc_nr($0)
+L.89:
+	jr	$ra
+.global	curr_syscall_num
+curr_syscall_num:
+	lw	$1, curr_syscall($0)
+L.90:
+	jr	$ra
+.global	is_in_syscall
+is_in_syscall:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	sw	$13, 3($sp)
+	lw	$12, 19($13)
+	andi	$12, $12, 2
+	seq	$13, $12, $0
+	bnez	$13, L.93
+	lw	$13, curr_caller_proc_nr($0)
+	lw	$12, 3($sp)
+	lw	$12, 133($12)
+	sne	$13, $13, $12
+	bnez	$13, L.93
+	addui	$7, $0, 1
+	j	L.94
+L.93:
+	addu	$7, $0, $0
+L.94:
+	addu	$1, $0, $7
+L.91:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	syscall_reply
+syscall_reply:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	jal	curr_syscall_num
+	addu	$13, $0, $1
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	lw	$13, 8($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.95:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	syscall_reply2
+syscall_reply2:
+	subui	$sp, $sp, 44
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addui	$13, $sp, 11
+	sw	$13, 43($sp)
+	lw	$13, 46($sp)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $0
+	sw	$13, 10($sp)
+	lw	$12, trace_syscall($0)
+	seq	$13, $12, $13
+	bnez	$13, L.97
+	lw	$13, 44($sp)
+	sw	$13, 9($sp)
+	lw	$12, 10($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.97
+	lw	$13, 9($sp)
+	sgei	$13, $13, 65
+	bnez	$13, L.97
+	lw	$13, 45($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.99
+	lw	$13, 45($sp)
+	sw	$13, 0($sp)
+	jal	kstr_error
+	addu	$13, $0, $1
+	sw	$13, 43($sp)
+	j	L.100
+L.99:
+	lw	$13, 45($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	jal	kputd_buf
+L.100:
+	la	$13, L.101
+	sw	$13, 0($sp)
+	lw	$13, 44($sp)
+	lw	$13, syscall_str($13)
+	sw	$13, 1($sp)
+	lw	$13, 43($sp)
+	sw	$13, 2($sp)
+	addui	$13, $7, 94
+	sw	$13, 3($sp)
+	lw	$13, 114($7)
+	sw	$13, 4($sp)
+	jal	klog
+L.97:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.102
+	lw	$13, 47($sp)
+	lw	$12, 44($sp)
+	sw	$12, 1($13)
+	lw	$13, 47($sp)
+	lw	$12, 45($sp)
+	sw	$12, 1($13)
+	sw	$0, 0($sp)
+	lw	$13, 46($sp)
+	sw	$13, 1($sp)
+	lw	$13, 47($sp)
+	sw	$13, 2($sp)
+	jal	do_notify
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.96
+L.102:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+L.96:
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 44
+	jr	$ra
+.global	_syscall_map
+_syscall_map:
+	subui	$sp, $sp, 6
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 6($sp)
+	sw	$13, 5($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.107
+	lw	$13, 5($sp)
+	slti	$13, $13, 65
+	bnez	$13, L.105
+L.107:
+	la	$13, L.108
+	sw	$13, 0($sp)
+	la	$13, L.36
+	sw	$13, 1($sp)
+	jal	_panic
+L.105:
+	lw	$13, 6($sp)
+	lw	$12, 7($sp)
+	sw	$12, syscall_table($13)
+	lw	$13, 6($sp)
+	lw	$12, 8($sp)
+	sw	$12, syscall_str($13)
+L.104:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	init_syscall_table
+init_syscall_table:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, do_times
+	sw	$13, 1($sp)
+	la	$13, L.110
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	la	$13, do_exit
+	sw	$13, 1($sp)
+	la	$13, L.111
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 3
+	sw	$13, 0($sp)
+	la	$13, do_fork
+	sw	$13, 1($sp)
+	la	$13, L.112
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 4
+	sw	$13, 0($sp)
+	la	$13, do_vfork
+	sw	$13, 1($sp)
+	la	$13, L.113
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 5
+	sw	$13, 0($sp)
+	la	$13, do_execve
+	sw	$13, 1($sp)
+	la	$13, L.114
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 6
+	sw	$13, 0($sp)
+	la	$13, do_brk
+	sw	$13, 1($sp)
+	la	$13, L.115
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 7
+	sw	$13, 0($sp)
+	la	$13, do_alarm
+	sw	$13, 1($sp)
+	la	$13, L.116
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 8
+	sw	$13, 0($sp)
+	la	$13, do_sigaction
+	sw	$13, 1($sp)
+	la	$13, L.117
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 9
+	sw	$13, 0($sp)
+	la	$13, do_sigreturn
+	sw	$13, 1($sp)
+	la	$13, L.118
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	la	$13, do_waitpid
+	sw	$13, 1($sp)
+	la	$13, L.119
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 11
+	sw	$13, 0($sp)
+	la	$13, do_kill
+	sw	$13, 1($sp)
+	la	$13, L.120
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 12
+	sw	$13, 0($sp)
+	la	$13, do_getpid
+	sw	$13, 1($sp)
+	la	$13, L.121
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 13
+	sw	$13, 0($sp)
+	la	$13, do_winfo
+	sw	$13, 1($sp)
+	la	$13, L.122
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 14
+	sw	$13, 0($sp)
+	la	$13, do_winix_strerror
+	sw	$13, 1($sp)
+	la	$13, L.123
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 15
+	sw	$13, 0($sp)
+	la	$13, do_winix_dprintf
+	sw	$13, 1($sp)
+	la	$13, L.124
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 16
+	sw	$13, 0($sp)
+	la	$13, do_sysconf
+	sw	$13, 1($sp)
+	la	$13, L.125
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 17
+	sw	$13, 0($sp)
+	la	$13, do_sigsuspend
+	sw	$13, 1($sp)
+	la	$13, L.126
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 18
+	sw	$13, 0($sp)
+	la	$13, do_sigpending
+	sw	$13, 1($sp)
+	la	$13, L.127
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 19
+	sw	$13, 0($sp)
+	la	$13, do_sigprocmask
+	sw	$13, 1($sp)
+	la	$13, L.128
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 20
+	sw	$13, 0($sp)
+	la	$13, do_setpgid
+	sw	$13, 1($sp)
+	la	$13, L.129
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 21
+	sw	$13, 0($sp)
+	la	$13, do_getpgid
+	sw	$13, 1($sp)
+	la	$13, L.130
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	la	$13, do_open
+	sw	$13, 1($sp)
+	la	$13, L.131
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 26
+	sw	$13, 0($sp)
+	la	$13, do_creat
+	sw	$13, 1($sp)
+	la	$13, L.132
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	la	$13, do_close
+	sw	$13, 1($sp)
+	la	$13, L.133
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	la	$13, do_read
+	sw	$13, 1($sp)
+	la	$13, L.134
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 24
+	sw	$13, 0($sp)
+	la	$13, do_write
+	sw	$13, 1($sp)
+	la	$13, L.135
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 27
+	sw	$13, 0($sp)
+	la	$13, do_pipe
+	sw	$13, 1($sp)
+	la	$13, L.136
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 28
+	sw	$13, 0($sp)
+	la	$13, do_mknod
+	sw	$13, 1($sp)
+	la	$13, L.137
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 29
+	sw	$13, 0($sp)
+	la	$13, do_chdir
+	sw	$13, 1($sp)
+	la	$13, L.138
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 30
+	sw	$13, 0($sp)
+	la	$13, do_chown
+	sw	$13, 1($sp)
+	la	$13, L.139
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 31
+	sw	$13, 0($sp)
+	la	$13, do_chmod
+	sw	$13, 1($sp)
+	la	$13, L.140
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	la	$13, do_stat
+	sw	$13, 1($sp)
+	la	$13, L.141
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 33
+	sw	$13, 0($sp)
+	la	$13, do_fstat
+	sw	$13, 1($sp)
+	la	$13, L.142
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 34
+	sw	$13, 0($sp)
+	la	$13, do_dup
+	sw	$13, 1($sp)
+	la	$13, L.143
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 35
+	sw	$13, 0($sp)
+	la	$13, do_dup2
+	sw	$13, 1($sp)
+	la	$13, L.144
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 36
+	sw	$13, 0($sp)
+	la	$13, do_link
+	sw	$13, 1($sp)
+	la	$13, L.145
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 37
+	sw	$13, 0($sp)
+	la	$13, do_unlink
+	sw	$13, 1($sp)
+	la	$13, L.146
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 38
+	sw	$13, 0($sp)
+	la	$13, do_getdents
+	sw	$13, 1($sp)
+	la	$13, L.147
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 39
+	sw	$13, 0($sp)
+	la	$13, do_access
+	sw	$13, 1($sp)
+	la	$13, L.148
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 40
+	sw	$13, 0($sp)
+	la	$13, do_mkdir
+	sw	$13, 1($sp)
+	la	$13, L.149
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 41
+	sw	$13, 0($sp)
+	la	$13, do_sync
+	sw	$13, 1($sp)
+	la	$13, L.150
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 42
+	sw	$13, 0($sp)
+	la	$13, do_lseek
+	sw	$13, 1($sp)
+	la	$13, L.151
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 43
+	sw	$13, 0($sp)
+	la	$13, do_umask
+	sw	$13, 1($sp)
+	la	$13, L.152
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 44
+	sw	$13, 0($sp)
+	la	$13, do_fcntl
+	sw	$13, 1($sp)
+	la	$13, L.153
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	la	$13, do_ioctl
+	sw	$13, 1($sp)
+	la	$13, L.154
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 46
+	sw	$13, 0($sp)
+	la	$13, do_setsid
+	sw	$13, 1($sp)
+	la	$13, L.155
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 47
+	sw	$13, 0($sp)
+	la	$13, do_nanosleep
+	sw	$13, 1($sp)
+	la	$13, L.156
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 48
+	sw	$13, 0($sp)
+	la	$13, do_getppid
+	sw	$13, 1($sp)
+	la	$13, L.157
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	la	$13, do_signal
+	sw	$13, 1($sp)
+	la	$13, L.158
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 50
+	sw	$13, 0($sp)
+	la	$13, do_sbrk
+	sw	$13, 1($sp)
+	la	$13, L.159
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 51
+	sw	$13, 0($sp)
+	la	$13, do_statfs
+	sw	$13, 1($sp)
+	la	$13, L.160
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 52
+	sw	$13, 0($sp)
+	la	$13, do_getcwd
+	sw	$13, 1($sp)
+	la	$13, L.161
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	la	$13, do_tfork
+	sw	$13, 1($sp)
+	la	$13, L.162
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 54
+	sw	$13, 0($sp)
+	la	$13, do_sched_yield
+	sw	$13, 1($sp)
+	la	$13, L.163
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 55
+	sw	$13, 0($sp)
+	la	$13, do_setitimer
+	sw	$13, 1($sp)
+	la	$13, L.164
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 56
+	sw	$13, 0($sp)
+	la	$13, do_rmdir
+	sw	$13, 1($sp)
+	la	$13, L.165
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 57
+	sw	$13, 0($sp)
+	la	$13, do_spawn
+	sw	$13, 1($sp)
+	la	$13, L.166
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 58
+	sw	$13, 0($sp)
+	la	$13, do_setpriority
+	sw	$13, 1($sp)
+	la	$13, L.167
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 59
+	sw	$13, 0($sp)
+	la	$13, do_getpriority
+	sw	$13, 1($sp)
+	la	$13, L.168
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 60
+	sw	$13, 0($sp)
+	la	$13, do_sched_setscheduler
+	sw	$13, 1($sp)
+	la	$13, L.169
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 61
+	sw	$13, 0($sp)
+	la	$13, do_sched_getscheduler
+	sw	$13, 1($sp)
+	la	$13, L.170
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 62
+	sw	$13, 0($sp)
+	la	$13, do_prctl
+	sw	$13, 1($sp)
+	la	$13, L.171
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 63
+	sw	$13, 0($sp)
+	la	$13, do_uring_setup
+	sw	$13, 1($sp)
+	la	$13, L.172
+	sw	$13, 2($sp)
+	jal	_syscall_map
+	addui	$13, $0, 64
+	sw	$13, 0($sp)
+	la	$13, do_uring_enter
+	sw	$13, 1($sp)
+	la	$13, L.173
+	sw	$13, 2($sp)
+	jal	_syscall_map
+L.109:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.bss
+recv_ctx:
+	.space	21
+curr_caller:
+	.space	1
+curr_syscall:
+	.space	1
+curr_caller_proc_nr:
+	.space	1
+_message:
+	.space	8
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.173:
+	.asciiz	"URING_ENTER"
+L.172:
+	.asciiz	"URING_SETUP"
+L.171:
+	.asciiz	"PRCTL"
+L.170:
+	.asciiz	"SCHED_GETSCHEDULER"
+L.169:
+	.asciiz	"SCHED_SETSCHEDULER"
+L.168:
+	.asciiz	"GETPRIORITY"
+L.167:
+	.asciiz	"SETPRIORITY"
+L.166:
+	.asciiz	"SPAWN"
+L.165:
+	.asciiz	"RMDIR"
+L.164:
+	.asciiz	"SETITIMER"
+L.163:
+	.asciiz	"SCHED_YIELD"
+L.162:
+	.asciiz	"TFORK"
+L.161:
+	.asciiz	"GETCWD"
+L.160:
+	.asciiz	"STATFS"
+L.159:
+	.asciiz	"SBRK"
+L.158:
+	.asciiz	"SIGNAL"
+L.157:
+	.asciiz	"GETPPID"
+L.156:
+	.asciiz	"NANOSLEEP"
+L.155:
+	.asciiz	"SETSID"
+L.154:
+	.asciiz	"IOCTL"
+L.153:
+	.asciiz	"FCNTL"
+L.152:
+	.asciiz	"UMASK"
+L.151:
+	.asciiz	"LSEEK"
+L.150:
+	.asciiz	"SYNC"
+L.149:
+	.asciiz	"MKDIR"
+L.148:
+	.asciiz	"ACCESS"
+L.147:
+	.asciiz	"GETDENT"
+L.146:
+	.asciiz	"UNLINK"
+L.145:
+	.asciiz	"LINK"
+L.144:
+	.asciiz	"DUP2"
+L.143:
+	.asciiz	"DUP"
+L.142:
+	.asciiz	"FSTAT"
+L.141:
+	.asciiz	"STAT"
+L.140:
+	.asciiz	"CHMOD"
+L.139:
+	.asciiz	"CHOWN"
+L.138:
+	.asciiz	"CHDIR"
+L.137:
+	.asciiz	"MKNOD"
+L.136:
+	.asciiz	"PIPE"
+L.135:
+	.asciiz	"WRITE"
+L.134:
+	.asciiz	"READ"
+L.133:
+	.asciiz	"CLOSE"
+L.132:
+	.asciiz	"CREAT"
+L.131:
+	.asciiz	"OPEN"
+L.130:
+	.asciiz	"GETPGID"
+L.129:
+	.asciiz	"SETPGID"
+L.128:
+	.asciiz	"SIGPROCMASK"
+L.127:
+	.asciiz	"SIGPENDING"
+L.126:
+	.asciiz	"SIGSUSPEND"
+L.125:
+	.asciiz	"SYSCONF"
+L.124:
+	.asciiz	"DPRINTF"
+L.123:
+	.asciiz	"STRERROR"
+L.122:
+	.asciiz	"WINFO"
+L.121:
+	.asciiz	"GETPID"
+L.120:
+	.asciiz	"KILL"
+L.119:
+	.asciiz	"WAITPID"
+L.118:
+	.asciiz	"SIGRET"
+L.117:
+	.asciiz	"SIGACTION"
+L.116:
+	.asciiz	"ALARM"
+L.115:
+	.asciiz	"BRK"
+L.114:
+	.asciiz	"EXECVE"
+L.113:
+	.asciiz	"VFORK"
+L.112:
+	.asciiz	"FORK"
+L.111:
+	.asciiz	"EXIT"
+L.110:
+	.asciiz	"TIMES"
+L.108:
+	.asciiz	"syscall number out of range"
+L.101:
+	.asciiz	"Syscall %s return %s to Proc %s[%d]\n"
+L.87:
+	.asciiz	"%s[%d] performed syscall %d that is not linked\n"
+L.85:
+	.asciiz	"Process \"%s (%d)\" performed unknown system call %d\r\n"
+L.36:
+	.asciiz	"kernel/system.c"
+L.33:
+	.asciiz	"%ld Pages Free\n"
+L.32:
+	.asciiz	"Root Disk %d Blocks Used, %d Remaining\n"
+L.31:
+	.asciiz	"Unallocated:  0x%08x - 0x%08x\n"
+L.30:
+	.asciiz	"BSS Segment:  0x%08lx - 0x%08lx\n"
+L.29:
+	.asciiz	"Data Segment: 0x%08lx - 0x%08lx\n"
+L.28:
+	.asciiz	"Text Segment: 0x%08lx - 0x%08lx\n"
+L.27:
+	.asciiz	"\nWINIX v%d.%d\n"
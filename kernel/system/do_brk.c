@@ -33,9 +33,13 @@
  * between stack bottom and heap bottom are the preallocated heap 
  * region for each process heap_break can be increased or 
  * decreased freely between heap_bottom and stack bottom
- * but if heap_break were to go beyond heap_bottom, heap_bottom 
- * is first extended by syscall brk() 
- * NB that heap_bottom always point at the end of the page
+ * but if heap_break were to go beyond heap_bottom, the pages up to
+ * heap_end are reserved by syscall brk(). They are allocated in the system
+ * bitmap straight away, so no one else can take them, but not claimed until the
+ * process first touches them, the GPF then claims and zeroes the page
+ * touched. heap_bottom stays at the end of the image mapped by exec, past
+ * it the protection table tells which pages are claimed
+ * NB that heap_bottom and heap_end always point at the end of the page
  */
     
 
@@ -43,8 +47,6 @@
 // NB sbrk() is implemented as a user wrapper function, that internally uses brk() syscall
 // This function is just an internal kernel function for extending heaps
 ptr_t* sys_sbrk(struct proc *who, int size){
-    ptr_t* next_page;
-    int err;
     int residual, request_size;
 
     if(size == 0)
@@ -59,23 +61,23 @@ ptr_t* sys_sbrk(struct proc *who, int size){
     }
     
     // residual is the remaining unused heap by the user
-    residual = who->heap_bottom - who->heap_break;
+    residual = who->heap_end - who->heap_break;
     if(residual >= size){
         who->heap_break += size;
         goto ret_result;
     }
 
-    // extend the heap bottom if needed
-    next_page = who->heap_bottom + 1;
-    request_size = size - residual; 
-    err = user_get_free_pages_from(who,next_page, request_size );
-    if(err)
-        return NULL;        
+    // reserve the pages past heap_end, the image must stay contiguous,
+    // so the pages are taken from the system now, but each of them is
+    // not mapped or zeroed until claimed
+    request_size = align_page(size - residual);
+    if(get_free_pages_from(who->heap_end + 1, request_size))
+        return NULL;
+    who->heap_end += request_size;
     
     // klog("extending heap size %d oheap %x newheap %x btm %x\n", size, who->heap_break, 
     //                                                         (who->heap_break + size), who->heap_bottom);                                  
     who->heap_break += size;
-    who->heap_bottom += align_page(request_size);
 
 ret_result:
     return who->heap_break;
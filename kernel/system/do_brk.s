@@ -0,0 +1,259 @@
+.global	sys_sbrk
+.text
+sys_sbrk:
+	subui	$sp, $sp, 8
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.10
+	j	L.12
+L.10:
+	lw	$13, 9($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.13
+	lw	$13, 8($sp)
+	lw	$12, 9($sp)
+	lw	$11, 25($13)
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	lw	$13, 24($13)
+	addu	$13, $0, $13
+	sltu	$13, $12, $13
+	bnez	$13, L.15
+	lw	$13, 8($sp)
+	addui	$13, $13, 25
+	lw	$12, 9($sp)
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.12
+L.15:
+	addu	$1, $0, $0
+	j	L.9
+L.13:
+	lw	$13, 8($sp)
+	lw	$12, 27($13)
+	addu	$12, $0, $12
+	lw	$13, 25($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$7, $0, $13
+	lw	$13, 9($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.17
+	lw	$13, 8($sp)
+	addui	$13, $13, 25
+	lw	$12, 9($sp)
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.12
+L.17:
+	lw	$13, 9($sp)
+	sub	$13, $13, $7
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 8($sp)
+	lw	$13, 27($13)
+	addui	$13, $13, 1
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	get_free_pages_from
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.19
+	addu	$1, $0, $0
+	j	L.9
+L.19:
+	lw	$13, 8($sp)
+	addui	$13, $13, 27
+	lw	$12, 0($13)
+	addu	$12, $6, $12
+	sw	$12, 0($13)
+	lw	$13, 8($sp)
+	addui	$13, $13, 25
+	lw	$12, 9($sp)
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+L.12:
+	lw	$13, 8($sp)
+	lw	$1, 25($13)
+L.9:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_sbrk
+do_sbrk:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	jal	sys_sbrk
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.22
+	la	$13, L.24
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	addui	$12, $13, 94
+	sw	$12, 2($sp)
+	lw	$13, 114($13)
+	sw	$13, 3($sp)
+	jal	kwarn
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.21
+L.22:
+	lw	$13, 8($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	subu	$13, $7, $13
+	addu	$13, $0, $13
+	addu	$1, $0, $13
+L.21:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_brk
+do_brk:
+	subui	$sp, $sp, 10
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 11($sp)
+	lw	$13, 5($13)
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 11($sp)
+	lw	$12, 5($12)
+	addu	$6, $13, $12
+	lw	$13, 10($sp)
+	lw	$12, 11($sp)
+	lw	$11, 25($13)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	subu	$13, $11, $13
+	sw	$13, 5($12)
+	addu	$13, $0, $6
+	lw	$12, 10($sp)
+	lw	$12, 25($12)
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.26
+	addu	$13, $0, $6
+	lw	$12, 10($sp)
+	lw	$12, 24($12)
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.28
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.25
+L.28:
+	lw	$13, 10($sp)
+	sw	$6, 25($13)
+	lw	$13, 11($sp)
+	lw	$12, 8($sp)
+	sw	$12, 5($13)
+	addu	$1, $0, $0
+	j	L.25
+L.26:
+	lw	$13, 10($sp)
+	addu	$12, $0, $6
+	lw	$11, 25($13)
+	addu	$11, $0, $11
+	subu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	sys_sbrk
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.30
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.25
+L.30:
+	lw	$13, 10($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	subu	$7, $7, $13
+	lw	$13, 11($sp)
+	sw	$7, 5($13)
+	addu	$1, $0, $0
+L.25:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.24:
+	.asciiz	"sbrk of %d for %s[%d] failed\n"
@@ -0,0 +1,176 @@
+.global	do_winix_strerror
+.text
+do_winix_strerror:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 10($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.9
+L.10:
+	lw	$13, 10($sp)
+	lw	$12, 2($13)
+	sw	$12, 7($sp)
+	lw	$7, 3($13)
+	sle	$13, $7, $0
+	bnez	$13, L.14
+	slti	$13, $7, 40
+	bnez	$13, L.12
+L.14:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.12:
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 10($sp)
+	lw	$12, 5($12)
+	addu	$13, $13, $12
+	sw	$13, 8($sp)
+	sw	$7, 0($sp)
+	jal	kstr_error
+	addu	$13, $0, $1
+	lw	$12, 8($sp)
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	strlcpy
+	addu	$1, $0, $0
+L.9:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_winix_dprintf
+do_winix_dprintf:
+	subui	$sp, $sp, 14
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 15($sp)
+	lw	$7, 2($13)
+	lw	$6, 5($13)
+	lw	$5, 6($13)
+	sw	$6, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 14($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.18
+	sw	$5, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 14($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.16
+L.18:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.15
+L.16:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.19
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.15
+L.19:
+	lw	$13, 14($sp)
+	addui	$12, $13, 214
+	addu	$12, $7, $12
+	lw	$12, 0($12)
+	sw	$12, 13($sp)
+	addui	$12, $13, 16
+	lw	$11, 0($12)
+	addu	$11, $0, $11
+	addu	$11, $11, $6
+	sw	$11, 12($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	addu	$12, $12, $5
+	sw	$12, 11($sp)
+	lw	$12, 13($sp)
+	sw	$12, 0($sp)
+	lw	$12, 12($sp)
+	sw	$12, 1($sp)
+	lw	$12, 11($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	kprintf_vm
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.15:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
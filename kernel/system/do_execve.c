@@ -44,11 +44,19 @@ struct initial_frame{
     struct exit_code code;
 };
 
-struct string_array{
-    char **array;
-    int size;
+// argv and envp of the new image, packed in one allocation. The argv and envp
+// pointer arrays come first, followed by the strings. Until copied to the
+// user heap, each pointer holds the offset of its string in the arena
+struct exec_args{
+    ptr_t *arena;
+    int len;
+    int argc;
+    int envc;
 };
 
+#define ARG_LEN_MAX     (PAGE_LEN * sizeof(char))
+#define ARG_NUM_MAX     (ARG_MAX / ARG_LEN_MAX)
+
 int do_execve(struct proc *who, struct message *m){
     char* path = m->m1_p1;
     char** argv = m->m1_p2;
@@ -61,113 +69,111 @@ int do_execve(struct proc *who, struct message *m){
         envp = (char**)get_physical_addr(envp, who);
         if((ret = copy_from_user(who, (ptr_t *)buffer, (vptr_t *)path, PATH_MAX)) < 0)
             return ret;
-        return exec_welf(who, buffer, argv, envp, false);
+        return exec_welf(who, buffer, argv, envp, who);
     }
     return -EFAULT;
 }
 
-int copy_stirng_array(struct string_array *arr, char* from[], struct proc* who, bool is_physical_addr){
-    int limit_per_arg = PAGE_LEN * sizeof(char);
-    int limit_arg_num = ARG_MAX / limit_per_arg;
-    int count = limit_arg_num;
-    int size = 0, i, strsize, j, ret;
-    char* physical;
-    char **pptr = from;
+PRIVATE char* get_arg_string(char* str, struct proc* from){
+    if(from){
+        if(resolve_user_pages(from, (vptr_t *)str, ARG_LEN_MAX) || !is_vaddr_accessible(str, from))
+            return NULL;
+        str = (char*)get_physical_addr(str, from);
+    }
+    return str;
+}
 
-    arr->size = 0;
-    if(!from)
+/**
+ * count the strings in array, and add the space they take to size
+ * @param  array 
+ * @param  from  
+ * @param  size  
+ * @return       number of strings, or -EFAULT
+ */
+PRIVATE int measure_string_array(char* array[], struct proc* from, int* size){
+    int nr = 0, len;
+    char* str;
+    if(!array)
         return 0;
-    while(*pptr++ && count-- > 0){
-        size++;
-    }
-    size++;
-    arr->array = (char**)kmalloc(size, sizeof(char *));
-    if(!arr->array){
-        return -ENOMEM;
+    while(array[nr] && nr < ARG_NUM_MAX){
+        if(!(str = get_arg_string(array[nr], from)))
+            return -EFAULT;
+        len = strlen(str);
+        *size += (len < ARG_LEN_MAX ? len : ARG_LEN_MAX - 1) + 1;
+        nr++;
     }
-    arr->size = size;
-    pptr = from;
-    count = limit_per_arg;
-    for(i = 0; i < size - 1; i++){
-        physical = from[i];
-        if(!is_physical_addr){
-            physical = (char*)get_physical_addr(physical, who);
-        }
-        strsize = strlen(physical);
-        strsize = strsize < limit_per_arg ? strsize : limit_per_arg;
-        arr->array[i] = (char*)kmalloc(strsize + 1, sizeof(char));
-        if(!arr->array[i]){
-            ret = -ENOMEM;
-            goto err_free_all;
-        }
-        
-        strlcpy(arr->array[i], physical, limit_per_arg);
-    }
-    arr->array[i] = NULL;
-    ret = 0;
-    
-    goto final;
-
-    err_free_all:
-        for( j = 0; j < i; j++){
-            kfree(arr->array[j]);
-        }
-    kfree(arr->array);
-    final:
-    return ret;
+    return nr;
 }
 
-void kfree_string_array(struct string_array* arr){
-    int j;
-    char *p;
-    for( j = 0; j < arr->size; j++){
-        p = arr->array[j];
-        if(p){
-            kfree(p);
-        }
+/**
+ * copy nr strings of array to the arena from offset onward,
+ * and record their offsets in the pointer array ptrs
+ * @return  offset after the last string
+ */
+PRIVATE int pack_string_array(ptr_t* arena, ptr_t* ptrs, char* array[], int nr, struct proc* from, int offset){
+    char* dest;
+    int i;
+    for(i = 0; i < nr; i++){
+        dest = arena + offset;
+        strlcpy(dest, get_arg_string(array[i], from), ARG_LEN_MAX);
+        ptrs[i] = offset;
+        offset += strlen(dest) + 1;
     }
-    kfree(arr->array);
+    ptrs[nr] = 0;
+    return offset;
 }
 
-void copy_sarray_to_heap(struct proc* who, struct string_array* arr, ptr_t* p){
-    int i, len;
-    for(i = 0; i < arr->size - 1; i++){
-        len = strlen(arr->array[i]) + 1;
-        *p++ = (unsigned int)(unsigned long)copyto_user_heap(who, arr->array[i], len);
-    }
-    *p = 0;
+/**
+ * measure argv and envp, then pack both of them in a single arena
+ * @param  args 
+ * @param  argv 
+ * @param  envp 
+ * @param  from 
+ * @return      
+ */
+PRIVATE int pack_exec_args(struct exec_args* args, char* argv[], char* envp[], struct proc* from){
+    int size = 0, offset;
+
+    args->argc = measure_string_array(argv, from, &size);
+    if(args->argc < 0)
+        return args->argc;
+    args->envc = measure_string_array(envp, from, &size);
+    if(args->envc < 0)
+        return args->envc;
+    offset = args->argc + 1 + args->envc + 1;
+    args->len = offset + size;
+    args->arena = (ptr_t*)kmalloc(args->len, sizeof(ptr_t));
+    if(!args->arena)
+        return -ENOMEM;
+    offset = pack_string_array(args->arena, args->arena, argv, args->argc, from, offset);
+    pack_string_array(args->arena, args->arena + args->argc + 1, envp, args->envc, from, offset);
+    return 0;
 }
 
-int build_user_stack(struct proc* who, struct string_array* argv, struct string_array* env){
+int build_user_stack(struct proc* who, struct exec_args* args){
     struct initial_frame init_stack;
     unsigned long* sp_btm;
-    ptr_t *env_ptr = NULL, *argv_ptr = NULL;
+    ptr_t *arena;
+    vptr_t *varena;
+    int i;
 
     sp_btm = (unsigned long*)get_physical_addr((unsigned long)align_page((int)(unsigned long)who->ctx.m.sp) - 1,who);
 
     memset(&init_stack, 0, sizeof(init_stack));
 
-    // malloc the pointer for each environment and argv variable
-    if(argv->size > 0){
-        argv_ptr = (ptr_t*)kmalloc(argv->size, sizeof(ptr_t));
-        if(argv_ptr){
-            copy_sarray_to_heap(who, argv, argv_ptr);
-            init_stack.argc = argv->size - 1;
-            init_stack.argv = (char**)copyto_user_heap(who, argv_ptr, argv->size);
-            // kdebug("%d argc %d argv %p\n", who->pid, init_stack.argc, init_stack.argv);
-            kfree(argv_ptr);
-        }
-    }
-    if(env->size > 0){
-        env_ptr = (ptr_t*)kmalloc(env->size, sizeof(ptr_t));
-        if(env_ptr){
-            copy_sarray_to_heap(who, env, env_ptr);
-            // store the pointer to environment variable at the bottom of stack
-            // this can be retrieved by get_environ() in lib/ansi/env.c
-            *sp_btm = (unsigned long)copyto_user_heap(who, env_ptr, env->size);
-            // kdebug("build stack env %p physical %p\n", *sp_btm , get_physical_addr(*sp_btm, who));
-            kfree(env_ptr);
+    // copy the arena in one go, and turn the offsets into user addresses
+    varena = copyto_user_heap(who, args->arena, args->len);
+    if(varena){
+        arena = get_physical_addr(varena, who);
+        for(i = 0; i < args->argc + 1 + args->envc + 1; i++){
+            if(arena[i])
+                arena[i] = (ptr_t)(unsigned long)(varena + arena[i]);
         }
+        init_stack.argc = args->argc;
+        init_stack.argv = (char**)varena;
+        // store the pointer to environment variable at the bottom of stack
+        // this can be retrieved by get_environ() in lib/ansi/env.c
+        *sp_btm = (unsigned long)(varena + args->argc + 1);
     }
 
     // setup exit if main is returned
@@ -193,23 +199,28 @@ void arch_elf(struct winix_elf* elf, struct superblock* sb){
     ARCH_CHAR_SIZE(elf->binary_offset, sb);
 }
 
-int exec_welf(struct proc* who, const char* path, char *argv[], char *envp[], bool is_new){
+/**
+ * load the welf binary at path as the new image of who
+ * @param who   
+ * @param path  
+ * @param argv  physical address of the argv array
+ * @param envp  physical address of the envp array
+ * @param from  process whose address space the strings of argv and envp
+ *              are in, or NULL if they are in the kernel
+ * @return      DONTREPLY on success
+ */
+int exec_welf(struct proc* who, const char* path, char *argv[], char *envp[], struct proc* from){
     int ret;
     struct filp* filp;
     bool has_enough_ram;
     struct winix_elf elf;
-    struct string_array argv_copy, envp_copy;
+    struct exec_args args;
     struct proc* parent = get_proc(who->parent);
     struct message m;
 
     memset(&m, 0, sizeof(m));
-    memset(&argv_copy, 0, sizeof(struct string_array));
-    memset(&envp_copy, 0, sizeof(struct string_array));
-    if (argv && (ret = copy_stirng_array(&argv_copy, argv, who, is_new)))
+    if ((ret = pack_exec_args(&args, argv, envp, from)))
         return ret;
-    // kdebug("copy argv string %d\n", argv_copy.size);
-    if (envp && (ret = copy_stirng_array(&envp_copy, envp, who, is_new)))
-        goto err_env;
 
     ret = filp_open(who, &filp, path, O_RDONLY | O_DIRECT, 0);
     if(ret)
@@ -238,7 +249,7 @@ int exec_welf(struct proc* who, const char* path, char *argv[], char *envp[], bo
         goto final;
     }
 
-    if ((ret = release_proc_mem(who)))
+    if (who->mem_start && (ret = release_proc_mem(who)))
         goto final;
     bitmap_clear((unsigned int *)who->ctx.ptable, PTABLE_LEN);
     
@@ -260,7 +271,8 @@ int exec_welf(struct proc* who, const char* path, char *argv[], char *envp[], bo
     }
 
     who->thread_parent = 0;
-    build_user_stack(who, &argv_copy, &envp_copy);
+    who->uring = NULL;
+    build_user_stack(who, &args);
     proc_memctl(who, (void *)0, false);
     ret = 0;
     goto final;
@@ -268,13 +280,7 @@ int exec_welf(struct proc* who, const char* path, char *argv[], char *envp[], bo
 final:
     filp_close(filp);
 err_open:
-    // kdebug("freeing envp\n");
-    if (envp)
-        kfree_string_array(&envp_copy);
-err_env:
-    // kdebug("freeing argv\n");
-    if (argv)
-        kfree_string_array(&argv_copy);
+    kfree(args.arena);
 
     if (trace_syscall || ret != 0){
         klog("%s[%d] execve() %s, return %s\n", who->name, who->pid, path, kstr_error(ret));
@@ -285,7 +291,7 @@ err_env:
         set_proc(who, (void (*)())(unsigned long)elf.binary_pc, path);
     }
     
-    if(!is_new){
+    if(from == who){
         if(parent->state & STATE_VFORKING){
             parent->state &= ~STATE_VFORKING;
             m.type = VFORK;
@@ -0,0 +1,911 @@
+.global	do_execve
+.text
+do_execve:
+	subui	$sp, $sp, 141
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 142($sp)
+	lw	$13, 5($13)
+	sw	$13, 140($sp)
+	lw	$13, 142($sp)
+	lw	$7, 6($13)
+	lw	$13, 142($sp)
+	lw	$6, 7($13)
+	lw	$13, 140($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 141($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	sw	$7, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 141($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	sw	$6, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 141($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 141($sp)
+	addui	$12, $13, 16
+	lw	$11, 0($12)
+	addu	$11, $0, $11
+	addu	$7, $11, $7
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	addu	$6, $12, $6
+	sw	$13, 0($sp)
+	addui	$13, $sp, 12
+	sw	$13, 1($sp)
+	lw	$13, 140($sp)
+	sw	$13, 2($sp)
+	addui	$13, $0, 128
+	sw	$13, 3($sp)
+	jal	copy_from_user
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.12
+	lw	$1, 11($sp)
+	j	L.9
+L.12:
+	lw	$13, 141($sp)
+	sw	$13, 0($sp)
+	addui	$12, $sp, 12
+	sw	$12, 1($sp)
+	sw	$7, 2($sp)
+	sw	$6, 3($sp)
+	sw	$13, 4($sp)
+	jal	exec_welf
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.9
+L.10:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+L.9:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 141
+	jr	$ra
+get_arg_string:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.19
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.17
+L.19:
+	addu	$1, $0, $0
+	j	L.14
+L.17:
+	lw	$13, 7($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 6($sp)
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+L.15:
+	lw	$1, 6($sp)
+L.14:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+measure_string_array:
+	subui	$sp, $sp, 10
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addu	$7, $0, $0
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.24
+	addu	$1, $0, $0
+	j	L.20
+L.23:
+	lw	$13, 10($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	get_arg_string
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.26
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.20
+L.26:
+	sw	$5, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	addui	$12, $0, 1024
+	sgeu	$13, $13, $12
+	bnez	$13, L.29
+	addu	$4, $0, $6
+	j	L.30
+L.29:
+	addui	$4, $0, 1023
+L.30:
+	lw	$13, 12($sp)
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addui	$11, $0, 1
+	addu	$11, $4, $11
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	addi	$7, $7, 1
+L.24:
+	lw	$13, 10($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.31
+	addu	$13, $0, $7
+	addui	$12, $0, 10
+	sltu	$13, $13, $12
+	bnez	$13, L.23
+L.31:
+	addu	$1, $0, $7
+L.20:
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+pack_string_array:
+	subui	$sp, $sp, 9
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addu	$7, $0, $0
+	j	L.36
+L.33:
+	lw	$13, 14($sp)
+	lw	$12, 9($sp)
+	addu	$6, $13, $12
+	lw	$13, 11($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	jal	get_arg_string
+	addu	$13, $0, $1
+	sw	$6, 0($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	strlcpy
+	lw	$13, 10($sp)
+	addu	$13, $7, $13
+	lw	$12, 14($sp)
+	sw	$12, 0($13)
+	sw	$6, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	lw	$12, 14($sp)
+	addu	$12, $0, $12
+	addui	$11, $0, 1
+	addu	$13, $13, $11
+	addu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 14($sp)
+L.34:
+	addi	$7, $7, 1
+L.36:
+	lw	$13, 12($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.33
+	lw	$13, 12($sp)
+	lw	$12, 10($sp)
+	addu	$13, $13, $12
+	sw	$0, 0($13)
+	lw	$1, 14($sp)
+L.32:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+pack_exec_args:
+	subui	$sp, $sp, 12
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	sw	$0, 11($sp)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	jal	measure_string_array
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$13, 2($12)
+	lw	$13, 12($sp)
+	lw	$13, 2($13)
+	sge	$13, $13, $0
+	bnez	$13, L.38
+	lw	$13, 12($sp)
+	lw	$1, 2($13)
+	j	L.37
+L.38:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	jal	measure_string_array
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$13, 3($12)
+	lw	$13, 12($sp)
+	lw	$13, 3($13)
+	sge	$13, $13, $0
+	bnez	$13, L.40
+	lw	$13, 12($sp)
+	lw	$1, 3($13)
+	j	L.37
+L.40:
+	lw	$13, 12($sp)
+	lw	$12, 2($13)
+	addi	$12, $12, 1
+	lw	$11, 3($13)
+	add	$12, $12, $11
+	addi	$7, $12, 1
+	lw	$12, 11($sp)
+	add	$12, $7, $12
+	sw	$12, 1($13)
+	lw	$13, 12($sp)
+	lw	$12, 1($13)
+	addu	$12, $0, $12
+	sw	$12, 0($sp)
+	addui	$12, $0, 1
+	sw	$12, 1($sp)
+	jal	kmalloc
+	addu	$12, $0, $1
+	sw	$12, 0($13)
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.42
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.37
+L.42:
+	lw	$13, 12($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	sw	$12, 1($sp)
+	lw	$12, 13($sp)
+	sw	$12, 2($sp)
+	lw	$13, 2($13)
+	sw	$13, 3($sp)
+	lw	$13, 15($sp)
+	sw	$13, 4($sp)
+	sw	$7, 5($sp)
+	jal	pack_string_array
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 12($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$11, 2($13)
+	addu	$12, $11, $12
+	addui	$12, $12, 1
+	sw	$12, 1($sp)
+	lw	$12, 14($sp)
+	sw	$12, 2($sp)
+	lw	$13, 3($13)
+	sw	$13, 3($sp)
+	lw	$13, 15($sp)
+	sw	$13, 4($sp)
+	sw	$7, 5($sp)
+	jal	pack_string_array
+	addu	$1, $0, $0
+L.37:
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	build_user_stack
+build_user_stack:
+	subui	$sp, $sp, 18
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 18($sp)
+	lw	$12, 13($13)
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	sw	$12, 0($sp)
+	jal	align_page
+	addu	$12, $0, $1
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$12, $0, $12
+	addui	$11, $0, 1
+	subu	$12, $12, $11
+	addu	$12, $0, $12
+	addu	$13, $13, $12
+	sw	$13, 10($sp)
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 7
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 18($sp)
+	sw	$13, 0($sp)
+	lw	$13, 19($sp)
+	lw	$12, 0($13)
+	sw	$12, 1($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	copyto_user_heap
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	addu	$13, $0, $5
+	sequ	$13, $13, $0
+	bnez	$13, L.45
+	lw	$13, 18($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$6, $13, $5
+	addu	$7, $0, $0
+	j	L.50
+L.47:
+	addu	$13, $7, $6
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.51
+	addu	$13, $7, $6
+	lw	$12, 0($13)
+	addu	$12, $12, $5
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+L.51:
+L.48:
+	addi	$7, $7, 1
+L.50:
+	lw	$13, 19($sp)
+	lw	$12, 2($13)
+	addi	$12, $12, 1
+	lw	$13, 3($13)
+	add	$13, $12, $13
+	addi	$13, $13, 1
+	slt	$13, $7, $13
+	bnez	$13, L.47
+	lw	$13, 19($sp)
+	lw	$13, 2($13)
+	sw	$13, 11($sp)
+	sw	$5, 12($sp)
+	lw	$13, 10($sp)
+	lw	$12, 19($sp)
+	lw	$12, 2($12)
+	addu	$12, $12, $5
+	addui	$12, $12, 1
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+L.45:
+	lw	$13, 18($sp)
+	lw	$12, 13($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffe
+	addu	$12, $12, $11
+	sw	$12, 14($13)
+	addui	$13, $0, 2
+	sw	$13, 13($sp)
+	lhi	$13, 0x1029
+	ori	$13, $13, 0x3847
+	sw	$13, 14($sp)
+	sw	$0, 15($sp)
+	lhi	$13, 0x1ee1
+	ori	$13, $13, 0x2
+	sw	$13, 16($sp)
+	lhi	$13, 0x200d
+	ori	$13, $13, 0x0
+	sw	$13, 17($sp)
+	lw	$13, 18($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	addui	$13, $0, 7
+	sw	$13, 2($sp)
+	jal	copyto_user_stack
+	addu	$1, $0, $0
+L.44:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 18
+	jr	$ra
+.global	arch_elf
+arch_elf:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	addui	$13, $13, 3
+	lw	$12, 0($13)
+	addui	$11, $0, 32
+	lw	$10, 5($sp)
+	lw	$10, 16($10)
+	divu	$11, $11, $10
+	divu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	addui	$13, $13, 6
+	lw	$12, 0($13)
+	addui	$11, $0, 32
+	lw	$10, 5($sp)
+	lw	$10, 16($10)
+	divu	$11, $11, $10
+	divu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	addui	$13, $13, 5
+	lw	$12, 0($13)
+	addui	$11, $0, 32
+	lw	$10, 5($sp)
+	lw	$10, 16($10)
+	divu	$11, $11, $10
+	divu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	addui	$11, $0, 32
+	lw	$10, 5($sp)
+	lw	$10, 16($10)
+	divu	$11, $11, $10
+	divu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addui	$11, $0, 32
+	lw	$10, 5($sp)
+	lw	$10, 16($10)
+	divu	$11, $11, $10
+	divu	$12, $12, $11
+	sw	$12, 0($13)
+L.60:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	exec_welf
+exec_welf:
+	subui	$sp, $sp, 34
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 34($sp)
+	lw	$13, 120($13)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	sw	$13, 12($sp)
+	addui	$13, $sp, 14
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 8
+	sw	$13, 2($sp)
+	jal	memset
+	addui	$13, $sp, 22
+	sw	$13, 0($sp)
+	lw	$13, 36($sp)
+	sw	$13, 1($sp)
+	lw	$13, 37($sp)
+	sw	$13, 2($sp)
+	lw	$13, 38($sp)
+	sw	$13, 3($sp)
+	jal	pack_exec_args
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.62
+	addu	$1, $0, $7
+	j	L.61
+L.62:
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 26
+	sw	$13, 1($sp)
+	lw	$13, 35($sp)
+	sw	$13, 2($sp)
+	lhi	$13, 0x8
+	ori	$13, $13, 0x0
+	sw	$13, 3($sp)
+	sw	$0, 4($sp)
+	jal	filp_open
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.64
+	j	L.66
+L.64:
+	lw	$13, 26($sp)
+	lw	$13, 3($13)
+	lw	$13, 0($13)
+	addui	$12, $0, 16384
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.67
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffeb
+	j	L.66
+L.67:
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	lw	$13, 26($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 27
+	sw	$13, 2($sp)
+	addui	$13, $0, 7
+	sw	$13, 3($sp)
+	jal	filp_read
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	addui	$12, $0, 7
+	sequ	$13, $13, $12
+	bnez	$13, L.69
+	la	$13, L.71
+	sw	$13, 0($sp)
+	lw	$13, 35($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	kwarn
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xfffb
+	j	L.72
+L.69:
+	addui	$13, $sp, 27
+	sw	$13, 0($sp)
+	lw	$13, 26($sp)
+	lw	$13, 3($13)
+	lw	$13, 20($13)
+	sw	$13, 1($sp)
+	jal	arch_elf
+	addui	$13, $sp, 27
+	sw	$13, 0($sp)
+	addui	$13, $0, 1024
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	peek_mem_welf
+	addu	$13, $0, $1
+	sw	$13, 13($sp)
+	lw	$13, 13($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.73
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xfff4
+	j	L.72
+L.73:
+	addui	$13, $sp, 27
+	sw	$13, 0($sp)
+	jal	validate_welf
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.75
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xfff8
+	j	L.72
+L.75:
+	lw	$13, 34($sp)
+	sw	$13, 11($sp)
+	lw	$12, 21($13)
+	addu	$12, $0, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.77
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	release_proc_mem
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.77
+	j	L.72
+L.77:
+	lw	$13, 34($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	jal	bitmap_clear
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 27
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	sw	$13, 3($sp)
+	jal	alloc_mem_welf
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.79
+	j	L.72
+L.79:
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	lw	$12, 26($sp)
+	sw	$12, 1($sp)
+	lw	$12, 29($sp)
+	lw	$13, 16($13)
+	addu	$13, $12, $13
+	sw	$13, 2($sp)
+	lw	$13, 30($sp)
+	sw	$13, 3($sp)
+	jal	filp_read
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	lw	$12, 30($sp)
+	sequ	$13, $13, $12
+	bnez	$13, L.83
+	slt	$13, $7, $0
+	bnez	$13, L.72
+	la	$13, L.88
+	sw	$13, 0($sp)
+	lw	$13, 30($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	kwarn
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xfff5
+	j	L.72
+L.83:
+	lw	$13, 34($sp)
+	sw	$0, 121($13)
+	lw	$13, 34($sp)
+	sw	$0, 212($13)
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 22
+	sw	$13, 1($sp)
+	jal	build_user_stack
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	sw	$0, 2($sp)
+	jal	proc_memctl
+	addu	$7, $0, $0
+L.72:
+	lw	$13, 26($sp)
+	sw	$13, 0($sp)
+	jal	filp_close
+L.66:
+	lw	$13, 22($sp)
+	sw	$13, 0($sp)
+	jal	kfree
+	addu	$13, $0, $0
+	sw	$13, 10($sp)
+	lw	$12, trace_syscall($0)
+	sne	$13, $12, $13
+	bnez	$13, L.92
+	lw	$13, 10($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.90
+L.92:
+	sw	$7, 0($sp)
+	jal	kstr_error
+	addu	$13, $0, $1
+	la	$12, L.93
+	sw	$12, 0($sp)
+	lw	$12, 34($sp)
+	addui	$11, $12, 94
+	sw	$11, 1($sp)
+	lw	$12, 114($12)
+	sw	$12, 2($sp)
+	lw	$12, 35($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	jal	klog
+L.90:
+	sne	$13, $7, $0
+	bnez	$13, L.94
+	lw	$13, 34($sp)
+	sw	$0, 19($13)
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule
+	lw	$13, 34($sp)
+	sw	$13, 0($sp)
+	lw	$13, 28($sp)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	lw	$13, 35($sp)
+	sw	$13, 2($sp)
+	jal	set_proc
+L.94:
+	lw	$13, 38($sp)
+	addu	$13, $0, $13
+	lw	$12, 34($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.97
+	lw	$13, 12($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 8
+	seq	$13, $13, $0
+	bnez	$13, L.99
+	lw	$13, 12($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfff7
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	addui	$13, $0, 4
+	sw	$13, 15($sp)
+	addui	$13, $0, 4
+	sw	$13, 0($sp)
+	lw	$13, 34($sp)
+	lw	$13, 114($13)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 14
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+L.99:
+L.97:
+	sne	$13, $7, $0
+	bnez	$13, L.102
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1b
+	j	L.61
+L.102:
+	addu	$1, $0, $7
+L.61:
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 34
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.93:
+	.asciiz	"%s[%d] execve() %s, return %s\n"
+L.88:
+	.asciiz	"exp %d read %d\n"
+L.71:
+	.asciiz	"welf %s read fail %d\n"
@@ -110,6 +110,12 @@ void clear_sending_mesg(struct proc *who){
     struct proc *rp; // iterate over the process table
     struct proc **xp; // iterate over the process's queue
 
+    list_del_init(&who->notify_link);
+
+    // only a process blocked sending is in a sender_q
+    if(!(who->state & STATE_SENDING))
+        return;
+
     foreach_proc_and_task(rp){
         if((xp = &(rp->sender_q)) != NULL && *xp){
             // walk through the message queues
@@ -127,6 +133,9 @@ void clear_sending_mesg(struct proc *who){
 
 void clear_proc_mesg(struct proc *who){
     clear_sending_mesg(who);
+    // notifications to this process are dropped
+    while(!list_empty(&who->notify_q))
+        list_del_init(who->notify_q.next);
 }
 
 
@@ -196,11 +205,10 @@ void exit_proc_in_interrupt(struct proc* who, int exit_val,int signum){
 }
 
 void exit_proc(struct proc *who, int status, int signum){
-    struct proc *mp;
     int i;
     struct filp* file;
     struct message* mesg;
-    struct proc* parent;
+    struct proc *parent, *owner;
 
 
     if(in_interrupt()){
@@ -223,6 +231,13 @@ void exit_proc(struct proc *who, int status, int signum){
     who->exit_status = status;
     who->sig_status = signum;
 
+    // the image is no longer shared with this thread, see copy_mm()
+    if(IS_THREAD(who)){
+        owner = get_proc(who->thread_parent);
+        if(owner && owner->mem_start == who->mem_start && owner->nr_threads > 0)
+            owner->nr_threads--;
+    }
+
     // When process is created by vfork, parent will be blocked
     // until child _exit(2) or execve(2), to prevent race condition
     // between the parent and child. Since both child and parent share
@@ -238,9 +253,7 @@ void exit_proc(struct proc *who, int status, int signum){
     }
 
     // child will be adopted by INIT
-    foreach_child(mp, who){
-        mp->parent = INIT;
-    }
+    reparent_children(who, proc_table + INIT);
 
     for(i = 0; i < OPEN_MAX; i++){
         file = who->fp_filp[i];
@@ -0,0 +1,784 @@
+.global	get_wstats
+.text
+get_wstats:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	lw	$12, 112($13)
+	slli	$12, $12, 8
+	lw	$13, 113($13)
+	andi	$13, $13, 127
+	or	$13, $12, $13
+	sw	$13, 2($sp)
+	lw	$1, 2($sp)
+L.9:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	do_waitpid
+do_waitpid:
+	subui	$sp, $sp, 15
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	addu	$4, $0, $0
+	lw	$13, 16($sp)
+	lw	$6, 2($13)
+	lw	$5, 3($13)
+	lw	$3, 5($13)
+	addu	$13, $0, $3
+	sequ	$13, $13, $0
+	bnez	$13, L.11
+	sw	$3, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 15($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.11
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.10
+L.11:
+	lw	$13, 15($sp)
+	lw	$13, 123($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff83
+	addu	$7, $13, $12
+	j	L.16
+L.13:
+	sle	$13, $6, $0
+	bnez	$13, L.17
+	lw	$13, 114($7)
+	seq	$13, $6, $13
+	bnez	$13, L.17
+	j	L.14
+L.17:
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sge	$13, $6, $13
+	bnez	$13, L.19
+	subu	$13, $0, $6
+	lw	$12, 115($7)
+	seq	$13, $13, $12
+	bnez	$13, L.19
+	j	L.14
+L.19:
+	sne	$13, $6, $0
+	bnez	$13, L.21
+	lw	$13, 115($7)
+	lw	$12, 15($sp)
+	lw	$12, 115($12)
+	seq	$13, $13, $12
+	bnez	$13, L.21
+	j	L.14
+L.21:
+	lw	$13, 19($7)
+	sw	$13, 14($sp)
+	addu	$12, $0, $13
+	lhi	$11, 0x8000
+	ori	$11, $11, 0x0
+	and	$12, $12, $11
+	sneu	$13, $12, $0
+	bnez	$13, L.25
+	addu	$13, $0, $0
+	sw	$13, 13($sp)
+	andi	$12, $5, 2
+	seq	$13, $12, $13
+	bnez	$13, L.23
+	lw	$13, 14($sp)
+	andi	$13, $13, 16
+	lw	$12, 13($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.23
+L.25:
+	addu	$13, $0, $3
+	sequ	$13, $13, $0
+	bnez	$13, L.26
+	lw	$13, 15($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$2, $13, $3
+	sw	$7, 0($sp)
+	jal	get_wstats
+	addu	$13, $0, $1
+	sw	$13, 0($2)
+L.26:
+	sw	$7, 0($sp)
+	jal	release_zombie
+	lw	$1, 114($7)
+	j	L.10
+L.23:
+	addi	$4, $4, 1
+L.14:
+	lw	$13, 125($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff83
+	addu	$7, $13, $12
+L.16:
+	addui	$13, $7, 125
+	addu	$13, $0, $13
+	lw	$12, 15($sp)
+	addui	$12, $12, 123
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.13
+	andi	$13, $5, 1
+	seq	$13, $13, $0
+	bnez	$13, L.28
+	addu	$1, $0, $0
+	j	L.10
+L.28:
+	sne	$13, $4, $0
+	bnez	$13, L.30
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff6
+	j	L.10
+L.30:
+	lw	$13, 15($sp)
+	sw	$6, 117($13)
+	lw	$13, 15($sp)
+	sw	$5, 119($13)
+	lw	$13, 15($sp)
+	sw	$3, 118($13)
+	lw	$13, 15($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 4
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+L.10:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	clear_sending_mesg
+clear_sending_mesg:
+	subui	$sp, $sp, 7
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+L.33:
+L.36:
+L.39:
+	lw	$13, 7($sp)
+	lw	$12, 69($13)
+	lw	$13, 70($13)
+	sw	$13, 1($12)
+	lw	$13, 7($sp)
+	lw	$12, 70($13)
+	lw	$13, 69($13)
+	sw	$13, 0($12)
+L.40:
+L.37:
+L.42:
+	lw	$13, 7($sp)
+	addui	$13, $13, 69
+	sw	$13, 0($13)
+	lw	$13, 7($sp)
+	addui	$12, $13, 69
+	sw	$12, 70($13)
+L.43:
+L.34:
+	lw	$13, 7($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 1
+	sne	$13, $13, $0
+	bnez	$13, L.45
+	j	L.32
+L.45:
+	lw	$13, proc_table($0)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfe28
+	addu	$6, $13, $12
+	j	L.50
+L.47:
+	lw	$13, 131($6)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.51
+	addui	$13, $6, 65
+	addu	$7, $0, $13
+	addu	$12, $0, $0
+	addu	$13, $0, $13
+	sequ	$13, $13, $12
+	bnez	$13, L.53
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $12
+	bnez	$13, L.53
+	j	L.56
+L.55:
+	lw	$13, 0($7)
+	addui	$7, $13, 66
+L.56:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sw	$13, 6($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.58
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	lw	$12, 6($sp)
+	sneu	$13, $12, $13
+	bnez	$13, L.55
+L.58:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.59
+	lw	$13, 0($7)
+	lw	$13, 66($13)
+	sw	$13, 0($7)
+L.59:
+L.53:
+L.51:
+L.48:
+	sw	$6, 0($sp)
+	jal	next_proc_slot
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+L.50:
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.47
+L.32:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	clear_proc_mesg
+clear_proc_mesg:
+	subui	$sp, $sp, 4
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	jal	clear_sending_mesg
+	j	L.63
+L.62:
+L.65:
+L.68:
+L.71:
+	lw	$13, 4($sp)
+	lw	$13, 67($13)
+	lw	$12, 0($13)
+	lw	$13, 1($13)
+	sw	$13, 1($12)
+	lw	$13, 4($sp)
+	lw	$13, 67($13)
+	lw	$12, 1($13)
+	lw	$13, 0($13)
+	sw	$13, 0($12)
+L.72:
+L.69:
+L.74:
+	lw	$13, 4($sp)
+	lw	$13, 67($13)
+	sw	$13, 0($13)
+	lw	$13, 4($sp)
+	lw	$13, 67($13)
+	sw	$13, 1($13)
+L.75:
+L.66:
+L.63:
+	lw	$13, 4($sp)
+	addui	$13, $13, 67
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.62
+L.61:
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	check_waiting
+check_waiting:
+	subui	$sp, $sp, 13
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 13($sp)
+	lw	$13, 120($13)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	jal	get_ipc_mesg
+	addu	$13, $0, $1
+	sw	$13, 12($sp)
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.78
+	lw	$13, 19($7)
+	andi	$13, $13, 4
+	seq	$13, $13, $0
+	bnez	$13, L.78
+	lw	$6, 117($7)
+	sle	$13, $6, $0
+	bnez	$13, L.83
+	lw	$13, 13($sp)
+	lw	$13, 114($13)
+	seq	$13, $6, $13
+	bnez	$13, L.86
+L.83:
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sge	$13, $6, $13
+	bnez	$13, L.85
+	subu	$13, $0, $6
+	lw	$12, 13($sp)
+	lw	$12, 115($12)
+	seq	$13, $13, $12
+	bnez	$13, L.86
+L.85:
+	sne	$13, $6, $0
+	bnez	$13, L.87
+	lw	$13, 115($7)
+	lw	$12, 13($sp)
+	lw	$12, 115($12)
+	seq	$13, $13, $12
+	bnez	$13, L.86
+L.87:
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sne	$13, $6, $13
+	bnez	$13, L.79
+L.86:
+	addu	$13, $0, $0
+	sw	$13, 10($sp)
+	lw	$12, 13($sp)
+	lw	$12, 19($12)
+	andi	$12, $12, 16
+	seq	$13, $12, $13
+	bnez	$13, L.88
+	lw	$13, 119($7)
+	andi	$13, $13, 2
+	lw	$12, 10($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.88
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.77
+L.88:
+	lw	$13, 118($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.90
+	lw	$13, 16($7)
+	addu	$13, $0, $13
+	lw	$12, 118($7)
+	addu	$13, $13, $12
+	sw	$13, 11($sp)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	jal	get_wstats
+	addu	$13, $0, $1
+	lw	$12, 11($sp)
+	sw	$13, 0($12)
+L.90:
+	addui	$13, $7, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffb
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	sw	$0, 117($7)
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	lw	$13, 114($13)
+	sw	$13, 1($sp)
+	lw	$13, 133($7)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, 13($sp)
+	lw	$13, 19($13)
+	addu	$13, $0, $13
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.92
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	jal	release_zombie
+L.92:
+	addu	$1, $0, $0
+	j	L.77
+L.78:
+	lw	$13, 19($7)
+	andi	$13, $13, 8
+	seq	$13, $13, $0
+	bnez	$13, L.94
+	addui	$13, $7, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfff7
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	addui	$13, $0, 4
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	lw	$13, 114($13)
+	sw	$13, 1($sp)
+	lw	$13, 133($7)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+L.94:
+L.79:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+L.77:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	exit_proc_in_interrupt
+exit_proc_in_interrupt:
+	subui	$sp, $sp, 17
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	jal	irq_count
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.97
+	j	L.96
+L.97:
+	addui	$13, $0, 2
+	sw	$13, 10($sp)
+	lw	$13, 18($sp)
+	sw	$13, 11($sp)
+	lw	$13, 19($sp)
+	sw	$13, 12($sp)
+	lw	$13, 17($sp)
+	lw	$12, 133($13)
+	sw	$12, 9($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 9
+	sw	$13, 1($sp)
+	addui	$13, $0, 8
+	sw	$13, 2($sp)
+	jal	copyto_user_heap
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 17($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$11, 8($sp)
+	addu	$12, $12, $11
+	sw	$12, 7($sp)
+	sw	$13, 0($sp)
+	jal	zombify
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	do_send
+L.96:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	exit_proc
+exit_proc:
+	subui	$sp, $sp, 15
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	jal	irq_count
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.104
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	lw	$13, 16($sp)
+	sw	$13, 1($sp)
+	lw	$13, 17($sp)
+	sw	$13, 2($sp)
+	jal	exit_proc_in_interrupt
+	j	L.103
+L.104:
+	lw	$13, trace_syscall($0)
+	seq	$13, $13, $0
+	bnez	$13, L.106
+	la	$13, L.108
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	addui	$12, $13, 94
+	sw	$12, 1($sp)
+	lw	$13, 114($13)
+	sw	$13, 2($sp)
+	lw	$13, 16($sp)
+	sw	$13, 3($sp)
+	lw	$13, 17($sp)
+	sw	$13, 4($sp)
+	jal	klog
+L.106:
+	lw	$13, 17($sp)
+	snei	$13, $13, 11
+	bnez	$13, L.109
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	kreport_proc_sigsegv
+L.109:
+	jal	get_ipc_mesg
+	addu	$13, $0, $1
+	sw	$13, 13($sp)
+	lw	$13, 15($sp)
+	lw	$13, 120($13)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	zombify
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	clear_proc_mesg
+	lw	$13, 15($sp)
+	lw	$12, 16($sp)
+	sw	$12, 112($13)
+	lw	$13, 15($sp)
+	lw	$12, 17($sp)
+	sw	$12, 113($13)
+	lw	$13, 15($sp)
+	lw	$13, 121($13)
+	sle	$13, $13, $0
+	bnez	$13, L.111
+	lw	$13, 15($sp)
+	lw	$13, 121($13)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+	lw	$13, 14($sp)
+	sw	$13, 12($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.113
+	lw	$13, 12($sp)
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	lw	$12, 15($sp)
+	lw	$12, 21($12)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.113
+	lw	$13, 12($sp)
+	lw	$13, 122($13)
+	sle	$13, $13, $0
+	bnez	$13, L.113
+	lw	$13, 14($sp)
+	addui	$13, $13, 122
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+L.113:
+L.111:
+	lw	$13, 19($5)
+	andi	$13, $13, 8
+	seq	$13, $13, $0
+	bnez	$13, L.115
+	addui	$13, $5, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfff7
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 13($sp)
+	addui	$12, $0, 4
+	sw	$12, 1($13)
+	addui	$13, $0, 4
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	lw	$13, 114($13)
+	sw	$13, 1($sp)
+	lw	$13, 133($5)
+	sw	$13, 2($sp)
+	lw	$13, 13($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	j	L.116
+L.115:
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	release_proc_mem
+L.116:
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	lw	$13, proc_table($0)
+	addui	$13, $13, 236
+	sw	$13, 1($sp)
+	jal	reparent_children
+	addu	$7, $0, $0
+L.117:
+	lw	$13, 15($sp)
+	addui	$13, $13, 214
+	addu	$13, $7, $13
+	lw	$6, 0($13)
+	addu	$13, $0, $6
+	sequ	$13, $13, $0
+	bnez	$13, L.121
+	sw	$6, 0($sp)
+	jal	filp_close
+	lw	$13, 15($sp)
+	addui	$13, $13, 214
+	addu	$13, $7, $13
+	sw	$0, 0($13)
+L.121:
+L.118:
+	addi	$7, $7, 1
+	slti	$13, $7, 16
+	bnez	$13, L.117
+	lw	$13, 15($sp)
+	lw	$13, 231($13)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$13, 15($sp)
+	lw	$13, 230($13)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	put_inode
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	check_waiting
+	lw	$13, 197($5)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.123
+	sw	$5, 0($sp)
+	addui	$13, $0, 20
+	sw	$13, 1($sp)
+	jal	send_sig
+L.123:
+L.103:
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	do_exit
+do_exit:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	lw	$7, 2($13)
+	lw	$13, 8($sp)
+	lw	$13, 3($13)
+	sw	$13, 6($sp)
+	lhi	$13, 0x1029
+	ori	$13, $13, 0x3847
+	sne	$13, $7, $13
+	bnez	$13, L.126
+	lw	$13, 7($sp)
+	lw	$13, 0($13)
+	addu	$7, $0, $13
+L.126:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	exit_proc
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+L.125:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.108:
+	.asciiz	"%s[%d] exit status %d signal %d\n"
@@ -36,10 +36,8 @@ int copy_stack(struct proc* parent, struct proc* child){
     int i;
     
     new_stack = user_get_free_page(child, GFP_HIGH);
-    if(new_stack == NULL){
-        release_proc_slot(child);
+    if(new_stack == NULL)
         return -ENOMEM;
-    }
     copy_page(new_stack, parent->stack_top);
     child_sp = &child->ctx.m.sp;
     vsp_relative_to_stack_top = (vptr_t*)(get_physical_addr(parent->ctx.m.sp, parent) - parent->stack_top);
@@ -96,10 +94,17 @@ int copy_pcb(struct proc* parent, struct proc* child){
     child->sig_pending = 0;
     // ptable points to its own protection table
     child->ctx.ptable = child->protection_table;
-    child->time_used = child->sys_time_used = 0;
+    child->time_used = child->sys_time_used = child->sched_charged = 0;
 
     INIT_LIST_HEAD(&child->pipe_reading_list);
     INIT_LIST_HEAD(&child->pipe_writing_list);
+    INIT_LIST_HEAD(&child->children);
+    INIT_LIST_HEAD(&child->sibling);
+    INIT_LIST_HEAD(&child->pid_link);
+    INIT_LIST_HEAD(&child->pgrp_link);
+    INIT_LIST_HEAD(&child->notify_q);
+    INIT_LIST_HEAD(&child->notify_link);
+    child->nr_threads = 0;
 
     for (i = 0; i < OPEN_MAX; ++i) {
         file = child->fp_filp[i];
@@ -111,14 +116,31 @@ int copy_pcb(struct proc* parent, struct proc* child){
 }
 
 /**
- * allocate new virtual address space for chlid, and 
- * copy the whole process image from parent to child
+ * is the process image also used by a thread or a vforked child
+ * @param  who 
+ * @return     
+ */
+PRIVATE bool is_image_shared(struct proc* who){
+    struct proc* parent = get_proc(who->parent);
+    if(IS_THREAD(who) || who->nr_threads)
+        return true;
+    // a vforked child runs in the image of its blocked parent
+    return parent && parent->state & STATE_VFORKING && parent->mem_start == who->mem_start;
+}
+
+/**
+ * allocate new virtual address space for chlid. The process image is not
+ * copied here, each page is copied when the parent or the child first
+ * touches it, so a child that calls exec() soon after fork() copies
+ * almost nothing. Images shared by threads are still copied up front, since
+ * other threads may keep using the pages without faulting
  * @param  parent 
  * @param  child  
  * @return        
  */
 int copy_mm(struct proc* parent, struct proc* child){
     ptr_t *src, *dest;
+    int len, page, page_num;
 
     bitmap_clear((unsigned int *)child->ctx.ptable, PTABLE_LEN);
     child->mem_start = dup_vm(parent, child);
@@ -127,13 +149,33 @@ int copy_mm(struct proc* parent, struct proc* child){
     child->text_top = child->mem_start;
     child->ctx.rbase = (reg_t*)(child->mem_start - child->rbase_offset);
 
+    // claimed pages of the reserved heap are copied now, unlike the image
+    // below heap_bottom only the protection table tells them from the
+    // reserved pages that are not claimed yet
+    src = parent->heap_bottom + 1;
+    dest = child->mem_start + (src - parent->mem_start);
+    for(; src < parent->heap_end; src += PAGE_LEN, dest += PAGE_LEN){
+        if(is_bit_on((unsigned int *)parent->ctx.ptable, PTABLE_LEN, PADDR_TO_PAGED(src)))
+            copy_page(dest, src);
+    }
+
     src = (ptr_t *)parent->mem_start;
     dest = (ptr_t *)child->mem_start;
-    while(src < parent->heap_bottom){
-        copy_page(dest, src);
-        src += PAGE_LEN;
-        dest += PAGE_LEN;
+    len = parent->heap_bottom + 1 - parent->mem_start;
+    if(is_image_shared(parent) || defer_copy_pages(dest, src, len)){
+        while(src < parent->heap_bottom){
+            copy_page(dest, src);
+            src += PAGE_LEN;
+            dest += PAGE_LEN;
+        }
+        return 0;
     }
+
+    page_num = PADDR_TO_NUM_PAGES(len);
+    page = PADDR_TO_PAGED(src);
+    bitmap_clear_nbits((unsigned int *)parent->ctx.ptable, PTABLE_LEN, page, page_num);
+    page = PADDR_TO_PAGED(dest);
+    bitmap_clear_nbits((unsigned int *)child->ctx.ptable, PTABLE_LEN, page, page_num);
     return 0;
 }
 
@@ -150,6 +192,7 @@ void copy_pregs(struct proc* parent, struct proc* child){
     child->message = (struct message *)get_physical_addr(get_virtual_addr(parent->message, parent), child);
     child->heap_break = get_physical_addr(get_virtual_addr(parent->heap_break, parent), child);
     child->heap_bottom = get_physical_addr(get_virtual_addr(parent->heap_bottom, parent), child);
+    child->heap_end = get_physical_addr(get_virtual_addr(parent->heap_end, parent), child);
 }
 
 
@@ -174,15 +217,16 @@ int sys_fork(struct proc *parent) {
         }
 
         if((ret = copy_stack(parent, child))){
+            user_release_pages(child, child->mem_start, parent->heap_end + 1 - parent->mem_start);
             release_proc_slot(child);
             return ret;
         }
 
         copy_pregs(parent,child);
 
-        child->time_used = child->sys_time_used = 0;
+        child->time_used = child->sys_time_used = child->sched_charged = 0;
 
-        child->parent = parent->proc_nr;
+        link_proc(child, parent);
         child->thread_parent = 0;
         return child->proc_nr;
     }
@@ -212,7 +256,7 @@ int do_vfork(struct proc* parent, struct message* m){
     struct proc* child;
     if((child = get_free_proc_slot())){
         copy_pcb(parent,child);
-        child->parent = parent->proc_nr;
+        link_proc(child, parent);
         child->thread_parent = 0;
         
         syscall_reply2(VFORK, 0, child->proc_nr, m);
@@ -231,12 +275,12 @@ int do_vfork(struct proc* parent, struct message* m){
  * @return int 
  */
 int do_tfork(struct proc* parent, struct message* m){
-    struct proc* child;
+    struct proc *child, *owner;
     int ret;
     
     if((child = get_free_proc_slot())){
         copy_pcb(parent,child);
-        child->parent = parent->proc_nr;
+        link_proc(child, parent);
         
         if(parent->thread_parent > 0){
             child->thread_parent = parent->thread_parent;
@@ -244,8 +288,12 @@ int do_tfork(struct proc* parent, struct message* m){
             child->thread_parent = parent->proc_nr;
         }
         
-        if ((ret = copy_stack(parent, child)))
+        if ((ret = copy_stack(parent, child))){
+            release_proc_slot(child);
             return ret;
+        }
+        if((owner = get_proc(child->thread_parent)))
+            owner->nr_threads++;
 
         /* reply to parent */
         syscall_reply2(TFORK, child->pid, parent->proc_nr, m);
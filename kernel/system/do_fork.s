@@ -0,0 +1,857 @@
+.global	copy_stack
+.text
+copy_stack:
+	subui	$sp, $sp, 20
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$10, 9($sp)
+	sw	$11, 10($sp)
+	sw	$12, 11($sp)
+	sw	$13, 12($sp)
+	sw	$ra, 13($sp)
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1024
+	sw	$13, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	user_get_free_pages
+	addu	$13, $0, $1
+	addu	$2, $0, $13
+	addu	$13, $0, $2
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.9
+L.10:
+	sw	$2, 0($sp)
+	lw	$13, 20($sp)
+	lw	$13, 22($13)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 21($sp)
+	addui	$12, $13, 13
+	sw	$12, 14($sp)
+	lw	$12, 20($sp)
+	lw	$11, 16($12)
+	addu	$11, $0, $11
+	lw	$10, 13($12)
+	addu	$11, $11, $10
+	addu	$11, $0, $11
+	lw	$12, 22($12)
+	addu	$12, $0, $12
+	subu	$12, $11, $12
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	sw	$12, 15($sp)
+	lw	$12, 15($sp)
+	addu	$12, $0, $12
+	addu	$12, $12, $2
+	sw	$12, 17($sp)
+	lw	$12, 14($sp)
+	lw	$11, 17($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	subu	$13, $11, $13
+	sw	$13, 0($12)
+	lw	$13, 21($sp)
+	sw	$2, 22($13)
+	lw	$13, 21($sp)
+	lw	$6, 22($13)
+	lw	$13, 32($13)
+	addu	$13, $13, $6
+	sw	$13, 19($sp)
+	lw	$13, 20($sp)
+	lw	$12, 22($13)
+	sw	$12, 16($sp)
+	lw	$12, 16($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	subu	$12, $12, $11
+	sw	$12, 18($sp)
+	lw	$12, 18($sp)
+	addu	$12, $0, $12
+	addu	$4, $0, $12
+	lw	$13, 32($13)
+	addu	$3, $12, $13
+	j	L.13
+L.12:
+	lw	$7, 0($6)
+	sltu	$13, $7, $4
+	bnez	$13, L.15
+	sgeu	$13, $7, $3
+	bnez	$13, L.15
+	subu	$13, $7, $4
+	addu	$13, $13, $2
+	lw	$12, 21($sp)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 0($6)
+L.15:
+	addui	$6, $6, 1
+L.13:
+	addu	$13, $0, $6
+	lw	$12, 19($sp)
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.12
+	addu	$5, $0, $0
+L.17:
+	lw	$13, 21($sp)
+	addu	$13, $5, $13
+	lw	$7, 0($13)
+	sltu	$13, $7, $4
+	bnez	$13, L.21
+	sgeu	$13, $7, $3
+	bnez	$13, L.21
+	lw	$13, 21($sp)
+	addu	$12, $5, $13
+	subu	$11, $7, $4
+	addu	$11, $11, $2
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	subu	$13, $11, $13
+	addu	$13, $0, $13
+	sw	$13, 0($12)
+L.21:
+L.18:
+	addi	$5, $5, 1
+	slti	$13, $5, 13
+	bnez	$13, L.17
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	proc_memctl
+	addu	$1, $0, $0
+L.9:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$10, 9($sp)
+	lw	$11, 10($sp)
+	lw	$12, 11($sp)
+	lw	$13, 12($sp)
+	lw	$ra, 13($sp)
+	addui	$sp, $sp, 20
+	jr	$ra
+.global	copy_pcb
+copy_pcb:
+	subui	$sp, $sp, 10
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 11($sp)
+	lw	$12, 133($13)
+	sw	$12, 9($sp)
+	lw	$12, 114($13)
+	sw	$12, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 236
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 11($sp)
+	lw	$12, 9($sp)
+	sw	$12, 133($13)
+	lw	$13, 11($sp)
+	lw	$12, 8($sp)
+	sw	$12, 114($13)
+	lw	$13, 11($sp)
+	sw	$0, 134($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 33
+	sw	$12, 17($13)
+	lw	$13, 11($sp)
+	addu	$12, $0, $0
+	sw	$12, 91($13)
+	sw	$12, 93($13)
+	sw	$12, 92($13)
+L.24:
+	lw	$13, 11($sp)
+	addui	$13, $13, 232
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 232
+	sw	$12, 233($13)
+L.25:
+L.27:
+	lw	$13, 11($sp)
+	addui	$13, $13, 234
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 234
+	sw	$12, 235($13)
+L.28:
+L.30:
+	lw	$13, 11($sp)
+	addui	$13, $13, 123
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 123
+	sw	$12, 124($13)
+L.31:
+L.33:
+	lw	$13, 11($sp)
+	addui	$13, $13, 125
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 125
+	sw	$12, 126($13)
+L.34:
+L.36:
+	lw	$13, 11($sp)
+	addui	$13, $13, 127
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 127
+	sw	$12, 128($13)
+L.37:
+L.39:
+	lw	$13, 11($sp)
+	addui	$13, $13, 129
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 129
+	sw	$12, 130($13)
+L.40:
+L.42:
+	lw	$13, 11($sp)
+	addui	$13, $13, 67
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 67
+	sw	$12, 68($13)
+L.43:
+L.45:
+	lw	$13, 11($sp)
+	addui	$13, $13, 69
+	sw	$13, 0($13)
+	lw	$13, 11($sp)
+	addui	$12, $13, 69
+	sw	$12, 70($13)
+L.46:
+	lw	$13, 11($sp)
+	sw	$0, 122($13)
+	addu	$7, $0, $0
+L.48:
+	lw	$13, 11($sp)
+	addui	$13, $13, 214
+	addu	$13, $7, $13
+	lw	$6, 0($13)
+	addu	$13, $0, $6
+	sequ	$13, $13, $0
+	bnez	$13, L.52
+	addui	$13, $6, 2
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.52:
+L.49:
+	addi	$7, $7, 1
+	slti	$13, $7, 16
+	bnez	$13, L.48
+	addu	$1, $0, $0
+L.23:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+is_image_shared:
+	subui	$sp, $sp, 8
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 120($13)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 8($sp)
+	sw	$13, 7($sp)
+	addu	$12, $0, $0
+	lw	$11, 121($13)
+	sgt	$13, $11, $12
+	bnez	$13, L.57
+	lw	$13, 7($sp)
+	lw	$13, 122($13)
+	seq	$13, $13, $12
+	bnez	$13, L.55
+L.57:
+	addui	$1, $0, 1
+	j	L.54
+L.55:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.59
+	lw	$13, 19($7)
+	andi	$13, $13, 8
+	seq	$13, $13, $0
+	bnez	$13, L.59
+	lw	$13, 21($7)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	lw	$12, 21($12)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.59
+	addui	$6, $0, 1
+	j	L.60
+L.59:
+	addu	$6, $0, $0
+L.60:
+	addu	$1, $0, $6
+L.54:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	copy_mm
+copy_mm:
+	subui	$sp, $sp, 13
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	lw	$13, 14($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	jal	bitmap_clear
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	jal	dup_vm
+	addu	$12, $0, $1
+	sw	$12, 21($13)
+	lw	$13, 14($sp)
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.62
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.61
+L.62:
+	lw	$13, 14($sp)
+	lw	$12, 21($13)
+	sw	$12, 23($13)
+	lw	$13, 14($sp)
+	lw	$12, 21($13)
+	lw	$11, 28($13)
+	subu	$12, $12, $11
+	sw	$12, 16($13)
+	lw	$13, 13($sp)
+	lw	$12, 26($13)
+	addui	$7, $12, 1
+	addu	$12, $0, $7
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$13, $0, $13
+	lw	$12, 14($sp)
+	lw	$12, 21($12)
+	addu	$6, $13, $12
+	j	L.67
+L.64:
+	lw	$13, 13($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	addu	$13, $0, $7
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.68
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	memcpy
+L.68:
+L.65:
+	addui	$13, $0, 1024
+	addu	$7, $7, $13
+	addu	$6, $6, $13
+L.67:
+	addu	$13, $0, $7
+	lw	$12, 13($sp)
+	lw	$12, 27($12)
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.64
+	lw	$13, 13($sp)
+	addui	$12, $13, 21
+	lw	$7, 0($12)
+	lw	$11, 14($sp)
+	lw	$6, 21($11)
+	lw	$13, 26($13)
+	addui	$13, $13, 1
+	addu	$13, $0, $13
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$4, $0, $13
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	jal	is_image_shared
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.72
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$4, 2($sp)
+	jal	defer_copy_pages
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.70
+L.72:
+	j	L.74
+L.73:
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	memcpy
+	addui	$13, $0, 1024
+	addu	$7, $7, $13
+	addu	$6, $6, $13
+L.74:
+	addu	$13, $0, $7
+	lw	$12, 13($sp)
+	lw	$12, 26($12)
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.73
+	addu	$1, $0, $0
+	j	L.61
+L.70:
+	sw	$4, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$3, $0, $13
+	addu	$13, $0, $7
+	srli	$13, $13, 10
+	addu	$5, $0, $13
+	lw	$13, 13($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	sw	$5, 2($sp)
+	sw	$3, 3($sp)
+	jal	bitmap_clear_nbits
+	addu	$13, $0, $6
+	srli	$13, $13, 10
+	addu	$5, $0, $13
+	lw	$13, 14($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	sw	$5, 2($sp)
+	sw	$3, 3($sp)
+	jal	bitmap_clear_nbits
+	addu	$1, $0, $0
+L.61:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	copy_pregs
+copy_pregs:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	lw	$10, 20($12)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	subu	$12, $10, $12
+	addu	$12, $11, $12
+	sw	$12, 20($13)
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	lw	$10, 25($12)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	subu	$12, $10, $12
+	addu	$12, $11, $12
+	sw	$12, 25($13)
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	lw	$10, 26($12)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	subu	$12, $10, $12
+	addu	$12, $11, $12
+	sw	$12, 26($13)
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	lw	$11, 16($13)
+	addu	$11, $0, $11
+	lw	$10, 27($12)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	subu	$12, $10, $12
+	addu	$12, $11, $12
+	sw	$12, 27($13)
+L.76:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	sys_fork
+sys_fork:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	jal	get_free_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.78
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_pcb
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_mm
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.80
+	sw	$7, 0($sp)
+	jal	release_proc_slot
+	lw	$1, 7($sp)
+	j	L.77
+L.80:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_stack
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.82
+	sw	$7, 0($sp)
+	lw	$13, 21($7)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	lw	$12, 27($13)
+	addui	$12, $12, 1
+	addu	$12, $0, $12
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	user_release_pages
+	sw	$7, 0($sp)
+	jal	release_proc_slot
+	lw	$1, 7($sp)
+	j	L.77
+L.82:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_pregs
+	addu	$13, $0, $0
+	sw	$13, 91($7)
+	sw	$13, 93($7)
+	sw	$13, 92($7)
+	sw	$7, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	link_proc
+	sw	$0, 121($7)
+	lw	$1, 133($7)
+	j	L.77
+L.78:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff5
+L.77:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_fork
+do_fork:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	sys_fork
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.85
+	addu	$1, $0, $7
+	j	L.84
+L.85:
+	sw	$7, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	addui	$13, $0, 3
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, 9($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	addui	$13, $0, 3
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	lw	$13, 114($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	lw	$13, 9($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1b
+L.84:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_vfork
+do_vfork:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	jal	get_free_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.88
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_pcb
+	sw	$7, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	link_proc
+	sw	$0, 121($7)
+	addui	$13, $0, 4
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 133($7)
+	sw	$13, 2($sp)
+	lw	$13, 9($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, 8($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 8
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+	j	L.87
+L.88:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff5
+L.87:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_tfork
+do_tfork:
+	subui	$sp, $sp, 10
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	jal	get_free_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.91
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_pcb
+	sw	$7, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	link_proc
+	lw	$13, 10($sp)
+	lw	$13, 121($13)
+	sle	$13, $13, $0
+	bnez	$13, L.93
+	lw	$13, 10($sp)
+	lw	$13, 121($13)
+	sw	$13, 121($7)
+	j	L.94
+L.93:
+	lw	$13, 10($sp)
+	lw	$13, 133($13)
+	sw	$13, 121($7)
+L.94:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_stack
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.95
+	sw	$7, 0($sp)
+	jal	release_proc_slot
+	lw	$1, 8($sp)
+	j	L.90
+L.95:
+	lw	$13, 121($7)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.97
+	lw	$13, 9($sp)
+	addui	$13, $13, 122
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.97:
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	lw	$13, 114($7)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	lw	$13, 11($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 133($7)
+	sw	$13, 2($sp)
+	lw	$13, 11($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1b
+	j	L.90
+L.91:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff5
+L.90:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
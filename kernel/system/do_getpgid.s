@@ -0,0 +1,68 @@
+.global	do_getpgid
+.text
+do_getpgid:
+	subui	$sp, $sp, 5
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 6($sp)
+	lw	$7, 2($13)
+	sge	$13, $7, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.10:
+	sne	$13, $7, $0
+	bnez	$13, L.12
+	lw	$13, 5($sp)
+	lw	$7, 114($13)
+L.12:
+	sw	$7, 0($sp)
+	jal	get_proc_by_pid
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.14
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+	j	L.9
+L.14:
+	lw	$1, 115($6)
+L.9:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
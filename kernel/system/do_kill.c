@@ -16,8 +16,22 @@
 #include <kernel/kernel.h>
 #include <winix/ksignal.h>
 
+PRIVATE void kill_target(struct proc* who, struct proc* to, int signum){
+    /*
+     * if the process to which we are sending 
+     * is blocked, we will need to temporarily unblock it
+     * so that the scheduler will trigger the signal handling
+     */
+    send_sig(to, signum);
+    // kdebug("send sig %d to proc %s[%d]\n", signum, to->name, to->pid);
+    if(to != who && to->state){
+        handle_pendingsig(to, true);
+    }
+}
+
 int sys_kill(struct proc* who, pid_t pid, int signum){
-    struct proc* to;
+    struct proc *to, *next;
+    pid_t pgid;
     int valid_targets = 0;
     if(signum < 0 || signum >= _NSIG)
         return -EINVAL;
@@ -25,27 +39,34 @@ int sys_kill(struct proc* who, pid_t pid, int signum){
     if(pid == 1 && (signum == SIGSTOP || signum == SIGKILL))
         return -EINVAL;
 
-    foreach_proc(to){
-        if(pid < -1 && -pid != to->procgrp) continue;
-        if(pid == 0 && to->procgrp == who->procgrp) continue;
-        if(pid > 0 && pid != to->pid)   continue;
-        if(pid == -1 && to->pid == 1)   continue;
+    if(pid > 0){
+        if(!(to = get_proc_by_pid(pid)))
+            return -ESRCH;
+        if(signum)
+            kill_target(who, to, signum);
+        return 0;
+    }
 
+    if(pid == -1){
+        foreach_proc(to){
+            if(to->pid == 1)   continue;
+            if(signum == 0)
+                return 0;
+            kill_target(who, to, signum);
+            valid_targets++;
+        }
+        return valid_targets ? 0 : -ESRCH;
+    }
+
+    // only the members of the group are visited, a member may exit
+    // while it is signalled
+    pgid = pid == 0 ? who->procgrp : -pid;
+    list_for_each_entry_safe(struct proc, to, next, &pgrp_hash[PID_HASH(pgid)], pgrp_link){
+        if(to->procgrp != pgid) continue;
         if(signum == 0)
             return 0;
-
-        /*
-         * if the process to which we are sending 
-         * is blocked, we will need to temporarily unblock it
-         * so that the scheduler will trigger the signal handling
-         */
-        
-        send_sig(to, signum);
-        // kdebug("send sig %d to proc %s[%d]\n", signum, to->name, to->pid);
-        if(to != who && to->state){
-            handle_pendingsig(to, true);
-        }
-	    valid_targets++;
+        kill_target(who, to, signum);
+        valid_targets++;
     }
 
     if(!valid_targets)
@@ -0,0 +1,283 @@
+.text
+kill_target:
+	subui	$sp, $sp, 7
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	send_sig
+	lw	$13, 8($sp)
+	sw	$13, 6($sp)
+	addu	$12, $0, $13
+	lw	$11, 7($sp)
+	addu	$11, $0, $11
+	sequ	$13, $12, $11
+	bnez	$13, L.10
+	lw	$13, 6($sp)
+	lw	$13, 19($13)
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	handle_pendingsig
+L.10:
+L.9:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	sys_kill
+sys_kill:
+	subui	$sp, $sp, 14
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addu	$4, $0, $0
+	lw	$13, 16($sp)
+	sw	$13, 13($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, 13($sp)
+	slti	$13, $13, 21
+	bnez	$13, L.13
+L.15:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.12
+L.13:
+	lw	$13, 15($sp)
+	snei	$13, $13, 1
+	bnez	$13, L.16
+	lw	$13, 16($sp)
+	sw	$13, 12($sp)
+	seqi	$13, $13, 17
+	bnez	$13, L.18
+	lw	$13, 12($sp)
+	snei	$13, $13, 9
+	bnez	$13, L.16
+L.18:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.12
+L.16:
+	lw	$13, 15($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.19
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	get_proc_by_pid
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.21
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+	j	L.12
+L.21:
+	lw	$13, 16($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.23
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 16($sp)
+	sw	$13, 2($sp)
+	jal	kill_target
+L.23:
+	addu	$1, $0, $0
+	j	L.12
+L.19:
+	lw	$13, 15($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.25
+	lw	$13, proc_table($0)
+	addui	$7, $13, 236
+	j	L.30
+L.27:
+	lw	$13, 131($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.31
+	lw	$13, 114($7)
+	snei	$13, $13, 1
+	bnez	$13, L.33
+	j	L.28
+L.33:
+	lw	$13, 16($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.35
+	addu	$1, $0, $0
+	j	L.12
+L.35:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 16($sp)
+	sw	$13, 2($sp)
+	jal	kill_target
+	addi	$4, $4, 1
+L.31:
+L.28:
+	sw	$7, 0($sp)
+	jal	next_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.30:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.27
+	seq	$13, $4, $0
+	bnez	$13, L.38
+	addu	$3, $0, $0
+	j	L.39
+L.38:
+	lhi	$3, 0xffff
+	ori	$3, $3, 0xfffd
+L.39:
+	addu	$1, $0, $3
+	j	L.12
+L.25:
+	lw	$13, 15($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.41
+	lw	$13, 14($sp)
+	lw	$3, 115($13)
+	j	L.42
+L.41:
+	lw	$13, 15($sp)
+	subu	$3, $0, $13
+L.42:
+	addu	$5, $0, $3
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xff7f
+	andi	$12, $5, 63
+	slli	$12, $12, 1
+	lw	$12, pgrp_hash($12)
+	addu	$7, $12, $13
+	lw	$12, 129($7)
+	addu	$6, $12, $13
+	j	L.46
+L.43:
+	lw	$13, 115($7)
+	seq	$13, $13, $5
+	bnez	$13, L.47
+	j	L.44
+L.47:
+	lw	$13, 16($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.49
+	addu	$1, $0, $0
+	j	L.12
+L.49:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 16($sp)
+	sw	$13, 2($sp)
+	jal	kill_target
+	addi	$4, $4, 1
+L.44:
+	addu	$7, $0, $6
+	lw	$13, 129($6)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xff7f
+	addu	$6, $13, $12
+L.46:
+	addui	$13, $7, 129
+	addu	$13, $0, $13
+	andi	$12, $5, 63
+	slli	$12, $12, 1
+	la	$11, pgrp_hash
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.43
+	sne	$13, $4, $0
+	bnez	$13, L.51
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+	j	L.12
+L.51:
+	addu	$1, $0, $0
+L.12:
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.global	do_kill
+do_kill:
+	subui	$sp, $sp, 7
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 8($sp)
+	lw	$13, 2($13)
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	lw	$13, 3($13)
+	sw	$13, 5($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	sys_kill
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.53:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,34 @@
+/**
+ * Syscall in this file: prctl
+ * Input:   m1_i1: option, m1_i2: argument
+ *
+ * Return:  reply_res: PR_GET_TIMERSLACK returns the timer slack in nanoseconds
+*/
+#include <kernel/kernel.h>
+#include <kernel/clock.h>
+#include <sys/prctl.h>
+
+// a timer does not wait for others for longer than a second
+#define MAX_TIMER_SLACK     TIMER_FREQ
+
+int do_prctl(struct proc* who, struct message* m){
+    clock_t usec;
+
+    switch(m->m1_i1){
+        case PR_SET_TIMERSLACK:
+            // rounded down, so a timer is never later than asked for
+            usec = (unsigned int)m->m1_i2 / 1000;
+            if(usec >= 1000000)
+                who->timer_slack = MAX_TIMER_SLACK;
+            else
+                who->timer_slack = usec * (TIMER_FREQ / 100) / 10000;
+            return 0;
+
+        case PR_GET_TIMERSLACK:
+            usec = who->timer_slack * 10000 / (TIMER_FREQ / 100);
+            return usec * 1000;
+
+        default:
+            return -EINVAL;
+    }
+}
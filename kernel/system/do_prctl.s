@@ -0,0 +1,94 @@
+.global	do_prctl
+.text
+do_prctl:
+	subui	$sp, $sp, 5
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 6($sp)
+	lw	$7, 2($13)
+	seqi	$13, $7, 29
+	bnez	$13, L.13
+	seqi	$13, $7, 30
+	bnez	$13, L.16
+	j	L.10
+L.13:
+	lw	$13, 6($sp)
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	addui	$12, $0, 1000
+	divu	$13, $13, $12
+	sw	$13, 4($sp)
+	lw	$13, 4($sp)
+	lhi	$12, 0xf
+	ori	$12, $12, 0x4240
+	sltu	$13, $13, $12
+	bnez	$13, L.14
+	lw	$13, 5($sp)
+	addui	$12, $0, 2400
+	sw	$12, 211($13)
+	j	L.15
+L.14:
+	lw	$13, 5($sp)
+	addui	$12, $0, 24
+	lw	$11, 4($sp)
+	multu	$12, $12, $11
+	addui	$11, $0, 10000
+	divu	$12, $12, $11
+	sw	$12, 211($13)
+L.15:
+	addu	$1, $0, $0
+	j	L.9
+L.16:
+	addui	$13, $0, 10000
+	lw	$12, 5($sp)
+	lw	$12, 211($12)
+	multu	$13, $13, $12
+	addui	$12, $0, 24
+	divu	$13, $13, $12
+	sw	$13, 4($sp)
+	addui	$13, $0, 1000
+	lw	$12, 4($sp)
+	multu	$13, $13, $12
+	addu	$1, $0, $13
+	j	L.9
+L.10:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.9:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,113 @@
+/**
+ * Syscall in this file: setpriority, getpriority,
+ *                       sched_setscheduler, sched_getscheduler
+ * Input:   setpriority:        m1_i1: which, m1_i2: who, m1_i3: nice value
+ *          getpriority:        m1_i1: which, m1_i2: who
+ *          sched_setscheduler: m1_i1: pid, m1_i2: policy
+ *          sched_getscheduler: m1_i1: pid
+ *
+ * Return:  reply_res: getpriority returns the lowest nice value plus NZERO,
+ *                     sched_getscheduler returns the policy
+*/
+#include <kernel/kernel.h>
+#include <kernel/sched.h>
+#include <sys/resource.h>
+
+/**
+ * whether the process is one of the processes named by which and id,
+ * where id 0 names the caller, its process group or its user
+ * @param  caller 
+ * @param  mp     
+ * @param  which  
+ * @param  id     
+ * @return        
+ */
+PRIVATE bool prio_match(struct proc* caller, struct proc* mp, int which, int id){
+    if(mp->state & STATE_ZOMBIE)
+        return false;
+    switch(which){
+        case PRIO_PROCESS:
+            return mp->pid == (id ? id : caller->pid);
+        case PRIO_PGRP:
+            return mp->procgrp == (id ? id : caller->procgrp);
+        case PRIO_USER:
+            return mp->uid == (id ? id : caller->uid);
+        default:
+            return false;
+    }
+}
+
+int do_setpriority(struct proc* who, struct message* m){
+    int which = m->m1_i1;
+    int id = m->m1_i2;
+    struct proc* mp;
+    bool found = false;
+
+    if(which < PRIO_PROCESS || which > PRIO_USER || id < 0)
+        return -EINVAL;
+
+    foreach_proc(mp){
+        if(prio_match(who, mp, which, id)){
+            set_nice(mp, m->m1_i3);
+            found = true;
+        }
+    }
+    return found ? 0 : -ESRCH;
+}
+
+int do_getpriority(struct proc* who, struct message* m){
+    int which = m->m1_i1;
+    int id = m->m1_i2;
+    int nice = NZERO;
+    struct proc* mp;
+
+    if(which < PRIO_PROCESS || which > PRIO_USER || id < 0)
+        return -EINVAL;
+
+    foreach_proc(mp){
+        if(prio_match(who, mp, which, id) && mp->nice < nice)
+            nice = mp->nice;
+    }
+    // nice values are offset, as negative replies are errors
+    return nice == NZERO ? -ESRCH : nice + NZERO;
+}
+
+PRIVATE struct proc* get_sched_target(struct proc* who, pid_t pid){
+    struct proc* mp;
+    if(pid == 0)
+        return who;
+    mp = get_proc_by_pid(pid);
+    if(!mp || mp->state & STATE_ZOMBIE)
+        return NULL;
+    return mp;
+}
+
+int do_sched_setscheduler(struct proc* who, struct message* m){
+    int policy = m->m1_i2;
+    struct proc* mp;
+    bool queued;
+
+    if(m->m1_i1 < 0 || (policy != SCHED_OTHER && policy != SCHED_STRIDE))
+        return -EINVAL;
+    if(!(mp = get_sched_target(who, m->m1_i1)))
+        return -ESRCH;
+    if(mp->sched_policy == policy)
+        return 0;
+
+    // a process waiting to run moves to the queue of the new class
+    queued = dequeue_schedule(mp) == 0;
+    set_sched_policy(mp, policy);
+    if(queued)
+        enqueue_schedule(mp);
+    return 0;
+}
+
+int do_sched_getscheduler(struct proc* who, struct message* m){
+    struct proc* mp;
+
+    if(m->m1_i1 < 0)
+        return -EINVAL;
+    if(!(mp = get_sched_target(who, m->m1_i1)))
+        return -ESRCH;
+    return mp->sched_policy;
+}
@@ -0,0 +1,452 @@
+.text
+prio_match:
+	subui	$sp, $sp, 9
+	sw	$2, 0($sp)
+	sw	$3, 1($sp)
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	lw	$13, 10($sp)
+	lw	$13, 19($13)
+	addu	$13, $0, $13
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.10
+	addu	$1, $0, $0
+	j	L.9
+L.10:
+	lw	$13, 11($sp)
+	sw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.14
+	lw	$13, 8($sp)
+	seqi	$13, $13, 1
+	bnez	$13, L.21
+	lw	$13, 8($sp)
+	seqi	$13, $13, 2
+	bnez	$13, L.28
+	j	L.12
+L.14:
+	lw	$13, 12($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.19
+	lw	$6, 12($sp)
+	j	L.20
+L.19:
+	lw	$13, 9($sp)
+	lw	$6, 114($13)
+L.20:
+	lw	$13, 10($sp)
+	lw	$13, 114($13)
+	sne	$13, $13, $6
+	bnez	$13, L.17
+	addui	$7, $0, 1
+	j	L.18
+L.17:
+	addu	$7, $0, $0
+L.18:
+	addu	$1, $0, $7
+	j	L.9
+L.21:
+	lw	$13, 12($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.26
+	lw	$4, 12($sp)
+	j	L.27
+L.26:
+	lw	$13, 9($sp)
+	lw	$4, 115($13)
+L.27:
+	lw	$13, 10($sp)
+	lw	$13, 115($13)
+	sne	$13, $13, $4
+	bnez	$13, L.24
+	addui	$5, $0, 1
+	j	L.25
+L.24:
+	addu	$5, $0, $0
+L.25:
+	addu	$1, $0, $5
+	j	L.9
+L.28:
+	lw	$13, 12($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.33
+	lw	$13, 12($sp)
+	addu	$2, $0, $13
+	j	L.34
+L.33:
+	lw	$13, 9($sp)
+	lw	$2, 110($13)
+L.34:
+	lw	$13, 10($sp)
+	lw	$13, 110($13)
+	sneu	$13, $13, $2
+	bnez	$13, L.31
+	addui	$3, $0, 1
+	j	L.32
+L.31:
+	addu	$3, $0, $0
+L.32:
+	addu	$1, $0, $3
+	j	L.9
+L.12:
+	addu	$1, $0, $0
+L.9:
+	lw	$2, 0($sp)
+	lw	$3, 1($sp)
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_setpriority
+do_setpriority:
+	subui	$sp, $sp, 12
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 13($sp)
+	lw	$6, 2($13)
+	lw	$13, 13($sp)
+	lw	$5, 3($13)
+	addu	$4, $0, $0
+	addu	$13, $0, $0
+	sw	$13, 11($sp)
+	slt	$13, $6, $13
+	bnez	$13, L.39
+	sgti	$13, $6, 2
+	bnez	$13, L.39
+	lw	$13, 11($sp)
+	sge	$13, $5, $13
+	bnez	$13, L.36
+L.39:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.35
+L.36:
+	lw	$13, proc_table($0)
+	addui	$7, $13, 236
+	j	L.43
+L.40:
+	lw	$13, 131($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.44
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	sw	$6, 2($sp)
+	sw	$5, 3($sp)
+	jal	prio_match
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.46
+	sw	$7, 0($sp)
+	lw	$13, 13($sp)
+	lw	$13, 4($13)
+	sw	$13, 1($sp)
+	jal	set_nice
+	addui	$4, $0, 1
+L.46:
+L.44:
+L.41:
+	sw	$7, 0($sp)
+	jal	next_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.43:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.40
+	seq	$13, $4, $0
+	bnez	$13, L.49
+	addu	$3, $0, $0
+	j	L.50
+L.49:
+	lhi	$3, 0xffff
+	ori	$3, $3, 0xfffd
+L.50:
+	addu	$1, $0, $3
+L.35:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	do_getpriority
+do_getpriority:
+	subui	$sp, $sp, 12
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 13($sp)
+	lw	$5, 2($13)
+	lw	$13, 13($sp)
+	lw	$4, 3($13)
+	addui	$6, $0, 20
+	addu	$13, $0, $0
+	sw	$13, 11($sp)
+	slt	$13, $5, $13
+	bnez	$13, L.55
+	sgti	$13, $5, 2
+	bnez	$13, L.55
+	lw	$13, 11($sp)
+	sge	$13, $4, $13
+	bnez	$13, L.52
+L.55:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.51
+L.52:
+	lw	$13, proc_table($0)
+	addui	$7, $13, 236
+	j	L.59
+L.56:
+	lw	$13, 131($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.60
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	sw	$5, 2($sp)
+	sw	$4, 3($sp)
+	jal	prio_match
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.62
+	lw	$13, 88($7)
+	sge	$13, $13, $6
+	bnez	$13, L.62
+	lw	$6, 88($7)
+L.62:
+L.60:
+L.57:
+	sw	$7, 0($sp)
+	jal	next_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.59:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.56
+	snei	$13, $6, 20
+	bnez	$13, L.65
+	lhi	$3, 0xffff
+	ori	$3, $3, 0xfffd
+	j	L.66
+L.65:
+	addi	$3, $6, 20
+L.66:
+	addu	$1, $0, $3
+L.51:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+get_sched_target:
+	subui	$sp, $sp, 5
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 6($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.68
+	lw	$1, 5($sp)
+	j	L.67
+L.68:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_proc_by_pid
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.72
+	lw	$13, 19($7)
+	addu	$13, $0, $13
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.70
+L.72:
+	addu	$1, $0, $0
+	j	L.67
+L.70:
+	addu	$1, $0, $7
+L.67:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	do_sched_setscheduler
+do_sched_setscheduler:
+	subui	$sp, $sp, 10
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 11($sp)
+	lw	$7, 3($13)
+	addu	$13, $0, $0
+	sw	$13, 8($sp)
+	lw	$12, 11($sp)
+	lw	$12, 2($12)
+	slt	$13, $12, $13
+	bnez	$13, L.76
+	lw	$13, 8($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.74
+	seqi	$13, $7, 1
+	bnez	$13, L.74
+L.76:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.73
+L.74:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	jal	get_sched_target
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.77
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+	j	L.73
+L.77:
+	lw	$13, 87($6)
+	sne	$13, $13, $7
+	bnez	$13, L.79
+	addu	$1, $0, $0
+	j	L.73
+L.79:
+	sw	$6, 0($sp)
+	jal	dequeue_schedule
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.82
+	addui	$5, $0, 1
+	j	L.83
+L.82:
+	addu	$5, $0, $0
+L.83:
+	sw	$5, 9($sp)
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	jal	set_sched_policy
+	lw	$13, 9($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.84
+	sw	$6, 0($sp)
+	jal	enqueue_schedule
+L.84:
+	addu	$1, $0, $0
+L.73:
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	do_sched_getscheduler
+do_sched_getscheduler:
+	subui	$sp, $sp, 5
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 6($sp)
+	lw	$13, 2($13)
+	sge	$13, $13, $0
+	bnez	$13, L.87
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.86
+L.87:
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	jal	get_sched_target
+	addu	$13, $0, $1
+	sw	$13, 4($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.89
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+	j	L.86
+L.89:
+	lw	$13, 4($sp)
+	lw	$1, 87($13)
+L.86:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -1,9 +1,15 @@
 #include <kernel/kernel.h>
+#include <kernel/sched.h>
 
 int do_sched_yield(struct proc* who, struct message* m){
-    who->priority = who->priority == MIN_PRIORITY ? MIN_PRIORITY : who->priority - 1;
+    if(who->sched_policy == SCHED_STRIDE){
+        // the reply puts the caller first among its pass, requeue it after
+        syscall_reply2(SCHED_YIELD, 0, who->proc_nr, m);
+        yield_stride(who);
+        return DONTREPLY;
+    }
+    age_proc(who);
+    if(who->priority > USER_MIN_PRIORITY)
+        set_user_priority(who, who->priority - 1);
     return 0;
 }
-
-
-
@@ -0,0 +1,74 @@
+.global	do_sched_yield
+.text
+do_sched_yield:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$13, 87($13)
+	snei	$13, $13, 1
+	bnez	$13, L.10
+	addui	$13, $0, 54
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 6($sp)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	lw	$13, 7($sp)
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	yield_stride
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1b
+	j	L.9
+L.10:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	age_proc
+	lw	$13, 6($sp)
+	lw	$13, 81($13)
+	slei	$13, $13, 1
+	bnez	$13, L.12
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 81($13)
+	subi	$13, $13, 1
+	sw	$13, 1($sp)
+	jal	set_user_priority
+L.12:
+	addu	$1, $0, $0
+L.9:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
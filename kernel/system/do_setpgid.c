@@ -20,7 +20,7 @@ int do_setpgid(struct proc* who, struct message* m){
     if(pgid == 0)
         pgid = mp->pid;
 
-    mp->procgrp = pgid;
+    set_proc_pgrp(mp, pgid);
     return 0;
 }
 
@@ -0,0 +1,86 @@
+.global	do_setpgid
+.text
+do_setpgid:
+	subui	$sp, $sp, 8
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	lw	$6, 2($13)
+	lw	$13, 9($sp)
+	lw	$7, 3($13)
+	addu	$13, $0, $0
+	sw	$13, 7($sp)
+	slt	$13, $6, $13
+	bnez	$13, L.12
+	lw	$13, 7($sp)
+	sge	$13, $7, $13
+	bnez	$13, L.10
+L.12:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.10:
+	sne	$13, $6, $0
+	bnez	$13, L.13
+	lw	$5, 8($sp)
+	j	L.14
+L.13:
+	sw	$6, 0($sp)
+	jal	get_proc_by_pid
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+L.14:
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.15
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+	j	L.9
+L.15:
+	sne	$13, $7, $0
+	bnez	$13, L.17
+	lw	$7, 114($5)
+L.17:
+	sw	$5, 0($sp)
+	sw	$7, 1($sp)
+	jal	set_proc_pgrp
+	addu	$1, $0, $0
+L.9:
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -6,7 +6,7 @@ int do_setsid(struct proc* who, struct message* m){
         return -EPERM;
     }
     who->session_id = pid;
-    who->procgrp = pid;
+    set_proc_pgrp(who, pid);
     return pid;
 }
 
@@ -0,0 +1,58 @@
+.global	do_setsid
+.text
+do_setsid:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$7, 114($13)
+	lw	$13, 5($sp)
+	lw	$13, 115($13)
+	sne	$13, $13, $7
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.9
+L.10:
+	lw	$13, 5($sp)
+	sw	$7, 116($13)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	set_proc_pgrp
+	addu	$1, $0, $7
+L.9:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
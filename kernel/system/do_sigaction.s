@@ -0,0 +1,238 @@
+.global	sys_sigaction
+.text
+sys_sigaction:
+	subui	$sp, $sp, 8
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 9($sp)
+	sw	$13, 7($sp)
+	slti	$13, $13, 1
+	bnez	$13, L.12
+	lw	$13, 7($sp)
+	slti	$13, $13, 21
+	bnez	$13, L.10
+L.12:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.10:
+	lw	$13, 9($sp)
+	sw	$13, 6($sp)
+	seqi	$13, $13, 9
+	bnez	$13, L.15
+	lw	$13, 6($sp)
+	snei	$13, $13, 17
+	bnez	$13, L.13
+L.15:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.13:
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	addui	$12, $0, 1
+	sneu	$13, $13, $12
+	bnez	$13, L.16
+	lw	$13, 9($sp)
+	snei	$13, $13, 11
+	bnez	$13, L.18
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.18:
+	lw	$13, 8($sp)
+	addui	$13, $13, 134
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	sigdelset
+L.16:
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	lw	$12, 9($sp)
+	mult	$13, $13, $12
+	lw	$12, 8($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	sw	$13, 1($sp)
+	addui	$13, $0, 3
+	sw	$13, 2($sp)
+	jal	memcpy
+L.20:
+	lw	$13, 10($sp)
+	addui	$13, $13, 1
+	sw	$13, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	jal	sigdelset
+	lw	$13, 10($sp)
+	addui	$13, $13, 1
+	sw	$13, 0($sp)
+	addui	$13, $0, 17
+	sw	$13, 1($sp)
+	jal	sigdelset
+	addui	$13, $0, 3
+	lw	$12, 9($sp)
+	mult	$13, $13, $12
+	lw	$12, 8($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 3
+	sw	$13, 2($sp)
+	jal	memcpy
+	addu	$1, $0, $0
+L.9:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_sigaction
+do_sigaction:
+	subui	$sp, $sp, 9
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	lw	$13, 2($13)
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	lw	$6, 5($13)
+	lw	$13, 10($sp)
+	lw	$7, 6($13)
+	sw	$6, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.23
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.22
+L.23:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.25
+	sw	$7, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.25
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.22
+L.25:
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$6, $13, $6
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.27
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$7, $13, $7
+L.27:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	jal	sys_sigaction
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.22:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	do_signal
+do_signal:
+	subui	$sp, $sp, 13
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 14($sp)
+	lw	$13, 2($13)
+	sw	$13, 6($sp)
+	lw	$13, 14($sp)
+	lw	$13, 5($13)
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	sw	$13, 10($sp)
+	addui	$13, $0, 2
+	sw	$13, 12($sp)
+	addui	$13, $0, 0xffff
+	sw	$13, 11($sp)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	addui	$13, $sp, 7
+	sw	$13, 3($sp)
+	jal	sys_sigaction
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.32
+	addui	$1, $0, 65535
+	j	L.29
+L.32:
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	addu	$1, $0, $13
+L.29:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
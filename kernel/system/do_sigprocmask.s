@@ -0,0 +1,157 @@
+.global	do_sigprocmask
+.text
+do_sigprocmask:
+	subui	$sp, $sp, 14
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 15($sp)
+	lw	$13, 2($13)
+	sw	$13, 13($sp)
+	lw	$13, 15($sp)
+	lw	$5, 5($13)
+	addu	$13, $0, $5
+	sequ	$13, $13, $0
+	bnez	$13, L.10
+	sw	$5, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 14($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.9
+L.10:
+	addu	$13, $0, $5
+	sequ	$13, $13, $0
+	bnez	$13, L.12
+	lw	$13, 14($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	addu	$12, $12, $5
+	sw	$12, 10($sp)
+	lw	$12, 10($sp)
+	lw	$13, 135($13)
+	addu	$13, $0, $13
+	sw	$13, 0($12)
+L.12:
+	lw	$13, 15($sp)
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	sw	$13, 12($sp)
+	addui	$6, $sp, 12
+	lw	$13, 14($sp)
+	addui	$13, $13, 135
+	sw	$13, 11($sp)
+	sw	$6, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	jal	sigdelset
+	sw	$6, 0($sp)
+	addui	$13, $0, 17
+	sw	$13, 1($sp)
+	jal	sigdelset
+	lw	$13, 13($sp)
+	sw	$13, 9($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.17
+	lw	$13, 9($sp)
+	seqi	$13, $13, 1
+	bnez	$13, L.24
+	lw	$13, 9($sp)
+	seqi	$13, $13, 2
+	bnez	$13, L.16
+	j	L.14
+L.16:
+	lw	$13, 14($sp)
+	lw	$12, 12($sp)
+	sw	$12, 135($13)
+	j	L.15
+L.17:
+	addui	$7, $0, 1
+L.18:
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	jal	sigismember
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.22
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	sigaddset
+L.22:
+L.19:
+	addi	$7, $7, 1
+	slti	$13, $7, 21
+	bnez	$13, L.18
+	j	L.15
+L.24:
+	addui	$7, $0, 1
+L.25:
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	jal	sigismember
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.29
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	sigdelset
+L.29:
+L.26:
+	addi	$7, $7, 1
+	slti	$13, $7, 21
+	bnez	$13, L.25
+	j	L.15
+L.14:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.15:
+	addu	$1, $0, $0
+L.9:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
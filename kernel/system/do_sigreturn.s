@@ -0,0 +1,105 @@
+.global	do_sigreturn
+.text
+do_sigreturn:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	lw	$13, 2($13)
+	sw	$13, 8($sp)
+	lw	$13, 9($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$11, 13($13)
+	addu	$7, $12, $11
+	addui	$12, $0, 3
+	addu	$7, $7, $12
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $0, 21
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 9($sp)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfff7
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	lw	$12, 136($13)
+	sw	$12, 135($13)
+	lw	$13, 8($sp)
+	snei	$13, $13, 6
+	bnez	$13, L.10
+	lw	$13, 9($sp)
+	sw	$0, 155($13)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	jal	send_sig
+	j	L.12
+L.10:
+	lw	$13, 9($sp)
+	lw	$13, 19($13)
+	sne	$13, $13, $0
+	bnez	$13, L.13
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	enqueue_schedule
+L.13:
+L.12:
+	lw	$13, 9($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, 9($sp)
+	addui	$12, $0, 2
+	sw	$12, 19($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffc
+	j	L.9
+L.15:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1b
+L.9:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,78 @@
+.global	do_sigsuspend
+.text
+do_sigsuspend:
+	subui	$sp, $sp, 6
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sw	$13, 5($sp)
+	addui	$13, $sp, 5
+	sw	$13, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	jal	sigdelset
+	addui	$13, $sp, 5
+	sw	$13, 0($sp)
+	addui	$13, $0, 17
+	sw	$13, 1($sp)
+	jal	sigdelset
+	lw	$13, 6($sp)
+	lw	$12, 135($13)
+	sw	$12, 136($13)
+	lw	$13, 6($sp)
+	lw	$12, 5($sp)
+	sw	$12, 135($13)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	is_sigpending
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffc
+	j	L.9
+L.10:
+	lw	$13, 6($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 4
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+L.9:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,194 @@
+/**
+ * Syscall in this file: spawn
+ * Input:   m1_p1: struct spawn_request, see <sys/spawn.h>
+ *
+ * Return:  reply_res: pid of the child
+*/
+#include <kernel/kernel.h>
+#include <kernel/table.h>
+#include <winix/mm.h>
+#include <winix/bitmap.h>
+#include <winix/dev.h>
+#include <fs/fs_methods.h>
+#include <fs/path.h>
+#include <sys/spawn.h>
+#include <limits.h>
+
+/**
+ * physical address of the string array argv or envp of the caller
+ * @param  who
+ * @param  array
+ * @param  result
+ * @return
+ */
+PRIVATE int get_spawn_array(struct proc* who, char *const *array, char*** result){
+    *result = NULL;
+    if(!array)
+        return 0;
+    if(resolve_user_pages(who, (vptr_t *)array, PAGE_LEN) || !is_vaddr_accessible(array, who))
+        return -EFAULT;
+    *result = (char **)get_physical_addr(array, who);
+    return 0;
+}
+
+PRIVATE int spawn_open(struct proc* parent, struct proc* child, struct spawn_action* action){
+    char* path;
+    int fd, ret;
+
+    if(resolve_user_pages(parent, (vptr_t *)action->path, PAGE_LEN) || !is_vaddr_accessible(action->path, parent))
+        return -EFAULT;
+    path = (char *)get_physical_addr(action->path, parent);
+    fd = sys_open(child, path, action->flags, action->mode);
+    if(fd < 0 || fd == action->fd)
+        return fd < 0 ? fd : 0;
+    ret = sys_dup2(child, fd, action->fd);
+    sys_close(child, fd);
+    return ret < 0 ? ret : 0;
+}
+
+/**
+ * apply the file actions to the child in order
+ * @param  parent
+ * @param  child
+ * @param  file_actions
+ * @return
+ */
+PRIVATE int spawn_file_actions(struct proc* parent, struct proc* child, posix_spawn_file_actions_t* file_actions){
+    struct spawn_action* action;
+    int i, ret = 0;
+
+    if(file_actions->nr_actions < 0 || file_actions->nr_actions > SPAWN_ACTIONS_MAX)
+        return -EINVAL;
+    for(i = 0; i < file_actions->nr_actions && ret >= 0; i++){
+        action = &file_actions->actions[i];
+        switch(action->type){
+            case SPAWN_OPEN:
+                ret = spawn_open(parent, child, action);
+                break;
+            case SPAWN_CLOSE:
+                // closing a descriptor that is not open is not an error
+                ret = sys_close(child, action->fd);
+                if(ret == -EBADF && action->fd >= 0 && action->fd < OPEN_MAX)
+                    ret = 0;
+                break;
+            case SPAWN_DUP2:
+                ret = sys_dup2(child, action->fd, action->newfd);
+                break;
+            default:
+                ret = -EINVAL;
+                break;
+        }
+    }
+    return ret < 0 ? ret : 0;
+}
+
+/**
+ * apply the attributes of the spawn to the child
+ * @param  child
+ * @param  attr
+ * @param  tty      set to the tty whose foreground group was changed
+ * @param  tty_pgrp set to the foreground group it had before
+ * @return
+ */
+PRIVATE int spawn_attr(struct proc* child, posix_spawnattr_t* attr, struct device** tty, pid_t* tty_pgrp){
+    int i, ret;
+    struct filp* file;
+
+    if(attr->flags & POSIX_SPAWN_SETPGROUP)
+        set_proc_pgrp(child, attr->pgroup ? attr->pgroup : child->pid);
+
+    if(attr->flags & POSIX_SPAWN_TCSETPGROUP){
+        if(!is_fd_opened_and_valid(child, attr->tty_fd))
+            return -EBADF;
+        file = child->fp_filp[attr->tty_fd];
+        if((ret = tty_set_foreground(file, child, child->procgrp, tty_pgrp)))
+            return ret;
+        *tty = file->filp_dev;
+    }
+
+    if(attr->flags & POSIX_SPAWN_SETSIGMASK)
+        child->sig_mask = attr->sigmask;
+
+    for(i = 1; i < _NSIG; i++){
+        // handlers of the caller do not exist in the new image
+        if(child->sig_table[i].sa_handler != SIG_IGN)
+            child->sig_table[i].sa_handler = SIG_DFL;
+        if(attr->flags & POSIX_SPAWN_SETSIGDEF && sigismember(&attr->sigdefault, i))
+            child->sig_table[i].sa_handler = SIG_DFL;
+    }
+    return 0;
+}
+
+PRIVATE void release_spawned(struct proc* child){
+    struct filp* file;
+    int i;
+
+    for(i = 0; i < OPEN_MAX; i++){
+        file = child->fp_filp[i];
+        if(file){
+            filp_close(file);
+            child->fp_filp[i] = NULL;
+        }
+    }
+    if(child->mem_start)
+        release_proc_mem(child);
+    release_proc_slot(child);
+}
+
+/**
+ * Create a child running the binary at path. Unlike fork() and execve(),
+ * the image of the caller is never duplicated, the child only inherits
+ * the process attributes and the open files, and loads its own image
+ * @param  parent
+ * @param  m
+ * @return        pid of the child
+ */
+int do_spawn(struct proc* parent, struct message* m){
+    struct spawn_request req;
+    struct proc* child;
+    char buffer[PATH_MAX];
+    char **argv, **envp;
+    struct device* tty = NULL;
+    pid_t tty_pgrp = 0;
+    int ret;
+
+    if((ret = copy_from_user(parent, &req, m->m1_p1, sizeof(req))) < 0)
+        return ret;
+    if((ret = get_spawn_array(parent, req.argv, &argv)))
+        return ret;
+    if((ret = get_spawn_array(parent, req.envp, &envp)))
+        return ret;
+    if((ret = copy_from_user(parent, (ptr_t *)buffer, (vptr_t *)req.path, PATH_MAX)) < 0)
+        return ret;
+
+    child = get_free_proc_slot();
+    if(!child)
+        return -EAGAIN;
+    copy_pcb(parent, child);
+    link_proc(child, parent);
+    child->thread_parent = 0;
+    memset(&child->timer, 0, sizeof(child->timer));
+    child->timer.proc_nr = child->proc_nr;
+    child->timer_interval = 0;
+
+    // nothing of the caller's memory is shared or copied
+    child->mem_start = child->text_top = child->stack_top = NULL;
+    child->heap_top = child->heap_break = child->heap_bottom = child->heap_end = NULL;
+    bitmap_clear((unsigned int *)child->ctx.ptable, PTABLE_LEN);
+
+    if((ret = spawn_attr(child, &req.attr, &tty, &tty_pgrp)))
+        goto err;
+    if((ret = spawn_file_actions(parent, child, &req.actions)))
+        goto err;
+
+    ret = exec_welf(child, buffer, argv, envp, parent);
+    if(ret == DONTREPLY)
+        return child->pid;
+
+err:
+    // the tty must not be left to a group nothing runs in
+    if(tty)
+        tty_restore_foreground(tty, tty_pgrp);
+    release_spawned(child);
+    return ret;
+}
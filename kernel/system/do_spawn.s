@@ -0,0 +1,673 @@
+.text
+get_spawn_array:
+	subui	$sp, $sp, 7
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	sw	$0, 0($13)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.12
+	addu	$1, $0, $0
+	j	L.11
+L.12:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.16
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.14
+L.16:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.11
+L.14:
+	lw	$13, 9($sp)
+	lw	$12, 7($sp)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	lw	$11, 8($sp)
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.11:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+spawn_open:
+	subui	$sp, $sp, 13
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	lw	$13, 3($13)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, 15($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.18
+L.20:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.17
+L.18:
+	lw	$13, 15($sp)
+	lw	$12, 13($sp)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	lw	$11, 3($13)
+	addu	$12, $12, $11
+	sw	$12, 12($sp)
+	lw	$12, 14($sp)
+	sw	$12, 0($sp)
+	lw	$12, 12($sp)
+	sw	$12, 1($sp)
+	lw	$12, 4($13)
+	sw	$12, 2($sp)
+	lw	$13, 5($13)
+	sw	$13, 3($sp)
+	jal	sys_open
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	slt	$13, $7, $0
+	bnez	$13, L.23
+	lw	$13, 15($sp)
+	lw	$13, 1($13)
+	sne	$13, $7, $13
+	bnez	$13, L.21
+L.23:
+	sge	$13, $7, $0
+	bnez	$13, L.25
+	addu	$5, $0, $7
+	j	L.26
+L.25:
+	addu	$5, $0, $0
+L.26:
+	addu	$1, $0, $5
+	j	L.17
+L.21:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 15($sp)
+	lw	$13, 1($13)
+	sw	$13, 2($sp)
+	jal	sys_dup2
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	sys_close
+	sge	$13, $6, $0
+	bnez	$13, L.28
+	addu	$4, $0, $6
+	j	L.29
+L.28:
+	addu	$4, $0, $0
+L.29:
+	addu	$1, $0, $4
+L.17:
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+spawn_file_actions:
+	subui	$sp, $sp, 12
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addu	$5, $0, $0
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	sw	$13, 11($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.33
+	lw	$13, 11($sp)
+	slei	$13, $13, 8
+	bnez	$13, L.31
+L.33:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.30
+L.31:
+	addu	$7, $0, $0
+	j	L.37
+L.34:
+	addui	$13, $0, 6
+	mult	$13, $13, $7
+	lw	$12, 14($sp)
+	addui	$12, $12, 1
+	addu	$6, $13, $12
+	lw	$4, 0($6)
+	seqi	$13, $4, 1
+	bnez	$13, L.41
+	seqi	$13, $4, 2
+	bnez	$13, L.42
+	seqi	$13, $4, 3
+	bnez	$13, L.45
+	j	L.38
+L.41:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	spawn_open
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	j	L.39
+L.42:
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 1($6)
+	sw	$13, 1($sp)
+	jal	sys_close
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfff7
+	sne	$13, $5, $13
+	bnez	$13, L.39
+	lw	$13, 1($6)
+	sw	$13, 10($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.39
+	lw	$13, 10($sp)
+	sgei	$13, $13, 16
+	bnez	$13, L.39
+	addu	$5, $0, $0
+	j	L.39
+L.45:
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 1($6)
+	sw	$13, 1($sp)
+	lw	$13, 2($6)
+	sw	$13, 2($sp)
+	jal	sys_dup2
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	j	L.39
+L.38:
+	lhi	$5, 0xffff
+	ori	$5, $5, 0xffea
+L.39:
+L.35:
+	addi	$7, $7, 1
+L.37:
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	sge	$13, $7, $13
+	bnez	$13, L.46
+	sge	$13, $5, $0
+	bnez	$13, L.34
+L.46:
+	sge	$13, $5, $0
+	bnez	$13, L.48
+	addu	$4, $0, $5
+	j	L.49
+L.48:
+	addu	$4, $0, $0
+L.49:
+	addu	$1, $0, $4
+L.30:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+spawn_attr:
+	subui	$sp, $sp, 13
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.51
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	lw	$13, 1($13)
+	seq	$13, $13, $0
+	bnez	$13, L.54
+	lw	$13, 14($sp)
+	lw	$6, 1($13)
+	j	L.55
+L.54:
+	lw	$13, 13($sp)
+	lw	$6, 114($13)
+L.55:
+	sw	$6, 1($sp)
+	jal	set_proc_pgrp
+L.51:
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	andi	$13, $13, 8
+	seq	$13, $13, $0
+	bnez	$13, L.56
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	lw	$13, 4($13)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.58
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff7
+	j	L.50
+L.58:
+	lw	$13, 13($sp)
+	lw	$12, 14($sp)
+	lw	$12, 4($12)
+	addui	$11, $13, 214
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	sw	$12, 12($sp)
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 115($13)
+	sw	$13, 2($sp)
+	lw	$13, 16($sp)
+	sw	$13, 3($sp)
+	jal	tty_set_foreground
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.60
+	lw	$1, 11($sp)
+	j	L.50
+L.60:
+	lw	$13, 15($sp)
+	lw	$12, 12($sp)
+	lw	$12, 5($12)
+	sw	$12, 0($13)
+L.56:
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	andi	$13, $13, 4
+	seq	$13, $13, $0
+	bnez	$13, L.62
+	lw	$13, 13($sp)
+	lw	$12, 14($sp)
+	lw	$12, 3($12)
+	sw	$12, 135($13)
+L.62:
+	addui	$7, $0, 1
+L.64:
+	addui	$13, $0, 3
+	mult	$13, $13, $7
+	lw	$12, 13($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	addui	$12, $0, 1
+	sequ	$13, $13, $12
+	bnez	$13, L.68
+	addui	$13, $0, 3
+	mult	$13, $13, $7
+	lw	$12, 13($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	sw	$0, 0($13)
+L.68:
+	lw	$13, 14($sp)
+	sw	$13, 10($sp)
+	lw	$12, 0($13)
+	andi	$12, $12, 2
+	seq	$13, $12, $0
+	bnez	$13, L.70
+	lw	$13, 10($sp)
+	addui	$13, $13, 2
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	sigismember
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.70
+	addui	$13, $0, 3
+	mult	$13, $13, $7
+	lw	$12, 13($sp)
+	addui	$12, $12, 137
+	addu	$13, $13, $12
+	sw	$0, 0($13)
+L.70:
+L.65:
+	addi	$7, $7, 1
+	slti	$13, $7, 21
+	bnez	$13, L.64
+	addu	$1, $0, $0
+L.50:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+release_spawned:
+	subui	$sp, $sp, 5
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addu	$7, $0, $0
+L.73:
+	lw	$13, 5($sp)
+	addui	$13, $13, 214
+	addu	$13, $7, $13
+	lw	$6, 0($13)
+	addu	$13, $0, $6
+	sequ	$13, $13, $0
+	bnez	$13, L.77
+	sw	$6, 0($sp)
+	jal	filp_close
+	lw	$13, 5($sp)
+	addui	$13, $13, 214
+	addu	$13, $7, $13
+	sw	$0, 0($13)
+L.77:
+L.74:
+	addi	$7, $7, 1
+	slti	$13, $7, 16
+	bnez	$13, L.73
+	lw	$13, 5($sp)
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.79
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	release_proc_mem
+L.79:
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	release_proc_slot
+L.72:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	do_spawn
+do_spawn:
+	subui	$sp, $sp, 198
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, 140($sp)
+	sw	$0, 139($sp)
+	lw	$13, 198($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 141
+	sw	$13, 1($sp)
+	lw	$13, 199($sp)
+	lw	$13, 5($13)
+	sw	$13, 2($sp)
+	addui	$13, $0, 57
+	sw	$13, 3($sp)
+	jal	copy_from_user
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.82
+	addu	$1, $0, $6
+	j	L.81
+L.82:
+	lw	$13, 198($sp)
+	sw	$13, 0($sp)
+	lw	$13, 142($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	jal	get_spawn_array
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.84
+	addu	$1, $0, $6
+	j	L.81
+L.84:
+	lw	$13, 198($sp)
+	sw	$13, 0($sp)
+	lw	$13, 143($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	jal	get_spawn_array
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.87
+	addu	$1, $0, $6
+	j	L.81
+L.87:
+	lw	$13, 198($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	lw	$13, 141($sp)
+	sw	$13, 2($sp)
+	addui	$13, $0, 128
+	sw	$13, 3($sp)
+	jal	copy_from_user
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.90
+	addu	$1, $0, $6
+	j	L.81
+L.90:
+	jal	get_free_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.92
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff5
+	j	L.81
+L.92:
+	lw	$13, 198($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	copy_pcb
+	sw	$7, 0($sp)
+	lw	$13, 198($sp)
+	sw	$13, 1($sp)
+	jal	link_proc
+	sw	$0, 121($7)
+	addui	$13, $7, 200
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 133($7)
+	sw	$13, 200($7)
+	sw	$0, 210($7)
+	addu	$13, $0, $0
+	sw	$13, 22($7)
+	sw	$13, 23($7)
+	sw	$13, 21($7)
+	addu	$13, $0, $0
+	sw	$13, 27($7)
+	sw	$13, 26($7)
+	sw	$13, 25($7)
+	sw	$13, 24($7)
+	lw	$13, 17($7)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	jal	bitmap_clear
+	sw	$7, 0($sp)
+	addui	$13, $sp, 193
+	sw	$13, 1($sp)
+	addui	$13, $sp, 140
+	sw	$13, 2($sp)
+	addui	$13, $sp, 139
+	sw	$13, 3($sp)
+	jal	spawn_attr
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.94
+	j	L.97
+L.94:
+	lw	$13, 198($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $sp, 144
+	sw	$13, 2($sp)
+	jal	spawn_file_actions
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.98
+	j	L.97
+L.98:
+	sw	$7, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	lw	$13, 9($sp)
+	sw	$13, 3($sp)
+	lw	$13, 198($sp)
+	sw	$13, 4($sp)
+	jal	exec_welf
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xfc1b
+	sne	$13, $6, $13
+	bnez	$13, L.101
+	lw	$1, 114($7)
+	j	L.81
+L.101:
+L.97:
+	lw	$13, 140($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.103
+	lw	$13, 140($sp)
+	sw	$13, 0($sp)
+	lw	$13, 139($sp)
+	sw	$13, 1($sp)
+	jal	tty_restore_foreground
+L.103:
+	sw	$7, 0($sp)
+	jal	release_spawned
+	addu	$1, $0, $6
+L.81:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 198
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
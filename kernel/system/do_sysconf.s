@@ -0,0 +1,50 @@
+.global	do_sysconf
+.text
+do_sysconf:
+	subui	$sp, $sp, 2
+	sw	$7, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	lw	$7, 2($13)
+	seqi	$13, $7, 3
+	bnez	$13, L.13
+	j	L.10
+L.13:
+	addui	$1, $0, 60
+	j	L.9
+L.10:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.9:
+	lw	$7, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -17,70 +17,96 @@
 #include <sys/time.h>
 #include <time.h>
 
+/**
+ * timer counts until a timer is due, leaving out its slack, negative
+ * once it is overdue
+ * @param timer 
+ * @return 
+ */
+PRIVATE int timer_left(struct timer* timer){
+    if(timer->flags & TIMER_HIRES)
+        return get_hrtime_until(timer->hr_tick, timer->hr_offset);
+    return get_hrtime_until(timer->time_out, 0);
+}
+
 void deliver_alarm(int proc_nr, clock_t time){
     struct proc* who = get_non_zombie_proc(proc_nr);
+    int left;
+
     if(who){
         send_sig(who, SIGALRM);
         if(who->state){
             handle_pendingsig(who, true);
         }
         if(who->state == STATE_RUNNABLE && who->timer_interval){
-            new_timer(proc_nr, &who->timer, who->timer_interval, deliver_alarm);
+            // from when the timer was due, so that the interval does not drift
+            left = timer_left(&who->timer) + (int)who->timer_interval;
+            new_hrtimer(proc_nr, &who->timer, left > 0 ? left : 1,
+                            who->timer_slack, deliver_alarm);
         }
     }
 }
 
-clock_t convert_timeval_to_hz(const struct timeval *tv){
-    clock_t hz, micro_hz;
-    hz = tv->tv_sec * HZ;
-    micro_hz = tv->tv_usec / (1000000 / HZ);
-    if (tv->tv_usec && micro_hz == 0)
-        micro_hz = 1;
-    return hz + micro_hz;
+/**
+ * microseconds to timer counts, rounded up so that a timer never
+ * goes off early
+ */
+PRIVATE clock_t convert_usec_to_counts(clock_t usec){
+    return (usec * (TIMER_FREQ / 100) + 9999) / 10000;
+}
+
+// timer counts do not overflow for timers of up to about 10 days
+#define MAX_TIMER_SEC       (0x7fffffff / TIMER_FREQ - 1)
+
+clock_t convert_timeval_to_counts(const struct timeval *tv){
+    if(tv->tv_sec >= MAX_TIMER_SEC)
+        return MAX_TIMER_SEC * TIMER_FREQ;
+    return tv->tv_sec * TIMER_FREQ + convert_usec_to_counts(tv->tv_usec);
+}
+
+clock_t convert_timespec_to_counts(const struct timespec *tv){
+    if(tv->tv_sec >= MAX_TIMER_SEC)
+        return MAX_TIMER_SEC * TIMER_FREQ;
+    return tv->tv_sec * TIMER_FREQ + convert_usec_to_counts((tv->tv_nsec + 999) / 1000);
 }
 
-clock_t convert_timespec_to_hz(const struct timespec *tv){
-    clock_t hz, nano_hz;
-    hz = tv->tv_sec * HZ;
-    nano_hz = tv->tv_nsec / (1000000000 / HZ);
-    if (tv->tv_nsec && nano_hz == 0)
-        nano_hz = 1;
-    return hz + nano_hz;
+void convert_counts_to_timeval(clock_t counts, struct timeval *tv){
+    tv->tv_sec = counts / TIMER_FREQ;
+    tv->tv_usec = (counts % TIMER_FREQ) * 10000 / (TIMER_FREQ / 100);
 }
 
 
 int sys_setitimer(struct proc* who, int which, const struct itimerval* new_value, struct itimerval* old_value){
     struct timer *timer;
-    clock_t prev_timeout;
+    clock_t prev_timeout = 0, prev_interval;
     clock_t new_timeout, interval;
-    int microseconds = (1000 * 1000);
-    int micro_seconds_period = microseconds / HZ;
+    int left;
 
     if (which != ITIMER_REAL)
         return -EINVAL;
 
     timer = &who->timer;
-    prev_timeout = timer->time_out; 
+    prev_interval = who->timer_interval;
     who->timer_interval = 0;
 
     if(timer->flags & TIMER_INUSE){
+        left = timer_left(timer);
+        if(left > 0)
+            prev_timeout = left;
         remove_timer(timer);
     }
 
-    new_timeout = convert_timeval_to_hz(&new_value->it_value);
-    interval = convert_timeval_to_hz(&new_value->it_interval);
+    new_timeout = convert_timeval_to_counts(&new_value->it_value);
+    interval = convert_timeval_to_counts(&new_value->it_interval);
     who->timer_interval = interval;
 
     if(new_timeout > 0){
-        new_timer(who->proc_nr, timer, new_timeout, deliver_alarm);
+        new_hrtimer(who->proc_nr, timer, new_timeout, who->timer_slack, deliver_alarm);
     }
 
     if (old_value){
-        int seconds = prev_timeout / HZ;
-        int remainder = prev_timeout % HZ;
-        int microseconds = remainder * micro_seconds_period;
-        old_value->it_value.tv_sec = seconds;
-        old_value->it_value.tv_usec = microseconds;
+        convert_counts_to_timeval(prev_timeout, &old_value->it_value);
+        convert_counts_to_timeval(prev_interval, &old_value->it_interval);
     }
 
     return 0;
@@ -112,6 +138,9 @@ int do_alarm(struct proc *who, struct message *m){
     ret = sys_setitimer(who, ITIMER_REAL, &act, &oact);
     if (ret)
         return ret;
+    // the seconds left are rounded, but never down to 0
+    if((!oact.it_value.tv_sec && oact.it_value.tv_usec) || oact.it_value.tv_usec >= 500000)
+        oact.it_value.tv_sec++;
     return oact.it_value.tv_sec;
 }
 
@@ -125,7 +154,7 @@ void _wakeup_process(int proc_nr, clock_t time){
 }
 
 int do_nanosleep(struct proc* who, struct message* m){
-    clock_t ticks;
+    clock_t counts;
     int ret;
     struct timer *alarm;
     struct timespec* req;
@@ -140,9 +169,8 @@ int do_nanosleep(struct proc* who, struct message* m){
         return -EINVAL;
     }
 
-    ticks = convert_timespec_to_hz(req);
-    
-    ret = new_timer(who->proc_nr, alarm, ticks, _wakeup_process);
+    counts = convert_timespec_to_counts(req);
+    ret = new_hrtimer(who->proc_nr, alarm, counts, who->timer_slack, _wakeup_process);
     if (ret)    
         return ret;
 
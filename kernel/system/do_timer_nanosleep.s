@@ -0,0 +1,570 @@
+.text
+timer_left:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 9($13)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 5($sp)
+	lw	$12, 3($13)
+	sw	$12, 0($sp)
+	lw	$13, 4($13)
+	sw	$13, 1($sp)
+	jal	get_hrtime_until
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.9
+L.10:
+	lw	$13, 5($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	get_hrtime_until
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.9:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	deliver_alarm
+deliver_alarm:
+	subui	$sp, $sp, 11
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	get_non_zombie_proc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.13
+	sw	$7, 0($sp)
+	addui	$13, $0, 14
+	sw	$13, 1($sp)
+	jal	send_sig
+	lw	$13, 19($7)
+	seq	$13, $13, $0
+	bnez	$13, L.15
+	sw	$7, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	handle_pendingsig
+L.15:
+	lw	$13, 19($7)
+	sne	$13, $13, $0
+	bnez	$13, L.17
+	lw	$13, 210($7)
+	sequ	$13, $13, $0
+	bnez	$13, L.17
+	addui	$13, $7, 200
+	sw	$13, 0($sp)
+	jal	timer_left
+	addu	$13, $0, $1
+	lw	$12, 210($7)
+	addu	$12, $0, $12
+	add	$13, $13, $12
+	sw	$13, 10($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	addui	$13, $7, 200
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.20
+	lw	$6, 10($sp)
+	j	L.21
+L.20:
+	addui	$6, $0, 1
+L.21:
+	addu	$13, $0, $6
+	sw	$13, 2($sp)
+	lw	$13, 211($7)
+	sw	$13, 3($sp)
+	la	$13, deliver_alarm
+	sw	$13, 4($sp)
+	jal	new_hrtimer
+L.17:
+L.13:
+L.12:
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+convert_usec_to_counts:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 24
+	lw	$12, 2($sp)
+	multu	$13, $13, $12
+	addui	$12, $0, 9999
+	addu	$13, $13, $12
+	addui	$12, $0, 10000
+	divu	$1, $13, $12
+L.22:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	convert_timeval_to_counts
+convert_timeval_to_counts:
+	subui	$sp, $sp, 5
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xd
+	ori	$12, $12, 0xa73f
+	sltu	$13, $13, $12
+	bnez	$13, L.24
+	lhi	$1, 0x7fff
+	ori	$1, $1, 0xeea0
+	j	L.23
+L.24:
+	lw	$13, 5($sp)
+	lw	$12, 1($13)
+	sw	$12, 0($sp)
+	jal	convert_usec_to_counts
+	addu	$12, $0, $1
+	addui	$11, $0, 2400
+	lw	$13, 0($13)
+	multu	$13, $11, $13
+	addu	$1, $13, $12
+L.23:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	convert_timespec_to_counts
+convert_timespec_to_counts:
+	subui	$sp, $sp, 5
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xd
+	ori	$12, $12, 0xa73f
+	sltu	$13, $13, $12
+	bnez	$13, L.27
+	lhi	$1, 0x7fff
+	ori	$1, $1, 0xeea0
+	j	L.26
+L.27:
+	lw	$13, 5($sp)
+	lw	$12, 1($13)
+	addi	$12, $12, 999
+	divi	$12, $12, 1000
+	addu	$12, $0, $12
+	sw	$12, 0($sp)
+	jal	convert_usec_to_counts
+	addu	$12, $0, $1
+	addui	$11, $0, 2400
+	lw	$13, 0($13)
+	multu	$13, $11, $13
+	addu	$1, $13, $12
+L.26:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	convert_counts_to_timeval
+convert_counts_to_timeval:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	addui	$11, $0, 2400
+	divu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 5($sp)
+	addui	$12, $0, 10000
+	lw	$11, 4($sp)
+	addui	$10, $0, 2400
+	remu	$11, $11, $10
+	multu	$12, $12, $11
+	addui	$11, $0, 24
+	divu	$12, $12, $11
+	sw	$12, 1($13)
+L.29:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	sys_setitimer
+sys_setitimer:
+	subui	$sp, $sp, 14
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, 11($sp)
+	lw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.31
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.30
+L.31:
+	lw	$13, 14($sp)
+	addui	$7, $13, 200
+	addui	$13, $13, 210
+	lw	$12, 0($13)
+	sw	$12, 10($sp)
+	sw	$0, 0($13)
+	lw	$13, 9($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.33
+	sw	$7, 0($sp)
+	jal	timer_left
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.35
+	lw	$13, 9($sp)
+	addu	$13, $0, $13
+	sw	$13, 11($sp)
+L.35:
+	sw	$7, 0($sp)
+	jal	remove_timer
+L.33:
+	lw	$13, 16($sp)
+	addui	$13, $13, 2
+	sw	$13, 0($sp)
+	jal	convert_timeval_to_counts
+	addu	$13, $0, $1
+	sw	$13, 13($sp)
+	lw	$13, 16($sp)
+	sw	$13, 0($sp)
+	jal	convert_timeval_to_counts
+	addu	$13, $0, $1
+	sw	$13, 12($sp)
+	lw	$13, 14($sp)
+	lw	$12, 12($sp)
+	sw	$12, 210($13)
+	lw	$13, 13($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.37
+	lw	$13, 14($sp)
+	lw	$12, 133($13)
+	sw	$12, 0($sp)
+	sw	$7, 1($sp)
+	lw	$12, 13($sp)
+	sw	$12, 2($sp)
+	lw	$13, 211($13)
+	sw	$13, 3($sp)
+	la	$13, deliver_alarm
+	sw	$13, 4($sp)
+	jal	new_hrtimer
+L.37:
+	lw	$13, 17($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.39
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 17($sp)
+	addui	$13, $13, 2
+	sw	$13, 1($sp)
+	jal	convert_counts_to_timeval
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 17($sp)
+	sw	$13, 1($sp)
+	jal	convert_counts_to_timeval
+L.39:
+	addu	$1, $0, $0
+L.30:
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.global	do_setitimer
+do_setitimer:
+	subui	$sp, $sp, 8
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$6, 5($13)
+	lw	$13, 9($sp)
+	lw	$7, 6($13)
+	sw	$6, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.42
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.41
+L.42:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.44
+	sw	$7, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.44
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.41
+L.44:
+	lw	$13, 8($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$6, $13, $6
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.46
+	lw	$13, 8($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	addu	$7, $13, $7
+L.46:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	jal	sys_setitimer
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.41:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	do_alarm
+do_alarm:
+	subui	$sp, $sp, 17
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 4
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 18($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sw	$13, 11($sp)
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	addui	$13, $sp, 13
+	sw	$13, 3($sp)
+	jal	sys_setitimer
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.50
+	lw	$1, 8($sp)
+	j	L.48
+L.50:
+	addu	$13, $0, $0
+	sw	$13, 7($sp)
+	lw	$12, 15($sp)
+	sneu	$13, $12, $13
+	bnez	$13, L.60
+	lw	$13, 16($sp)
+	lw	$12, 7($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.59
+L.60:
+	lw	$13, 16($sp)
+	lhi	$12, 0x7
+	ori	$12, $12, 0xa120
+	sltu	$13, $13, $12
+	bnez	$13, L.52
+L.59:
+	lw	$13, 15($sp)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	sw	$13, 15($sp)
+L.52:
+	lw	$13, 15($sp)
+	addu	$1, $0, $13
+L.48:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	_wakeup_process
+_wakeup_process:
+	subui	$sp, $sp, 15
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	sw	$13, 14($sp)
+	lw	$13, 14($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.64
+	addui	$13, $0, 47
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 15($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 6
+	sw	$13, 3($sp)
+	jal	syscall_reply2
+L.64:
+L.63:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	do_nanosleep
+do_nanosleep:
+	subui	$sp, $sp, 13
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 14($sp)
+	lw	$13, 5($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.67
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.66
+L.67:
+	lw	$13, 13($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$11, 14($sp)
+	lw	$11, 5($11)
+	addu	$12, $12, $11
+	sw	$12, 10($sp)
+	addui	$7, $13, 200
+	lw	$13, 9($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.69
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.66
+L.69:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	jal	convert_timespec_to_counts
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	lw	$13, 13($sp)
+	lw	$12, 133($13)
+	sw	$12, 0($sp)
+	sw	$7, 1($sp)
+	lw	$12, 11($sp)
+	sw	$12, 2($sp)
+	lw	$13, 211($13)
+	sw	$13, 3($sp)
+	la	$13, _wakeup_process
+	sw	$13, 4($sp)
+	jal	new_hrtimer
+	addu	$13, $0, $1
+	sw	$13, 12($sp)
+	lw	$13, 12($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.71
+	lw	$1, 12($sp)
+	j	L.66
+L.71:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+L.66:
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,90 @@
+.global	do_times
+.text
+do_times:
+	subui	$sp, $sp, 13
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 14($sp)
+	lw	$7, 5($13)
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 9
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	addui	$13, $0, 4
+	sw	$13, 3($sp)
+	jal	copy_from_user
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.12
+	lw	$1, 8($sp)
+	j	L.9
+L.12:
+	lw	$13, 13($sp)
+	lw	$12, 92($13)
+	sw	$12, 9($sp)
+	lw	$13, 93($13)
+	sw	$13, 10($sp)
+	sw	$0, 12($sp)
+	sw	$0, 11($sp)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	addui	$13, $0, 4
+	sw	$13, 3($sp)
+	jal	copy_to_user
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.17
+	lw	$1, 8($sp)
+	j	L.9
+L.17:
+L.10:
+	jal	get_uptime
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.9:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,105 @@
+/**
+ * Syscall in this file: uring_setup, uring_enter
+ * Input:   uring_setup:    m1_p1: struct uring, or NULL to unregister
+ *          uring_enter:    m1_i1: number of submissions to run
+ *
+ * Return:  reply_res: uring_enter returns the number of submissions run
+ *
+ * A process queues syscalls on the submission ring and collects their
+ * results from the completion ring, so that a batch of file operations
+ * costs one message to the system task instead of one per call
+*/
+#include <kernel/kernel.h>
+#include <kernel/table.h>
+#include <kernel/system.h>
+#include <fs/path.h>
+#include <fs/inode.h>
+#include <fs/filp.h>
+#include <sys/stat.h>
+#include <sys/uring.h>
+
+/**
+ * whether the syscall can be run from the ring. The caller is not blocked,
+ * so only calls that complete immediately are, and read and write are
+ * limited to regular files
+ * @param  who 
+ * @param  sqe 
+ * @return     0, or the errno of the completion
+ */
+PRIVATE int uring_check(struct proc* who, struct uring_sqe* sqe){
+    int fd = sqe->args[0];
+    mode_t mode;
+
+    switch(sqe->opcode){
+        case READ:
+        case WRITE:
+            // bad descriptors are left to the handler
+            if(!is_fd_opened_and_valid(who, fd))
+                return 0;
+            mode = who->fp_filp[fd]->filp_ino->i_mode;
+            return S_ISREG(mode) || S_ISDIR(mode) ? 0 : -EAGAIN;
+
+        case LSEEK:
+        case CLOSE:
+        case STAT:
+        case FSTAT:
+            return 0;
+
+        default:
+            return -EINVAL;
+    }
+}
+
+PRIVATE int uring_run(struct proc* who, struct uring_sqe* sqe){
+    struct message m;
+    int ret;
+
+    if((ret = uring_check(who, sqe)))
+        return ret;
+    memset(&m, 0, sizeof(m));
+    m.type = sqe->opcode;
+    m.src = who->proc_nr;
+    set_syscall_mesg_exception(sqe->opcode, (ptr_t *)sqe->args, &m, who);
+    if((ret = resolve_syscall_args(sqe->opcode, &m, who)))
+        return ret;
+    return syscall_table[sqe->opcode](who, &m);
+}
+
+int do_uring_setup(struct proc* who, struct message* m){
+    vptr_t* ring = m->m1_p1;
+
+    if(ring && !is_vaddr_ok(ring, sizeof(struct uring), who))
+        return -EFAULT;
+    who->uring = ring;
+    return 0;
+}
+
+int do_uring_enter(struct proc* who, struct message* m){
+    unsigned int to_submit = m->m1_i1;
+    struct uring* ring;
+    struct uring_sqe sqe;
+    struct uring_cqe* cqe;
+    int submitted = 0;
+
+    if(!who->uring)
+        return -EINVAL;
+    if(!is_vaddr_ok(who->uring, sizeof(struct uring), who))
+        return -EFAULT;
+    ring = (struct uring*)get_physical_addr(who->uring, who);
+
+    // submissions left once the completion ring is full wait for the
+    // next call, so no completion is ever dropped
+    while(submitted < to_submit && ring->sq_head != ring->sq_tail &&
+            ring->cq_tail - ring->cq_head < URING_ENTRIES){
+
+        // the handler may write to the ring, e.g. read(2) into it
+        sqe = ring->sqes[ring->sq_head & URING_MASK];
+        ring->sq_head++;
+        cqe = &ring->cqes[ring->cq_tail & URING_MASK];
+        cqe->res = uring_run(who, &sqe);
+        cqe->user_data = sqe.user_data;
+        ring->cq_tail++;
+        submitted++;
+    }
+    return submitted;
+}
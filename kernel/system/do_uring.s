@@ -0,0 +1,350 @@
+.text
+uring_check:
+	subui	$sp, $sp, 11
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 12($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sw	$13, 10($sp)
+	lw	$13, 12($sp)
+	lw	$7, 0($13)
+	seqi	$13, $7, 32
+	bnez	$13, L.20
+	addui	$13, $0, 33
+	sw	$13, 8($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.20
+	lw	$13, 8($sp)
+	sgt	$13, $7, $13
+	bnez	$13, L.22
+L.21:
+	seqi	$13, $7, 23
+	bnez	$13, L.13
+	seqi	$13, $7, 24
+	bnez	$13, L.13
+	seqi	$13, $7, 25
+	bnez	$13, L.20
+	j	L.10
+L.22:
+	seqi	$13, $7, 42
+	bnez	$13, L.20
+	j	L.10
+L.13:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	is_fd_opened_and_valid
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.14
+	addu	$1, $0, $0
+	j	L.9
+L.14:
+	lw	$13, 10($sp)
+	lw	$12, 11($sp)
+	addui	$12, $12, 214
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	lw	$13, 3($13)
+	lw	$13, 0($13)
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	sw	$13, 7($sp)
+	addui	$12, $0, 0x8000
+	sequ	$13, $13, $12
+	bnez	$13, L.19
+	addui	$13, $0, 16384
+	lw	$12, 7($sp)
+	sneu	$13, $12, $13
+	bnez	$13, L.17
+L.19:
+	addu	$6, $0, $0
+	j	L.18
+L.17:
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xfff5
+L.18:
+	addu	$1, $0, $6
+	j	L.9
+L.20:
+	addu	$1, $0, $0
+	j	L.9
+L.10:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.9:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+uring_run:
+	subui	$sp, $sp, 17
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	lw	$13, 18($sp)
+	sw	$13, 1($sp)
+	jal	uring_check
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.24
+	addu	$1, $0, $7
+	j	L.23
+L.24:
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 8
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 18($sp)
+	lw	$13, 0($13)
+	sw	$13, 10($sp)
+	lw	$13, 17($sp)
+	lw	$12, 133($13)
+	sw	$12, 9($sp)
+	lw	$12, 18($sp)
+	lw	$11, 0($12)
+	sw	$11, 0($sp)
+	addui	$12, $12, 1
+	sw	$12, 1($sp)
+	addui	$12, $sp, 9
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	set_syscall_mesg_exception
+	lw	$13, 18($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 9
+	sw	$13, 1($sp)
+	lw	$13, 17($sp)
+	sw	$13, 2($sp)
+	jal	resolve_syscall_args
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.27
+	addu	$1, $0, $7
+	j	L.23
+L.27:
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 9
+	sw	$13, 1($sp)
+	lw	$13, 18($sp)
+	lw	$13, 0($13)
+	lw	$13, syscall_table($13)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.23:
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	do_uring_setup
+do_uring_setup:
+	subui	$sp, $sp, 6
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	lw	$7, 5($13)
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.30
+	sw	$7, 0($sp)
+	addui	$13, $0, 228
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.30
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.29
+L.30:
+	lw	$13, 6($sp)
+	sw	$7, 212($13)
+	addu	$1, $0, $0
+L.29:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	do_uring_enter
+do_uring_enter:
+	subui	$sp, $sp, 19
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$8, 7($sp)
+	sw	$9, 8($sp)
+	sw	$10, 9($sp)
+	sw	$11, 10($sp)
+	sw	$12, 11($sp)
+	sw	$13, 12($sp)
+	sw	$ra, 13($sp)
+	lw	$13, 20($sp)
+	lw	$13, 2($13)
+	addu	$4, $0, $13
+	addu	$5, $0, $0
+	lw	$13, 19($sp)
+	lw	$13, 212($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.33
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.32
+L.33:
+	lw	$13, 19($sp)
+	lw	$12, 212($13)
+	sw	$12, 0($sp)
+	addui	$12, $0, 228
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.35
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.32
+L.35:
+	lw	$13, 19($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$13, 212($13)
+	addu	$7, $12, $13
+	j	L.38
+L.37:
+	addui	$13, $sp, 14
+	addui	$12, $0, 5
+	lw	$11, 0($7)
+	addui	$10, $0, 31
+	and	$11, $11, $10
+	multu	$12, $12, $11
+	addui	$11, $7, 4
+	addu	$9, $12, $11
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	sw	$8, 4($13)
+	lw	$13, 0($7)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	sw	$13, 0($7)
+	lw	$13, 3($7)
+	addui	$12, $0, 31
+	and	$13, $13, $12
+	slli	$13, $13, 1
+	addui	$12, $7, 164
+	addu	$6, $13, $12
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 14
+	sw	$13, 1($sp)
+	jal	uring_run
+	addu	$13, $0, $1
+	sw	$13, 0($6)
+	lw	$13, 18($sp)
+	sw	$13, 1($6)
+	addui	$13, $7, 3
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	addi	$5, $5, 1
+L.38:
+	addu	$13, $0, $5
+	sgeu	$13, $13, $4
+	bnez	$13, L.42
+	lw	$13, 0($7)
+	lw	$12, 1($7)
+	sequ	$13, $13, $12
+	bnez	$13, L.42
+	lw	$13, 3($7)
+	lw	$12, 2($7)
+	subu	$13, $13, $12
+	addui	$12, $0, 32
+	sltu	$13, $13, $12
+	bnez	$13, L.37
+L.42:
+	addu	$1, $0, $5
+L.32:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$8, 7($sp)
+	lw	$9, 8($sp)
+	lw	$10, 9($sp)
+	lw	$11, 10($sp)
+	lw	$12, 11($sp)
+	lw	$13, 12($sp)
+	lw	$ra, 13($sp)
+	addui	$sp, $sp, 19
+	jr	$ra
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -2,8 +2,10 @@
  * Syscall in this file: winfo
  * NB this is a winix specific system call
  * Input:   m1_i1: type of information to be displayed
+ *          m1_p1: buffer for WINFO_KMALLOC_SITES
+ *          m1_i2: number of entries the buffer holds
  *
- * Return:  reply_res: 0
+ * Return:  reply_res: 0, or number of entries for WINFO_KMALLOC_SITES
  * 
  * @author Bruce Tan
  * @email brucetansh@gmail.com
@@ -55,6 +57,14 @@ int do_winfo(struct proc *who, struct message *m){
             who->flags |= PROC_NO_GPF;
             break;
 
+        case WINFO_KMALLOC_SITES:
+            if(m->m1_i2 < 0)
+                return -EINVAL;
+            if(!is_vaddr_ok(m->m1_p1, m->m1_i2 * sizeof(struct kmalloc_site), who))
+                return -EFAULT;
+            return get_kmalloc_sites(
+                (struct kmalloc_site *)get_physical_addr(m->m1_p1, who), m->m1_i2);
+
         default:
             return -EINVAL;
     }
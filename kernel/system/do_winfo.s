@@ -0,0 +1,160 @@
+.global	do_winfo
+.text
+do_winfo:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 215($13)
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.10:
+	lw	$13, 10($sp)
+	lw	$7, 2($13)
+	slti	$13, $7, 1
+	bnez	$13, L.12
+	sgti	$13, $7, 9
+	bnez	$13, L.12
+	lw	$13, L.28-1($7)
+	jr	$13
+.data
+L.28:
+	.word	L.15
+	.word	L.17
+	.word	L.16
+	.word	L.18
+	.word	L.19
+	.word	L.20
+	.word	L.21
+	.word	L.22
+	.word	L.23
+.text
+L.15:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	kreport_all_procs
+	j	L.13
+L.16:
+	jal	kprint_slab
+	j	L.13
+L.17:
+	la	$13, kprintf
+	sw	$13, 0($sp)
+	jal	_kreport_sysmap
+	j	L.13
+L.18:
+	addui	$13, $0, 1
+	sw	$13, trace_syscall($0)
+	j	L.13
+L.19:
+	sw	$0, trace_syscall($0)
+	j	L.13
+L.20:
+	addui	$13, $0, 999
+	sw	$13, 0($sp)
+	jal	debug_ipc
+	j	L.13
+L.21:
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	jal	debug_scheduling
+	j	L.13
+L.22:
+	lw	$13, 9($sp)
+	addui	$13, $13, 131
+	lw	$12, 0($13)
+	ori	$12, $12, 16
+	sw	$12, 0($13)
+	j	L.13
+L.23:
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	sge	$13, $13, $0
+	bnez	$13, L.24
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.24:
+	lw	$13, 10($sp)
+	lw	$12, 5($13)
+	sw	$12, 0($sp)
+	addui	$12, $0, 5
+	lw	$13, 3($13)
+	addu	$13, $0, $13
+	multu	$13, $12, $13
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.26
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.9
+L.26:
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	lw	$12, 16($12)
+	addu	$12, $0, $12
+	lw	$11, 5($13)
+	addu	$12, $12, $11
+	sw	$12, 0($sp)
+	lw	$13, 3($13)
+	sw	$13, 1($sp)
+	jal	get_kmalloc_sites
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.9
+L.12:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.13:
+	addu	$1, $0, $0
+L.9:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,120 @@
+.global	boot_table
+boot_table:
+	.asciiz	"idle"
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+	.word	idle_main
+	.word	0xfffffffe
+	.word	0x1
+	.word	0x0
+	.word	0x32
+	.asciiz	"parallel"
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+	.word	parallel_main
+	.word	0xffffffff
+	.word	0x1
+	.word	0x0
+	.word	0x32
+	.asciiz	"winix"
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+
+.word	0
+	.word	system_main
+	.word	0x0
+	.word	0x40
+	.word	0x5
+	.word	0x400
+.global	INIT_PATH
+INIT_PATH:
+	.asciiz	"/bin/init"
+.global	init_argv
+init_argv:
+	.word	INIT_PATH
+	.word	0x0
+.extern	build_bug_on 1
+.bss
+.global	syscall_str
+syscall_str:
+	.space	65
+.global	syscall_table
+syscall_table:
+	.space	65
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
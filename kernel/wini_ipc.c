@@ -56,7 +56,7 @@ int do_send(struct proc* src, int dest, struct message *m) {
             // Unblock receiver
             pDest->state &= ~STATE_RECEIVING;
             pDest->ctx.m.regs[0] = m->reply_res;
-            enqueue_head(ready_q[pDest->priority], pDest);
+            enqueue_schedule_head(pDest);
             if(is_debugging_ipc()){
                 kdebug("IPC: msg delivered to %d from %d\n", dest, src->proc_nr);
             }
@@ -87,20 +87,15 @@ int do_send(struct proc* src, int dest, struct message *m) {
  **/
 int do_receive(struct message *m) {
     struct proc *p;
-    int i;
-
-    if(curr_scheduling_proc->notify_pending){
-        for(i = 0; i < 32; i++){
-            if(is_bit_on(&curr_scheduling_proc->notify_pending, 1, i)){
-                bitmap_clear_bit(&curr_scheduling_proc->notify_pending, 1, i);
-                p = get_proc(i);
-                *m = *(p->message);
-                if(is_debugging_ipc()){
-                    klog("%d notify queue %d type %d\n", curr_scheduling_proc->proc_nr, p->proc_nr, m->type);
-                }
-                return 0;
-            }
+
+    if(!list_empty(&curr_scheduling_proc->notify_q)){
+        p = list_first_entry(&curr_scheduling_proc->notify_q, struct proc, notify_link);
+        list_del_init(&p->notify_link);
+        *m = p->notify_mesg;
+        if(is_debugging_ipc()){
+            klog("%d notify queue %d type %d\n", curr_scheduling_proc->proc_nr, p->proc_nr, m->type);
         }
+        return 0;
     }
     
     p = curr_scheduling_proc->sender_q;
@@ -117,7 +112,7 @@ int do_receive(struct message *m) {
         // Unblock sender
         p->state &= ~STATE_SENDING;
         if(p->state == STATE_RUNNABLE)
-            enqueue_head(ready_q[p->priority], p);
+            enqueue_schedule_head(p);
         
         // if(is_debugging_ipc())
         //     kdebug("IPC: %d REC from %d type %d\n",curr_scheduling_proc->proc_nr, m->src ,m->type);
@@ -138,6 +133,7 @@ int do_receive(struct message *m) {
  * Returns:
  *   0 on success
  *   -1 if destination is invalid
+ *   -EAGAIN if a notification of src to another destination is still queued
  **/
 int do_notify(int src, int dest, struct message *m) {
     struct proc *pDest, *pSrc;
@@ -168,12 +164,20 @@ int do_notify(int src, int dest, struct message *m) {
             pDest->state &= ~STATE_RECEIVING;
             
             if(pDest->state == STATE_RUNNABLE){
-                enqueue_head(ready_q[pDest->priority], pDest);
+                enqueue_schedule_head(pDest);
             }
         }else{
             pSrc = get_proc(src);
             if(IS_USER_PROC(pSrc)){
-                pSrc->message = m;
+                // delivered by the next receive of pDest. pSrc has one
+                // queued notification, a later one to the same destination
+                // replaces it, one to another destination has to wait
+                if(!list_empty(&pSrc->notify_link) && pSrc->notify_dest != dest)
+                    return -EAGAIN;
+                pSrc->notify_mesg = *m;
+                pSrc->notify_dest = dest;
+                if(list_empty(&pSrc->notify_link))
+                    list_add_tail(&pSrc->notify_link, &pDest->notify_q);
             }else{
                 syscall_num = m->type;
                 if(syscall_num > 0 && syscall_num < _NSYSCALL){
@@ -0,0 +1,534 @@
+.global	do_send
+.text
+do_send:
+	subui	$sp, $sp, 12
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$8, 5($sp)
+	sw	$9, 6($sp)
+	sw	$10, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, 12($sp)
+	lw	$12, 14($sp)
+	sw	$12, 20($13)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 19($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.12
+	lw	$13, 12($sp)
+	lw	$6, 65($13)
+	j	L.15
+L.14:
+	addu	$13, $0, $6
+	addu	$12, $0, $7
+	sneu	$13, $13, $12
+	bnez	$13, L.17
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffdd
+	j	L.9
+L.17:
+	lw	$6, 66($6)
+L.15:
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.14
+L.12:
+	lw	$13, 19($7)
+	snei	$13, $13, 2
+	bnez	$13, L.19
+	lw	$13, 20($7)
+	lw	$9, 14($sp)
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	lw	$10, 5($9)
+	sw	$8, 4($13)
+	sw	$10, 5($13)
+	lw	$8, 6($9)
+	lw	$10, 7($9)
+	sw	$8, 6($13)
+	sw	$10, 7($13)
+	addui	$13, $7, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffd
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 14($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sw	$13, 0($7)
+	sw	$7, 0($sp)
+	jal	enqueue_schedule_head
+	jal	is_debugging_ipc
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.20
+	la	$13, L.23
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	jal	klog
+	j	L.20
+L.19:
+	jal	is_debugging_ipc
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.24
+	la	$13, L.26
+	sw	$13, 0($sp)
+	lw	$13, 13($sp)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	lw	$13, 133($13)
+	sw	$13, 2($sp)
+	jal	klog
+L.24:
+	lw	$13, 12($sp)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 12($sp)
+	lw	$12, 65($7)
+	sw	$12, 66($13)
+	lw	$13, 12($sp)
+	sw	$13, 65($7)
+L.20:
+	addu	$1, $0, $0
+	j	L.9
+L.10:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+L.9:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$8, 5($sp)
+	lw	$9, 6($sp)
+	lw	$10, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	do_receive
+do_receive:
+	subui	$sp, $sp, 12
+	sw	$7, 4($sp)
+	sw	$8, 5($sp)
+	sw	$9, 6($sp)
+	sw	$10, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 67
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.28
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 67($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffbb
+	addu	$7, $13, $12
+L.30:
+L.33:
+L.36:
+	lw	$13, 69($7)
+	lw	$12, 70($7)
+	sw	$12, 1($13)
+	lw	$13, 70($7)
+	lw	$12, 69($7)
+	sw	$12, 0($13)
+L.37:
+L.34:
+L.39:
+	addui	$13, $7, 69
+	sw	$13, 0($13)
+	addui	$13, $7, 69
+	sw	$13, 70($7)
+L.40:
+L.31:
+	lw	$13, 12($sp)
+	addui	$9, $7, 72
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	lw	$10, 5($9)
+	sw	$8, 4($13)
+	sw	$10, 5($13)
+	lw	$8, 6($9)
+	lw	$10, 7($9)
+	sw	$8, 6($13)
+	sw	$10, 7($13)
+	jal	is_debugging_ipc
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.42
+	la	$13, L.44
+	sw	$13, 0($sp)
+	lw	$13, curr_scheduling_proc($0)
+	lw	$13, 133($13)
+	sw	$13, 1($sp)
+	lw	$13, 133($7)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	lw	$13, 1($13)
+	sw	$13, 3($sp)
+	jal	klog
+L.42:
+	addu	$1, $0, $0
+	j	L.27
+L.28:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$7, 65($13)
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.45
+	lw	$13, curr_scheduling_proc($0)
+	lw	$12, 66($7)
+	sw	$12, 65($13)
+	lw	$13, 12($sp)
+	lw	$9, 20($7)
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	lw	$10, 5($9)
+	sw	$8, 4($13)
+	sw	$10, 5($13)
+	lw	$8, 6($9)
+	lw	$10, 7($9)
+	sw	$8, 6($13)
+	sw	$10, 7($13)
+	addui	$13, $7, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffe
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 19($7)
+	sne	$13, $13, $0
+	bnez	$13, L.47
+	sw	$7, 0($sp)
+	jal	enqueue_schedule_head
+L.47:
+	addu	$1, $0, $0
+	j	L.27
+L.45:
+	lw	$13, curr_scheduling_proc($0)
+	lw	$12, 12($sp)
+	sw	$12, 20($13)
+	lw	$13, curr_scheduling_proc($0)
+	addui	$13, $13, 19
+	lw	$12, 0($13)
+	ori	$12, $12, 2
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.27:
+	lw	$7, 4($sp)
+	lw	$8, 5($sp)
+	lw	$9, 6($sp)
+	lw	$10, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	do_notify
+do_notify:
+	subui	$sp, $sp, 21
+	sw	$3, 6($sp)
+	sw	$4, 7($sp)
+	sw	$5, 8($sp)
+	sw	$6, 9($sp)
+	sw	$7, 10($sp)
+	sw	$8, 11($sp)
+	sw	$9, 12($sp)
+	sw	$10, 13($sp)
+	sw	$11, 14($sp)
+	sw	$12, 15($sp)
+	sw	$13, 16($sp)
+	sw	$ra, 17($sp)
+	la	$13, L.50
+	sw	$13, 20($sp)
+	lw	$13, 22($sp)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.51
+	lw	$13, 19($7)
+	addu	$13, $0, $13
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.53
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.49
+L.53:
+	lw	$13, 19($7)
+	snei	$13, $13, 2
+	bnez	$13, L.55
+	lw	$13, 131($7)
+	andi	$13, $13, 4
+	seq	$13, $13, $0
+	bnez	$13, L.57
+	addui	$13, $7, 131
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffb
+	and	$12, $12, $11
+	sw	$12, 0($13)
+L.57:
+	sw	$7, 0($sp)
+	lw	$13, 23($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	set_syscall_reply
+	lw	$13, 20($7)
+	lw	$9, 23($sp)
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	lw	$10, 5($9)
+	sw	$8, 4($13)
+	sw	$10, 5($13)
+	lw	$8, 6($9)
+	lw	$10, 7($9)
+	sw	$8, 6($13)
+	sw	$10, 7($13)
+	addui	$13, $7, 19
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffd
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 19($7)
+	sne	$13, $13, $0
+	bnez	$13, L.56
+	sw	$7, 0($sp)
+	jal	enqueue_schedule_head
+	j	L.56
+L.55:
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 16($6)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.61
+	addui	$13, $6, 69
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.63
+	lw	$13, 71($6)
+	lw	$12, 22($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.63
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff5
+	j	L.49
+L.63:
+	addui	$13, $6, 72
+	lw	$9, 23($sp)
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	lw	$10, 5($9)
+	sw	$8, 4($13)
+	sw	$10, 5($13)
+	lw	$8, 6($9)
+	lw	$10, 7($9)
+	sw	$8, 6($13)
+	sw	$10, 7($13)
+	lw	$13, 22($sp)
+	sw	$13, 71($6)
+	addui	$13, $6, 69
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.62
+L.67:
+L.70:
+	addui	$5, $6, 69
+	lw	$4, 68($7)
+	addui	$3, $7, 67
+	sw	$5, 1($3)
+	sw	$3, 0($5)
+	sw	$4, 1($5)
+	sw	$5, 0($4)
+	j	L.62
+L.61:
+	lw	$13, 23($sp)
+	lw	$13, 1($13)
+	sw	$13, 19($sp)
+	lw	$13, 19($sp)
+	sw	$13, 18($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.73
+	lw	$13, 18($sp)
+	sgei	$13, $13, 65
+	bnez	$13, L.73
+	lw	$13, 19($sp)
+	lw	$13, syscall_str($13)
+	sw	$13, 20($sp)
+L.73:
+	la	$13, L.75
+	sw	$13, 0($sp)
+	addui	$13, $7, 94
+	sw	$13, 1($sp)
+	lw	$13, 133($7)
+	sw	$13, 2($sp)
+	lw	$13, 19($7)
+	sw	$13, 3($sp)
+	lw	$13, 20($sp)
+	sw	$13, 4($sp)
+	lw	$13, 21($sp)
+	sw	$13, 5($sp)
+	jal	kwarn
+L.62:
+L.56:
+	addu	$1, $0, $0
+	j	L.49
+L.51:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+L.49:
+	lw	$3, 6($sp)
+	lw	$4, 7($sp)
+	lw	$5, 8($sp)
+	lw	$6, 9($sp)
+	lw	$7, 10($sp)
+	lw	$8, 11($sp)
+	lw	$9, 12($sp)
+	lw	$10, 13($sp)
+	lw	$11, 14($sp)
+	lw	$12, 15($sp)
+	lw	$13, 16($sp)
+	lw	$ra, 17($sp)
+	addui	$sp, $sp, 21
+	jr	$ra
+.global	winix_notify
+winix_notify:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x4
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.76:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.75:
+	.asciiz	"notify: dest %s[%d] state %x cant receive %s from %d\n"
+L.50:
+	.asciiz	""
+L.44:
+	.asciiz	"%d notify queue %d type %d\n"
+L.26:
+	.asciiz	"IPC: SEND to %d from %d blocked\n"
+L.23:
+	.asciiz	"IPC: msg delivered to %d from %d\n"
@@ -0,0 +1,33 @@
+.global	__assert
+.text
+__assert:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.4
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.7
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	lw	$13, 7($sp)
+	sw	$13, 3($sp)
+	jal	dprintf
+	jal	abort
+L.4:
+L.3:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.7:
+	.asciiz	"assertion failed at %s:%d\n"
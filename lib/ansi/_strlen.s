@@ -0,0 +1,31 @@
+.global	strlen
+.text
+strlen:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	sw	$13, 2($sp)
+	j	L.5
+L.2:
+L.3:
+	lw	$13, 3($sp)
+	addui	$13, $13, 1
+	sw	$13, 3($sp)
+L.5:
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.2
+	lw	$13, 3($sp)
+	addu	$13, $0, $13
+	lw	$12, 2($sp)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	addu	$1, $0, $13
+L.1:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
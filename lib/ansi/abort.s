@@ -0,0 +1,28 @@
+.global	abort
+.text
+abort:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 12
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addui	$12, $0, 11
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 6
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+L.1:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
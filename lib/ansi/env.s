@@ -0,0 +1,36 @@
+.global	_environ
+_environ:
+	.word	0x0
+.global	get_environ
+.text
+get_environ:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, _environ($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.2
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1023
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	sw	$13, _environ($0)
+L.2:
+	lw	$1, _environ($0)
+L.1:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
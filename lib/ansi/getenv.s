@@ -0,0 +1,74 @@
+.global	getenv
+.text
+getenv:
+	subui	$sp, $sp, 7
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+	addu	$1, $0, $0
+	j	L.3
+L.4:
+	jal	get_environ
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	j	L.7
+L.6:
+	lw	$7, 7($sp)
+	j	L.10
+L.9:
+	addui	$7, $7, 1
+L.10:
+	lw	$13, 0($7)
+	sw	$13, 6($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.12
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	lw	$13, 0($13)
+	lw	$12, 6($sp)
+	seq	$13, $12, $13
+	bnez	$13, L.9
+L.12:
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, 0($6)
+	seqi	$13, $13, 61
+	bnez	$13, L.13
+L.15:
+	j	L.7
+L.13:
+	addui	$13, $6, 1
+	addu	$13, $0, $13
+	addu	$1, $0, $13
+	j	L.3
+L.7:
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	lw	$13, 0($13)
+	addu	$6, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.6
+	addu	$1, $0, $0
+L.3:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,39 @@
+.global	index
+.text
+index:
+	subui	$sp, $sp, 5
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$7, 5($sp)
+	j	L.3
+L.2:
+	addui	$7, $7, 1
+L.3:
+	lw	$13, 0($7)
+	sw	$13, 4($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.5
+	lw	$13, 6($sp)
+	lw	$12, 4($sp)
+	sne	$13, $12, $13
+	bnez	$13, L.2
+L.5:
+	lw	$13, 0($7)
+	seq	$13, $13, $0
+	bnez	$13, L.7
+	addu	$6, $0, $7
+	j	L.8
+L.7:
+	addu	$6, $0, $0
+L.8:
+	addu	$13, $0, $6
+	addu	$1, $0, $13
+L.1:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
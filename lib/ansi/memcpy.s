@@ -0,0 +1,41 @@
+.global	memcpy
+.text
+memcpy:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$7, 4($sp)
+	lw	$6, 5($sp)
+	lw	$13, 6($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.2
+	lw	$13, 6($sp)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	j	L.5
+L.4:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	addu	$12, $0, $6
+	addui	$6, $12, 1
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.5:
+	lw	$13, 6($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	sw	$13, 6($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+L.2:
+	lw	$1, 4($sp)
+L.1:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
@@ -0,0 +1,99 @@
+.global	memmove
+.text
+memmove:
+	subui	$sp, $sp, 11
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$7, 12($sp)
+	lw	$6, 11($sp)
+	addu	$13, $0, $7
+	addu	$12, $0, $6
+	sequ	$13, $13, $12
+	bnez	$13, L.4
+	lw	$13, 13($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.2
+L.4:
+	lw	$1, 11($sp)
+	j	L.1
+L.2:
+	addu	$13, $0, $6
+	sw	$13, 10($sp)
+	addu	$12, $0, $7
+	sleu	$13, $13, $12
+	bnez	$13, L.5
+	lw	$13, 10($sp)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$12, 13($sp)
+	addu	$12, $0, $12
+	sge	$13, $13, $12
+	bnez	$13, L.5
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	addu	$5, $0, $13
+	j	L.10
+L.7:
+	addu	$13, $5, $6
+	addu	$12, $5, $7
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.8:
+	subi	$5, $5, 1
+L.10:
+	sge	$13, $5, $0
+	bnez	$13, L.7
+	lw	$1, 11($sp)
+	j	L.1
+L.5:
+	addu	$13, $0, $7
+	sw	$13, 9($sp)
+	addu	$12, $0, $6
+	sleu	$13, $13, $12
+	bnez	$13, L.11
+	lw	$13, 9($sp)
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$12, 13($sp)
+	addu	$12, $0, $12
+	sge	$13, $13, $12
+	bnez	$13, L.11
+	addu	$5, $0, $0
+	j	L.16
+L.13:
+	addu	$13, $5, $6
+	addu	$12, $5, $7
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.14:
+	addui	$13, $0, 1
+	addu	$5, $5, $13
+L.16:
+	lw	$13, 13($sp)
+	sltu	$13, $5, $13
+	bnez	$13, L.13
+	lw	$1, 11($sp)
+	j	L.1
+L.11:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$1, 11($sp)
+L.1:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
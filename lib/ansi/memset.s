@@ -0,0 +1,31 @@
+.global	memset
+.text
+memset:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 5($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.2
+	lw	$7, 3($sp)
+L.4:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$12, 4($sp)
+	sw	$12, 0($13)
+L.5:
+	lw	$13, 5($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	sw	$13, 5($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+L.2:
+	lw	$1, 3($sp)
+L.1:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
@@ -0,0 +1,194 @@
+L.4:
+	.word	0x0
+.global	putenv
+.text
+putenv:
+	subui	$sp, $sp, 11
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.5
+	addu	$1, $0, $0
+	j	L.3
+L.5:
+	jal	get_environ
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 61
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.7
+	sw	$0, 0($6)
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.9
+	j	L.12
+L.11:
+	lw	$5, 11($sp)
+L.14:
+L.15:
+	addu	$13, $0, $5
+	sw	$13, 10($sp)
+	lw	$12, 0($13)
+	seq	$13, $12, $0
+	bnez	$13, L.17
+	lw	$13, 10($sp)
+	addui	$5, $13, 1
+	addu	$13, $0, $4
+	addui	$4, $13, 1
+	lw	$12, 10($sp)
+	lw	$12, 0($12)
+	lw	$13, 0($13)
+	seq	$13, $12, $13
+	bnez	$13, L.14
+L.17:
+	lw	$13, 0($5)
+	sne	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, 0($4)
+	seqi	$13, $13, 61
+	bnez	$13, L.18
+L.20:
+	addui	$7, $7, 1
+	j	L.19
+L.18:
+	addui	$13, $0, 61
+	sw	$13, 0($6)
+	lw	$13, 11($sp)
+	sw	$13, 0($7)
+	addu	$1, $0, $0
+	j	L.3
+L.19:
+L.12:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	addu	$4, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.11
+L.9:
+	addui	$13, $0, 61
+	sw	$13, 0($6)
+	lw	$7, _environ($0)
+L.7:
+	lw	$13, L.4($0)
+	sne	$13, $13, $0
+	bnez	$13, L.21
+	addu	$4, $0, $0
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.23
+L.25:
+	addi	$4, $4, 1
+L.26:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.25
+L.23:
+	addui	$13, $0, 10
+	addui	$12, $0, 1
+	div	$11, $4, $13
+	mult	$13, $13, $11
+	addi	$13, $13, 10
+	addu	$13, $0, $13
+	multu	$13, $12, $13
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.28
+	addui	$1, $0, 1
+	j	L.3
+L.28:
+	sw	$4, L.4($0)
+	lw	$5, _environ($0)
+	sw	$7, _environ($0)
+L.30:
+L.31:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	addu	$12, $0, $5
+	addui	$5, $12, 1
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+	addu	$13, $0, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.30
+	lw	$7, _environ($0)
+	j	L.22
+L.21:
+	lw	$13, L.4($0)
+	remi	$13, $13, 10
+	sne	$13, $13, $0
+	bnez	$13, L.33
+	lw	$13, _environ($0)
+	sw	$13, 0($sp)
+	addui	$13, $0, 10
+	addui	$12, $0, 1
+	lw	$11, L.4($0)
+	div	$11, $11, $13
+	mult	$13, $13, $11
+	addi	$13, $13, 10
+	addu	$13, $0, $13
+	multu	$13, $12, $13
+	sw	$13, 1($sp)
+	jal	realloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.35
+	addui	$1, $0, 1
+	j	L.3
+L.35:
+	sw	$7, _environ($0)
+L.33:
+L.22:
+	lw	$13, L.4($0)
+	subi	$13, $13, 1
+	addu	$13, $13, $7
+	lw	$12, 11($sp)
+	sw	$12, 0($13)
+	lw	$13, L.4($0)
+	addu	$13, $13, $7
+	sw	$0, 0($13)
+	lw	$13, L.4($0)
+	addi	$13, $13, 1
+	sw	$13, L.4($0)
+	addu	$1, $0, $0
+L.3:
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
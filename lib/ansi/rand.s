@@ -0,0 +1,40 @@
+next:
+	.word	0x1
+.global	rand
+.text
+rand:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lhi	$13, 0x41c6
+	ori	$13, $13, 0x4e6d
+	lw	$12, next($0)
+	multu	$13, $13, $12
+	addui	$12, $0, 12345
+	addu	$13, $13, $12
+	sw	$13, next($0)
+	lw	$13, next($0)
+	srli	$13, $13, 16
+	addui	$12, $0, 32767
+	and	$13, $13, $12
+	addu	$1, $0, $13
+L.3:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	srand
+srand:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$13, next($0)
+L.4:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
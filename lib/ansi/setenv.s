@@ -0,0 +1,84 @@
+.global	setenv
+.text
+setenv:
+	subui	$sp, $sp, 8
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.4
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	getenv
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.4
+	addu	$1, $0, $0
+	j	L.3
+L.4:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	lw	$12, 9($sp)
+	sw	$12, 0($sp)
+	jal	strlen
+	addu	$12, $0, $1
+	addu	$13, $13, $12
+	addui	$12, $0, 2
+	addu	$13, $13, $12
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.6
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.3
+L.6:
+	sw	$7, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $6
+	sw	$13, 2($sp)
+	jal	strlcpy
+	sw	$7, 0($sp)
+	la	$13, L.8
+	sw	$13, 1($sp)
+	addu	$13, $0, $6
+	sw	$13, 2($sp)
+	jal	strlcat
+	sw	$7, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $6
+	sw	$13, 2($sp)
+	jal	strlcat
+	sw	$7, 0($sp)
+	jal	putenv
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.3:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.8:
+	.asciiz	"="
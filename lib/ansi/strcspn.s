@@ -0,0 +1,40 @@
+.global	strcspn
+.text
+strcspn:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addu	$7, $0, $0
+	j	L.3
+L.2:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.5
+	addu	$1, $0, $7
+	j	L.1
+L.5:
+	lw	$13, 5($sp)
+	addui	$13, $13, 1
+	sw	$13, 5($sp)
+	addui	$13, $0, 1
+	addu	$7, $7, $13
+L.3:
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.2
+	addu	$1, $0, $7
+L.1:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
@@ -0,0 +1,44 @@
+.global	strdup
+.text
+strdup:
+	subui	$sp, $sp, 8
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addui	$12, $0, 1
+	addu	$6, $13, $12
+	sw	$6, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+	addu	$1, $0, $0
+	j	L.3
+L.4:
+	sw	$7, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	strlcpy
+	addu	$1, $0, $7
+L.3:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,25 @@
+.global	strerror
+.text
+strerror:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 14
+	sw	$13, 0($sp)
+	addui	$13, $0, 16
+	sw	$13, 1($sp)
+	la	$13, estr
+	sw	$13, 2($sp)
+	lw	$13, 6($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	la	$1, estr
+L.1:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.bss
+.global	estr
+estr:
+	.space	16
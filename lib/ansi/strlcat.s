@@ -0,0 +1,69 @@
+.global	strlcat
+.text
+strlcat:
+	subui	$sp, $sp, 5
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$7, 5($sp)
+L.2:
+L.3:
+	lw	$13, 5($sp)
+	addui	$12, $13, 1
+	sw	$12, 5($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.2
+	lw	$13, 5($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	addu	$13, $13, $12
+	sw	$13, 5($sp)
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	addu	$12, $0, $7
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	sw	$13, 4($sp)
+	lw	$13, 7($sp)
+	lw	$12, 4($sp)
+	subu	$13, $13, $12
+	sw	$13, 7($sp)
+	lw	$13, 7($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.8
+	addu	$1, $0, $7
+	j	L.1
+L.7:
+	lw	$13, 5($sp)
+	addui	$12, $13, 1
+	sw	$12, 5($sp)
+	lw	$12, 6($sp)
+	addui	$11, $12, 1
+	sw	$11, 6($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.8:
+	lw	$13, 6($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 7($sp)
+	addui	$12, $0, 1
+	subu	$12, $13, $12
+	sw	$12, 7($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.7
+L.10:
+	lw	$13, 5($sp)
+	sw	$0, 0($13)
+	addu	$1, $0, $7
+L.1:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
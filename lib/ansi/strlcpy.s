@@ -0,0 +1,44 @@
+.global	strlcpy
+.text
+strlcpy:
+	subui	$sp, $sp, 4
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	sw	$13, 3($sp)
+	lw	$13, 6($sp)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	sw	$13, 6($sp)
+	j	L.3
+L.2:
+	lw	$13, 4($sp)
+	addui	$12, $13, 1
+	sw	$12, 4($sp)
+	lw	$12, 5($sp)
+	addui	$11, $12, 1
+	sw	$11, 5($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.3:
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.5
+	lw	$13, 6($sp)
+	addui	$12, $0, 1
+	subu	$12, $13, $12
+	sw	$12, 6($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.2
+L.5:
+	lw	$13, 4($sp)
+	sw	$0, 0($13)
+	lw	$1, 3($sp)
+L.1:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
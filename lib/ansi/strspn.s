@@ -0,0 +1,41 @@
+.global	strspn
+.text
+strspn:
+	subui	$sp, $sp, 7
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addu	$7, $0, $0
+	j	L.3
+L.2:
+	addui	$13, $0, 1
+	addu	$7, $7, $13
+L.3:
+	lw	$13, 7($sp)
+	sw	$13, 6($sp)
+	lw	$12, 0($13)
+	seq	$13, $12, $0
+	bnez	$13, L.5
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	addui	$13, $13, 1
+	sw	$13, 7($sp)
+	lw	$13, 6($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.2
+L.5:
+	addu	$1, $0, $7
+L.1:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
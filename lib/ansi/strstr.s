@@ -0,0 +1,93 @@
+.global	compare
+.text
+compare:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	j	L.3
+L.2:
+	lw	$13, 4($sp)
+	lw	$13, 0($13)
+	lw	$12, 5($sp)
+	lw	$12, 0($12)
+	seq	$13, $13, $12
+	bnez	$13, L.5
+	addu	$1, $0, $0
+	j	L.1
+L.5:
+	lw	$13, 4($sp)
+	addui	$13, $13, 1
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	addui	$13, $13, 1
+	sw	$13, 5($sp)
+L.3:
+	addu	$13, $0, $0
+	sw	$13, 3($sp)
+	lw	$12, 4($sp)
+	lw	$12, 0($12)
+	seq	$13, $12, $13
+	bnez	$13, L.7
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	lw	$12, 3($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.2
+L.7:
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.9
+	addui	$7, $0, 1
+	j	L.10
+L.9:
+	addu	$7, $0, $0
+L.10:
+	addu	$1, $0, $7
+L.1:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	strstr
+strstr:
+	subui	$sp, $sp, 7
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$7, 7($sp)
+	lw	$6, 8($sp)
+	j	L.13
+L.12:
+	lw	$13, 0($7)
+	lw	$12, 0($6)
+	sne	$13, $13, $12
+	bnez	$13, L.15
+	sw	$7, 0($sp)
+	sw	$6, 1($sp)
+	jal	compare
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.15
+	addu	$13, $0, $7
+	addu	$1, $0, $13
+	j	L.11
+L.15:
+	addui	$7, $7, 1
+L.13:
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.12
+	addu	$1, $0, $0
+L.11:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
@@ -0,0 +1,116 @@
+.global	_ctx_end
+.text
+_ctx_end:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 20($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+L.4:
+	lw	$13, 5($sp)
+	lw	$13, 20($13)
+	sw	$13, 0($sp)
+	jal	setcontext
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.3:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	makecontext
+makecontext:
+	subui	$sp, $sp, 10
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$13, $sp, 13
+	sw	$13, 9($sp)
+	lw	$13, 10($sp)
+	sw	$13, 8($sp)
+	addu	$12, $0, $0
+	addu	$11, $0, $13
+	sequ	$13, $11, $12
+	bnez	$13, L.11
+	lw	$13, 8($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $12
+	bnez	$13, L.11
+	lw	$13, 8($sp)
+	lw	$13, 18($13)
+	addui	$12, $0, 50
+	sgeu	$13, $13, $12
+	bnez	$13, L.8
+L.11:
+	j	L.6
+L.8:
+	lw	$13, 10($sp)
+	la	$12, _ctx_start
+	sw	$12, 15($13)
+	lw	$13, 10($sp)
+	la	$12, _ctx_end
+	addu	$12, $0, $12
+	sw	$12, 7($13)
+	lw	$13, 10($sp)
+	lw	$12, 18($13)
+	lw	$11, 16($13)
+	addu	$12, $12, $11
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$7, $12, $11
+	lw	$12, 12($sp)
+	addi	$12, $12, 3
+	subu	$7, $7, $12
+	sw	$7, 13($13)
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$12, 11($sp)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$12, 12($sp)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	sw	$7, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	memcpy
+	lw	$13, 12($sp)
+	addu	$7, $13, $7
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sw	$13, 0($7)
+L.6:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,131 @@
+.global	winix_receive
+.text
+winix_receive:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x2
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.5:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	winix_send
+winix_send:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+L.7:
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$0, 0($13)
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x1
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.10
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	subu	$12, $0, $7
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.6
+L.10:
+L.8:
+	addu	$1, $0, $7
+L.6:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	winix_sendrec
+winix_sendrec:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+L.13:
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$0, 0($13)
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x3
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.16
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	subu	$12, $0, $7
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.12
+L.16:
+L.14:
+	addu	$1, $0, $7
+L.12:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
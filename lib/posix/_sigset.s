@@ -0,0 +1,129 @@
+.global	sigaddset
+.text
+sigaddset:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 21
+	sleu	$13, $13, $12
+	bnez	$13, L.2
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.1
+L.2:
+	lw	$13, 4($sp)
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	lw	$10, 5($sp)
+	sll	$11, $11, $10
+	or	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.1:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	sigdelset
+sigdelset:
+	subui	$sp, $sp, 4
+	sw	$10, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 21
+	sleu	$13, $13, $12
+	bnez	$13, L.5
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.4
+L.5:
+	lw	$13, 4($sp)
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	lw	$10, 5($sp)
+	sll	$11, $11, $10
+	subu	$11, $0, $11
+	subui	$11, $11, 1
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.4:
+	lw	$10, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	sigemptyset
+sigemptyset:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$0, 0($13)
+	addu	$1, $0, $0
+L.7:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	sigfillset
+sigfillset:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lhi	$12, 0x3f
+	ori	$12, $12, 0xffff
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.8:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	sigismember
+sigismember:
+	subui	$sp, $sp, 3
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 4($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 21
+	sleu	$13, $13, $12
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.9
+L.10:
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	addui	$12, $0, 1
+	lw	$11, 4($sp)
+	sll	$12, $12, $11
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.12
+	addui	$1, $0, 1
+	j	L.9
+L.12:
+	addu	$1, $0, $0
+L.9:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,145 @@
+.global	opendir
+.text
+opendir:
+	subui	$sp, $sp, 7
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.4
+	addu	$1, $0, $0
+	j	L.3
+L.4:
+	addui	$13, $0, 314
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.6
+	addu	$1, $0, $0
+	j	L.3
+L.6:
+	sw	$6, 0($7)
+	sw	$0, 1($7)
+	sw	$0, 2($7)
+	addu	$1, $0, $7
+L.3:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	readdir
+readdir:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	seq	$13, $13, $0
+	bnez	$13, L.9
+	lw	$13, 9($sp)
+	lw	$12, 1($13)
+	lw	$13, 2($13)
+	sge	$13, $12, $13
+	bnez	$13, L.11
+	lw	$13, 9($sp)
+	addui	$13, $13, 1
+	lw	$12, 0($13)
+	addi	$11, $12, 1
+	sw	$11, 0($13)
+	addui	$13, $0, 31
+	mult	$13, $13, $12
+	lw	$12, 9($sp)
+	addui	$12, $12, 4
+	addu	$1, $13, $12
+	j	L.8
+L.11:
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	sgei	$13, $13, 10
+	bnez	$13, L.13
+	addu	$1, $0, $0
+	j	L.8
+L.13:
+L.9:
+	addui	$13, $0, 38
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	lw	$12, 0($13)
+	sw	$12, 1($sp)
+	addui	$13, $13, 4
+	sw	$13, 2($sp)
+	addui	$13, $0, 10
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sgt	$13, $7, $0
+	bnez	$13, L.15
+	addu	$1, $0, $0
+	j	L.8
+L.15:
+	addui	$13, $0, 1
+	lw	$12, 9($sp)
+	sw	$13, 1($12)
+	lw	$13, 9($sp)
+	addu	$12, $0, $7
+	addui	$11, $0, 31
+	divu	$12, $12, $11
+	addu	$12, $0, $12
+	sw	$12, 2($13)
+	lw	$13, 9($sp)
+	addui	$1, $13, 4
+L.8:
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	closedir
+closedir:
+	subui	$sp, $sp, 5
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	free
+	lw	$1, 4($sp)
+L.17:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,37 @@
+.global	basename
+.text
+basename:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$13, 1($sp)
+	addu	$7, $0, $0
+	lw	$13, 3($sp)
+	sw	$13, 2($sp)
+	j	L.3
+L.2:
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 47
+	bnez	$13, L.5
+	lw	$7, 3($sp)
+L.5:
+	lw	$13, 3($sp)
+	addui	$13, $13, 1
+	sw	$13, 3($sp)
+L.3:
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.2
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.7
+	addui	$13, $7, 1
+	sw	$13, 2($sp)
+L.7:
+	lw	$1, 2($sp)
+L.1:
+	lw	$7, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
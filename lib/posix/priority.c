@@ -0,0 +1,40 @@
+#include <unistd.h>
+#include <sched.h>
+#include <errno.h>
+#include <sys/resource.h>
+
+/**
+ * The kernel returns the nice value offset by NZERO, so that
+ * a negative nice value is not taken for an error
+ */
+int getpriority(int which, int who){
+    int ret = wramp_syscall(GETPRIORITY, which, who);
+    if(ret < 0)
+        return -1;
+    return ret - NZERO;
+}
+
+int nice(int inc){
+    int prio;
+
+    errno = 0;
+    prio = getpriority(PRIO_PROCESS, 0);
+    if(prio == -1 && errno)
+        return -1;
+    prio += inc;
+    if(prio < -NZERO)
+        prio = -NZERO;
+    if(prio > NZERO - 1)
+        prio = NZERO - 1;
+    if(setpriority(PRIO_PROCESS, 0, prio) < 0)
+        return -1;
+    return prio;
+}
+
+int sched_setscheduler(pid_t pid, int policy, const struct sched_param *param){
+    if(param && param->sched_priority != 0){
+        errno = EINVAL;
+        return -1;
+    }
+    return wramp_syscall(SCHED_SETSCHEDULER, pid, policy);
+}
@@ -0,0 +1,154 @@
+.global	getpriority
+.text
+getpriority:
+	subui	$sp, $sp, 6
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 59
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.2
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.1
+L.2:
+	subi	$1, $7, 20
+L.1:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	nice
+nice:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$0, 0($13)
+	addu	$13, $0, $0
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	jal	getpriority
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sne	$13, $7, $13
+	bnez	$13, L.5
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	sequ	$13, $13, $0
+	bnez	$13, L.5
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.4
+L.5:
+	lw	$13, 8($sp)
+	add	$7, $7, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffec
+	sge	$13, $7, $13
+	bnez	$13, L.7
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffec
+L.7:
+	slei	$13, $7, 19
+	bnez	$13, L.9
+	addui	$7, $0, 19
+L.9:
+	addui	$13, $0, 58
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sge	$13, $13, $0
+	bnez	$13, L.11
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.4
+L.11:
+	addu	$1, $0, $7
+L.4:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	sched_setscheduler
+sched_setscheduler:
+	subui	$sp, $sp, 7
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 9($sp)
+	sw	$13, 6($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.14
+	lw	$13, 6($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.14
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	addui	$12, $0, 22
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.13
+L.14:
+	addui	$13, $0, 60
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.13:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
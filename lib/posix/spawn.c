@@ -0,0 +1,111 @@
+#include <spawn.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+/**
+ * The child is built by the kernel straight from the path, the caller's
+ * image is never copied. File actions and attributes are passed by value
+ * in one request, only the paths and string arrays are read from the caller
+ */
+int posix_spawn(pid_t *pid, const char *path,
+                const posix_spawn_file_actions_t *file_actions,
+                const posix_spawnattr_t *attrp,
+                char *const argv[], char *const envp[]){
+    struct spawn_request req;
+    int ret;
+
+    memset(&req, 0, sizeof(req));
+    req.path = path;
+    req.argv = argv;
+    req.envp = envp;
+    if(file_actions)
+        req.actions = *file_actions;
+    if(attrp)
+        req.attr = *attrp;
+
+    ret = wramp_syscall(SPAWN, &req);
+    if(ret < 0)
+        return errno;
+    if(pid)
+        *pid = ret;
+    return 0;
+}
+
+static int add_action(posix_spawn_file_actions_t *file_actions, int type, int fd,
+                        int newfd, const char *path, int oflag, mode_t mode){
+    struct spawn_action *action;
+    if(fd < 0 || newfd < 0)
+        return EBADF;
+    if(file_actions->nr_actions >= SPAWN_ACTIONS_MAX)
+        return ENOMEM;
+    action = &file_actions->actions[file_actions->nr_actions++];
+    action->type = type;
+    action->fd = fd;
+    action->newfd = newfd;
+    action->path = path;
+    action->flags = oflag;
+    action->mode = mode;
+    return 0;
+}
+
+int posix_spawn_file_actions_init(posix_spawn_file_actions_t *file_actions){
+    memset(file_actions, 0, sizeof(posix_spawn_file_actions_t));
+    return 0;
+}
+
+int posix_spawn_file_actions_destroy(posix_spawn_file_actions_t *file_actions){
+    file_actions->nr_actions = 0;
+    return 0;
+}
+
+int posix_spawn_file_actions_addopen(posix_spawn_file_actions_t *file_actions,
+                int fd, const char *path, int oflag, mode_t mode){
+    return add_action(file_actions, SPAWN_OPEN, fd, 0, path, oflag, mode);
+}
+
+int posix_spawn_file_actions_addclose(posix_spawn_file_actions_t *file_actions, int fd){
+    return add_action(file_actions, SPAWN_CLOSE, fd, 0, NULL, 0, 0);
+}
+
+int posix_spawn_file_actions_adddup2(posix_spawn_file_actions_t *file_actions, int fd, int newfd){
+    return add_action(file_actions, SPAWN_DUP2, fd, newfd, NULL, 0, 0);
+}
+
+int posix_spawnattr_init(posix_spawnattr_t *attr){
+    memset(attr, 0, sizeof(posix_spawnattr_t));
+    return 0;
+}
+
+int posix_spawnattr_destroy(posix_spawnattr_t *attr){
+    return 0;
+}
+
+int posix_spawnattr_setflags(posix_spawnattr_t *attr, short flags){
+    if(flags & ~(POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_TCSETPGROUP))
+        return EINVAL;
+    attr->flags = flags;
+    return 0;
+}
+
+int posix_spawnattr_setpgroup(posix_spawnattr_t *attr, pid_t pgroup){
+    attr->pgroup = pgroup;
+    return 0;
+}
+
+int posix_spawnattr_setsigdefault(posix_spawnattr_t *attr, const sigset_t *sigdefault){
+    attr->sigdefault = *sigdefault;
+    return 0;
+}
+
+int posix_spawnattr_setsigmask(posix_spawnattr_t *attr, const sigset_t *sigmask){
+    attr->sigmask = *sigmask;
+    return 0;
+}
+
+int posix_spawnattr_tcsetpgrp_np(posix_spawnattr_t *attr, int fd){
+    if(fd < 0)
+        return EBADF;
+    attr->tty_fd = fd;
+    return 0;
+}
@@ -0,0 +1,369 @@
+.global	posix_spawn
+.text
+posix_spawn:
+	subui	$sp, $sp, 68
+	sw	$8, 3($sp)
+	sw	$9, 4($sp)
+	sw	$10, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 57
+	sw	$13, 2($sp)
+	jal	memset
+	lw	$13, 69($sp)
+	sw	$13, 11($sp)
+	lw	$13, 72($sp)
+	sw	$13, 12($sp)
+	lw	$13, 73($sp)
+	sw	$13, 13($sp)
+	lw	$13, 70($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.8
+	addui	$13, $sp, 14
+	lw	$9, 70($sp)
+	addui	$9, $9, 49
+	addui	$11, $13, 49
+L.18:
+	subui	$9, $9, 1
+	subui	$11, $11, 1
+	lw	$8, 0($9)
+	sw	$8, 0($11)
+	sltu	$10, $13, $11
+	bnez	$10, L.18
+L.8:
+	lw	$13, 71($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.11
+	addui	$13, $sp, 63
+	lw	$9, 71($sp)
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	sw	$8, 4($13)
+L.11:
+	addui	$13, $0, 57
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+	lw	$13, 10($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.14
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	addu	$1, $0, $13
+	j	L.5
+L.14:
+	lw	$13, 68($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.16
+	lw	$13, 68($sp)
+	lw	$12, 10($sp)
+	sw	$12, 0($13)
+L.16:
+	addu	$1, $0, $0
+L.5:
+	lw	$8, 3($sp)
+	lw	$9, 4($sp)
+	lw	$10, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 68
+	jr	$ra
+add_action:
+	subui	$sp, $sp, 5
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	addu	$13, $0, $0
+	sw	$13, 4($sp)
+	lw	$12, 7($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.22
+	lw	$13, 8($sp)
+	lw	$12, 4($sp)
+	sge	$13, $13, $12
+	bnez	$13, L.20
+L.22:
+	addui	$1, $0, 9
+	j	L.19
+L.20:
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	slti	$13, $13, 8
+	bnez	$13, L.23
+	addui	$1, $0, 12
+	j	L.19
+L.23:
+	lw	$13, 5($sp)
+	lw	$12, 0($13)
+	addi	$11, $12, 1
+	sw	$11, 0($13)
+	addui	$13, $0, 6
+	mult	$13, $13, $12
+	lw	$12, 5($sp)
+	addui	$12, $12, 1
+	addu	$7, $13, $12
+	lw	$13, 6($sp)
+	sw	$13, 0($7)
+	lw	$13, 7($sp)
+	sw	$13, 1($7)
+	lw	$13, 8($sp)
+	sw	$13, 2($7)
+	lw	$13, 9($sp)
+	sw	$13, 3($7)
+	lw	$13, 10($sp)
+	sw	$13, 4($7)
+	lw	$13, 11($sp)
+	sw	$13, 5($7)
+	addu	$1, $0, $0
+L.19:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	posix_spawn_file_actions_init
+posix_spawn_file_actions_init:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 49
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$1, $0, $0
+L.25:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	__spawn_actions_destroy
+__spawn_actions_destroy:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$0, 0($13)
+	addu	$1, $0, $0
+L.26:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	__spawn_actions_addopen
+__spawn_actions_addopen:
+	subui	$sp, $sp, 9
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	lw	$13, 11($sp)
+	sw	$13, 4($sp)
+	lw	$13, 12($sp)
+	sw	$13, 5($sp)
+	lw	$13, 13($sp)
+	sw	$13, 6($sp)
+	jal	add_action
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.27:
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	__spawn_actions_addclose
+__spawn_actions_addclose:
+	subui	$sp, $sp, 9
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	addu	$13, $0, $0
+	sw	$13, 3($sp)
+	sw	$0, 4($sp)
+	sw	$13, 5($sp)
+	sw	$0, 6($sp)
+	jal	add_action
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.28:
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	__spawn_actions_adddup2
+__spawn_actions_adddup2:
+	subui	$sp, $sp, 9
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	lw	$13, 11($sp)
+	sw	$13, 3($sp)
+	sw	$0, 4($sp)
+	sw	$0, 5($sp)
+	sw	$0, 6($sp)
+	jal	add_action
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.29:
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	posix_spawnattr_init
+posix_spawnattr_init:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 5
+	sw	$13, 2($sp)
+	jal	memset
+	addu	$1, $0, $0
+L.30:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	posix_spawnattr_destroy
+posix_spawnattr_destroy:
+	addu	$1, $0, $0
+L.31:
+	jr	$ra
+.global	posix_spawnattr_setflags
+posix_spawnattr_setflags:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfff0
+	and	$13, $13, $12
+	seq	$13, $13, $0
+	bnez	$13, L.33
+	addui	$1, $0, 22
+	j	L.32
+L.33:
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.32:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	posix_spawnattr_setpgroup
+posix_spawnattr_setpgroup:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	sw	$12, 1($13)
+	addu	$1, $0, $0
+L.35:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	posix_spawnattr_setsigdefault
+posix_spawnattr_setsigdefault:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	sw	$12, 2($13)
+	addu	$1, $0, $0
+L.36:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	posix_spawnattr_setsigmask
+posix_spawnattr_setsigmask:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	lw	$12, 0($12)
+	sw	$12, 3($13)
+	addu	$1, $0, $0
+L.37:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	posix_spawnattr_tcsetpgrp_np
+posix_spawnattr_tcsetpgrp_np:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.39
+	addui	$1, $0, 9
+	j	L.38
+L.39:
+	lw	$13, 2($sp)
+	lw	$12, 3($sp)
+	sw	$12, 4($13)
+	addu	$1, $0, $0
+L.38:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,26 @@
+.global	tcgetpgrp
+.text
+tcgetpgrp:
+	subui	$sp, $sp, 7
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 11
+	sw	$13, 2($sp)
+	addui	$13, $sp, 6
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	lw	$1, 6($sp)
+L.1:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
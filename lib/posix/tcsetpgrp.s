@@ -0,0 +1,27 @@
+.global	tcsetpgrp
+.text
+tcsetpgrp:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 12
+	sw	$13, 2($sp)
+	addui	$13, $sp, 7
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.1:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,43 @@
+.global	isatty
+.text
+isatty:
+	subui	$sp, $sp, 21
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$13, $0, 33
+	sw	$13, 0($sp)
+	lw	$13, 21($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 7
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 20($sp)
+	lw	$13, 20($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.2
+	lw	$13, 7($sp)
+	addui	$12, $0, 0xff00
+	and	$13, $13, $12
+	srli	$13, $13, 8
+	addui	$12, $0, 3
+	sneu	$13, $13, $12
+	bnez	$13, L.5
+	addui	$7, $0, 1
+	j	L.6
+L.5:
+	addu	$7, $0, $0
+L.6:
+	addu	$1, $0, $7
+	j	L.1
+L.2:
+	addu	$1, $0, $0
+L.1:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 21
+	jr	$ra
@@ -0,0 +1,193 @@
+.global	history_get_history_state
+.text
+history_get_history_state:
+	la	$1, history_state
+L.3:
+	jr	$ra
+.global	init_history
+init_history:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, history_state($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.5
+	j	L.4
+L.5:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	sw	$13, history_state($0)
+	sw	$0, history_state+1($0)
+	sw	$0, history_state+2($0)
+	addui	$13, $0, 10
+	sw	$13, history_state+3($0)
+	sw	$0, history_state+4($0)
+L.4:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	add_history
+add_history:
+	subui	$sp, $sp, 6
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	jal	init_history
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	strdup
+	addu	$13, $0, $1
+	sw	$13, 0($7)
+	sw	$0, 1($7)
+	lw	$13, history_state+2($0)
+	lw	$12, history_state+3($0)
+	slt	$13, $13, $12
+	bnez	$13, L.12
+	lw	$13, history_state+3($0)
+	slli	$13, $13, 1
+	sw	$13, history_state+3($0)
+	lw	$13, history_state($0)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	lw	$12, history_state+3($0)
+	addu	$12, $0, $12
+	multu	$13, $13, $12
+	sw	$13, 1($sp)
+	jal	realloc
+	addu	$13, $0, $1
+	sw	$13, history_state($0)
+L.12:
+	lw	$13, history_state+2($0)
+	lw	$12, history_state($0)
+	addu	$13, $13, $12
+	sw	$7, 0($13)
+	lw	$13, history_state+1($0)
+	addi	$13, $13, 1
+	sw	$13, history_state+1($0)
+	lw	$13, history_state+2($0)
+	addi	$13, $13, 1
+	sw	$13, history_state+2($0)
+L.11:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	history_get
+history_get:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	sw	$13, 2($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.25
+	lw	$13, history_state+2($0)
+	lw	$12, 2($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.22
+L.25:
+	addu	$1, $0, $0
+	j	L.21
+L.22:
+	lw	$13, 3($sp)
+	lw	$12, history_state($0)
+	addu	$13, $13, $12
+	lw	$1, 0($13)
+L.21:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	previous_history
+previous_history:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, history_state+1($0)
+	sgt	$13, $13, $0
+	bnez	$13, L.27
+	addu	$1, $0, $0
+	j	L.26
+L.27:
+	lw	$13, history_state+1($0)
+	subi	$13, $13, 1
+	sw	$13, history_state+1($0)
+	lw	$13, history_state+1($0)
+	lw	$12, history_state($0)
+	addu	$13, $13, $12
+	lw	$1, 0($13)
+L.26:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	next_history
+next_history:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, history_state+1($0)
+	lw	$12, history_state+2($0)
+	subi	$12, $12, 1
+	slt	$13, $13, $12
+	bnez	$13, L.33
+	addu	$1, $0, $0
+	j	L.32
+L.33:
+	lw	$13, history_state+1($0)
+	addi	$13, $13, 1
+	sw	$13, history_state+1($0)
+	lw	$13, history_state+1($0)
+	lw	$12, history_state($0)
+	addu	$13, $13, $12
+	lw	$1, 0($13)
+L.32:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	current_history
+current_history:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, history_state+1($0)
+	slt	$13, $13, $0
+	bnez	$13, L.45
+	lw	$13, history_state+1($0)
+	lw	$12, history_state+2($0)
+	slt	$13, $13, $12
+	bnez	$13, L.40
+L.45:
+	addu	$1, $0, $0
+	j	L.39
+L.40:
+	lw	$13, history_state+1($0)
+	lw	$12, history_state($0)
+	addu	$13, $13, $12
+	lw	$1, 0($13)
+L.39:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.bss
+history_state:
+	.space	5
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,462 @@
+rl_initied:
+	.word	0x0
+.global	rl_termios
+rl_termios:
+	.word	_rl_termios
+history_offset:
+	.word	0x0
+.global	init_readline
+.text
+init_readline:
+	subui	$sp, $sp, 8
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	lw	$13, rl_termios($0)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	lw	$13, rl_termios($0)
+	addui	$13, $13, 3
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfff5
+	addu	$11, $0, $11
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, rl_termios($0)
+	addui	$12, $0, 1
+	sw	$12, 11($13)
+	lw	$13, rl_termios($0)
+	sw	$0, 10($13)
+	addui	$13, $0, 1
+	sw	$13, rl_initied($0)
+L.3:
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	rl_backspace
+rl_backspace:
+	subui	$sp, $sp, 7
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 8
+	sw	$13, 6($sp)
+	lw	$13, rl_point($0)
+	subi	$13, $13, 1
+	sw	$13, rl_point($0)
+	lw	$13, rl_end($0)
+	subi	$13, $13, 1
+	sw	$13, rl_end($0)
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, rl_outstream($0)
+	sw	$13, 3($sp)
+	jal	fwrite
+L.4:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	rl_clear
+rl_clear:
+	subui	$sp, $sp, 2
+	sw	$13, 0($sp)
+	sw	$ra, 1($sp)
+	j	L.7
+L.6:
+	jal	rl_backspace
+L.7:
+	lw	$13, rl_end($0)
+	sgt	$13, $13, $0
+	bnez	$13, L.6
+L.5:
+	lw	$13, 0($sp)
+	lw	$ra, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+navigate_history:
+	subui	$sp, $sp, 11
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	jal	rl_clear
+	addu	$13, $0, $0
+	sw	$13, rl_point($0)
+	sw	$13, rl_end($0)
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	la	$12, next_history
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.10
+	lw	$13, history_offset($0)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.10
+	jal	current_history
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sw	$0, history_offset($0)
+	j	L.11
+L.10:
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	la	$12, previous_history
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.12
+	lw	$13, history_offset($0)
+	snei	$13, $13, 1
+	bnez	$13, L.12
+	jal	current_history
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sw	$0, history_offset($0)
+	j	L.13
+L.12:
+	lw	$13, 11($sp)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+L.13:
+L.11:
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.14
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	la	$12, previous_history
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.17
+	lhi	$4, 0xffff
+	ori	$4, $4, 0xffff
+	j	L.18
+L.17:
+	addui	$4, $0, 1
+L.18:
+	sw	$4, history_offset($0)
+	j	L.9
+L.14:
+	lw	$6, 0($5)
+	sw	$6, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $0, 1
+	subu	$13, $7, $13
+	addu	$13, $13, $6
+	lw	$13, 0($13)
+	snei	$13, $13, 10
+	bnez	$13, L.19
+	addui	$13, $0, 1
+	subu	$13, $7, $13
+	addu	$7, $0, $13
+	addu	$13, $13, $6
+	sw	$0, 0($13)
+L.19:
+	sw	$6, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, rl_outstream($0)
+	sw	$13, 3($sp)
+	jal	fwrite
+	lw	$13, rl_line_buffer($0)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $0, 128
+	sw	$13, 2($sp)
+	jal	strlcpy
+	addu	$13, $0, $7
+	sw	$13, rl_end($0)
+	sw	$13, rl_point($0)
+L.9:
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	reset_history_offset
+reset_history_offset:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	jal	history_get_history_state
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 2($7)
+	sw	$13, 1($7)
+L.21:
+	lw	$7, 0($sp)
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	rl_getline
+rl_getline:
+	subui	$sp, $sp, 11
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, 10($sp)
+	addu	$13, $0, $0
+	sw	$13, rl_point($0)
+	sw	$13, rl_end($0)
+	sw	$13, rl_done($0)
+	sw	$13, rl_eof_found($0)
+	addui	$13, $0, 128
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	sw	$13, rl_line_buffer($0)
+	j	L.24
+L.23:
+	addui	$13, $sp, 10
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, rl_instream($0)
+	sw	$13, 3($sp)
+	jal	fread
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sne	$13, $7, $13
+	bnez	$13, L.26
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	addui	$12, $0, 4
+	sneu	$13, $13, $12
+	bnez	$13, L.28
+	j	L.24
+L.28:
+	addu	$1, $0, $7
+	j	L.22
+L.26:
+	lw	$13, 10($sp)
+	lw	$12, rl_termios($0)
+	lw	$12, 9($12)
+	addu	$12, $0, $12
+	sne	$13, $13, $12
+	bnez	$13, L.30
+	addui	$13, $0, 1
+	sw	$13, rl_eof_found($0)
+	j	L.25
+L.30:
+	lw	$13, 10($sp)
+	lw	$12, rl_termios($0)
+	lw	$12, 7($12)
+	addu	$12, $0, $12
+	sne	$13, $13, $12
+	bnez	$13, L.32
+	lw	$13, rl_point($0)
+	sle	$13, $13, $0
+	bnez	$13, L.24
+	jal	rl_backspace
+	j	L.24
+L.32:
+	lw	$13, 10($sp)
+	lw	$12, rl_termios($0)
+	lw	$12, 8($12)
+	addu	$12, $0, $12
+	sne	$13, $13, $12
+	bnez	$13, L.36
+	jal	rl_clear
+	j	L.24
+L.36:
+	lw	$13, 10($sp)
+	snei	$13, $13, 16
+	bnez	$13, L.38
+	la	$13, previous_history
+	sw	$13, 0($sp)
+	jal	navigate_history
+	j	L.24
+L.38:
+	lw	$13, 10($sp)
+	snei	$13, $13, 14
+	bnez	$13, L.40
+	la	$13, next_history
+	sw	$13, 0($sp)
+	jal	navigate_history
+	j	L.24
+L.40:
+	lw	$13, rl_end($0)
+	slti	$13, $13, 128
+	bnez	$13, L.42
+	j	L.25
+L.42:
+	lw	$13, 10($sp)
+	snei	$13, $13, 13
+	bnez	$13, L.44
+	addui	$13, $0, 10
+	sw	$13, 10($sp)
+L.44:
+	lw	$13, 10($sp)
+	sw	$13, 9($sp)
+	subi	$12, $13, 32
+	addu	$12, $0, $12
+	addui	$11, $0, 95
+	sltu	$13, $12, $11
+	bnez	$13, L.48
+	lw	$13, 9($sp)
+	snei	$13, $13, 10
+	bnez	$13, L.46
+L.48:
+	lw	$13, rl_point($0)
+	addi	$13, $13, 1
+	sw	$13, rl_point($0)
+	lw	$13, rl_end($0)
+	addi	$12, $13, 1
+	sw	$12, rl_end($0)
+	lw	$12, rl_line_buffer($0)
+	addu	$13, $13, $12
+	lw	$12, 10($sp)
+	sw	$12, 0($13)
+	addui	$13, $sp, 10
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, rl_outstream($0)
+	sw	$13, 3($sp)
+	jal	fwrite
+L.46:
+	lw	$13, 10($sp)
+	snei	$13, $13, 10
+	bnez	$13, L.49
+	j	L.25
+L.49:
+L.24:
+	j	L.23
+L.25:
+	jal	reset_history_offset
+	lw	$13, rl_end($0)
+	lw	$12, rl_line_buffer($0)
+	addu	$13, $13, $12
+	sw	$0, 0($13)
+	addu	$1, $0, $0
+L.22:
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	readline
+readline:
+	subui	$sp, $sp, 9
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, rl_initied($0)
+	sne	$13, $13, $0
+	bnez	$13, L.52
+	jal	init_readline
+L.52:
+	lw	$13, 9($sp)
+	sw	$13, rl_prompt($0)
+	lw	$13, rl_prompt($0)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	lw	$12, rl_prompt($0)
+	sw	$12, 0($sp)
+	addui	$12, $0, 1
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	la	$13, _stdout
+	sw	$13, 3($sp)
+	jal	fwrite
+	lw	$13, rl_initied($0)
+	seq	$13, $13, $0
+	bnez	$13, L.54
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	lw	$13, rl_termios($0)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+L.54:
+	jal	rl_getline
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	addu	$13, $0, $0
+	sw	$13, 7($sp)
+	lw	$12, rl_eof_found($0)
+	seq	$13, $12, $13
+	bnez	$13, L.59
+	lw	$13, rl_end($0)
+	lw	$12, 7($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.58
+L.59:
+	lw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.56
+L.58:
+	addu	$1, $0, $0
+	j	L.51
+L.56:
+	lw	$1, rl_line_buffer($0)
+L.51:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.bss
+.global	_rl_termios
+_rl_termios:
+	.space	39
+.extern	_environ 1
+.extern	errlist 40
+.extern	rl_outstream 1
+.extern	rl_instream 1
+.extern	rl_ttyset 39
+.extern	rl_eof_found 1
+.extern	rl_done 1
+.extern	rl_prompt 1
+.extern	rl_end 1
+.extern	rl_point 1
+.extern	rl_line_buffer 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
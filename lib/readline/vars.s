@@ -0,0 +1,29 @@
+.global	rl_line_buffer
+rl_line_buffer:
+	.word	0x0
+.global	rl_point
+rl_point:
+	.word	0x0
+.global	rl_end
+rl_end:
+	.word	0x0
+.global	rl_prompt
+rl_prompt:
+	.word	0x0
+.global	rl_done
+rl_done:
+	.word	0x0
+.global	rl_eof_found
+rl_eof_found:
+	.word	0x0
+.global	rl_instream
+rl_instream:
+	.word	_stdin
+.global	rl_outstream
+rl_outstream:
+	.word	_stdout
+.extern	rl_ttyset 39
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
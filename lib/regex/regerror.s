@@ -0,0 +1,32 @@
+.global	regerror
+.text
+regerror:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.3:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.5:
+	.asciiz	"regexp(3): %s\n"
@@ -0,0 +1,2165 @@
+.global	regcomp
+.text
+regcomp:
+	subui	$sp, $sp, 18
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 18($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+	la	$13, L.6
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.3
+L.4:
+	lw	$13, 18($sp)
+	sw	$13, 11($sp)
+	addui	$13, $0, 1
+	sw	$13, 12($sp)
+	sw	$0, 17($sp)
+	addui	$13, $0, 9
+	sw	$13, 14($sp)
+	addu	$13, $0, $0
+	sw	$13, 16($sp)
+	sw	$13, 15($sp)
+	addui	$13, $sp, 14
+	sw	$13, 13($sp)
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	addui	$13, $0, 123
+	sw	$13, 1($sp)
+	jal	regc
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	jal	reg
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.16
+	addu	$1, $0, $0
+	j	L.3
+L.16:
+	lw	$13, 17($sp)
+	slti	$13, $13, 32767
+	bnez	$13, L.18
+	la	$13, L.21
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.3
+L.18:
+	lw	$13, 17($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 25
+	addu	$13, $13, $12
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.23
+	la	$13, L.25
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.3
+L.23:
+	lw	$13, 18($sp)
+	sw	$13, 11($sp)
+	addui	$13, $0, 1
+	sw	$13, 12($sp)
+	addui	$13, $6, 24
+	sw	$13, 13($sp)
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	addui	$13, $0, 123
+	sw	$13, 1($sp)
+	jal	regc
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	jal	reg
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.28
+	addu	$1, $0, $0
+	j	L.3
+L.28:
+	sw	$0, 20($6)
+	sw	$0, 21($6)
+	sw	$0, 22($6)
+	sw	$0, 23($6)
+	addui	$7, $6, 25
+	sw	$7, 0($sp)
+	jal	regnext
+	addu	$13, $0, $1
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.30
+	addui	$7, $7, 3
+	lw	$13, 0($7)
+	snei	$13, $13, 8
+	bnez	$13, L.32
+	lw	$13, 3($7)
+	sw	$13, 20($6)
+	j	L.33
+L.32:
+	lw	$13, 0($7)
+	snei	$13, $13, 1
+	bnez	$13, L.34
+	addui	$13, $0, 1
+	sw	$13, 21($6)
+L.34:
+L.33:
+	lw	$13, 10($sp)
+	andi	$13, $13, 4
+	seq	$13, $13, $0
+	bnez	$13, L.36
+	sw	$0, 9($sp)
+	addu	$5, $0, $0
+	j	L.41
+L.38:
+	lw	$13, 0($7)
+	snei	$13, $13, 8
+	bnez	$13, L.42
+	addui	$13, $7, 3
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	sltu	$13, $13, $5
+	bnez	$13, L.42
+	addui	$13, $7, 3
+	sw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+L.42:
+L.39:
+	sw	$7, 0($sp)
+	jal	regnext
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.41:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.38
+	lw	$13, 9($sp)
+	sw	$13, 22($6)
+	addu	$13, $0, $5
+	sw	$13, 23($6)
+L.36:
+L.30:
+	addu	$1, $0, $6
+L.3:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 18
+	jr	$ra
+reg:
+	subui	$sp, $sp, 14
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addu	$4, $0, $0
+	lw	$13, 16($sp)
+	addui	$12, $0, 1
+	sw	$12, 0($13)
+	lw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.45
+	lw	$13, 14($sp)
+	lw	$13, 1($13)
+	slti	$13, $13, 10
+	bnez	$13, L.47
+	la	$13, L.49
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.44
+L.47:
+	lw	$13, 14($sp)
+	addui	$13, $13, 1
+	lw	$4, 0($13)
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	addi	$13, $4, 20
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+L.45:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 13
+	sw	$13, 1($sp)
+	jal	regbranch
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.50
+	addu	$1, $0, $0
+	j	L.44
+L.50:
+	lw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.52
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	jal	regtail
+	j	L.53
+L.52:
+	addu	$6, $0, $7
+L.53:
+	lw	$13, 16($sp)
+	lw	$12, 0($13)
+	lw	$11, 13($sp)
+	subu	$11, $0, $11
+	subui	$11, $11, 1
+	andi	$11, $11, 1
+	subu	$11, $0, $11
+	subui	$11, $11, 1
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 16($sp)
+	lw	$12, 0($13)
+	lw	$11, 13($sp)
+	andi	$11, $11, 4
+	or	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.55
+L.54:
+	lw	$13, 14($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 13
+	sw	$13, 1($sp)
+	jal	regbranch
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.57
+	addu	$1, $0, $0
+	j	L.44
+L.57:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	jal	regtail
+	lw	$13, 16($sp)
+	lw	$12, 0($13)
+	lw	$11, 13($sp)
+	subu	$11, $0, $11
+	subui	$11, $11, 1
+	andi	$11, $11, 1
+	subu	$11, $0, $11
+	subui	$11, $11, 1
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 16($sp)
+	lw	$12, 0($13)
+	lw	$11, 13($sp)
+	andi	$11, $11, 4
+	or	$12, $12, $11
+	sw	$12, 0($13)
+L.55:
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	seqi	$13, $13, 124
+	bnez	$13, L.54
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.60
+	addi	$3, $4, 30
+	j	L.61
+L.60:
+	addu	$3, $0, $0
+L.61:
+	sw	$3, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$5, 2($sp)
+	jal	regtail
+	addu	$7, $0, $6
+	j	L.65
+L.62:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	sw	$5, 2($sp)
+	jal	regoptail
+L.63:
+	sw	$7, 0($sp)
+	jal	regnext
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.65:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.62
+	lw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.66
+	lw	$13, 14($sp)
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$13, 0($12)
+	seqi	$13, $13, 41
+	bnez	$13, L.66
+	la	$13, L.68
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.44
+L.66:
+	addu	$13, $0, $0
+	sw	$13, 12($sp)
+	lw	$12, 15($sp)
+	sne	$13, $12, $13
+	bnez	$13, L.69
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	lw	$12, 12($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.69
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	snei	$13, $13, 41
+	bnez	$13, L.71
+	la	$13, L.73
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.44
+L.71:
+	la	$13, L.74
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.44
+L.69:
+	addu	$1, $0, $6
+L.44:
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+regbranch:
+	subui	$sp, $sp, 12
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	sw	$0, 11($sp)
+	lw	$13, 13($sp)
+	sw	$0, 0($13)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+	addu	$5, $0, $0
+	j	L.77
+L.76:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	jal	regpiece
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.79
+	addu	$1, $0, $0
+	j	L.75
+L.79:
+	lw	$13, 13($sp)
+	lw	$12, 0($13)
+	lw	$11, 11($sp)
+	andi	$11, $11, 1
+	or	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.81
+	lw	$13, 13($sp)
+	lw	$12, 0($13)
+	lw	$11, 11($sp)
+	andi	$11, $11, 4
+	or	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.82
+L.81:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	sw	$7, 2($sp)
+	jal	regtail
+L.82:
+	addu	$5, $0, $7
+L.77:
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.84
+	seqi	$13, $6, 124
+	bnez	$13, L.84
+	snei	$13, $6, 41
+	bnez	$13, L.76
+L.84:
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.85
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	jal	regnode
+L.85:
+	lw	$1, 10($sp)
+L.75:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+regpiece:
+	subui	$sp, $sp, 12
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	jal	regatom
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.88
+	addu	$1, $0, $0
+	j	L.87
+L.88:
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	lw	$7, 0($13)
+	seqi	$13, $7, 42
+	bnez	$13, L.90
+	seqi	$13, $7, 43
+	bnez	$13, L.90
+	seqi	$13, $7, 63
+	bnez	$13, L.90
+	lw	$13, 13($sp)
+	lw	$12, 11($sp)
+	sw	$12, 0($13)
+	addu	$1, $0, $6
+	j	L.87
+L.90:
+	lw	$13, 11($sp)
+	andi	$13, $13, 1
+	sne	$13, $13, $0
+	bnez	$13, L.92
+	seqi	$13, $7, 63
+	bnez	$13, L.92
+	la	$13, L.94
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.87
+L.92:
+	addui	$13, $0, 42
+	sw	$13, 9($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.97
+	seqi	$13, $7, 43
+	bnez	$13, L.98
+	lw	$13, 9($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.96
+L.100:
+	seqi	$13, $7, 63
+	bnez	$13, L.99
+	j	L.96
+L.97:
+	lw	$13, 13($sp)
+	addui	$12, $0, 4
+	sw	$12, 0($13)
+	j	L.96
+L.98:
+	lw	$13, 13($sp)
+	addui	$12, $0, 5
+	sw	$12, 0($13)
+	j	L.96
+L.99:
+	lw	$13, 13($sp)
+	sw	$0, 0($13)
+L.96:
+	snei	$13, $7, 42
+	bnez	$13, L.101
+	lw	$13, 11($sp)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.101
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 10
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	reginsert
+	j	L.102
+L.101:
+	snei	$13, $7, 42
+	bnez	$13, L.103
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	reginsert
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 7
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	sw	$6, 1($sp)
+	sw	$13, 2($sp)
+	jal	regoptail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$6, 2($sp)
+	jal	regoptail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	sw	$6, 1($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	sw	$6, 1($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+	j	L.104
+L.103:
+	snei	$13, $7, 43
+	bnez	$13, L.105
+	lw	$13, 11($sp)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.105
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	reginsert
+	j	L.106
+L.105:
+	snei	$13, $7, 43
+	bnez	$13, L.107
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 7
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	regtail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	lw	$12, 10($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	sw	$6, 1($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+	j	L.108
+L.107:
+	snei	$13, $7, 63
+	bnez	$13, L.109
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	reginsert
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 6
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	sw	$12, 0($sp)
+	sw	$6, 1($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	regoptail
+L.109:
+L.108:
+L.106:
+L.104:
+L.102:
+	lw	$13, 12($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	sw	$13, 8($sp)
+	seqi	$13, $13, 42
+	bnez	$13, L.114
+	lw	$13, 8($sp)
+	seqi	$13, $13, 43
+	bnez	$13, L.114
+	lw	$13, 8($sp)
+	snei	$13, $13, 63
+	bnez	$13, L.111
+L.114:
+	la	$13, L.115
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.87
+L.111:
+	addu	$1, $0, $6
+L.87:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+regatom:
+	subui	$sp, $sp, 19
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 20($sp)
+	sw	$0, 0($13)
+	lw	$13, 19($sp)
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$7, 0($12)
+	addui	$13, $0, 63
+	sw	$13, 16($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.153
+	lw	$13, 16($sp)
+	sgt	$13, $7, $13
+	bnez	$13, L.174
+L.173:
+	addu	$13, $0, $0
+	sw	$13, 15($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.151
+	lw	$13, 15($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.117
+L.175:
+	slti	$13, $7, 36
+	bnez	$13, L.117
+	sgti	$13, $7, 46
+	bnez	$13, L.117
+	lw	$13, L.176-36($7)
+	jr	$13
+.data
+L.176:
+	.word	L.121
+	.word	L.117
+	.word	L.117
+	.word	L.117
+	.word	L.148
+	.word	L.151
+	.word	L.153
+	.word	L.153
+	.word	L.117
+	.word	L.117
+	.word	L.122
+.text
+L.174:
+	addui	$13, $0, 91
+	sw	$13, 14($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.123
+	seqi	$13, $7, 92
+	bnez	$13, L.155
+	seqi	$13, $7, 94
+	bnez	$13, L.120
+	lw	$13, 14($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.117
+L.178:
+	seqi	$13, $7, 124
+	bnez	$13, L.151
+	j	L.117
+L.120:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+	j	L.118
+L.121:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+	j	L.118
+L.122:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+	lw	$13, 20($sp)
+	lw	$12, 0($13)
+	ori	$12, $12, 3
+	sw	$12, 0($13)
+	j	L.118
+L.123:
+	lw	$13, 19($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	snei	$13, $13, 94
+	bnez	$13, L.124
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 5
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+	lw	$13, 19($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+	j	L.125
+L.124:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+L.125:
+	lw	$13, 19($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	addu	$5, $0, $13
+	seqi	$13, $13, 93
+	bnez	$13, L.128
+	snei	$13, $5, 45
+	bnez	$13, L.130
+L.128:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	jal	regc
+	lw	$13, 19($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+	j	L.130
+L.129:
+	seqi	$13, $5, 45
+	bnez	$13, L.132
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	jal	regc
+	j	L.133
+L.132:
+	lw	$13, 19($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	addu	$5, $0, $13
+	seqi	$13, $13, 93
+	bnez	$13, L.136
+	sne	$13, $5, $0
+	bnez	$13, L.134
+L.136:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 45
+	sw	$13, 1($sp)
+	jal	regc
+	j	L.135
+L.134:
+	lw	$13, 19($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	addu	$6, $0, $13
+	addu	$13, $0, $5
+	addu	$4, $0, $13
+	sle	$13, $6, $4
+	bnez	$13, L.137
+	la	$13, L.139
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.116
+L.137:
+	addi	$6, $6, 1
+	j	L.143
+L.140:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	regc
+L.141:
+	addi	$6, $6, 1
+L.143:
+	sle	$13, $6, $4
+	bnez	$13, L.140
+	lw	$13, 19($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+L.135:
+L.133:
+L.130:
+	lw	$13, 19($sp)
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$13, 0($12)
+	addu	$5, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.144
+	snei	$13, $5, 93
+	bnez	$13, L.129
+L.144:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	regc
+	seqi	$13, $5, 93
+	bnez	$13, L.145
+	la	$13, L.147
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.116
+L.145:
+	lw	$13, 20($sp)
+	lw	$12, 0($13)
+	ori	$12, $12, 3
+	sw	$12, 0($13)
+	j	L.118
+L.148:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	addui	$13, $sp, 17
+	sw	$13, 2($sp)
+	jal	reg
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+	lw	$13, 18($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.149
+	addu	$1, $0, $0
+	j	L.116
+L.149:
+	lw	$13, 20($sp)
+	lw	$12, 0($13)
+	lw	$11, 17($sp)
+	andi	$11, $11, 5
+	or	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.118
+L.151:
+	la	$13, L.152
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.116
+L.153:
+	la	$13, L.154
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.116
+L.155:
+	lw	$13, 19($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.156
+	la	$13, L.158
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.116
+L.156:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$13, 0($12)
+	sw	$13, 1($sp)
+	jal	regc
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	regc
+	lw	$13, 20($sp)
+	lw	$12, 0($13)
+	ori	$12, $12, 3
+	sw	$12, 0($13)
+	j	L.118
+L.117:
+	lw	$13, 19($sp)
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 19($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	la	$13, L.159
+	sw	$13, 1($sp)
+	jal	strcspn
+	addu	$13, $0, $1
+	sw	$13, 13($sp)
+	lw	$13, 13($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.160
+	la	$13, L.162
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.116
+L.160:
+	lw	$13, 13($sp)
+	lw	$12, 19($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 12($sp)
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	sleu	$13, $13, $12
+	bnez	$13, L.163
+	lw	$13, 12($sp)
+	sw	$13, 11($sp)
+	seqi	$13, $13, 42
+	bnez	$13, L.166
+	lw	$13, 11($sp)
+	seqi	$13, $13, 43
+	bnez	$13, L.166
+	lw	$13, 11($sp)
+	snei	$13, $13, 63
+	bnez	$13, L.163
+L.166:
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	sw	$13, 13($sp)
+L.163:
+	lw	$13, 20($sp)
+	lw	$12, 0($13)
+	ori	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	sneu	$13, $13, $12
+	bnez	$13, L.167
+	lw	$13, 20($sp)
+	lw	$12, 0($13)
+	ori	$12, $12, 2
+	sw	$12, 0($13)
+L.167:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	jal	regnode
+	addu	$13, $0, $1
+	sw	$13, 18($sp)
+	j	L.172
+L.169:
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$13, 0($12)
+	sw	$13, 1($sp)
+	jal	regc
+L.170:
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	sw	$13, 13($sp)
+L.172:
+	lw	$13, 13($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.169
+	lw	$13, 19($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	regc
+L.118:
+	lw	$1, 18($sp)
+L.116:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 19
+	jr	$ra
+regnode:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	lw	$6, 2($13)
+	lw	$13, 4($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	addui	$13, $13, 3
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.180
+	lw	$13, 4($sp)
+	addui	$13, $13, 6
+	lw	$12, 0($13)
+	addi	$12, $12, 3
+	sw	$12, 0($13)
+	addu	$1, $0, $6
+	j	L.179
+L.180:
+	addu	$7, $0, $6
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$12, 5($sp)
+	sw	$12, 0($13)
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+	lw	$13, 4($sp)
+	sw	$7, 2($13)
+	addu	$1, $0, $6
+L.179:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+regc:
+	subui	$sp, $sp, 3
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 3($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	addui	$13, $13, 3
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.183
+	lw	$13, 3($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$13, 4($sp)
+	sw	$13, 0($12)
+	j	L.184
+L.183:
+	lw	$13, 3($sp)
+	addui	$13, $13, 6
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.184:
+L.182:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+reginsert:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	addui	$13, $13, 3
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.186
+	lw	$13, 7($sp)
+	addui	$13, $13, 6
+	lw	$12, 0($13)
+	addi	$12, $12, 3
+	sw	$12, 0($13)
+	j	L.185
+L.186:
+	lw	$13, 9($sp)
+	addui	$12, $13, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$12, 7($sp)
+	lw	$12, 2($12)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	memmove
+	lw	$13, 7($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addui	$12, $12, 3
+	sw	$12, 0($13)
+	lw	$7, 9($sp)
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$12, 8($sp)
+	sw	$12, 0($13)
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+L.185:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+regtail:
+	subui	$sp, $sp, 8
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 8($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	addui	$13, $13, 3
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.189
+	j	L.188
+L.189:
+	lw	$7, 9($sp)
+	j	L.194
+L.192:
+	addu	$7, $0, $6
+L.194:
+	sw	$7, 0($sp)
+	jal	regnext
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.192
+	lw	$13, 0($7)
+	snei	$13, $13, 7
+	bnez	$13, L.196
+	addu	$13, $0, $7
+	lw	$12, 10($sp)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$4, $0, $13
+	j	L.197
+L.196:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	addu	$12, $0, $7
+	subu	$13, $13, $12
+	addu	$4, $0, $13
+L.197:
+	addu	$5, $0, $4
+	srai	$13, $5, 8
+	andi	$13, $13, 127
+	sw	$13, 1($7)
+	andi	$13, $5, 255
+	sw	$13, 2($7)
+L.188:
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+regoptail:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$12, 2($13)
+	addu	$12, $0, $12
+	addui	$13, $13, 3
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.201
+	lw	$13, 7($sp)
+	lw	$13, 0($13)
+	seqi	$13, $13, 6
+	bnez	$13, L.199
+L.201:
+	j	L.198
+L.199:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	addui	$13, $13, 3
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	regtail
+L.198:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	regexec
+regexec:
+	subui	$sp, $sp, 14
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$6, 15($sp)
+	addu	$13, $0, $0
+	sw	$13, 9($sp)
+	lw	$12, 14($sp)
+	addu	$12, $0, $12
+	sequ	$13, $12, $13
+	bnez	$13, L.205
+	addu	$13, $0, $6
+	lw	$12, 9($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.203
+L.205:
+	la	$13, L.206
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.202
+L.203:
+	lw	$13, 14($sp)
+	lw	$13, 24($13)
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	seqi	$13, $13, 123
+	bnez	$13, L.207
+	la	$13, L.209
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.202
+L.207:
+	lw	$13, 14($sp)
+	lw	$13, 22($13)
+	sw	$13, 8($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.210
+	sw	$6, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	strstr
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.210
+	addu	$1, $0, $0
+	j	L.202
+L.210:
+	sw	$6, 11($sp)
+	lw	$13, 14($sp)
+	sw	$13, 12($sp)
+	lw	$13, 14($sp)
+	addui	$13, $13, 10
+	sw	$13, 13($sp)
+	lw	$13, 14($sp)
+	lw	$13, 21($13)
+	seq	$13, $13, $0
+	bnez	$13, L.215
+	addui	$13, $sp, 10
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	regtry
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.202
+L.215:
+	lw	$13, 14($sp)
+	lw	$13, 20($13)
+	seq	$13, $13, $0
+	bnez	$13, L.217
+	addu	$7, $0, $6
+	j	L.222
+L.219:
+	addui	$13, $sp, 10
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	regtry
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.223
+	addui	$1, $0, 1
+	j	L.202
+L.223:
+L.220:
+	addui	$13, $7, 1
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	lw	$13, 20($13)
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.222:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.219
+	addu	$1, $0, $0
+	j	L.202
+L.217:
+	addu	$7, $0, $6
+	j	L.228
+L.225:
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.229
+	addu	$1, $0, $0
+	j	L.202
+L.229:
+L.226:
+	addui	$7, $7, 1
+L.228:
+	addui	$13, $sp, 10
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	regtry
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.225
+	addui	$1, $0, 1
+L.202:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+regtry:
+	subui	$sp, $sp, 8
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 8($sp)
+	lw	$12, 10($sp)
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	addu	$6, $0, $13
+	addui	$12, $0, 10
+	addui	$5, $13, 10
+	addu	$7, $0, $12
+L.232:
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	sw	$0, 0($13)
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	sw	$0, 0($13)
+L.233:
+	subi	$7, $7, 1
+	sgt	$13, $7, $0
+	bnez	$13, L.232
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	addui	$13, $13, 25
+	sw	$13, 1($sp)
+	jal	regmatch
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.236
+	lw	$13, 9($sp)
+	lw	$12, 10($sp)
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	lw	$12, 8($sp)
+	lw	$12, 0($12)
+	sw	$12, 10($13)
+	addui	$1, $0, 1
+	j	L.231
+L.236:
+	addu	$1, $0, $0
+L.231:
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+regmatch:
+	subui	$sp, $sp, 17
+	sw	$2, 2($sp)
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$7, 18($sp)
+	j	L.242
+L.239:
+	sw	$7, 0($sp)
+	jal	regnext
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$5, 0($7)
+	slt	$13, $5, $0
+	bnez	$13, L.243
+	sgti	$13, $5, 39
+	bnez	$13, L.243
+	lw	$13, L.306($5)
+	jr	$13
+.data
+L.306:
+	.word	L.304
+	.word	L.246
+	.word	L.249
+	.word	L.252
+	.word	L.260
+	.word	L.264
+	.word	L.280
+	.word	L.244
+	.word	L.255
+	.word	L.244
+	.word	L.288
+	.word	L.288
+	.word	L.243
+	.word	L.243
+	.word	L.243
+	.word	L.243
+	.word	L.243
+	.word	L.243
+	.word	L.243
+	.word	L.243
+	.word	L.243
+	.word	L.270
+	.word	L.270
+	.word	L.270
+	.word	L.270
+	.word	L.270
+	.word	L.270
+	.word	L.270
+	.word	L.270
+	.word	L.270
+	.word	L.243
+	.word	L.275
+	.word	L.275
+	.word	L.275
+	.word	L.275
+	.word	L.275
+	.word	L.275
+	.word	L.275
+	.word	L.275
+	.word	L.275
+.text
+L.246:
+	lw	$13, 17($sp)
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.244
+	addu	$1, $0, $0
+	j	L.238
+L.249:
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.244
+	addu	$1, $0, $0
+	j	L.238
+L.252:
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.253
+	addu	$1, $0, $0
+	j	L.238
+L.253:
+	lw	$13, 17($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+	j	L.244
+L.255:
+	addui	$4, $7, 3
+	lw	$13, 0($4)
+	lw	$12, 17($sp)
+	lw	$12, 0($12)
+	lw	$12, 0($12)
+	seq	$13, $13, $12
+	bnez	$13, L.256
+	addu	$1, $0, $0
+	j	L.238
+L.256:
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	sw	$4, 1($sp)
+	jal	strstr
+	addu	$13, $0, $1
+	sw	$13, 15($sp)
+	lw	$13, 15($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.258
+	addu	$1, $0, $0
+	j	L.238
+L.258:
+	sw	$4, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	sw	$13, 16($sp)
+	lw	$13, 17($sp)
+	lw	$12, 16($sp)
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.244
+L.260:
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	sw	$13, 16($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.263
+	addui	$13, $7, 3
+	sw	$13, 0($sp)
+	lw	$13, 16($sp)
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.261
+L.263:
+	addu	$1, $0, $0
+	j	L.238
+L.261:
+	lw	$13, 17($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+	j	L.244
+L.264:
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	sw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.267
+	addui	$13, $7, 3
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.265
+L.267:
+	addu	$1, $0, $0
+	j	L.238
+L.265:
+	lw	$13, 17($sp)
+	lw	$12, 0($13)
+	addui	$12, $12, 1
+	sw	$12, 0($13)
+	j	L.244
+L.270:
+	lw	$13, 0($7)
+	subi	$13, $13, 20
+	sw	$13, 14($sp)
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	sw	$13, 13($sp)
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	regmatch
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.271
+	lw	$13, 14($sp)
+	lw	$12, 17($sp)
+	lw	$12, 2($12)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.273
+	lw	$13, 14($sp)
+	lw	$12, 17($sp)
+	lw	$12, 2($12)
+	addu	$13, $13, $12
+	lw	$12, 13($sp)
+	sw	$12, 0($13)
+L.273:
+	addui	$1, $0, 1
+	j	L.238
+L.271:
+	addu	$1, $0, $0
+	j	L.238
+L.275:
+	lw	$13, 0($7)
+	subi	$13, $13, 30
+	sw	$13, 14($sp)
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	sw	$13, 13($sp)
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	regmatch
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.276
+	lw	$13, 14($sp)
+	lw	$12, 17($sp)
+	lw	$12, 3($12)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.278
+	lw	$13, 14($sp)
+	lw	$12, 17($sp)
+	lw	$12, 3($12)
+	addu	$13, $13, $12
+	lw	$12, 13($sp)
+	sw	$12, 0($13)
+L.278:
+	addui	$1, $0, 1
+	j	L.238
+L.276:
+	addu	$1, $0, $0
+	j	L.238
+L.280:
+	lw	$13, 17($sp)
+	lw	$4, 0($13)
+	lw	$13, 0($6)
+	seqi	$13, $13, 6
+	bnez	$13, L.284
+	addui	$6, $7, 3
+	j	L.244
+L.283:
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	addui	$13, $7, 3
+	sw	$13, 1($sp)
+	jal	regmatch
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.286
+	addui	$1, $0, 1
+	j	L.238
+L.286:
+	lw	$13, 17($sp)
+	sw	$4, 0($13)
+	sw	$7, 0($sp)
+	jal	regnext
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.284:
+	lw	$13, 0($7)
+	seqi	$13, $13, 6
+	bnez	$13, L.283
+	addu	$1, $0, $0
+	j	L.238
+L.288:
+	lw	$13, 0($6)
+	snei	$13, $13, 8
+	bnez	$13, L.290
+	lw	$13, 3($6)
+	sw	$13, 13($sp)
+	j	L.291
+L.290:
+	sw	$0, 13($sp)
+L.291:
+	lw	$3, 13($sp)
+	lw	$13, 17($sp)
+	lw	$2, 0($13)
+	lw	$13, 0($7)
+	snei	$13, $13, 10
+	bnez	$13, L.293
+	sw	$0, 12($sp)
+	j	L.294
+L.293:
+	addui	$13, $0, 1
+	sw	$13, 12($sp)
+L.294:
+	lw	$13, 12($sp)
+	addu	$13, $0, $13
+	sw	$13, 14($sp)
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	addui	$13, $7, 3
+	sw	$13, 1($sp)
+	jal	regrepeat
+	addu	$13, $0, $1
+	addui	$12, $0, 1
+	addu	$4, $13, $12
+	j	L.298
+L.295:
+	lw	$13, 17($sp)
+	addu	$12, $4, $2
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	seq	$13, $3, $0
+	bnez	$13, L.301
+	lw	$13, 17($sp)
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	sne	$13, $13, $3
+	bnez	$13, L.299
+L.301:
+	lw	$13, 17($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	regmatch
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.302
+	addui	$1, $0, 1
+	j	L.238
+L.302:
+L.299:
+L.296:
+	addui	$13, $0, 1
+	subu	$4, $4, $13
+L.298:
+	lw	$13, 14($sp)
+	sgtu	$13, $4, $13
+	bnez	$13, L.295
+	addu	$1, $0, $0
+	j	L.238
+L.304:
+	addui	$1, $0, 1
+	j	L.238
+L.243:
+	la	$13, L.305
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+	j	L.238
+L.244:
+L.240:
+	addu	$7, $0, $6
+L.242:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.239
+	la	$13, L.307
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+L.238:
+	lw	$2, 2($sp)
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+regrepeat:
+	subui	$sp, $sp, 9
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 10($sp)
+	lw	$7, 0($13)
+	slti	$13, $7, 3
+	bnez	$13, L.309
+	sgti	$13, $7, 8
+	bnez	$13, L.309
+	lw	$13, L.321-3($7)
+	jr	$13
+.data
+L.321:
+	.word	L.312
+	.word	L.318
+	.word	L.319
+	.word	L.309
+	.word	L.309
+	.word	L.313
+.text
+L.312:
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.308
+L.313:
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	sw	$13, 6($sp)
+	sw	$0, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	sw	$13, 8($sp)
+	j	L.317
+L.314:
+	lw	$13, 7($sp)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	sw	$13, 7($sp)
+L.315:
+	lw	$13, 8($sp)
+	addui	$13, $13, 1
+	sw	$13, 8($sp)
+L.317:
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	lw	$12, 6($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.314
+	lw	$1, 7($sp)
+	j	L.308
+L.318:
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	addui	$13, $13, 3
+	sw	$13, 1($sp)
+	jal	strspn
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.308
+L.319:
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	addui	$13, $13, 3
+	sw	$13, 1($sp)
+	jal	strcspn
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.308
+L.309:
+	la	$13, L.320
+	sw	$13, 0($sp)
+	jal	regerror
+	addu	$1, $0, $0
+L.308:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+regnext:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	lw	$12, 1($13)
+	andi	$12, $12, 127
+	slli	$12, $12, 8
+	lw	$13, 2($13)
+	andi	$13, $13, 255
+	add	$7, $12, $13
+	sne	$13, $7, $0
+	bnez	$13, L.324
+	addu	$1, $0, $0
+	j	L.323
+L.324:
+	lw	$13, 4($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 7
+	bnez	$13, L.327
+	lw	$13, 4($sp)
+	subu	$6, $13, $7
+	j	L.328
+L.327:
+	lw	$13, 4($sp)
+	addu	$6, $7, $13
+L.328:
+	addu	$1, $0, $6
+L.323:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.320:
+	.asciiz	"internal error: bad call of regrepeat"
+L.307:
+	.asciiz	"corrupted pointers"
+L.305:
+	.asciiz	"regexp corruption"
+L.209:
+	.asciiz	"corrupted regexp"
+L.206:
+	.asciiz	"NULL argument to regexec"
+L.162:
+	.asciiz	"internal error: strcspn 0"
+L.159:
+	.asciiz	"^$.[()|?+*\\"
+L.158:
+	.asciiz	"trailing \\"
+L.154:
+	.asciiz	"?+* follows nothing"
+L.152:
+	.asciiz	"internal error: \\0|) unexpected"
+L.147:
+	.asciiz	"unmatched []"
+L.139:
+	.asciiz	"invalid [] range"
+L.115:
+	.asciiz	"nested *?+"
+L.94:
+	.asciiz	"*+ operand could be empty"
+L.74:
+	.asciiz	"internal error: junk on end"
+L.73:
+	.asciiz	"unmatched ()"
+L.68:
+	.asciiz	"unterminated ()"
+L.49:
+	.asciiz	"too many ()"
+L.25:
+	.asciiz	"out of space"
+L.21:
+	.asciiz	"regexp too big"
+L.6:
+	.asciiz	"NULL argument to regcomp"
@@ -0,0 +1,177 @@
+.global	regsub
+.text
+regsub:
+	subui	$sp, $sp, 16
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	lw	$7, 16($sp)
+	lw	$6, 17($sp)
+	lw	$5, 18($sp)
+	addu	$13, $0, $0
+	sw	$13, 15($sp)
+	addu	$12, $0, $7
+	sequ	$13, $12, $13
+	bnez	$13, L.7
+	lw	$13, 17($sp)
+	addu	$13, $0, $13
+	lw	$12, 15($sp)
+	sequ	$13, $13, $12
+	bnez	$13, L.7
+	lw	$13, 18($sp)
+	addu	$13, $0, $13
+	lw	$12, 15($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.4
+L.7:
+	la	$13, L.8
+	sw	$13, 0($sp)
+	jal	regerror
+	j	L.3
+L.4:
+	lw	$13, 24($7)
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	seqi	$13, $13, 123
+	bnez	$13, L.13
+	la	$13, L.11
+	sw	$13, 0($sp)
+	jal	regerror
+	j	L.3
+L.12:
+	snei	$13, $4, 38
+	bnez	$13, L.15
+	addu	$3, $0, $0
+	j	L.16
+L.15:
+	snei	$13, $4, 92
+	bnez	$13, L.17
+	lw	$13, 0($6)
+	subi	$13, $13, 48
+	addu	$13, $0, $13
+	addui	$12, $0, 10
+	sgeu	$13, $13, $12
+	bnez	$13, L.17
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	lw	$13, 0($13)
+	subi	$3, $13, 48
+	j	L.18
+L.17:
+	lhi	$3, 0xffff
+	ori	$3, $3, 0xffff
+L.18:
+L.16:
+	sge	$13, $3, $0
+	bnez	$13, L.19
+	addui	$13, $0, 92
+	sw	$13, 14($sp)
+	sne	$13, $4, $13
+	bnez	$13, L.21
+	lw	$13, 0($6)
+	sw	$13, 13($sp)
+	lw	$12, 14($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.23
+	lw	$13, 13($sp)
+	snei	$13, $13, 38
+	bnez	$13, L.21
+L.23:
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	lw	$4, 0($13)
+L.21:
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	sw	$4, 0($13)
+	j	L.20
+L.19:
+	addu	$13, $3, $7
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 14($sp)
+	addu	$12, $0, $0
+	sequ	$13, $13, $12
+	bnez	$13, L.24
+	addui	$13, $7, 10
+	addu	$13, $3, $13
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 13($sp)
+	sequ	$13, $13, $12
+	bnez	$13, L.24
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	sleu	$13, $12, $13
+	bnez	$13, L.24
+	addu	$13, $3, $7
+	addui	$12, $7, 10
+	addu	$12, $3, $12
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	lw	$11, 0($13)
+	addu	$11, $0, $11
+	subu	$12, $12, $11
+	addu	$12, $0, $12
+	addu	$2, $0, $12
+	sw	$5, 0($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	sw	$2, 2($sp)
+	jal	strlcpy
+	addu	$5, $2, $5
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	addu	$13, $5, $13
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.26
+	la	$13, L.28
+	sw	$13, 0($sp)
+	jal	regerror
+	j	L.3
+L.26:
+L.24:
+L.20:
+L.13:
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	lw	$13, 0($13)
+	addu	$4, $0, $13
+	sne	$13, $13, $0
+	bnez	$13, L.12
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	sw	$0, 0($13)
+L.3:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.28:
+	.asciiz	"damaged match string"
+L.11:
+	.asciiz	"damaged regexp"
+L.8:
+	.asciiz	"NULL parameter to regsub"
@@ -0,0 +1,47 @@
+.global	_stdin
+_stdin:
+	.word	0x0
+	.word	0x0
+	.word	0x800
+	.word	0x0
+	.word	0x0
+	.word	0x0
+.global	_stdout
+_stdout:
+	.word	0x0
+	.word	0x1
+	.word	0x800
+	.word	0x0
+	.word	0x0
+	.word	0x0
+.global	_stderr
+_stderr:
+	.word	0x0
+	.word	0x2
+	.word	0x800
+	.word	0x0
+	.word	0x0
+	.word	0x0
+.global	dprintf
+.text
+dprintf:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 15
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 8
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.1:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	__iotab 8
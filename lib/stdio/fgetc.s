@@ -0,0 +1,100 @@
+.global	fgetc
+.text
+fgetc:
+	subui	$sp, $sp, 11
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 11($sp)
+	lw	$13, 2($13)
+	andi	$13, $13, 16
+	seq	$13, $13, $0
+	bnez	$13, L.4
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.3
+L.4:
+	lw	$13, 11($sp)
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.6
+	addui	$13, $0, 500
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	lw	$12, 11($sp)
+	sw	$13, 4($12)
+	lw	$13, 11($sp)
+	addui	$12, $0, 500
+	sw	$12, 3($13)
+L.6:
+	lw	$13, 11($sp)
+	lw	$12, 0($13)
+	lw	$13, 4($13)
+	addu	$13, $12, $13
+	sw	$13, 10($sp)
+	lw	$13, 11($sp)
+	lw	$13, 5($13)
+	addu	$13, $0, $13
+	sw	$13, 8($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	sltu	$13, $12, $13
+	bnez	$13, L.8
+L.10:
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	lw	$12, 1($13)
+	sw	$12, 1($sp)
+	lw	$12, 4($13)
+	sw	$12, 2($sp)
+	lw	$13, 3($13)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	sgt	$13, $13, $0
+	bnez	$13, L.11
+	lw	$13, 11($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	ori	$12, $12, 16
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.3
+L.11:
+	lw	$13, 11($sp)
+	lw	$12, 9($sp)
+	sw	$12, 0($13)
+	lw	$13, 11($sp)
+	lw	$12, 4($13)
+	sw	$12, 5($13)
+L.8:
+	lw	$13, 11($sp)
+	addui	$13, $13, 5
+	lw	$12, 0($13)
+	addui	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$13, 0($12)
+	addu	$1, $0, $13
+L.3:
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
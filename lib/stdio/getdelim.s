@@ -0,0 +1,138 @@
+.global	getdelim
+.text
+getdelim:
+	subui	$sp, $sp, 8
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addu	$13, $0, $0
+	sw	$13, 7($sp)
+	lw	$12, 8($sp)
+	addu	$12, $0, $12
+	sequ	$13, $12, $13
+	bnez	$13, L.7
+	lw	$13, 9($sp)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	sequ	$13, $13, $12
+	bnez	$13, L.7
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.4
+L.7:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.3
+L.4:
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.8
+	lw	$13, 9($sp)
+	addui	$12, $0, 120
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	lw	$12, 8($sp)
+	sw	$13, 0($12)
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.3
+L.10:
+L.8:
+	addu	$6, $0, $0
+	j	L.13
+L.12:
+	addui	$13, $0, 1
+	addu	$13, $6, $13
+	lw	$12, 9($sp)
+	lw	$12, 0($12)
+	sltu	$13, $13, $12
+	bnez	$13, L.15
+	lw	$13, 9($sp)
+	lw	$12, 0($13)
+	slli	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 8($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$12, 9($sp)
+	lw	$12, 0($12)
+	sw	$12, 1($sp)
+	jal	realloc
+	addu	$12, $0, $1
+	sw	$12, 0($13)
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.17
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.3
+L.17:
+L.15:
+	addu	$13, $0, $6
+	addui	$12, $0, 1
+	addu	$6, $13, $12
+	lw	$12, 8($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	sw	$7, 0($13)
+	lw	$13, 10($sp)
+	sne	$13, $7, $13
+	bnez	$13, L.19
+	j	L.14
+L.19:
+L.13:
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	fgetc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.12
+L.14:
+	sneu	$13, $6, $0
+	bnez	$13, L.21
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sne	$13, $7, $13
+	bnez	$13, L.21
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.3
+L.21:
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $6, $13
+	sw	$0, 0($13)
+	addu	$1, $0, $6
+L.3:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,42 @@
+.global	perror
+.text
+perror:
+	subui	$sp, $sp, 7
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	jal	strerror
+	addu	$13, $0, $1
+	lw	$12, _stderr+1($0)
+	sw	$12, 0($sp)
+	la	$12, L.3
+	sw	$12, 1($sp)
+	lw	$12, 7($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	dprintf
+L.1:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.3:
+	.asciiz	"%s: %s\n"
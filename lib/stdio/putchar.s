@@ -0,0 +1,33 @@
+.global	putchar
+.text
+putchar:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.4
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.2
+	lw	$1, 5($sp)
+	j	L.1
+L.2:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.1:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.4:
+	.asciiz	"%c"
@@ -0,0 +1,166 @@
+.global	fopen
+.text
+fopen:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$13, $0, 6
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+	addu	$1, $0, $7
+	j	L.3
+L.4:
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 258
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 1($7)
+	lw	$13, 1($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.6
+	j	L.8
+L.6:
+	addui	$13, $0, 500
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	sw	$13, 4($7)
+	lw	$13, 4($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.9
+	j	L.11
+L.9:
+	addui	$13, $0, 500
+	sw	$13, 3($7)
+	addu	$1, $0, $7
+	j	L.3
+L.11:
+	lw	$13, 4($7)
+	sw	$13, 0($sp)
+	jal	free
+L.8:
+	sw	$7, 0($sp)
+	jal	free
+	addu	$1, $0, $0
+L.3:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	fread
+fread:
+	subui	$sp, $sp, 8
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	lw	$12, 10($sp)
+	multu	$13, $13, $12
+	sw	$13, 7($sp)
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	lw	$13, 7($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.12:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	fwrite
+fwrite:
+	subui	$sp, $sp, 8
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	lw	$12, 10($sp)
+	multu	$13, $13, $12
+	sw	$13, 7($sp)
+	addui	$13, $0, 24
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	lw	$13, 7($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.13:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	fclose
+fclose:
+	subui	$sp, $sp, 5
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, 5($sp)
+	lw	$13, 4($13)
+	sw	$13, 0($sp)
+	jal	free
+L.15:
+	lw	$13, 5($sp)
+	lw	$13, 2($13)
+	andi	$13, $13, 2048
+	xori	$13, $13, 2048
+	seq	$13, $13, $0
+	bnez	$13, L.17
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	free
+L.17:
+	lw	$1, 4($sp)
+L.14:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	errlist 40
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,50 @@
+.global	calloc
+.text
+calloc:
+	subui	$sp, $sp, 7
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lw	$12, 8($sp)
+	multu	$13, $13, $12
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sequ	$13, $13, $0
+	bnez	$13, L.4
+	lw	$13, 7($sp)
+	lw	$12, 8($sp)
+	multu	$5, $13, $12
+	addu	$7, $0, $0
+	j	L.9
+L.6:
+	addu	$13, $7, $6
+	sw	$0, 0($13)
+L.7:
+	addui	$13, $0, 1
+	addu	$7, $7, $13
+L.9:
+	sltu	$13, $7, $5
+	bnez	$13, L.6
+L.4:
+	addu	$1, $0, $6
+L.3:
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,193 @@
+.global	copy_sblock
+.text
+copy_sblock:
+	subui	$sp, $sp, 6
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 6($sp)
+	lw	$6, 4($13)
+	lw	$13, 7($sp)
+	lw	$5, 4($13)
+	addu	$7, $0, $0
+	j	L.7
+L.4:
+	addu	$13, $7, $5
+	addu	$12, $7, $6
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.5:
+	addui	$13, $0, 1
+	addu	$7, $7, $13
+L.7:
+	slli	$13, $7, 2
+	sw	$13, 5($sp)
+	lw	$12, 6($sp)
+	lw	$12, 0($12)
+	sgeu	$13, $13, $12
+	bnez	$13, L.8
+	lw	$13, 7($sp)
+	lw	$13, 0($13)
+	lw	$12, 5($sp)
+	sltu	$13, $12, $13
+	bnez	$13, L.4
+L.8:
+L.3:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	realloc
+realloc:
+	subui	$sp, $sp, 12
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 12($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.9
+L.10:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	sblock_valid_addr
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.12
+	lw	$13, 13($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	srli	$13, $13, 2
+	slli	$13, $13, 2
+	addui	$12, $0, 4
+	addu	$13, $13, $12
+	sw	$13, 10($sp)
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	get_sblock
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	lw	$13, 11($sp)
+	lw	$13, 0($13)
+	lw	$12, 10($sp)
+	sltu	$13, $13, $12
+	bnez	$13, L.14
+	lw	$13, 11($sp)
+	lw	$13, 0($13)
+	lw	$12, 10($sp)
+	subu	$13, $13, $12
+	addui	$12, $0, 9
+	sltu	$13, $13, $12
+	bnez	$13, L.15
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	split_sblock
+	j	L.15
+L.14:
+	lw	$13, 11($sp)
+	lw	$13, 1($13)
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	sw	$13, 6($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.18
+	lw	$13, 6($sp)
+	lw	$13, 3($13)
+	seq	$13, $13, $0
+	bnez	$13, L.18
+	lw	$13, 11($sp)
+	lw	$11, 0($13)
+	lw	$13, 4($13)
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	addu	$13, $13, $11
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.18
+	addui	$13, $0, 5
+	addu	$13, $11, $13
+	lw	$12, 6($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$12, 10($sp)
+	sltu	$13, $13, $12
+	bnez	$13, L.18
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	fusion_sblock
+	lw	$13, 11($sp)
+	lw	$13, 0($13)
+	lw	$12, 10($sp)
+	subu	$13, $13, $12
+	addui	$12, $0, 9
+	sltu	$13, $13, $12
+	bnez	$13, L.19
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	split_sblock
+	j	L.19
+L.18:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.22
+	addu	$1, $0, $0
+	j	L.9
+L.22:
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	get_sblock
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	copy_sblock
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	free
+	lw	$1, 8($sp)
+	j	L.9
+L.19:
+L.15:
+	lw	$1, 12($sp)
+	j	L.9
+L.12:
+	addu	$1, $0, $0
+L.9:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
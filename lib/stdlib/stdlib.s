@@ -0,0 +1,392 @@
+base:
+	.word	0x0
+.global	find_sblock
+.text
+find_sblock:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$7, base($0)
+	j	L.5
+L.4:
+	lw	$13, 3($sp)
+	sw	$7, 0($13)
+	lw	$7, 1($7)
+L.5:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.7
+	lw	$13, 3($7)
+	seq	$13, $13, $0
+	bnez	$13, L.4
+	lw	$13, 0($7)
+	lw	$12, 4($sp)
+	sltu	$13, $13, $12
+	bnez	$13, L.4
+L.7:
+	addu	$1, $0, $7
+L.3:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	split_sblock
+split_sblock:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	addui	$11, $12, 5
+	addu	$7, $13, $11
+	lw	$12, 0($12)
+	subu	$13, $12, $13
+	addui	$12, $0, 5
+	subu	$13, $13, $12
+	sw	$13, 0($7)
+	lw	$13, 4($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($7)
+	lw	$13, 4($sp)
+	sw	$13, 2($7)
+	addui	$13, $0, 1
+	sw	$13, 3($7)
+	addui	$13, $7, 5
+	sw	$13, 4($7)
+	lw	$13, 4($sp)
+	lw	$12, 5($sp)
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	sw	$7, 1($13)
+	lw	$13, 1($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.9
+	lw	$13, 1($7)
+	sw	$7, 2($13)
+L.9:
+L.8:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	extend_sblock_heap
+extend_sblock_heap:
+	subui	$sp, $sp, 6
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	sw	$0, 0($sp)
+	jal	sbrk
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 7($sp)
+	addui	$12, $0, 5
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	jal	sbrk
+	addu	$13, $0, $1
+	sw	$13, 5($sp)
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	sge	$13, $13, $0
+	bnez	$13, L.12
+	addu	$1, $0, $0
+	j	L.11
+L.12:
+	lw	$13, 7($sp)
+	sw	$13, 0($7)
+	sw	$0, 1($7)
+	lw	$13, 6($sp)
+	sw	$13, 2($7)
+	addui	$13, $7, 5
+	sw	$13, 4($7)
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.14
+	lw	$13, 6($sp)
+	sw	$7, 1($13)
+L.14:
+	sw	$0, 3($7)
+	addu	$1, $0, $7
+L.11:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	malloc
+malloc:
+	subui	$sp, $sp, 8
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	addui	$12, $0, 1
+	subu	$13, $13, $12
+	srli	$13, $13, 2
+	slli	$13, $13, 2
+	addui	$12, $0, 4
+	addu	$13, $13, $12
+	sw	$13, 7($sp)
+	lw	$13, base($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.17
+	lw	$13, base($0)
+	sw	$13, 6($sp)
+	addui	$13, $sp, 6
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	find_sblock
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.19
+	lw	$13, 0($7)
+	lw	$12, 7($sp)
+	subu	$13, $13, $12
+	addui	$12, $0, 9
+	sltu	$13, $13, $12
+	bnez	$13, L.21
+	sw	$7, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	split_sblock
+L.21:
+	sw	$0, 3($7)
+	j	L.18
+L.19:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	extend_sblock_heap
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.18
+	addu	$1, $0, $0
+	j	L.16
+L.17:
+	sw	$0, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	extend_sblock_heap
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.25
+	addu	$1, $0, $0
+	j	L.16
+L.25:
+	sw	$7, base($0)
+L.18:
+	addui	$1, $7, 5
+L.16:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	fusion_sblock
+fusion_sblock:
+	subui	$sp, $sp, 6
+	sw	$7, 0($sp)
+	sw	$10, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 6($sp)
+	lw	$7, 1($13)
+	addu	$13, $0, $7
+	sw	$13, 5($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.28
+	lw	$13, 3($7)
+	seq	$13, $13, $0
+	bnez	$13, L.28
+	lw	$13, 6($sp)
+	lw	$12, 4($13)
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	lw	$13, 0($13)
+	addu	$13, $12, $13
+	lw	$12, 5($sp)
+	addu	$12, $0, $12
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.28
+	lw	$13, 6($sp)
+	lw	$12, 0($13)
+	lw	$11, 0($7)
+	addui	$10, $0, 5
+	addu	$11, $11, $10
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	lw	$13, 6($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.30
+	lw	$13, 6($sp)
+	lw	$12, 1($13)
+	sw	$13, 2($12)
+L.30:
+L.28:
+	lw	$1, 6($sp)
+L.27:
+	lw	$7, 0($sp)
+	lw	$10, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	get_sblock
+get_sblock:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffb
+	addu	$1, $13, $12
+L.32:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	sblock_valid_addr
+sblock_valid_addr:
+	subui	$sp, $sp, 6
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, base($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.34
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	sw	$13, 5($sp)
+	lw	$12, base($0)
+	addu	$12, $0, $12
+	sleu	$13, $13, $12
+	bnez	$13, L.36
+	sw	$0, 0($sp)
+	jal	sbrk
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	lw	$12, 5($sp)
+	sgeu	$13, $12, $13
+	bnez	$13, L.36
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_sblock
+	addu	$12, $0, $1
+	addu	$13, $0, $13
+	lw	$12, 4($12)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.39
+	addui	$7, $0, 1
+	j	L.40
+L.39:
+	addu	$7, $0, $0
+L.40:
+	addu	$1, $0, $7
+	j	L.33
+L.36:
+L.34:
+	addu	$1, $0, $0
+L.33:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	free
+free:
+	subui	$sp, $sp, 7
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	jal	sblock_valid_addr
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.42
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	jal	get_sblock
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addui	$13, $0, 1
+	sw	$13, 3($7)
+	lw	$13, 2($7)
+	sw	$13, 6($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.44
+	lw	$13, 6($sp)
+	lw	$13, 3($13)
+	seq	$13, $13, $0
+	bnez	$13, L.44
+	lw	$13, 2($7)
+	sw	$13, 0($sp)
+	jal	fusion_sblock
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.44:
+	lw	$13, 1($7)
+	sw	$13, 5($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.46
+	lw	$13, 5($sp)
+	lw	$13, 3($13)
+	seq	$13, $13, $0
+	bnez	$13, L.46
+	sw	$7, 0($sp)
+	jal	fusion_sblock
+L.46:
+L.42:
+L.41:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	errlist 40
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,243 @@
+.global	strtol
+.text
+strtol:
+	subui	$sp, $sp, 13
+	sw	$3, 0($sp)
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addui	$6, $0, 1
+	addu	$7, $0, $0
+	j	L.5
+L.4:
+	lw	$13, 13($sp)
+	addui	$13, $13, 1
+	sw	$13, 13($sp)
+L.5:
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	sw	$13, 12($sp)
+	subi	$12, $13, 9
+	slti	$13, $12, 5
+	bnez	$13, L.10
+	lw	$13, 12($sp)
+	snei	$13, $13, 32
+	bnez	$13, L.8
+L.10:
+	addui	$5, $0, 1
+	j	L.9
+L.8:
+	addu	$5, $0, $0
+L.9:
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.4
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 43
+	bnez	$13, L.11
+	lw	$13, 13($sp)
+	addui	$13, $13, 1
+	sw	$13, 13($sp)
+	j	L.12
+L.11:
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 45
+	bnez	$13, L.13
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffff
+	lw	$13, 13($sp)
+	addui	$13, $13, 1
+	sw	$13, 13($sp)
+L.13:
+L.12:
+	lw	$13, 15($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 48
+	bnez	$13, L.17
+	lw	$13, 13($sp)
+	lw	$13, 1($13)
+	subi	$13, $13, 65
+	addu	$13, $0, $13
+	addui	$12, $0, 26
+	sgeu	$13, $13, $12
+	bnez	$13, L.22
+	lw	$13, 13($sp)
+	lw	$13, 1($13)
+	addi	$13, $13, 97
+	subi	$4, $13, 65
+	j	L.23
+L.22:
+	lw	$13, 13($sp)
+	lw	$4, 1($13)
+L.23:
+	snei	$13, $4, 120
+	bnez	$13, L.19
+	addui	$13, $0, 16
+	sw	$13, 15($sp)
+	lw	$13, 13($sp)
+	addui	$13, $13, 2
+	sw	$13, 13($sp)
+	j	L.18
+L.19:
+	addui	$13, $0, 8
+	sw	$13, 15($sp)
+	lw	$13, 13($sp)
+	addui	$13, $13, 1
+	sw	$13, 13($sp)
+	j	L.18
+L.17:
+	addui	$13, $0, 10
+	sw	$13, 15($sp)
+L.18:
+L.15:
+	lw	$13, 15($sp)
+	sw	$13, 11($sp)
+	slti	$13, $13, 2
+	bnez	$13, L.26
+	lw	$13, 11($sp)
+	slei	$13, $13, 36
+	bnez	$13, L.30
+L.26:
+	lw	$13, 14($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.27
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	sw	$12, 0($13)
+L.27:
+	addu	$1, $0, $0
+	j	L.3
+L.29:
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	subi	$13, $13, 48
+	addu	$13, $0, $13
+	addui	$12, $0, 10
+	sgeu	$13, $13, $12
+	bnez	$13, L.32
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	subi	$4, $13, 48
+	j	L.33
+L.32:
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	subi	$13, $13, 97
+	addu	$13, $0, $13
+	addui	$12, $0, 26
+	sgeu	$13, $13, $12
+	bnez	$13, L.35
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	addi	$13, $13, 65
+	subi	$3, $13, 97
+	j	L.36
+L.35:
+	lw	$13, 13($sp)
+	lw	$3, 0($13)
+L.36:
+	subi	$13, $3, 65
+	addi	$4, $13, 10
+L.33:
+	lw	$13, 15($sp)
+	slt	$13, $4, $13
+	bnez	$13, L.37
+	j	L.31
+L.37:
+	lhi	$13, 0x7fff
+	ori	$13, $13, 0xffff
+	sub	$13, $13, $4
+	lw	$12, 15($sp)
+	div	$13, $13, $12
+	sle	$13, $7, $13
+	bnez	$13, L.39
+	snei	$13, $6, 1
+	bnez	$13, L.42
+	lhi	$3, 0x7fff
+	ori	$3, $3, 0xffff
+	j	L.43
+L.42:
+	lhi	$3, 0x8000
+	ori	$3, $3, 0x0
+L.43:
+	addu	$7, $0, $3
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	addui	$12, $0, 34
+	sw	$12, 0($13)
+	j	L.40
+L.39:
+	lw	$13, 15($sp)
+	mult	$13, $7, $13
+	add	$7, $13, $4
+L.40:
+	lw	$13, 13($sp)
+	addui	$13, $13, 1
+	sw	$13, 13($sp)
+L.30:
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	sw	$13, 10($sp)
+	subi	$12, $13, 48
+	addu	$12, $0, $12
+	addui	$11, $0, 10
+	sltu	$13, $12, $11
+	bnez	$13, L.29
+	addui	$13, $0, 6
+	sw	$13, 9($sp)
+	lw	$12, 10($sp)
+	subi	$12, $12, 97
+	addu	$12, $0, $12
+	sltu	$13, $12, $13
+	bnez	$13, L.29
+	lw	$13, 10($sp)
+	subi	$13, $13, 65
+	addu	$13, $0, $13
+	lw	$12, 9($sp)
+	sltu	$13, $13, $12
+	bnez	$13, L.29
+L.31:
+	lw	$13, 14($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.44
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	sw	$12, 0($13)
+L.44:
+	mult	$1, $6, $7
+L.3:
+	lw	$3, 0($sp)
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.extern	errlist 40
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
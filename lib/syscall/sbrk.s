@@ -0,0 +1,39 @@
+_brk:
+	.word	0x0
+.global	sbrk
+.text
+sbrk:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, _brk($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.2
+	j	L.4
+L.2:
+	lw	$13, 4($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.5
+	lw	$1, _brk($0)
+	j	L.1
+L.5:
+L.4:
+	addui	$13, $0, 50
+	sw	$13, 0($sp)
+	lw	$13, 4($sp)
+	sw	$13, 1($sp)
+	jal	ptr_wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, _brk($0)
+	addu	$1, $0, $13
+L.1:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
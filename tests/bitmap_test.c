@@ -1,8 +1,90 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
+#include <time.h>
 #include <winix/bitmap.h>
+#include <winix/comm.h>
 
 extern unsigned int mask[BITMASK_NR];
 
+#define ORACLE_MAP_LEN      (8)
+#define ORACLE_ROUNDS       (2000)
+#define BENCH_ROUNDS        (200)
+
+static double now_ms(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+/* the original bit by bit implementations, kept as the reference */
+static int reference_search_from(unsigned int *map, int map_len, int start, int num){
+    int i, j, count = 0;
+    if(num >= map_len * 32 || start >= map_len * 32)
+        return -1;
+    i = start / 32;
+    j = start % 32;
+    for (; i < map_len; ++i){
+        for (; j < BITMASK_NR; j++) {
+            if ((map[i] & mask[j]) == 0) {
+                count++;
+                if (count == num)
+                    return (i*32 + j - count+1);
+            }else{
+                count = 0;
+            }
+        }
+        j = 0;
+    }
+    return -1;
+}
+
+static int reference_search_reverse(unsigned int *map, int map_len, int num){
+    int i, j, count = 0;
+    if(num >= map_len * 32 )
+        return -1;
+    for (i = map_len -1; i >= 0; i--){
+        for (j = BITMASK_NR -1; j >= 0; j--) {
+            if ((map[i] & mask[j]) == 0) {
+                count++;
+                if (count == num)
+                    return (i*32 + j);
+            }else{
+                count = 0;
+            }
+        }
+    }
+    return -1;
+}
+
+static int reference_count_ones(unsigned int *map, int map_len){
+    int i, j, count = 0;
+    for(i = 0; i < map_len; i++)
+        for(j = 0; j < 32; j++)
+            if(map[i] & mask[j])
+                count++;
+    return count;
+}
+
+/* fill the map so that roughly density out of 100 bits are set, in runs */
+static void random_map(unsigned int *map, int map_len, int density){
+    int i, bits = map_len * 32;
+    int run;
+    bitmap_clear(map, map_len);
+    for(i = 0; i < bits; i += run){
+        run = 1 + rand() % 40;
+        if(i + run > bits)
+            run = bits - i;
+        if(rand() % 100 < density)
+            bitmap_set_nbits(map, map_len, i, run);
+    }
+}
+
+static int normalise(int ret){
+    return ret < 0 ? -1 : ret;
+}
+
 void test_given_bitmask_should_return_aligned(){
     int i;
     unsigned int curr = 0x80000000;
@@ -10,4 +92,189 @@ void test_given_bitmask_should_return_aligned(){
         assert(mask[i-1] == curr);
         curr = curr >> 1;
     }
-}
\ No newline at end of file
+}
+
+void test_given_word_should_find_first_set_bit(){
+    int i, j;
+    unsigned int word;
+
+    assert(bitmap_first_set(0) == -1);
+    for(i = 0; i < BITMASK_NR; i++){
+        word = mask[i];
+        for(j = i + 1; j < BITMASK_NR; j++){
+            word |= rand() % 2 ? mask[j] : 0;
+        }
+        assert(bitmap_first_set(word) == i);
+    }
+}
+
+void test_given_random_maps_when_search_should_match_reference(){
+    unsigned int map[ORACLE_MAP_LEN];
+    int round, start, num, len;
+
+    srand(30);
+    for(round = 0; round < ORACLE_ROUNDS; round++){
+        len = 1 + rand() % ORACLE_MAP_LEN;
+        random_map(map, len, rand() % 101);
+        start = rand() % (len * 32);
+        num = 1 + rand() % (round % 4 == 0 ? len * 32 : 48);
+
+        assert(normalise(bitmap_search_from(map, len, start, num))
+                == reference_search_from(map, len, start, num));
+        assert(normalise(bitmap_search_reverse(map, len, num))
+                == reference_search_reverse(map, len, num));
+        assert(count_bits(map, len, ONE_BITS) == reference_count_ones(map, len));
+        assert(count_bits(map, len, ZERO_BITS) == len * 32 - reference_count_ones(map, len));
+    }
+}
+
+void test_given_nbits_should_set_and_clear_across_words(){
+    unsigned int map[4];
+    int i;
+
+    bitmap_clear(map, 4);
+    assert(bitmap_set_nbits(map, 4, 30, 40) == 0);
+    for(i = 0; i < 128; i++)
+        assert(!!is_bit_on(map, 4, i) == (i >= 30 && i < 70));
+    assert(map[1] == 0xffffffff);
+    assert(bitmap_clear_nbits(map, 4, 31, 38) == 0);
+    assert(map[0] == 0x00000002);
+    assert(map[1] == 0);
+    assert(map[2] == 0x04000000);
+    assert(bitmap_set_nbits(map, 4, 100, 28) == 0);
+    assert(map[3] == 0x0fffffff);
+    assert(bitmap_set_nbits(map, 4, 100, 29) < 0);
+}
+
+void test_given_sparse_and_dense_maps_should_benchmark_search(){
+    static const int sizes[] = {32, 256, 1024};
+    static const int densities[] = {10, 90, 99};
+    static unsigned int map[1024];
+    double t0, t_ref, t_new;
+    int s, d, r, len, num, sink = 0;
+
+    srand(31);
+    for(s = 0; s < 3; s++){
+        for(d = 0; d < 3; d++){
+            len = sizes[s];
+            random_map(map, len, densities[d]);
+            t0 = now_ms();
+            for(r = 0; r < BENCH_ROUNDS; r++){
+                num = 1 + r % 16;
+                sink += reference_search_from(map, len, 0, num);
+                sink += reference_search_reverse(map, len, num);
+                sink += reference_count_ones(map, len);
+            }
+            t_ref = now_ms() - t0;
+            t0 = now_ms();
+            for(r = 0; r < BENCH_ROUNDS; r++){
+                num = 1 + r % 16;
+                sink += bitmap_search_from(map, len, 0, num);
+                sink += bitmap_search_reverse(map, len, num);
+                sink += count_bits(map, len, ONE_BITS);
+            }
+            t_new = now_ms() - t0;
+            printf("bitmap %4d words %2d%% used: reference %.2fms, word scan %.2fms\n",
+                len, densities[d], t_ref, t_new);
+        }
+    }
+    assert(sink != 0x7fffffff);
+}
+
+#define HMAP_LEN            (1024)
+#define HMAP_ROUNDS         (4000)
+
+static unsigned int hmap_words[HMAP_LEN];
+static unsigned int hmap_full[HBITMAP_SUMMARY_LEN(HMAP_LEN)];
+static unsigned int hmap_empty[HBITMAP_SUMMARY_LEN(HMAP_LEN)];
+static unsigned int flat_words[HMAP_LEN];
+
+void test_given_random_operations_hbitmap_should_match_flat_bitmap(){
+    struct hbitmap hmap;
+    int round, len, start, num, ret;
+
+    srand(311);
+    len = 70;
+    random_map(flat_words, len, 50);
+    memcpy(hmap_words, flat_words, sizeof(flat_words));
+    assert(hbitmap_init(&hmap, hmap_words, len, hmap_full, hmap_empty) == 0);
+
+    for(round = 0; round < HMAP_ROUNDS; round++){
+        start = rand() % (len * 32);
+        num = 1 + rand() % (round % 8 == 0 ? 300 : 40);
+        switch(rand() % 4){
+            case 0:
+                ret = bitmap_search_from(flat_words, len, start, num);
+                assert(hbitmap_search_from(&hmap, start, num) == ret);
+                if(ret >= 0 && ret + num <= len * 32){
+                    bitmap_set_nbits(flat_words, len, ret, num);
+                    assert(hbitmap_set_nbits(&hmap, ret, num) == 0);
+                }
+                break;
+            case 1:
+                ret = bitmap_search_reverse(flat_words, len, num);
+                assert(hbitmap_search_reverse(&hmap, num) == ret);
+                if(ret >= 0 && ret + num <= len * 32){
+                    bitmap_set_nbits(flat_words, len, ret, num);
+                    assert(hbitmap_set_nbits(&hmap, ret, num) == 0);
+                }
+                break;
+            case 2:
+                num = num * 4;
+                if(start + num < len * 32){
+                    bitmap_clear_nbits(flat_words, len, start, num);
+                    assert(hbitmap_clear_nbits(&hmap, start, num) == 0);
+                }
+                break;
+            default:
+                bitmap_set_bit(flat_words, len, start);
+                hbitmap_set_bit(&hmap, start);
+                break;
+        }
+        assert(memcmp(flat_words, hmap_words, len * sizeof(unsigned int)) == 0);
+    }
+}
+
+void test_given_fragmented_map_should_benchmark_hbitmap_alloc(){
+    struct hbitmap hmap;
+    double t0, t_flat, t_hmap;
+    int i, r, num, ret, sink = 0;
+
+    // low half fully used apart from scattered single holes, high half free
+    bitmap_clear(flat_words, HMAP_LEN);
+    bitmap_set_nbits(flat_words, HMAP_LEN, 0, HMAP_LEN * 16);
+    for(i = 0; i < HMAP_LEN * 16; i += 1531)
+        bitmap_clear_bit(flat_words, HMAP_LEN, i);
+    memcpy(hmap_words, flat_words, sizeof(flat_words));
+    hbitmap_init(&hmap, hmap_words, HMAP_LEN, hmap_full, hmap_empty);
+
+    t0 = now_ms();
+    for(r = 0; r < BENCH_ROUNDS; r++){
+        num = 2 + r % 64;
+        ret = bitmap_search_from(flat_words, HMAP_LEN, 0, num);
+        bitmap_set_nbits(flat_words, HMAP_LEN, ret, num);
+        sink += ret;
+    }
+    for(r = 0; r < BENCH_ROUNDS; r++){
+        num = 2 + r % 64;
+        sink += bitmap_search_reverse(flat_words, HMAP_LEN, num * 600);
+    }
+    t_flat = now_ms() - t0;
+
+    t0 = now_ms();
+    for(r = 0; r < BENCH_ROUNDS; r++){
+        num = 2 + r % 64;
+        ret = hbitmap_search_from(&hmap, 0, num);
+        hbitmap_set_nbits(&hmap, ret, num);
+        sink -= ret;
+    }
+    for(r = 0; r < BENCH_ROUNDS; r++){
+        num = 2 + r % 64;
+        sink -= hbitmap_search_reverse(&hmap, num * 600);
+    }
+    t_hmap = now_ms() - t0;
+
+    printf("fragmented %d words: flat %.2fms, summary %.2fms\n", HMAP_LEN, t_flat, t_hmap);
+    assert(sink == 0);
+    assert(memcmp(flat_words, hmap_words, sizeof(flat_words)) == 0);
+}
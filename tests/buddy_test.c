@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <winix/gfp.h>
+#include <winix/buddy.h>
+
+#define POOL_MAP_LEN        (32)
+#define POOL_PAGES          (POOL_MAP_LEN * 32)
+#define POOL_ROUNDS         (20000)
+#define MAX_LIVE            (64)
+
+static unsigned int pool_map[POOL_MAP_LEN];
+static unsigned int pool_full[HBITMAP_SUMMARY_LEN(POOL_MAP_LEN)];
+static unsigned int pool_empty[HBITMAP_SUMMARY_LEN(POOL_MAP_LEN)];
+static struct buddy_page pool_pages[POOL_PAGES];
+static char covered[POOL_PAGES];
+
+struct live_range{
+    int start;
+    int num;
+};
+
+static void init_pool(struct buddy_pool *pool, struct hbitmap *hmap, int reserved){
+    bitmap_clear(pool_map, POOL_MAP_LEN);
+    bitmap_set_nbits(pool_map, POOL_MAP_LEN, 0, reserved);
+    hbitmap_init(hmap, pool_map, POOL_MAP_LEN, pool_full, pool_empty);
+    assert(buddy_init(pool, pool_pages, POOL_PAGES, hmap) == 0);
+}
+
+/* every free page is in exactly one aligned block, blocks are fully merged */
+static int check_pool(struct buddy_pool *pool){
+    struct buddy_page *bp;
+    int order, page, i, buddy, nr_free = 0;
+
+    memset(covered, 0, sizeof(covered));
+    for(order = 0; order <= pool->max_order; order++){
+        i = 0;
+        list_for_each_entry(struct buddy_page, bp, &pool->free_area[order], list){
+            page = bp - pool->pages;
+            assert(bp->order == order);
+            assert((page & ((1 << order) - 1)) == 0);
+            buddy = page ^ (1 << order);
+            if(order < pool->max_order && buddy + (1 << order) <= pool->nr_pages)
+                assert(pool->pages[buddy].order != order);
+            for(i = page; i < page + (1 << order); i++){
+                assert(!covered[i]);
+                covered[i] = 1;
+                nr_free++;
+            }
+        }
+    }
+    for(i = 0; i < POOL_PAGES; i++)
+        assert(covered[i] == !is_bit_on(pool_map, POOL_MAP_LEN, i));
+    return nr_free;
+}
+
+void test_given_fresh_pool_should_hold_free_pages_in_max_blocks(){
+    struct buddy_pool pool;
+    struct hbitmap hmap;
+
+    init_pool(&pool, &hmap, 3);
+    assert(check_pool(&pool) == POOL_PAGES - 3);
+    assert(pool.max_order == 10);
+    assert(pool.nr_free[0] == 1);
+    assert(pool.nr_free[2] == 1);
+    assert(pool.nr_free[9] == 1);
+    assert(pool.nr_free[10] == 0);
+}
+
+void test_given_zones_should_allocate_low_and_high(){
+    struct buddy_pool pool;
+    struct hbitmap hmap;
+    int low, high;
+
+    init_pool(&pool, &hmap, 16);
+    low = buddy_alloc(&pool, 3, GFP_NORM);
+    high = buddy_alloc(&pool, 3, GFP_HIGH);
+    assert(low == 16);
+    assert(high == POOL_PAGES - 3);
+    assert(buddy_peek(&pool, 1, GFP_NORM) == 19);
+    assert(buddy_peek(&pool, 1, GFP_HIGH) == POOL_PAGES - 4);
+
+    // the pages left over from the rounded up blocks can be claimed
+    assert(buddy_alloc_at(&pool, 19, 1) == 0);
+    assert(buddy_alloc_at(&pool, 19, 1) == -ENOMEM);
+    assert(check_pool(&pool) == POOL_PAGES - 23);
+
+    assert(buddy_free(&pool, low, 4) == 0);
+    assert(buddy_free(&pool, high, 3) == 0);
+    assert(check_pool(&pool) == POOL_PAGES - 16);
+    assert(pool.nr_free[4] == 1);
+    assert(pool.nr_free[9] == 1);
+}
+
+void test_given_no_aligned_block_should_use_unaligned_run(){
+    struct buddy_pool pool;
+    struct hbitmap hmap;
+    int i;
+
+    init_pool(&pool, &hmap, POOL_PAGES);
+    // free pages 5, 6, 7, 8 only, which is two blocks of 1 and 2 and one of 1
+    buddy_free(&pool, 5, 4);
+    assert(check_pool(&pool) == 4);
+    assert(pool.nr_free[2] == 0);
+    assert(buddy_alloc(&pool, 4, GFP_NORM) == 5);
+    assert(check_pool(&pool) == 0);
+    assert(buddy_alloc(&pool, 1, GFP_NORM) == -ENOMEM);
+    for(i = 0; i < POOL_PAGES; i++)
+        assert(is_bit_on(pool_map, POOL_MAP_LEN, i));
+}
+
+void test_given_random_alloc_free_should_keep_pool_consistent(){
+    struct buddy_pool pool;
+    struct hbitmap hmap;
+    struct live_range live[MAX_LIVE];
+    int nr_live = 0, used, round, i, num, start, flags;
+
+    init_pool(&pool, &hmap, 8);
+    used = 8;
+    srand(32);
+    for(round = 0; round < POOL_ROUNDS; round++){
+        if(nr_live < MAX_LIVE && (nr_live == 0 || rand() % 3)){
+            num = 1 + (rand() % 8 == 0 ? rand() % 100 : rand() % 6);
+            flags = rand() % 2 ? GFP_HIGH : GFP_NORM;
+            if(rand() % 8 == 0){
+                // extend a live range in place, as brk does
+                i = rand() % (nr_live ? nr_live : 1);
+                if(nr_live && buddy_alloc_at(&pool, live[i].start + live[i].num, num) == 0){
+                    live[i].num += num;
+                    used += num;
+                }
+                continue;
+            }
+            start = buddy_alloc(&pool, num, flags);
+            if(start < 0){
+                assert(bitmap_search_from(pool_map, POOL_MAP_LEN, 0, num) < 0);
+                continue;
+            }
+            for(i = start; i < start + num; i++)
+                assert(is_bit_on(pool_map, POOL_MAP_LEN, i));
+            live[nr_live].start = start;
+            live[nr_live].num = num;
+            nr_live++;
+            used += num;
+        }else{
+            i = rand() % nr_live;
+            assert(buddy_free(&pool, live[i].start, live[i].num) == 0);
+            used -= live[i].num;
+            live[i] = live[--nr_live];
+        }
+        if(round % 97 == 0)
+            assert(check_pool(&pool) == POOL_PAGES - used);
+    }
+    while(nr_live > 0){
+        nr_live--;
+        buddy_free(&pool, live[nr_live].start, live[nr_live].num);
+    }
+    assert(check_pool(&pool) == POOL_PAGES - 8);
+    assert(pool.nr_free[pool.max_order] == 0);
+    assert(pool.nr_free[9] == 1);
+}
@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <winix/cow.h>
+
+#define COW_PAGES           (64)
+#define COW_ROUNDS          (20000)
+
+static int cow_src[COW_PAGES];
+static int cow_refs[COW_PAGES];
+static int memory[COW_PAGES];       // content of each physical page
+static int expected[COW_PAGES];     // content each page should have once resolved
+static int nr_copies;
+
+static void copy_page(int dest, int src){
+    memory[dest] = memory[src];
+    nr_copies++;
+}
+
+static void init_table(struct cow_table *table){
+    int i;
+    assert(cow_init(table, cow_src, cow_refs, COW_PAGES, copy_page) == 0);
+    for(i = 0; i < COW_PAGES; i++){
+        memory[i] = expected[i] = i;
+    }
+    nr_copies = 0;
+}
+
+void test_cow_resolve(){
+    struct cow_table table;
+
+    init_table(&table);
+    assert(cow_share(&table, 10, 0, 4) == 0);
+    assert(nr_copies == 0);
+    assert(cow_is_pending(&table, 0) && cow_is_pending(&table, 13));
+    assert(!cow_is_pending(&table, 4));
+
+    // dest pulls from its source
+    assert(cow_resolve(&table, 11) == 1);
+    assert(memory[11] == 1 && !cow_is_pending(&table, 11) && !cow_is_pending(&table, 1));
+
+    // source pushes to its dest before it is modified
+    assert(cow_resolve(&table, 2) == 1);
+    memory[2] = 100;
+    assert(memory[12] == 2);
+    assert(cow_resolve(&table, 12) == 0);
+
+    // a dest shared again waits for the original source
+    assert(cow_share(&table, 20, 10, 1) == 0);
+    assert(cow_src[20] == 0 && cow_refs[0] == 2);
+    assert(cow_resolve(&table, 0) == 2);
+    assert(memory[10] == 0 && memory[20] == 0);
+
+    // pending pages can not be shared into
+    assert(cow_share(&table, 13, 5, 1) == -EINVAL);
+    assert(cow_share(&table, COW_PAGES - 1, 0, 2) == -EINVAL);
+}
+
+void test_cow_release(){
+    struct cow_table table;
+
+    init_table(&table);
+    assert(cow_share(&table, 10, 0, 2) == 0);
+    assert(cow_share(&table, 20, 0, 2) == 0);
+    assert(cow_share(&table, 30, 0, 2) == 0);
+
+    // freeing a dest drops its copy
+    assert(cow_release(&table, 10) == 0);
+    assert(cow_refs[0] == 2 && nr_copies == 0);
+
+    // freeing a source copies once and hands the rest over
+    assert(cow_release(&table, 0) == 1);
+    assert(memory[20] == 0 && !cow_is_pending(&table, 0));
+    assert(cow_src[30] == 20 && cow_refs[20] == 1);
+    assert(cow_resolve(&table, 30) == 1 && memory[30] == 0);
+    assert(nr_copies == 2);
+}
+
+void test_cow_random(){
+    struct cow_table table;
+    int round, page, dest, src, num, i;
+
+    srand(35);
+    init_table(&table);
+    for(round = 0; round < COW_ROUNDS; round++){
+        switch(rand() % 4){
+            case 0:
+                // fork a range into a range that is not waiting for anything
+                num = 1 + rand() % 4;
+                src = rand() % (COW_PAGES - num);
+                dest = rand() % (COW_PAGES - num);
+                if(dest < src + num && src < dest + num)
+                    break;
+                for(i = 0; i < num; i++){
+                    if(cow_is_pending(&table, dest + i))
+                        break;
+                }
+                if(i < num){
+                    assert(cow_share(&table, dest, src, num) == -EINVAL);
+                    break;
+                }
+                assert(cow_share(&table, dest, src, num) == 0);
+                for(i = 0; i < num; i++){
+                    expected[dest + i] = expected[src + i];
+                }
+                break;
+
+            case 1:
+                // write to a page
+                page = rand() % COW_PAGES;
+                assert(cow_resolve(&table, page) >= 0);
+                assert(!cow_is_pending(&table, page));
+                memory[page] = expected[page] = round + COW_PAGES;
+                break;
+
+            case 2:
+                // read a page
+                page = rand() % COW_PAGES;
+                assert(cow_resolve(&table, page) >= 0);
+                assert(memory[page] == expected[page]);
+                break;
+
+            default:
+                // free a page and reuse it with fresh content
+                page = rand() % COW_PAGES;
+                assert(cow_release(&table, page) >= 0);
+                assert(!cow_is_pending(&table, page));
+                memory[page] = expected[page] = -round;
+                break;
+        }
+    }
+    for(page = 0; page < COW_PAGES; page++){
+        assert(cow_resolve(&table, page) >= 0);
+        assert(memory[page] == expected[page]);
+    }
+    for(page = 0; page < COW_PAGES; page++){
+        assert(cow_src[page] == COW_NONE && cow_refs[page] == 0);
+    }
+}
@@ -1,6 +1,7 @@
 #include <fs/fs.h>
 #include <assert.h>
 #include "unit_test.h"
+#include "../fs/mock/mock.h"
 
 void test_given_zone_iterator_should_return(){
     struct zone_iterator iter;
@@ -282,3 +283,113 @@ void test_given_iter_dirent_has_next_when_non_empty_option_should_return_false()
 
     assert(iter_dirent_close(&iter) == 0);
 }
+
+void test_given_unlink_should_clear_inode_map_and_keep_root(){
+    struct device* dev = get_dev(ROOT_DEV);
+    struct inode* root;
+    struct stat statbuf;
+    int fd, ret, inum;
+
+    fd = sys_creat(curr_scheduling_proc, FILE1, 0755);
+    assert(fd == 0);
+    ret = sys_fstat(curr_scheduling_proc, fd, &statbuf);
+    assert(ret == 0);
+    inum = statbuf.st_ino;
+    assert(is_inode_in_use(inum, dev));
+
+    ret = sys_close(curr_scheduling_proc, fd);
+    assert(ret == 0);
+    ret = sys_unlink(curr_scheduling_proc, FILE1, false);
+    assert(ret == 0);
+    assert(!is_inode_in_use(inum, dev));
+
+    root = get_inode(ROOT_INODE_NUM, dev);
+    assert(root != NULL);
+    assert(S_ISDIR(root->i_mode));
+    put_inode(root, false);
+}
+
+int release_block(block_t bnr, struct device* id);
+
+static void reset_fs_geometry(size_t blocks, unsigned int inode_ratio){
+    struct fs_geometry geometry;
+    int ret;
+
+    geometry.disk_size = blocks * BLOCK_SIZE;
+    geometry.inode_ratio = inode_ratio;
+    ret = init_disk_geometry(&geometry);
+    assert(ret == 0);
+    init_dev();
+    init_fs();
+    init_drivers();
+}
+
+void test_given_large_disk_when_alloc_all_blocks_should_span_bitmap_blocks(){
+    struct device* dev;
+    struct superblock* sb;
+    unsigned int blocks = BITMAP_BITS_PER_BLOCK + 3000;
+    unsigned int free_blocks, i;
+    int bnr, last = 0;
+
+    reset_fs_geometry(blocks, 0);
+    dev = get_dev(ROOT_DEV);
+    sb = get_sb(dev);
+    assert(sb->s_blockmap_size == 2 * BLOCK_SIZE);
+    assert(sb->s_inodemapnr == sb->s_blockmapnr + 2);
+    assert(sb->s_block_inuse + sb->s_free_blocks == blocks);
+
+    free_blocks = sb->s_free_blocks;
+    for(i = 0; i < free_blocks; i++){
+        bnr = alloc_block(NULL, dev);
+        assert(bnr > last);
+        last = bnr;
+    }
+    assert(last == blocks - 1);
+    assert(sb->s_free_blocks == 0);
+    assert(alloc_block(NULL, dev) == -ENOSPC);
+
+    assert(release_block(BITMAP_BITS_PER_BLOCK + 10, dev) == 0);
+    assert(sb->s_free_blocks == 1);
+    assert(alloc_block(NULL, dev) == BITMAP_BITS_PER_BLOCK + 10);
+    reset_fs();
+}
+
+void test_given_large_disk_when_alloc_all_inodes_should_span_bitmap_blocks(){
+    struct device* dev;
+    struct superblock* sb;
+    struct inode* ino;
+    unsigned int free_inodes, i;
+    int high = BITMAP_BITS_PER_BLOCK + 5;
+    int last = ROOT_INODE_NUM;
+
+    reset_fs_geometry(BITMAP_BITS_PER_BLOCK * 2, BLOCK_SIZE);
+    dev = get_dev(ROOT_DEV);
+    sb = get_sb(dev);
+    assert(sb->s_inodemap_size >= 2 * BLOCK_SIZE);
+
+    free_inodes = sb->s_free_inodes;
+    assert(free_inodes > BITMAP_BITS_PER_BLOCK);
+    for(i = 0; i < free_inodes; i++){
+        ino = alloc_inode(dev, dev);
+        assert(ino != NULL);
+        assert(ino->i_num == last + 1);
+        last = ino->i_num;
+        put_inode(ino, true);
+        // drop it from the in core inode table
+        ino->i_num = 0;
+    }
+    assert(sb->s_free_inodes == 0);
+    assert(alloc_inode(dev, dev) == NULL);
+    assert(is_inode_in_use(high, dev));
+
+    ino = get_inode(high, dev);
+    assert(ino != NULL);
+    put_inode(ino, false);
+    assert(_release_inode(ino, false) == 0);
+    assert(!is_inode_in_use(high, dev));
+
+    ino = alloc_inode(dev, dev);
+    assert(ino != NULL && ino->i_num == high);
+    put_inode(ino, true);
+    reset_fs();
+}
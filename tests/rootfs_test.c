@@ -0,0 +1,58 @@
+#include <fs/fs.h>
+#include "unit_test.h"
+#include <assert.h>
+#include <stdlib.h>
+
+void test_given_disk_rle_when_compress_and_expand_should_match_disk(){
+    unsigned int *rle, *disk;
+    int len, ret;
+
+    rle = malloc(DISK_SIZE_DWORD * 2 * sizeof(unsigned int));
+    disk = malloc(DISK_SIZE_DWORD * sizeof(unsigned int));
+    assert(rle && disk);
+
+    assert(DISK_RAW_SIZE == DISK_SIZE);
+    len = disk_rle_compress(rle, DISK_SIZE_DWORD * 2, (unsigned int *)DISK_RAW, DISK_SIZE_DWORD);
+    assert(len > 0);
+    assert(len < DISK_SIZE_DWORD / 2);
+
+    memset(disk, 0xff, DISK_SIZE_DWORD * sizeof(unsigned int));
+    ret = disk_rle_expand(disk, DISK_SIZE_DWORD, rle, len);
+    assert(ret == DISK_SIZE_DWORD);
+    assert(memcmp(disk, DISK_RAW, DISK_SIZE) == 0);
+
+    free(rle);
+    free(disk);
+}
+
+void test_given_disk_rle_when_short_zero_runs_should_keep_literals(){
+    unsigned int src[] = {1, 0, 0, 2, 0, 0, 0, 0, 3};
+    unsigned int rle[16], dst[9];
+    int len, ret;
+
+    len = disk_rle_compress(rle, 16, src, 9);
+    assert(len == 8);
+    assert(rle[0] == 4);
+    assert(rle[5] == (DISK_RLE_ZERO_RUN | 4));
+    assert(rle[6] == 1);
+
+    ret = disk_rle_compress(rle, 4, src, 9);
+    assert(ret == -ENOSPC);
+
+    len = disk_rle_compress(rle, 16, src, 9);
+    ret = disk_rle_expand(dst, 9, rle, len);
+    assert(ret == 9);
+    assert(memcmp(dst, src, sizeof(src)) == 0);
+}
+
+void test_given_disk_rle_when_stream_overflows_should_return_einval(){
+    unsigned int rle[] = {DISK_RLE_ZERO_RUN | 8, 2, 1};
+    unsigned int dst[16];
+    int ret;
+
+    ret = disk_rle_expand(dst, 4, rle, 1);
+    assert(ret == -EINVAL);
+
+    ret = disk_rle_expand(dst, 16, rle, 3);
+    assert(ret == -EINVAL);
+}
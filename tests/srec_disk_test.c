@@ -0,0 +1,155 @@
+#include <stdlib.h>
+#include <fs/fs.h>
+#include <assert.h>
+#include "unit_test.h"
+#include "../fs/mock/mock.h"
+#include "../fs/fsutil/srec_disk.h"
+
+#define SREC_WORDS      (64)
+#define SREC_OFFSET     (1024)
+
+static void write_program(const char* dir, const char* name, unsigned int seed){
+    char path[PATH_MAX];
+    unsigned int checksum, word;
+    int i, j;
+    FILE *fp;
+
+    snprintf(path, PATH_MAX, "%s/%s.srec", dir, name);
+    fp = fopen(path, "w");
+    assert(fp != NULL);
+    for(i = 0; i < SREC_WORDS; i++){
+        word = seed * 2654435761u + i;
+        checksum = 9 + ((i >> 8) & 0xff) + (i & 0xff);
+        for(j = 0; j < 4; j++)
+            checksum += (word >> (24 - j * 8)) & 0xff;
+        fprintf(fp, "S309%08X%08X%02X\n", i, word, ~checksum & 0xff);
+    }
+    checksum = 5 + ((seed >> 8) & 0xff) + (seed & 0xff);
+    fprintf(fp, "S705%08X%02X\n", seed, ~checksum & 0xff);
+    fclose(fp);
+
+    snprintf(path, PATH_MAX, "%s/%s.verbose", dir, name);
+    fp = fopen(path, "w");
+    assert(fp != NULL);
+    fprintf(fp, ".text segment size = 0x%08x\n", SREC_WORDS);
+    fclose(fp);
+}
+
+static void remove_program(const char* dir, const char* name){
+    char path[PATH_MAX];
+
+    snprintf(path, PATH_MAX, "%s/%s.srec", dir, name);
+    remove(path);
+    snprintf(path, PATH_MAX, "%s/%s.verbose", dir, name);
+    remove(path);
+}
+
+static void save_image(const char* image, struct list_head* manifest, unsigned long long version){
+    flush_all_buffer();
+    flush_inodes();
+    flush_super_block(get_dev(ROOT_DEV));
+    write_disk_image((char *)image);
+    write_manifest(manifest, image, version);
+    free_manifest(manifest);
+}
+
+static bool manifest_has(const char* image, const char* name){
+    char path[PATH_MAX], line[256];
+    size_t len = strlen(name);
+    bool found = false;
+    FILE *fp;
+
+    snprintf(path, PATH_MAX, "%s.manifest", image);
+    fp = fopen(path, "r");
+    assert(fp != NULL);
+    while(fgets(line, sizeof(line), fp)){
+        if(strncmp(line, name, len) == 0 && line[len] == ' ')
+            found = true;
+    }
+    fclose(fp);
+    return found;
+}
+
+static struct stat stat_bin(const char* name){
+    char path[PATH_MAX];
+    struct stat statbuf;
+
+    snprintf(path, PATH_MAX, "/bin/%s", name);
+    assert(sys_stat(curr_scheduling_proc, path, &statbuf) == 0);
+    return statbuf;
+}
+
+static unsigned int get_binary_pc(const char* name){
+    char path[PATH_MAX];
+    struct winix_elf elf;
+    int fd;
+
+    snprintf(path, PATH_MAX, "/bin/%s", name);
+    fd = sys_open(curr_scheduling_proc, path, O_RDONLY, 0);
+    assert(fd >= 0);
+    assert(sys_read(curr_scheduling_proc, fd, &elf, sizeof(elf)) == sizeof(elf));
+    assert(sys_close(curr_scheduling_proc, fd) == 0);
+    return elf.binary_pc;
+}
+
+void test_given_previous_image_when_incremental_build_should_only_rewrite_changes(){
+    char dir[] = "/tmp/srec_diskXXXXXX";
+    char image[PATH_MAX], path[PATH_MAX];
+    unsigned long long version = 0x1234;
+    struct list_head manifest;
+
+    assert(mkdtemp(dir) != NULL);
+    snprintf(image, PATH_MAX, "%s/disk.img", dir);
+    write_program(dir, "kept", 0x400);
+    write_program(dir, "changed", 0x500);
+    write_program(dir, "removed", 0x600);
+
+    // full build
+    set_start_unix_time(100);
+    INIT_LIST_HEAD(&manifest);
+    assert(load_manifest(&manifest, image, version) == -ENOENT);
+    assert(write_srec_to_disk(dir, SREC_OFFSET, &manifest) == 0);
+    assert(stat_bin("kept").st_mtime == 100);
+    assert(get_binary_pc("changed") == 0x500);
+    save_image(image, &manifest, version);
+    assert(manifest_has(image, "removed"));
+
+    write_program(dir, "changed", 0x501);
+    remove_program(dir, "removed");
+
+    // a manifest of another fsutil is not reused
+    INIT_LIST_HEAD(&manifest);
+    assert(load_manifest(&manifest, image, version + 1) == -EINVAL);
+    assert(load_manifest(&manifest, image, 0) == -EINVAL);
+    free_manifest(&manifest);
+
+    // incremental build
+    set_start_unix_time(200);
+    INIT_LIST_HEAD(&manifest);
+    assert(load_manifest(&manifest, image, version) == 0);
+    assert(load_disk_image(image) == 0);
+    assert(write_srec_to_disk(dir, SREC_OFFSET, &manifest) == 0);
+
+    assert(stat_bin("kept").st_mtime == 100);
+    assert(get_binary_pc("kept") == 0x400);
+    assert(stat_bin("changed").st_mtime == 200);
+    assert(get_binary_pc("changed") == 0x501);
+    assert(sys_access(curr_scheduling_proc, "/bin/removed", F_OK) == -ENOENT);
+
+    // a reused image is dated at the time of the build
+    stamp_inodes(get_dev(ROOT_DEV), 300);
+    assert(stat_bin("kept").st_mtime == 300);
+
+    // the dropped binary is gone from the new manifest as well
+    save_image(image, &manifest, version);
+    assert(manifest_has(image, "kept"));
+    assert(!manifest_has(image, "removed"));
+
+    snprintf(path, PATH_MAX, "%s.manifest", image);
+    remove_program(dir, "kept");
+    remove_program(dir, "changed");
+    remove(path);
+    remove(image);
+    remove(dir);
+    set_start_unix_time(0);
+}
@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <time.h>
+#include <winix/list.h>
+#include <winix/welf.h>
+#include "../fs/fsutil/srec_import.h"
+
+#define BENCH_FILES         (8)
+#define BENCH_RECORDS       (20000)
+#define BENCH_WORDS         (4)
+
+static double now_ms(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static void write_record(FILE *fp, int type, unsigned int address, unsigned int *words, int nr_words){
+    unsigned int checksum;
+    int byte_count = 4 + nr_words * 4 + 1;
+    int i, j;
+
+    checksum = byte_count;
+    fprintf(fp, "S%d%02X%08X", type, byte_count, address);
+    for(i = 0; i < 4; i++)
+        checksum += (address >> (24 - i * 8)) & 0xff;
+    for(i = 0; i < nr_words; i++){
+        fprintf(fp, "%08x", words[i]);
+        for(j = 0; j < 4; j++)
+            checksum += (words[i] >> (24 - j * 8)) & 0xff;
+    }
+    fprintf(fp, "%02X\n", ~checksum & 0xff);
+}
+
+static void write_corpus_file(const char *path, int seed){
+    unsigned int words[BENCH_WORDS];
+    FILE *fp = fopen(path, "w");
+    int i, j;
+    assert(fp != NULL);
+    srand(seed);
+    for(i = 0; i < BENCH_RECORDS; i++){
+        for(j = 0; j < BENCH_WORDS; j++)
+            words[j] = (unsigned int)rand() ^ ((unsigned int)rand() << 16);
+        write_record(fp, 3, i * BENCH_WORDS, words, BENCH_WORDS);
+    }
+    write_record(fp, 7, 0x400 + seed, NULL, 0);
+    fclose(fp);
+}
+
+/* the original fgets and per digit shift decoder, kept as the reference */
+static int reference_hex2int(const char *a, int len){
+    int i, val = 0;
+    for (i = 0; i < len; i++){
+        if (a[i] <= '9')
+            val += (a[i] - 48) * (1 << (4 * (len - 1 - i)));
+        else if (a[i] <= 'F')
+            val += (a[i] - 55) * (1 << (4 * (len - 1 - i)));
+        else if(a[i] <= 'f')
+            val += (a[i] - 87) * (1 << (4 * (len - 1 - i)));
+    }
+    return val;
+}
+
+static void reference_decode(const char *path, unsigned int **data, unsigned int *len, unsigned int *pc){
+    char line[10240];
+    unsigned int size = 1024, idx = 0, word;
+    int byte_count, i, type;
+    FILE *fp = fopen(path, "r");
+    assert(fp != NULL);
+    *data = malloc(size * sizeof(unsigned int));
+    while(fgets(line, sizeof(line), fp)){
+        type = line[1] - '0';
+        byte_count = reference_hex2int(line + 2, 2);
+        if(type == 7){
+            *pc = reference_hex2int(line + 4, 8);
+            continue;
+        }
+        for(i = 0; i < (byte_count - 5) / 4; i++){
+            word = (unsigned int)reference_hex2int(line + 12 + i * 8, 8);
+            (*data)[idx++] = word;
+            if(idx >= size){
+                size += 1024;
+                *data = realloc(*data, size * sizeof(unsigned int));
+            }
+        }
+    }
+    fclose(fp);
+    *len = idx;
+}
+
+void test_given_srec_corpus_when_decode_in_parallel_should_match_reference(){
+    char dir[] = "/tmp/srec_benchXXXXXX";
+    struct srec_job jobs[BENCH_FILES];
+    struct srec_binary binaries[BENCH_FILES];
+    unsigned int *ref_data[BENCH_FILES];
+    unsigned int ref_len[BENCH_FILES], ref_pc[BENCH_FILES];
+    double start, reference_ms, serial_ms, parallel_ms;
+    int i, ret;
+
+    assert(mkdtemp(dir) != NULL);
+    for(i = 0; i < BENCH_FILES; i++){
+        snprintf(jobs[i].path, SREC_PATH_LEN, "%s/prog%d.srec", dir, i);
+        write_corpus_file(jobs[i].path, i);
+    }
+
+    start = now_ms();
+    for(i = 0; i < BENCH_FILES; i++)
+        reference_decode(jobs[i].path, &ref_data[i], &ref_len[i], &ref_pc[i]);
+    reference_ms = now_ms() - start;
+
+    /* decode_srec() strips the extension from the path it is given */
+    start = now_ms();
+    for(i = 0; i < BENCH_FILES; i++){
+        snprintf(jobs[i].path, SREC_PATH_LEN, "%s/prog%d.srec", dir, i);
+        jobs[i].binary = &binaries[i];
+        jobs[i].debug = NULL;
+    }
+    ret = decode_srec_jobs(jobs, BENCH_FILES, 1024, 1);
+    assert(ret == 0);
+    serial_ms = now_ms() - start;
+    for(i = 0; i < BENCH_FILES; i++)
+        free(binaries[i].binary_data);
+
+    start = now_ms();
+    for(i = 0; i < BENCH_FILES; i++)
+        snprintf(jobs[i].path, SREC_PATH_LEN, "%s/prog%d.srec", dir, i);
+    ret = decode_srec_jobs(jobs, BENCH_FILES, 1024, 0);
+    assert(ret == 0);
+    parallel_ms = now_ms() - start;
+
+    for(i = 0; i < BENCH_FILES; i++){
+        assert(binaries[i].binary_idx == ref_len[i]);
+        assert(binaries[i].binary_idx == BENCH_RECORDS * BENCH_WORDS);
+        assert(binaries[i].binary_pc == ref_pc[i]);
+        assert(binaries[i].binary_offset == 1024);
+        assert(memcmp(binaries[i].binary_data, ref_data[i], ref_len[i] * sizeof(unsigned int)) == 0);
+        free(binaries[i].binary_data);
+        free(ref_data[i]);
+
+        snprintf(jobs[i].path, SREC_PATH_LEN, "%s/prog%d.srec", dir, i);
+        unlink(jobs[i].path);
+    }
+    rmdir(dir);
+
+    printf("srec decode %d x %d records: reference %.1fms, serial %.1fms, parallel %.1fms\n",
+        BENCH_FILES, BENCH_RECORDS, reference_ms, serial_ms, parallel_ms);
+}
+
+void test_given_srec_record_when_checksum_wrong_should_skip(){
+    struct srec_binary result;
+    char good[] = "S3150000000000112233445566778899AABBCCDDEEFFF2";
+    char bad[] = "S3150000000000112233445566778899AABBCCDDEEFFF3";
+    int ret;
+
+    init_srec_binary_struct(&result);
+    ret = winix_load_srec_mem_val(good, strlen(good), &result);
+    assert(ret == 4);
+    assert(result.binary_data[0] == 0x00112233);
+    assert(result.binary_data[3] == 0xccddeeff);
+
+    ret = winix_load_srec_mem_val(bad, strlen(bad), &result);
+    assert(ret == 0);
+    ret = winix_load_srec_mem_val(good, 10, &result);
+    assert(ret == 0);
+    assert(result.binary_idx == 4);
+    free(result.binary_data);
+}
@@ -0,0 +1,543 @@
+#include <sys/fcntl.h>
+#include <stdio.h>
+#include "unit_test.h"
+
+void test_given_cmdline_when_4_pipes_should_return_4();
+void test_given_cmdline_when_args_4_pipes_should_return_4();
+void test_given_cmdline_when_args_5_pipes_should_return_5();
+void test_given_cmdline_when_line_break_should_return_3();
+void test_given_bitmask_should_return_aligned();
+void test_given_word_should_find_first_set_bit();
+void test_given_random_maps_when_search_should_match_reference();
+void test_given_nbits_should_set_and_clear_across_words();
+void test_given_sparse_and_dense_maps_should_benchmark_search();
+void test_given_random_operations_hbitmap_should_match_flat_bitmap();
+void test_given_fragmented_map_should_benchmark_hbitmap_alloc();
+void test_cow_resolve();
+void test_cow_release();
+void test_cow_random();
+void test_given_fresh_pool_should_hold_free_pages_in_max_blocks();
+void test_given_zones_should_allocate_low_and_high();
+void test_given_no_aligned_block_should_use_unaligned_run();
+void test_given_random_alloc_free_should_keep_pool_consistent();
+void test_given_zone_iterator_should_return();
+void test_given_has_next_zone_when_exceed_max_should_return_false();
+void test_given_has_next_zone_when_no_zone_should_return_false();
+void test_given_has_next_zone_when_have_zone_should_return_true();
+void test_given_has_next_zone_when_zone_exhausted_should_return_false();
+void test_given_has_next_zone_when_alloc_zone_should_continue();
+void test_given_iter_dirent_has_next_when_has_data_should_return_true();
+void test_given_iter_dirent_has_next_when_dirent_exhausted_should_return_false();
+void test_given_iter_dirent_has_next_when_non_empty_option_should_return_false();
+void test_given_unlink_should_clear_inode_map_and_keep_root();
+void test_given_large_disk_when_alloc_all_blocks_should_span_bitmap_blocks();
+void test_given_large_disk_when_alloc_all_inodes_should_span_bitmap_blocks();
+void test_rmdir_file_should_fail();
+void test_rmdir_empty_directory_should_succeed();
+void test_rmdir_non_emtpy_directory_should_fail_with_enotempty();
+void test_given_open_when_flag_is_o_create_should_return_0();
+void test_given_open_when_openned_max_exceeds_should_return_emfile();
+void test_given_open_when_openned_exceeds_system_limit_should_return_enfile();
+void test_given_open_when_flag_write_and_path_directory_should_return_eisdir();
+void test_given_creat_when_file_not_present_should_return_0();
+void test_given_creat_when_file_present_should_return_eexist();
+void test_given_close_when_file_closed_should_return_ebadf();
+void test_given_read_when_fd_is_closed_return_ebadf();
+void test_given_write_when_fd_is_closed_return_ebadf();
+void test_given_open_when_deleting_file_should_return_error();
+void test_given_dup_when_dupping_file_should_result_in_same_fd();
+void test_given_read_when_open_and_closing_file_should_persistted_data();
+void test_given_read_when_o_direct_open_and_closing_file_should_persistted_data();
+void test_given_access_when_file_not_exist_should_return_enoent();
+void test_given_access_when_file_exists_should_return_0();
+void test_given_access_when_folder_exists_should_return_0();
+void test_given_access_when_under_folder_should_return_enoent();
+void test_given_link_stat_when_two_files_are_linked_should_return_same();
+void test_given_link_stat_when_one_file_deleted_should_return_1_nlink();
+void test_given_chdir_when_dir_not_present_should_return_eexist();
+void test_given_chdir_when_path_is_file_should_return_eexist();
+void test_given_chdir_when_dir_is_valid_should_succeed();
+void test_given_chmod_when_file_not_present_should_return_enonent();
+void test_given_chmod_stat_when_file_present_should_return_0();
+void test_given_chmod_stat_when_folder_present_should_return_0();
+void test_given_getdents_when_no_files_in_folder_should_return_default_files();
+void test_given_getdents_when_files_in_folder_should_return_files();
+void test_given_getdents_when_successive_call_should_return_files();
+void test_given_cwd_when_chdir_should_return_path();
+void test_given_cwd_when_path_is_1_should_return_einvalid();
+void test_given_mknod_when_path_valid_should_return_0();
+void test_given_dev_open_when_file_is_driver_should_return_from_driver();
+void test_given_dev_read_when_file_is_driver_should_return_from_driver();
+void test_given_dev_write_when_file_is_driver_should_return_from_driver();
+void test_given_dev_close_when_file_is_driver_should_return_from_driver();
+void test_given_dev_dup_when_file_is_driver_should_return_from_driver();
+void test_when_zone_full_should_return_enospc();
+void test_given_directory_when_read_should_return_eisdir();
+void test_given_directory_when_write_should_return_eisdir();
+void test_given_srec_corpus_when_decode_in_parallel_should_match_reference();
+void test_given_srec_record_when_checksum_wrong_should_skip();
+void test_given_pipe_read_when_no_data_in_pipe_should_return_suspend();
+void test_given_pipe_write_when_no_data_in_pipe_should_return_succeed();
+void test_given_pipe_write_when_pipe_is_full_should_return_suspend();
+void test_given_pipe_read_when_proc_was_suspended_should_return();
+void test_given_pipe_read_when_data_is_written_should_return_data();
+void test_given_pipe_read_when_pipe_is_full_should_return_data();
+void test_given_pipe_read_when_writer_write_fd_closed_should_return_suspend();
+void test_given_pipe_read_when_all_write_fds_closed_should_return_0();
+void test_given_pipe_write_when_one_read_fd_s_closed_should_return_success();
+void test_given_pipe_write_when_read_fd_are_closed_should_return_sigpipe();
+void test_given_pipe_write_when_read_fd_closed_and_sigpipe_ignored_should_return_epipe();
+void test_given_previous_image_when_incremental_build_should_only_rewrite_changes();
+void test_given_disk_rle_when_compress_and_expand_should_match_disk();
+void test_given_disk_rle_when_short_zero_runs_should_keep_literals();
+void test_given_disk_rle_when_stream_overflows_should_return_einval();
+
+int main(){
+    printf("%s\n", "running test_given_cmdline_when_4_pipes_should_return_4");
+    reset_fs();
+    test_given_cmdline_when_4_pipes_should_return_4();
+    printf("%s\n\n", "passed: test_given_cmdline_when_4_pipes_should_return_4");
+
+    printf("%s\n", "running test_given_cmdline_when_args_4_pipes_should_return_4");
+    reset_fs();
+    test_given_cmdline_when_args_4_pipes_should_return_4();
+    printf("%s\n\n", "passed: test_given_cmdline_when_args_4_pipes_should_return_4");
+
+    printf("%s\n", "running test_given_cmdline_when_args_5_pipes_should_return_5");
+    reset_fs();
+    test_given_cmdline_when_args_5_pipes_should_return_5();
+    printf("%s\n\n", "passed: test_given_cmdline_when_args_5_pipes_should_return_5");
+
+    printf("%s\n", "running test_given_cmdline_when_line_break_should_return_3");
+    reset_fs();
+    test_given_cmdline_when_line_break_should_return_3();
+    printf("%s\n\n", "passed: test_given_cmdline_when_line_break_should_return_3");
+
+    printf("%s\n", "running test_given_bitmask_should_return_aligned");
+    reset_fs();
+    test_given_bitmask_should_return_aligned();
+    printf("%s\n\n", "passed: test_given_bitmask_should_return_aligned");
+
+    printf("%s\n", "running test_given_word_should_find_first_set_bit");
+    reset_fs();
+    test_given_word_should_find_first_set_bit();
+    printf("%s\n\n", "passed: test_given_word_should_find_first_set_bit");
+
+    printf("%s\n", "running test_given_random_maps_when_search_should_match_reference");
+    reset_fs();
+    test_given_random_maps_when_search_should_match_reference();
+    printf("%s\n\n", "passed: test_given_random_maps_when_search_should_match_reference");
+
+    printf("%s\n", "running test_given_nbits_should_set_and_clear_across_words");
+    reset_fs();
+    test_given_nbits_should_set_and_clear_across_words();
+    printf("%s\n\n", "passed: test_given_nbits_should_set_and_clear_across_words");
+
+    printf("%s\n", "running test_given_sparse_and_dense_maps_should_benchmark_search");
+    reset_fs();
+    test_given_sparse_and_dense_maps_should_benchmark_search();
+    printf("%s\n\n", "passed: test_given_sparse_and_dense_maps_should_benchmark_search");
+
+    printf("%s\n", "running test_given_random_operations_hbitmap_should_match_flat_bitmap");
+    reset_fs();
+    test_given_random_operations_hbitmap_should_match_flat_bitmap();
+    printf("%s\n\n", "passed: test_given_random_operations_hbitmap_should_match_flat_bitmap");
+
+    printf("%s\n", "running test_given_fragmented_map_should_benchmark_hbitmap_alloc");
+    reset_fs();
+    test_given_fragmented_map_should_benchmark_hbitmap_alloc();
+    printf("%s\n\n", "passed: test_given_fragmented_map_should_benchmark_hbitmap_alloc");
+
+    printf("%s\n", "running test_cow_resolve");
+    reset_fs();
+    test_cow_resolve();
+    printf("%s\n\n", "passed: test_cow_resolve");
+
+    printf("%s\n", "running test_cow_release");
+    reset_fs();
+    test_cow_release();
+    printf("%s\n\n", "passed: test_cow_release");
+
+    printf("%s\n", "running test_cow_random");
+    reset_fs();
+    test_cow_random();
+    printf("%s\n\n", "passed: test_cow_random");
+
+    printf("%s\n", "running test_given_fresh_pool_should_hold_free_pages_in_max_blocks");
+    reset_fs();
+    test_given_fresh_pool_should_hold_free_pages_in_max_blocks();
+    printf("%s\n\n", "passed: test_given_fresh_pool_should_hold_free_pages_in_max_blocks");
+
+    printf("%s\n", "running test_given_zones_should_allocate_low_and_high");
+    reset_fs();
+    test_given_zones_should_allocate_low_and_high();
+    printf("%s\n\n", "passed: test_given_zones_should_allocate_low_and_high");
+
+    printf("%s\n", "running test_given_no_aligned_block_should_use_unaligned_run");
+    reset_fs();
+    test_given_no_aligned_block_should_use_unaligned_run();
+    printf("%s\n\n", "passed: test_given_no_aligned_block_should_use_unaligned_run");
+
+    printf("%s\n", "running test_given_random_alloc_free_should_keep_pool_consistent");
+    reset_fs();
+    test_given_random_alloc_free_should_keep_pool_consistent();
+    printf("%s\n\n", "passed: test_given_random_alloc_free_should_keep_pool_consistent");
+
+    printf("%s\n", "running test_given_zone_iterator_should_return");
+    reset_fs();
+    test_given_zone_iterator_should_return();
+    printf("%s\n\n", "passed: test_given_zone_iterator_should_return");
+
+    printf("%s\n", "running test_given_has_next_zone_when_exceed_max_should_return_false");
+    reset_fs();
+    test_given_has_next_zone_when_exceed_max_should_return_false();
+    printf("%s\n\n", "passed: test_given_has_next_zone_when_exceed_max_should_return_false");
+
+    printf("%s\n", "running test_given_has_next_zone_when_no_zone_should_return_false");
+    reset_fs();
+    test_given_has_next_zone_when_no_zone_should_return_false();
+    printf("%s\n\n", "passed: test_given_has_next_zone_when_no_zone_should_return_false");
+
+    printf("%s\n", "running test_given_has_next_zone_when_have_zone_should_return_true");
+    reset_fs();
+    test_given_has_next_zone_when_have_zone_should_return_true();
+    printf("%s\n\n", "passed: test_given_has_next_zone_when_have_zone_should_return_true");
+
+    printf("%s\n", "running test_given_has_next_zone_when_zone_exhausted_should_return_false");
+    reset_fs();
+    test_given_has_next_zone_when_zone_exhausted_should_return_false();
+    printf("%s\n\n", "passed: test_given_has_next_zone_when_zone_exhausted_should_return_false");
+
+    printf("%s\n", "running test_given_has_next_zone_when_alloc_zone_should_continue");
+    reset_fs();
+    test_given_has_next_zone_when_alloc_zone_should_continue();
+    printf("%s\n\n", "passed: test_given_has_next_zone_when_alloc_zone_should_continue");
+
+    printf("%s\n", "running test_given_iter_dirent_has_next_when_has_data_should_return_true");
+    reset_fs();
+    test_given_iter_dirent_has_next_when_has_data_should_return_true();
+    printf("%s\n\n", "passed: test_given_iter_dirent_has_next_when_has_data_should_return_true");
+
+    printf("%s\n", "running test_given_iter_dirent_has_next_when_dirent_exhausted_should_return_false");
+    reset_fs();
+    test_given_iter_dirent_has_next_when_dirent_exhausted_should_return_false();
+    printf("%s\n\n", "passed: test_given_iter_dirent_has_next_when_dirent_exhausted_should_return_false");
+
+    printf("%s\n", "running test_given_iter_dirent_has_next_when_non_empty_option_should_return_false");
+    reset_fs();
+    test_given_iter_dirent_has_next_when_non_empty_option_should_return_false();
+    printf("%s\n\n", "passed: test_given_iter_dirent_has_next_when_non_empty_option_should_return_false");
+
+    printf("%s\n", "running test_given_unlink_should_clear_inode_map_and_keep_root");
+    reset_fs();
+    test_given_unlink_should_clear_inode_map_and_keep_root();
+    printf("%s\n\n", "passed: test_given_unlink_should_clear_inode_map_and_keep_root");
+
+    printf("%s\n", "running test_given_large_disk_when_alloc_all_blocks_should_span_bitmap_blocks");
+    reset_fs();
+    test_given_large_disk_when_alloc_all_blocks_should_span_bitmap_blocks();
+    printf("%s\n\n", "passed: test_given_large_disk_when_alloc_all_blocks_should_span_bitmap_blocks");
+
+    printf("%s\n", "running test_given_large_disk_when_alloc_all_inodes_should_span_bitmap_blocks");
+    reset_fs();
+    test_given_large_disk_when_alloc_all_inodes_should_span_bitmap_blocks();
+    printf("%s\n\n", "passed: test_given_large_disk_when_alloc_all_inodes_should_span_bitmap_blocks");
+
+    printf("%s\n", "running test_rmdir_file_should_fail");
+    reset_fs();
+    test_rmdir_file_should_fail();
+    printf("%s\n\n", "passed: test_rmdir_file_should_fail");
+
+    printf("%s\n", "running test_rmdir_empty_directory_should_succeed");
+    reset_fs();
+    test_rmdir_empty_directory_should_succeed();
+    printf("%s\n\n", "passed: test_rmdir_empty_directory_should_succeed");
+
+    printf("%s\n", "running test_rmdir_non_emtpy_directory_should_fail_with_enotempty");
+    reset_fs();
+    test_rmdir_non_emtpy_directory_should_fail_with_enotempty();
+    printf("%s\n\n", "passed: test_rmdir_non_emtpy_directory_should_fail_with_enotempty");
+
+    printf("%s\n", "running test_given_open_when_flag_is_o_create_should_return_0");
+    reset_fs();
+    test_given_open_when_flag_is_o_create_should_return_0();
+    printf("%s\n\n", "passed: test_given_open_when_flag_is_o_create_should_return_0");
+
+    printf("%s\n", "running test_given_open_when_openned_max_exceeds_should_return_emfile");
+    reset_fs();
+    test_given_open_when_openned_max_exceeds_should_return_emfile();
+    printf("%s\n\n", "passed: test_given_open_when_openned_max_exceeds_should_return_emfile");
+
+    printf("%s\n", "running test_given_open_when_openned_exceeds_system_limit_should_return_enfile");
+    reset_fs();
+    test_given_open_when_openned_exceeds_system_limit_should_return_enfile();
+    printf("%s\n\n", "passed: test_given_open_when_openned_exceeds_system_limit_should_return_enfile");
+
+    printf("%s\n", "running test_given_open_when_flag_write_and_path_directory_should_return_eisdir");
+    reset_fs();
+    test_given_open_when_flag_write_and_path_directory_should_return_eisdir();
+    printf("%s\n\n", "passed: test_given_open_when_flag_write_and_path_directory_should_return_eisdir");
+
+    printf("%s\n", "running test_given_creat_when_file_not_present_should_return_0");
+    reset_fs();
+    test_given_creat_when_file_not_present_should_return_0();
+    printf("%s\n\n", "passed: test_given_creat_when_file_not_present_should_return_0");
+
+    printf("%s\n", "running test_given_creat_when_file_present_should_return_eexist");
+    reset_fs();
+    test_given_creat_when_file_present_should_return_eexist();
+    printf("%s\n\n", "passed: test_given_creat_when_file_present_should_return_eexist");
+
+    printf("%s\n", "running test_given_close_when_file_closed_should_return_ebadf");
+    reset_fs();
+    test_given_close_when_file_closed_should_return_ebadf();
+    printf("%s\n\n", "passed: test_given_close_when_file_closed_should_return_ebadf");
+
+    printf("%s\n", "running test_given_read_when_fd_is_closed_return_ebadf");
+    reset_fs();
+    test_given_read_when_fd_is_closed_return_ebadf();
+    printf("%s\n\n", "passed: test_given_read_when_fd_is_closed_return_ebadf");
+
+    printf("%s\n", "running test_given_write_when_fd_is_closed_return_ebadf");
+    reset_fs();
+    test_given_write_when_fd_is_closed_return_ebadf();
+    printf("%s\n\n", "passed: test_given_write_when_fd_is_closed_return_ebadf");
+
+    printf("%s\n", "running test_given_open_when_deleting_file_should_return_error");
+    reset_fs();
+    test_given_open_when_deleting_file_should_return_error();
+    printf("%s\n\n", "passed: test_given_open_when_deleting_file_should_return_error");
+
+    printf("%s\n", "running test_given_dup_when_dupping_file_should_result_in_same_fd");
+    reset_fs();
+    test_given_dup_when_dupping_file_should_result_in_same_fd();
+    printf("%s\n\n", "passed: test_given_dup_when_dupping_file_should_result_in_same_fd");
+
+    printf("%s\n", "running test_given_read_when_open_and_closing_file_should_persistted_data");
+    reset_fs();
+    test_given_read_when_open_and_closing_file_should_persistted_data();
+    printf("%s\n\n", "passed: test_given_read_when_open_and_closing_file_should_persistted_data");
+
+    printf("%s\n", "running test_given_read_when_o_direct_open_and_closing_file_should_persistted_data");
+    reset_fs();
+    test_given_read_when_o_direct_open_and_closing_file_should_persistted_data();
+    printf("%s\n\n", "passed: test_given_read_when_o_direct_open_and_closing_file_should_persistted_data");
+
+    printf("%s\n", "running test_given_access_when_file_not_exist_should_return_enoent");
+    reset_fs();
+    test_given_access_when_file_not_exist_should_return_enoent();
+    printf("%s\n\n", "passed: test_given_access_when_file_not_exist_should_return_enoent");
+
+    printf("%s\n", "running test_given_access_when_file_exists_should_return_0");
+    reset_fs();
+    test_given_access_when_file_exists_should_return_0();
+    printf("%s\n\n", "passed: test_given_access_when_file_exists_should_return_0");
+
+    printf("%s\n", "running test_given_access_when_folder_exists_should_return_0");
+    reset_fs();
+    test_given_access_when_folder_exists_should_return_0();
+    printf("%s\n\n", "passed: test_given_access_when_folder_exists_should_return_0");
+
+    printf("%s\n", "running test_given_access_when_under_folder_should_return_enoent");
+    reset_fs();
+    test_given_access_when_under_folder_should_return_enoent();
+    printf("%s\n\n", "passed: test_given_access_when_under_folder_should_return_enoent");
+
+    printf("%s\n", "running test_given_link_stat_when_two_files_are_linked_should_return_same");
+    reset_fs();
+    test_given_link_stat_when_two_files_are_linked_should_return_same();
+    printf("%s\n\n", "passed: test_given_link_stat_when_two_files_are_linked_should_return_same");
+
+    printf("%s\n", "running test_given_link_stat_when_one_file_deleted_should_return_1_nlink");
+    reset_fs();
+    test_given_link_stat_when_one_file_deleted_should_return_1_nlink();
+    printf("%s\n\n", "passed: test_given_link_stat_when_one_file_deleted_should_return_1_nlink");
+
+    printf("%s\n", "running test_given_chdir_when_dir_not_present_should_return_eexist");
+    reset_fs();
+    test_given_chdir_when_dir_not_present_should_return_eexist();
+    printf("%s\n\n", "passed: test_given_chdir_when_dir_not_present_should_return_eexist");
+
+    printf("%s\n", "running test_given_chdir_when_path_is_file_should_return_eexist");
+    reset_fs();
+    test_given_chdir_when_path_is_file_should_return_eexist();
+    printf("%s\n\n", "passed: test_given_chdir_when_path_is_file_should_return_eexist");
+
+    printf("%s\n", "running test_given_chdir_when_dir_is_valid_should_succeed");
+    reset_fs();
+    test_given_chdir_when_dir_is_valid_should_succeed();
+    printf("%s\n\n", "passed: test_given_chdir_when_dir_is_valid_should_succeed");
+
+    printf("%s\n", "running test_given_chmod_when_file_not_present_should_return_enonent");
+    reset_fs();
+    test_given_chmod_when_file_not_present_should_return_enonent();
+    printf("%s\n\n", "passed: test_given_chmod_when_file_not_present_should_return_enonent");
+
+    printf("%s\n", "running test_given_chmod_stat_when_file_present_should_return_0");
+    reset_fs();
+    test_given_chmod_stat_when_file_present_should_return_0();
+    printf("%s\n\n", "passed: test_given_chmod_stat_when_file_present_should_return_0");
+
+    printf("%s\n", "running test_given_chmod_stat_when_folder_present_should_return_0");
+    reset_fs();
+    test_given_chmod_stat_when_folder_present_should_return_0();
+    printf("%s\n\n", "passed: test_given_chmod_stat_when_folder_present_should_return_0");
+
+    printf("%s\n", "running test_given_getdents_when_no_files_in_folder_should_return_default_files");
+    reset_fs();
+    test_given_getdents_when_no_files_in_folder_should_return_default_files();
+    printf("%s\n\n", "passed: test_given_getdents_when_no_files_in_folder_should_return_default_files");
+
+    printf("%s\n", "running test_given_getdents_when_files_in_folder_should_return_files");
+    reset_fs();
+    test_given_getdents_when_files_in_folder_should_return_files();
+    printf("%s\n\n", "passed: test_given_getdents_when_files_in_folder_should_return_files");
+
+    printf("%s\n", "running test_given_getdents_when_successive_call_should_return_files");
+    reset_fs();
+    test_given_getdents_when_successive_call_should_return_files();
+    printf("%s\n\n", "passed: test_given_getdents_when_successive_call_should_return_files");
+
+    printf("%s\n", "running test_given_cwd_when_chdir_should_return_path");
+    reset_fs();
+    test_given_cwd_when_chdir_should_return_path();
+    printf("%s\n\n", "passed: test_given_cwd_when_chdir_should_return_path");
+
+    printf("%s\n", "running test_given_cwd_when_path_is_1_should_return_einvalid");
+    reset_fs();
+    test_given_cwd_when_path_is_1_should_return_einvalid();
+    printf("%s\n\n", "passed: test_given_cwd_when_path_is_1_should_return_einvalid");
+
+    printf("%s\n", "running test_given_mknod_when_path_valid_should_return_0");
+    reset_fs();
+    test_given_mknod_when_path_valid_should_return_0();
+    printf("%s\n\n", "passed: test_given_mknod_when_path_valid_should_return_0");
+
+    printf("%s\n", "running test_given_dev_open_when_file_is_driver_should_return_from_driver");
+    reset_fs();
+    test_given_dev_open_when_file_is_driver_should_return_from_driver();
+    printf("%s\n\n", "passed: test_given_dev_open_when_file_is_driver_should_return_from_driver");
+
+    printf("%s\n", "running test_given_dev_read_when_file_is_driver_should_return_from_driver");
+    reset_fs();
+    test_given_dev_read_when_file_is_driver_should_return_from_driver();
+    printf("%s\n\n", "passed: test_given_dev_read_when_file_is_driver_should_return_from_driver");
+
+    printf("%s\n", "running test_given_dev_write_when_file_is_driver_should_return_from_driver");
+    reset_fs();
+    test_given_dev_write_when_file_is_driver_should_return_from_driver();
+    printf("%s\n\n", "passed: test_given_dev_write_when_file_is_driver_should_return_from_driver");
+
+    printf("%s\n", "running test_given_dev_close_when_file_is_driver_should_return_from_driver");
+    reset_fs();
+    test_given_dev_close_when_file_is_driver_should_return_from_driver();
+    printf("%s\n\n", "passed: test_given_dev_close_when_file_is_driver_should_return_from_driver");
+
+    printf("%s\n", "running test_given_dev_dup_when_file_is_driver_should_return_from_driver");
+    reset_fs();
+    test_given_dev_dup_when_file_is_driver_should_return_from_driver();
+    printf("%s\n\n", "passed: test_given_dev_dup_when_file_is_driver_should_return_from_driver");
+
+    printf("%s\n", "running test_when_zone_full_should_return_enospc");
+    reset_fs();
+    test_when_zone_full_should_return_enospc();
+    printf("%s\n\n", "passed: test_when_zone_full_should_return_enospc");
+
+    printf("%s\n", "running test_given_directory_when_read_should_return_eisdir");
+    reset_fs();
+    test_given_directory_when_read_should_return_eisdir();
+    printf("%s\n\n", "passed: test_given_directory_when_read_should_return_eisdir");
+
+    printf("%s\n", "running test_given_directory_when_write_should_return_eisdir");
+    reset_fs();
+    test_given_directory_when_write_should_return_eisdir();
+    printf("%s\n\n", "passed: test_given_directory_when_write_should_return_eisdir");
+
+    printf("%s\n", "running test_given_srec_corpus_when_decode_in_parallel_should_match_reference");
+    reset_fs();
+    test_given_srec_corpus_when_decode_in_parallel_should_match_reference();
+    printf("%s\n\n", "passed: test_given_srec_corpus_when_decode_in_parallel_should_match_reference");
+
+    printf("%s\n", "running test_given_srec_record_when_checksum_wrong_should_skip");
+    reset_fs();
+    test_given_srec_record_when_checksum_wrong_should_skip();
+    printf("%s\n\n", "passed: test_given_srec_record_when_checksum_wrong_should_skip");
+
+    printf("%s\n", "running test_given_pipe_read_when_no_data_in_pipe_should_return_suspend");
+    reset_fs();
+    test_given_pipe_read_when_no_data_in_pipe_should_return_suspend();
+    printf("%s\n\n", "passed: test_given_pipe_read_when_no_data_in_pipe_should_return_suspend");
+
+    printf("%s\n", "running test_given_pipe_write_when_no_data_in_pipe_should_return_succeed");
+    reset_fs();
+    test_given_pipe_write_when_no_data_in_pipe_should_return_succeed();
+    printf("%s\n\n", "passed: test_given_pipe_write_when_no_data_in_pipe_should_return_succeed");
+
+    printf("%s\n", "running test_given_pipe_write_when_pipe_is_full_should_return_suspend");
+    reset_fs();
+    test_given_pipe_write_when_pipe_is_full_should_return_suspend();
+    printf("%s\n\n", "passed: test_given_pipe_write_when_pipe_is_full_should_return_suspend");
+
+    printf("%s\n", "running test_given_pipe_read_when_proc_was_suspended_should_return");
+    reset_fs();
+    test_given_pipe_read_when_proc_was_suspended_should_return();
+    printf("%s\n\n", "passed: test_given_pipe_read_when_proc_was_suspended_should_return");
+
+    printf("%s\n", "running test_given_pipe_read_when_data_is_written_should_return_data");
+    reset_fs();
+    test_given_pipe_read_when_data_is_written_should_return_data();
+    printf("%s\n\n", "passed: test_given_pipe_read_when_data_is_written_should_return_data");
+
+    printf("%s\n", "running test_given_pipe_read_when_pipe_is_full_should_return_data");
+    reset_fs();
+    test_given_pipe_read_when_pipe_is_full_should_return_data();
+    printf("%s\n\n", "passed: test_given_pipe_read_when_pipe_is_full_should_return_data");
+
+    printf("%s\n", "running test_given_pipe_read_when_writer_write_fd_closed_should_return_suspend");
+    reset_fs();
+    test_given_pipe_read_when_writer_write_fd_closed_should_return_suspend();
+    printf("%s\n\n", "passed: test_given_pipe_read_when_writer_write_fd_closed_should_return_suspend");
+
+    printf("%s\n", "running test_given_pipe_read_when_all_write_fds_closed_should_return_0");
+    reset_fs();
+    test_given_pipe_read_when_all_write_fds_closed_should_return_0();
+    printf("%s\n\n", "passed: test_given_pipe_read_when_all_write_fds_closed_should_return_0");
+
+    printf("%s\n", "running test_given_pipe_write_when_one_read_fd_s_closed_should_return_success");
+    reset_fs();
+    test_given_pipe_write_when_one_read_fd_s_closed_should_return_success();
+    printf("%s\n\n", "passed: test_given_pipe_write_when_one_read_fd_s_closed_should_return_success");
+
+    printf("%s\n", "running test_given_pipe_write_when_read_fd_are_closed_should_return_sigpipe");
+    reset_fs();
+    test_given_pipe_write_when_read_fd_are_closed_should_return_sigpipe();
+    printf("%s\n\n", "passed: test_given_pipe_write_when_read_fd_are_closed_should_return_sigpipe");
+
+    printf("%s\n", "running test_given_pipe_write_when_read_fd_closed_and_sigpipe_ignored_should_return_epipe");
+    reset_fs();
+    test_given_pipe_write_when_read_fd_closed_and_sigpipe_ignored_should_return_epipe();
+    printf("%s\n\n", "passed: test_given_pipe_write_when_read_fd_closed_and_sigpipe_ignored_should_return_epipe");
+
+    printf("%s\n", "running test_given_previous_image_when_incremental_build_should_only_rewrite_changes");
+    reset_fs();
+    test_given_previous_image_when_incremental_build_should_only_rewrite_changes();
+    printf("%s\n\n", "passed: test_given_previous_image_when_incremental_build_should_only_rewrite_changes");
+
+    printf("%s\n", "running test_given_disk_rle_when_compress_and_expand_should_match_disk");
+    reset_fs();
+    test_given_disk_rle_when_compress_and_expand_should_match_disk();
+    printf("%s\n\n", "passed: test_given_disk_rle_when_compress_and_expand_should_match_disk");
+
+    printf("%s\n", "running test_given_disk_rle_when_short_zero_runs_should_keep_literals");
+    reset_fs();
+    test_given_disk_rle_when_short_zero_runs_should_keep_literals();
+    printf("%s\n\n", "passed: test_given_disk_rle_when_short_zero_runs_should_keep_literals");
+
+    printf("%s\n", "running test_given_disk_rle_when_stream_overflows_should_return_einval");
+    reset_fs();
+    test_given_disk_rle_when_stream_overflows_should_return_einval();
+    printf("%s\n\n", "passed: test_given_disk_rle_when_stream_overflows_should_return_einval");
+
+    printf("%d tests passed\n", 89);
+    return 0;
+}
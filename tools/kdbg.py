@@ -5,17 +5,18 @@ from subprocess import call
 from os import path
 from uuid import uuid4
 
-def main():
-    if len(sys.argv) < 3:
-        print("python tools/kdby.py <file> <vir_address>")
-        return 1
-
+def lookup(name, target, quiet=False):
+    """
+    Map an address of the given srec to its source. Returns a tuple of
+    (c file, function, c line), or None if it could not be found. Unless
+    quiet, every step of the search is printed
+    """
+    log = (lambda *args: None) if quiet else print
     curr_path = path.dirname(path.realpath(__file__))
     main_path = curr_path + "/.."
     rpath = "include_winix/srec"
 
-    in_file = sys.argv[1] + ".verbose"
-    target = int(sys.argv[2],16)
+    in_file = name + ".verbose"
 
     verbose_filepath = rpath + "/" + in_file
     verbose_fullpath = main_path + "/" + verbose_filepath
@@ -55,31 +56,32 @@ def main():
                 target_line_num += 1
 
     if addr == 0:
-        print("Instruction not found 1")
-        return 0
+        log("Instruction not found 1")
+        return None
     
     filename = prevfile.split(" ")[1].split(", ")[0].replace("'","")\
                     .replace(",","").replace(".o",".c")
-    print(f"target assembly line number {target_line_num} in segment {target_segment} in {filename}")
+    log(f"target assembly line number {target_line_num} in segment {target_segment} in {filename}")
 
     tmp_filename = "/tmp/" + filename.replace("/", "_") + ".s"
     cc_cmd = f"gcc -Iinclude -DTEXT_OFFSET=1024 -D_DEBUG -Iinclude_winix -g -Wall -Werror -pedantic -Wno-discarded-qualifiers -Wno-comment  -D__wramp__ -nostdinc -E {filename} -o /dev/stdout | sed -E \"s/__attribute__\s*\(.+\)//\" | {curr_path}/bin/rcc -g -target=wramp > {tmp_filename}"
 
-    print(cc_cmd)
+    log(cc_cmd)
     result = call(cc_cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, shell=True)
     if result != 0:
         tmpfilename = filename.replace(".c",".s")
         if path.isfile(main_path+"/" +  tmpfilename):
-            print(f"Line: {target_line_num} in {tmpfilename}:{target_line_num}")
-            return 0
+            log(f"Line: {target_line_num} in {tmpfilename}:{target_line_num}")
+            return (tmpfilename, "", str(target_line_num))
         else:
-            print('Err')
-            return 1
+            log('Err')
+            return None
 
     loc = "0"
     curr_count = 0
     next_incr = 0
     prev_name_index = 0
+    prev_name = ""
     found = False
     curr_seg = ".data"
     seg_types = [".text", ".data", ".bss"]
@@ -121,11 +123,11 @@ def main():
                         
                 if(curr_count <= target_line_num\
                     and curr_count + next_incr >= target_line_num):
-                    print(f"Assembly: \n\t0x{instruction}\n {line}")
-                    print(f"Line: {idx} in {tmp_filename}:{idx}")
+                    log(f"Assembly: \n\t0x{instruction}\n {line}")
+                    log(f"Line: {idx} in {tmp_filename}:{idx}")
                     if curr_seg == ".text":
-                        print(f"Line: {loc} in {filename}:{loc}")
-                    print(f"Verbose: {verbose_line_no} in {verbose_filepath}:{verbose_line_no}")
+                        log(f"Line: {loc} in {filename}:{loc}")
+                    log(f"Verbose: {verbose_line_no} in {verbose_filepath}:{verbose_line_no}")
                     found = True
                     break
                 # print(str(curr_count), line )
@@ -135,7 +137,45 @@ def main():
             prev_line = line
 
         if not found:
-            print("Instruction not found ")
+            log("Instruction not found ")
+            return None
+    return (filename, prev_name.rstrip(":"), loc)
+
+def read_addresses(args):
+    """
+    addresses from the command line, "-" reads them from stdin, taking the
+    first hex number of each line, e.g. the output of "slab -p" in wsh
+    """
+    addresses = []
+    for arg in args:
+        if arg != "-":
+            addresses.append(int(arg, 16))
+            continue
+        for line in sys.stdin:
+            tokens = line.split()
+            if tokens and tokens[0].startswith("0x"):
+                addresses.append(int(tokens[0], 16))
+    return addresses
+
+def main():
+    if len(sys.argv) < 3:
+        print("python tools/kdby.py <file> <vir_address>")
+        print("python tools/kdby.py <file> <vir_address> <vir_address>... | -")
+        return 1
+
+    addresses = read_addresses(sys.argv[2:])
+    if len(sys.argv) == 3 and sys.argv[2] != "-":
+        return 0 if lookup(sys.argv[1], addresses[0]) else 1
+
+    # one line per address, to resolve kmalloc call sites and the like
+    for target in addresses:
+        result = lookup(sys.argv[1], target, quiet=True)
+        if result:
+            filename, function, loc = result
+            print(f"0x{target:05x}  {function:<24} {filename}:{loc}")
+        else:
+            print(f"0x{target:05x}  ?")
+    return 0
 
 if __name__ == '__main__':
     main()
@@ -0,0 +1,115 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 535
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 536($sp)
+	lw	$13, 1($13)
+	sw	$13, 22($sp)
+	lw	$13, 535($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.2
+	addu	$6, $0, $0
+	j	L.15
+L.2:
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	lw	$13, 22($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.4
+	la	$13, L.6
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.4:
+	lw	$13, 11($sp)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sneu	$13, $13, $12
+	bnez	$13, L.7
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.11
+	sw	$13, 1($sp)
+	lw	$13, 22($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.7:
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 22($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.15
+	la	$13, L.6
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.14:
+	addui	$13, $0, 24
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	addui	$13, $sp, 23
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	wramp_syscall
+L.15:
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 23
+	sw	$13, 2($sp)
+	addui	$13, $0, 512
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sgt	$13, $13, $0
+	bnez	$13, L.14
+	sge	$13, $7, $0
+	bnez	$13, L.17
+	la	$13, L.19
+	sw	$13, 0($sp)
+	jal	perror
+L.17:
+	addu	$1, $0, $0
+L.1:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 535
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.19:
+	.asciiz	"read"
+L.11:
+	.asciiz	"%s is a directory\n"
+L.6:
+	.asciiz	"open"
@@ -0,0 +1,215 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 38
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, 38($sp)
+	sgei	$13, $13, 3
+	bnez	$13, L.2
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	lw	$13, 39($sp)
+	addui	$13, $13, 1
+	sw	$13, 39($sp)
+	lw	$13, 39($sp)
+	addui	$12, $13, 1
+	sw	$12, 39($sp)
+	lw	$4, 0($13)
+	lw	$13, 39($sp)
+	lw	$3, 0($13)
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	sw	$4, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.6
+	sw	$4, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.6:
+	addui	$13, $0, 33
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 25
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.8
+	addu	$1, $0, $7
+	j	L.1
+L.8:
+	lw	$13, 27($sp)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 0x8000
+	sequ	$13, $13, $12
+	bnez	$13, L.10
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.14
+	sw	$13, 1($sp)
+	sw	$4, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.10:
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	sw	$3, 1($sp)
+	addui	$13, $sp, 12
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.15
+	lw	$13, 14($sp)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 16384
+	sneu	$13, $13, $12
+	bnez	$13, L.15
+	la	$13, buffer
+	sw	$13, 0($sp)
+	sw	$3, 1($sp)
+	addui	$13, $0, 256
+	sw	$13, 2($sp)
+	jal	strlcpy
+	la	$13, buffer
+	sw	$13, 0($sp)
+	la	$13, L.18
+	sw	$13, 1($sp)
+	addui	$13, $0, 256
+	sw	$13, 2($sp)
+	jal	strlcat
+	sw	$4, 0($sp)
+	jal	basename
+	addu	$13, $0, $1
+	la	$12, buffer
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 256
+	sw	$13, 2($sp)
+	jal	strlcat
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 257
+	sw	$13, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	lw	$13, 27($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sge	$13, $5, $0
+	bnez	$13, L.26
+	la	$13, buffer
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.15:
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 257
+	sw	$13, 1($sp)
+	sw	$3, 2($sp)
+	lw	$13, 27($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sge	$13, $5, $0
+	bnez	$13, L.26
+	sw	$3, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.25:
+	addui	$13, $0, 24
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sgt	$13, $7, $0
+	bnez	$13, L.28
+	la	$13, L.30
+	sw	$13, 0($sp)
+	jal	perror
+	j	L.27
+L.28:
+L.26:
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	addui	$13, $0, 256
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sgt	$13, $13, $0
+	bnez	$13, L.25
+L.27:
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	jal	wramp_syscall
+	addu	$1, $0, $0
+L.1:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 38
+	jr	$ra
+.bss
+buffer:
+	.space	256
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.30:
+	.asciiz	"write"
+L.18:
+	.asciiz	"/"
+L.14:
+	.asciiz	"not regular file %s\n"
+L.5:
+	.asciiz	"cp [OPTION]... SOURCE DEST\n"
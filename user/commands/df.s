@@ -0,0 +1,49 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 17
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$13, $0, 51
+	sw	$13, 0($sp)
+	la	$13, L.2
+	sw	$13, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.3
+	lw	$1, 8($sp)
+	j	L.1
+L.3:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	lw	$13, 14($sp)
+	sw	$13, 4($sp)
+	lw	$13, 15($sp)
+	sw	$13, 5($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.1:
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.5:
+	.asciiz	"\nFileSystem status:\n%d blocks in total, %d blocks free\n%d inodes in total, %d inodes free. \n"
+L.2:
+	.asciiz	"/"
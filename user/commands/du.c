@@ -3,10 +3,23 @@
 #include <stdlib.h>
 #include <string.h>
 #include <bsd/string.h>
+#include <sys/stat.h>
+#include <sys/uring.h>
 
 #define PATH_LEN    (64)
 char slash[] = "/";
 
+// stats of the files of a directory are queued on the ring, and run
+// together by one uring_enter()
+struct stat_batch{
+    struct uring ring;
+    char paths[URING_ENTRIES][PATH_LEN];
+    struct stat bufs[URING_ENTRIES];
+    int nr_queued;
+};
+
+struct stat_batch *batch;   // NULL if stat() is called directly
+
 void reset_path(char *dir_path, char* path){
     strlcpy(path, dir_path, PATH_LEN);
     strlcat(path, slash, PATH_LEN);
@@ -37,9 +50,60 @@ void set_num_str(int value, char *buf){
     *buf = '\0';
 }
 
+size_t flush_stats(){
+    struct uring_cqe *cqe;
+    struct stat statbuf;
+    size_t count = 0;
+    int i;
+
+    if(!batch)
+        return 0;
+    if(batch->nr_queued && uring_enter(batch->nr_queued) < 0){
+        perror("uring_enter");
+        // nothing was submitted, drop the queue and stat the paths
+        // directly, and stop using the ring from now on
+        batch->ring.sq_tail = batch->ring.sq_head;
+        for(i = 0; i < batch->nr_queued; i++){
+            if(stat(batch->paths[i], &statbuf) == 0)
+                count += (size_t)statbuf.st_size;
+        }
+        free(batch);
+        batch = NULL;
+        return count;
+    }
+    while(uring_cq_ready(&batch->ring)){
+        cqe = uring_next_cqe(&batch->ring);
+        if(cqe->res == 0)
+            count += (size_t)batch->bufs[cqe->user_data].st_size;
+        batch->ring.cq_head++;
+    }
+    batch->nr_queued = 0;
+    return count;
+}
+
+size_t file_size(char *path){
+    struct stat statbuf;
+    struct uring_sqe *sqe;
+    size_t count = 0;
+    int i;
+
+    if(batch && !uring_sq_space(&batch->ring))
+        count = flush_stats();
+    if(!batch){
+        if(stat(path, &statbuf) == 0)
+            count += (size_t)statbuf.st_size;
+        return count;
+    }
+    i = batch->nr_queued++;
+    strlcpy(batch->paths[i], path, PATH_LEN);
+    sqe = uring_next_sqe(&batch->ring);
+    uring_prep(sqe, STAT, batch->paths[i], &batch->bufs[i], 0, i);
+    batch->ring.sq_tail++;
+    return count;
+}
+
 size_t count_dir_size(char *dir_path){
     struct dirent* dir;
-    struct stat statbuf;
     size_t count = 0;
     char *path;
     char size_buf[10];
@@ -56,14 +120,14 @@ size_t count_dir_size(char *dir_path){
             continue;
         strlcat(path, (const char*)dir->d_name, PATH_LEN);
         if(dir->d_type == DT_DIR){
+            count += flush_stats();
             count += count_dir_size(path);
         }else{
-            (void)stat(path, &statbuf);
-            // printf("stat %s %d size %d\n", dir->d_name, ret, statbuf.st_size);
-            count += (size_t)statbuf.st_size;
+            count += file_size(path);
         }
         reset_path(dir_path, path);
     }
+    count += flush_stats();
     set_num_str(count, size_buf);
     printf("%sKB %s\n", size_buf, dir_path);
     closedir(directory);
@@ -76,6 +140,11 @@ int main(int argc, char **argv){
     if(argc > 1)
         curr_dir = argv[1];
 
+    batch = calloc(1, sizeof(struct stat_batch));
+    if(batch && uring_setup(&batch->ring)){
+        free(batch);
+        batch = NULL;
+    }
     count_dir_size(curr_dir);
     return 0;
 }
@@ -0,0 +1,521 @@
+.global	slash
+slash:
+	.asciiz	"/"
+.global	reset_path
+.text
+reset_path:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	jal	strlcpy
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	la	$13, slash
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	jal	strlcat
+L.3:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	int2str
+int2str:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	j	L.6
+L.5:
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	div	$13, $13, $12
+	remi	$7, $13, 10
+	lw	$13, 5($sp)
+	addui	$12, $13, 1
+	sw	$12, 5($sp)
+	addi	$12, $7, 48
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	divi	$13, $13, 10
+	sw	$13, 4($sp)
+L.6:
+	lw	$13, 4($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.5
+L.4:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	set_num_str
+set_num_str:
+	subui	$sp, $sp, 9
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	addui	$12, $0, 4096
+	div	$11, $13, $12
+	sw	$11, 8($sp)
+	rem	$13, $13, $12
+	sw	$13, 7($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 10
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	int2str
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 48
+	bnez	$13, L.9
+	lw	$13, 10($sp)
+	addui	$12, $0, 32
+	sw	$12, 0($13)
+L.9:
+	lw	$13, 10($sp)
+	addui	$13, $13, 2
+	sw	$13, 10($sp)
+	lw	$13, 10($sp)
+	addui	$12, $13, 1
+	sw	$12, 10($sp)
+	addui	$12, $0, 46
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 10
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	int2str
+	lw	$13, 10($sp)
+	addui	$13, $13, 2
+	sw	$13, 10($sp)
+	lw	$13, 10($sp)
+	sw	$0, 0($13)
+L.8:
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	flush_stats
+flush_stats:
+	subui	$sp, $sp, 24
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addu	$5, $0, $0
+	lw	$13, batch($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.12
+	addu	$1, $0, $0
+	j	L.11
+L.12:
+	lw	$13, batch($0)
+	lw	$13, 2692($13)
+	sw	$13, 10($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.25
+	addui	$13, $0, 64
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sge	$13, $13, $0
+	bnez	$13, L.25
+	la	$13, L.16
+	sw	$13, 0($sp)
+	jal	perror
+	lw	$13, batch($0)
+	lw	$12, 0($13)
+	sw	$12, 1($13)
+	addu	$6, $0, $0
+	j	L.20
+L.17:
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	slli	$13, $6, 6
+	lw	$12, batch($0)
+	addui	$12, $12, 228
+	addu	$13, $13, $12
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.21
+	lw	$13, 18($sp)
+	addu	$5, $5, $13
+L.21:
+L.18:
+	addi	$6, $6, 1
+L.20:
+	lw	$13, batch($0)
+	lw	$13, 2692($13)
+	slt	$13, $6, $13
+	bnez	$13, L.17
+	lw	$13, batch($0)
+	sw	$13, 0($sp)
+	jal	free
+	sw	$0, batch($0)
+	addu	$1, $0, $5
+	j	L.11
+L.24:
+	lw	$13, batch($0)
+	lw	$12, 2($13)
+	addui	$11, $0, 31
+	and	$12, $12, $11
+	slli	$12, $12, 1
+	addui	$13, $13, 164
+	addu	$7, $12, $13
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.27
+	addui	$13, $0, 13
+	lw	$12, 1($7)
+	mult	$13, $13, $12
+	lw	$12, batch($0)
+	addui	$12, $12, 2276
+	addu	$13, $13, $12
+	lw	$13, 7($13)
+	addu	$5, $5, $13
+L.27:
+	lw	$13, batch($0)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+L.25:
+	lw	$13, batch($0)
+	lw	$12, 3($13)
+	lw	$13, 2($13)
+	subu	$13, $12, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.24
+	lw	$13, batch($0)
+	sw	$0, 2692($13)
+	addu	$1, $0, $5
+L.11:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 24
+	jr	$ra
+.global	file_size
+file_size:
+	subui	$sp, $sp, 25
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$10, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addu	$5, $0, $0
+	lw	$13, batch($0)
+	sw	$13, 11($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.30
+	addui	$13, $0, 32
+	lw	$12, 11($sp)
+	lw	$12, 1($12)
+	lw	$11, 11($sp)
+	lw	$11, 0($11)
+	subu	$12, $12, $11
+	subu	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.30
+	jal	flush_stats
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+L.30:
+	lw	$13, batch($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.32
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	lw	$13, 25($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 12
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.34
+	lw	$13, 19($sp)
+	addu	$5, $5, $13
+L.34:
+	addu	$1, $0, $5
+	j	L.29
+L.32:
+	lw	$13, batch($0)
+	addui	$13, $13, 2692
+	lw	$12, 0($13)
+	addi	$11, $12, 1
+	sw	$11, 0($13)
+	addu	$6, $0, $12
+	slli	$13, $6, 6
+	lw	$12, batch($0)
+	addui	$12, $12, 228
+	addu	$13, $13, $12
+	sw	$13, 0($sp)
+	lw	$13, 25($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	jal	strlcpy
+	lw	$13, batch($0)
+	addui	$12, $0, 5
+	lw	$11, 1($13)
+	addui	$10, $0, 31
+	and	$11, $11, $10
+	multu	$12, $12, $11
+	addui	$13, $13, 4
+	addu	$7, $12, $13
+L.37:
+	addui	$13, $0, 32
+	sw	$13, 0($7)
+	slli	$13, $6, 6
+	lw	$12, batch($0)
+	addui	$12, $12, 228
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 1($7)
+	addui	$13, $0, 13
+	mult	$13, $13, $6
+	lw	$12, batch($0)
+	addui	$12, $12, 2276
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 2($7)
+	sw	$0, 3($7)
+	sw	$6, 4($7)
+L.38:
+	lw	$13, batch($0)
+	addui	$13, $13, 1
+	lw	$12, 0($13)
+	addui	$11, $0, 1
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $5
+L.29:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$10, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 25
+	jr	$ra
+.global	count_dir_size
+count_dir_size:
+	subui	$sp, $sp, 21
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addu	$5, $0, $0
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	jal	opendir
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	addu	$13, $0, $4
+	sneu	$13, $13, $0
+	bnez	$13, L.41
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.44
+	sw	$13, 1($sp)
+	lw	$13, 21($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+	j	L.40
+L.41:
+	addui	$13, $0, 64
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	reset_path
+	j	L.46
+L.45:
+	lw	$13, 2($7)
+	addui	$12, $0, 46
+	sneu	$13, $13, $12
+	bnez	$13, L.48
+	j	L.46
+L.48:
+	sw	$6, 0($sp)
+	addui	$13, $7, 2
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	jal	strlcat
+	lw	$13, 1($7)
+	addui	$12, $0, 4
+	sneu	$13, $13, $12
+	bnez	$13, L.50
+	jal	flush_stats
+	addu	$13, $0, $1
+	addu	$5, $5, $13
+	sw	$6, 0($sp)
+	jal	count_dir_size
+	addu	$13, $0, $1
+	addu	$5, $5, $13
+	j	L.51
+L.50:
+	sw	$6, 0($sp)
+	jal	file_size
+	addu	$13, $0, $1
+	addu	$5, $5, $13
+L.51:
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	reset_path
+L.46:
+	sw	$4, 0($sp)
+	jal	readdir
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.45
+	jal	flush_stats
+	addu	$13, $0, $1
+	addu	$5, $5, $13
+	addu	$13, $0, $5
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	jal	set_num_str
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.52
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	lw	$13, 21($sp)
+	sw	$13, 3($sp)
+	jal	dprintf
+	sw	$4, 0($sp)
+	jal	closedir
+	sw	$6, 0($sp)
+	jal	free
+	addu	$1, $0, $5
+L.40:
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 21
+	jr	$ra
+.global	main
+main:
+	subui	$sp, $sp, 7
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, L.54
+	sw	$13, 6($sp)
+	lw	$13, 7($sp)
+	slei	$13, $13, 1
+	bnez	$13, L.55
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	sw	$13, 6($sp)
+L.55:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	addui	$13, $0, 2693
+	sw	$13, 1($sp)
+	jal	calloc
+	addu	$13, $0, $1
+	sw	$13, batch($0)
+	lw	$13, batch($0)
+	sw	$13, 5($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.57
+	addui	$13, $0, 63
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.57
+	lw	$13, batch($0)
+	sw	$13, 0($sp)
+	jal	free
+	sw	$0, batch($0)
+L.57:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	count_dir_size
+	addu	$1, $0, $0
+L.53:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.bss
+.global	batch
+batch:
+	.space	1
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.54:
+	.asciiz	"."
+L.52:
+	.asciiz	"%sKB %s\n"
+L.44:
+	.asciiz	"err:%s\n"
+L.16:
+	.asciiz	"uring_enter"
@@ -0,0 +1,105 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 11
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$4, $0, 1
+	lw	$13, 11($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.2
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	la	$5, buffer
+	j	L.5
+L.4:
+	lw	$13, 12($sp)
+	addu	$13, $4, $13
+	lw	$6, 0($13)
+	slei	$13, $4, 1
+	bnez	$13, L.10
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	addui	$12, $0, 32
+	sw	$12, 0($13)
+	j	L.10
+L.9:
+	lw	$7, 0($6)
+	snei	$13, $7, 92
+	bnez	$13, L.12
+	addui	$13, $6, 1
+	addu	$6, $0, $13
+	lw	$7, 0($13)
+	addui	$13, $0, 110
+	sw	$13, 10($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.16
+	lw	$13, 10($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.15
+L.18:
+	seqi	$13, $7, 116
+	bnez	$13, L.17
+	j	L.15
+L.16:
+	addui	$7, $0, 10
+	j	L.15
+L.17:
+	addui	$7, $0, 9
+L.15:
+L.12:
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	sw	$7, 0($13)
+	addui	$6, $6, 1
+L.10:
+	lw	$13, 0($6)
+	sne	$13, $13, $0
+	bnez	$13, L.9
+	sw	$0, 0($5)
+	addi	$4, $4, 1
+L.5:
+	lw	$13, 11($sp)
+	slt	$13, $4, $13
+	bnez	$13, L.4
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	addui	$12, $0, 10
+	sw	$12, 0($13)
+	addu	$13, $0, $5
+	addui	$5, $13, 1
+	sw	$0, 0($13)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.19
+	sw	$13, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.1:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.bss
+buffer:
+	.space	512
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.19:
+	.asciiz	"%s"
@@ -0,0 +1,444 @@
+.global	status
+status:
+	.word	0x1
+.global	pmflag
+pmflag:
+	.word	0x1
+.global	pnmflag
+pnmflag:
+	.word	0x0
+.global	nflag
+nflag:
+	.word	0x0
+.global	main
+.text
+main:
+	subui	$sp, $sp, 11
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 12($sp)
+	addui	$7, $13, 1
+	lw	$13, 11($sp)
+	sw	$13, args($0)
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	sw	$13, progname($0)
+	j	L.5
+L.4:
+	lw	$13, args($0)
+	subi	$13, $13, 1
+	sw	$13, args($0)
+	lw	$13, 0($7)
+	lw	$5, 1($13)
+	addui	$13, $0, 110
+	sw	$13, 9($sp)
+	seq	$13, $5, $13
+	bnez	$13, L.11
+	lw	$13, 9($sp)
+	sgt	$13, $5, $13
+	bnez	$13, L.16
+L.15:
+	seqi	$13, $5, 101
+	bnez	$13, L.13
+	j	L.7
+L.16:
+	seqi	$13, $5, 115
+	bnez	$13, L.12
+	seqi	$13, $5, 118
+	bnez	$13, L.10
+	j	L.7
+L.10:
+	sw	$0, pmflag($0)
+	addui	$13, $0, 1
+	sw	$13, pnmflag($0)
+	j	L.8
+L.11:
+	lw	$13, nflag($0)
+	addi	$13, $13, 1
+	sw	$13, nflag($0)
+	j	L.8
+L.12:
+	addu	$13, $0, $0
+	sw	$13, pnmflag($0)
+	sw	$13, pmflag($0)
+	j	L.8
+L.13:
+	addui	$7, $7, 1
+	j	L.14
+L.7:
+	jal	usage
+L.8:
+	addui	$7, $7, 1
+L.5:
+	lw	$13, 0($7)
+	sw	$13, 9($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.17
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	seqi	$13, $13, 45
+	bnez	$13, L.4
+L.17:
+L.14:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.18
+	jal	usage
+L.18:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	jal	regcomp
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.20
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.23
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.20:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.27
+	sw	$0, 0($sp)
+	sw	$6, 1($sp)
+	jal	match
+	j	L.25
+L.26:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	la	$13, L.31
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.29
+	la	$13, L.31
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	match
+	j	L.30
+L.29:
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 0($7)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.32
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.35
+	sw	$13, 1($sp)
+	lw	$13, 0($7)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, status($0)
+	j	L.33
+L.32:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	match
+L.33:
+L.30:
+	addui	$7, $7, 1
+L.27:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.26
+L.25:
+	lw	$1, status($0)
+L.3:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	match
+match:
+	subui	$sp, $sp, 112
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addu	$6, $0, $0
+	j	L.38
+L.37:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	addui	$13, $0, 10
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	addi	$6, $6, 1
+	addu	$13, $0, $4
+	sneu	$13, $13, $0
+	bnez	$13, L.40
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.43
+	sw	$13, 1($sp)
+	lw	$13, 112($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.46
+	lw	$3, 112($sp)
+	j	L.47
+L.46:
+	la	$3, L.44
+L.47:
+	sw	$3, 2($sp)
+	jal	dprintf
+	j	L.41
+L.40:
+	sw	$0, 0($4)
+L.41:
+	lw	$13, 113($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 11
+	sw	$13, 1($sp)
+	jal	regexec
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.48
+	lw	$13, pmflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.50
+	lw	$13, 112($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	jal	pline
+L.50:
+	lw	$13, status($0)
+	seqi	$13, $13, 2
+	bnez	$13, L.49
+	sw	$0, status($0)
+	j	L.49
+L.48:
+	lw	$13, pnmflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.54
+	lw	$13, 112($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	jal	pline
+L.54:
+L.49:
+L.38:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	addui	$13, $0, 101
+	sw	$13, 1($sp)
+	jal	_getline
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.37
+L.36:
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 112
+	jr	$ra
+.global	pline
+pline:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.57
+	lw	$13, args($0)
+	slei	$13, $13, 3
+	bnez	$13, L.57
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.59
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.57:
+	lw	$13, nflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.60
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.62
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.60:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.63
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.56:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	usage
+usage:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.66
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.64:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	_getline
+_getline:
+	subui	$sp, $sp, 6
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$6, 6($sp)
+	j	L.69
+L.68:
+	la	$13, _stdin
+	sw	$13, 0($sp)
+	jal	fgetc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 6($sp)
+	addui	$12, $13, 1
+	sw	$12, 6($sp)
+	sw	$7, 0($13)
+	sge	$13, $7, $0
+	bnez	$13, L.71
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.67
+L.71:
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	addu	$12, $0, $6
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	subi	$12, $12, 1
+	seq	$13, $13, $12
+	bnez	$13, L.75
+	snei	$13, $7, 10
+	bnez	$13, L.73
+L.75:
+	lw	$13, 6($sp)
+	sw	$0, 0($13)
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	addu	$12, $0, $6
+	subu	$13, $13, $12
+	addu	$1, $0, $13
+	j	L.67
+L.73:
+L.69:
+	j	L.68
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.67:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.bss
+.global	args
+args:
+	.space	1
+.global	progname
+progname:
+	.space	1
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.66:
+	.asciiz	"Usage: grep [-v] [-n] [-s] [-e expr] expression [file ...]\n"
+L.63:
+	.asciiz	"%s\n"
+L.62:
+	.asciiz	"%d:"
+L.59:
+	.asciiz	"%s:"
+L.44:
+	.asciiz	"stdin"
+L.43:
+	.asciiz	"Line too long in %s\n"
+L.35:
+	.asciiz	"Can't open %s\n"
+L.31:
+	.asciiz	"-"
+L.23:
+	.asciiz	"grep: regcomp failed\n"
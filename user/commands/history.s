@@ -0,0 +1,68 @@
+filename:
+	.asciiz	"/.history"
+.global	main
+.text
+main:
+	subui	$sp, $sp, 8
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	la	$13, filename
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.5
+	la	$13, filename
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.4:
+	addui	$13, $0, 24
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	wramp_syscall
+L.5:
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	addui	$13, $0, 128
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sgt	$13, $13, $0
+	bnez	$13, L.4
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+	addu	$1, $0, $0
+L.1:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.bss
+buffer:
+	.space	128
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -0,0 +1,719 @@
+.data
+L.4:
+	.word	0x1f
+	.word	0x1c
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+	.word	0x1e
+	.word	0x1f
+.global	parse_unix_time
+.text
+parse_unix_time:
+	subui	$sp, $sp, 30
+	sw	$2, 0($sp)
+	sw	$3, 1($sp)
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$8, 6($sp)
+	sw	$9, 7($sp)
+	sw	$10, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	addui	$13, $sp, 18
+	la	$9, L.4
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	lw	$10, 5($9)
+	sw	$8, 4($13)
+	sw	$10, 5($13)
+	lw	$8, 6($9)
+	lw	$10, 7($9)
+	sw	$8, 6($13)
+	sw	$10, 7($13)
+	lw	$8, 8($9)
+	lw	$10, 9($9)
+	sw	$8, 8($13)
+	sw	$10, 9($13)
+	lw	$8, 10($9)
+	lw	$10, 11($9)
+	sw	$8, 10($13)
+	sw	$10, 11($13)
+	sw	$0, 17($sp)
+	lw	$13, 30($sp)
+	lhi	$12, 0x1
+	ori	$12, $12, 0x5180
+	divu	$11, $13, $12
+	addu	$4, $0, $11
+	remu	$13, $13, $12
+	addu	$2, $0, $13
+	addui	$7, $0, 1970
+	j	L.6
+L.5:
+	addu	$13, $0, $0
+	sw	$13, 12($sp)
+	remi	$12, $7, 400
+	seq	$13, $12, $13
+	bnez	$13, L.10
+	remi	$13, $7, 4
+	lw	$12, 12($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.8
+	remi	$13, $7, 100
+	lw	$12, 12($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.8
+L.10:
+	subi	$4, $4, 366
+	j	L.9
+L.8:
+	subi	$4, $4, 365
+L.9:
+	addi	$7, $7, 1
+L.6:
+	sgei	$13, $4, 365
+	bnez	$13, L.5
+	addi	$5, $4, 1
+	addu	$13, $0, $0
+	sw	$13, 12($sp)
+	remi	$12, $7, 400
+	seq	$13, $12, $13
+	bnez	$13, L.13
+	remi	$13, $7, 4
+	lw	$12, 12($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.11
+	remi	$13, $7, 100
+	lw	$12, 12($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.11
+L.13:
+	addui	$13, $0, 1
+	sw	$13, 17($sp)
+L.11:
+	addu	$13, $0, $0
+	addu	$3, $0, $13
+	addu	$6, $0, $13
+	lw	$13, 17($sp)
+	snei	$13, $13, 1
+	bnez	$13, L.26
+	j	L.17
+L.16:
+	snei	$13, $6, 1
+	bnez	$13, L.19
+	subi	$13, $5, 29
+	sge	$13, $13, $0
+	bnez	$13, L.21
+	j	L.15
+L.21:
+	addi	$3, $3, 1
+	subi	$5, $5, 29
+	j	L.20
+L.19:
+	addui	$13, $sp, 18
+	addu	$13, $6, $13
+	lw	$13, 0($13)
+	sub	$13, $5, $13
+	sge	$13, $13, $0
+	bnez	$13, L.23
+	j	L.15
+L.23:
+	addi	$3, $3, 1
+	addui	$13, $sp, 18
+	addu	$13, $6, $13
+	lw	$13, 0($13)
+	sub	$5, $5, $13
+L.20:
+	addi	$6, $6, 1
+L.17:
+	j	L.16
+	j	L.15
+L.25:
+	addui	$13, $sp, 18
+	addu	$13, $6, $13
+	lw	$13, 0($13)
+	sub	$13, $5, $13
+	sge	$13, $13, $0
+	bnez	$13, L.28
+	j	L.27
+L.28:
+	addi	$3, $3, 1
+	addui	$13, $sp, 18
+	addu	$13, $6, $13
+	lw	$13, 0($13)
+	sub	$5, $5, $13
+	addi	$6, $6, 1
+L.26:
+	j	L.25
+L.27:
+L.15:
+	sle	$13, $5, $0
+	bnez	$13, L.30
+	addi	$3, $3, 1
+	sw	$5, 16($sp)
+	j	L.31
+L.30:
+	snei	$13, $3, 2
+	bnez	$13, L.32
+	lw	$13, 17($sp)
+	snei	$13, $13, 1
+	bnez	$13, L.32
+	addui	$13, $0, 29
+	sw	$13, 16($sp)
+	j	L.33
+L.32:
+	addui	$13, $sp, 17
+	addu	$13, $3, $13
+	lw	$13, 0($13)
+	sw	$13, 16($sp)
+L.33:
+L.31:
+	addui	$13, $0, 3600
+	div	$12, $2, $13
+	sw	$12, 15($sp)
+	rem	$13, $2, $13
+	addui	$12, $0, 60
+	div	$11, $13, $12
+	sw	$11, 14($sp)
+	rem	$13, $13, $12
+	sw	$13, 13($sp)
+	lw	$13, 31($sp)
+	lw	$12, 16($sp)
+	sw	$12, 0($13)
+	lw	$13, 31($sp)
+	sw	$3, 1($13)
+	lw	$13, 31($sp)
+	sw	$7, 2($13)
+	lw	$13, 31($sp)
+	lw	$12, 15($sp)
+	sw	$12, 3($13)
+	lw	$13, 31($sp)
+	lw	$12, 14($sp)
+	sw	$12, 4($13)
+	lw	$13, 31($sp)
+	lw	$12, 13($sp)
+	sw	$12, 5($13)
+	addu	$1, $0, $0
+L.3:
+	lw	$2, 0($sp)
+	lw	$3, 1($sp)
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$8, 6($sp)
+	lw	$9, 7($sp)
+	lw	$10, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	addui	$sp, $sp, 30
+	jr	$ra
+.global	usernames
+usernames:
+	.word	0x0
+	.word	L.35
+	.word	0x0
+
+.word	0
+.global	get_user_name
+.text
+get_user_name:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	la	$7, usernames
+	j	L.38
+L.37:
+	lw	$13, 0($7)
+	lw	$12, 3($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.40
+	lw	$1, 1($7)
+	j	L.36
+L.40:
+	addui	$7, $7, 2
+L.38:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.37
+	addu	$1, $0, $0
+L.36:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+permission_char:
+	.asciiz	"-xwr"
+.global	print_long_format
+.text
+print_long_format:
+	subui	$sp, $sp, 45
+	sw	$2, 9($sp)
+	sw	$3, 10($sp)
+	sw	$4, 11($sp)
+	sw	$5, 12($sp)
+	sw	$6, 13($sp)
+	sw	$7, 14($sp)
+	sw	$11, 15($sp)
+	sw	$12, 16($sp)
+	sw	$13, 17($sp)
+	sw	$ra, 18($sp)
+	la	$5, buffer
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	lw	$13, 45($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 32
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 24($sp)
+	lw	$13, 24($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.43
+	j	L.42
+L.43:
+	lw	$4, 34($sp)
+	addu	$13, $0, $5
+	sw	$13, 21($sp)
+	addui	$5, $13, 1
+	lw	$12, 34($sp)
+	addui	$11, $0, 0xf000
+	and	$12, $12, $11
+	addui	$11, $0, 16384
+	sneu	$13, $12, $11
+	bnez	$13, L.48
+	addui	$2, $0, 100
+	j	L.49
+L.48:
+	addui	$2, $0, 45
+L.49:
+	lw	$13, 21($sp)
+	sw	$2, 0($13)
+	addui	$6, $0, 256
+	addui	$3, $0, 3
+L.50:
+	addui	$7, $0, 3
+L.54:
+	addu	$13, $0, $5
+	sw	$13, 19($sp)
+	addui	$5, $13, 1
+	addu	$12, $0, $6
+	and	$12, $12, $4
+	sequ	$13, $12, $0
+	bnez	$13, L.59
+	lw	$13, permission_char($7)
+	sw	$13, 20($sp)
+	j	L.60
+L.59:
+	addui	$13, $0, 45
+	sw	$13, 20($sp)
+L.60:
+	lw	$13, 20($sp)
+	lw	$12, 19($sp)
+	sw	$13, 0($12)
+	srai	$6, $6, 1
+L.55:
+	subi	$7, $7, 1
+	sgt	$13, $7, $0
+	bnez	$13, L.54
+L.51:
+	subi	$3, $3, 1
+	sgt	$13, $3, $0
+	bnez	$13, L.50
+	sw	$0, 0($5)
+	lw	$13, 36($sp)
+	sw	$13, 0($sp)
+	jal	get_user_name
+	addu	$13, $0, $1
+	sw	$13, 23($sp)
+	lw	$13, 37($sp)
+	sw	$13, 0($sp)
+	jal	get_user_name
+	addu	$13, $0, $1
+	sw	$13, 22($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.63
+	sw	$13, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	lw	$13, 35($sp)
+	sw	$13, 3($sp)
+	lw	$13, 23($sp)
+	sw	$13, 4($sp)
+	lw	$13, 22($sp)
+	sw	$13, 5($sp)
+	jal	dprintf
+	lw	$13, 39($sp)
+	sw	$13, 25($sp)
+	lw	$13, 46($sp)
+	andi	$13, $13, 4
+	seq	$13, $13, $0
+	bnez	$13, L.66
+	lw	$13, 25($sp)
+	addui	$12, $0, 1023
+	and	$13, $13, $12
+	sw	$13, 20($sp)
+	lw	$13, 20($sp)
+	addui	$12, $0, 1000
+	sltu	$13, $13, $12
+	bnez	$13, L.69
+	addui	$13, $0, 999
+	sw	$13, 19($sp)
+	j	L.70
+L.69:
+	lw	$13, 20($sp)
+	sw	$13, 19($sp)
+L.70:
+	lw	$13, 19($sp)
+	sw	$13, 20($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.71
+	sw	$13, 1($sp)
+	lw	$13, 25($sp)
+	srli	$13, $13, 10
+	sw	$13, 2($sp)
+	lw	$13, 20($sp)
+	sw	$13, 3($sp)
+	jal	dprintf
+	j	L.67
+L.66:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.72
+	sw	$13, 1($sp)
+	lw	$13, 25($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.67:
+	lw	$13, 42($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 26
+	sw	$13, 1($sp)
+	jal	parse_unix_time
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.74
+	sw	$13, 1($sp)
+	lw	$13, 26($sp)
+	sw	$13, 2($sp)
+	lw	$13, 27($sp)
+	sw	$13, 3($sp)
+	lw	$13, 28($sp)
+	sw	$13, 4($sp)
+	lw	$13, 29($sp)
+	sw	$13, 5($sp)
+	lw	$13, 30($sp)
+	sw	$13, 6($sp)
+	lw	$13, 31($sp)
+	sw	$13, 7($sp)
+	lw	$13, 45($sp)
+	sw	$13, 8($sp)
+	jal	dprintf
+L.42:
+	lw	$2, 9($sp)
+	lw	$3, 10($sp)
+	lw	$4, 11($sp)
+	lw	$5, 12($sp)
+	lw	$6, 13($sp)
+	lw	$7, 14($sp)
+	lw	$11, 15($sp)
+	lw	$12, 16($sp)
+	lw	$13, 17($sp)
+	lw	$ra, 18($sp)
+	addui	$sp, $sp, 45
+	jr	$ra
+.global	do_ls
+do_ls:
+	subui	$sp, $sp, 62
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	la	$4, L.81
+	lw	$13, 62($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.82
+	la	$13, L.84
+	sw	$13, 62($sp)
+L.82:
+	lw	$13, 62($sp)
+	sw	$13, 0($sp)
+	jal	opendir
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sneu	$13, $13, $0
+	bnez	$13, L.89
+	la	$13, L.87
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.80
+L.88:
+	lw	$13, 2($7)
+	addui	$12, $0, 46
+	sneu	$13, $13, $12
+	bnez	$13, L.91
+	lw	$13, 63($sp)
+	andi	$13, $13, 1
+	sne	$13, $13, $0
+	bnez	$13, L.91
+	j	L.89
+L.91:
+	lw	$13, 63($sp)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.93
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	lw	$13, 62($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 50
+	sw	$13, 2($sp)
+	jal	strlcpy
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	la	$13, L.81
+	sw	$13, 1($sp)
+	addui	$13, $0, 50
+	sw	$13, 2($sp)
+	jal	strlcat
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	addui	$13, $7, 2
+	sw	$13, 1($sp)
+	addui	$13, $0, 50
+	sw	$13, 2($sp)
+	jal	strlcat
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	lw	$13, 63($sp)
+	sw	$13, 1($sp)
+	jal	print_long_format
+	j	L.94
+L.93:
+	lw	$13, 1($7)
+	addui	$12, $0, 4
+	sneu	$13, $13, $12
+	bnez	$13, L.97
+	lw	$13, 2($7)
+	addui	$12, $0, 46
+	sequ	$13, $13, $12
+	bnez	$13, L.97
+	addu	$3, $0, $4
+	j	L.98
+L.97:
+	la	$3, L.95
+L.98:
+	addu	$5, $0, $3
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.99
+	sw	$13, 1($sp)
+	sw	$5, 2($sp)
+	addui	$13, $7, 2
+	sw	$13, 3($sp)
+	jal	dprintf
+L.94:
+L.89:
+	sw	$6, 0($sp)
+	jal	readdir
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.88
+	lw	$13, 63($sp)
+	andi	$13, $13, 2
+	sne	$13, $13, $0
+	bnez	$13, L.100
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.102
+	sw	$13, 1($sp)
+	jal	dprintf
+L.100:
+	sw	$6, 0($sp)
+	jal	closedir
+	addu	$1, $0, $0
+L.80:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 62
+	jr	$ra
+.global	usage
+usage:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.105
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.103:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	main
+main:
+	subui	$sp, $sp, 13
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	la	$13, L.84
+	sw	$13, 12($sp)
+	addu	$6, $0, $0
+	addui	$13, $0, 1
+	addu	$5, $0, $13
+	lw	$13, 14($sp)
+	lw	$7, 1($13)
+	addu	$13, $0, $7
+	sw	$13, 10($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.107
+	lw	$13, 10($sp)
+	addui	$7, $13, 1
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 45
+	bnez	$13, L.107
+	addi	$5, $5, 1
+	j	L.110
+L.109:
+	lw	$4, 0($7)
+	addui	$13, $0, 104
+	sw	$13, 9($sp)
+	seq	$13, $4, $13
+	bnez	$13, L.117
+	lw	$13, 9($sp)
+	sgt	$13, $4, $13
+	bnez	$13, L.119
+L.118:
+	seqi	$13, $4, 97
+	bnez	$13, L.115
+	j	L.112
+L.119:
+	seqi	$13, $4, 108
+	bnez	$13, L.116
+	j	L.112
+L.115:
+	ori	$6, $6, 1
+	j	L.113
+L.116:
+	ori	$6, $6, 2
+	j	L.113
+L.117:
+	ori	$6, $6, 4
+	j	L.113
+L.112:
+	jal	usage
+L.113:
+	addui	$7, $7, 1
+L.110:
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.109
+L.107:
+	lw	$13, 13($sp)
+	sge	$13, $5, $13
+	bnez	$13, L.120
+	lw	$13, 14($sp)
+	addu	$13, $5, $13
+	lw	$13, 0($13)
+	sw	$13, 12($sp)
+L.120:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	do_ls
+	addu	$13, $0, $1
+	sw	$13, 11($sp)
+	lw	$1, 11($sp)
+L.106:
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.bss
+buffer:
+	.space	128
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.105:
+	.asciiz	"ls [-l] [-a] [-h] FOLDER\n"
+L.102:
+	.asciiz	"\n"
+L.99:
+	.asciiz	"%s%s  "
+L.95:
+	.asciiz	""
+L.87:
+	.asciiz	"opendir"
+L.84:
+	.asciiz	"."
+L.81:
+	.asciiz	"/"
+L.74:
+	.asciiz	"%02d/%02d/%04d %02d:%02d:%02d %s\n"
+L.72:
+	.asciiz	"%5d "
+L.71:
+	.asciiz	"%2d.%.3dKB "
+L.63:
+	.asciiz	"%s %2d %s %s "
+L.35:
+	.asciiz	"root"
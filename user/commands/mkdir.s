@@ -0,0 +1,56 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 6
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.2
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	addui	$13, $0, 40
+	sw	$13, 0($sp)
+	addui	$13, $0, 493
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	lw	$13, 1($13)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.6
+	la	$13, L.8
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.6:
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	wramp_syscall
+	addu	$1, $0, $0
+L.1:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.8:
+	.asciiz	"mkdir"
+L.5:
+	.asciiz	"mising file operand\n"
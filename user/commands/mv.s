@@ -0,0 +1,175 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 36
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 36($sp)
+	sgei	$13, $13, 3
+	bnez	$13, L.2
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	jal	dprintf
+	j	L.6
+L.2:
+	lw	$13, 37($sp)
+	addui	$13, $13, 1
+	sw	$13, 37($sp)
+	lw	$5, 0($13)
+	lw	$13, 37($sp)
+	addui	$13, $13, 1
+	sw	$13, 37($sp)
+	lw	$6, 0($13)
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.7
+	sw	$5, 0($sp)
+	jal	perror
+	j	L.6
+L.7:
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 23
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.9
+	lw	$13, 25($sp)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 0x8000
+	sequ	$13, $13, $12
+	bnez	$13, L.17
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.15
+	sw	$13, 1($sp)
+	jal	dprintf
+	j	L.6
+L.16:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.19
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	dprintf
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	la	$13, buffer
+	sw	$13, 2($sp)
+	addui	$13, $0, 256
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, buffer($0)
+	snei	$13, $13, 110
+	bnez	$13, L.20
+	addu	$1, $0, $0
+	j	L.1
+L.20:
+	lw	$13, buffer($0)
+	snei	$13, $13, 121
+	bnez	$13, L.22
+	addui	$13, $0, 37
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.18
+	la	$13, L.26
+	sw	$13, 0($sp)
+	jal	perror
+	j	L.6
+L.22:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.27
+	sw	$13, 1($sp)
+	jal	dprintf
+L.17:
+	j	L.16
+L.18:
+L.9:
+	addui	$13, $0, 36
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.28
+	la	$13, L.30
+	sw	$13, 0($sp)
+	jal	perror
+	j	L.6
+L.28:
+	addui	$13, $0, 37
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.31
+	la	$13, L.33
+	sw	$13, 0($sp)
+	jal	perror
+	j	L.6
+L.31:
+	addu	$1, $0, $0
+	j	L.1
+L.6:
+	addui	$1, $0, 1
+L.1:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 36
+	jr	$ra
+.bss
+buffer:
+	.space	256
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.33:
+	.asciiz	"unlink"
+L.30:
+	.asciiz	"cant link"
+L.27:
+	.asciiz	"plz type y or n\n"
+L.26:
+	.asciiz	"cant overwrite"
+L.19:
+	.asciiz	"overwrite %s (y/n)? "
+L.15:
+	.asciiz	"dest not regular file\n"
+L.5:
+	.asciiz	"usage: mv [SRC] [DEST]\n"
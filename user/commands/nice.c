@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <bsd/string.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/resource.h>
+
+#define PATH_LEN    (64)
+
+void usage(){
+    fprintf(stderr, "usage: nice [-n adjustment] [-s] command [args...]\n");
+    fprintf(stderr, "  -s  run the command in the proportional share class\n");
+}
+
+int main(int argc, char *argv[]){
+    int i, inc = 10;
+    int stride = 0;
+    char *endptr;
+    char path[PATH_LEN];
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++){
+        if(strcmp(argv[i], "-n") == 0 && i + 1 < argc){
+            inc = strtol(argv[i + 1], &endptr, 10);
+            if (*endptr){
+                fprintf(stderr, "Invalid adjustment: %s\n", argv[i + 1]);
+                return 1;
+            }
+            i++;
+        } else if(strcmp(argv[i], "-s") == 0){
+            stride = 1;
+        } else {
+            usage();
+            return 1;
+        }
+    }
+
+    if(i >= argc){
+        usage();
+        return 1;
+    }
+
+    // -1 is also a valid nice value
+    errno = 0;
+    if(nice(inc) == -1 && errno){
+        perror("nice");
+        return 1;
+    }
+    if(stride && sched_setscheduler(0, SCHED_STRIDE, NULL)){
+        perror("sched_setscheduler");
+        return 1;
+    }
+
+    if(strchr(argv[i], '/')){
+        strlcpy(path, argv[i], PATH_LEN);
+    }else{
+        strlcpy(path, "/bin/", PATH_LEN);
+        strlcat(path, argv[i], PATH_LEN);
+    }
+    execv(path, argv + i);
+    fprintf(stderr, "nice: cannot run %s\n", argv[i]);
+    return 1;
+}
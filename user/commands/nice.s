@@ -0,0 +1,265 @@
+.global	usage
+.text
+usage:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	jal	dprintf
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.7
+	sw	$13, 1($sp)
+	jal	dprintf
+L.3:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	main
+main:
+	subui	$sp, $sp, 76
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$6, $0, 10
+	addu	$5, $0, $0
+	addui	$7, $0, 1
+	j	L.12
+L.9:
+	lw	$13, 77($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	la	$13, L.15
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.13
+	addi	$13, $7, 1
+	lw	$12, 76($sp)
+	sge	$13, $13, $12
+	bnez	$13, L.13
+	addi	$13, $7, 1
+	lw	$12, 77($sp)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 75
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	lw	$13, 75($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.16
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.19
+	sw	$13, 1($sp)
+	addi	$13, $7, 1
+	lw	$12, 77($sp)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.8
+L.16:
+	addi	$7, $7, 1
+	j	L.14
+L.13:
+	lw	$13, 77($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	la	$13, L.22
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.20
+	addui	$5, $0, 1
+	j	L.21
+L.20:
+	jal	usage
+	addui	$1, $0, 1
+	j	L.8
+L.21:
+L.14:
+L.10:
+	addi	$7, $7, 1
+L.12:
+	lw	$13, 76($sp)
+	sge	$13, $7, $13
+	bnez	$13, L.23
+	lw	$13, 77($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	lw	$13, 0($13)
+	seqi	$13, $13, 45
+	bnez	$13, L.9
+L.23:
+	lw	$13, 76($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.24
+	jal	usage
+	addui	$1, $0, 1
+	j	L.8
+L.24:
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$0, 0($13)
+	sw	$6, 0($sp)
+	jal	nice
+	addu	$13, $0, $1
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.26
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	sequ	$13, $13, $0
+	bnez	$13, L.26
+	la	$13, L.28
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.8
+L.26:
+	addu	$13, $0, $0
+	sw	$13, 10($sp)
+	seq	$13, $5, $13
+	bnez	$13, L.29
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	sched_setscheduler
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.29
+	la	$13, L.31
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.8
+L.29:
+	lw	$13, 77($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 47
+	sw	$13, 1($sp)
+	jal	index
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.32
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	lw	$13, 77($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	jal	strlcpy
+	j	L.33
+L.32:
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	la	$13, L.34
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	jal	strlcpy
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	lw	$13, 77($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	jal	strlcat
+L.33:
+	jal	get_environ
+	addu	$13, $0, $1
+	addui	$12, $0, 5
+	sw	$12, 0($sp)
+	addui	$12, $sp, 11
+	sw	$12, 1($sp)
+	lw	$12, 77($sp)
+	addu	$12, $7, $12
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.36
+	sw	$13, 1($sp)
+	lw	$13, 77($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+L.8:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 76
+	jr	$ra
+.extern	errlist 40
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.36:
+	.asciiz	"nice: cannot run %s\n"
+L.34:
+	.asciiz	"/bin/"
+L.31:
+	.asciiz	"sched_setscheduler"
+L.28:
+	.asciiz	"nice"
+L.22:
+	.asciiz	"-s"
+L.19:
+	.asciiz	"Invalid adjustment: %s\n"
+L.15:
+	.asciiz	"-n"
+L.7:
+	.asciiz	"  -s  run the command in the proportional share class\n"
+L.5:
+	.asciiz	"usage: nice [-n adjustment] [-s] command [args...]\n"
@@ -0,0 +1,43 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 134
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 52
+	sw	$13, 0($sp)
+	addui	$13, $0, 128
+	sw	$13, 1($sp)
+	addui	$13, $sp, 6
+	sw	$13, 2($sp)
+	jal	ptr_wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.2
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.4
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.1:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 134
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.4:
+	.asciiz	"%s\n"
@@ -0,0 +1,87 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 21
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 22($sp)
+	addui	$13, $13, 1
+	sw	$13, 22($sp)
+	lw	$6, 0($13)
+	lw	$13, 21($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.2
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 8
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.6
+	sw	$6, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.6:
+	lw	$13, 10($sp)
+	addui	$12, $0, 0xf000
+	and	$13, $13, $12
+	addui	$12, $0, 0x8000
+	sequ	$13, $13, $12
+	bnez	$13, L.8
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.12
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.8:
+	addui	$13, $0, 37
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.13
+	la	$13, L.15
+	sw	$13, 0($sp)
+	jal	perror
+L.13:
+	addu	$1, $0, $7
+L.1:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 21
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.15:
+	.asciiz	"rm failed"
+L.12:
+	.asciiz	"%s is not regular file\n"
+L.5:
+	.asciiz	"usage: rm [FILE]\n"
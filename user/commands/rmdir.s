@@ -0,0 +1,53 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 6
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	addui	$13, $13, 1
+	sw	$13, 7($sp)
+	lw	$13, 0($13)
+	sw	$13, 5($sp)
+	lw	$13, 6($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.2
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	addui	$13, $0, 56
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.6
+	la	$13, L.8
+	sw	$13, 0($sp)
+	jal	perror
+L.6:
+	addu	$1, $0, $7
+L.1:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.8:
+	.asciiz	"rmdir failed"
+L.5:
+	.asciiz	"usage: rmdir [DIRECTORY]\n"
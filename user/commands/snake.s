@@ -0,0 +1,1338 @@
+.global	tty_inited
+tty_inited:
+	.word	0x0
+.global	new_point
+.text
+new_point:
+	subui	$sp, $sp, 4
+	sw	$7, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 4
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 4($sp)
+	sw	$13, 0($7)
+	lw	$13, 5($sp)
+	sw	$13, 1($7)
+	addu	$1, $0, $7
+L.3:
+	lw	$7, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	new_food
+new_food:
+	subui	$sp, $sp, 6
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	jal	rand
+	addu	$13, $0, $1
+	remi	$13, $13, 48
+	addi	$13, $13, 1
+	sw	$13, 5($sp)
+	jal	rand
+	addu	$13, $0, $1
+	remi	$13, $13, 14
+	addi	$13, $13, 1
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	lw	$13, 4($sp)
+	sw	$13, 1($sp)
+	jal	new_point
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.4:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+cursor_str:
+	.word	0x1b
+	.word	0x5b
+	.word	0x3f
+	.word	0x32
+	.word	0x35
+	.word	0x6c
+	.word	0x0
+.global	disable_cursor
+.text
+disable_cursor:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.6
+	sw	$13, 1($sp)
+	la	$13, cursor_str
+	sw	$13, 2($sp)
+	jal	dprintf
+L.5:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	enable_cursor
+enable_cursor:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 104
+	sw	$13, cursor_str+5($0)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.6
+	sw	$13, 1($sp)
+	la	$13, cursor_str
+	sw	$13, 2($sp)
+	jal	dprintf
+L.7:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	int2str
+int2str:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	j	L.11
+L.10:
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	div	$13, $13, $12
+	remi	$7, $13, 10
+	lw	$13, 5($sp)
+	addui	$12, $13, 1
+	sw	$12, 5($sp)
+	addi	$12, $7, 48
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	divi	$13, $13, 10
+	sw	$13, 4($sp)
+L.11:
+	lw	$13, 4($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.10
+L.9:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+draw_pos:
+	.word	0x1b
+	.word	0x5b
+	.word	0x30
+	.word	0x30
+	.word	0x30
+	.word	0x3b
+	.word	0x30
+	.word	0x30
+	.word	0x30
+	.word	0x48
+	.word	0x0
+coordinate_format:
+	.asciiz	"%s "
+.global	draw_coordinate
+.text
+draw_coordinate:
+	subui	$sp, $sp, 6
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	la	$7, draw_pos
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 100
+	sw	$13, 1($sp)
+	addui	$13, $7, 2
+	sw	$13, 2($sp)
+	jal	int2str
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 100
+	sw	$13, 1($sp)
+	addui	$13, $7, 6
+	sw	$13, 2($sp)
+	jal	int2str
+	lw	$13, 8($sp)
+	sw	$13, coordinate_format+2($0)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, coordinate_format
+	sw	$13, 1($sp)
+	la	$13, draw_pos
+	sw	$13, 2($sp)
+	jal	dprintf
+L.13:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+L.16:
+	.word	0x1b
+	.word	0x5b
+	.word	0x30
+	.word	0x3b
+	.word	0x30
+	.word	0x48
+	.word	0x1b
+	.word	0x5b
+	.word	0x32
+	.word	0x4a
+	.word	0x0
+.global	clear_screen
+.text
+clear_screen:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.6
+	sw	$13, 1($sp)
+	la	$13, L.16
+	sw	$13, 2($sp)
+	jal	dprintf
+L.15:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	print_to_central_screen
+print_to_central_screen:
+	subui	$sp, $sp, 8
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	addui	$13, $0, 25
+	lw	$12, 7($sp)
+	divi	$12, $12, 2
+	sub	$13, $13, $12
+	subi	$13, $13, 1
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 32
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.6
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.17:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	print_instruction
+print_instruction:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$7, $0, 7
+	addu	$13, $0, $7
+	addi	$7, $13, 1
+	sw	$13, 0($sp)
+	la	$13, L.19
+	sw	$13, 1($sp)
+	jal	print_to_central_screen
+	addu	$13, $0, $7
+	addi	$7, $13, 1
+	sw	$13, 0($sp)
+	la	$13, L.20
+	sw	$13, 1($sp)
+	jal	print_to_central_screen
+	sw	$7, 0($sp)
+	la	$13, L.21
+	sw	$13, 1($sp)
+	jal	print_to_central_screen
+L.18:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	print_border
+print_border:
+	subui	$sp, $sp, 10
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$13, $0, 50
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	addu	$6, $0, $4
+	addui	$5, $0, 48
+	addu	$7, $0, $0
+	j	L.26
+L.23:
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	addui	$12, $0, 45
+	sw	$12, 0($13)
+L.24:
+	addi	$7, $7, 1
+L.26:
+	slt	$13, $7, $5
+	bnez	$13, L.23
+	sw	$0, 0($6)
+	addu	$13, $0, $0
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 45
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.6
+	sw	$13, 1($sp)
+	sw	$4, 2($sp)
+	jal	dprintf
+	sw	$0, 0($sp)
+	addui	$13, $0, 15
+	sw	$13, 1($sp)
+	addui	$13, $0, 45
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.6
+	sw	$13, 1($sp)
+	sw	$4, 2($sp)
+	jal	dprintf
+	addui	$7, $0, 1
+L.27:
+	sw	$0, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $0, 124
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+L.28:
+	addi	$7, $7, 1
+	slti	$13, $7, 15
+	bnez	$13, L.27
+	addui	$7, $0, 1
+L.31:
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	addui	$13, $0, 124
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+L.32:
+	addi	$7, $7, 1
+	slti	$13, $7, 15
+	bnez	$13, L.31
+	sw	$4, 0($sp)
+	jal	free
+L.22:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	init_tty
+init_tty:
+	subui	$sp, $sp, 50
+	sw	$8, 4($sp)
+	sw	$9, 5($sp)
+	sw	$10, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	la	$13, prev_termios
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $sp, 11
+	la	$9, prev_termios
+	addui	$9, $9, 39
+	addui	$11, $13, 39
+L.39:
+	subui	$9, $9, 1
+	subui	$11, $11, 1
+	lw	$8, 0($9)
+	sw	$8, 0($11)
+	sltu	$10, $13, $11
+	bnez	$10, L.39
+	lw	$13, 14($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfff5
+	addu	$12, $0, $12
+	and	$13, $13, $12
+	sw	$13, 14($sp)
+	sw	$0, 22($sp)
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	addui	$13, $sp, 11
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 1
+	sw	$13, tty_inited($0)
+L.35:
+	lw	$8, 4($sp)
+	lw	$9, 5($sp)
+	lw	$10, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 50
+	jr	$ra
+.global	restore_tty
+restore_tty:
+	subui	$sp, $sp, 6
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, tty_inited($0)
+	seq	$13, $13, $0
+	bnez	$13, L.41
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	la	$13, prev_termios
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	jal	enable_cursor
+L.41:
+L.40:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	board_init
+board_init:
+	subui	$sp, $sp, 10
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	srand
+L.44:
+	lw	$13, 10($sp)
+	addui	$13, $13, 2
+	sw	$13, 0($13)
+	lw	$13, 10($sp)
+	addui	$12, $13, 2
+	sw	$12, 3($13)
+L.45:
+L.47:
+	lw	$13, 10($sp)
+	sw	$13, 0($13)
+	lw	$13, 10($sp)
+	sw	$13, 1($13)
+L.48:
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 4354
+	sw	$13, 1($sp)
+	la	$13, L.50
+	sw	$13, 2($sp)
+	addui	$13, $0, 420
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addui	$13, $0, 35
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	wramp_syscall
+	jal	init_tty
+	jal	disable_cursor
+	addu	$7, $0, $0
+L.51:
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	la	$13, restore_tty
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+L.52:
+	addi	$7, $7, 1
+	slti	$13, $7, 21
+	bnez	$13, L.51
+L.43:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	init_snake_food
+init_snake_food:
+	subui	$sp, $sp, 11
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addu	$5, $0, $0
+L.56:
+	jal	new_food
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.60:
+L.63:
+	addui	$4, $7, 2
+	lw	$13, 11($sp)
+	addui	$3, $13, 2
+	lw	$13, 11($sp)
+	lw	$2, 2($13)
+	sw	$4, 1($2)
+	sw	$2, 0($4)
+	sw	$3, 1($4)
+	sw	$4, 0($3)
+L.64:
+L.61:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	addui	$13, $0, 111
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+L.57:
+	addi	$5, $5, 1
+	slti	$13, $5, 10
+	bnez	$13, L.56
+	addui	$5, $0, 1
+L.66:
+	sw	$5, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	new_point
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+L.70:
+L.73:
+	addui	$4, $6, 2
+	lw	$3, 11($sp)
+	lw	$13, 11($sp)
+	lw	$2, 0($13)
+	sw	$4, 1($2)
+	sw	$2, 0($4)
+	sw	$3, 1($4)
+	sw	$4, 0($3)
+L.74:
+L.71:
+	lw	$13, 0($6)
+	sw	$13, 0($sp)
+	lw	$13, 1($6)
+	sw	$13, 1($sp)
+	addui	$13, $0, 120
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+L.67:
+	addi	$5, $5, 1
+	slei	$13, $5, 3
+	bnez	$13, L.66
+L.55:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	debug_board
+debug_board:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.78
+	sw	$13, 1($sp)
+	jal	dprintf
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+	j	L.82
+L.79:
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.84
+	sw	$13, 1($sp)
+	lw	$13, 0($7)
+	sw	$13, 2($sp)
+	lw	$13, 1($7)
+	sw	$13, 3($sp)
+	jal	dprintf
+L.80:
+	lw	$13, 2($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+L.82:
+	addui	$13, $7, 2
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.79
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.86
+	sw	$13, 1($sp)
+	jal	dprintf
+L.76:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	get_direction
+get_direction:
+	subui	$sp, $sp, 7
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, 7($sp)
+	lw	$13, 4($13)
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	sw	$13, 5($sp)
+	seqi	$13, $13, 113
+	bnez	$13, L.102
+	addui	$13, $0, 115
+	sw	$13, 4($sp)
+	lw	$12, 5($sp)
+	seq	$13, $12, $13
+	bnez	$13, L.96
+	lw	$13, 5($sp)
+	lw	$12, 4($sp)
+	sgt	$13, $13, $12
+	bnez	$13, L.104
+L.103:
+	lw	$13, 8($sp)
+	sw	$13, 3($sp)
+	seqi	$13, $13, 97
+	bnez	$13, L.93
+	lw	$13, 3($sp)
+	seqi	$13, $13, 100
+	bnez	$13, L.99
+	j	L.89
+L.104:
+	lw	$13, 8($sp)
+	seqi	$13, $13, 119
+	bnez	$13, L.90
+	j	L.89
+L.90:
+	lw	$13, 6($sp)
+	snei	$13, $13, 3
+	bnez	$13, L.91
+	addui	$1, $0, 3
+	j	L.87
+L.91:
+	addui	$1, $0, 1
+	j	L.87
+L.93:
+	lw	$13, 6($sp)
+	snei	$13, $13, 2
+	bnez	$13, L.94
+	addui	$1, $0, 2
+	j	L.87
+L.94:
+	addu	$1, $0, $0
+	j	L.87
+L.96:
+	lw	$13, 6($sp)
+	snei	$13, $13, 1
+	bnez	$13, L.97
+	addui	$1, $0, 1
+	j	L.87
+L.97:
+	addui	$1, $0, 3
+	j	L.87
+L.99:
+	lw	$13, 6($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.100
+	addu	$1, $0, $0
+	j	L.87
+L.100:
+	addui	$1, $0, 2
+	j	L.87
+L.102:
+	jal	quit
+L.89:
+	lw	$1, 6($sp)
+L.87:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	get_point_at_coordinate
+get_point_at_coordinate:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 3($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+	j	L.109
+L.106:
+	lw	$13, 0($7)
+	lw	$12, 4($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.110
+	lw	$13, 1($7)
+	lw	$12, 5($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.110
+	addu	$1, $0, $7
+	j	L.105
+L.110:
+L.107:
+	lw	$13, 2($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+L.109:
+	addui	$13, $7, 2
+	addu	$13, $0, $13
+	lw	$12, 3($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.106
+	addu	$1, $0, $0
+L.105:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	_refresh
+_refresh:
+	subui	$sp, $sp, 16
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, 16($sp)
+	lw	$13, 4($13)
+	sw	$13, 15($sp)
+	lw	$13, 16($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$3, $13, $12
+	lw	$5, 0($3)
+	lw	$4, 1($3)
+	lw	$2, 15($sp)
+	slt	$13, $2, $0
+	bnez	$13, L.113
+	sgti	$13, $2, 3
+	bnez	$13, L.113
+	lw	$13, L.128($2)
+	jr	$13
+.data
+L.128:
+	.word	L.116
+	.word	L.119
+	.word	L.122
+	.word	L.125
+.text
+L.116:
+	snei	$13, $5, 1
+	bnez	$13, L.117
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffe
+	j	L.112
+L.117:
+	subi	$5, $5, 1
+	j	L.114
+L.119:
+	snei	$13, $4, 1
+	bnez	$13, L.120
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffb
+	j	L.112
+L.120:
+	subi	$4, $4, 1
+	j	L.114
+L.122:
+	slti	$13, $5, 48
+	bnez	$13, L.123
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffd
+	j	L.112
+L.123:
+	addi	$5, $5, 1
+	j	L.114
+L.125:
+	slti	$13, $4, 14
+	bnez	$13, L.126
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffc
+	j	L.112
+L.126:
+	addi	$4, $4, 1
+	j	L.114
+L.113:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.112
+L.114:
+	lw	$13, 16($sp)
+	addui	$13, $13, 2
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	sw	$4, 2($sp)
+	jal	get_point_at_coordinate
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.129
+	lw	$13, 16($sp)
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	sw	$4, 2($sp)
+	jal	get_point_at_coordinate
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.131
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfffa
+	j	L.112
+L.131:
+	lw	$13, 16($sp)
+	lw	$13, 1($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	addui	$13, $0, 32
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+	j	L.130
+L.129:
+	jal	new_food
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+L.133:
+L.136:
+	addui	$13, $6, 2
+	sw	$13, 14($sp)
+	lw	$13, 16($sp)
+	addui	$13, $13, 2
+	sw	$13, 13($sp)
+	lw	$13, 16($sp)
+	lw	$13, 2($13)
+	sw	$13, 12($sp)
+	lw	$13, 12($sp)
+	lw	$12, 14($sp)
+	sw	$12, 1($13)
+	lw	$13, 14($sp)
+	lw	$12, 12($sp)
+	sw	$12, 0($13)
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	sw	$12, 1($13)
+	lw	$13, 13($sp)
+	lw	$12, 14($sp)
+	sw	$12, 0($13)
+L.137:
+L.134:
+	lw	$13, 0($6)
+	sw	$13, 0($sp)
+	lw	$13, 1($6)
+	sw	$13, 1($sp)
+	addui	$13, $0, 111
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+L.130:
+L.139:
+L.142:
+L.145:
+	lw	$13, 2($7)
+	lw	$12, 3($7)
+	sw	$12, 1($13)
+	lw	$13, 3($7)
+	lw	$12, 2($7)
+	sw	$12, 0($13)
+L.146:
+L.143:
+	sw	$0, 2($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 3($7)
+L.140:
+	sw	$5, 0($7)
+	sw	$4, 1($7)
+L.148:
+L.151:
+	addui	$13, $7, 2
+	sw	$13, 14($sp)
+	lw	$13, 16($sp)
+	sw	$13, 13($sp)
+	lw	$13, 16($sp)
+	lw	$13, 0($13)
+	sw	$13, 12($sp)
+	lw	$13, 12($sp)
+	lw	$12, 14($sp)
+	sw	$12, 1($13)
+	lw	$13, 14($sp)
+	lw	$12, 12($sp)
+	sw	$12, 0($13)
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	sw	$12, 1($13)
+	lw	$13, 13($sp)
+	lw	$12, 14($sp)
+	sw	$12, 0($13)
+L.152:
+L.149:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	addui	$13, $0, 120
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+	addu	$1, $0, $0
+L.112:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.global	refresh
+refresh:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	_refresh
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.155
+	addui	$13, $0, 6
+	sw	$13, 0($sp)
+	la	$13, L.157
+	sw	$13, 1($sp)
+	jal	print_to_central_screen
+L.155:
+	addu	$1, $0, $7
+L.154:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	draw
+draw:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+	j	L.162
+L.159:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	addui	$13, $0, 120
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+L.160:
+	lw	$13, 2($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+L.162:
+	addui	$13, $7, 2
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.159
+	lw	$13, 7($sp)
+	lw	$13, 2($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+	j	L.166
+L.163:
+	lw	$13, 0($7)
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	addui	$13, $0, 111
+	sw	$13, 2($sp)
+	jal	draw_coordinate
+L.164:
+	lw	$13, 2($7)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffe
+	addu	$7, $13, $12
+L.166:
+	addui	$13, $7, 2
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	addui	$12, $12, 2
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.163
+L.158:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	get_chr
+get_chr:
+	subui	$sp, $sp, 8
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 6
+	sw	$13, 2($sp)
+	addui	$13, $0, 1
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$13, 7($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.168
+	lw	$1, 6($sp)
+	j	L.167
+L.168:
+	addu	$1, $0, $0
+L.167:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	reset_board
+reset_board:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+L.171:
+	lw	$13, 2($sp)
+	sw	$13, 0($13)
+	lw	$13, 2($sp)
+	sw	$13, 1($13)
+L.172:
+L.174:
+	lw	$13, 2($sp)
+	addui	$13, $13, 2
+	sw	$13, 0($13)
+	lw	$13, 2($sp)
+	addui	$12, $13, 2
+	sw	$12, 3($13)
+L.175:
+	lw	$13, 2($sp)
+	addui	$12, $0, 2
+	sw	$12, 4($13)
+L.170:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	quit
+quit:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	sw	$0, 0($sp)
+	jal	restore_tty
+	jal	clear_screen
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+L.177:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.bss
+L.179:
+	.space	12
+L.180:
+	.space	5
+.global	main
+.text
+main:
+	subui	$sp, $sp, 16
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	la	$5, L.180
+	addui	$4, $0, 1
+	addui	$2, $0, 1
+	addui	$3, $0, 1
+	addui	$13, $sp, 14
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	memset
+	sw	$5, 0($sp)
+	jal	board_init
+	jal	clear_screen
+	sw	$5, 0($sp)
+	jal	print_border
+	lhi	$13, 0x773
+	ori	$13, $13, 0x5940
+	sw	$13, 15($sp)
+	j	L.183
+L.182:
+	jal	print_instruction
+	j	L.186
+L.185:
+	jal	get_chr
+	addu	$13, $0, $1
+	sw	$13, 13($sp)
+	lw	$13, 13($sp)
+	snei	$13, $13, 32
+	bnez	$13, L.188
+	j	L.187
+L.188:
+	lw	$13, 13($sp)
+	snei	$13, $13, 113
+	bnez	$13, L.190
+	jal	quit
+L.190:
+L.186:
+	sne	$13, $3, $0
+	bnez	$13, L.185
+L.187:
+	sw	$5, 0($sp)
+	jal	reset_board
+	jal	clear_screen
+	sw	$5, 0($sp)
+	jal	print_border
+	sw	$5, 0($sp)
+	jal	init_snake_food
+	addui	$4, $0, 1
+	j	L.193
+L.192:
+	sw	$0, 13($sp)
+	addui	$13, $0, 47
+	sw	$13, 0($sp)
+	addui	$13, $sp, 14
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	la	$13, L.179
+	sw	$13, 2($sp)
+	addui	$13, $0, 12
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sne	$13, $6, $0
+	bnez	$13, L.195
+	sw	$5, 0($sp)
+	jal	refresh
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.197
+	addu	$4, $0, $0
+	j	L.194
+L.197:
+L.195:
+	addu	$7, $0, $0
+	j	L.202
+L.199:
+	seq	$13, $7, $0
+	bnez	$13, L.203
+	lw	$13, L.179($7)
+	lw	$12, 13($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.203
+	j	L.200
+L.203:
+	la	$13, L.179
+	addu	$13, $7, $13
+	lw	$12, 0($13)
+	sw	$12, 13($sp)
+	sw	$5, 0($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	get_direction
+	addu	$13, $0, $1
+	sw	$13, 4($5)
+	sw	$5, 0($sp)
+	jal	refresh
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $6, $0
+	bnez	$13, L.205
+	addu	$4, $0, $0
+	j	L.201
+L.205:
+L.200:
+	addi	$7, $7, 1
+L.202:
+	slt	$13, $7, $6
+	bnez	$13, L.199
+L.201:
+L.193:
+	sne	$13, $4, $0
+	bnez	$13, L.192
+L.194:
+L.183:
+	sne	$13, $2, $0
+	bnez	$13, L.182
+	jal	quit
+	addu	$1, $0, $0
+L.178:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.bss
+.global	prev_termios
+prev_termios:
+	.space	39
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.157:
+	.asciiz	"You lost :("
+L.86:
+	.asciiz	"\n"
+L.84:
+	.asciiz	"x %d y %d; "
+L.78:
+	.asciiz	"points: "
+L.50:
+	.asciiz	"/var/log/snake.log"
+L.21:
+	.asciiz	"Press q to exit"
+L.20:
+	.asciiz	"Press SPACE to start"
+L.19:
+	.asciiz	"Use WASD to move"
+L.6:
+	.asciiz	"%s"
@@ -0,0 +1,87 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 30
+	sw	$4, 8($sp)
+	sw	$5, 9($sp)
+	sw	$6, 10($sp)
+	sw	$7, 11($sp)
+	sw	$12, 12($sp)
+	sw	$13, 13($sp)
+	sw	$ra, 14($sp)
+	lw	$13, 31($sp)
+	lw	$6, 1($13)
+	lw	$13, 30($sp)
+	seqi	$13, $13, 2
+	bnez	$13, L.2
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	addui	$13, $sp, 17
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 16($sp)
+	lw	$13, 16($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.4
+	la	$13, L.6
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.1
+L.4:
+	lw	$13, 24($sp)
+	addu	$5, $0, $13
+	addui	$13, $0, 1024
+	div	$12, $5, $13
+	sw	$12, 15($sp)
+	rem	$7, $5, $13
+	slti	$13, $7, 1000
+	bnez	$13, L.9
+	addui	$4, $0, 999
+	j	L.10
+L.9:
+	addu	$4, $0, $7
+L.10:
+	addu	$7, $0, $4
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.11
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	lw	$13, 18($sp)
+	sw	$13, 3($sp)
+	lw	$13, 15($sp)
+	sw	$13, 4($sp)
+	sw	$7, 5($sp)
+	lw	$13, 26($sp)
+	sw	$13, 6($sp)
+	lw	$13, 19($sp)
+	addui	$12, $0, 511
+	and	$13, $13, $12
+	sw	$13, 7($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.1:
+	lw	$4, 8($sp)
+	lw	$5, 9($sp)
+	lw	$6, 10($sp)
+	lw	$7, 11($sp)
+	lw	$12, 12($sp)
+	lw	$13, 13($sp)
+	lw	$ra, 14($sp)
+	addui	$sp, $sp, 30
+	jr	$ra
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.11:
+	.asciiz	"File: %s\nNum: %d\nSize: %d.%.3dKB\nBlocks: %d\nAccess: 0%o\n"
+L.6:
+	.asciiz	"stat"
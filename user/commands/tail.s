@@ -0,0 +1,340 @@
+.global	print_last_n_lines
+.text
+print_last_n_lines:
+	subui	$sp, $sp, 15
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	sw	$0, 14($sp)
+	sw	$0, 13($sp)
+	addu	$4, $0, $0
+	addu	$7, $0, $0
+	addu	$5, $0, $0
+	addui	$13, $0, 1
+	lw	$12, 16($sp)
+	addu	$12, $0, $12
+	multu	$13, $13, $12
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	j	L.5
+L.4:
+	addi	$2, $3, 1
+	lw	$13, 16($sp)
+	slt	$13, $4, $13
+	bnez	$13, L.7
+	addu	$13, $7, $6
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	jal	free
+L.7:
+	addu	$13, $0, $2
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$12, $7, $6
+	sw	$13, 0($12)
+	addu	$13, $7, $6
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	sw	$13, 1($sp)
+	addu	$13, $0, $2
+	sw	$13, 2($sp)
+	jal	strlcpy
+	addi	$13, $7, 1
+	lw	$12, 16($sp)
+	rem	$7, $13, $12
+	addi	$4, $4, 1
+L.5:
+	addui	$13, $sp, 14
+	sw	$13, 0($sp)
+	addui	$13, $sp, 13
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	lw	$13, 15($sp)
+	sw	$13, 3($sp)
+	jal	getdelim
+	addu	$13, $0, $1
+	addu	$3, $0, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.4
+	lw	$13, 14($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.9
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	jal	free
+L.9:
+	lw	$13, 16($sp)
+	sge	$13, $4, $13
+	bnez	$13, L.11
+	addu	$5, $0, $0
+	j	L.16
+L.13:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.17
+	sw	$13, 1($sp)
+	addu	$13, $5, $6
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addu	$13, $5, $6
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	jal	free
+L.14:
+	addi	$5, $5, 1
+L.16:
+	slt	$13, $5, $4
+	bnez	$13, L.13
+	j	L.12
+L.11:
+	addu	$5, $0, $0
+	j	L.21
+L.18:
+	add	$13, $7, $5
+	lw	$12, 16($sp)
+	rem	$13, $13, $12
+	addu	$13, $13, $6
+	lw	$2, 0($13)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.17
+	sw	$13, 1($sp)
+	sw	$2, 2($sp)
+	jal	dprintf
+	sw	$2, 0($sp)
+	jal	free
+L.19:
+	addi	$5, $5, 1
+L.21:
+	lw	$13, 16($sp)
+	slt	$13, $5, $13
+	bnez	$13, L.18
+L.12:
+	sw	$6, 0($sp)
+	jal	free
+L.3:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	main
+main:
+	subui	$sp, $sp, 79
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	la	$7, _stdin
+	addu	$6, $0, $0
+	addui	$5, $0, 10
+	addu	$4, $0, $0
+	addui	$6, $0, 1
+	j	L.26
+L.23:
+	lw	$13, 80($sp)
+	addu	$13, $6, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	la	$13, L.29
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.27
+	addi	$13, $6, 1
+	lw	$12, 80($sp)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 78
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lw	$13, 78($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.30
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.33
+	sw	$13, 1($sp)
+	addi	$13, $6, 1
+	lw	$12, 80($sp)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.22
+L.30:
+	addi	$6, $6, 1
+	j	L.28
+L.27:
+	lw	$13, 80($sp)
+	addu	$13, $6, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	la	$13, L.36
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.34
+	addui	$4, $0, 1
+	j	L.35
+L.34:
+	lw	$13, 80($sp)
+	addu	$13, $6, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	la	$13, L.37
+	sw	$13, 1($sp)
+	jal	fopen
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.38
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	jal	strerror
+	addu	$13, $0, $1
+	lw	$12, _stderr+1($0)
+	sw	$12, 0($sp)
+	la	$12, L.41
+	sw	$12, 1($sp)
+	lw	$12, 80($sp)
+	lw	$12, 1($12)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.22
+L.38:
+L.35:
+L.28:
+L.24:
+	addi	$6, $6, 1
+L.26:
+	lw	$13, 79($sp)
+	slt	$13, $6, $13
+	bnez	$13, L.23
+	sw	$7, 0($sp)
+	sw	$5, 1($sp)
+	jal	print_last_n_lines
+	seq	$13, $4, $0
+	bnez	$13, L.42
+	addui	$13, $sp, 76
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	memset
+	lhi	$13, 0x773
+	ori	$13, $13, 0x5940
+	sw	$13, 77($sp)
+	j	L.46
+L.45:
+	addui	$13, $0, 47
+	sw	$13, 0($sp)
+	addui	$13, $sp, 76
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+	j	L.49
+L.48:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	addu	$13, $0, $3
+	sw	$13, 2($sp)
+	la	$13, _stdout
+	sw	$13, 3($sp)
+	jal	fwrite
+L.49:
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	addui	$13, $0, 64
+	sw	$13, 2($sp)
+	sw	$7, 3($sp)
+	jal	fread
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	addu	$3, $0, $13
+	sgt	$13, $13, $0
+	bnez	$13, L.48
+L.46:
+	j	L.45
+L.42:
+	addu	$1, $0, $0
+L.22:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 79
+	jr	$ra
+.extern	errlist 40
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.41:
+	.asciiz	"Error opening file %s, %s\n"
+L.37:
+	.asciiz	"r"
+L.36:
+	.asciiz	"-f"
+L.33:
+	.asciiz	"Invalid number of lines: %s\n"
+L.29:
+	.asciiz	"-n"
+L.17:
+	.asciiz	"%s"
@@ -0,0 +1,1807 @@
+.global	test_commands
+test_commands:
+	.word	test_so
+	.word	L.7
+	.word	0x1
+	.word	test_float
+	.word	L.8
+	.word	0x1
+	.word	test_coroutine
+	.word	L.9
+	.word	0x1
+	.word	test_sigsegv
+	.word	L.10
+	.word	0x1
+	.word	test_eintr
+	.word	L.11
+	.word	0x1
+	.word	test_timer
+	.word	L.12
+	.word	0x1
+	.word	test_times
+	.word	L.13
+	.word	0x1
+	.word	test_signal
+	.word	L.14
+	.word	0x1
+	.word	test_pipes
+	.word	L.15
+	.word	0x1
+	.word	test_while
+	.word	L.16
+	.word	0x0
+	.word	run_all
+	.word	L.17
+	.word	0x0
+	.word	test_nohandler
+	.word	0x0
+	.word	0x0
+	.word	0x0
+
+.word	0
+
+.word	0
+.global	main
+.text
+main:
+	subui	$sp, $sp, 9
+	sw	$7, 2($sp)
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 10($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.19
+	lw	$13, 9($sp)
+	subi	$13, $13, 1
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	addui	$13, $13, 1
+	sw	$13, 1($sp)
+	jal	test_nohandler
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.18
+L.19:
+	la	$7, test_commands
+	j	L.22
+L.21:
+	addui	$7, $7, 3
+L.22:
+	addu	$13, $0, $0
+	sw	$13, 8($sp)
+	addu	$12, $0, $7
+	sequ	$13, $12, $13
+	bnez	$13, L.25
+	lw	$13, 1($7)
+	sw	$13, 7($sp)
+	addu	$12, $0, $13
+	lw	$11, 8($sp)
+	sequ	$13, $12, $11
+	bnez	$13, L.25
+	lw	$13, 10($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.21
+L.25:
+	lw	$13, 9($sp)
+	subi	$13, $13, 1
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	addui	$13, $13, 1
+	sw	$13, 1($sp)
+	lw	$13, 0($7)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.18:
+	lw	$7, 2($sp)
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	test_nohandler
+test_nohandler:
+	subui	$sp, $sp, 6
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	la	$7, test_commands
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.27
+	sw	$13, 1($sp)
+	jal	dprintf
+	j	L.29
+L.28:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.31
+	sw	$13, 1($sp)
+	lw	$13, 1($7)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$7, $7, 3
+L.29:
+	lw	$13, 1($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.28
+	addu	$1, $0, $0
+L.26:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	run_all
+run_all:
+	subui	$sp, $sp, 12
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	la	$7, test_commands
+	sw	$0, 11($sp)
+	j	L.35
+L.34:
+	lw	$13, 2($7)
+	seq	$13, $13, $0
+	bnez	$13, L.37
+	addui	$13, $0, 1
+	lw	$12, 1($7)
+	sw	$12, 10($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 10
+	sw	$13, 1($sp)
+	lw	$13, 0($7)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.39
+	sw	$13, 1($sp)
+	lw	$13, 1($7)
+	sw	$13, 2($sp)
+	sw	$6, 3($sp)
+	jal	dprintf
+	sne	$13, $6, $0
+	bnez	$13, L.42
+	addui	$5, $0, 1
+	j	L.43
+L.42:
+	addu	$5, $0, $0
+L.43:
+	sw	$5, 0($sp)
+	addui	$13, $0, 106
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+L.37:
+	addui	$7, $7, 3
+L.35:
+	lw	$13, 1($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.34
+	addu	$1, $0, $0
+L.32:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	usr_handler
+usr_handler:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, sig_sum($0)
+	lw	$12, 5($sp)
+	add	$13, $13, $12
+	sw	$13, sig_sum($0)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.45
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 12
+	sw	$13, 0($sp)
+	jal	raise
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.46
+	sw	$13, 1($sp)
+	jal	dprintf
+L.44:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	usr2_handler
+usr2_handler:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, sig_sum($0)
+	lw	$12, 5($sp)
+	add	$13, $13, $12
+	sw	$13, sig_sum($0)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.48
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	jal	raise
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.49
+	sw	$13, 1($sp)
+	jal	dprintf
+L.47:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	int_handler
+int_handler:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, sig_sum($0)
+	lw	$12, 5($sp)
+	add	$13, $13, $12
+	sw	$13, sig_sum($0)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.51
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 15
+	sw	$13, 0($sp)
+	jal	raise
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.52
+	sw	$13, 1($sp)
+	jal	dprintf
+L.50:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	term_handler
+term_handler:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, sig_sum($0)
+	lw	$12, 5($sp)
+	add	$13, $13, $12
+	sw	$13, sig_sum($0)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.54
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.55
+	sw	$13, 1($sp)
+	jal	dprintf
+L.53:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	test_signal
+test_signal:
+	subui	$sp, $sp, 14
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, sig_sum($0)
+	addui	$13, $sp, 12
+	sw	$13, 0($sp)
+	jal	sigemptyset
+	sw	$0, 13($sp)
+	la	$13, usr_handler
+	sw	$13, 11($sp)
+	addui	$13, $0, 8
+	sw	$13, 0($sp)
+	addui	$13, $0, 10
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	la	$13, usr2_handler
+	sw	$13, 11($sp)
+	addui	$13, $0, 8
+	sw	$13, 0($sp)
+	addui	$13, $0, 12
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	la	$13, int_handler
+	sw	$13, 11($sp)
+	addui	$13, $0, 8
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	la	$13, term_handler
+	sw	$13, 11($sp)
+	addui	$13, $0, 8
+	sw	$13, 0($sp)
+	addui	$13, $0, 15
+	sw	$13, 1($sp)
+	addui	$13, $sp, 11
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $sp, 10
+	sw	$13, 0($sp)
+	jal	sigfillset
+	addui	$13, $0, 19
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	lw	$13, 10($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	jal	raise
+	lw	$13, sig_sum($0)
+	sne	$13, $13, $0
+	bnez	$13, L.60
+	addui	$7, $0, 1
+	j	L.61
+L.60:
+	addu	$7, $0, $0
+L.61:
+	sw	$7, 0($sp)
+	addui	$13, $0, 172
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 18
+	sw	$13, 0($sp)
+	addui	$13, $sp, 10
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $sp, 10
+	sw	$13, 0($sp)
+	addui	$13, $0, 10
+	sw	$13, 1($sp)
+	jal	sigismember
+	addu	$13, $0, $1
+	sw	$13, 0($sp)
+	addui	$13, $0, 176
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, sig_sum($0)
+	sne	$13, $13, $0
+	bnez	$13, L.63
+	addui	$6, $0, 1
+	j	L.64
+L.63:
+	addu	$6, $0, $0
+L.64:
+	sw	$6, 0($sp)
+	addui	$13, $0, 177
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.65
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 17
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	lw	$13, sig_sum($0)
+	snei	$13, $13, 39
+	bnez	$13, L.67
+	addui	$5, $0, 1
+	j	L.68
+L.67:
+	addu	$5, $0, $0
+L.68:
+	sw	$5, 0($sp)
+	addui	$13, $0, 182
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addu	$1, $0, $0
+L.56:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.global	test_float
+test_float:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addu	$7, $0, $0
+	sw	$0, 7($sp)
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x1
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 1
+	lw	$12, 7($sp)
+	div	$7, $13, $12
+	sw	$13, 0($sp)
+	la	$13, L.70
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	dprintf
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+	addu	$1, $0, $0
+L.69:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	stack_overflow
+stack_overflow:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	lw	$13, 3($sp)
+	sw	$13, 0($sp)
+	jal	stack_overflow
+L.71:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	do_fork
+do_fork:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	addui	$13, $0, 3
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.72:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	do_tfork
+do_tfork:
+	subui	$sp, $sp, 3
+	sw	$13, 1($sp)
+	sw	$ra, 2($sp)
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.73:
+	lw	$13, 1($sp)
+	lw	$ra, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.data
+L.75:
+	.word	do_fork
+	.word	do_tfork
+.global	test_so
+.text
+test_so:
+	subui	$sp, $sp, 16
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$8, 7($sp)
+	sw	$9, 8($sp)
+	sw	$10, 9($sp)
+	sw	$11, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	addui	$13, $sp, 14
+	la	$9, L.75
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	addu	$7, $0, $0
+	addu	$7, $0, $0
+L.76:
+	addui	$13, $sp, 14
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sne	$13, $6, $0
+	bnez	$13, L.80
+	addui	$13, $0, 13
+	sw	$13, 0($sp)
+	addui	$13, $0, 8
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.82
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	dprintf
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	jal	stack_overflow
+	j	L.81
+L.80:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	addui	$13, $sp, 13
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	lw	$13, 13($sp)
+	andi	$13, $13, 127
+	sw	$13, 0($sp)
+	addui	$13, $0, 223
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 13($sp)
+	andi	$13, $13, 127
+	snei	$13, $13, 11
+	bnez	$13, L.84
+	addui	$5, $0, 1
+	j	L.85
+L.84:
+	addu	$5, $0, $0
+L.85:
+	sw	$5, 0($sp)
+	addui	$13, $0, 224
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+L.81:
+L.77:
+	addi	$7, $7, 1
+	slti	$13, $7, 2
+	bnez	$13, L.76
+	addu	$1, $0, $0
+L.74:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$8, 7($sp)
+	lw	$9, 8($sp)
+	lw	$10, 9($sp)
+	lw	$11, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.global	sigsegv_handler
+sigsegv_handler:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.87
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.86:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	test_sigsegv
+test_sigsegv:
+	subui	$sp, $sp, 11
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x1
+	sw	$13, 10($sp)
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.89
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	la	$13, sigsegv_handler
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.91
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	j	L.90
+L.89:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	addui	$13, $sp, 9
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	lw	$13, 9($sp)
+	andi	$13, $13, 127
+	sne	$13, $13, $0
+	bnez	$13, L.93
+	addui	$7, $0, 1
+	j	L.94
+L.93:
+	addu	$7, $0, $0
+L.94:
+	sw	$7, 0($sp)
+	addui	$13, $0, 247
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 9($sp)
+	srai	$13, $13, 8
+	andi	$13, $13, 255
+	sne	$13, $13, $0
+	bnez	$13, L.96
+	addui	$6, $0, 1
+	j	L.97
+L.96:
+	addu	$6, $0, $0
+L.97:
+	sw	$6, 0($sp)
+	addui	$13, $0, 248
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+L.90:
+	addu	$1, $0, $0
+L.88:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	alarm_handler_called
+alarm_handler_called:
+	.word	0x0
+.global	alarm_handler
+.text
+alarm_handler:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.99
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 1
+	sw	$13, alarm_handler_called($0)
+L.98:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	test_eintr
+test_eintr:
+	subui	$sp, $sp, 29
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.101
+	sw	$0, 22($sp)
+	addui	$13, $0, 1000
+	sw	$13, 21($sp)
+	addui	$13, $sp, 23
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 4
+	sw	$13, 2($sp)
+	jal	memset
+	sw	$0, alarm_handler_called($0)
+	lw	$13, 29($sp)
+	slei	$13, $13, 1
+	bnez	$13, L.103
+	lw	$13, 30($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 27
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	sw	$13, 22($sp)
+	lw	$13, 27($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.105
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.108
+	sw	$13, 1($sp)
+	lw	$13, 30($sp)
+	lw	$13, 1($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.100
+L.105:
+L.103:
+	lw	$13, 22($sp)
+	sw	$13, 25($sp)
+	lw	$13, 21($sp)
+	sw	$13, 26($sp)
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	addui	$13, $0, 14
+	sw	$13, 1($sp)
+	la	$13, alarm_handler
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 55
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 23
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 10
+	sw	$13, 2($sp)
+	addui	$13, $0, 10
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 20($sp)
+	lw	$13, 20($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.113
+	addui	$7, $0, 1
+	j	L.114
+L.113:
+	addu	$7, $0, $0
+L.114:
+	sw	$7, 0($sp)
+	addui	$13, $0, 289
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	addui	$12, $0, 4
+	sneu	$13, $13, $12
+	bnez	$13, L.116
+	addui	$6, $0, 1
+	j	L.117
+L.116:
+	addu	$6, $0, $0
+L.117:
+	sw	$6, 0($sp)
+	addui	$13, $0, 290
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, alarm_handler_called($0)
+	snei	$13, $13, 1
+	bnez	$13, L.119
+	addui	$5, $0, 1
+	j	L.120
+L.119:
+	addu	$5, $0, $0
+L.120:
+	sw	$5, 0($sp)
+	addui	$13, $0, 291
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	j	L.102
+L.101:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	addui	$13, $sp, 28
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	lw	$13, 28($sp)
+	andi	$13, $13, 127
+	sne	$13, $13, $0
+	bnez	$13, L.122
+	addui	$7, $0, 1
+	j	L.123
+L.122:
+	addu	$7, $0, $0
+L.123:
+	sw	$7, 0($sp)
+	addui	$13, $0, 295
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 28($sp)
+	srai	$13, $13, 8
+	andi	$13, $13, 255
+	sne	$13, $13, $0
+	bnez	$13, L.125
+	addui	$6, $0, 1
+	j	L.126
+L.125:
+	addu	$6, $0, $0
+L.126:
+	sw	$6, 0($sp)
+	addui	$13, $0, 296
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+L.102:
+	addu	$1, $0, $0
+L.100:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 29
+	jr	$ra
+.global	test_timer
+test_timer:
+	subui	$sp, $sp, 21
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$8, 6($sp)
+	sw	$9, 7($sp)
+	sw	$10, 8($sp)
+	sw	$11, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addui	$13, $0, 5000
+	sw	$13, 13($sp)
+	addui	$13, $sp, 17
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 4
+	sw	$13, 2($sp)
+	jal	memset
+	addui	$13, $sp, 14
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 3
+	sw	$13, 2($sp)
+	jal	memset
+	sw	$0, alarm_handler_called($0)
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.128
+	lw	$13, 13($sp)
+	sw	$13, 20($sp)
+	addui	$13, $sp, 17
+	addui	$9, $sp, 19
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	la	$13, alarm_handler
+	sw	$13, 14($sp)
+	addui	$13, $0, 2
+	sw	$13, 16($sp)
+	addui	$13, $0, 8
+	sw	$13, 0($sp)
+	addui	$13, $0, 14
+	sw	$13, 1($sp)
+	addui	$13, $sp, 14
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 55
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $sp, 17
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+L.134:
+L.135:
+	j	L.134
+	j	L.129
+L.128:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	addui	$13, $sp, 12
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	lw	$13, alarm_handler_called($0)
+	snei	$13, $13, 1
+	bnez	$13, L.138
+	addui	$7, $0, 1
+	j	L.139
+L.138:
+	addu	$7, $0, $0
+L.139:
+	sw	$7, 0($sp)
+	addui	$13, $0, 322
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 12($sp)
+	andi	$13, $13, 127
+	sw	$13, 0($sp)
+	addui	$13, $0, 323
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 12($sp)
+	andi	$13, $13, 127
+	snei	$13, $13, 14
+	bnez	$13, L.141
+	addui	$6, $0, 1
+	j	L.142
+L.141:
+	addu	$6, $0, $0
+L.142:
+	sw	$6, 0($sp)
+	addui	$13, $0, 324
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+L.129:
+	addu	$1, $0, $0
+L.127:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$8, 6($sp)
+	lw	$9, 7($sp)
+	lw	$10, 8($sp)
+	lw	$11, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 21
+	jr	$ra
+.global	func
+func:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.144
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+	lw	$13, sum($0)
+	lw	$12, 6($sp)
+	add	$13, $13, $12
+	sw	$13, sum($0)
+L.143:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	test_coroutine
+test_coroutine:
+	subui	$sp, $sp, 17
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	addui	$3, $0, 2
+	addui	$2, $0, 1
+	sw	$0, 16($sp)
+	sw	$0, sum($0)
+	lw	$13, 17($sp)
+	slei	$13, $13, 1
+	bnez	$13, L.146
+	lw	$13, 18($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 14
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	addu	$3, $0, $13
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.148
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.108
+	sw	$13, 1($sp)
+	lw	$13, 18($sp)
+	lw	$13, 1($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.145
+L.148:
+L.146:
+	addui	$13, $0, 21
+	addu	$12, $0, $3
+	multu	$13, $13, $12
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	sw	$13, 15($sp)
+	lw	$13, 15($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.151
+	j	L.153
+L.151:
+	addui	$13, $0, 1
+	addu	$12, $0, $3
+	multu	$13, $13, $12
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	addu	$13, $0, $4
+	sneu	$13, $13, $0
+	bnez	$13, L.154
+	j	L.156
+L.154:
+	lw	$6, 15($sp)
+	addu	$7, $0, $0
+	j	L.160
+L.157:
+	addui	$13, $0, 56
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	addu	$12, $7, $4
+	sw	$13, 0($12)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.165
+	addu	$13, $7, $4
+	lw	$13, 0($13)
+	sw	$13, 16($6)
+	addui	$13, $0, 56
+	sw	$13, 18($6)
+	la	$13, mcontext
+	sw	$13, 20($6)
+	addu	$13, $0, $2
+	lw	$12, 16($sp)
+	add	$12, $12, $13
+	sw	$12, 16($sp)
+	sw	$6, 0($sp)
+	la	$12, func
+	sw	$12, 1($sp)
+	addui	$12, $0, 1
+	sw	$12, 2($sp)
+	addi	$2, $13, 1
+	sw	$13, 3($sp)
+	jal	makecontext
+	addui	$6, $6, 21
+	addu	$13, $0, $0
+	sw	$13, 13($sp)
+	seq	$13, $7, $13
+	bnez	$13, L.162
+	remi	$13, $7, 50
+	lw	$12, 13($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.162
+	addui	$13, $0, 33
+	sw	$13, 0($sp)
+	jal	putchar
+L.162:
+L.158:
+	addi	$7, $7, 1
+L.160:
+	slt	$13, $7, $3
+	bnez	$13, L.157
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	jal	putchar
+	lw	$6, 15($sp)
+	addu	$7, $0, $0
+	j	L.169
+L.166:
+	la	$13, mcontext
+	sw	$13, 0($sp)
+	addu	$13, $0, $6
+	addui	$6, $13, 21
+	sw	$13, 1($sp)
+	jal	swapcontext
+L.167:
+	addi	$7, $7, 1
+L.169:
+	slt	$13, $7, $3
+	bnez	$13, L.166
+	lw	$13, sum($0)
+	lw	$12, 16($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.171
+	addui	$13, $0, 1
+	sw	$13, 13($sp)
+	j	L.172
+L.171:
+	sw	$0, 13($sp)
+L.172:
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 395
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+L.165:
+	addu	$5, $0, $0
+	j	L.176
+L.173:
+	addu	$13, $5, $4
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	jal	free
+L.174:
+	addi	$5, $5, 1
+L.176:
+	slt	$13, $5, $7
+	bnez	$13, L.173
+	sw	$4, 0($sp)
+	jal	free
+L.156:
+	lw	$13, 15($sp)
+	sw	$13, 0($sp)
+	jal	free
+L.153:
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	addui	$12, $0, 12
+	sneu	$13, $13, $12
+	bnez	$13, L.177
+	la	$13, L.179
+	sw	$13, 0($sp)
+	jal	perror
+L.177:
+	addu	$1, $0, $0
+L.145:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 17
+	jr	$ra
+.global	test_while
+test_while:
+	subui	$sp, $sp, 7
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $sp, 5
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	memset
+	addui	$13, $0, 1
+	sw	$13, 5($sp)
+	j	L.182
+L.181:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.184
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 47
+	sw	$13, 0($sp)
+	addui	$13, $sp, 5
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.182:
+	j	L.181
+	addu	$1, $0, $0
+L.180:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	test_times
+test_times:
+	subui	$sp, $sp, 19
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	addui	$13, $sp, 15
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sequ	$13, $6, $0
+	bnez	$13, L.187
+	addui	$5, $0, 1
+	j	L.188
+L.187:
+	addu	$5, $0, $0
+L.188:
+	sw	$5, 0($sp)
+	addui	$13, $0, 427
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 15($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.190
+	addui	$4, $0, 1
+	j	L.191
+L.190:
+	addu	$4, $0, $0
+L.191:
+	sw	$4, 0($sp)
+	addui	$13, $0, 428
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 16($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.194
+	addui	$3, $0, 1
+	j	L.195
+L.194:
+	addu	$3, $0, $0
+L.195:
+	sw	$3, 0($sp)
+	addui	$13, $0, 429
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x1
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	addu	$13, $0, $13
+	sneu	$13, $7, $13
+	bnez	$13, L.197
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	addui	$12, $0, 14
+	sneu	$13, $13, $12
+	bnez	$13, L.197
+	addui	$2, $0, 1
+	j	L.198
+L.197:
+	addu	$2, $0, $0
+L.198:
+	sw	$2, 0($sp)
+	addui	$13, $0, 431
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $sp, 13
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	jal	memset
+	lhi	$13, 0x5f5
+	ori	$13, $13, 0xe100
+	sw	$13, 14($sp)
+	addui	$13, $0, 47
+	sw	$13, 0($sp)
+	addui	$13, $sp, 13
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sequ	$13, $7, $0
+	bnez	$13, L.201
+	sleu	$13, $7, $6
+	bnez	$13, L.201
+	addui	$13, $0, 1
+	sw	$13, 12($sp)
+	j	L.202
+L.201:
+	sw	$0, 12($sp)
+L.202:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 437
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addu	$1, $0, $0
+L.185:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 19
+	jr	$ra
+.data
+L.204:
+	.word	L.205
+	.word	L.206
+	.word	L.207
+	.word	0x0
+.global	test_pipes
+.text
+test_pipes:
+	subui	$sp, $sp, 124
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$8, 9($sp)
+	sw	$9, 10($sp)
+	sw	$10, 11($sp)
+	sw	$11, 12($sp)
+	sw	$12, 13($sp)
+	sw	$13, 14($sp)
+	sw	$ra, 15($sp)
+	addui	$13, $sp, 16
+	la	$9, L.204
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	addui	$13, $0, 27
+	sw	$13, 0($sp)
+	addui	$13, $sp, 122
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.209
+	addui	$7, $0, 1
+	j	L.210
+L.209:
+	addu	$7, $0, $0
+L.210:
+	sw	$7, 0($sp)
+	addui	$13, $0, 446
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 53
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.211
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 122($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 35
+	sw	$13, 0($sp)
+	lw	$13, 123($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 123($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	jal	get_environ
+	addu	$13, $0, $1
+	addui	$12, $0, 5
+	sw	$12, 0($sp)
+	la	$12, L.205
+	sw	$12, 1($sp)
+	addui	$12, $sp, 16
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.211:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sw	$13, 1($sp)
+	addui	$13, $sp, 121
+	sw	$13, 2($sp)
+	sw	$0, 3($sp)
+	jal	wramp_syscall
+	lw	$13, 121($sp)
+	andi	$13, $13, 127
+	sne	$13, $13, $0
+	bnez	$13, L.216
+	addui	$6, $0, 1
+	j	L.217
+L.216:
+	addu	$6, $0, $0
+L.217:
+	sw	$6, 0($sp)
+	addui	$13, $0, 456
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	lw	$13, 121($sp)
+	srai	$13, $13, 8
+	andi	$13, $13, 255
+	sne	$13, $13, $0
+	bnez	$13, L.219
+	addui	$5, $0, 1
+	j	L.220
+L.219:
+	addu	$5, $0, $0
+L.220:
+	sw	$5, 0($sp)
+	addui	$13, $0, 457
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $sp, 21
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 100
+	sw	$13, 2($sp)
+	jal	memset
+	addui	$13, $0, 23
+	sw	$13, 0($sp)
+	lw	$13, 122($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 21
+	sw	$13, 2($sp)
+	addui	$13, $0, 100
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 20($sp)
+	lw	$13, 20($sp)
+	snei	$13, $13, 4
+	bnez	$13, L.222
+	addui	$4, $0, 1
+	j	L.223
+L.222:
+	addu	$4, $0, $0
+L.223:
+	sw	$4, 0($sp)
+	addui	$13, $0, 461
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $sp, 21
+	sw	$13, 0($sp)
+	la	$13, L.224
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.226
+	addui	$3, $0, 1
+	j	L.227
+L.226:
+	addu	$3, $0, $0
+L.227:
+	sw	$3, 0($sp)
+	addui	$13, $0, 462
+	sw	$13, 1($sp)
+	la	$13, L.41
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 122($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 123($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$1, $0, $0
+L.203:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$8, 9($sp)
+	lw	$9, 10($sp)
+	lw	$10, 11($sp)
+	lw	$11, 12($sp)
+	lw	$12, 13($sp)
+	lw	$13, 14($sp)
+	lw	$ra, 15($sp)
+	addui	$sp, $sp, 124
+	jr	$ra
+.bss
+.global	sum
+sum:
+	.space	1
+.global	mcontext
+mcontext:
+	.space	21
+.global	sig_sum
+sig_sum:
+	.space	1
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.224:
+	.asciiz	"def\n"
+L.207:
+	.asciiz	"echo abc\\ndef\\nghn | tail -n 2 | grep def"
+L.206:
+	.asciiz	"-c"
+L.205:
+	.asciiz	"/bin/wsh"
+L.184:
+	.asciiz	"a"
+L.179:
+	.asciiz	"malloc"
+L.144:
+	.asciiz	"Hello World! I'm coroutine %d\n"
+L.108:
+	.asciiz	"Invalid number: %s\n"
+L.99:
+	.asciiz	"alarm handler triggered\n"
+L.91:
+	.asciiz	"%s"
+L.87:
+	.asciiz	"sigsegv handler invoked %d\n"
+L.82:
+	.asciiz	"Generating stack overflow for %d ....\n"
+L.70:
+	.asciiz	"dividing foo %d by 0\n"
+L.65:
+	.asciiz	"signal handler usr1 should be called after this\n"
+L.55:
+	.asciiz	"SIGTERM end\n"
+L.54:
+	.asciiz	"SIGTERM start\n"
+L.52:
+	.asciiz	"SIGINT end\n"
+L.51:
+	.asciiz	"SIGINT start\n"
+L.49:
+	.asciiz	"SIGUR2 end\n"
+L.48:
+	.asciiz	"SIGUR2 start\n"
+L.46:
+	.asciiz	"SIGUR1 end\n"
+L.45:
+	.asciiz	"SIGUR1 start\n"
+L.41:
+	.asciiz	"user/commands/test.c"
+L.39:
+	.asciiz	"%s return %d\n---\n\n"
+L.31:
+	.asciiz	" * %s\n"
+L.27:
+	.asciiz	"Available Test Options\n"
+L.17:
+	.asciiz	"run"
+L.16:
+	.asciiz	"while"
+L.15:
+	.asciiz	"pipe"
+L.14:
+	.asciiz	"signal"
+L.13:
+	.asciiz	"times"
+L.12:
+	.asciiz	"timer"
+L.11:
+	.asciiz	"eintr"
+L.10:
+	.asciiz	"null"
+L.9:
+	.asciiz	"coroutine"
+L.8:
+	.asciiz	"float"
+L.7:
+	.asciiz	"stack"
@@ -0,0 +1,47 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 7
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.2
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.1
+L.2:
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 258
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	sw	$13, 2($sp)
+	addui	$13, $0, 493
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$1, $0, $0
+L.1:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.5:
+	.asciiz	"mising file operand\n"
@@ -0,0 +1,90 @@
+.global	main
+.text
+main:
+	subui	$sp, $sp, 21
+	sw	$3, 7($sp)
+	sw	$4, 8($sp)
+	sw	$5, 9($sp)
+	sw	$6, 10($sp)
+	sw	$7, 11($sp)
+	sw	$11, 12($sp)
+	sw	$12, 13($sp)
+	sw	$13, 14($sp)
+	sw	$ra, 15($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	addui	$13, $sp, 17
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$3, $0, $13
+	addui	$13, $0, 16
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	div	$4, $3, $7
+	addui	$13, $0, 60
+	div	$5, $4, $13
+	div	$6, $5, $13
+	addui	$12, $0, 24
+	div	$11, $6, $12
+	sw	$11, 16($sp)
+	rem	$4, $4, $13
+	rem	$5, $5, $13
+	rem	$6, $6, $12
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.4
+	sw	$13, 1($sp)
+	lw	$13, 16($sp)
+	sw	$13, 2($sp)
+	sw	$6, 3($sp)
+	sw	$5, 4($sp)
+	sw	$4, 5($sp)
+	rem	$13, $3, $7
+	sw	$13, 6($sp)
+	jal	dprintf
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.5
+	sw	$13, 1($sp)
+	lw	$13, 17($sp)
+	addu	$12, $0, $7
+	divu	$11, $13, $12
+	sw	$11, 2($sp)
+	remu	$13, $13, $12
+	sw	$13, 3($sp)
+	lw	$13, 18($sp)
+	divu	$13, $13, $12
+	sw	$13, 4($sp)
+	lw	$13, 18($sp)
+	remu	$13, $13, $12
+	sw	$13, 5($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.3:
+	lw	$3, 7($sp)
+	lw	$4, 8($sp)
+	lw	$5, 9($sp)
+	lw	$6, 10($sp)
+	lw	$7, 11($sp)
+	lw	$11, 12($sp)
+	lw	$12, 13($sp)
+	lw	$13, 14($sp)
+	lw	$ra, 15($sp)
+	addui	$sp, $sp, 21
+	jr	$ra
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.5:
+	.asciiz	"user time %d.%d seconds, system time %d.%02d seconds\n"
+L.4:
+	.asciiz	"Uptime is %dd %dh %dm %d.%02ds\n"
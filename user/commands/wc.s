@@ -0,0 +1,423 @@
+.global	lflag
+lflag:
+	.word	0x0
+.global	wflag
+wflag:
+	.word	0x0
+.global	cflag
+cflag:
+	.word	0x0
+.global	count
+.text
+count:
+	subui	$sp, $sp, 6
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addu	$6, $0, $0
+	addu	$13, $0, $0
+	sw	$13, lcount($0)
+	sw	$13, wcount($0)
+	sw	$13, ccount($0)
+	j	L.5
+L.4:
+	lw	$13, ccount($0)
+	addi	$13, $13, 1
+	sw	$13, ccount($0)
+	seqi	$13, $7, 32
+	bnez	$13, L.10
+	seqi	$13, $7, 9
+	bnez	$13, L.10
+	snei	$13, $7, 10
+	bnez	$13, L.7
+L.10:
+	seq	$13, $6, $0
+	bnez	$13, L.11
+	lw	$13, wcount($0)
+	addi	$13, $13, 1
+	sw	$13, wcount($0)
+L.11:
+	addu	$6, $0, $0
+	j	L.8
+L.7:
+	addui	$6, $0, 1
+L.8:
+	seqi	$13, $7, 10
+	bnez	$13, L.15
+	snei	$13, $7, 12
+	bnez	$13, L.13
+L.15:
+	lw	$13, lcount($0)
+	addi	$13, $13, 1
+	sw	$13, lcount($0)
+L.13:
+L.5:
+	la	$13, _stdin
+	sw	$13, 0($sp)
+	jal	fgetc
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sgt	$13, $13, $0
+	bnez	$13, L.4
+	lw	$13, ltotal($0)
+	lw	$12, lcount($0)
+	add	$13, $13, $12
+	sw	$13, ltotal($0)
+	lw	$13, wtotal($0)
+	lw	$12, wcount($0)
+	add	$13, $13, $12
+	sw	$13, wtotal($0)
+	lw	$13, ctotal($0)
+	lw	$12, ccount($0)
+	add	$13, $13, $12
+	sw	$13, ctotal($0)
+L.3:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	usage
+usage:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.18
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+L.16:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	main
+main:
+	subui	$sp, $sp, 14
+	sw	$4, 3($sp)
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addui	$13, $0, 1
+	lw	$12, 14($sp)
+	subi	$12, $12, 1
+	sw	$12, 13($sp)
+	addu	$7, $0, $13
+	lw	$13, 15($sp)
+	lw	$6, 1($13)
+	addu	$13, $0, $6
+	sw	$13, 11($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.20
+	lw	$13, 11($sp)
+	addui	$6, $13, 1
+	lw	$13, 11($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 45
+	bnez	$13, L.20
+	lw	$13, 13($sp)
+	subi	$13, $13, 1
+	sw	$13, 13($sp)
+	addi	$7, $7, 1
+	j	L.23
+L.22:
+	lw	$4, 0($6)
+	addui	$13, $0, 108
+	sw	$13, 10($sp)
+	seq	$13, $4, $13
+	bnez	$13, L.28
+	lw	$13, 10($sp)
+	sgt	$13, $4, $13
+	bnez	$13, L.32
+L.31:
+	seqi	$13, $4, 99
+	bnez	$13, L.30
+	j	L.25
+L.32:
+	seqi	$13, $4, 119
+	bnez	$13, L.29
+	j	L.25
+L.28:
+	lw	$13, lflag($0)
+	addi	$13, $13, 1
+	sw	$13, lflag($0)
+	j	L.26
+L.29:
+	lw	$13, wflag($0)
+	addi	$13, $13, 1
+	sw	$13, wflag($0)
+	j	L.26
+L.30:
+	lw	$13, cflag($0)
+	addi	$13, $13, 1
+	sw	$13, cflag($0)
+	j	L.26
+L.25:
+	jal	usage
+L.26:
+	addui	$6, $6, 1
+L.23:
+	lw	$13, 0($6)
+	sne	$13, $13, $0
+	bnez	$13, L.22
+L.20:
+	addu	$13, $0, $0
+	sw	$13, 10($sp)
+	lw	$12, lflag($0)
+	sne	$13, $12, $13
+	bnez	$13, L.33
+	lw	$13, wflag($0)
+	lw	$12, 10($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.33
+	lw	$13, cflag($0)
+	lw	$12, 10($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.33
+	addui	$13, $0, 1
+	sw	$13, lflag($0)
+	sw	$13, wflag($0)
+	sw	$13, cflag($0)
+L.33:
+	lw	$13, 13($sp)
+	slti	$13, $13, 2
+	bnez	$13, L.36
+	addui	$4, $0, 1
+	j	L.37
+L.36:
+	addu	$4, $0, $0
+L.37:
+	sw	$4, 12($sp)
+	lw	$13, 14($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.49
+	jal	count
+	lw	$13, lflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.40
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, lcount($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.40:
+	lw	$13, wflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.43
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, wcount($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.43:
+	lw	$13, cflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.45
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, ccount($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.45:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.47
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	j	L.49
+L.48:
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 15($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.51
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.54
+	sw	$13, 1($sp)
+	lw	$13, 15($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addi	$7, $7, 1
+	j	L.49
+L.51:
+	jal	count
+	lw	$13, lflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.55
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, lcount($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.55:
+	lw	$13, wflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.57
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, wcount($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.57:
+	lw	$13, cflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.59
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, ccount($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.59:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.61
+	sw	$13, 1($sp)
+	lw	$13, 15($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addi	$7, $7, 1
+L.49:
+	lw	$13, 14($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.48
+	lw	$13, 12($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.62
+	lw	$13, lflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.64
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, ltotal($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.64:
+	lw	$13, wflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.66
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, wtotal($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.66:
+	lw	$13, cflag($0)
+	seq	$13, $13, $0
+	bnez	$13, L.68
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.42
+	sw	$13, 1($sp)
+	lw	$13, ctotal($0)
+	sw	$13, 2($sp)
+	jal	dprintf
+L.68:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.70
+	sw	$13, 1($sp)
+	jal	dprintf
+L.62:
+	addu	$1, $0, $0
+L.19:
+	lw	$4, 3($sp)
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.bss
+.global	ctotal
+ctotal:
+	.space	1
+.global	wtotal
+wtotal:
+	.space	1
+.global	ltotal
+ltotal:
+	.space	1
+.global	ccount
+ccount:
+	.space	1
+.global	wcount
+wcount:
+	.space	1
+.global	lcount
+lcount:
+	.space	1
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.70:
+	.asciiz	" total\n"
+L.61:
+	.asciiz	" %s\n"
+L.54:
+	.asciiz	"wc: cannot open %s\n"
+L.47:
+	.asciiz	" \n"
+L.42:
+	.asciiz	" %6d"
+L.18:
+	.asciiz	"Usage: wc [-lwc] [name ...]\n"
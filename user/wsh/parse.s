@@ -0,0 +1,541 @@
+.global	parse
+.text
+parse:
+	subui	$sp, $sp, 20
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	addu	$6, $0, $0
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	lw	$13, 20($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 100
+	sw	$13, 2($sp)
+	jal	strlcpy
+	lw	$13, 21($sp)
+	addu	$7, $0, $13
+	addu	$12, $0, $0
+	sw	$12, 118($13)
+	sw	$12, 150($13)
+	sw	$12, 149($13)
+	lw	$13, 21($sp)
+	addu	$12, $0, $0
+	sw	$12, 152($13)
+	sw	$12, 100($13)
+	sw	$12, 151($13)
+	lw	$13, 21($sp)
+	sw	$0, 101($13)
+	lw	$13, 21($sp)
+	addu	$12, $0, $0
+	sw	$12, 154($13)
+	sw	$12, 153($13)
+	j	L.5
+L.7:
+	addui	$7, $7, 1
+L.8:
+	lw	$13, 0($7)
+	sw	$13, 19($sp)
+	subi	$12, $13, 9
+	slti	$13, $12, 5
+	bnez	$13, L.13
+	lw	$13, 19($sp)
+	snei	$13, $13, 32
+	bnez	$13, L.11
+L.13:
+	addui	$5, $0, 1
+	j	L.12
+L.11:
+	addu	$5, $0, $0
+L.12:
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.7
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.14
+	j	L.6
+L.14:
+	lw	$4, 0($7)
+	addui	$13, $0, 92
+	sw	$13, 18($sp)
+	seq	$13, $4, $13
+	bnez	$13, L.39
+	lw	$13, 18($sp)
+	sgt	$13, $4, $13
+	bnez	$13, L.53
+L.52:
+	addui	$13, $0, 34
+	sw	$13, 17($sp)
+	seq	$13, $4, $13
+	bnez	$13, L.44
+	seqi	$13, $4, 38
+	bnez	$13, L.38
+	seqi	$13, $4, 39
+	bnez	$13, L.40
+	lw	$13, 17($sp)
+	slt	$13, $4, $13
+	bnez	$13, L.16
+L.54:
+	seqi	$13, $4, 60
+	bnez	$13, L.20
+	seqi	$13, $4, 62
+	bnez	$13, L.28
+	j	L.16
+L.53:
+	addui	$13, $0, 96
+	sw	$13, 16($sp)
+	seq	$13, $4, $13
+	bnez	$13, L.48
+	lw	$13, 16($sp)
+	slt	$13, $4, $13
+	bnez	$13, L.16
+L.55:
+	seqi	$13, $4, 124
+	bnez	$13, L.19
+	j	L.16
+L.19:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	lw	$12, 21($sp)
+	addui	$12, $12, 118
+	addu	$13, $13, $12
+	sw	$0, 0($13)
+	lw	$13, 21($sp)
+	addui	$13, $13, 100
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 21($sp)
+	addui	$13, $13, 101
+	addu	$13, $12, $13
+	sw	$6, 0($13)
+	j	L.5
+L.20:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+	j	L.22
+L.21:
+	addui	$7, $7, 1
+L.22:
+	lw	$13, 0($7)
+	sw	$13, 15($sp)
+	subi	$12, $13, 9
+	slti	$13, $12, 5
+	bnez	$13, L.27
+	lw	$13, 15($sp)
+	snei	$13, $13, 32
+	bnez	$13, L.25
+L.27:
+	addui	$3, $0, 1
+	j	L.26
+L.25:
+	addu	$3, $0, $0
+L.26:
+	addu	$13, $0, $3
+	sneu	$13, $13, $0
+	bnez	$13, L.21
+	lw	$13, 21($sp)
+	sw	$7, 149($13)
+	j	L.57
+L.28:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+	lw	$13, 0($7)
+	snei	$13, $13, 62
+	bnez	$13, L.32
+	lw	$13, 21($sp)
+	addui	$12, $0, 1
+	sw	$12, 151($13)
+	addui	$7, $7, 1
+	j	L.32
+L.31:
+	addui	$7, $7, 1
+L.32:
+	lw	$13, 0($7)
+	sw	$13, 14($sp)
+	subi	$12, $13, 9
+	slti	$13, $12, 5
+	bnez	$13, L.37
+	lw	$13, 14($sp)
+	snei	$13, $13, 32
+	bnez	$13, L.35
+L.37:
+	addui	$2, $0, 1
+	j	L.36
+L.35:
+	addu	$2, $0, $0
+L.36:
+	addu	$13, $0, $2
+	sneu	$13, $13, $0
+	bnez	$13, L.31
+	lw	$13, 21($sp)
+	sw	$7, 150($13)
+	j	L.57
+L.38:
+	lw	$13, 21($sp)
+	addui	$12, $0, 1
+	sw	$12, 152($13)
+	j	L.57
+L.39:
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	addui	$12, $7, 1
+	addu	$7, $0, $12
+	lw	$11, 21($sp)
+	addui	$11, $11, 118
+	addu	$13, $13, $11
+	sw	$12, 0($13)
+	addui	$7, $7, 1
+	j	L.57
+L.40:
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	addui	$12, $7, 1
+	addu	$7, $0, $12
+	lw	$11, 21($sp)
+	addui	$11, $11, 118
+	addu	$13, $13, $11
+	sw	$12, 0($13)
+	j	L.42
+L.41:
+	addui	$7, $7, 1
+L.42:
+	lw	$13, 0($7)
+	snei	$13, $13, 39
+	bnez	$13, L.41
+	sw	$0, 0($7)
+	j	L.57
+L.44:
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	addu	$12, $0, $7
+	addui	$7, $12, 1
+	lw	$11, 21($sp)
+	addui	$11, $11, 118
+	addu	$13, $13, $11
+	sw	$12, 0($13)
+	j	L.46
+L.45:
+	addui	$7, $7, 1
+L.46:
+	lw	$13, 0($7)
+	snei	$13, $13, 34
+	bnez	$13, L.45
+	addui	$13, $7, 1
+	addu	$7, $0, $13
+	sw	$0, 0($13)
+	addui	$7, $7, 1
+	j	L.5
+L.48:
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	addu	$12, $0, $7
+	addui	$7, $12, 1
+	lw	$11, 21($sp)
+	addui	$11, $11, 118
+	addu	$13, $13, $11
+	sw	$12, 0($13)
+	j	L.50
+L.49:
+	addui	$7, $7, 1
+L.50:
+	lw	$13, 0($7)
+	snei	$13, $13, 96
+	bnez	$13, L.49
+	addui	$13, $7, 1
+	addu	$7, $0, $13
+	sw	$0, 0($13)
+	addui	$7, $7, 1
+	j	L.5
+L.16:
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	lw	$12, 21($sp)
+	addui	$12, $12, 118
+	addu	$13, $13, $12
+	sw	$7, 0($13)
+	j	L.57
+L.56:
+	addui	$7, $7, 1
+L.57:
+	lw	$13, 0($7)
+	sw	$13, 15($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.70
+	lw	$13, 15($sp)
+	subi	$13, $13, 9
+	slti	$13, $13, 5
+	bnez	$13, L.64
+	lw	$13, 15($sp)
+	snei	$13, $13, 32
+	bnez	$13, L.62
+L.64:
+	addui	$3, $0, 1
+	j	L.63
+L.62:
+	addu	$3, $0, $0
+L.63:
+	addu	$13, $0, $3
+	sneu	$13, $13, $0
+	bnez	$13, L.70
+	lw	$13, 0($7)
+	sw	$13, 14($sp)
+	seqi	$13, $13, 124
+	bnez	$13, L.70
+	lw	$13, 14($sp)
+	seqi	$13, $13, 60
+	bnez	$13, L.70
+	lw	$13, 14($sp)
+	seqi	$13, $13, 62
+	bnez	$13, L.70
+	lw	$13, 14($sp)
+	seqi	$13, $13, 39
+	bnez	$13, L.70
+	lw	$13, 14($sp)
+	seqi	$13, $13, 61
+	bnez	$13, L.70
+	lw	$13, 14($sp)
+	seqi	$13, $13, 34
+	bnez	$13, L.70
+	lw	$13, 14($sp)
+	snei	$13, $13, 96
+	bnez	$13, L.56
+L.70:
+	lw	$13, 0($7)
+	snei	$13, $13, 61
+	bnez	$13, L.71
+	addu	$2, $0, $0
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+	lw	$13, 21($sp)
+	subi	$12, $6, 1
+	addui	$11, $13, 118
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	sw	$12, 153($13)
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	lw	$12, 21($sp)
+	addui	$12, $12, 118
+	addu	$13, $13, $12
+	sw	$7, 0($13)
+	lw	$13, 21($sp)
+	subi	$12, $6, 1
+	addui	$11, $13, 118
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	sw	$12, 154($13)
+	lw	$13, 0($7)
+	snei	$13, $13, 34
+	bnez	$13, L.73
+	lw	$2, 0($7)
+L.73:
+	lw	$13, 0($7)
+	snei	$13, $13, 39
+	bnez	$13, L.75
+	lw	$2, 0($7)
+L.75:
+	addui	$7, $7, 1
+	j	L.78
+L.77:
+	addui	$7, $7, 1
+L.78:
+	lw	$13, 0($7)
+	sw	$13, 13($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.80
+	lw	$13, 13($sp)
+	sne	$13, $13, $2
+	bnez	$13, L.77
+L.80:
+	addui	$7, $7, 1
+L.71:
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.81
+	j	L.6
+L.81:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	sw	$0, 0($13)
+L.5:
+	sgei	$13, $6, 29
+	bnez	$13, L.83
+	lw	$13, 21($sp)
+	lw	$13, 100($13)
+	slti	$13, $13, 8
+	bnez	$13, L.8
+L.83:
+L.6:
+	lw	$13, 21($sp)
+	addui	$13, $13, 118
+	addu	$13, $6, $13
+	sw	$0, 0($13)
+	lw	$13, 21($sp)
+	addui	$13, $13, 119
+	addu	$13, $6, $13
+	sw	$0, 0($13)
+	sle	$13, $6, $0
+	bnez	$13, L.84
+	lw	$13, 21($sp)
+	addui	$13, $13, 100
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.84:
+	sne	$13, $6, $0
+	bnez	$13, L.86
+	lw	$13, 21($sp)
+	sw	$13, 118($13)
+	lw	$13, 21($sp)
+	lw	$13, 118($13)
+	sw	$0, 0($13)
+L.86:
+	lw	$13, 21($sp)
+	sw	$6, 117($13)
+	addu	$1, $0, $0
+L.3:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 20
+	jr	$ra
+.global	parse_quotes
+parse_quotes:
+	subui	$sp, $sp, 14
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$7, 14($sp)
+	lw	$6, 15($sp)
+	lw	$13, 0($7)
+	snei	$13, $13, 34
+	bnez	$13, L.89
+	addui	$7, $7, 1
+	j	L.94
+L.89:
+	lw	$13, 0($7)
+	snei	$13, $13, 39
+	bnez	$13, L.94
+	addui	$7, $7, 1
+	j	L.94
+L.93:
+	lw	$13, 0($7)
+	sw	$13, 13($sp)
+	seqi	$13, $13, 34
+	bnez	$13, L.98
+	lw	$13, 13($sp)
+	snei	$13, $13, 39
+	bnez	$13, L.96
+L.98:
+	sw	$0, 0($7)
+L.96:
+	lw	$13, 0($7)
+	snei	$13, $13, 36
+	bnez	$13, L.99
+	addui	$13, $7, 1
+	addu	$7, $0, $13
+	addu	$3, $0, $13
+	j	L.102
+L.101:
+	addui	$7, $7, 1
+L.102:
+	lw	$13, 0($7)
+	sw	$13, 12($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.104
+	addui	$13, $0, 26
+	sw	$13, 11($sp)
+	lw	$12, 12($sp)
+	subi	$12, $12, 65
+	addu	$12, $0, $12
+	sltu	$13, $12, $13
+	bnez	$13, L.101
+	lw	$13, 12($sp)
+	subi	$13, $13, 97
+	addu	$13, $0, $13
+	lw	$12, 11($sp)
+	sltu	$13, $13, $12
+	bnez	$13, L.101
+L.104:
+	lw	$4, 0($7)
+	sw	$0, 0($7)
+	sw	$3, 0($sp)
+	jal	getenv
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.105
+	sw	$4, 0($7)
+	j	L.94
+L.105:
+	sw	$0, 0($6)
+	sw	$6, 0($sp)
+	sw	$5, 1($sp)
+	lw	$13, 16($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	strlcat
+	sw	$5, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$6, $13, $6
+	sw	$4, 0($7)
+	j	L.100
+L.99:
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	addu	$12, $0, $7
+	addui	$7, $12, 1
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.100:
+L.94:
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.93
+	sw	$0, 0($6)
+	addu	$1, $0, $0
+L.88:
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.extern	_environ 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
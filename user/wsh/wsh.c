@@ -78,13 +78,6 @@ void init_shell_sysenv(){
 #endif
 }
 
-void restore_shell_sysenv(){
-#ifdef __wramp__
-    signal(SIGINT, SIG_DFL);
-    signal(SIGTSTP, SIG_DFL);
-#endif
-}
-
 int append_line_to_history_file (char *filename, char *line){
     int ret;
     int fd = open(filename, O_WRONLY | O_CREAT | O_APPEND, 0666);
@@ -156,77 +149,79 @@ int search_path(char* path, int len, char* name){
 #define BUFFER_LEN  (30)
 
 pid_t run_cmd(struct cmdLine *cmd, int i, int *pipe_ptr, int *prev_pipe_ptr){
-    int sout;
+    int oflag, ret;
     pid_t pid;
     int cmd_start = cmd->cmdStart[i];
     char buffer[BUFFER_LEN];
+    posix_spawn_file_actions_t actions;
+    posix_spawnattr_t attr;
+    sigset_t sigdefault;
+    short flags = POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGDEF;
 
     if(search_path(buffer, BUFFER_LEN, cmd->argv[cmd_start])){
         fprintf(stderr, "Unknown command '%s'\n", cmd->argv[cmd_start]);
         return -1;
     }
 
-    pid = tfork();
-    if (pid == -1){
-        perror("fork");
-        return -1;
-    }
+    posix_spawn_file_actions_init(&actions);
 
-    if(pid == 0){ // child, actual command
+    // if redirecting input and first command
+    if (i == 0 && cmd->infile) { 
+        posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, cmd->infile, O_RDONLY, 0);
+    }
+    
+    // if redirecting output and last command
+    if(i == cmd->numCommands - 1 && cmd->outfile){ 
+        oflag = O_WRONLY | O_CREAT;
+        if(cmd->append) //if append
+            oflag |= O_APPEND;
+        else //else replace the original document
+            oflag |= O_TRUNC;
+        posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, cmd->outfile, oflag, 0664);
+    }
 
-        // if redirecting input and first command
-        if (i == 0 && cmd->infile) { 
-            int sin = open(cmd->infile, O_RDONLY);
-            dup2(sin,STDIN_FILENO);
-            close(sin);
-        }
-        
-        // if redirecting output and last command
-        if(i == cmd->numCommands - 1 && cmd->outfile){ 
-            int mode = O_WRONLY | O_CREAT;
-            if(cmd->append) //if append
-                mode |= O_APPEND;
-            else //else replace the original document
-                mode |= O_TRUNC;
-            sout = open(cmd->outfile, mode, 0664);
-            dup2(sout,STDOUT_FILENO);
-            close(sout);
+    if(cmd->numCommands > 1){
+        if((i+1) < cmd->numCommands ){ // not the last command
+            posix_spawn_file_actions_adddup2(&actions, pipe_ptr[PIPE_WRITE], STDOUT_FILENO);
+            posix_spawn_file_actions_addclose(&actions, pipe_ptr[PIPE_WRITE]);
+            posix_spawn_file_actions_addclose(&actions, pipe_ptr[PIPE_READ]);
         }
 
-        restore_shell_sysenv();
-        if (termios_inited)
-            tcsetattr(STDIN_FILENO, TCSANOW, &termios);
-
-        if (last_pgid){
-            setpgid(0, last_pgid);
-        }else{
-            setpgid(0, 0);
-            last_pgid = getpgid(0);
-            tcsetpgrp(STDIN_FILENO, last_pgid);
+        if(i > 0){ // not the first command, read previous pipe
+            posix_spawn_file_actions_adddup2(&actions, prev_pipe_ptr[PIPE_READ], STDIN_FILENO);
+            posix_spawn_file_actions_addclose(&actions, prev_pipe_ptr[PIPE_READ]);
+            posix_spawn_file_actions_addclose(&actions, prev_pipe_ptr[PIPE_WRITE]);
         }
+    }
 
-    
-        if(cmd->numCommands > 1){
-            if((i+1) < cmd->numCommands ){ // not the last command
-                dup2(pipe_ptr[PIPE_WRITE], STDOUT_FILENO);
-                close(pipe_ptr[PIPE_WRITE]);
-                close(pipe_ptr[PIPE_READ]);
-                // printf("cmd %d %s pipe  %d %d\n", i, buffer, pipe_ptr[PIPE_READ], pipe_ptr[PIPE_WRITE]);
-            }
-            // printf("cmd %d %s com %d, res %d\n", i, buffer,  cmd->numCommands, (i+1) < cmd->numCommands);
+    // the command gets the default handlers the shell ignores,
+    // and the first command of the pipeline leads a new foreground group
+    posix_spawnattr_init(&attr);
+    sigemptyset(&sigdefault);
+    sigaddset(&sigdefault, SIGINT);
+    sigaddset(&sigdefault, SIGTSTP);
+    posix_spawnattr_setsigdefault(&attr, &sigdefault);
+    posix_spawnattr_setpgroup(&attr, last_pgid);
+    if (!last_pgid){
+        posix_spawnattr_tcsetpgrp_np(&attr, STDIN_FILENO);
+        flags |= POSIX_SPAWN_TCSETPGROUP;
+    }
+    posix_spawnattr_setflags(&attr, flags);
 
-            if(i > 0){ // not the first command, read previous pipe
-                dup2(prev_pipe_ptr[PIPE_READ], STDIN_FILENO);
-                close(prev_pipe_ptr[PIPE_READ]);
-                close(prev_pipe_ptr[PIPE_WRITE]);
-                // printf("cmd %d %s dup read %d\n", i, buffer, prev_pipe_ptr[PIPE_READ]);
-            }
-        }
-        execv(buffer, &cmd->argv[cmd_start]);
-        perror("execv");
-        exit(1);
+    if (termios_inited)
+        tcsetattr(STDIN_FILENO, TCSANOW, &termios);
+
+    ret = posix_spawn(&pid, buffer, &actions, &attr, &cmd->argv[cmd_start], (char *const *)environ);
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    if (ret){
+        errno = ret;
+        perror("spawn");
+        return -1;
     }
 
+    if (!last_pgid)
+        last_pgid = pid;
     return pid;
 }
 
@@ -416,9 +411,46 @@ int print_pid(int argc, char **argv){
     return 0;
 }
 
-// list all the processes in the system
+#define SLAB_MAX_SITES  64
+
+// insertion sort of kmalloc call sites, most live words first
+static void sort_sites(struct kmalloc_site *sites, int n){
+    struct kmalloc_site tmp;
+    int i, j;
+    for(i = 1; i < n; i++){
+        tmp = sites[i];
+        for(j = i; j > 0 && sites[j - 1].live < tmp.live; j--)
+            sites[j] = sites[j - 1];
+        sites[j] = tmp;
+    }
+}
+
+// print the kernel heap, or with -p, the kmalloc call sites by live words
 int slab(int argc, char **argv){
-    return wramp_syscall(WINFO, WINFO_SLAB);
+    static struct kmalloc_site sites[SLAB_MAX_SITES];
+    int i, n;
+
+    if(argc < 2)
+        return wramp_syscall(WINFO, WINFO_SLAB);
+    if(strcmp(argv[1], "-p")){
+        fprintf(stderr, "Usage: slab [-p]\n");
+        return 1;
+    }
+
+    n = wramp_syscall(WINFO, WINFO_KMALLOC_SITES, sites, SLAB_MAX_SITES);
+    if(n < 0){
+        perror("slab");
+        return 1;
+    }
+    sort_sites(sites, n);
+    printf("call site     live     peak   allocs    frees\n");
+    for(i = 0; i < n; i++){
+        // ra is the instruction after the jal to kmalloc
+        printf("0x%05x  %7d  %7d  %7d  %7d\n", (unsigned int)(unsigned long)sites[i].ra - 1,
+            sites[i].live, sites[i].peak, sites[i].nr_allocs, sites[i].nr_frees);
+    }
+    printf("resolve call sites with tools/kdbg.py winix <call site>...\n");
+    return 0;
 }
 
 int cmd_exit(int argc, char **argv){
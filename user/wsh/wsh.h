@@ -23,6 +23,7 @@
 #include <stdbool.h>
 #include <sys/stat.h>
 #include <readline/history.h>
+#include <spawn.h>
 
 
 #define CMD_PROTOTYPE(name)    int name(int argc, char**argv)
@@ -39,9 +40,6 @@ struct cmd_internal {
 #ifndef __wramp__
 
 extern const char **environ;
-static int tfork(){
-    return fork();
-}
 static int enable_syscall_tracing(){
     return 0;
 }
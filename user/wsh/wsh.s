@@ -0,0 +1,1695 @@
+history_file:
+	.asciiz	".history"
+PREFIX:
+	.asciiz	"WINIX> "
+.global	termios_inited
+termios_inited:
+	.word	0x0
+.global	builtin_commands
+builtin_commands:
+	.word	printenv
+	.word	L.5
+	.word	do_trace_syscall
+	.word	L.6
+	.word	do_untrace_syscall
+	.word	L.7
+	.word	slab
+	.word	L.8
+	.word	cmd_kill
+	.word	L.9
+	.word	print_pid
+	.word	L.10
+	.word	mem_info
+	.word	L.11
+	.word	cmd_exit
+	.word	L.12
+	.word	help
+	.word	L.13
+	.word	help
+	.word	L.14
+	.word	do_cd
+	.word	L.15
+	.word	do_cls
+	.word	L.16
+	.word	do_fg
+	.word	L.17
+	.word	do_stest
+	.word	L.18
+	.word	0x0
+	.word	0x0
+.global	init_pgid
+.text
+init_pgid:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 21
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, pgid($0)
+L.19:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	init_shell
+init_shell:
+	subui	$sp, $sp, 8
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$13, $0, 20
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	jal	init_pgid
+	sw	$0, 0($sp)
+	lw	$13, pgid($0)
+	sw	$13, 1($sp)
+	jal	tcsetpgrp
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.23
+	addui	$6, $0, 1
+	j	L.24
+L.23:
+	addu	$6, $0, $0
+L.24:
+	sw	$6, 0($sp)
+	addui	$13, $0, 69
+	sw	$13, 1($sp)
+	la	$13, L.22
+	sw	$13, 2($sp)
+	jal	__assert
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	la	$13, termios
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 1
+	sw	$13, termios_inited($0)
+L.20:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	init_shell_sysenv
+init_shell_sysenv:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x1
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 49
+	sw	$13, 0($sp)
+	addui	$13, $0, 18
+	sw	$13, 1($sp)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x1
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+L.25:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	append_line_to_history_file
+append_line_to_history_file:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$13, $0, 22
+	sw	$13, 0($sp)
+	addui	$13, $0, 8449
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	addui	$13, $0, 438
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.27
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$13, 0($13)
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$1, $0, $13
+	j	L.26
+L.27:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addui	$12, $0, 24
+	sw	$12, 0($sp)
+	sw	$7, 1($sp)
+	lw	$12, 10($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	wramp_syscall
+	lw	$1, 8($sp)
+L.26:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	main
+main:
+	subui	$sp, $sp, 108
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	jal	init_pgid
+	lw	$13, 108($sp)
+	slei	$13, $13, 2
+	bnez	$13, L.30
+	lw	$13, 109($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	la	$13, L.32
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.30
+	sw	$0, 8($sp)
+	addui	$7, $0, 2
+	j	L.36
+L.33:
+	addui	$13, $sp, 8
+	sw	$13, 0($sp)
+	lw	$13, 109($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	addui	$13, $0, 100
+	sw	$13, 2($sp)
+	jal	strlcat
+	lw	$13, 108($sp)
+	subi	$13, $13, 1
+	sge	$13, $7, $13
+	bnez	$13, L.37
+	addui	$13, $sp, 8
+	sw	$13, 0($sp)
+	la	$13, L.39
+	sw	$13, 1($sp)
+	addui	$13, $0, 100
+	sw	$13, 2($sp)
+	jal	strlcat
+L.37:
+L.34:
+	addi	$7, $7, 1
+L.36:
+	lw	$13, 108($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.33
+	addui	$13, $sp, 8
+	sw	$13, 0($sp)
+	jal	exec_cmd
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.29
+L.30:
+	jal	init_shell
+	jal	init_shell_sysenv
+	j	L.41
+L.40:
+	la	$13, PREFIX
+	sw	$13, 0($sp)
+	jal	readline
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.43
+	j	L.42
+L.43:
+	sw	$7, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $6, $0
+	bnez	$13, L.48
+	lw	$13, 0($7)
+	sw	$13, 107($sp)
+	seqi	$13, $13, 35
+	bnez	$13, L.48
+	lw	$13, 107($sp)
+	snei	$13, $13, 10
+	bnez	$13, L.45
+L.48:
+	j	L.41
+L.45:
+	lw	$13, 0($7)
+	seq	$13, $13, $0
+	bnez	$13, L.49
+	sw	$7, 0($sp)
+	jal	add_history
+	la	$13, history_file
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	append_line_to_history_file
+L.49:
+	subi	$13, $6, 1
+	addu	$13, $13, $7
+	lw	$13, 0($13)
+	snei	$13, $13, 10
+	bnez	$13, L.51
+	subi	$13, $6, 1
+	addu	$13, $13, $7
+	sw	$0, 0($13)
+L.51:
+	sw	$7, 0($sp)
+	jal	exec_cmd
+	sw	$7, 0($sp)
+	jal	free
+L.41:
+	j	L.40
+L.42:
+	lw	$13, termios_inited($0)
+	seq	$13, $13, $0
+	bnez	$13, L.53
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	la	$13, termios
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+L.53:
+	addu	$1, $0, $0
+L.29:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 108
+	jr	$ra
+.global	search_path
+search_path:
+	subui	$sp, $sp, 21
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	la	$13, L.56
+	sw	$13, 1($sp)
+	lw	$13, 22($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	strlcpy
+	lw	$13, 21($sp)
+	sw	$13, 0($sp)
+	lw	$13, 23($sp)
+	sw	$13, 1($sp)
+	lw	$13, 22($sp)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	strlcat
+	addui	$13, $0, 32
+	sw	$13, 0($sp)
+	lw	$13, 21($sp)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 7
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	sw	$13, 20($sp)
+	lw	$13, 20($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.57
+	lw	$1, 20($sp)
+	j	L.55
+L.57:
+	lw	$13, 9($sp)
+	addui	$12, $0, 0x8000
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.61
+	addu	$7, $0, $0
+	j	L.62
+L.61:
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffff
+L.62:
+	addu	$1, $0, $7
+L.55:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 21
+	jr	$ra
+.global	run_cmd
+run_cmd:
+	subui	$sp, $sp, 101
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lw	$13, 102($sp)
+	lw	$12, 101($sp)
+	addui	$12, $12, 101
+	addu	$13, $13, $12
+	lw	$7, 0($13)
+	addui	$13, $0, 3
+	sw	$13, 43($sp)
+	addui	$13, $sp, 13
+	sw	$13, 0($sp)
+	addui	$13, $0, 30
+	sw	$13, 1($sp)
+	lw	$13, 101($sp)
+	addui	$13, $13, 118
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	search_path
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.64
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.67
+	sw	$13, 1($sp)
+	lw	$13, 101($sp)
+	addui	$13, $13, 118
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.63
+L.64:
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	jal	posix_spawn_file_actions_init
+	lw	$13, 102($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.68
+	lw	$13, 101($sp)
+	lw	$13, 149($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.68
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	addu	$13, $0, $0
+	sw	$13, 1($sp)
+	lw	$12, 101($sp)
+	lw	$12, 149($12)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$0, 4($sp)
+	jal	__spawn_actions_addopen
+L.68:
+	lw	$13, 101($sp)
+	sw	$13, 11($sp)
+	lw	$12, 102($sp)
+	lw	$11, 100($13)
+	subi	$11, $11, 1
+	sne	$13, $12, $11
+	bnez	$13, L.70
+	lw	$13, 11($sp)
+	lw	$13, 150($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.70
+	addui	$13, $0, 257
+	sw	$13, 12($sp)
+	lw	$13, 101($sp)
+	lw	$13, 151($13)
+	seq	$13, $13, $0
+	bnez	$13, L.72
+	lw	$13, 12($sp)
+	ori	$13, $13, 8192
+	sw	$13, 12($sp)
+	j	L.73
+L.72:
+	lw	$13, 12($sp)
+	ori	$13, $13, 4096
+	sw	$13, 12($sp)
+L.73:
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 101($sp)
+	lw	$13, 150($13)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	addui	$13, $0, 436
+	sw	$13, 4($sp)
+	jal	__spawn_actions_addopen
+L.70:
+	lw	$13, 101($sp)
+	lw	$13, 100($13)
+	slei	$13, $13, 1
+	bnez	$13, L.74
+	lw	$13, 102($sp)
+	addi	$13, $13, 1
+	lw	$12, 101($sp)
+	lw	$12, 100($12)
+	sge	$13, $13, $12
+	bnez	$13, L.76
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	lw	$12, 103($sp)
+	lw	$12, 1($12)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	jal	__spawn_actions_adddup2
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	lw	$13, 103($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	jal	__spawn_actions_addclose
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	lw	$13, 103($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	__spawn_actions_addclose
+L.76:
+	lw	$13, 102($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.78
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	lw	$13, 104($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	__spawn_actions_adddup2
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	lw	$13, 104($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	__spawn_actions_addclose
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	lw	$13, 104($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	jal	__spawn_actions_addclose
+L.78:
+L.74:
+	addui	$13, $sp, 96
+	sw	$13, 0($sp)
+	jal	posix_spawnattr_init
+	addui	$13, $sp, 46
+	sw	$13, 0($sp)
+	jal	sigemptyset
+	addui	$13, $sp, 46
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	sigaddset
+	addui	$13, $sp, 46
+	sw	$13, 0($sp)
+	addui	$13, $0, 18
+	sw	$13, 1($sp)
+	jal	sigaddset
+	addui	$13, $sp, 96
+	sw	$13, 0($sp)
+	addui	$13, $sp, 46
+	sw	$13, 1($sp)
+	jal	posix_spawnattr_setsigdefault
+	addui	$13, $sp, 96
+	sw	$13, 0($sp)
+	lw	$13, last_pgid($0)
+	sw	$13, 1($sp)
+	jal	posix_spawnattr_setpgroup
+	lw	$13, last_pgid($0)
+	sne	$13, $13, $0
+	bnez	$13, L.80
+	addui	$13, $sp, 96
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	jal	posix_spawnattr_tcsetpgrp_np
+	lw	$13, 43($sp)
+	ori	$13, $13, 8
+	sw	$13, 43($sp)
+L.80:
+	addui	$13, $sp, 96
+	sw	$13, 0($sp)
+	lw	$13, 43($sp)
+	sw	$13, 1($sp)
+	jal	posix_spawnattr_setflags
+	lw	$13, termios_inited($0)
+	seq	$13, $13, $0
+	bnez	$13, L.82
+	addui	$13, $0, 45
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 2
+	sw	$13, 2($sp)
+	la	$13, termios
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+L.82:
+	jal	get_environ
+	addu	$13, $0, $1
+	addui	$12, $sp, 44
+	sw	$12, 0($sp)
+	addui	$12, $sp, 13
+	sw	$12, 1($sp)
+	addui	$12, $sp, 47
+	sw	$12, 2($sp)
+	addui	$12, $sp, 96
+	sw	$12, 3($sp)
+	lw	$12, 101($sp)
+	addui	$12, $12, 118
+	addu	$12, $7, $12
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	jal	posix_spawn
+	addu	$13, $0, $1
+	sw	$13, 45($sp)
+	addui	$13, $sp, 96
+	sw	$13, 0($sp)
+	jal	posix_spawnattr_destroy
+	addui	$13, $sp, 47
+	sw	$13, 0($sp)
+	jal	__spawn_actions_destroy
+	lw	$13, 45($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.84
+	jal	get_sp
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	slli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	addu	$13, $0, $13
+	lw	$12, 45($sp)
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+	la	$13, L.86
+	sw	$13, 0($sp)
+	jal	perror
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.63
+L.84:
+	lw	$13, last_pgid($0)
+	sne	$13, $13, $0
+	bnez	$13, L.87
+	lw	$13, 44($sp)
+	sw	$13, last_pgid($0)
+L.87:
+	lw	$1, 44($sp)
+L.63:
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 101
+	jr	$ra
+.global	_exec_cmd
+_exec_cmd:
+	subui	$sp, $sp, 24
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	addu	$6, $0, $0
+	lw	$13, 24($sp)
+	lw	$13, 117($13)
+	sne	$13, $13, $0
+	bnez	$13, L.90
+	addui	$1, $0, 1
+	j	L.89
+L.90:
+	addu	$13, $0, $0
+	sw	$13, last_pgid($0)
+	addu	$7, $0, $13
+	j	L.95
+L.92:
+	slli	$13, $7, 1
+	addui	$12, $sp, 13
+	addu	$5, $13, $12
+	lw	$13, 24($sp)
+	lw	$13, 100($13)
+	subi	$13, $13, 1
+	sge	$13, $7, $13
+	bnez	$13, L.96
+	addui	$13, $0, 27
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	seq	$13, $4, $0
+	bnez	$13, L.98
+	la	$13, L.100
+	sw	$13, 0($sp)
+	jal	perror
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.89
+L.98:
+L.96:
+	lw	$13, 24($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	jal	run_cmd
+	addu	$13, $0, $1
+	addu	$3, $0, $13
+	lw	$13, 24($sp)
+	addui	$13, $13, 109
+	addu	$13, $7, $13
+	sw	$3, 0($13)
+	addu	$13, $0, $6
+	sequ	$13, $13, $0
+	bnez	$13, L.101
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 0($6)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addui	$13, $0, 25
+	sw	$13, 0($sp)
+	lw	$13, 1($6)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+L.101:
+	addu	$6, $0, $5
+L.93:
+	addi	$7, $7, 1
+L.95:
+	lw	$13, 24($sp)
+	lw	$13, 100($13)
+	slt	$13, $7, $13
+	bnez	$13, L.92
+	addu	$7, $0, $0
+	j	L.106
+L.103:
+	lw	$13, 24($sp)
+	addui	$13, $13, 109
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sne	$13, $13, $12
+	bnez	$13, L.107
+	j	L.104
+L.107:
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lw	$13, 24($sp)
+	addui	$13, $13, 109
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	addui	$13, $sp, 23
+	sw	$13, 2($sp)
+	addui	$13, $0, 2
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	lw	$13, 23($sp)
+	andi	$13, $13, 127
+	sw	$13, 12($sp)
+	seqi	$13, $13, 17
+	bnez	$13, L.111
+	lw	$13, 12($sp)
+	snei	$13, $13, 18
+	bnez	$13, L.109
+L.111:
+	lw	$13, last_pgid($0)
+	sw	$13, last_stopped_pgid($0)
+L.109:
+L.104:
+	addi	$7, $7, 1
+L.106:
+	lw	$13, 24($sp)
+	lw	$13, 100($13)
+	slt	$13, $7, $13
+	bnez	$13, L.103
+	sw	$0, 0($sp)
+	lw	$13, pgid($0)
+	sw	$13, 1($sp)
+	jal	tcsetpgrp
+	lw	$13, 23($sp)
+	srai	$13, $13, 8
+	andi	$1, $13, 255
+L.89:
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 24
+	jr	$ra
+.global	exec_cmd
+exec_cmd:
+	subui	$sp, $sp, 168
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addu	$7, $0, $0
+	lw	$13, 168($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 13
+	sw	$13, 1($sp)
+	jal	parse
+	addu	$13, $0, $0
+	sw	$13, 11($sp)
+	lw	$12, 166($sp)
+	addu	$12, $0, $12
+	sequ	$13, $12, $13
+	bnez	$13, L.113
+	lw	$13, 167($sp)
+	addu	$13, $0, $13
+	lw	$12, 11($sp)
+	sequ	$13, $13, $12
+	bnez	$13, L.113
+	addui	$13, $0, 100
+	sw	$13, 0($sp)
+	jal	malloc
+	addu	$13, $0, $1
+	sw	$13, 12($sp)
+	lw	$13, 167($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 100
+	sw	$13, 2($sp)
+	jal	parse_quotes
+	lw	$13, 12($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.118
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.120
+	sw	$13, 1($sp)
+	lw	$13, 166($sp)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	dprintf
+	lw	$13, 166($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	setenv
+L.118:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	free
+	addu	$1, $0, $0
+	j	L.112
+L.113:
+	la	$7, builtin_commands
+	j	L.124
+L.123:
+	addui	$7, $7, 2
+L.124:
+	addu	$13, $0, $0
+	sw	$13, 10($sp)
+	addu	$12, $0, $7
+	sequ	$13, $12, $13
+	bnez	$13, L.128
+	lw	$13, 1($7)
+	sw	$13, 9($sp)
+	addu	$12, $0, $13
+	lw	$11, 10($sp)
+	sequ	$13, $12, $11
+	bnez	$13, L.128
+	lw	$13, 131($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.123
+L.128:
+	lw	$13, 1($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.129
+	lw	$13, 130($sp)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 131
+	sw	$13, 1($sp)
+	lw	$13, 0($7)
+	jalr	$13
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.112
+L.129:
+	addui	$13, $sp, 13
+	sw	$13, 0($sp)
+	jal	_exec_cmd
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.112:
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 168
+	jr	$ra
+.global	printenv
+printenv:
+	subui	$sp, $sp, 7
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	jal	get_environ
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	j	L.135
+L.134:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.137
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	dprintf
+L.135:
+	addu	$13, $0, $6
+	addui	$6, $13, 1
+	lw	$13, 0($13)
+	addu	$7, $0, $13
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.134
+	addu	$1, $0, $0
+L.133:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	cmd_kill
+cmd_kill:
+	subui	$sp, $sp, 10
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 15
+	sw	$13, 8($sp)
+	addui	$13, $0, 1
+	sw	$13, 7($sp)
+	lw	$13, 10($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.139
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.141
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.138
+L.139:
+	lw	$13, 11($sp)
+	lw	$13, 1($13)
+	lw	$13, 0($13)
+	snei	$13, $13, 45
+	bnez	$13, L.142
+	lw	$13, 11($sp)
+	lw	$13, 1($13)
+	addui	$13, $13, 1
+	sw	$13, 0($sp)
+	addui	$13, $sp, 9
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.144
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.147
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	lw	$13, 1($13)
+	addui	$13, $13, 1
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.138
+L.144:
+	addui	$13, $0, 2
+	sw	$13, 7($sp)
+L.142:
+	lw	$13, 7($sp)
+	lw	$12, 11($sp)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 9
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.148
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.147
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	lw	$13, 2($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.138
+L.148:
+	addui	$13, $0, 11
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.151
+	la	$13, L.153
+	sw	$13, 0($sp)
+	jal	perror
+L.151:
+	addu	$1, $0, $0
+L.138:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	do_cd
+do_cd:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.155
+	addui	$1, $0, 1
+	j	L.154
+L.155:
+	addui	$13, $0, 29
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.157
+	la	$13, L.159
+	sw	$13, 0($sp)
+	jal	perror
+L.157:
+	addu	$1, $0, $7
+L.154:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	help
+help:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	la	$7, builtin_commands
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.161
+	sw	$13, 1($sp)
+	jal	dprintf
+	j	L.163
+L.162:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.165
+	sw	$13, 1($sp)
+	lw	$13, 1($7)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$7, $7, 2
+L.163:
+	addu	$13, $0, $0
+	sw	$13, 7($sp)
+	addu	$12, $0, $7
+	sequ	$13, $12, $13
+	bnez	$13, L.166
+	lw	$13, 1($7)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.162
+L.166:
+	addu	$1, $0, $0
+L.160:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+L.168:
+	.asciiz	"ls -lah /bin | grep snake | wc | cat"
+.global	do_stest
+.text
+do_stest:
+	subui	$sp, $sp, 5
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addu	$7, $0, $0
+L.169:
+	la	$13, L.168
+	sw	$13, 0($sp)
+	jal	exec_cmd
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	seq	$13, $13, $0
+	bnez	$13, L.173
+	j	L.171
+L.173:
+L.170:
+	addi	$7, $7, 1
+	slti	$13, $7, 10
+	bnez	$13, L.169
+L.171:
+	addu	$1, $0, $0
+L.167:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	cls
+cls:
+	.word	0x1b
+	.word	0x5b
+	.word	0x30
+	.word	0x3b
+	.word	0x30
+	.word	0x48
+	.word	0x1b
+	.word	0x5b
+	.word	0x32
+	.word	0x4a
+	.word	0x0
+.global	do_cls
+.text
+do_cls:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.176
+	sw	$13, 1($sp)
+	la	$13, cls
+	sw	$13, 2($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.175:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	do_trace_syscall
+do_trace_syscall:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.178
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 13
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.177:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	do_untrace_syscall
+do_untrace_syscall:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.180
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 13
+	sw	$13, 0($sp)
+	addui	$13, $0, 5
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.179:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	mem_info
+mem_info:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	addui	$13, $0, 13
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$1, $0, $0
+L.181:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	print_pid
+print_pid:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addui	$13, $0, 12
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addui	$12, $0, 1
+	sw	$12, 0($sp)
+	la	$12, L.183
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.182:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+sort_sites:
+	subui	$sp, $sp, 14
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$8, 2($sp)
+	sw	$9, 3($sp)
+	sw	$10, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	addui	$6, $0, 1
+	j	L.188
+L.185:
+	addui	$13, $sp, 9
+	addui	$12, $0, 5
+	mult	$12, $12, $6
+	lw	$11, 14($sp)
+	addu	$9, $12, $11
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	sw	$8, 4($13)
+	addu	$7, $0, $6
+	j	L.192
+L.189:
+	addui	$13, $0, 5
+	mult	$13, $13, $7
+	lw	$12, 14($sp)
+	addu	$11, $13, $12
+	sw	$11, 8($sp)
+	subi	$13, $13, 5
+	addu	$9, $13, $12
+	lw	$13, 8($sp)
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	sw	$8, 4($13)
+L.190:
+	subi	$7, $7, 1
+L.192:
+	sle	$13, $7, $0
+	bnez	$13, L.194
+	addui	$13, $0, 5
+	mult	$13, $13, $7
+	subi	$13, $13, 5
+	lw	$12, 14($sp)
+	addu	$13, $13, $12
+	lw	$13, 3($13)
+	lw	$12, 12($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.189
+L.194:
+	addui	$13, $0, 5
+	mult	$13, $13, $7
+	lw	$12, 14($sp)
+	addu	$13, $13, $12
+	addui	$9, $sp, 9
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	sw	$8, 4($13)
+L.186:
+	addi	$6, $6, 1
+L.188:
+	lw	$13, 15($sp)
+	slt	$13, $6, $13
+	bnez	$13, L.185
+L.184:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$8, 2($sp)
+	lw	$9, 3($sp)
+	lw	$10, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.bss
+L.196:
+	.space	320
+.global	slab
+.text
+slab:
+	subui	$sp, $sp, 13
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	lw	$13, 13($sp)
+	sgei	$13, $13, 2
+	bnez	$13, L.197
+	addui	$13, $0, 13
+	sw	$13, 0($sp)
+	addui	$13, $0, 3
+	sw	$13, 1($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.195
+L.197:
+	lw	$13, 14($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	la	$13, L.201
+	sw	$13, 1($sp)
+	jal	strcmp
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.199
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.203
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.195
+L.199:
+	addui	$13, $0, 13
+	sw	$13, 0($sp)
+	addui	$13, $0, 9
+	sw	$13, 1($sp)
+	la	$13, L.196
+	sw	$13, 2($sp)
+	addui	$13, $0, 64
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.204
+	la	$13, L.8
+	sw	$13, 0($sp)
+	jal	perror
+	addui	$1, $0, 1
+	j	L.195
+L.204:
+	la	$13, L.196
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	sort_sites
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.206
+	sw	$13, 1($sp)
+	jal	dprintf
+	addu	$7, $0, $0
+	j	L.210
+L.207:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.211
+	sw	$13, 1($sp)
+	addui	$13, $0, 5
+	mult	$13, $13, $7
+	lw	$12, L.196($13)
+	addu	$12, $0, $12
+	addui	$11, $0, 1
+	subu	$12, $12, $11
+	sw	$12, 2($sp)
+	lw	$12, L.196+3($13)
+	sw	$12, 3($sp)
+	lw	$12, L.196+4($13)
+	sw	$12, 4($sp)
+	lw	$12, L.196+1($13)
+	sw	$12, 5($sp)
+	lw	$13, L.196+2($13)
+	sw	$13, 6($sp)
+	jal	dprintf
+L.208:
+	addi	$7, $7, 1
+L.210:
+	slt	$13, $7, $6
+	bnez	$13, L.207
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.216
+	sw	$13, 1($sp)
+	jal	dprintf
+	addu	$1, $0, $0
+L.195:
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	cmd_exit
+cmd_exit:
+	subui	$sp, $sp, 7
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	sw	$0, 6($sp)
+	lw	$13, 7($sp)
+	slei	$13, $13, 1
+	bnez	$13, L.218
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	sw	$13, 0($sp)
+	addui	$13, $sp, 5
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.220
+	lw	$13, _stderr+1($0)
+	sw	$13, 0($sp)
+	la	$13, L.147
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	lw	$13, 1($13)
+	sw	$13, 2($sp)
+	jal	dprintf
+	addui	$1, $0, 1
+	j	L.217
+L.220:
+L.218:
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	la	$13, L.223
+	sw	$13, 1($sp)
+	jal	dprintf
+	addui	$13, $0, 2
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	jal	wramp_syscall
+	addui	$1, $0, 1
+L.217:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	do_fg
+do_fg:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	sw	$0, 0($sp)
+	lw	$13, last_stopped_pgid($0)
+	sw	$13, 1($sp)
+	jal	tcsetpgrp
+	addui	$13, $0, 11
+	sw	$13, 0($sp)
+	lw	$13, last_stopped_pgid($0)
+	subu	$13, $0, $13
+	sw	$13, 1($sp)
+	addui	$13, $0, 19
+	sw	$13, 2($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.225
+	addui	$13, $0, 10
+	sw	$13, 0($sp)
+	lw	$13, last_stopped_pgid($0)
+	subu	$13, $0, $13
+	sw	$13, 1($sp)
+	addui	$13, $sp, 7
+	sw	$13, 2($sp)
+	addui	$13, $0, 2
+	sw	$13, 3($sp)
+	jal	wramp_syscall
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.225:
+	sw	$0, 0($sp)
+	lw	$13, pgid($0)
+	sw	$13, 1($sp)
+	jal	tcsetpgrp
+	addu	$1, $0, $7
+L.224:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.bss
+.global	termios
+termios:
+	.space	39
+last_stopped_pgid:
+	.space	1
+last_pgid:
+	.space	1
+pgid:
+	.space	1
+.extern	rl_outstream 1
+.extern	rl_instream 1
+.extern	rl_ttyset 39
+.extern	rl_eof_found 1
+.extern	rl_done 1
+.extern	rl_prompt 1
+.extern	rl_end 1
+.extern	rl_point 1
+.extern	rl_line_buffer 1
+.extern	_environ 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.223:
+	.asciiz	"Bye!\n"
+L.216:
+	.asciiz	"resolve call sites with tools/kdbg.py winix <call site>...\n"
+L.211:
+	.asciiz	"0x%05x  %7d  %7d  %7d  %7d\n"
+L.206:
+	.asciiz	"call site     live     peak   allocs    frees\n"
+L.203:
+	.asciiz	"Usage: slab [-p]\n"
+L.201:
+	.asciiz	"-p"
+L.183:
+	.asciiz	"%d\n"
+L.180:
+	.asciiz	"Syscall tracking disabled\n"
+L.178:
+	.asciiz	"Printing syscall tracing in Serial Port 2\n"
+L.176:
+	.asciiz	"%s"
+L.165:
+	.asciiz	" * %s\n"
+L.161:
+	.asciiz	"Available Commands\n"
+L.159:
+	.asciiz	""
+L.153:
+	.asciiz	"kill "
+L.147:
+	.asciiz	"Invalid number '%s'\n"
+L.141:
+	.asciiz	"kill <-signal> [pid]\n"
+L.137:
+	.asciiz	"%s\n"
+L.120:
+	.asciiz	"setenv %s=%s\n"
+L.100:
+	.asciiz	"pipe"
+L.86:
+	.asciiz	"spawn"
+L.67:
+	.asciiz	"Unknown command '%s'\n"
+L.56:
+	.asciiz	"/bin/"
+L.39:
+	.asciiz	" "
+L.32:
+	.asciiz	"-c"
+L.22:
+	.asciiz	"user/wsh/wsh.c"
+L.18:
+	.asciiz	"stest"
+L.17:
+	.asciiz	"fg"
+L.16:
+	.asciiz	"clear"
+L.15:
+	.asciiz	"cd"
+L.14:
+	.asciiz	"?"
+L.13:
+	.asciiz	"help"
+L.12:
+	.asciiz	"exit"
+L.11:
+	.asciiz	"free"
+L.10:
+	.asciiz	"pid"
+L.9:
+	.asciiz	"kill"
+L.8:
+	.asciiz	"slab"
+L.7:
+	.asciiz	"untrace"
+L.6:
+	.asciiz	"trace"
+L.5:
+	.asciiz	"env"
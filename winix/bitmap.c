@@ -93,8 +93,190 @@ int bitmap_fill(unsigned int *map, int map_len){
     }
     return 0;
 }
+/**
+ * count the leading zero bits of a word, i.e. the number of clear bits
+ * before the first set bit in bitmap order (mask[0] first)
+ * @param  x 
+ * @return   0 - 32
+ */
+static int leading_zeros(unsigned int x){
+    int n = 0;
+    if(x == 0)
+        return 32;
+    if((x & 0xffff0000) == 0){
+        n += 16;
+        x <<= 16;
+    }
+    if((x & 0xff000000) == 0){
+        n += 8;
+        x <<= 8;
+    }
+    if((x & 0xf0000000) == 0){
+        n += 4;
+        x <<= 4;
+    }
+    if((x & 0xc0000000) == 0){
+        n += 2;
+        x <<= 2;
+    }
+    if((x & 0x80000000) == 0)
+        n += 1;
+    return n;
+}
+
+/**
+ * find the first set bit of a single word in bitmap order
+ * @param  word 
+ * @return      index of the bit, or -1 if no bit is set
+ */
+int bitmap_first_set(unsigned int word){
+    return word ? leading_zeros(word) : -1;
+}
+
+/**
+ * count the trailing zero bits of a word, i.e. the number of clear bits
+ * after the last set bit in bitmap order (mask[31] first)
+ * @param  x 
+ * @return   0 - 32
+ */
+static int trailing_zeros(unsigned int x){
+    int n = 0;
+    if(x == 0)
+        return 32;
+    if((x & 0x0000ffff) == 0){
+        n += 16;
+        x >>= 16;
+    }
+    if((x & 0x000000ff) == 0){
+        n += 8;
+        x >>= 8;
+    }
+    if((x & 0x0000000f) == 0){
+        n += 4;
+        x >>= 4;
+    }
+    if((x & 0x00000003) == 0){
+        n += 2;
+        x >>= 2;
+    }
+    if((x & 0x00000001) == 0)
+        n += 1;
+    return n;
+}
+
+/**
+ * number of 1s in a word
+ * @param  x 
+ * @return   
+ */
+static int popcount(unsigned int x){
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    x = (x + (x >> 4)) & 0x0f0f0f0f;
+    x = x + (x >> 8);
+    x = x + (x >> 16);
+    return x & 0x3f;
+}
+
+/**
+ * mask covering bits [from, to) of a word in bitmap order
+ * @param  from 0 <= from < to
+ * @param  to   from < to <= 32
+ * @return      
+ */
+static unsigned int range_mask(int from, int to){
+    unsigned int m = 0xffffffff >> from;
+    if(to < 32)
+        m &= ~(0xffffffff >> to);
+    return m;
+}
+
+/**
+ * continue a forward free run search through one word
+ * @param  word      map word, bits that must not be used are set
+ * @param  base      bit index of the first bit of the word
+ * @param  num       length of the run wanted
+ * @param  count     length of the free run carried over from previous words
+ * @param  run_start start of the carried over run
+ * @return           start of the run if it completes in this word, or -1
+ */
+static int scan_word_forward(unsigned int word, int base, int num, int *count, int *run_start){
+    int b, z;
+
+    if(word == 0xffffffff){
+        *count = 0;
+        return -1;
+    }
+    if(word == 0){
+        if(*count == 0)
+            *run_start = base;
+        *count += 32;
+        return *count >= num ? *run_start : -1;
+    }
+    for(b = 0; b < 32; ){
+        z = leading_zeros(word << b);
+        if(z > 32 - b)
+            z = 32 - b;
+        if(z){
+            if(*count == 0)
+                *run_start = base + b;
+            *count += z;
+            if(*count >= num)
+                return *run_start;
+            b += z;
+        }
+        if(b < 32){
+            b += leading_zeros(~(word << b));
+            *count = 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * continue a reverse free run search through one word
+ * @param  word  map word
+ * @param  base  bit index of the first bit of the word
+ * @param  num   length of the run wanted
+ * @param  count length of the free run carried over from higher words
+ * @return       lowest index of the run if it completes in this word, or -1
+ */
+static int scan_word_reverse(unsigned int word, int base, int num, int *count){
+    int s, z;
+
+    if(word == 0xffffffff){
+        *count = 0;
+        return -1;
+    }
+    if(word == 0){
+        if(*count + 32 >= num)
+            return base + 32 - (num - *count);
+        *count += 32;
+        return -1;
+    }
+    // s is the number of bits consumed from the tail of the word
+    for(s = 0; s < 32; ){
+        z = trailing_zeros(word >> s);
+        if(z > 32 - s)
+            z = 32 - s;
+        if(z){
+            if(*count + z >= num)
+                return base + 32 - s - (num - *count);
+            *count += z;
+            s += z;
+        }
+        if(s < 32){
+            s += trailing_zeros(~(word >> s));
+            *count = 0;
+        }
+    }
+    return -1;
+}
+
 /**
  * search the number of 0 bits from the position specified
+ * Full words are skipped or consumed at once, and runs inside partially
+ * used words are measured with leading zero counts
  * @param  map     memory map
  * @param  map_len memory map length
  * @param  start   starting bit to search from memory map, 0 <= start < map_len * 32
@@ -102,27 +284,21 @@ int bitmap_fill(unsigned int *map, int map_len){
  * @return         bit found
  */
 int bitmap_search_from(unsigned int *map, int map_len, int start, int num){
-    int i,j;
-    int count = 0;
+    int i, ret;
+    int count = 0, run_start = 0;
+    unsigned int word;
 
-    if(num >= map_len * 32 || start >= map_len * 32)
+    if(num <= 0 || start < 0 || num >= map_len * 32 || start >= map_len * 32)
         return -EINVAL;
 
-    i = start / 32;
-    j = start % 32;
-
-    for (; i < map_len; ++i){
-        for (; j< BITMASK_NR; j++) {
-            if ((map[i] & mask[j]) == 0) {
-                count++;
-                if (count == num) {
-                    return (i*32 + j - count+1);
-                }
-            }else{
-                count = 0;
-            }
-        }
-        j=0;
+    for (i = start / 32; i < map_len; ++i){
+        word = map[i];
+        // bits before the starting position are never part of a run
+        if(i == start / 32 && start % 32)
+            word |= ~(0xffffffff >> (start % 32));
+        ret = scan_word_forward(word, i * 32, num, &count, &run_start);
+        if(ret >= 0)
+            return ret;
     }
     return -EINVAL;
 }
@@ -140,23 +316,16 @@ int bitmap_search_from(unsigned int *map, int map_len, int start, int num){
  *                 or -1 if failed
  */
 int bitmap_search_reverse(unsigned int *map, int map_len, int num){
-    int i,j;
+    int i, ret;
     int count = 0;
 
-    if(num >= map_len * 32 )
+    if(num <= 0 || num >= map_len * 32 )
         return -EINVAL;
 
     for (i = map_len -1; i >= 0; i--){
-        for (j = BITMASK_NR -1; j >= 0; j--) {
-            if ((map[i] & mask[j]) == 0) {
-                count++;
-                if (count == num) {
-                    return (i*32 + j);
-                }
-            }else{
-                count = 0;
-            }
-        }
+        ret = scan_word_reverse(map[i], i * 32, num, &count);
+        if(ret >= 0)
+            return ret;
     }
     return -EINVAL;
 }
@@ -186,13 +355,16 @@ int bitmap_set_bit(unsigned int *map, int map_len,int start){
  * @return         
  */
 int bitmap_set_nbits(unsigned int *map, int map_len,int start, int len){
-    int i;
-    int inum;
-    if(start + len >= map_len * 32)    
+    int i, from, to;
+    if(start < 0 || len < 0 || start + len > map_len * 32)
         return -EINVAL;
-    for(i=0 ; i<len ; i++){
-        inum = start + i;
-        map[inum/32] = map[inum/32] | mask[inum%32];
+    while(len > 0){
+        i = start / 32;
+        from = start % 32;
+        to = from + len < 32 ? from + len : 32;
+        map[i] |= range_mask(from, to);
+        len -= to - from;
+        start += to - from;
     }
     return 0;
 }
@@ -201,13 +373,16 @@ int bitmap_set_nbits(unsigned int *map, int map_len,int start, int len){
  * @return         
  */
 int bitmap_clear_nbits(unsigned int *map, int map_len,int start, int len){
-    int i;
-    int inum;
-    if(start + len >= map_len * 32)    
+    int i, from, to;
+    if(start < 0 || len < 0 || start + len > map_len * 32)
         return -EINVAL;
-    for(i=0 ; i<len ; i++){
-        inum = start + i;
-        map[inum/32] = map[inum/32] & (~mask[inum%32]);
+    while(len > 0){
+        i = start / 32;
+        from = start % 32;
+        to = from + len < 32 ? from + len : 32;
+        map[i] &= ~range_mask(from, to);
+        len -= to - from;
+        start += to - from;
     }
     return 0;
 }
@@ -253,26 +428,16 @@ bool is_bit_on(unsigned int *map, int map_len, int bit){
  * @return         number of bits found
  */
 int count_bits(unsigned int *map, int map_len, int flags){
-    int i,j,curr_map_unit, count = 0;
-    bool and_mask;
-
-    if(flags == ONE_BITS)
-        and_mask = true;
-    else if(flags == ZERO_BITS)
-        and_mask = false;
-    else
+    int i, count = 0;
+
+    if(flags != ONE_BITS && flags != ZERO_BITS)
         return -EINVAL;
 
     for(i = 0; i < map_len; i++){
-        curr_map_unit = map[i];
-        for(j = 0; j < 32; j++){
-            if(and_mask && (mask[j] & curr_map_unit)){
-                count++;
-            }else if((!and_mask) && ((mask[j] & curr_map_unit) == 0)){
-                count++;
-            }
-        }
+        count += popcount(map[i]);
     }
+    if(flags == ZERO_BITS)
+        count = map_len * 32 - count;
     return count;
 }
 
@@ -291,6 +456,211 @@ int bitmap_xor(unsigned int *map1, unsigned int *map2, int map_len){
     return 0;
 }
 
+/**
+ * find the next bit with the given value at or after from
+ * @param  map   
+ * @param  nbits number of valid bits in map
+ * @param  from  
+ * @param  set   true to look for a 1, false for a 0
+ * @return       index of the bit, or -1 if none
+ */
+static int find_next_bit(unsigned int *map, int nbits, int from, bool set){
+    int i, idx;
+    unsigned int word;
+
+    for(i = from / 32; i * 32 < nbits; i++){
+        word = set ? map[i] : ~map[i];
+        if(i == from / 32)
+            word &= 0xffffffff >> (from % 32);
+        if(word){
+            idx = i * 32 + leading_zeros(word);
+            return idx < nbits ? idx : -1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * find the previous bit with the given value at or before from
+ * @param  map   
+ * @param  from  
+ * @param  set   true to look for a 1, false for a 0
+ * @return       index of the bit, or -1 if none
+ */
+static int find_prev_bit(unsigned int *map, int from, bool set){
+    int i;
+    unsigned int word;
+
+    for(i = from / 32; i >= 0; i--){
+        word = set ? map[i] : ~map[i];
+        if(i == from / 32)
+            word &= ~(0x7fffffff >> (from % 32));
+        if(word)
+            return i * 32 + 31 - trailing_zeros(word);
+    }
+    return -1;
+}
+
+/**
+ * recompute the summary bits of map words [from, to]
+ * @param hmap 
+ * @param from first word index
+ * @param to   last word index
+ */
+static void hbitmap_update(struct hbitmap *hmap, int from, int to){
+    int i;
+    unsigned int bit;
+
+    for(i = from; i <= to && i < hmap->map_len; i++){
+        bit = mask[i % 32];
+        if(hmap->map[i] == 0xffffffff)
+            hmap->full[i / 32] |= bit;
+        else
+            hmap->full[i / 32] &= ~bit;
+        if(hmap->map[i] == 0)
+            hmap->empty[i / 32] |= bit;
+        else
+            hmap->empty[i / 32] &= ~bit;
+    }
+}
+
+/**
+ * attach summary words to an existing bitmap. Each summary word covers
+ * a group of 32 map words, one bit per word, recording whether the word
+ * is completely used (full) or completely free (empty). The summary is
+ * built from the current content of map
+ * @param  hmap    
+ * @param  map     
+ * @param  map_len 
+ * @param  full    HBITMAP_SUMMARY_LEN(map_len) words
+ * @param  empty   HBITMAP_SUMMARY_LEN(map_len) words
+ * @return         
+ */
+int hbitmap_init(struct hbitmap *hmap, unsigned int *map, int map_len,
+                    unsigned int *full, unsigned int *empty){
+    if(map_len <= 0)
+        return -EINVAL;
+    hmap->map = map;
+    hmap->map_len = map_len;
+    hmap->full = full;
+    hmap->empty = empty;
+    bitmap_clear(full, HBITMAP_SUMMARY_LEN(map_len));
+    bitmap_clear(empty, HBITMAP_SUMMARY_LEN(map_len));
+    hbitmap_update(hmap, 0, map_len - 1);
+    return 0;
+}
+
+/**
+ * same as bitmap_search_from(), but runs of full words are skipped and
+ * runs of empty words are consumed through the summary
+ * @param  hmap  
+ * @param  start 
+ * @param  num   
+ * @return       
+ */
+int hbitmap_search_from(struct hbitmap *hmap, int start, int num){
+    int i, next, ret;
+    int count = 0, run_start = 0;
+    unsigned int word;
+
+    if(num <= 0 || start < 0 || num >= hmap->map_len * 32 || start >= hmap->map_len * 32)
+        return -EINVAL;
+
+    i = start / 32;
+    while(i < hmap->map_len){
+        word = hmap->map[i];
+        if(i == start / 32 && start % 32){
+            word |= ~(0xffffffff >> (start % 32));
+        }else if(hmap->full[i / 32] & mask[i % 32]){
+            count = 0;
+            i = find_next_bit(hmap->full, hmap->map_len, i, false);
+            if(i < 0)
+                break;
+            continue;
+        }else if(hmap->empty[i / 32] & mask[i % 32]){
+            next = find_next_bit(hmap->empty, hmap->map_len, i, false);
+            if(next < 0)
+                next = hmap->map_len;
+            if(count == 0)
+                run_start = i * 32;
+            count += (next - i) * 32;
+            if(count >= num)
+                return run_start;
+            i = next;
+            continue;
+        }
+        ret = scan_word_forward(word, i * 32, num, &count, &run_start);
+        if(ret >= 0)
+            return ret;
+        i++;
+    }
+    return -EINVAL;
+}
+
+/**
+ * same as bitmap_search_reverse(), using the summary to skip
+ * @param  hmap 
+ * @param  num  
+ * @return      
+ */
+int hbitmap_search_reverse(struct hbitmap *hmap, int num){
+    int i, prev, ret;
+    int count = 0;
+
+    if(num <= 0 || num >= hmap->map_len * 32)
+        return -EINVAL;
+
+    i = hmap->map_len - 1;
+    while(i >= 0){
+        if(hmap->full[i / 32] & mask[i % 32]){
+            count = 0;
+            i = find_prev_bit(hmap->full, i, false);
+            continue;
+        }
+        if(hmap->empty[i / 32] & mask[i % 32]){
+            prev = find_prev_bit(hmap->empty, i, false);
+            if(count + (i - prev) * 32 >= num)
+                return (i + 1) * 32 - (num - count);
+            count += (i - prev) * 32;
+            i = prev;
+            continue;
+        }
+        ret = scan_word_reverse(hmap->map[i], i * 32, num, &count);
+        if(ret >= 0)
+            return ret;
+        i--;
+    }
+    return -EINVAL;
+}
+
+int hbitmap_set_bit(struct hbitmap *hmap, int start){
+    int ret = bitmap_set_bit(hmap->map, hmap->map_len, start);
+    if(ret == 0)
+        hbitmap_update(hmap, start / 32, start / 32);
+    return ret;
+}
+
+int hbitmap_clear_bit(struct hbitmap *hmap, int start){
+    int ret = bitmap_clear_bit(hmap->map, hmap->map_len, start);
+    if(ret == 0)
+        hbitmap_update(hmap, start / 32, start / 32);
+    return ret;
+}
+
+int hbitmap_set_nbits(struct hbitmap *hmap, int start, int len){
+    int ret = bitmap_set_nbits(hmap->map, hmap->map_len, start, len);
+    if(ret == 0 && len > 0)
+        hbitmap_update(hmap, start / 32, (start + len - 1) / 32);
+    return ret;
+}
+
+int hbitmap_clear_nbits(struct hbitmap *hmap, int start, int len){
+    int ret = bitmap_clear_nbits(hmap->map, hmap->map_len, start, len);
+    if(ret == 0 && len > 0)
+        hbitmap_update(hmap, start / 32, (start + len - 1) / 32);
+    return ret;
+}
+
 /**
  * print the given bitmap
  * @param p   
@@ -0,0 +1,1914 @@
+.global	mask
+mask:
+	.word	0x80000000
+	.word	0x40000000
+	.word	0x20000000
+	.word	0x10000000
+	.word	0x8000000
+	.word	0x4000000
+	.word	0x2000000
+	.word	0x1000000
+	.word	0x800000
+	.word	0x400000
+	.word	0x200000
+	.word	0x100000
+	.word	0x80000
+	.word	0x40000
+	.word	0x20000
+	.word	0x10000
+	.word	0x8000
+	.word	0x4000
+	.word	0x2000
+	.word	0x1000
+	.word	0x800
+	.word	0x400
+	.word	0x200
+	.word	0x100
+	.word	0x80
+	.word	0x40
+	.word	0x20
+	.word	0x10
+	.word	0x8
+	.word	0x4
+	.word	0x2
+	.word	0x1
+.global	get_mask
+.text
+get_mask:
+	subui	$sp, $sp, 2
+	sw	$13, 0($sp)
+	lw	$13, 2($sp)
+	sw	$13, 1($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.12
+	lw	$13, 1($sp)
+	slti	$13, $13, 32
+	bnez	$13, L.10
+L.12:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.10:
+	lw	$13, 2($sp)
+	lw	$13, mask($13)
+	addu	$1, $0, $13
+L.9:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	bitmap_clear
+bitmap_clear:
+	subui	$sp, $sp, 2
+	sw	$7, 0($sp)
+	sw	$13, 1($sp)
+	addu	$7, $0, $0
+	j	L.17
+L.14:
+	lw	$13, 2($sp)
+	addu	$13, $7, $13
+	sw	$0, 0($13)
+L.15:
+	addi	$7, $7, 1
+L.17:
+	lw	$13, 3($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.14
+	addu	$1, $0, $0
+L.13:
+	lw	$7, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	bitmap_fill
+bitmap_fill:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	addu	$7, $0, $0
+	j	L.22
+L.19:
+	lw	$13, 3($sp)
+	addu	$13, $7, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 0($13)
+L.20:
+	addi	$7, $7, 1
+L.22:
+	lw	$13, 4($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.19
+	addu	$1, $0, $0
+L.18:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+leading_zeros:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	addu	$7, $0, $0
+	lw	$13, 3($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.24
+	addui	$1, $0, 32
+	j	L.23
+L.24:
+	lw	$13, 3($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.26
+	addi	$7, $7, 16
+	lw	$13, 3($sp)
+	slli	$13, $13, 16
+	sw	$13, 3($sp)
+L.26:
+	lw	$13, 3($sp)
+	lhi	$12, 0xff00
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.28
+	addi	$7, $7, 8
+	lw	$13, 3($sp)
+	slli	$13, $13, 8
+	sw	$13, 3($sp)
+L.28:
+	lw	$13, 3($sp)
+	lhi	$12, 0xf000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.30
+	addi	$7, $7, 4
+	lw	$13, 3($sp)
+	slli	$13, $13, 4
+	sw	$13, 3($sp)
+L.30:
+	lw	$13, 3($sp)
+	lhi	$12, 0xc000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.32
+	addi	$7, $7, 2
+	lw	$13, 3($sp)
+	slli	$13, $13, 2
+	sw	$13, 3($sp)
+L.32:
+	lw	$13, 3($sp)
+	lhi	$12, 0x8000
+	ori	$12, $12, 0x0
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.34
+	addi	$7, $7, 1
+L.34:
+	addu	$1, $0, $7
+L.23:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	bitmap_first_set
+bitmap_first_set:
+	subui	$sp, $sp, 4
+	sw	$7, 1($sp)
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	lw	$13, 4($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.38
+	lw	$13, 4($sp)
+	sw	$13, 0($sp)
+	jal	leading_zeros
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.39
+L.38:
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffff
+L.39:
+	addu	$1, $0, $7
+L.36:
+	lw	$7, 1($sp)
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+trailing_zeros:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	addu	$7, $0, $0
+	lw	$13, 3($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.41
+	addui	$1, $0, 32
+	j	L.40
+L.41:
+	lw	$13, 3($sp)
+	addui	$12, $0, 0xffff
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.43
+	addi	$7, $7, 16
+	lw	$13, 3($sp)
+	srli	$13, $13, 16
+	sw	$13, 3($sp)
+L.43:
+	lw	$13, 3($sp)
+	addui	$12, $0, 255
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.45
+	addi	$7, $7, 8
+	lw	$13, 3($sp)
+	srli	$13, $13, 8
+	sw	$13, 3($sp)
+L.45:
+	lw	$13, 3($sp)
+	addui	$12, $0, 15
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.47
+	addi	$7, $7, 4
+	lw	$13, 3($sp)
+	srli	$13, $13, 4
+	sw	$13, 3($sp)
+L.47:
+	lw	$13, 3($sp)
+	addui	$12, $0, 3
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.49
+	addi	$7, $7, 2
+	lw	$13, 3($sp)
+	srli	$13, $13, 2
+	sw	$13, 3($sp)
+L.49:
+	lw	$13, 3($sp)
+	addui	$12, $0, 1
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.51
+	addi	$7, $7, 1
+L.51:
+	addu	$1, $0, $7
+L.40:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+popcount:
+	subui	$sp, $sp, 3
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 3($sp)
+	srli	$12, $13, 1
+	lhi	$11, 0x5555
+	ori	$11, $11, 0x5555
+	and	$12, $12, $11
+	subu	$13, $13, $12
+	sw	$13, 3($sp)
+	lw	$13, 3($sp)
+	lhi	$12, 0x3333
+	ori	$12, $12, 0x3333
+	and	$11, $13, $12
+	srli	$13, $13, 2
+	and	$13, $13, $12
+	addu	$13, $11, $13
+	sw	$13, 3($sp)
+	lw	$13, 3($sp)
+	srli	$12, $13, 4
+	addu	$13, $13, $12
+	lhi	$12, 0xf0f
+	ori	$12, $12, 0xf0f
+	and	$13, $13, $12
+	sw	$13, 3($sp)
+	lw	$13, 3($sp)
+	srli	$12, $13, 8
+	addu	$13, $13, $12
+	sw	$13, 3($sp)
+	lw	$13, 3($sp)
+	srli	$12, $13, 16
+	addu	$13, $13, $12
+	sw	$13, 3($sp)
+	lw	$13, 3($sp)
+	addui	$12, $0, 63
+	and	$13, $13, $12
+	addu	$1, $0, $13
+L.53:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+range_mask:
+	subui	$sp, $sp, 4
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	lw	$12, 4($sp)
+	srl	$13, $13, $12
+	sw	$13, 3($sp)
+	lw	$13, 5($sp)
+	sgei	$13, $13, 32
+	bnez	$13, L.55
+	lw	$13, 3($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	lw	$11, 5($sp)
+	srl	$12, $12, $11
+	subu	$12, $0, $12
+	subui	$12, $12, 1
+	and	$13, $13, $12
+	sw	$13, 3($sp)
+L.55:
+	lw	$1, 3($sp)
+L.54:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+scan_word_forward:
+	subui	$sp, $sp, 7
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sneu	$13, $13, $12
+	bnez	$13, L.58
+	lw	$13, 10($sp)
+	sw	$0, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.57
+L.58:
+	lw	$13, 7($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.60
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.62
+	lw	$13, 11($sp)
+	lw	$12, 8($sp)
+	sw	$12, 0($13)
+L.62:
+	lw	$13, 10($sp)
+	lw	$12, 0($13)
+	addi	$12, $12, 32
+	sw	$12, 0($13)
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	lw	$12, 9($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.65
+	lw	$13, 11($sp)
+	lw	$5, 0($13)
+	j	L.66
+L.65:
+	lhi	$5, 0xffff
+	ori	$5, $5, 0xffff
+L.66:
+	addu	$1, $0, $5
+	j	L.57
+L.60:
+	addu	$7, $0, $0
+L.67:
+	lw	$13, 7($sp)
+	sll	$13, $13, $7
+	sw	$13, 0($sp)
+	jal	leading_zeros
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addui	$13, $0, 32
+	sub	$13, $13, $7
+	sle	$13, $6, $13
+	bnez	$13, L.71
+	addui	$13, $0, 32
+	sub	$6, $13, $7
+L.71:
+	seq	$13, $6, $0
+	bnez	$13, L.73
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.75
+	lw	$13, 11($sp)
+	lw	$12, 8($sp)
+	add	$12, $12, $7
+	sw	$12, 0($13)
+L.75:
+	lw	$13, 10($sp)
+	lw	$12, 0($13)
+	add	$12, $12, $6
+	sw	$12, 0($13)
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	lw	$12, 9($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.77
+	lw	$13, 11($sp)
+	lw	$1, 0($13)
+	j	L.57
+L.77:
+	add	$7, $7, $6
+L.73:
+	sgei	$13, $7, 32
+	bnez	$13, L.79
+	lw	$13, 7($sp)
+	sll	$13, $13, $7
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	sw	$13, 0($sp)
+	jal	leading_zeros
+	addu	$13, $0, $1
+	add	$7, $7, $13
+	lw	$13, 10($sp)
+	sw	$0, 0($13)
+L.79:
+L.68:
+	slti	$13, $7, 32
+	bnez	$13, L.67
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.57:
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+scan_word_reverse:
+	subui	$sp, $sp, 7
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sneu	$13, $13, $12
+	bnez	$13, L.82
+	lw	$13, 10($sp)
+	sw	$0, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.81
+L.82:
+	lw	$13, 7($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.84
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	addi	$13, $13, 32
+	lw	$12, 9($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.86
+	lw	$13, 8($sp)
+	addi	$13, $13, 32
+	lw	$12, 9($sp)
+	lw	$11, 10($sp)
+	lw	$11, 0($11)
+	sub	$12, $12, $11
+	sub	$1, $13, $12
+	j	L.81
+L.86:
+	lw	$13, 10($sp)
+	lw	$12, 0($13)
+	addi	$12, $12, 32
+	sw	$12, 0($13)
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.81
+L.84:
+	addu	$7, $0, $0
+L.88:
+	lw	$13, 7($sp)
+	srl	$13, $13, $7
+	sw	$13, 0($sp)
+	jal	trailing_zeros
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addui	$13, $0, 32
+	sub	$13, $13, $7
+	sle	$13, $6, $13
+	bnez	$13, L.92
+	addui	$13, $0, 32
+	sub	$6, $13, $7
+L.92:
+	seq	$13, $6, $0
+	bnez	$13, L.94
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	add	$13, $13, $6
+	lw	$12, 9($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.96
+	lw	$13, 8($sp)
+	addi	$13, $13, 32
+	sub	$13, $13, $7
+	lw	$12, 9($sp)
+	lw	$11, 10($sp)
+	lw	$11, 0($11)
+	sub	$12, $12, $11
+	sub	$1, $13, $12
+	j	L.81
+L.96:
+	lw	$13, 10($sp)
+	lw	$12, 0($13)
+	add	$12, $12, $6
+	sw	$12, 0($13)
+	add	$7, $7, $6
+L.94:
+	sgei	$13, $7, 32
+	bnez	$13, L.98
+	lw	$13, 7($sp)
+	srl	$13, $13, $7
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	sw	$13, 0($sp)
+	jal	trailing_zeros
+	addu	$13, $0, $1
+	add	$7, $7, $13
+	lw	$13, 10($sp)
+	sw	$0, 0($13)
+L.98:
+L.89:
+	slti	$13, $7, 32
+	bnez	$13, L.88
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.81:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	bitmap_search_from
+bitmap_search_from:
+	subui	$sp, $sp, 18
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$11, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	sw	$0, 17($sp)
+	sw	$0, 16($sp)
+	lw	$13, 21($sp)
+	sw	$13, 15($sp)
+	addu	$12, $0, $0
+	sle	$13, $13, $12
+	bnez	$13, L.105
+	lw	$13, 20($sp)
+	sw	$13, 14($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.105
+	lw	$13, 19($sp)
+	slli	$13, $13, 5
+	sw	$13, 13($sp)
+	lw	$12, 15($sp)
+	sge	$13, $12, $13
+	bnez	$13, L.105
+	lw	$13, 14($sp)
+	lw	$12, 13($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.101
+L.105:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.100
+L.101:
+	lw	$13, 20($sp)
+	divi	$7, $13, 32
+	j	L.109
+L.106:
+	lw	$13, 18($sp)
+	addu	$13, $7, $13
+	lw	$5, 0($13)
+	lw	$13, 20($sp)
+	sw	$13, 12($sp)
+	addui	$12, $0, 32
+	div	$11, $13, $12
+	sne	$13, $7, $11
+	bnez	$13, L.110
+	lw	$13, 12($sp)
+	rem	$13, $13, $12
+	seq	$13, $13, $0
+	bnez	$13, L.110
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	lw	$12, 20($sp)
+	remi	$12, $12, 32
+	srl	$13, $13, $12
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	or	$5, $5, $13
+L.110:
+	sw	$5, 0($sp)
+	slli	$13, $7, 5
+	sw	$13, 1($sp)
+	lw	$13, 21($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 17
+	sw	$13, 3($sp)
+	addui	$13, $sp, 16
+	sw	$13, 4($sp)
+	jal	scan_word_forward
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	slt	$13, $6, $0
+	bnez	$13, L.112
+	addu	$1, $0, $6
+	j	L.100
+L.112:
+L.107:
+	addi	$7, $7, 1
+L.109:
+	lw	$13, 19($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.106
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.100:
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$11, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 18
+	jr	$ra
+.global	bitmap_search_reverse
+bitmap_search_reverse:
+	subui	$sp, $sp, 11
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	sw	$0, 10($sp)
+	lw	$13, 13($sp)
+	sw	$13, 9($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.117
+	lw	$13, 12($sp)
+	slli	$13, $13, 5
+	lw	$12, 9($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.115
+L.117:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.114
+L.115:
+	lw	$13, 12($sp)
+	subi	$7, $13, 1
+	j	L.121
+L.118:
+	lw	$13, 11($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	slli	$13, $7, 5
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 10
+	sw	$13, 3($sp)
+	jal	scan_word_reverse
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	slt	$13, $6, $0
+	bnez	$13, L.122
+	addu	$1, $0, $6
+	j	L.114
+L.122:
+L.119:
+	subi	$7, $7, 1
+L.121:
+	sge	$13, $7, $0
+	bnez	$13, L.118
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.114:
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	bitmap_set_bit
+bitmap_set_bit:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 6($sp)
+	divi	$7, $13, 32
+	lw	$13, 6($sp)
+	lw	$12, 5($sp)
+	slli	$12, $12, 5
+	slt	$13, $13, $12
+	bnez	$13, L.125
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.124
+L.125:
+	lw	$13, 4($sp)
+	addu	$13, $7, $13
+	lw	$12, 0($13)
+	lw	$11, 6($sp)
+	remi	$11, $11, 32
+	lw	$11, mask($11)
+	or	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.124:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	bitmap_set_nbits
+bitmap_set_nbits:
+	subui	$sp, $sp, 12
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 14($sp)
+	sw	$13, 11($sp)
+	addu	$12, $0, $0
+	slt	$13, $13, $12
+	bnez	$13, L.131
+	lw	$13, 15($sp)
+	sw	$13, 10($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.131
+	lw	$13, 11($sp)
+	lw	$12, 10($sp)
+	add	$13, $13, $12
+	lw	$12, 13($sp)
+	slli	$12, $12, 5
+	sle	$13, $13, $12
+	bnez	$13, L.133
+L.131:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.127
+L.132:
+	lw	$13, 14($sp)
+	addui	$12, $0, 32
+	div	$5, $13, $12
+	rem	$7, $13, $12
+	lw	$13, 15($sp)
+	add	$13, $7, $13
+	sge	$13, $13, $12
+	bnez	$13, L.136
+	lw	$13, 15($sp)
+	add	$4, $7, $13
+	j	L.137
+L.136:
+	addui	$4, $0, 32
+L.137:
+	addu	$6, $0, $4
+	sw	$7, 0($sp)
+	sw	$6, 1($sp)
+	jal	range_mask
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	addu	$12, $5, $12
+	lw	$11, 0($12)
+	or	$13, $11, $13
+	sw	$13, 0($12)
+	sub	$13, $6, $7
+	lw	$12, 15($sp)
+	sub	$12, $12, $13
+	sw	$12, 15($sp)
+	lw	$12, 14($sp)
+	add	$13, $12, $13
+	sw	$13, 14($sp)
+L.133:
+	lw	$13, 15($sp)
+	sgt	$13, $13, $0
+	bnez	$13, L.132
+	addu	$1, $0, $0
+L.127:
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	bitmap_clear_nbits
+bitmap_clear_nbits:
+	subui	$sp, $sp, 12
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	lw	$13, 14($sp)
+	sw	$13, 11($sp)
+	addu	$12, $0, $0
+	slt	$13, $13, $12
+	bnez	$13, L.142
+	lw	$13, 15($sp)
+	sw	$13, 10($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.142
+	lw	$13, 11($sp)
+	lw	$12, 10($sp)
+	add	$13, $13, $12
+	lw	$12, 13($sp)
+	slli	$12, $12, 5
+	sle	$13, $13, $12
+	bnez	$13, L.144
+L.142:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.138
+L.143:
+	lw	$13, 14($sp)
+	addui	$12, $0, 32
+	div	$5, $13, $12
+	rem	$7, $13, $12
+	lw	$13, 15($sp)
+	add	$13, $7, $13
+	sge	$13, $13, $12
+	bnez	$13, L.147
+	lw	$13, 15($sp)
+	add	$4, $7, $13
+	j	L.148
+L.147:
+	addui	$4, $0, 32
+L.148:
+	addu	$6, $0, $4
+	sw	$7, 0($sp)
+	sw	$6, 1($sp)
+	jal	range_mask
+	addu	$13, $0, $1
+	lw	$12, 12($sp)
+	addu	$12, $5, $12
+	lw	$11, 0($12)
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	and	$13, $11, $13
+	sw	$13, 0($12)
+	sub	$13, $6, $7
+	lw	$12, 15($sp)
+	sub	$12, $12, $13
+	sw	$12, 15($sp)
+	lw	$12, 14($sp)
+	add	$13, $12, $13
+	sw	$13, 14($sp)
+L.144:
+	lw	$13, 15($sp)
+	sgt	$13, $13, $0
+	bnez	$13, L.143
+	addu	$1, $0, $0
+L.138:
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	bitmap_clear_bit
+bitmap_clear_bit:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 6($sp)
+	divi	$7, $13, 32
+	lw	$13, 6($sp)
+	lw	$12, 5($sp)
+	slli	$12, $12, 5
+	slt	$13, $13, $12
+	bnez	$13, L.150
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.149
+L.150:
+	lw	$13, 4($sp)
+	addu	$13, $7, $13
+	lw	$12, 0($13)
+	lw	$11, 6($sp)
+	remi	$11, $11, 32
+	lw	$11, mask($11)
+	subu	$11, $0, $11
+	subui	$11, $11, 1
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+L.149:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	is_bit_on
+is_bit_on:
+	subui	$sp, $sp, 4
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	divi	$13, $13, 32
+	sw	$13, 3($sp)
+	lw	$13, 6($sp)
+	remi	$13, $13, 32
+	sw	$13, 2($sp)
+	lw	$13, 6($sp)
+	lw	$12, 5($sp)
+	slli	$12, $12, 5
+	sle	$13, $13, $12
+	bnez	$13, L.153
+	addu	$1, $0, $0
+	j	L.152
+L.153:
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	lw	$12, 2($sp)
+	lw	$12, mask($12)
+	and	$13, $13, $12
+	addu	$1, $0, $13
+L.152:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	count_bits
+count_bits:
+	subui	$sp, $sp, 6
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	addu	$6, $0, $0
+	lw	$13, 8($sp)
+	sw	$13, 5($sp)
+	seqi	$13, $13, 2
+	bnez	$13, L.156
+	lw	$13, 5($sp)
+	seqi	$13, $13, 1
+	bnez	$13, L.156
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.155
+L.156:
+	addu	$7, $0, $0
+	j	L.161
+L.158:
+	lw	$13, 6($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	jal	popcount
+	addu	$13, $0, $1
+	add	$6, $6, $13
+L.159:
+	addi	$7, $7, 1
+L.161:
+	lw	$13, 7($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.158
+	lw	$13, 8($sp)
+	snei	$13, $13, 1
+	bnez	$13, L.162
+	lw	$13, 7($sp)
+	slli	$13, $13, 5
+	sub	$6, $13, $6
+L.162:
+	addu	$1, $0, $6
+L.155:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	bitmap_xor
+bitmap_xor:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	addu	$7, $0, $0
+	addu	$7, $0, $0
+	j	L.168
+L.165:
+	lw	$13, 4($sp)
+	addu	$13, $7, $13
+	lw	$12, 0($13)
+	lw	$11, 5($sp)
+	addu	$11, $7, $11
+	lw	$11, 0($11)
+	xor	$12, $12, $11
+	sw	$12, 0($13)
+L.166:
+	addi	$7, $7, 1
+L.168:
+	lw	$13, 6($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.165
+	addu	$1, $0, $0
+L.164:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+find_next_bit:
+	subui	$sp, $sp, 9
+	sw	$3, 1($sp)
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 11($sp)
+	divi	$7, $13, 32
+	j	L.173
+L.170:
+	lw	$13, 12($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.175
+	lw	$13, 9($sp)
+	addu	$13, $7, $13
+	lw	$4, 0($13)
+	j	L.176
+L.175:
+	lw	$13, 9($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	subu	$4, $0, $13
+	subui	$4, $4, 1
+L.176:
+	addu	$6, $0, $4
+	lw	$13, 11($sp)
+	divi	$13, $13, 32
+	sne	$13, $7, $13
+	bnez	$13, L.177
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	lw	$12, 11($sp)
+	remi	$12, $12, 32
+	srl	$13, $13, $12
+	and	$6, $6, $13
+L.177:
+	sequ	$13, $6, $0
+	bnez	$13, L.179
+	sw	$6, 0($sp)
+	jal	leading_zeros
+	addu	$13, $0, $1
+	slli	$12, $7, 5
+	add	$5, $12, $13
+	lw	$13, 10($sp)
+	sge	$13, $5, $13
+	bnez	$13, L.182
+	addu	$3, $0, $5
+	j	L.183
+L.182:
+	lhi	$3, 0xffff
+	ori	$3, $3, 0xffff
+L.183:
+	addu	$1, $0, $3
+	j	L.169
+L.179:
+L.171:
+	addi	$7, $7, 1
+L.173:
+	slli	$13, $7, 5
+	lw	$12, 10($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.170
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.169:
+	lw	$3, 1($sp)
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+find_prev_bit:
+	subui	$sp, $sp, 7
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 8($sp)
+	divi	$7, $13, 32
+	j	L.188
+L.185:
+	lw	$13, 9($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.190
+	lw	$13, 7($sp)
+	addu	$13, $7, $13
+	lw	$5, 0($13)
+	j	L.191
+L.190:
+	lw	$13, 7($sp)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	subu	$5, $0, $13
+	subui	$5, $5, 1
+L.191:
+	addu	$6, $0, $5
+	lw	$13, 8($sp)
+	divi	$13, $13, 32
+	sne	$13, $7, $13
+	bnez	$13, L.192
+	lhi	$13, 0x7fff
+	ori	$13, $13, 0xffff
+	lw	$12, 8($sp)
+	remi	$12, $12, 32
+	sra	$13, $13, $12
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	addu	$13, $0, $13
+	and	$6, $6, $13
+L.192:
+	sequ	$13, $6, $0
+	bnez	$13, L.194
+	sw	$6, 0($sp)
+	jal	trailing_zeros
+	addu	$13, $0, $1
+	slli	$12, $7, 5
+	addi	$12, $12, 31
+	sub	$1, $12, $13
+	j	L.184
+L.194:
+L.186:
+	subi	$7, $7, 1
+L.188:
+	sge	$13, $7, $0
+	bnez	$13, L.185
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.184:
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+hbitmap_update:
+	subui	$sp, $sp, 5
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$7, 6($sp)
+	j	L.200
+L.197:
+	remi	$13, $7, 32
+	lw	$6, mask($13)
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sneu	$13, $13, $12
+	bnez	$13, L.201
+	divi	$13, $7, 32
+	lw	$12, 5($sp)
+	lw	$12, 2($12)
+	addu	$13, $13, $12
+	lw	$12, 0($13)
+	or	$12, $12, $6
+	sw	$12, 0($13)
+	j	L.202
+L.201:
+	divi	$13, $7, 32
+	lw	$12, 5($sp)
+	lw	$12, 2($12)
+	addu	$13, $13, $12
+	lw	$12, 0($13)
+	subu	$11, $0, $6
+	subui	$11, $11, 1
+	and	$12, $12, $11
+	sw	$12, 0($13)
+L.202:
+	lw	$13, 5($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sneu	$13, $13, $0
+	bnez	$13, L.203
+	divi	$13, $7, 32
+	lw	$12, 5($sp)
+	lw	$12, 3($12)
+	addu	$13, $13, $12
+	lw	$12, 0($13)
+	or	$12, $12, $6
+	sw	$12, 0($13)
+	j	L.204
+L.203:
+	divi	$13, $7, 32
+	lw	$12, 5($sp)
+	lw	$12, 3($12)
+	addu	$13, $13, $12
+	lw	$12, 0($13)
+	subu	$11, $0, $6
+	subui	$11, $11, 1
+	and	$12, $12, $11
+	sw	$12, 0($13)
+L.204:
+L.198:
+	addi	$7, $7, 1
+L.200:
+	lw	$13, 7($sp)
+	sgt	$13, $7, $13
+	bnez	$13, L.205
+	lw	$13, 5($sp)
+	lw	$13, 1($13)
+	slt	$13, $7, $13
+	bnez	$13, L.197
+L.205:
+L.196:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	hbitmap_init
+hbitmap_init:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	sgt	$13, $13, $0
+	bnez	$13, L.207
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.206
+L.207:
+	lw	$13, 6($sp)
+	lw	$12, 7($sp)
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	lw	$12, 8($sp)
+	sw	$12, 1($13)
+	lw	$13, 6($sp)
+	lw	$12, 9($sp)
+	sw	$12, 2($13)
+	lw	$13, 6($sp)
+	lw	$12, 10($sp)
+	sw	$12, 3($13)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	addi	$13, $13, 31
+	divi	$13, $13, 32
+	sw	$13, 1($sp)
+	jal	bitmap_clear
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	addi	$13, $13, 31
+	divi	$13, $13, 32
+	sw	$13, 1($sp)
+	jal	bitmap_clear
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 8($sp)
+	subi	$13, $13, 1
+	sw	$13, 2($sp)
+	jal	hbitmap_update
+	addu	$1, $0, $0
+L.206:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	hbitmap_search_from
+hbitmap_search_from:
+	subui	$sp, $sp, 19
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$11, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	sw	$0, 18($sp)
+	sw	$0, 17($sp)
+	lw	$13, 21($sp)
+	sw	$13, 16($sp)
+	addu	$12, $0, $0
+	sle	$13, $13, $12
+	bnez	$13, L.214
+	lw	$13, 20($sp)
+	sw	$13, 15($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.214
+	lw	$13, 19($sp)
+	lw	$13, 1($13)
+	slli	$13, $13, 5
+	sw	$13, 14($sp)
+	lw	$12, 16($sp)
+	sge	$13, $12, $13
+	bnez	$13, L.214
+	lw	$13, 15($sp)
+	lw	$12, 14($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.210
+L.214:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.209
+L.210:
+	lw	$13, 20($sp)
+	divi	$7, $13, 32
+	j	L.216
+L.215:
+	lw	$13, 19($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lw	$5, 0($13)
+	lw	$13, 20($sp)
+	sw	$13, 13($sp)
+	addui	$12, $0, 32
+	div	$11, $13, $12
+	sne	$13, $7, $11
+	bnez	$13, L.218
+	lw	$13, 13($sp)
+	rem	$13, $13, $12
+	seq	$13, $13, $0
+	bnez	$13, L.218
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	lw	$12, 20($sp)
+	remi	$12, $12, 32
+	srl	$13, $13, $12
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	or	$5, $5, $13
+	j	L.219
+L.218:
+	addui	$13, $0, 32
+	div	$12, $7, $13
+	lw	$11, 19($sp)
+	lw	$11, 2($11)
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	rem	$13, $7, $13
+	lw	$13, mask($13)
+	and	$13, $12, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.220
+	addu	$13, $0, $0
+	sw	$13, 18($sp)
+	lw	$12, 19($sp)
+	lw	$11, 2($12)
+	sw	$11, 0($sp)
+	lw	$12, 1($12)
+	sw	$12, 1($sp)
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	jal	find_next_bit
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.216
+	j	L.217
+L.220:
+	addui	$13, $0, 32
+	div	$12, $7, $13
+	lw	$11, 19($sp)
+	lw	$11, 3($11)
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	rem	$13, $7, $13
+	lw	$13, mask($13)
+	and	$13, $12, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.224
+	lw	$13, 19($sp)
+	lw	$12, 3($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	sw	$0, 3($sp)
+	jal	find_next_bit
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	sge	$13, $4, $0
+	bnez	$13, L.226
+	lw	$13, 19($sp)
+	lw	$4, 1($13)
+L.226:
+	lw	$13, 18($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.228
+	slli	$13, $7, 5
+	sw	$13, 17($sp)
+L.228:
+	lw	$13, 18($sp)
+	sub	$12, $4, $7
+	slli	$12, $12, 5
+	add	$13, $13, $12
+	sw	$13, 18($sp)
+	lw	$13, 18($sp)
+	lw	$12, 21($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.230
+	lw	$1, 17($sp)
+	j	L.209
+L.230:
+	addu	$7, $0, $4
+	j	L.216
+L.224:
+L.219:
+	sw	$5, 0($sp)
+	slli	$13, $7, 5
+	sw	$13, 1($sp)
+	lw	$13, 21($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 18
+	sw	$13, 3($sp)
+	addui	$13, $sp, 17
+	sw	$13, 4($sp)
+	jal	scan_word_forward
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	slt	$13, $6, $0
+	bnez	$13, L.232
+	addu	$1, $0, $6
+	j	L.209
+L.232:
+	addi	$7, $7, 1
+L.216:
+	lw	$13, 19($sp)
+	lw	$13, 1($13)
+	slt	$13, $7, $13
+	bnez	$13, L.215
+L.217:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.209:
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$11, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 19
+	jr	$ra
+.global	hbitmap_search_reverse
+hbitmap_search_reverse:
+	subui	$sp, $sp, 13
+	sw	$5, 4($sp)
+	sw	$6, 5($sp)
+	sw	$7, 6($sp)
+	sw	$11, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	sw	$0, 12($sp)
+	lw	$13, 14($sp)
+	sw	$13, 11($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.237
+	lw	$13, 13($sp)
+	lw	$13, 1($13)
+	slli	$13, $13, 5
+	lw	$12, 11($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.235
+L.237:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.234
+L.235:
+	lw	$13, 13($sp)
+	lw	$13, 1($13)
+	subi	$7, $13, 1
+	j	L.239
+L.238:
+	addui	$13, $0, 32
+	div	$12, $7, $13
+	lw	$11, 13($sp)
+	lw	$11, 2($11)
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	rem	$13, $7, $13
+	lw	$13, mask($13)
+	and	$13, $12, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.241
+	addu	$13, $0, $0
+	sw	$13, 12($sp)
+	lw	$12, 13($sp)
+	lw	$12, 2($12)
+	sw	$12, 0($sp)
+	sw	$7, 1($sp)
+	sw	$13, 2($sp)
+	jal	find_prev_bit
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.239
+L.241:
+	addui	$13, $0, 32
+	div	$12, $7, $13
+	lw	$11, 13($sp)
+	lw	$11, 3($11)
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	rem	$13, $7, $13
+	lw	$13, mask($13)
+	and	$13, $12, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.243
+	lw	$13, 13($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	sw	$0, 2($sp)
+	jal	find_prev_bit
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lw	$13, 12($sp)
+	sub	$12, $7, $5
+	slli	$12, $12, 5
+	add	$13, $13, $12
+	lw	$12, 14($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.245
+	slli	$13, $7, 5
+	addi	$13, $13, 32
+	lw	$12, 14($sp)
+	lw	$11, 12($sp)
+	sub	$12, $12, $11
+	sub	$1, $13, $12
+	j	L.234
+L.245:
+	lw	$13, 12($sp)
+	sub	$12, $7, $5
+	slli	$12, $12, 5
+	add	$13, $13, $12
+	sw	$13, 12($sp)
+	addu	$7, $0, $5
+	j	L.239
+L.243:
+	lw	$13, 13($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	slli	$13, $7, 5
+	sw	$13, 1($sp)
+	lw	$13, 14($sp)
+	sw	$13, 2($sp)
+	addui	$13, $sp, 12
+	sw	$13, 3($sp)
+	jal	scan_word_reverse
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	slt	$13, $6, $0
+	bnez	$13, L.247
+	addu	$1, $0, $6
+	j	L.234
+L.247:
+	subi	$7, $7, 1
+L.239:
+	sge	$13, $7, $0
+	bnez	$13, L.238
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.234:
+	lw	$5, 4($sp)
+	lw	$6, 5($sp)
+	lw	$7, 6($sp)
+	lw	$11, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 13
+	jr	$ra
+.global	hbitmap_set_bit
+hbitmap_set_bit:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_set_bit
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.250
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	divi	$13, $13, 32
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	hbitmap_update
+L.250:
+	addu	$1, $0, $7
+L.249:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	hbitmap_clear_bit
+hbitmap_clear_bit:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 7($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_clear_bit
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.253
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	divi	$13, $13, 32
+	sw	$13, 1($sp)
+	sw	$13, 2($sp)
+	jal	hbitmap_update
+L.253:
+	addu	$1, $0, $7
+L.252:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	hbitmap_set_nbits
+hbitmap_set_nbits:
+	subui	$sp, $sp, 10
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 10($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	bitmap_set_nbits
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $0
+	sw	$13, 9($sp)
+	sne	$13, $7, $13
+	bnez	$13, L.256
+	lw	$13, 12($sp)
+	lw	$12, 9($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.256
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	addui	$12, $0, 32
+	div	$11, $13, $12
+	sw	$11, 1($sp)
+	lw	$11, 12($sp)
+	add	$13, $13, $11
+	subi	$13, $13, 1
+	div	$13, $13, $12
+	sw	$13, 2($sp)
+	jal	hbitmap_update
+L.256:
+	addu	$1, $0, $7
+L.255:
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	hbitmap_clear_nbits
+hbitmap_clear_nbits:
+	subui	$sp, $sp, 10
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 10($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	lw	$13, 12($sp)
+	sw	$13, 3($sp)
+	jal	bitmap_clear_nbits
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $0
+	sw	$13, 9($sp)
+	sne	$13, $7, $13
+	bnez	$13, L.259
+	lw	$13, 12($sp)
+	lw	$12, 9($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.259
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	addui	$12, $0, 32
+	div	$11, $13, $12
+	sw	$11, 1($sp)
+	lw	$11, 12($sp)
+	add	$13, $13, $11
+	subi	$13, $13, 1
+	div	$13, $13, $12
+	sw	$13, 2($sp)
+	jal	hbitmap_update
+L.259:
+	addu	$1, $0, $7
+L.258:
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	_kreport_bitmap
+_kreport_bitmap:
+	subui	$sp, $sp, 6
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addu	$7, $0, $0
+	j	L.265
+L.262:
+	la	$13, L.266
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	addui	$12, $13, 1
+	sw	$12, 6($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	jalr	$13
+	addi	$13, $7, 1
+	remi	$13, $13, 8
+	sne	$13, $13, $0
+	bnez	$13, L.267
+	la	$13, L.269
+	sw	$13, 0($sp)
+	jal	kprintf
+L.267:
+L.263:
+	addi	$7, $7, 1
+L.265:
+	lw	$13, 7($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.262
+	la	$13, L.269
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	jalr	$13
+L.261:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.269:
+	.asciiz	"\n"
+L.266:
+	.asciiz	"0x%08x "
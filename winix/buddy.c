@@ -0,0 +1,294 @@
+/**
+ * Binary buddy page allocator
+ *
+ * Free pages are kept as naturally aligned blocks of 2^order pages, one
+ * free list per order. The first page of a free block records its order,
+ * so the buddy of a block is found by flipping the order bit of its index.
+ * The allocator keeps the page bitmap (mem_map) in sync, so that the
+ * bitmap still describes every used page for reports and lookups.
+ *
+ * Requests that are not a power of two take the smallest block that fits
+ * and give the unused pages back. GFP_HIGH requests take the highest
+ * block and keep the top pages of it, normal requests take the lowest
+ * block of the best fitting order and keep the bottom pages, which
+ * preserves the old high/normal zones. If no block is big enough but a long enough unaligned run of
+ * free pages exists, the run is carved out of the free lists.
+*/
+#include <kernel/kernel.h>
+#include <winix/gfp.h>
+#include <winix/buddy.h>
+
+#define ORDER_PAGES(order)      (1 << (order))
+
+/**
+ * smallest order whose block holds num pages
+ * @param  num 
+ * @return     
+ */
+static int order_of(int num){
+    int order = 0;
+    while(ORDER_PAGES(order) < num)
+        order++;
+    return order;
+}
+
+static void add_block(struct buddy_pool *pool, int page, int order){
+    struct list_head *entry = &pool->pages[page].list;
+    struct list_head *head = &pool->free_area[order];
+
+    pool->pages[page].order = order;
+    list_add(entry, head);
+    pool->nr_free[order]++;
+}
+
+static void remove_block(struct buddy_pool *pool, int page){
+    struct list_head *entry = &pool->pages[page].list;
+
+    pool->nr_free[pool->pages[page].order]--;
+    pool->pages[page].order = BUDDY_NOT_FREE;
+    list_del(entry);
+}
+
+/**
+ * put a free block on its list, merging it with its buddies
+ * @param pool  
+ * @param page  first page of the block
+ * @param order 
+ */
+static void free_block(struct buddy_pool *pool, int page, int order){
+    int buddy;
+
+    while(order < pool->max_order){
+        buddy = page ^ ORDER_PAGES(order);
+        if(buddy + ORDER_PAGES(order) > pool->nr_pages)
+            break;
+        if(pool->pages[buddy].order != order)
+            break;
+        remove_block(pool, buddy);
+        if(buddy < page)
+            page = buddy;
+        order++;
+    }
+    add_block(pool, page, order);
+}
+
+/**
+ * give the pages [start, end) to the free lists as aligned blocks
+ * @param pool  
+ * @param start 
+ * @param end   
+ */
+static void free_range(struct buddy_pool *pool, int start, int end){
+    int order;
+
+    while(start < end){
+        order = 0;
+        while(order < pool->max_order
+                && (start & (ORDER_PAGES(order + 1) - 1)) == 0
+                && start + ORDER_PAGES(order + 1) <= end)
+            order++;
+        free_block(pool, start, order);
+        start += ORDER_PAGES(order);
+    }
+}
+
+/**
+ * find the free block containing the given free page
+ * @param  pool 
+ * @param  page 
+ * @return      first page of the block, or -1 if page is not free
+ */
+static int find_block(struct buddy_pool *pool, int page){
+    int order, head;
+
+    for(order = 0; order <= pool->max_order; order++){
+        head = page & ~(ORDER_PAGES(order) - 1);
+        if(pool->pages[head].order >= order)
+            return head;
+    }
+    return -1;
+}
+
+/**
+ * remove the free pages [start, end) from the free lists, splitting the
+ * blocks around them
+ * @param pool  
+ * @param start 
+ * @param end   
+ */
+static void carve_range(struct buddy_pool *pool, int start, int end){
+    int head, block_end;
+
+    while(start < end){
+        head = find_block(pool, start);
+        block_end = head + ORDER_PAGES(pool->pages[head].order);
+        remove_block(pool, head);
+        free_range(pool, head, start);
+        if(block_end > end){
+            free_range(pool, end, block_end);
+            block_end = end;
+        }
+        start = block_end;
+    }
+}
+
+/**
+ * choose the free block for a request of the given order. Normal requests
+ * take the lowest block of the smallest order that fits, GFP_HIGH requests
+ * take the highest block of any order that fits, so that they stay packed
+ * at the top of memory
+ * @param  pool  
+ * @param  order 
+ * @param  flags 
+ * @return       first page of the block, or -1
+ */
+static int pick_block(struct buddy_pool *pool, int order, int flags){
+    struct buddy_page *bp;
+    int page, best = -1;
+
+    for(; order <= pool->max_order; order++){
+        list_for_each_entry(struct buddy_page, bp, &pool->free_area[order], list){
+            page = bp - pool->pages;
+            if(best < 0 || ((flags & GFP_HIGH) ? page > best : page < best))
+                best = page;
+        }
+        if(best >= 0 && !(flags & GFP_HIGH))
+            break;
+    }
+    return best;
+}
+
+/**
+ * initialise the allocator, every clear bit in map becomes a free page
+ * @param  pool     
+ * @param  pages    one entry per page
+ * @param  nr_pages 
+ * @param  map      page bitmap covering at least nr_pages
+ * @return          
+ */
+int buddy_init(struct buddy_pool *pool, struct buddy_page *pages, int nr_pages, struct hbitmap *map){
+    int i, start;
+
+    if(nr_pages <= 0 || nr_pages > map->map_len * 32)
+        return -EINVAL;
+
+    pool->pages = pages;
+    pool->nr_pages = nr_pages;
+    pool->map = map;
+    pool->max_order = 0;
+    while(pool->max_order < BUDDY_NR_ORDERS - 1 && ORDER_PAGES(pool->max_order + 1) <= nr_pages)
+        pool->max_order++;
+    for(i = 0; i < BUDDY_NR_ORDERS; i++){
+        INIT_LIST_HEAD(&pool->free_area[i]);
+        pool->nr_free[i] = 0;
+    }
+    for(i = 0; i < nr_pages; i++)
+        pages[i].order = BUDDY_NOT_FREE;
+
+    for(i = 0; i < nr_pages; ){
+        if(is_bit_on(map->map, map->map_len, i)){
+            i++;
+            continue;
+        }
+        start = i;
+        while(i < nr_pages && !is_bit_on(map->map, map->map_len, i))
+            i++;
+        free_range(pool, start, i);
+    }
+    return 0;
+}
+
+/**
+ * find where a request for num pages would be placed, without allocating
+ * @param  pool  
+ * @param  num   number of pages
+ * @param  flags GFP_HIGH or GFP_NORM
+ * @return       first page, or -ENOMEM
+ */
+int buddy_peek(struct buddy_pool *pool, int num, int flags){
+    int order, head;
+
+    if(num <= 0)
+        return -EINVAL;
+    order = order_of(num);
+    if(order <= pool->max_order){
+        head = pick_block(pool, order, flags);
+        if(head >= 0){
+            if(flags & GFP_HIGH)
+                head += ORDER_PAGES(pool->pages[head].order) - num;
+            return head;
+        }
+    }
+    if(flags & GFP_HIGH)
+        head = hbitmap_search_reverse(pool->map, num);
+    else
+        head = hbitmap_search_from(pool->map, 0, num);
+    if(head < 0 || head + num > pool->nr_pages)
+        return -ENOMEM;
+    return head;
+}
+
+/**
+ * allocate num contiguous pages
+ * @param  pool  
+ * @param  num   number of pages
+ * @param  flags GFP_HIGH or GFP_NORM
+ * @return       first page, or -ENOMEM
+ */
+int buddy_alloc(struct buddy_pool *pool, int num, int flags){
+    int start = buddy_peek(pool, num, flags);
+
+    if(start < 0)
+        return start;
+    carve_range(pool, start, start + num);
+    hbitmap_set_nbits(pool->map, start, num);
+    return start;
+}
+
+/**
+ * allocate the pages [start, start + num), all of which must be free
+ * @param  pool  
+ * @param  start 
+ * @param  num   
+ * @return       0 on success, or -ENOMEM
+ */
+int buddy_alloc_at(struct buddy_pool *pool, int start, int num){
+    int i;
+
+    if(start < 0 || num <= 0 || start + num > pool->nr_pages)
+        return -ENOMEM;
+    for(i = start; i < start + num; i++){
+        if(is_bit_on(pool->map->map, pool->map->map_len, i))
+            return -ENOMEM;
+    }
+    carve_range(pool, start, start + num);
+    return hbitmap_set_nbits(pool->map, start, num);
+}
+
+/**
+ * release the pages [start, start + num), pages already free are ignored
+ * @param  pool  
+ * @param  start 
+ * @param  num   
+ * @return       
+ */
+int buddy_free(struct buddy_pool *pool, int start, int num){
+    int i, run;
+    int end = start + num;
+
+    if(start < 0 || num < 0 || end > pool->nr_pages)
+        return -EINVAL;
+
+    for(i = start; i < end; ){
+        if(!is_bit_on(pool->map->map, pool->map->map_len, i)){
+            i++;
+            continue;
+        }
+        run = i;
+        while(i < end && is_bit_on(pool->map->map, pool->map->map_len, i))
+            i++;
+        hbitmap_clear_nbits(pool->map, run, i - run);
+        free_range(pool, run, i);
+    }
+    return 0;
+}
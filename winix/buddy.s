@@ -0,0 +1,961 @@
+.text
+order_of:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	addu	$7, $0, $0
+	j	L.11
+L.10:
+	addi	$7, $7, 1
+L.11:
+	addui	$13, $0, 1
+	sll	$13, $13, $7
+	lw	$12, 3($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.10
+	addu	$1, $0, $7
+L.9:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+add_block:
+	subui	$sp, $sp, 7
+	sw	$3, 0($sp)
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	addui	$13, $0, 3
+	lw	$12, 8($sp)
+	mult	$13, $13, $12
+	lw	$12, 7($sp)
+	lw	$12, 0($12)
+	addu	$6, $13, $12
+	lw	$13, 9($sp)
+	slli	$13, $13, 1
+	lw	$12, 7($sp)
+	addui	$12, $12, 4
+	addu	$7, $13, $12
+	addui	$13, $0, 3
+	lw	$12, 8($sp)
+	mult	$13, $13, $12
+	lw	$12, 7($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$12, 9($sp)
+	sw	$12, 2($13)
+L.14:
+L.17:
+	addu	$5, $0, $6
+	addu	$4, $0, $7
+	lw	$3, 0($7)
+	sw	$5, 1($3)
+	sw	$3, 0($5)
+	sw	$4, 1($5)
+	sw	$5, 0($4)
+L.18:
+L.15:
+	lw	$13, 9($sp)
+	lw	$12, 7($sp)
+	addui	$12, $12, 36
+	addu	$13, $13, $12
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.13:
+	lw	$3, 0($sp)
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+remove_block:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	addui	$13, $0, 3
+	lw	$12, 5($sp)
+	mult	$13, $13, $12
+	lw	$12, 4($sp)
+	lw	$12, 0($12)
+	addu	$7, $13, $12
+	lw	$13, 4($sp)
+	addui	$12, $0, 3
+	lw	$11, 5($sp)
+	mult	$12, $12, $11
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	lw	$12, 2($12)
+	addui	$13, $13, 36
+	addu	$13, $12, $13
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	addui	$13, $0, 3
+	lw	$12, 5($sp)
+	mult	$13, $13, $12
+	lw	$12, 4($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 2($13)
+L.21:
+L.24:
+L.27:
+	lw	$13, 0($7)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	lw	$13, 1($7)
+	lw	$12, 0($7)
+	sw	$12, 0($13)
+L.28:
+L.25:
+	sw	$0, 0($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 1($7)
+L.22:
+L.20:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+free_block:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	j	L.32
+L.31:
+	addui	$13, $0, 1
+	lw	$12, 9($sp)
+	sll	$13, $13, $12
+	lw	$12, 8($sp)
+	xor	$7, $12, $13
+	add	$13, $7, $13
+	lw	$12, 7($sp)
+	lw	$12, 1($12)
+	sle	$13, $13, $12
+	bnez	$13, L.34
+	j	L.33
+L.34:
+	addui	$13, $0, 3
+	mult	$13, $13, $7
+	lw	$12, 7($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$13, 2($13)
+	lw	$12, 9($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.36
+	j	L.33
+L.36:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	remove_block
+	lw	$13, 8($sp)
+	sge	$13, $7, $13
+	bnez	$13, L.38
+	sw	$7, 8($sp)
+L.38:
+	lw	$13, 9($sp)
+	addi	$13, $13, 1
+	sw	$13, 9($sp)
+L.32:
+	lw	$13, 9($sp)
+	lw	$12, 7($sp)
+	lw	$12, 2($12)
+	slt	$13, $13, $12
+	bnez	$13, L.31
+L.33:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	add_block
+L.30:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+free_range:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	j	L.42
+L.41:
+	addu	$7, $0, $0
+	j	L.45
+L.44:
+	addi	$7, $7, 1
+L.45:
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	sge	$13, $7, $13
+	bnez	$13, L.48
+	lw	$13, 10($sp)
+	sw	$13, 8($sp)
+	addui	$12, $0, 1
+	addi	$11, $7, 1
+	sll	$12, $12, $11
+	subi	$11, $12, 1
+	and	$11, $13, $11
+	sne	$13, $11, $0
+	bnez	$13, L.48
+	lw	$13, 8($sp)
+	add	$13, $13, $12
+	lw	$12, 11($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.44
+L.48:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	free_block
+	lw	$13, 10($sp)
+	addui	$12, $0, 1
+	sll	$12, $12, $7
+	add	$13, $13, $12
+	sw	$13, 10($sp)
+L.42:
+	lw	$13, 10($sp)
+	lw	$12, 11($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.41
+L.40:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+find_block:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	addu	$7, $0, $0
+	j	L.53
+L.50:
+	addui	$13, $0, 1
+	lw	$12, 5($sp)
+	sll	$13, $13, $7
+	subi	$13, $13, 1
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	and	$6, $12, $13
+	addui	$13, $0, 3
+	mult	$13, $13, $6
+	lw	$12, 4($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$13, 2($13)
+	slt	$13, $13, $7
+	bnez	$13, L.54
+	addu	$1, $0, $6
+	j	L.49
+L.54:
+L.51:
+	addi	$7, $7, 1
+L.53:
+	lw	$13, 4($sp)
+	lw	$13, 2($13)
+	sle	$13, $7, $13
+	bnez	$13, L.50
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+L.49:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+carve_range:
+	subui	$sp, $sp, 10
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$10, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	j	L.58
+L.57:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	find_block
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 10($sp)
+	addui	$12, $0, 1
+	addui	$11, $0, 3
+	mult	$11, $11, $7
+	lw	$10, 0($13)
+	addu	$11, $11, $10
+	lw	$11, 2($11)
+	sll	$12, $12, $11
+	add	$6, $7, $12
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	remove_block
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	jal	free_range
+	lw	$13, 12($sp)
+	sle	$13, $6, $13
+	bnez	$13, L.60
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	free_range
+	lw	$6, 12($sp)
+L.60:
+	sw	$6, 11($sp)
+L.58:
+	lw	$13, 11($sp)
+	lw	$12, 12($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.57
+L.56:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$10, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+pick_block:
+	subui	$sp, $sp, 10
+	sw	$2, 0($sp)
+	sw	$3, 1($sp)
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffff
+	j	L.66
+L.63:
+	lw	$13, 11($sp)
+	slli	$13, $13, 1
+	lw	$12, 10($sp)
+	addui	$12, $12, 4
+	addu	$13, $13, $12
+	lw	$7, 0($13)
+	j	L.70
+L.67:
+	addu	$13, $0, $7
+	lw	$12, 10($sp)
+	lw	$12, 0($12)
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$13, $0, $13
+	divi	$5, $13, 3
+	addu	$13, $0, $0
+	sw	$13, 9($sp)
+	slt	$13, $6, $13
+	bnez	$13, L.76
+	lw	$13, 12($sp)
+	andi	$13, $13, 2
+	lw	$12, 9($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.77
+	sle	$13, $5, $6
+	bnez	$13, L.79
+	addui	$3, $0, 1
+	j	L.80
+L.79:
+	addu	$3, $0, $0
+L.80:
+	addu	$4, $0, $3
+	j	L.78
+L.77:
+	sge	$13, $5, $6
+	bnez	$13, L.81
+	addui	$2, $0, 1
+	j	L.82
+L.81:
+	addu	$2, $0, $0
+L.82:
+	addu	$4, $0, $2
+L.78:
+	seq	$13, $4, $0
+	bnez	$13, L.71
+L.76:
+	addu	$6, $0, $5
+L.71:
+L.68:
+	lw	$7, 0($7)
+L.70:
+	addu	$13, $0, $7
+	lw	$12, 11($sp)
+	slli	$12, $12, 1
+	lw	$11, 10($sp)
+	addui	$11, $11, 4
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.67
+	addu	$13, $0, $0
+	sw	$13, 9($sp)
+	slt	$13, $6, $13
+	bnez	$13, L.83
+	lw	$13, 12($sp)
+	andi	$13, $13, 2
+	lw	$12, 9($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.83
+	j	L.65
+L.83:
+L.64:
+	lw	$13, 11($sp)
+	addi	$13, $13, 1
+	sw	$13, 11($sp)
+L.66:
+	lw	$13, 11($sp)
+	lw	$12, 10($sp)
+	lw	$12, 2($12)
+	sle	$13, $13, $12
+	bnez	$13, L.63
+L.65:
+	addu	$1, $0, $6
+L.62:
+	lw	$2, 0($sp)
+	lw	$3, 1($sp)
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	buddy_init
+buddy_init:
+	subui	$sp, $sp, 10
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 12($sp)
+	sw	$13, 9($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.88
+	lw	$13, 13($sp)
+	lw	$13, 1($13)
+	slli	$13, $13, 5
+	lw	$12, 9($sp)
+	sle	$13, $12, $13
+	bnez	$13, L.86
+L.88:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.85
+L.86:
+	lw	$13, 10($sp)
+	lw	$12, 11($sp)
+	sw	$12, 0($13)
+	lw	$13, 10($sp)
+	lw	$12, 12($sp)
+	sw	$12, 1($13)
+	lw	$13, 10($sp)
+	lw	$12, 13($sp)
+	sw	$12, 3($13)
+	lw	$13, 10($sp)
+	sw	$0, 2($13)
+	j	L.90
+L.89:
+	lw	$13, 10($sp)
+	addui	$13, $13, 2
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.90:
+	lw	$13, 10($sp)
+	lw	$13, 2($13)
+	sw	$13, 8($sp)
+	sgei	$13, $13, 15
+	bnez	$13, L.92
+	addui	$13, $0, 1
+	lw	$12, 8($sp)
+	addi	$12, $12, 1
+	sll	$13, $13, $12
+	lw	$12, 12($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.89
+L.92:
+	addu	$7, $0, $0
+L.93:
+L.97:
+	slli	$13, $7, 1
+	lw	$12, 10($sp)
+	addui	$12, $12, 4
+	addu	$13, $13, $12
+	sw	$13, 0($13)
+	slli	$13, $7, 1
+	lw	$12, 10($sp)
+	addui	$12, $12, 4
+	addu	$13, $13, $12
+	sw	$13, 1($13)
+L.98:
+	lw	$13, 10($sp)
+	addui	$13, $13, 36
+	addu	$13, $7, $13
+	sw	$0, 0($13)
+L.94:
+	addi	$7, $7, 1
+	slti	$13, $7, 16
+	bnez	$13, L.93
+	addu	$7, $0, $0
+	j	L.103
+L.100:
+	addui	$13, $0, 3
+	mult	$13, $13, $7
+	lw	$12, 11($sp)
+	addu	$13, $13, $12
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 2($13)
+L.101:
+	addi	$7, $7, 1
+L.103:
+	lw	$13, 12($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.100
+	addu	$7, $0, $0
+	j	L.107
+L.104:
+	lw	$13, 13($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.108
+	addi	$7, $7, 1
+	j	L.105
+L.108:
+	addu	$6, $0, $7
+	j	L.111
+L.110:
+	addi	$7, $7, 1
+L.111:
+	lw	$13, 12($sp)
+	sge	$13, $7, $13
+	bnez	$13, L.113
+	lw	$13, 13($sp)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.110
+L.113:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	jal	free_range
+L.105:
+L.107:
+	lw	$13, 12($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.104
+	addu	$1, $0, $0
+L.85:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	buddy_peek
+buddy_peek:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	sgt	$13, $13, $0
+	bnez	$13, L.115
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.114
+L.115:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	jal	order_of
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	lw	$12, 9($sp)
+	lw	$12, 2($12)
+	sgt	$13, $13, $12
+	bnez	$13, L.117
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	jal	pick_block
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	slt	$13, $7, $0
+	bnez	$13, L.119
+	lw	$13, 11($sp)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.121
+	addui	$13, $0, 1
+	addui	$12, $0, 3
+	mult	$12, $12, $7
+	lw	$11, 9($sp)
+	lw	$11, 0($11)
+	addu	$12, $12, $11
+	lw	$12, 2($12)
+	sll	$13, $13, $12
+	lw	$12, 10($sp)
+	sub	$13, $13, $12
+	add	$7, $7, $13
+L.121:
+	addu	$1, $0, $7
+	j	L.114
+L.119:
+L.117:
+	lw	$13, 11($sp)
+	andi	$13, $13, 2
+	seq	$13, $13, $0
+	bnez	$13, L.123
+	lw	$13, 9($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	hbitmap_search_reverse
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.124
+L.123:
+	lw	$13, 9($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	hbitmap_search_from
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.124:
+	slt	$13, $7, $0
+	bnez	$13, L.127
+	lw	$13, 10($sp)
+	add	$13, $7, $13
+	lw	$12, 9($sp)
+	lw	$12, 1($12)
+	sle	$13, $13, $12
+	bnez	$13, L.125
+L.127:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.114
+L.125:
+	addu	$1, $0, $7
+L.114:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	buddy_alloc
+buddy_alloc:
+	subui	$sp, $sp, 6
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	jal	buddy_peek
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	sge	$13, $7, $0
+	bnez	$13, L.129
+	addu	$1, $0, $7
+	j	L.128
+L.129:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 7($sp)
+	add	$13, $7, $13
+	sw	$13, 2($sp)
+	jal	carve_range
+	lw	$13, 6($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	hbitmap_set_nbits
+	addu	$1, $0, $7
+L.128:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	buddy_alloc_at
+buddy_alloc_at:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 10($sp)
+	sw	$13, 8($sp)
+	addu	$12, $0, $0
+	slt	$13, $13, $12
+	bnez	$13, L.135
+	lw	$13, 11($sp)
+	sw	$13, 7($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.135
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	add	$13, $13, $12
+	lw	$12, 9($sp)
+	lw	$12, 1($12)
+	sle	$13, $13, $12
+	bnez	$13, L.132
+L.135:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.131
+L.132:
+	lw	$7, 10($sp)
+	j	L.139
+L.136:
+	lw	$13, 9($sp)
+	lw	$13, 3($13)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.140
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.131
+L.140:
+L.137:
+	addi	$7, $7, 1
+L.139:
+	lw	$13, 10($sp)
+	lw	$12, 11($sp)
+	add	$13, $13, $12
+	slt	$13, $7, $13
+	bnez	$13, L.136
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	lw	$12, 11($sp)
+	add	$13, $13, $12
+	sw	$13, 2($sp)
+	jal	carve_range
+	lw	$13, 9($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	lw	$13, 11($sp)
+	sw	$13, 2($sp)
+	jal	hbitmap_set_nbits
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.131:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	buddy_free
+buddy_free:
+	subui	$sp, $sp, 10
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 11($sp)
+	lw	$12, 12($sp)
+	add	$6, $13, $12
+	addu	$13, $0, $0
+	sw	$13, 9($sp)
+	lw	$12, 11($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.146
+	lw	$13, 12($sp)
+	lw	$12, 9($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.146
+	lw	$13, 10($sp)
+	lw	$13, 1($13)
+	sle	$13, $6, $13
+	bnez	$13, L.143
+L.146:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.142
+L.143:
+	lw	$7, 11($sp)
+	j	L.150
+L.147:
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.151
+	addi	$7, $7, 1
+	j	L.148
+L.151:
+	addu	$5, $0, $7
+	j	L.154
+L.153:
+	addi	$7, $7, 1
+L.154:
+	sge	$13, $7, $6
+	bnez	$13, L.156
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	lw	$12, 0($13)
+	sw	$12, 0($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.153
+L.156:
+	lw	$13, 10($sp)
+	lw	$13, 3($13)
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	sub	$13, $7, $5
+	sw	$13, 2($sp)
+	jal	hbitmap_clear_nbits
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	sw	$5, 1($sp)
+	sw	$7, 2($sp)
+	jal	free_range
+L.148:
+L.150:
+	slt	$13, $7, $6
+	bnez	$13, L.147
+	addu	$1, $0, $0
+L.142:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
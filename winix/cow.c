@@ -0,0 +1,146 @@
+/**
+ * Deferred page copies for fork
+ *
+ * WRAMP has no read only pages, so a forked image can not be shared and
+ * copied on write. Instead the child gets its own pages at fork, but the
+ * copy into each of them is deferred until either side first touches the
+ * page. The table records, for every page, which page it still has to
+ * receive a copy from, and how many pages still wait for a copy of it.
+ *
+ * A page that waits for a copy may itself be shared by another fork, the
+ * new page then waits for the original source instead, so chains never
+ * form. The caller keeps both sides of a pending copy inaccessible and
+ * resolves the page before it is accessed again.
+*/
+#include <kernel/kernel.h>
+#include <winix/cow.h>
+
+#define IS_PAGE_OK(table, page)     ((page) >= 0 && (page) < (table)->nr_pages)
+
+int cow_init(struct cow_table *table, int *src, int *refs, int nr_pages, void (*copy)(int dest, int src)){
+    int i;
+    if(nr_pages <= 0 || !copy)
+        return -EINVAL;
+    table->src = src;
+    table->refs = refs;
+    table->nr_pages = nr_pages;
+    table->copy = copy;
+    for(i = 0; i < nr_pages; i++){
+        src[i] = COW_NONE;
+        refs[i] = 0;
+    }
+    return 0;
+}
+
+/**
+ * pages dest .. dest + num - 1 will receive a copy of src .. src + num - 1
+ * on first access
+ * @param  table
+ * @param  dest
+ * @param  src
+ * @param  num
+ * @return
+ */
+int cow_share(struct cow_table *table, int dest, int src, int num){
+    int i, from;
+
+    if(num <= 0 || !IS_PAGE_OK(table, dest) || !IS_PAGE_OK(table, src)
+        || !IS_PAGE_OK(table, dest + num - 1) || !IS_PAGE_OK(table, src + num - 1))
+        return -EINVAL;
+    for(i = 0; i < num; i++){
+        if(cow_is_pending(table, dest + i))
+            return -EINVAL;
+    }
+    for(i = 0; i < num; i++){
+        from = table->src[src + i];
+        if(from == COW_NONE)
+            from = src + i;
+        table->src[dest + i] = from;
+        table->refs[from]++;
+    }
+    return 0;
+}
+
+/**
+ * copy the given page into every page waiting for it
+ * @param  table
+ * @param  page
+ * @return       number of pages copied
+ */
+static int push_copies(struct cow_table *table, int page){
+    int i, copied = 0;
+
+    for(i = 0; i < table->nr_pages && table->refs[page] > 0; i++){
+        if(table->src[i] == page){
+            table->copy(i, page);
+            table->src[i] = COW_NONE;
+            table->refs[page]--;
+            copied++;
+        }
+    }
+    return copied;
+}
+
+/**
+ * complete every pending copy involving the page, so that it can be
+ * accessed and modified freely
+ * @param  table
+ * @param  page
+ * @return       number of pages copied, or negative errno
+ */
+int cow_resolve(struct cow_table *table, int page){
+    int from;
+
+    if(!IS_PAGE_OK(table, page))
+        return -EINVAL;
+    from = table->src[page];
+    if(from != COW_NONE){
+        table->copy(page, from);
+        table->src[page] = COW_NONE;
+        table->refs[from]--;
+        return 1;
+    }
+    return push_copies(table, page);
+}
+
+/**
+ * the page is about to be freed. A pending copy into it is dropped. If other
+ * pages still wait for its content, the first of them receives the copy
+ * and the rest wait for that one instead
+ * @param  table
+ * @param  page
+ * @return       number of pages copied, or negative errno
+ */
+int cow_release(struct cow_table *table, int page){
+    int i, heir = COW_NONE;
+
+    if(!IS_PAGE_OK(table, page))
+        return -EINVAL;
+    if(table->src[page] != COW_NONE){
+        table->refs[table->src[page]]--;
+        table->src[page] = COW_NONE;
+        return 0;
+    }
+    if(table->refs[page] == 0)
+        return 0;
+    for(i = 0; i < table->nr_pages; i++){
+        if(table->src[i] != page)
+            continue;
+        if(heir == COW_NONE){
+            heir = i;
+            table->copy(i, page);
+            table->src[i] = COW_NONE;
+        }else{
+            table->src[i] = heir;
+            table->refs[heir]++;
+        }
+    }
+    table->refs[page] = 0;
+    return 1;
+}
+
+bool cow_is_pending(struct cow_table *table, int page){
+    if(!IS_PAGE_OK(table, page))
+        return false;
+    return table->src[page] != COW_NONE || table->refs[page] > 0;
+}
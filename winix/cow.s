@@ -0,0 +1,518 @@
+.global	cow_init
+.text
+cow_init:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, 6($sp)
+	sle	$13, $13, $0
+	bnez	$13, L.12
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.10
+L.12:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.9
+L.10:
+	lw	$13, 3($sp)
+	lw	$12, 4($sp)
+	sw	$12, 0($13)
+	lw	$13, 3($sp)
+	lw	$12, 5($sp)
+	sw	$12, 1($13)
+	lw	$13, 3($sp)
+	lw	$12, 6($sp)
+	sw	$12, 2($13)
+	lw	$13, 3($sp)
+	lw	$12, 7($sp)
+	sw	$12, 3($13)
+	addu	$7, $0, $0
+	j	L.16
+L.13:
+	lw	$13, 4($sp)
+	addu	$13, $7, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 0($13)
+	lw	$13, 5($sp)
+	addu	$13, $7, $13
+	sw	$0, 0($13)
+L.14:
+	addi	$7, $7, 1
+L.16:
+	lw	$13, 6($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.13
+	addu	$1, $0, $0
+L.9:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	cow_share
+cow_share:
+	subui	$sp, $sp, 14
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 17($sp)
+	sw	$13, 13($sp)
+	addu	$12, $0, $0
+	sle	$13, $13, $12
+	bnez	$13, L.24
+	lw	$13, 15($sp)
+	sw	$13, 12($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.24
+	lw	$13, 14($sp)
+	lw	$13, 2($13)
+	sw	$13, 11($sp)
+	lw	$11, 12($sp)
+	sge	$13, $11, $13
+	bnez	$13, L.24
+	lw	$13, 16($sp)
+	sw	$13, 10($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.24
+	lw	$13, 11($sp)
+	lw	$11, 10($sp)
+	sge	$13, $11, $13
+	bnez	$13, L.24
+	lw	$13, 13($sp)
+	lw	$11, 12($sp)
+	add	$13, $11, $13
+	subi	$13, $13, 1
+	sw	$13, 9($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.24
+	lw	$13, 11($sp)
+	lw	$11, 9($sp)
+	sge	$13, $11, $13
+	bnez	$13, L.24
+	lw	$13, 13($sp)
+	lw	$11, 10($sp)
+	add	$13, $11, $13
+	subi	$13, $13, 1
+	sw	$13, 8($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.24
+	lw	$13, 11($sp)
+	lw	$12, 8($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.18
+L.24:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.17
+L.18:
+	addu	$7, $0, $0
+	j	L.28
+L.25:
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	add	$13, $13, $7
+	sw	$13, 1($sp)
+	jal	cow_is_pending
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.29
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.17
+L.29:
+L.26:
+	addi	$7, $7, 1
+L.28:
+	lw	$13, 17($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.25
+	addu	$7, $0, $0
+	j	L.34
+L.31:
+	lw	$13, 16($sp)
+	add	$13, $13, $7
+	lw	$12, 14($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$6, 0($13)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sne	$13, $6, $13
+	bnez	$13, L.35
+	lw	$13, 16($sp)
+	add	$6, $13, $7
+L.35:
+	lw	$13, 15($sp)
+	add	$13, $13, $7
+	lw	$12, 14($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	sw	$6, 0($13)
+	lw	$13, 14($sp)
+	lw	$13, 1($13)
+	addu	$13, $6, $13
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.32:
+	addi	$7, $7, 1
+L.34:
+	lw	$13, 17($sp)
+	slt	$13, $7, $13
+	bnez	$13, L.31
+	addu	$1, $0, $0
+L.17:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+push_copies:
+	subui	$sp, $sp, 8
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addu	$6, $0, $0
+	addu	$7, $0, $0
+	j	L.41
+L.38:
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	lw	$12, 9($sp)
+	sne	$13, $13, $12
+	bnez	$13, L.42
+	sw	$7, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	lw	$13, 3($13)
+	jalr	$13
+	lw	$13, 8($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	lw	$12, 8($sp)
+	lw	$12, 1($12)
+	addu	$13, $13, $12
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	addi	$6, $6, 1
+L.42:
+L.39:
+	addi	$7, $7, 1
+L.41:
+	lw	$13, 8($sp)
+	sw	$13, 7($sp)
+	lw	$12, 2($13)
+	sge	$13, $7, $12
+	bnez	$13, L.44
+	lw	$13, 9($sp)
+	lw	$12, 7($sp)
+	lw	$12, 1($12)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sgt	$13, $13, $0
+	bnez	$13, L.38
+L.44:
+	addu	$1, $0, $6
+L.37:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	cow_resolve
+cow_resolve:
+	subui	$sp, $sp, 7
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	sw	$13, 6($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.48
+	lw	$13, 7($sp)
+	lw	$13, 2($13)
+	lw	$12, 6($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.46
+L.48:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.45
+L.46:
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$7, 0($13)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	seq	$13, $7, $13
+	bnez	$13, L.49
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	lw	$13, 7($sp)
+	lw	$13, 3($13)
+	jalr	$13
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	lw	$13, 1($13)
+	addu	$13, $7, $13
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	addui	$1, $0, 1
+	j	L.45
+L.49:
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	push_copies
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.45:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	cow_release
+cow_release:
+	subui	$sp, $sp, 9
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lhi	$6, 0xffff
+	ori	$6, $6, 0xffff
+	lw	$13, 10($sp)
+	sw	$13, 8($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.54
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	lw	$12, 8($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.52
+L.54:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.51
+L.52:
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	seq	$13, $13, $12
+	bnez	$13, L.55
+	lw	$13, 9($sp)
+	lw	$12, 10($sp)
+	lw	$11, 0($13)
+	addu	$12, $12, $11
+	lw	$12, 0($12)
+	lw	$13, 1($13)
+	addu	$13, $12, $13
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	lw	$12, 0($12)
+	addu	$13, $13, $12
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 0($13)
+	addu	$1, $0, $0
+	j	L.51
+L.55:
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	lw	$12, 1($12)
+	addu	$13, $13, $12
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.57
+	addu	$1, $0, $0
+	j	L.51
+L.57:
+	addu	$7, $0, $0
+	j	L.62
+L.59:
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lw	$13, 0($13)
+	lw	$12, 10($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.63
+	j	L.60
+L.63:
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	sne	$13, $6, $13
+	bnez	$13, L.65
+	addu	$6, $0, $7
+	sw	$7, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	lw	$13, 3($13)
+	jalr	$13
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	sw	$12, 0($13)
+	j	L.66
+L.65:
+	lw	$13, 9($sp)
+	lw	$13, 0($13)
+	addu	$13, $7, $13
+	sw	$6, 0($13)
+	lw	$13, 9($sp)
+	lw	$13, 1($13)
+	addu	$13, $6, $13
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+L.66:
+L.60:
+	addi	$7, $7, 1
+L.62:
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	slt	$13, $7, $13
+	bnez	$13, L.59
+	lw	$13, 10($sp)
+	lw	$12, 9($sp)
+	lw	$12, 1($12)
+	addu	$13, $13, $12
+	sw	$0, 0($13)
+	addui	$1, $0, 1
+L.51:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	cow_is_pending
+cow_is_pending:
+	subui	$sp, $sp, 7
+	sw	$7, 0($sp)
+	sw	$10, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 8($sp)
+	sw	$13, 6($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.70
+	lw	$13, 7($sp)
+	lw	$13, 2($13)
+	lw	$12, 6($sp)
+	slt	$13, $12, $13
+	bnez	$13, L.68
+L.70:
+	addu	$1, $0, $0
+	j	L.67
+L.68:
+	lw	$13, 8($sp)
+	sw	$13, 5($sp)
+	lw	$12, 7($sp)
+	lw	$11, 0($12)
+	addu	$11, $13, $11
+	lw	$11, 0($11)
+	lhi	$10, 0xffff
+	ori	$10, $10, 0xffff
+	sne	$13, $11, $10
+	bnez	$13, L.74
+	lw	$13, 1($12)
+	lw	$12, 5($sp)
+	addu	$13, $12, $13
+	lw	$13, 0($13)
+	sle	$13, $13, $0
+	bnez	$13, L.72
+L.74:
+	addui	$7, $0, 1
+	j	L.73
+L.72:
+	addu	$7, $0, $0
+L.73:
+	addu	$1, $0, $7
+L.67:
+	lw	$7, 0($sp)
+	lw	$10, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
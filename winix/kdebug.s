@@ -0,0 +1,247 @@
+_debug_sched:
+	.word	0x0
+_debug_ipc:
+	.word	0x0
+_debug_syscall:
+	.word	0x0
+_debug_timer:
+	.word	0x0
+.global	is_debugging_sched
+.text
+is_debugging_sched:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, _debug_sched($0)
+	sle	$13, $13, $0
+	bnez	$13, L.10
+	lw	$13, _debug_sched($0)
+	subi	$12, $13, 1
+	sw	$12, _debug_sched($0)
+	addu	$1, $0, $13
+	j	L.9
+L.10:
+	addu	$1, $0, $0
+L.9:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	is_debugging_ipc
+is_debugging_ipc:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, _debug_ipc($0)
+	sle	$13, $13, $0
+	bnez	$13, L.13
+	lw	$13, _debug_ipc($0)
+	subi	$12, $13, 1
+	sw	$12, _debug_ipc($0)
+	addu	$1, $0, $13
+	j	L.12
+L.13:
+	addu	$1, $0, $0
+L.12:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	is_debugging_timer
+is_debugging_timer:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, _debug_timer($0)
+	sle	$13, $13, $0
+	bnez	$13, L.16
+	lw	$13, _debug_timer($0)
+	subi	$12, $13, 1
+	sw	$12, _debug_timer($0)
+	addu	$1, $0, $13
+	j	L.15
+L.16:
+	addu	$1, $0, $0
+L.15:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	is_debugging_syscall
+is_debugging_syscall:
+	lw	$1, _debug_syscall($0)
+L.18:
+	jr	$ra
+.global	debug_scheduling
+debug_scheduling:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$13, _debug_sched($0)
+L.19:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	debug_ipc
+debug_ipc:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$13, _debug_ipc($0)
+L.20:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	debug_syscall
+debug_syscall:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, trace_syscall($0)
+L.21:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	debug_timer
+debug_timer:
+	subui	$sp, $sp, 1
+	sw	$13, 0($sp)
+	lw	$13, 1($sp)
+	sw	$13, _debug_timer($0)
+L.22:
+	lw	$13, 0($sp)
+	addui	$sp, $sp, 1
+	jr	$ra
+.global	stop_debug_scheduling
+stop_debug_scheduling:
+	sw	$0, _debug_sched($0)
+L.23:
+	jr	$ra
+.global	stop_debug_ipc
+stop_debug_ipc:
+	sw	$0, _debug_ipc($0)
+L.24:
+	jr	$ra
+.global	stop_debug_syscall
+stop_debug_syscall:
+	sw	$0, trace_syscall($0)
+L.25:
+	jr	$ra
+.global	kreport_readyqueue
+kreport_readyqueue:
+	subui	$sp, $sp, 6
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	la	$13, L.27
+	sw	$13, 0($sp)
+	jal	kprintf
+	addu	$6, $0, $0
+L.28:
+	slli	$13, $6, 1
+	lw	$7, ready_q($13)
+	j	L.33
+L.32:
+	la	$13, L.35
+	sw	$13, 0($sp)
+	lw	$13, 133($7)
+	sw	$13, 1($sp)
+	jal	kprintf
+	lw	$7, 80($7)
+L.33:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.32
+L.29:
+	addi	$6, $6, 1
+	slti	$13, $6, 6
+	bnez	$13, L.28
+	la	$13, L.36
+	sw	$13, 0($sp)
+	jal	kprintf
+L.26:
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	kreport_receiver_queue
+kreport_receiver_queue:
+	subui	$sp, $sp, 5
+	sw	$7, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$7, 65($13)
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.42
+	la	$13, L.40
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	lw	$13, 133($13)
+	sw	$13, 1($sp)
+	jal	kprintf
+	j	L.42
+L.41:
+	la	$13, L.35
+	sw	$13, 0($sp)
+	lw	$13, 133($7)
+	sw	$13, 1($sp)
+	jal	kprintf
+	lw	$7, 66($7)
+L.42:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.41
+L.37:
+	lw	$7, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	syscall_str 65
+.extern	syscall_table 65
+.extern	INIT_PATH 0
+.extern	init_argv 0
+.extern	boot_table 63
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.40:
+	.asciiz	" %d sending queue: "
+L.36:
+	.asciiz	"| \n"
+L.35:
+	.asciiz	"%d "
+L.27:
+	.asciiz	" q| "
@@ -11,7 +11,17 @@
  * physical address as the page, and calculate the length of page by words
  *
  * Internally mm uses bitmap utilities to search, set, unset bits and pages
- * in the system bitmap.
+ * in the system bitmap. The bitmap carries a summary level (struct hbitmap)
+ * so that searches skip fully used and fully free regions. Pages are
+ * handed out by the buddy allocator (winix/buddy.c), which keeps the
+ * bitmap up to date.
+ *
+ * Pages of a forked image are copied lazily (winix/cow.c). Both sides of a
+ * pending copy are kept out of the process's protection table until the
+ * page is resolved, either by a GPF on the page or by the kernel checking
+ * a user buffer through is_vaddr_ok() or resolve_user_pages(). Heap pages
+ * reserved by brk() are already allocated in the system bitmap, so no one
+ * else can take them, but they are only mapped and zeroed the same way.
  *
  * @author Bruce Tan
  * @email brucetansh@gmail.com
@@ -25,10 +35,107 @@
 #include <kernel/kernel.h>
 #include <winix/mm.h>
 #include <winix/bitmap.h>
+#include <winix/buddy.h>
+#include <winix/cow.h>
 
 PRIVATE unsigned int mem_map[MEM_MAP_LEN];
+PRIVATE unsigned int mem_map_full[HBITMAP_SUMMARY_LEN(MEM_MAP_LEN)];
+PRIVATE unsigned int mem_map_empty[HBITMAP_SUMMARY_LEN(MEM_MAP_LEN)];
+PRIVATE struct hbitmap mem_hmap;
+PRIVATE struct buddy_page mem_pages[MEM_MAP_LEN * 32];
+PRIVATE struct buddy_pool mem_pool;
+PRIVATE int cow_src[MEM_MAP_LEN * 32];
+PRIVATE int cow_refs[MEM_MAP_LEN * 32];
+PRIVATE struct cow_table cow_pages;
 PRIVATE int bss_page_end;
 
+PRIVATE void cow_copy_page(int dest, int src){
+    copy_page(PAGE_TO_PADDR(dest), PAGE_TO_PADDR(src));
+}
+
+/**
+ * map and zero a reserved heap page past heap_bottom. The page is mapped
+ * for every process sharing the image, so that no thread or vforked child
+ * claims it again and wipes it
+ * @param  who   
+ * @param  page  
+ * @return       true if the page was claimed
+ */
+PRIVATE bool claim_heap_page(struct proc* who, int page){
+    struct proc* p;
+
+    foreach_proc(p){
+        if(p != who && p->mem_start == who->mem_start)
+            bitmap_set_bit((unsigned int *)p->ctx.ptable, PTABLE_LEN, page);
+    }
+    if(bitmap_set_bit((unsigned int *)who->ctx.ptable, PTABLE_LEN, page))
+        return false;
+    memset(PAGE_TO_PADDR(page), 0, PAGE_LEN);
+    return true;
+}
+
+/**
+ * resolve the pending copy of a page in the process image, or claim the
+ * page if it is in the reserved heap, and give the process access to it
+ * @param  who   
+ * @param  paddr 
+ * @return       true if the page was waiting to be resolved
+ */
+bool resolve_user_page(struct proc* who, ptr_t* paddr){
+    int page;
+
+    if(!IS_USER_PROC(who) || paddr < who->mem_start || paddr > who->heap_end)
+        return false;
+    page = PADDR_TO_PAGED(paddr);
+    if(is_bit_on((unsigned int *)who->ctx.ptable, PTABLE_LEN, page))
+        return false;
+    if(paddr > who->heap_bottom)
+        return claim_heap_page(who, page);
+    cow_resolve(&cow_pages, page);
+    bitmap_set_bit((unsigned int *)who->ctx.ptable, PTABLE_LEN, page);
+    return true;
+}
+
+/**
+ * resolve every pending page the kernel may touch in the given user buffer.
+ * Unlike is_vaddr_ok(), addresses outside the image are simply ignored
+ * @param who  
+ * @param addr 
+ * @param len  
+ * @return     0, or -EFAULT if a page of the image could not be resolved
+ */
+int resolve_user_pages(struct proc* who, vptr_t* addr, size_t len){
+    ptr_t *paddr, *paddr_end;
+
+    if(!IS_USER_PROC(who) || len == 0)
+        return 0;
+    paddr = get_physical_addr(addr, who);
+    paddr_end = paddr + len - 1;
+    if(paddr < who->mem_start)
+        paddr = who->mem_start;
+    if(paddr_end > who->heap_end)
+        paddr_end = who->heap_end;
+    for(; paddr <= paddr_end; paddr = PAGE_TO_PADDR(PADDR_TO_PAGED(paddr) + 1)){
+        resolve_user_page(who, paddr);
+        if(!is_bit_on((unsigned int *)who->ctx.ptable, PTABLE_LEN, PADDR_TO_PAGED(paddr)))
+            return -EFAULT;
+    }
+    return 0;
+}
+
+/**
+ * let the pages starting from dest receive a copy of the pages starting from
+ * src on first access, instead of copying them now. The caller clears the
+ * pages from the protection tables of every process using them
+ * @param  dest 
+ * @param  src  
+ * @param  len  
+ * @return      
+ */
+int defer_copy_pages(ptr_t* dest, ptr_t* src, int len){
+    return cow_share(&cow_pages, PADDR_TO_PAGED(dest), PADDR_TO_PAGED(src), PADDR_TO_NUM_PAGES(len));
+}
+
 /**
  * is the address accessible by the proc
  * @param  who  
@@ -40,6 +147,8 @@ bool is_vaddr_ok(vptr_t* addr, size_t len, struct proc* who){
     ptr_t* paddr, *paddr_end;
     bool ret = false;
 
+    if(resolve_user_pages(who, addr, len))
+        return false;
     paddr = get_physical_addr(addr, who);
     paddr_end = get_physical_addr(addr + len, who);
     start_page = PADDR_TO_PAGED(paddr);
@@ -94,14 +203,7 @@ bool is_pages_free_from(ptr_t* addr, int size){
  * @return int 
  */
 int peek_free_pages(int length, int flags){
-    int nstart;
-    int num = PADDR_TO_PAGED(length);
-    if(flags & GFP_HIGH){
-        nstart =  bitmap_search_reverse(mem_map, MEM_MAP_LEN, num);
-    }else{
-        nstart =  bitmap_search_from(mem_map, MEM_MAP_LEN, bss_page_end, num);
-    }
-    return nstart;
+    return buddy_peek(&mem_pool, PADDR_TO_NUM_PAGES(length), flags);
 }
 
 /**
@@ -111,12 +213,10 @@ int peek_free_pages(int length, int flags){
  * @return        pointer to the start of the page, or Null if failed
  */
 ptr_t *get_free_pages(int length, int flags) {
-    int num = PADDR_TO_NUM_PAGES(length);
-    int nstart = peek_free_pages(length, flags);
+    int nstart = buddy_alloc(&mem_pool, PADDR_TO_NUM_PAGES(length), flags);
     ptr_t *ret;
 
     if (nstart >= 0){
-        bitmap_set_nbits(mem_map, MEM_MAP_LEN, nstart, num);
         ret = PAGE_TO_PADDR(nstart);
         // klog("return 0x%x length %d\n", ret, length);
         return ret;
@@ -164,7 +264,7 @@ int get_free_pages_from(ptr_t* addr, int size){
         return -ENOMEM;
     paged = PADDR_TO_PAGED(addr);
     page_num = PADDR_TO_NUM_PAGES(size);
-    return bitmap_set_nbits(mem_map, MEM_MAP_LEN, paged, page_num);
+    return buddy_alloc_at(&mem_pool, paged, page_num);
 }
 
 /**
@@ -193,11 +293,11 @@ int user_get_free_pages_from(struct proc* who, ptr_t* addr, int size){
  * @return 
  */
 int peek_next_free_page(){
-    return bitmap_search_from(mem_map, MEM_MAP_LEN, bss_page_end,  1);
+    return hbitmap_search_from(&mem_hmap, bss_page_end,  1);
 }
 
 int peek_last_free_page(){
-    return bitmap_search_reverse(mem_map, MEM_MAP_LEN, 1);
+    return hbitmap_search_reverse(&mem_hmap, 1);
 }
 
 /**
@@ -207,12 +307,15 @@ int peek_last_free_page(){
  * @return      
  */
 int release_pages(ptr_t* page, int len){
-    int page_index, bitmaplen;
+    int page_index, bitmaplen, i;
     if((unsigned long)page % PAGE_LEN != 0)
         return -EINVAL;
     page_index = PADDR_TO_PAGED(page);
     bitmaplen = PADDR_TO_PAGED(len);
-    return bitmap_clear_nbits(mem_map, MEM_MAP_LEN, page_index, bitmaplen);
+    for(i = page_index; i < page_index + bitmaplen; i++){
+        cow_release(&cow_pages, i);
+    }
+    return buddy_free(&mem_pool, page_index, bitmaplen);
 }
 
 int user_release_pages(struct proc* who, ptr_t* page, int len){
@@ -226,18 +329,35 @@ int user_release_pages(struct proc* who, ptr_t* page, int len){
 
 /**
  * duplicate the virtual address from parent to child
- * The process image are not copied though
+ * The process image are not copied though, the heap the parent reserved
+ * past heap_bottom is reserved for the child as well, and the child is
+ * given the reserved pages the parent has claimed
  * @param parent 
  * @param child  
  * @param ptn    
  * return the new rbase of the child
  */
 void* dup_vm(struct proc* parent, struct proc* child){
-    int len;
+    int len, reserved, i, page, parent_page;
+    ptr_t* p;
 
     len = parent->heap_bottom + 1 - parent->mem_start;
+    reserved = parent->heap_end + 1 - parent->mem_start;
     
-    return user_get_free_pages(child, len, GFP_NORM);
+    p = get_free_pages(reserved, GFP_NORM);
+    if(p == NULL)
+        return NULL;
+    page = PADDR_TO_PAGED(p);
+    if(bitmap_set_nbits((unsigned int *)child->ctx.ptable, PTABLE_LEN, page, PADDR_TO_NUM_PAGES(len))){
+        release_pages(p, reserved);
+        return NULL;
+    }
+    parent_page = PADDR_TO_PAGED(parent->mem_start);
+    for(i = PADDR_TO_NUM_PAGES(len); i < PADDR_TO_NUM_PAGES(reserved); i++){
+        if(is_bit_on((unsigned int *)parent->ctx.ptable, PTABLE_LEN, parent_page + i))
+            bitmap_set_bit((unsigned int *)child->ctx.ptable, PTABLE_LEN, page + i);
+    }
+    return p;
 }
 
 /**
@@ -259,7 +379,7 @@ int release_proc_mem(struct proc *who){
 
     if (!IS_THREAD(who)){
         ptr_t* memstart = who->mem_start;
-        int page_len = (int)(who->heap_bottom + 1 - who->mem_start);
+        int page_len = (int)(who->heap_end + 1 - who->mem_start);
         ret = user_release_pages(who, memstart, page_len);
         // klog("release proc start 0x%x len %d of %s %d\n", memstart, page_len, who->name, who->proc_nr);
     }
@@ -285,6 +405,10 @@ void _kreport_sysmap(int (*func) (const char*, ...)){
         str = i == 0 ? free_str : used_str;
         func(" %s pages: %03d\t",str, pages, pages);
     }
+    func("\n Free blocks by order:");
+    for(i = 0; i <= mem_pool.max_order; i++){
+        func(" %d", mem_pool.nr_free[i]);
+    }
     func("\n");
 }
 
@@ -301,6 +425,9 @@ void init_mem_table() {
     bitmap_clear(mem_map, MEM_MAP_LEN);
     bitmap_set_nbits(mem_map, MEM_MAP_LEN, 0, len);
     bitmap_set_bit(mem_map, MEM_MAP_LEN, FREE_MEM_END / PAGE_LEN);
+    hbitmap_init(&mem_hmap, mem_map, MEM_MAP_LEN, mem_map_full, mem_map_empty);
+    buddy_init(&mem_pool, mem_pages, MEM_MAP_LEN * 32, &mem_hmap);
+    cow_init(&cow_pages, cow_src, cow_refs, MEM_MAP_LEN * 32, cow_copy_page);
     bss_page_end = PADDR_TO_PAGED(free_mem_begin);
 }
 
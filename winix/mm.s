@@ -0,0 +1,1267 @@
+.text
+cow_copy_page:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	slli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	slli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	memcpy
+L.9:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+claim_heap_page:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, proc_table($0)
+	addui	$7, $13, 236
+	j	L.14
+L.11:
+	lw	$13, 131($7)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.15
+	lw	$13, 9($sp)
+	sw	$13, 8($sp)
+	addu	$12, $0, $7
+	addu	$11, $0, $13
+	sequ	$13, $12, $11
+	bnez	$13, L.17
+	lw	$13, 21($7)
+	addu	$13, $0, $13
+	lw	$12, 8($sp)
+	lw	$12, 21($12)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.17
+	lw	$13, 17($7)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_set_bit
+L.17:
+L.15:
+L.12:
+	sw	$7, 0($sp)
+	jal	next_proc_slot
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.14:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.11
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	bitmap_set_bit
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.19
+	addu	$1, $0, $0
+	j	L.10
+L.19:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	slli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	memset
+	addui	$1, $0, 1
+L.10:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	resolve_user_page
+resolve_user_page:
+	subui	$sp, $sp, 9
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	sw	$13, 8($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.25
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	lw	$12, 8($sp)
+	lw	$12, 21($12)
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.25
+	lw	$13, 8($sp)
+	lw	$13, 27($13)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	sleu	$13, $12, $13
+	bnez	$13, L.22
+L.25:
+	addu	$1, $0, $0
+	j	L.21
+L.22:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$7, $0, $13
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.26
+	addu	$1, $0, $0
+	j	L.21
+L.26:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	lw	$12, 9($sp)
+	lw	$12, 26($12)
+	addu	$12, $0, $12
+	sleu	$13, $13, $12
+	bnez	$13, L.28
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	claim_heap_page
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+	j	L.21
+L.28:
+	la	$13, cow_pages
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	cow_resolve
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	bitmap_set_bit
+	addui	$1, $0, 1
+L.21:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	resolve_user_pages
+resolve_user_pages:
+	subui	$sp, $sp, 9
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 9($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.33
+	lw	$13, 11($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.31
+L.33:
+	addu	$1, $0, $0
+	j	L.30
+L.31:
+	lw	$13, 9($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	lw	$11, 10($sp)
+	addu	$7, $12, $11
+	lw	$12, 11($sp)
+	addu	$12, $12, $7
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xffff
+	addu	$6, $12, $11
+	addu	$12, $0, $7
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	sgeu	$13, $12, $13
+	bnez	$13, L.34
+	lw	$13, 9($sp)
+	lw	$7, 21($13)
+L.34:
+	addu	$13, $0, $6
+	lw	$12, 9($sp)
+	lw	$12, 27($12)
+	addu	$12, $0, $12
+	sleu	$13, $13, $12
+	bnez	$13, L.41
+	lw	$13, 9($sp)
+	lw	$6, 27($13)
+	j	L.41
+L.38:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	resolve_user_page
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	addu	$13, $0, $7
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.42
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff2
+	j	L.30
+L.42:
+L.39:
+	addu	$13, $0, $7
+	srli	$13, $13, 10
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	slli	$13, $13, 10
+	addu	$7, $0, $13
+L.41:
+	addu	$13, $0, $7
+	addu	$12, $0, $6
+	sleu	$13, $13, $12
+	bnez	$13, L.38
+	addu	$1, $0, $0
+L.30:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	defer_copy_pages
+defer_copy_pages:
+	subui	$sp, $sp, 7
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	la	$12, cow_pages
+	sw	$12, 0($sp)
+	lw	$12, 7($sp)
+	addu	$12, $0, $12
+	srli	$12, $12, 10
+	addu	$12, $0, $12
+	sw	$12, 1($sp)
+	lw	$12, 8($sp)
+	addu	$12, $0, $12
+	srli	$12, $12, 10
+	addu	$12, $0, $12
+	sw	$12, 2($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	cow_share
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.44:
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	is_vaddr_ok
+is_vaddr_ok:
+	subui	$sp, $sp, 12
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	addu	$6, $0, $0
+	lw	$13, 14($sp)
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.46
+	addu	$1, $0, $0
+	j	L.45
+L.46:
+	lw	$13, 14($sp)
+	addui	$13, $13, 16
+	lw	$12, 12($sp)
+	lw	$11, 0($13)
+	addu	$11, $0, $11
+	addu	$11, $11, $12
+	sw	$11, 11($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	lw	$11, 13($sp)
+	addu	$12, $11, $12
+	addu	$13, $13, $12
+	sw	$13, 10($sp)
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$7, $0, $13
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$5, $0, $13
+	j	L.51
+L.48:
+	lw	$13, 14($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sne	$13, $6, $0
+	bnez	$13, L.52
+	addu	$1, $0, $6
+	j	L.45
+L.52:
+L.49:
+	addi	$7, $7, 1
+L.51:
+	sle	$13, $7, $5
+	bnez	$13, L.48
+	addu	$1, $0, $6
+L.45:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	is_page_free
+is_page_free:
+	subui	$sp, $sp, 7
+	sw	$7, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 6($sp)
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	sw	$13, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.56
+	addui	$7, $0, 1
+	j	L.57
+L.56:
+	addu	$7, $0, $0
+L.57:
+	addu	$1, $0, $7
+L.54:
+	lw	$7, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	is_pages_free_from
+is_pages_free_from:
+	subui	$sp, $sp, 8
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$6, $0, $13
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$5, $0, $13
+	addu	$7, $0, $0
+	j	L.62
+L.59:
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.63
+	addu	$1, $0, $0
+	j	L.58
+L.63:
+	addi	$6, $6, 1
+L.60:
+	addi	$7, $7, 1
+L.62:
+	slt	$13, $7, $5
+	bnez	$13, L.59
+	addui	$1, $0, 1
+L.58:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	peek_free_pages
+peek_free_pages:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	la	$12, mem_pool
+	sw	$12, 0($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	buddy_peek
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.65:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	get_free_pages
+get_free_pages:
+	subui	$sp, $sp, 8
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	la	$12, mem_pool
+	sw	$12, 0($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	sw	$13, 2($sp)
+	jal	buddy_alloc
+	addu	$13, $0, $1
+	sw	$13, 7($sp)
+	lw	$13, 7($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.67
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	slli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 6($sp)
+	lw	$1, 6($sp)
+	j	L.66
+L.67:
+	addu	$1, $0, $0
+L.66:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	user_get_free_pages
+user_get_free_pages:
+	subui	$sp, $sp, 9
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	get_free_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.70
+	addu	$1, $0, $0
+	j	L.69
+L.70:
+	addu	$13, $0, $7
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	lw	$13, 7($sp)
+	sw	$13, 3($sp)
+	jal	bitmap_set_nbits
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.72
+	addu	$1, $0, $0
+	j	L.69
+L.72:
+	addu	$1, $0, $7
+L.69:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	get_free_pages_from
+get_free_pages_from:
+	subui	$sp, $sp, 7
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	jal	is_pages_free_from
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.75
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfff4
+	j	L.74
+L.75:
+	lw	$13, 7($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 6($sp)
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 5($sp)
+	la	$13, mem_pool
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	buddy_alloc_at
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.74:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	user_get_free_pages_from
+user_get_free_pages_from:
+	subui	$sp, $sp, 9
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	get_free_pages_from
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 8($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.78
+	lw	$1, 8($sp)
+	j	L.77
+L.78:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 6($sp)
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	lw	$13, 6($sp)
+	sw	$13, 3($sp)
+	jal	bitmap_set_nbits
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.77:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	peek_next_free_page
+peek_next_free_page:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, mem_hmap
+	sw	$13, 0($sp)
+	lw	$13, bss_page_end($0)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1
+	sw	$13, 2($sp)
+	jal	hbitmap_search_from
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.80:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	peek_last_free_page
+peek_last_free_page:
+	subui	$sp, $sp, 4
+	sw	$13, 2($sp)
+	sw	$ra, 3($sp)
+	la	$13, mem_hmap
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	jal	hbitmap_search_reverse
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.81:
+	lw	$13, 2($sp)
+	lw	$ra, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	release_pages
+release_pages:
+	subui	$sp, $sp, 9
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 9($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 1023
+	and	$13, $13, $12
+	sequ	$13, $13, $0
+	bnez	$13, L.83
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.82
+L.83:
+	lw	$13, 9($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$6, $0, $13
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$5, $0, $13
+	addu	$7, $0, $6
+	j	L.88
+L.85:
+	la	$13, cow_pages
+	sw	$13, 0($sp)
+	sw	$7, 1($sp)
+	jal	cow_release
+L.86:
+	addi	$7, $7, 1
+L.88:
+	add	$13, $6, $5
+	slt	$13, $7, $13
+	bnez	$13, L.85
+	la	$13, mem_pool
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$5, 2($sp)
+	jal	buddy_free
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.82:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	user_release_pages
+user_release_pages:
+	subui	$sp, $sp, 9
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	release_pages
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.90
+	lw	$1, 6($sp)
+	j	L.89
+L.90:
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 8($sp)
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	lw	$13, 9($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	lw	$13, 8($sp)
+	sw	$13, 2($sp)
+	lw	$13, 7($sp)
+	sw	$13, 3($sp)
+	jal	bitmap_clear_nbits
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.89:
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	dup_vm
+dup_vm:
+	subui	$sp, $sp, 16
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$9, 10($sp)
+	sw	$10, 11($sp)
+	sw	$11, 12($sp)
+	sw	$12, 13($sp)
+	sw	$13, 14($sp)
+	sw	$ra, 15($sp)
+	lw	$13, 16($sp)
+	addui	$12, $0, 1
+	addui	$11, $13, 21
+	lw	$10, 26($13)
+	addui	$10, $10, 1
+	addu	$10, $0, $10
+	lw	$9, 0($11)
+	addu	$9, $0, $9
+	subu	$10, $10, $9
+	addu	$2, $0, $10
+	lw	$13, 27($13)
+	addui	$13, $13, 1
+	addu	$13, $0, $13
+	lw	$11, 0($11)
+	addu	$11, $0, $11
+	subu	$13, $13, $11
+	addu	$6, $0, $13
+	sw	$6, 0($sp)
+	sw	$12, 1($sp)
+	jal	get_free_pages
+	addu	$13, $0, $1
+	addu	$3, $0, $13
+	addu	$13, $0, $3
+	sneu	$13, $13, $0
+	bnez	$13, L.93
+	addu	$1, $0, $0
+	j	L.92
+L.93:
+	addu	$13, $0, $3
+	srli	$13, $13, 10
+	addu	$4, $0, $13
+	sw	$2, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	lw	$12, 17($sp)
+	lw	$12, 17($12)
+	sw	$12, 0($sp)
+	addui	$12, $0, 32
+	sw	$12, 1($sp)
+	sw	$4, 2($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 3($sp)
+	jal	bitmap_set_nbits
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.95
+	sw	$3, 0($sp)
+	sw	$6, 1($sp)
+	jal	release_pages
+	addu	$1, $0, $0
+	j	L.92
+L.95:
+	lw	$13, 16($sp)
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$5, $0, $13
+	sw	$2, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$7, $0, $13
+	j	L.100
+L.97:
+	lw	$13, 16($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	add	$13, $5, $7
+	sw	$13, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.101
+	lw	$13, 17($sp)
+	lw	$13, 17($13)
+	sw	$13, 0($sp)
+	addui	$13, $0, 32
+	sw	$13, 1($sp)
+	add	$13, $4, $7
+	sw	$13, 2($sp)
+	jal	bitmap_set_bit
+L.101:
+L.98:
+	addi	$7, $7, 1
+L.100:
+	sw	$6, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$12, $0, $7
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	sltu	$13, $12, $13
+	bnez	$13, L.97
+	addu	$1, $0, $3
+L.92:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$9, 10($sp)
+	lw	$10, 11($sp)
+	lw	$11, 12($sp)
+	lw	$12, 13($sp)
+	lw	$13, 14($sp)
+	lw	$ra, 15($sp)
+	addui	$sp, $sp, 16
+	jr	$ra
+.global	release_proc_mem
+release_proc_mem:
+	subui	$sp, $sp, 10
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addu	$7, $0, $0
+	lw	$13, 10($sp)
+	lw	$13, 120($13)
+	sw	$13, 0($sp)
+	jal	get_proc
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	lw	$13, 9($sp)
+	lw	$13, 19($13)
+	andi	$13, $13, 8
+	seq	$13, $13, $0
+	bnez	$13, L.104
+	addu	$1, $0, $7
+	j	L.103
+L.104:
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$12, 22($13)
+	sw	$12, 1($sp)
+	lw	$13, 32($13)
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	user_release_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	seq	$13, $7, $0
+	bnez	$13, L.106
+	addu	$1, $0, $7
+	j	L.103
+L.106:
+	lw	$13, 10($sp)
+	lw	$13, 121($13)
+	sgt	$13, $13, $0
+	bnez	$13, L.108
+	lw	$13, 10($sp)
+	lw	$13, 21($13)
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	lw	$12, 27($13)
+	addui	$12, $12, 1
+	addu	$12, $0, $12
+	lw	$13, 21($13)
+	addu	$13, $0, $13
+	subu	$13, $12, $13
+	addu	$13, $0, $13
+	sw	$13, 7($sp)
+	lw	$13, 10($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	user_release_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.108:
+	addu	$1, $0, $7
+L.103:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	_kreport_memtable
+_kreport_memtable:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	lw	$13, 5($sp)
+	sw	$13, 2($sp)
+	jal	_kreport_bitmap
+L.110:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+L.112:
+	.asciiz	"Free"
+L.113:
+	.asciiz	"Used"
+.global	_kreport_sysmap
+.text
+_kreport_sysmap:
+	subui	$sp, $sp, 12
+	sw	$2, 4($sp)
+	sw	$3, 5($sp)
+	sw	$4, 6($sp)
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	la	$13, L.114
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	jalr	$13
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	sw	$13, 2($sp)
+	jal	_kreport_bitmap
+	addu	$7, $0, $0
+L.115:
+	sne	$13, $7, $0
+	bnez	$13, L.120
+	addui	$3, $0, 1
+	j	L.121
+L.120:
+	addui	$3, $0, 2
+L.121:
+	addu	$5, $0, $3
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	sw	$5, 2($sp)
+	jal	count_bits
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sne	$13, $7, $0
+	bnez	$13, L.123
+	la	$2, L.112
+	j	L.124
+L.123:
+	la	$2, L.113
+L.124:
+	addu	$4, $0, $2
+	la	$13, L.125
+	sw	$13, 0($sp)
+	sw	$4, 1($sp)
+	sw	$6, 2($sp)
+	sw	$6, 3($sp)
+	lw	$13, 12($sp)
+	jalr	$13
+L.116:
+	addi	$7, $7, 1
+	slti	$13, $7, 2
+	bnez	$13, L.115
+	la	$13, L.126
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	jalr	$13
+	addu	$7, $0, $0
+	j	L.130
+L.127:
+	la	$13, L.132
+	sw	$13, 0($sp)
+	lw	$13, mem_pool+36($7)
+	sw	$13, 1($sp)
+	lw	$13, 12($sp)
+	jalr	$13
+L.128:
+	addi	$7, $7, 1
+L.130:
+	lw	$13, mem_pool+2($0)
+	sle	$13, $7, $13
+	bnez	$13, L.127
+	la	$13, L.134
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	jalr	$13
+L.111:
+	lw	$2, 4($sp)
+	lw	$3, 5($sp)
+	lw	$4, 6($sp)
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	init_mem_table
+init_mem_table:
+	subui	$sp, $sp, 9
+	sw	$7, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	la	$13, BSS_END
+	addu	$7, $0, $13
+	addui	$13, $0, 1023
+	or	$7, $7, $13
+	addui	$13, $0, 1
+	addu	$7, $7, $13
+	srli	$13, $7, 10
+	addu	$13, $0, $13
+	sw	$13, 8($sp)
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	jal	bitmap_clear
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	sw	$0, 2($sp)
+	lw	$13, 8($sp)
+	sw	$13, 3($sp)
+	jal	bitmap_set_nbits
+	la	$13, mem_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	addui	$13, $0, 127
+	sw	$13, 2($sp)
+	jal	bitmap_set_bit
+	la	$13, mem_hmap
+	sw	$13, 0($sp)
+	la	$13, mem_map
+	sw	$13, 1($sp)
+	addui	$13, $0, 4
+	sw	$13, 2($sp)
+	la	$13, mem_map_full
+	sw	$13, 3($sp)
+	la	$13, mem_map_empty
+	sw	$13, 4($sp)
+	jal	hbitmap_init
+	la	$13, mem_pool
+	sw	$13, 0($sp)
+	la	$13, mem_pages
+	sw	$13, 1($sp)
+	addui	$13, $0, 128
+	sw	$13, 2($sp)
+	la	$13, mem_hmap
+	sw	$13, 3($sp)
+	jal	buddy_init
+	la	$13, cow_pages
+	sw	$13, 0($sp)
+	la	$13, cow_src
+	sw	$13, 1($sp)
+	la	$13, cow_refs
+	sw	$13, 2($sp)
+	addui	$13, $0, 128
+	sw	$13, 3($sp)
+	la	$13, cow_copy_page
+	sw	$13, 4($sp)
+	jal	cow_init
+	srli	$13, $7, 10
+	addu	$13, $0, $13
+	sw	$13, bss_page_end($0)
+L.135:
+	lw	$7, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.bss
+bss_page_end:
+	.space	1
+cow_pages:
+	.space	4
+cow_refs:
+	.space	128
+cow_src:
+	.space	128
+mem_pool:
+	.space	52
+mem_pages:
+	.space	384
+mem_hmap:
+	.space	4
+mem_map_empty:
+	.space	1
+mem_map_full:
+	.space	1
+mem_map:
+	.space	4
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.134:
+	.asciiz	"\n"
+L.132:
+	.asciiz	" %d"
+L.126:
+	.asciiz	"\n Free blocks by order:"
+L.125:
+	.asciiz	" %s pages: %03d\t"
+L.114:
+	.asciiz	"Sys Mem bitmap: \n"
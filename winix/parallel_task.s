@@ -0,0 +1,150 @@
+_mode:
+	.word	0x0
+.global	printHex
+.text
+printHex:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3002
+	lw	$12, 2($sp)
+	srai	$12, $12, 4
+	andi	$12, $12, 15
+	sw	$12, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3003
+	lw	$12, 2($sp)
+	andi	$12, $12, 15
+	sw	$12, 0($13)
+L.10:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	printDec
+printDec:
+	subui	$sp, $sp, 3
+	sw	$11, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	addui	$13, $0, 10
+	lhi	$12, 0x7
+	ori	$12, $12, 0x3002
+	lw	$11, 3($sp)
+	div	$11, $11, $13
+	rem	$13, $11, $13
+	sw	$13, 0($12)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3003
+	lw	$12, 3($sp)
+	remi	$12, $12, 10
+	sw	$12, 0($13)
+L.11:
+	lw	$11, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	parallel_main
+parallel_main:
+	subui	$sp, $sp, 8
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3004
+	addui	$12, $0, 1
+	sw	$12, 0($13)
+	j	L.14
+L.13:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3000
+	lw	$7, 0($13)
+	sne	$13, $7, $0
+	bnez	$13, L.16
+	addu	$6, $0, $0
+	j	L.17
+L.16:
+	addui	$13, $0, 100
+	div	$6, $13, $7
+L.17:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3001
+	lw	$5, 0($13)
+	seqi	$13, $5, 1
+	bnez	$13, L.21
+	seqi	$13, $5, 2
+	bnez	$13, L.22
+	seqi	$13, $5, 3
+	bnez	$13, L.23
+	j	L.19
+L.21:
+	sw	$0, _mode($0)
+	j	L.19
+L.22:
+	addui	$13, $0, 1
+	sw	$13, _mode($0)
+	j	L.19
+L.23:
+	jal	task_exit
+	j	L.12
+L.19:
+	lw	$4, _mode($0)
+	seq	$13, $4, $0
+	bnez	$13, L.27
+	seqi	$13, $4, 1
+	bnez	$13, L.28
+	j	L.25
+L.27:
+	sw	$6, 0($sp)
+	jal	printHex
+	j	L.25
+L.28:
+	sw	$6, 0($sp)
+	jal	printDec
+L.25:
+L.14:
+	j	L.13
+L.12:
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
@@ -31,6 +31,256 @@ struct mem_block {
 
 static void *base = NULL;
 
+/**
+ * Small kmalloc requests, and fixed size kernel objects, are served from
+ * slab caches. A slab is one page, starting with a struct slab header
+ * followed by equally sized objects. Free objects of a slab are linked
+ * through their first word, so allocation and free are O(1).
+ * Pages holding slabs are marked in slab_page_map, which is how kfree()
+ * tells slab objects apart from blocks of the first fit heap below.
+ * kmalloc objects carry the caller's return address in the word before
+ * the returned pointer, the same information mem_block.ra keeps.
+ */
+struct slab{
+    struct list_head list;
+    struct kmem_cache *cache;
+    void **free;
+    int inuse;
+};
+
+#define SLAB_OBJS(slab)         ((char *)(slab) + sizeof(struct slab))
+#define SLAB_OF(ptr)            ((struct slab *)((unsigned long)(ptr) & ~(unsigned long)(PAGE_LEN - 1)))
+#define KMALLOC_NR_CLASSES      7
+
+static const int kmalloc_sizes[KMALLOC_NR_CLASSES] = {4, 8, 16, 32, 64, 128, 256};
+static const char *kmalloc_names[KMALLOC_NR_CLASSES] = {
+    "kmalloc-4", "kmalloc-8", "kmalloc-16", "kmalloc-32",
+    "kmalloc-64", "kmalloc-128", "kmalloc-256",
+};
+static struct kmem_cache *kmalloc_caches[KMALLOC_NR_CLASSES];
+static struct kmem_cache caches[KMEM_CACHE_NR];
+static int nr_caches = 0;
+static unsigned int slab_page_map[MEM_MAP_LEN];
+
+/**
+ * Allocation profile of kmalloc call sites, an open addressed table keyed
+ * by the return address every kmalloc already records. Sizes are the
+ * words actually taken, slab object or heap block. Once the table is full
+ * new call sites are not profiled
+ */
+#define KMALLOC_SITE_NR         64
+
+static struct kmalloc_site kmalloc_sites[KMALLOC_SITE_NR];
+
+static struct kmalloc_site *get_kmalloc_site(void *ra){
+    struct kmalloc_site *site;
+    int i, idx = (unsigned long)ra % KMALLOC_SITE_NR;
+
+    for(i = 0; i < KMALLOC_SITE_NR; i++){
+        site = &kmalloc_sites[(idx + i) % KMALLOC_SITE_NR];
+        if(site->ra == ra)
+            return site;
+        if(site->ra == NULL){
+            site->ra = ra;
+            return site;
+        }
+    }
+    return NULL;
+}
+
+static void profile_alloc(void *ra, int size){
+    struct kmalloc_site *site = get_kmalloc_site(ra);
+    if(!site)
+        return;
+    site->nr_allocs++;
+    site->live += size;
+    if(site->live > site->peak)
+        site->peak = site->live;
+}
+
+static void profile_free(void *ra, int size){
+    struct kmalloc_site *site = get_kmalloc_site(ra);
+    if(!site)
+        return;
+    site->nr_frees++;
+    site->live -= size;
+}
+
+/**
+ * copy the profiled call sites
+ * @param  buf 
+ * @param  len number of entries buf holds
+ * @return     number of entries copied
+ */
+int get_kmalloc_sites(struct kmalloc_site *buf, int len){
+    int i, count = 0;
+
+    for(i = 0; i < KMALLOC_SITE_NR && count < len; i++){
+        if(kmalloc_sites[i].ra)
+            buf[count++] = kmalloc_sites[i];
+    }
+    return count;
+}
+
+/**
+ * create a cache of objects of the given size
+ * @param  name 
+ * @param  size 
+ * @return      the cache, or NULL if the cache table is full
+ */
+struct kmem_cache *kmem_cache_create(const char *name, size_t size){
+    struct kmem_cache *cache;
+
+    if(nr_caches >= KMEM_CACHE_NR)
+        return NULL;
+    if(size < sizeof(void *))
+        size = sizeof(void *);
+    size = (size + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+    if(size > PAGE_LEN - sizeof(struct slab))
+        return NULL;
+
+    cache = &caches[nr_caches++];
+    cache->name = name;
+    cache->size = size;
+    cache->objs_per_slab = (PAGE_LEN - sizeof(struct slab)) / size;
+    cache->nr_slabs = 0;
+    cache->nr_active = 0;
+    INIT_LIST_HEAD(&cache->slabs_partial);
+    INIT_LIST_HEAD(&cache->slabs_full);
+    INIT_LIST_HEAD(&cache->slabs_free);
+    return cache;
+}
+
+static struct slab *new_slab(struct kmem_cache *cache){
+    struct slab *slab;
+    void **obj;
+    int i;
+
+    slab = (struct slab *)get_free_page(GFP_HIGH);
+    if(!slab)
+        return NULL;
+    bitmap_set_bit(slab_page_map, MEM_MAP_LEN, PADDR_TO_PAGED(slab));
+    slab->cache = cache;
+    slab->inuse = 0;
+    slab->free = NULL;
+    for(i = cache->objs_per_slab - 1; i >= 0; i--){
+        obj = (void **)(SLAB_OBJS(slab) + i * cache->size);
+        *obj = slab->free;
+        slab->free = obj;
+    }
+    cache->nr_slabs++;
+    return slab;
+}
+
+static void release_slab(struct slab *slab){
+    slab->cache->nr_slabs--;
+    bitmap_clear_bit(slab_page_map, MEM_MAP_LEN, PADDR_TO_PAGED(slab));
+    release_pages((ptr_t *)slab, PAGE_LEN);
+}
+
+static bool is_slab_obj(struct slab *slab, void *ptr){
+    int offset = (char *)ptr - SLAB_OBJS(slab);
+    return offset >= 0 && offset % slab->cache->size == 0
+        && offset / slab->cache->size < slab->cache->objs_per_slab;
+}
+
+void *kmem_cache_alloc(struct kmem_cache *cache){
+    struct slab *slab;
+    void **obj;
+
+    if(!list_empty(&cache->slabs_partial)){
+        slab = list_first_entry(&cache->slabs_partial, struct slab, list);
+    }else if(!list_empty(&cache->slabs_free)){
+        slab = list_first_entry(&cache->slabs_free, struct slab, list);
+        list_move(&slab->list, &cache->slabs_partial);
+    }else{
+        slab = new_slab(cache);
+        if(!slab)
+            return NULL;
+        list_add(&slab->list, &cache->slabs_partial);
+    }
+
+    obj = slab->free;
+    slab->free = (void **)*obj;
+    slab->inuse++;
+    cache->nr_active++;
+    if(!slab->free)
+        list_move(&slab->list, &cache->slabs_full);
+    return obj;
+}
+
+/**
+ * return an object to its cache. A slab that becomes empty is kept as
+ * the cache's spare, further empty slabs give their page back
+ * @param cache 
+ * @param ptr   
+ */
+void kmem_cache_free(struct kmem_cache *cache, void *ptr){
+    struct slab *slab = SLAB_OF(ptr);
+    void **obj = ptr;
+    bool was_full;
+
+    if(!ptr || slab->cache != cache || !is_slab_obj(slab, ptr)){
+        kwarn("invalid %s object %p\n", cache->name, ptr);
+        return;
+    }
+    was_full = slab->free == NULL;
+    *obj = slab->free;
+    slab->free = obj;
+    slab->inuse--;
+    cache->nr_active--;
+
+    if(slab->inuse == 0){
+        if(list_empty(&cache->slabs_free)){
+            list_move(&slab->list, &cache->slabs_free);
+        }else{
+            list_del(&slab->list);
+            release_slab(slab);
+        }
+    }else if(was_full){
+        list_move(&slab->list, &cache->slabs_partial);
+    }
+}
+
+/**
+ * the kmalloc size class for size words, created on first use
+ * @param  size 
+ * @return      NULL if size is too big for any class
+ */
+static struct kmem_cache *kmalloc_cache(size_t size){
+    int i;
+
+    for(i = 0; i < KMALLOC_NR_CLASSES; i++){
+        if(size > kmalloc_sizes[i])
+            continue;
+        if(!kmalloc_caches[i])
+            kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i], kmalloc_sizes[i]);
+        return kmalloc_caches[i];
+    }
+    return NULL;
+}
+
+static bool is_kmalloc_cache(struct kmem_cache *cache){
+    int i;
+    for(i = 0; i < KMALLOC_NR_CLASSES; i++){
+        if(kmalloc_caches[i] == cache)
+            return true;
+    }
+    return false;
+}
+
+static void kprint_caches(){
+    struct kmem_cache *cache;
+    int capacity;
+
+    for(cache = caches; cache < caches + nr_caches; cache++){
+        capacity = cache->nr_slabs * cache->objs_per_slab;
+        kprintf("%-12s size %3d slabs %2d objs %4d / %4d %3d%%\n",
+            cache->name, cache->size, cache->nr_slabs, cache->nr_active, capacity,
+            capacity ? cache->nr_active * 100 / capacity : 0);
+    }
+}
+
 #define SLAB_HEADER_SIZE 	(sizeof(struct mem_block) - 1)
 #define align4(x) 	(((((x)-1)>>2)<<2)+4)
 
@@ -51,7 +301,8 @@ void kprint_slab() {
     int frees = 0;
     int used = 0;
     struct mem_block *b = base;
-    
+
+    kprint_caches();
     if(!b){
         kprintf("slab is empty\n");
         return;
@@ -146,8 +397,20 @@ struct mem_block *extend_heap(struct mem_block *first , size_t s)
 void *_kmalloc(size_t nitimes, size_t size, void* ra) {
 
     struct mem_block *b, *first, *b2;
+    struct kmem_cache *cache;
+    void **obj;
     size_t s = size * nitimes;
 
+    cache = kmalloc_cache(s + sizeof(void *));
+    if(cache){
+        obj = kmem_cache_alloc(cache);
+        if(!obj)
+            return NULL;
+        *obj = ra;
+        profile_alloc(ra, cache->size);
+        return obj + 1;
+    }
+
     // s = align4(size);
     // kdebug("kmalloc begin size %d by %x\n", size, ra);
 
@@ -175,6 +438,7 @@ void *_kmalloc(size_t nitimes, size_t size, void* ra) {
     }
     b->ra = ra;
     b->free = false;
+    profile_alloc(ra, b->size);
     // kdebug("kmalloc %x size %d to %x\n", b->data, size, ra);
     // printblock(b);
     return (b->data);
@@ -215,9 +479,23 @@ struct mem_block *fusion(struct mem_block *b) {
 void _kfree(void *p, void *ra)
 {
     struct mem_block *b;
+    struct slab *slab;
+    void **obj;
+
+    if(p && is_bit_on(slab_page_map, MEM_MAP_LEN, PADDR_TO_PAGED(p))){
+        obj = (void **)p - 1;
+        slab = SLAB_OF(obj);
+        if(is_kmalloc_cache(slab->cache) && is_slab_obj(slab, obj)){
+            profile_free(*obj, slab->cache->size);
+            kmem_cache_free(slab->cache, obj);
+        }else
+            kwarn("invalid addr %p by %p\n", p, ra);
+        return;
+    }
     if (valid_addr(p))
     {
         b = get_block(p);
+        profile_free(b->ra, b->size);
         b->free = true;
         /* fusion with previous if possible */
         if (b->prev && b->prev->free){
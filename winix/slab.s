@@ -0,0 +1,1617 @@
+base:
+	.word	0x0
+.data
+kmalloc_sizes:
+	.word	0x4
+	.word	0x8
+	.word	0x10
+	.word	0x20
+	.word	0x40
+	.word	0x80
+	.word	0x100
+kmalloc_names:
+	.word	L.9
+	.word	L.10
+	.word	L.11
+	.word	L.12
+	.word	L.13
+	.word	L.14
+	.word	L.15
+nr_caches:
+	.word	0x0
+.text
+get_kmalloc_site:
+	subui	$sp, $sp, 5
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 63
+	and	$13, $13, $12
+	addu	$5, $0, $13
+	addu	$6, $0, $0
+L.17:
+	addui	$13, $0, 5
+	add	$12, $5, $6
+	remi	$12, $12, 64
+	mult	$13, $13, $12
+	la	$12, kmalloc_sites
+	addu	$7, $13, $12
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	lw	$12, 5($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.21
+	addu	$1, $0, $7
+	j	L.16
+L.21:
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.23
+	lw	$13, 5($sp)
+	sw	$13, 0($7)
+	addu	$1, $0, $7
+	j	L.16
+L.23:
+L.18:
+	addi	$6, $6, 1
+	slti	$13, $6, 64
+	bnez	$13, L.17
+	addu	$1, $0, $0
+L.16:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+profile_alloc:
+	subui	$sp, $sp, 6
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_kmalloc_site
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.26
+	j	L.25
+L.26:
+	addui	$13, $7, 1
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	addui	$13, $7, 3
+	lw	$12, 0($13)
+	lw	$11, 7($sp)
+	add	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 3($7)
+	lw	$12, 4($7)
+	sle	$13, $13, $12
+	bnez	$13, L.28
+	lw	$13, 3($7)
+	sw	$13, 4($7)
+L.28:
+L.25:
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+profile_free:
+	subui	$sp, $sp, 6
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	get_kmalloc_site
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.31
+	j	L.30
+L.31:
+	addui	$13, $7, 2
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	addui	$13, $7, 3
+	lw	$12, 0($13)
+	lw	$11, 7($sp)
+	sub	$12, $12, $11
+	sw	$12, 0($13)
+L.30:
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	get_kmalloc_sites
+get_kmalloc_sites:
+	subui	$sp, $sp, 8
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$8, 2($sp)
+	sw	$9, 3($sp)
+	sw	$10, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	addu	$6, $0, $0
+	addu	$7, $0, $0
+	j	L.37
+L.34:
+	addui	$13, $0, 5
+	mult	$13, $13, $7
+	lw	$13, kmalloc_sites($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.38
+	addu	$13, $0, $6
+	addi	$6, $13, 1
+	addui	$12, $0, 5
+	mult	$13, $12, $13
+	lw	$11, 8($sp)
+	addu	$13, $13, $11
+	mult	$12, $12, $7
+	la	$11, kmalloc_sites
+	addu	$9, $12, $11
+	lw	$8, 0($9)
+	lw	$10, 1($9)
+	sw	$8, 0($13)
+	sw	$10, 1($13)
+	lw	$8, 2($9)
+	lw	$10, 3($9)
+	sw	$8, 2($13)
+	sw	$10, 3($13)
+	lw	$8, 4($9)
+	sw	$8, 4($13)
+L.38:
+L.35:
+	addi	$7, $7, 1
+L.37:
+	sgei	$13, $7, 64
+	bnez	$13, L.40
+	lw	$13, 9($sp)
+	slt	$13, $6, $13
+	bnez	$13, L.34
+L.40:
+	addu	$1, $0, $6
+L.33:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$8, 2($sp)
+	lw	$9, 3($sp)
+	lw	$10, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	kmem_cache_create
+kmem_cache_create:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$13, nr_caches($0)
+	slti	$13, $13, 16
+	bnez	$13, L.42
+	addu	$1, $0, $0
+	j	L.41
+L.42:
+	lw	$13, 4($sp)
+	addui	$12, $0, 1
+	sgeu	$13, $13, $12
+	bnez	$13, L.44
+	addui	$13, $0, 1
+	sw	$13, 4($sp)
+L.44:
+	addui	$13, $0, 1
+	lw	$12, 4($sp)
+	addu	$12, $12, $13
+	subu	$12, $12, $13
+	multu	$13, $13, $12
+	sw	$13, 4($sp)
+	lw	$13, 4($sp)
+	addui	$12, $0, 1019
+	sleu	$13, $13, $12
+	bnez	$13, L.46
+	addu	$1, $0, $0
+	j	L.41
+L.46:
+	lw	$13, nr_caches($0)
+	addi	$12, $13, 1
+	sw	$12, nr_caches($0)
+	addui	$12, $0, 11
+	mult	$13, $12, $13
+	la	$12, caches
+	addu	$7, $13, $12
+	lw	$13, 3($sp)
+	sw	$13, 0($7)
+	lw	$13, 4($sp)
+	sw	$13, 1($7)
+	addui	$13, $0, 1019
+	lw	$12, 4($sp)
+	divu	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 2($7)
+	sw	$0, 3($7)
+	sw	$0, 4($7)
+L.48:
+	addui	$13, $7, 5
+	sw	$13, 0($13)
+	addui	$13, $7, 5
+	sw	$13, 6($7)
+L.49:
+L.51:
+	addui	$13, $7, 7
+	sw	$13, 0($13)
+	addui	$13, $7, 7
+	sw	$13, 8($7)
+L.52:
+L.54:
+	addui	$13, $7, 9
+	sw	$13, 0($13)
+	addui	$13, $7, 9
+	sw	$13, 10($7)
+L.55:
+	addu	$1, $0, $7
+L.41:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+new_slab:
+	subui	$sp, $sp, 9
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addui	$13, $0, 1024
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	get_free_pages
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.58
+	addu	$1, $0, $0
+	j	L.57
+L.58:
+	la	$13, slab_page_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	addu	$13, $0, $7
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	bitmap_set_bit
+	lw	$13, 9($sp)
+	sw	$13, 2($7)
+	sw	$0, 4($7)
+	sw	$0, 3($7)
+	lw	$13, 9($sp)
+	lw	$13, 2($13)
+	subi	$6, $13, 1
+	j	L.63
+L.60:
+	addu	$13, $0, $6
+	lw	$12, 9($sp)
+	lw	$12, 1($12)
+	multu	$13, $13, $12
+	addui	$12, $0, 5
+	addu	$12, $7, $12
+	addu	$5, $13, $12
+	lw	$13, 3($7)
+	sw	$13, 0($5)
+	sw	$5, 3($7)
+L.61:
+	subi	$6, $6, 1
+L.63:
+	sge	$13, $6, $0
+	bnez	$13, L.60
+	lw	$13, 9($sp)
+	addui	$13, $13, 3
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	addu	$1, $0, $7
+L.57:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+release_slab:
+	subui	$sp, $sp, 6
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$13, 2($13)
+	addui	$13, $13, 3
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	la	$13, slab_page_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	bitmap_clear_bit
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1024
+	sw	$13, 1($sp)
+	jal	release_pages
+L.64:
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+is_slab_obj:
+	subui	$sp, $sp, 7
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$10, 2($sp)
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	lw	$13, 8($sp)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	addui	$11, $0, 5
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	subu	$13, $13, $12
+	addu	$7, $0, $13
+	slt	$13, $7, $0
+	bnez	$13, L.67
+	addu	$13, $0, $7
+	sw	$13, 6($sp)
+	lw	$12, 7($sp)
+	lw	$12, 2($12)
+	lw	$11, 1($12)
+	remu	$10, $13, $11
+	sneu	$13, $10, $0
+	bnez	$13, L.67
+	lw	$13, 6($sp)
+	divu	$13, $13, $11
+	lw	$12, 2($12)
+	addu	$12, $0, $12
+	sgeu	$13, $13, $12
+	bnez	$13, L.67
+	addui	$6, $0, 1
+	j	L.68
+L.67:
+	addu	$6, $0, $0
+L.68:
+	addu	$1, $0, $6
+L.65:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$10, 2($sp)
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	kmem_cache_alloc
+kmem_cache_alloc:
+	subui	$sp, $sp, 9
+	sw	$3, 1($sp)
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 9($sp)
+	addui	$13, $13, 5
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.70
+	lw	$13, 9($sp)
+	lw	$7, 5($13)
+	j	L.71
+L.70:
+	lw	$13, 9($sp)
+	addui	$13, $13, 9
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sequ	$13, $12, $13
+	bnez	$13, L.72
+	lw	$13, 9($sp)
+	lw	$7, 9($13)
+L.74:
+L.77:
+L.80:
+	lw	$13, 0($7)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	lw	$13, 1($7)
+	lw	$12, 0($7)
+	sw	$12, 0($13)
+L.81:
+L.78:
+L.83:
+L.86:
+	addu	$5, $0, $7
+	lw	$13, 9($sp)
+	addui	$4, $13, 5
+	lw	$13, 9($sp)
+	lw	$3, 5($13)
+	sw	$5, 1($3)
+	sw	$3, 0($5)
+	sw	$4, 1($5)
+	sw	$5, 0($4)
+	j	L.73
+L.72:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	jal	new_slab
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.89
+	addu	$1, $0, $0
+	j	L.69
+L.89:
+L.91:
+L.94:
+	addu	$5, $0, $7
+	lw	$13, 9($sp)
+	addui	$4, $13, 5
+	lw	$13, 9($sp)
+	lw	$3, 5($13)
+	sw	$5, 1($3)
+	sw	$3, 0($5)
+	sw	$4, 1($5)
+	sw	$5, 0($4)
+L.95:
+L.92:
+L.73:
+L.71:
+	addui	$13, $7, 3
+	lw	$6, 0($13)
+	lw	$12, 0($6)
+	sw	$12, 0($13)
+	addui	$13, $7, 4
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 9($sp)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	addi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 3($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.97
+L.99:
+L.102:
+L.105:
+	lw	$13, 0($7)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	lw	$13, 1($7)
+	lw	$12, 0($7)
+	sw	$12, 0($13)
+L.106:
+L.103:
+L.108:
+L.111:
+	addu	$5, $0, $7
+	lw	$13, 9($sp)
+	addui	$4, $13, 7
+	lw	$13, 9($sp)
+	lw	$3, 7($13)
+	sw	$5, 1($3)
+	sw	$3, 0($5)
+	sw	$4, 1($5)
+	sw	$5, 0($4)
+L.112:
+L.109:
+L.100:
+L.97:
+	addu	$1, $0, $6
+L.69:
+	lw	$3, 1($sp)
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	kmem_cache_free
+kmem_cache_free:
+	subui	$sp, $sp, 14
+	sw	$2, 3($sp)
+	sw	$3, 4($sp)
+	sw	$4, 5($sp)
+	sw	$5, 6($sp)
+	sw	$6, 7($sp)
+	sw	$7, 8($sp)
+	sw	$12, 9($sp)
+	sw	$13, 10($sp)
+	sw	$ra, 11($sp)
+	lw	$13, 15($sp)
+	addu	$13, $0, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfc00
+	and	$13, $13, $12
+	addu	$7, $0, $13
+	lw	$6, 15($sp)
+	lw	$13, 15($sp)
+	sw	$13, 12($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.118
+	lw	$13, 2($7)
+	addu	$13, $0, $13
+	lw	$12, 14($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.118
+	sw	$7, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	jal	is_slab_obj
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.115
+L.118:
+	la	$13, L.119
+	sw	$13, 0($sp)
+	lw	$13, 14($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	lw	$13, 15($sp)
+	sw	$13, 2($sp)
+	jal	kwarn
+	j	L.114
+L.115:
+	lw	$13, 3($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.121
+	addui	$5, $0, 1
+	j	L.122
+L.121:
+	addu	$5, $0, $0
+L.122:
+	sw	$5, 13($sp)
+	lw	$13, 3($7)
+	sw	$13, 0($6)
+	sw	$6, 3($7)
+	addui	$13, $7, 4
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 14($sp)
+	addui	$13, $13, 4
+	lw	$12, 0($13)
+	subi	$12, $12, 1
+	sw	$12, 0($13)
+	lw	$13, 4($7)
+	sne	$13, $13, $0
+	bnez	$13, L.123
+	lw	$13, 14($sp)
+	addui	$13, $13, 9
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	addu	$13, $0, $13
+	sneu	$13, $12, $13
+	bnez	$13, L.125
+L.127:
+L.130:
+L.133:
+	lw	$13, 0($7)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	lw	$13, 1($7)
+	lw	$12, 0($7)
+	sw	$12, 0($13)
+L.134:
+L.131:
+L.136:
+L.139:
+	addu	$4, $0, $7
+	lw	$13, 14($sp)
+	addui	$3, $13, 9
+	lw	$13, 14($sp)
+	lw	$2, 9($13)
+	sw	$4, 1($2)
+	sw	$2, 0($4)
+	sw	$3, 1($4)
+	sw	$4, 0($3)
+	j	L.124
+L.125:
+L.142:
+L.145:
+L.148:
+	lw	$13, 0($7)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	lw	$13, 1($7)
+	lw	$12, 0($7)
+	sw	$12, 0($13)
+L.149:
+L.146:
+	sw	$0, 0($7)
+	lhi	$13, 0x0
+	ori	$13, $13, 0x2
+	sw	$13, 1($7)
+L.143:
+	sw	$7, 0($sp)
+	jal	release_slab
+	j	L.124
+L.123:
+	lw	$13, 13($sp)
+	seq	$13, $13, $0
+	bnez	$13, L.151
+L.153:
+L.156:
+L.159:
+	lw	$13, 0($7)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	lw	$13, 1($7)
+	lw	$12, 0($7)
+	sw	$12, 0($13)
+L.160:
+L.157:
+L.162:
+L.165:
+	addu	$4, $0, $7
+	lw	$13, 14($sp)
+	addui	$3, $13, 5
+	lw	$13, 14($sp)
+	lw	$2, 5($13)
+	sw	$4, 1($2)
+	sw	$2, 0($4)
+	sw	$3, 1($4)
+	sw	$4, 0($3)
+L.166:
+L.163:
+L.154:
+L.151:
+L.124:
+L.114:
+	lw	$2, 3($sp)
+	lw	$3, 4($sp)
+	lw	$4, 5($sp)
+	lw	$5, 6($sp)
+	lw	$6, 7($sp)
+	lw	$7, 8($sp)
+	lw	$12, 9($sp)
+	lw	$13, 10($sp)
+	lw	$ra, 11($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+kmalloc_cache:
+	subui	$sp, $sp, 6
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	addu	$7, $0, $0
+L.169:
+	lw	$13, 6($sp)
+	lw	$12, kmalloc_sizes($7)
+	addu	$12, $0, $12
+	sleu	$13, $13, $12
+	bnez	$13, L.173
+	j	L.170
+L.173:
+	lw	$13, kmalloc_caches($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.175
+	lw	$13, kmalloc_names($7)
+	sw	$13, 0($sp)
+	lw	$13, kmalloc_sizes($7)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	kmem_cache_create
+	addu	$13, $0, $1
+	sw	$13, kmalloc_caches($7)
+L.175:
+	lw	$1, kmalloc_caches($7)
+	j	L.168
+L.170:
+	addi	$7, $7, 1
+	slti	$13, $7, 7
+	bnez	$13, L.169
+	addu	$1, $0, $0
+L.168:
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+is_kmalloc_cache:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	addu	$7, $0, $0
+L.178:
+	lw	$13, kmalloc_caches($7)
+	addu	$13, $0, $13
+	lw	$12, 3($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.182
+	addui	$1, $0, 1
+	j	L.177
+L.182:
+L.179:
+	addi	$7, $7, 1
+	slti	$13, $7, 7
+	bnez	$13, L.178
+	addu	$1, $0, $0
+L.177:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+kprint_caches:
+	subui	$sp, $sp, 14
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$11, 10($sp)
+	sw	$12, 11($sp)
+	sw	$13, 12($sp)
+	sw	$ra, 13($sp)
+	la	$7, caches
+	j	L.188
+L.185:
+	addui	$13, $7, 3
+	lw	$12, 0($13)
+	lw	$11, 2($7)
+	mult	$6, $12, $11
+	la	$12, L.189
+	sw	$12, 0($sp)
+	lw	$12, 0($7)
+	sw	$12, 1($sp)
+	lw	$12, 1($7)
+	sw	$12, 2($sp)
+	lw	$13, 0($13)
+	sw	$13, 3($sp)
+	lw	$13, 4($7)
+	sw	$13, 4($sp)
+	sw	$6, 5($sp)
+	seq	$13, $6, $0
+	bnez	$13, L.191
+	addui	$13, $0, 100
+	lw	$12, 4($7)
+	mult	$13, $13, $12
+	div	$5, $13, $6
+	j	L.192
+L.191:
+	addu	$5, $0, $0
+L.192:
+	sw	$5, 6($sp)
+	jal	kprintf
+L.186:
+	addui	$7, $7, 11
+L.188:
+	addu	$13, $0, $7
+	addui	$12, $0, 11
+	lw	$11, nr_caches($0)
+	mult	$12, $12, $11
+	la	$11, caches
+	addu	$12, $12, $11
+	addu	$12, $0, $12
+	sltu	$13, $13, $12
+	bnez	$13, L.185
+L.184:
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$11, 10($sp)
+	lw	$12, 11($sp)
+	lw	$13, 12($sp)
+	lw	$ra, 13($sp)
+	addui	$sp, $sp, 14
+	jr	$ra
+.global	kprintblock
+kprintblock:
+	subui	$sp, $sp, 15
+	sw	$5, 7($sp)
+	sw	$6, 8($sp)
+	sw	$7, 9($sp)
+	sw	$12, 10($sp)
+	sw	$13, 11($sp)
+	sw	$ra, 12($sp)
+	lw	$13, 15($sp)
+	lw	$13, 2($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.195
+	lw	$13, 15($sp)
+	lw	$13, 2($13)
+	addui	$7, $13, 6
+	j	L.196
+L.195:
+	lw	$13, 15($sp)
+	lw	$7, 2($13)
+L.196:
+	sw	$7, 14($sp)
+	lw	$13, 15($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.198
+	lw	$13, 15($sp)
+	lw	$13, 1($13)
+	addui	$6, $13, 6
+	j	L.199
+L.198:
+	lw	$13, 15($sp)
+	lw	$6, 1($13)
+L.199:
+	sw	$6, 13($sp)
+	la	$13, L.200
+	sw	$13, 0($sp)
+	lw	$13, 15($sp)
+	addui	$12, $13, 6
+	addu	$12, $0, $12
+	sw	$12, 1($sp)
+	lw	$12, 0($13)
+	sw	$12, 2($sp)
+	lw	$12, 14($sp)
+	addu	$12, $0, $12
+	sw	$12, 3($sp)
+	lw	$12, 13($sp)
+	addu	$12, $0, $12
+	sw	$12, 4($sp)
+	lw	$12, 3($13)
+	addu	$12, $0, $12
+	sw	$12, 5($sp)
+	lw	$13, 4($13)
+	seq	$13, $13, $0
+	bnez	$13, L.204
+	la	$5, L.201
+	j	L.205
+L.204:
+	la	$5, L.202
+L.205:
+	sw	$5, 6($sp)
+	jal	kprintf
+L.193:
+	lw	$5, 7($sp)
+	lw	$6, 8($sp)
+	lw	$7, 9($sp)
+	lw	$12, 10($sp)
+	lw	$13, 11($sp)
+	lw	$ra, 12($sp)
+	addui	$sp, $sp, 15
+	jr	$ra
+.global	kprint_slab
+kprint_slab:
+	subui	$sp, $sp, 9
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	addu	$6, $0, $0
+	addu	$5, $0, $0
+	lw	$7, base($0)
+	jal	kprint_caches
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.211
+	la	$13, L.209
+	sw	$13, 0($sp)
+	jal	kprintf
+	j	L.206
+L.210:
+	lw	$13, 4($7)
+	seq	$13, $13, $0
+	bnez	$13, L.213
+	addu	$13, $0, $6
+	lw	$12, 0($7)
+	addu	$13, $13, $12
+	addu	$6, $0, $13
+	j	L.214
+L.213:
+	addu	$13, $0, $5
+	lw	$12, 0($7)
+	addu	$13, $13, $12
+	addu	$5, $0, $13
+L.214:
+	sw	$7, 0($sp)
+	jal	kprintblock
+	lw	$7, 2($7)
+L.211:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.210
+	la	$13, L.215
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	sw	$5, 2($sp)
+	jal	kprintf
+L.206:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	find_block
+find_block:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$7, base($0)
+	j	L.218
+L.217:
+	lw	$13, 3($sp)
+	sw	$7, 0($13)
+	lw	$7, 2($7)
+L.218:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.220
+	lw	$13, 4($7)
+	seq	$13, $13, $0
+	bnez	$13, L.217
+	lw	$13, 0($7)
+	lw	$12, 4($sp)
+	sltu	$13, $13, $12
+	bnez	$13, L.217
+L.220:
+	addu	$1, $0, $7
+L.216:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	split_block
+split_block:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$13, 4($sp)
+	lw	$12, 5($sp)
+	lw	$11, 0($13)
+	addui	$13, $13, 6
+	addu	$13, $11, $13
+	subu	$13, $13, $12
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffa
+	addu	$7, $13, $11
+	sw	$12, 0($7)
+	lw	$13, 4($sp)
+	lw	$13, 1($13)
+	sw	$13, 1($7)
+	lw	$13, 4($sp)
+	sw	$13, 2($7)
+	addui	$13, $0, 1
+	sw	$13, 4($7)
+	addui	$13, $7, 6
+	sw	$13, 5($7)
+	lw	$13, 4($sp)
+	lw	$12, 0($13)
+	lw	$11, 5($sp)
+	subu	$12, $12, $11
+	addui	$11, $0, 6
+	subu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 4($sp)
+	sw	$7, 1($13)
+	lw	$13, 4($sp)
+	addu	$13, $0, $13
+	lw	$12, base($0)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.222
+	sw	$7, base($0)
+L.222:
+	lw	$13, 1($7)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.224
+	lw	$13, 1($7)
+	sw	$7, 2($13)
+L.224:
+	addu	$1, $0, $7
+L.221:
+	lw	$7, 0($sp)
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	extend_heap
+extend_heap:
+	subui	$sp, $sp, 10
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 11($sp)
+	addui	$12, $0, 6
+	sgeu	$13, $13, $12
+	bnez	$13, L.227
+	addui	$13, $0, 7
+	sw	$13, 11($sp)
+L.227:
+	lw	$13, 11($sp)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	jal	align_page
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	addu	$13, $0, $6
+	sw	$13, 0($sp)
+	addui	$13, $0, 2
+	sw	$13, 1($sp)
+	jal	get_free_pages
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	addu	$13, $0, $5
+	sneu	$13, $13, $0
+	bnez	$13, L.229
+	la	$13, L.231
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	sw	$6, 2($sp)
+	jal	kerror
+	addu	$1, $0, $0
+	j	L.226
+L.229:
+	addu	$7, $0, $5
+	addui	$13, $0, 6
+	subu	$13, $6, $13
+	sw	$13, 0($7)
+	sw	$0, 2($7)
+	lw	$13, 10($sp)
+	sw	$13, 1($7)
+	addui	$13, $7, 6
+	sw	$13, 5($7)
+	addui	$13, $0, 1
+	sw	$13, 4($7)
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.232
+	lw	$13, 10($sp)
+	sw	$7, 2($13)
+L.232:
+	lw	$13, base($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.234
+	sw	$7, base($0)
+L.234:
+	lw	$13, 11($sp)
+	subu	$13, $6, $13
+	addui	$12, $0, 12
+	sleu	$13, $13, $12
+	bnez	$13, L.236
+	sw	$7, 0($sp)
+	lw	$13, 11($sp)
+	sw	$13, 1($sp)
+	jal	split_block
+	addu	$13, $0, $1
+	sw	$13, 9($sp)
+	lw	$1, 9($sp)
+	j	L.226
+L.236:
+	addu	$1, $0, $7
+L.226:
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 10
+	jr	$ra
+.global	_kmalloc
+_kmalloc:
+	subui	$sp, $sp, 11
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 12($sp)
+	lw	$12, 11($sp)
+	multu	$6, $13, $12
+	addui	$13, $0, 1
+	addu	$13, $6, $13
+	sw	$13, 0($sp)
+	jal	kmalloc_cache
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	addu	$13, $0, $5
+	sequ	$13, $13, $0
+	bnez	$13, L.239
+	sw	$5, 0($sp)
+	jal	kmem_cache_alloc
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.241
+	addu	$1, $0, $0
+	j	L.238
+L.241:
+	lw	$13, 10($sp)
+	lw	$12, 13($sp)
+	sw	$12, 0($13)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 1($5)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	profile_alloc
+	lw	$13, 10($sp)
+	addui	$1, $13, 1
+	j	L.238
+L.239:
+	lw	$13, base($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.243
+	lw	$13, base($0)
+	sw	$13, 9($sp)
+	addui	$13, $sp, 9
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	find_block
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.245
+	lw	$13, 0($7)
+	subu	$13, $13, $6
+	addui	$12, $0, 12
+	sltu	$13, $13, $12
+	bnez	$13, L.244
+	sw	$7, 0($sp)
+	sw	$6, 1($sp)
+	jal	split_block
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$7, 8($sp)
+	j	L.244
+L.245:
+	lw	$13, 9($sp)
+	sw	$13, 0($sp)
+	sw	$6, 1($sp)
+	jal	extend_heap
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.244
+	addu	$1, $0, $0
+	j	L.238
+L.243:
+	sw	$0, 0($sp)
+	sw	$6, 1($sp)
+	jal	extend_heap
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.251
+	addu	$1, $0, $0
+	j	L.238
+L.251:
+L.244:
+	lw	$13, 13($sp)
+	sw	$13, 3($7)
+	sw	$0, 4($7)
+	lw	$13, 13($sp)
+	sw	$13, 0($sp)
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	profile_alloc
+	addui	$1, $7, 6
+L.238:
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	get_block
+get_block:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfffa
+	addu	$1, $13, $12
+L.253:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	valid_addr
+valid_addr:
+	subui	$sp, $sp, 7
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	sw	$13, 5($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.256
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	get_block
+	addu	$13, $0, $1
+	lw	$13, 5($13)
+	addu	$13, $0, $13
+	lw	$12, 7($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.256
+	addui	$7, $0, 1
+	j	L.257
+L.256:
+	addu	$7, $0, $0
+L.257:
+	sw	$7, 6($sp)
+	lw	$1, 6($sp)
+L.254:
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	fusion
+fusion:
+	subui	$sp, $sp, 6
+	sw	$7, 0($sp)
+	sw	$10, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 6($sp)
+	lw	$7, 1($13)
+	addu	$13, $0, $7
+	sw	$13, 5($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.259
+	lw	$13, 4($7)
+	seq	$13, $13, $0
+	bnez	$13, L.259
+	lw	$13, 6($sp)
+	lw	$12, 0($13)
+	lw	$13, 5($13)
+	addu	$13, $12, $13
+	addu	$13, $0, $13
+	lw	$12, 5($sp)
+	sneu	$13, $13, $12
+	bnez	$13, L.259
+	lw	$13, 6($sp)
+	lw	$12, 0($13)
+	lw	$11, 0($7)
+	addui	$10, $0, 6
+	addu	$11, $11, $10
+	addu	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	lw	$12, 1($7)
+	sw	$12, 1($13)
+	addu	$13, $0, $7
+	lw	$12, base($0)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.261
+	lw	$13, 6($sp)
+	sw	$13, base($0)
+L.261:
+	lw	$13, 6($sp)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.263
+	lw	$13, 6($sp)
+	lw	$12, 1($13)
+	sw	$13, 2($12)
+L.263:
+L.259:
+	lw	$1, 6($sp)
+L.258:
+	lw	$7, 0($sp)
+	lw	$10, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	_kfree
+_kfree:
+	subui	$sp, $sp, 12
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 12($sp)
+	addu	$13, $0, $13
+	sw	$13, 9($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.266
+	la	$13, slab_page_map
+	sw	$13, 0($sp)
+	addui	$13, $0, 4
+	sw	$13, 1($sp)
+	lw	$13, 9($sp)
+	srli	$13, $13, 10
+	addu	$13, $0, $13
+	sw	$13, 2($sp)
+	jal	is_bit_on
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.266
+	lw	$13, 12($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xffff
+	addu	$13, $13, $12
+	sw	$13, 10($sp)
+	lw	$13, 10($sp)
+	addu	$13, $0, $13
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfc00
+	and	$13, $13, $12
+	addu	$13, $0, $13
+	sw	$13, 11($sp)
+	lw	$13, 11($sp)
+	lw	$13, 2($13)
+	sw	$13, 0($sp)
+	jal	is_kmalloc_cache
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.268
+	lw	$13, 11($sp)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	is_slab_obj
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.268
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	lw	$13, 11($sp)
+	lw	$13, 2($13)
+	lw	$13, 1($13)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	profile_free
+	lw	$13, 11($sp)
+	lw	$13, 2($13)
+	sw	$13, 0($sp)
+	lw	$13, 10($sp)
+	sw	$13, 1($sp)
+	jal	kmem_cache_free
+	j	L.265
+L.268:
+	la	$13, L.270
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	jal	kwarn
+	j	L.265
+L.266:
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	valid_addr
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.271
+	lw	$13, 12($sp)
+	sw	$13, 0($sp)
+	jal	get_block
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	lw	$13, 3($7)
+	sw	$13, 0($sp)
+	lw	$13, 0($7)
+	addu	$13, $0, $13
+	sw	$13, 1($sp)
+	jal	profile_free
+	addui	$13, $0, 1
+	sw	$13, 4($7)
+	lw	$13, 2($7)
+	sw	$13, 8($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.273
+	lw	$13, 8($sp)
+	lw	$13, 4($13)
+	seq	$13, $13, $0
+	bnez	$13, L.273
+	lw	$13, 2($7)
+	sw	$13, 0($sp)
+	jal	fusion
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+L.273:
+	lw	$13, 1($7)
+	sw	$13, 7($sp)
+	addu	$12, $0, $13
+	sequ	$13, $12, $0
+	bnez	$13, L.272
+	lw	$13, 7($sp)
+	lw	$13, 4($13)
+	seq	$13, $13, $0
+	bnez	$13, L.272
+	sw	$7, 0($sp)
+	jal	fusion
+	j	L.272
+L.271:
+	la	$13, L.270
+	sw	$13, 0($sp)
+	lw	$13, 12($sp)
+	sw	$13, 1($sp)
+	lw	$13, 13($sp)
+	sw	$13, 2($sp)
+	jal	kwarn
+L.272:
+L.265:
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+.global	add_free_mem
+add_free_mem:
+L.277:
+	jr	$ra
+.global	init_holes
+init_holes:
+L.278:
+	jr	$ra
+.bss
+kmalloc_sites:
+	.space	320
+slab_page_map:
+	.space	4
+caches:
+	.space	176
+kmalloc_caches:
+	.space	7
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.270:
+	.asciiz	"invalid addr %p by %p\n"
+L.231:
+	.asciiz	"no mem left %ld %ld \n"
+L.215:
+	.asciiz	"Total free words: %d\nTotal words in use: %d\n"
+L.209:
+	.asciiz	"slab is empty\n"
+L.202:
+	.asciiz	"in use"
+L.201:
+	.asciiz	"is free"
+L.200:
+	.asciiz	"0x%08lx size %4ld prev 0x%08lx next 0x%08lx ra %08lx %s\n"
+L.189:
+	.asciiz	"%-12s size %3d slabs %2d objs %4d / %4d %3d%%\n"
+L.119:
+	.asciiz	"invalid %s object %p\n"
+L.15:
+	.asciiz	"kmalloc-256"
+L.14:
+	.asciiz	"kmalloc-128"
+L.13:
+	.asciiz	"kmalloc-64"
+L.12:
+	.asciiz	"kmalloc-32"
+L.11:
+	.asciiz	"kmalloc-16"
+L.10:
+	.asciiz	"kmalloc-8"
+L.9:
+	.asciiz	"kmalloc-4"
@@ -371,6 +371,9 @@ int kprintf_vm( struct filp* file, const char *orignal_format, void *arg, struct
                         // kwarn("pid %d has sigsegv in printf\n", who->pid);
                         (void)send_sig(who, SIGSEGV);
                         return SUSPEND;
+                    }else if(resolve_user_pages(who, vformat_str, PAGE_LEN)){
+                        (void)send_sig(who, SIGSEGV);
+                        return SUSPEND;
                     }else{
                         format_ptr = (char *)get_physical_addr(vformat_str, who);
                         if (!format_ptr)
@@ -0,0 +1,1213 @@
+.global	errlist
+errlist:
+	.word	L.9
+	.word	L.10
+	.word	L.11
+	.word	L.12
+	.word	L.13
+	.word	L.14
+	.word	L.15
+	.word	L.16
+	.word	L.17
+	.word	L.18
+	.word	L.19
+	.word	L.20
+	.word	L.21
+	.word	L.22
+	.word	L.23
+	.word	L.24
+	.word	L.25
+	.word	L.26
+	.word	L.27
+	.word	L.28
+	.word	L.29
+	.word	L.30
+	.word	L.31
+	.word	L.32
+	.word	L.33
+	.word	L.34
+	.word	L.35
+	.word	L.36
+	.word	L.37
+	.word	L.38
+	.word	L.39
+	.word	L.40
+	.word	L.41
+	.word	L.42
+	.word	L.43
+	.word	L.44
+	.word	L.45
+	.word	L.46
+	.word	L.47
+	.word	L.48
+NULL_STR:
+	.asciiz	"(NULL)"
+.global	kstr_error
+.text
+kstr_error:
+	subui	$sp, $sp, 3
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 3($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.50
+	lw	$13, 3($sp)
+	subu	$13, $0, $13
+	sw	$13, 3($sp)
+L.50:
+	lw	$13, 3($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfc1b
+	sne	$13, $13, $12
+	bnez	$13, L.52
+	la	$1, L.54
+	j	L.49
+L.52:
+	lw	$13, 3($sp)
+	lhi	$12, 0xffff
+	ori	$12, $12, 0xfc1a
+	sne	$13, $13, $12
+	bnez	$13, L.55
+	la	$1, L.57
+	j	L.49
+L.55:
+	lw	$13, 3($sp)
+	sw	$13, 2($sp)
+	slt	$13, $13, $0
+	bnez	$13, L.60
+	lw	$13, 2($sp)
+	slti	$13, $13, 40
+	bnez	$13, L.58
+L.60:
+	addu	$1, $0, $0
+	j	L.49
+L.58:
+	lw	$13, 3($sp)
+	lw	$1, errlist($13)
+L.49:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	_kputnum_buf
+_kputnum_buf:
+	subui	$sp, $sp, 6
+	sw	$4, 0($sp)
+	sw	$5, 1($sp)
+	sw	$6, 2($sp)
+	sw	$7, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	addu	$6, $0, $0
+	addu	$5, $0, $0
+	lw	$13, 6($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.62
+	lw	$13, 7($sp)
+	addui	$12, $13, 1
+	sw	$12, 7($sp)
+	addui	$12, $0, 48
+	sw	$12, 0($13)
+	lw	$13, 7($sp)
+	sw	$0, 0($13)
+	addui	$1, $0, 1
+	j	L.61
+L.62:
+	lw	$7, 8($sp)
+	j	L.67
+L.64:
+	lw	$13, 6($sp)
+	sra	$13, $13, $7
+	lw	$12, 10($sp)
+	and	$4, $13, $12
+	seq	$13, $4, $0
+	bnez	$13, L.68
+	addui	$6, $0, 1
+L.68:
+	sgei	$13, $4, 10
+	bnez	$13, L.70
+	seq	$13, $6, $0
+	bnez	$13, L.71
+	lw	$13, 7($sp)
+	addui	$12, $13, 1
+	sw	$12, 7($sp)
+	addi	$12, $4, 48
+	sw	$12, 0($13)
+	addi	$5, $5, 1
+	j	L.71
+L.70:
+	lw	$13, 7($sp)
+	addui	$12, $13, 1
+	sw	$12, 7($sp)
+	subi	$12, $4, 10
+	addi	$12, $12, 65
+	sw	$12, 0($13)
+	addi	$5, $5, 1
+L.71:
+L.65:
+	lw	$13, 9($sp)
+	sub	$7, $7, $13
+L.67:
+	sge	$13, $7, $0
+	bnez	$13, L.64
+	lw	$13, 7($sp)
+	sw	$0, 0($13)
+	addu	$1, $0, $5
+L.61:
+	lw	$4, 0($sp)
+	lw	$5, 1($sp)
+	lw	$6, 2($sp)
+	lw	$7, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	kputud_buf
+kputud_buf:
+	subui	$sp, $sp, 5
+	sw	$5, 0($sp)
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lhi	$7, 0x3b9a
+	ori	$7, $7, 0xca00
+	addu	$6, $0, $0
+	lw	$13, 5($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.78
+	lw	$13, 6($sp)
+	addui	$12, $13, 1
+	sw	$12, 6($sp)
+	addui	$12, $0, 48
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	sw	$0, 0($13)
+	addui	$1, $0, 1
+	j	L.74
+L.77:
+	addui	$13, $0, 10
+	divu	$7, $7, $13
+L.78:
+	lw	$13, 5($sp)
+	sgtu	$13, $7, $13
+	bnez	$13, L.77
+	j	L.81
+L.80:
+	lw	$13, 5($sp)
+	divu	$13, $13, $7
+	addu	$5, $0, $13
+	lw	$13, 6($sp)
+	addui	$12, $13, 1
+	sw	$12, 6($sp)
+	remi	$12, $5, 10
+	addi	$12, $12, 48
+	sw	$12, 0($13)
+	addui	$13, $0, 10
+	divu	$7, $7, $13
+	addui	$13, $0, 1
+	addu	$6, $6, $13
+L.81:
+	sneu	$13, $7, $0
+	bnez	$13, L.80
+	lw	$13, 6($sp)
+	sw	$0, 0($13)
+	addu	$1, $0, $6
+L.74:
+	lw	$5, 0($sp)
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	kputd_buf
+kputd_buf:
+	subui	$sp, $sp, 6
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	sw	$0, 5($sp)
+	lw	$13, 6($sp)
+	sge	$13, $13, $0
+	bnez	$13, L.84
+	lw	$13, 7($sp)
+	addui	$12, $13, 1
+	sw	$12, 7($sp)
+	addui	$12, $0, 45
+	sw	$12, 0($13)
+	lw	$13, 5($sp)
+	addi	$13, $13, 1
+	sw	$13, 5($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	lw	$12, 6($sp)
+	mult	$13, $13, $12
+	sw	$13, 6($sp)
+L.84:
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	kputud_buf
+	addu	$13, $0, $1
+	lw	$12, 5($sp)
+	add	$1, $13, $12
+L.83:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	kputs_vm_buf
+kputs_vm_buf:
+	subui	$sp, $sp, 4
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	lw	$7, 4($sp)
+	addu	$6, $0, $0
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	addu	$13, $0, $13
+	addu	$7, $13, $7
+	j	L.88
+L.87:
+	lw	$13, 6($sp)
+	addui	$12, $13, 1
+	sw	$12, 6($sp)
+	addu	$12, $0, $7
+	addui	$7, $12, 1
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+	addi	$6, $6, 1
+L.88:
+	lw	$13, 0($7)
+	sne	$13, $13, $0
+	bnez	$13, L.87
+	lw	$13, 6($sp)
+	sw	$0, 0($13)
+	addu	$1, $0, $6
+L.86:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	tty_non_init_write
+tty_non_init_write:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x1000
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	tty_write_rex
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.90:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+flush_buffer_data:
+	subui	$sp, $sp, 9
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 9($sp)
+	lw	$12, 105($13)
+	sw	$12, 0($sp)
+	lw	$11, 10($sp)
+	sw	$11, 1($sp)
+	lw	$11, 11($sp)
+	addu	$11, $0, $11
+	sw	$11, 2($sp)
+	lw	$12, 4($12)
+	sw	$12, 3($sp)
+	lw	$13, 103($13)
+	jalr	$13
+	addu	$13, $0, $1
+	sw	$13, 8($sp)
+	lw	$13, 9($sp)
+	addui	$13, $13, 104
+	lw	$12, 0($13)
+	lw	$11, 8($sp)
+	add	$12, $12, $11
+	sw	$12, 0($13)
+L.91:
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+flush_buffer:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$13, 102($13)
+	sle	$13, $13, $0
+	bnez	$13, L.93
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 102($13)
+	sw	$13, 2($sp)
+	jal	flush_buffer_data
+	lw	$13, 5($sp)
+	sw	$0, 102($13)
+L.93:
+L.92:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+add_char_to_buffer:
+	subui	$sp, $sp, 5
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	lw	$12, 102($13)
+	lw	$13, 101($13)
+	slt	$13, $12, $13
+	bnez	$13, L.96
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	flush_buffer
+L.96:
+	lw	$13, 5($sp)
+	addui	$13, $13, 102
+	lw	$12, 0($13)
+	addi	$11, $12, 1
+	sw	$11, 0($13)
+	lw	$13, 5($sp)
+	addu	$13, $12, $13
+	lw	$12, 6($sp)
+	sw	$12, 0($13)
+L.95:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+append_buffer:
+	subui	$sp, $sp, 8
+	sw	$7, 3($sp)
+	sw	$11, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	lw	$13, 10($sp)
+	lw	$12, 8($sp)
+	lw	$12, 101($12)
+	sle	$13, $13, $12
+	bnez	$13, L.99
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	flush_buffer
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	lw	$13, 9($sp)
+	sw	$13, 1($sp)
+	lw	$13, 10($sp)
+	sw	$13, 2($sp)
+	jal	flush_buffer_data
+	j	L.98
+L.99:
+	lw	$13, 8($sp)
+	lw	$12, 10($sp)
+	lw	$11, 102($13)
+	add	$12, $12, $11
+	lw	$13, 101($13)
+	slt	$13, $12, $13
+	bnez	$13, L.101
+	lw	$13, 8($sp)
+	sw	$13, 0($sp)
+	jal	flush_buffer
+L.101:
+	lw	$13, 8($sp)
+	addui	$12, $13, 102
+	lw	$11, 0($12)
+	addu	$7, $11, $13
+	lw	$13, 0($12)
+	lw	$11, 10($sp)
+	add	$13, $13, $11
+	sw	$13, 0($12)
+	j	L.104
+L.103:
+	addu	$13, $0, $7
+	addui	$7, $13, 1
+	lw	$12, 9($sp)
+	addui	$11, $12, 1
+	sw	$11, 9($sp)
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.104:
+	lw	$13, 10($sp)
+	subi	$12, $13, 1
+	sw	$12, 10($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.103
+L.98:
+	lw	$7, 3($sp)
+	lw	$11, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+fill_padding:
+	subui	$sp, $sp, 6
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$12, 8($sp)
+	lw	$11, 102($13)
+	add	$12, $12, $11
+	lw	$13, 101($13)
+	slt	$13, $12, $13
+	bnez	$13, L.110
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	flush_buffer
+	j	L.110
+L.109:
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	jal	add_char_to_buffer
+L.110:
+	lw	$13, 8($sp)
+	subi	$12, $13, 1
+	sw	$12, 8($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.109
+L.106:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+pass_number:
+	subui	$sp, $sp, 31
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, 31($sp)
+	lw	$6, 0($13)
+	sw	$0, 10($sp)
+	addu	$7, $0, $0
+	j	L.114
+L.113:
+	addu	$13, $0, $7
+	addi	$7, $13, 1
+	addu	$12, $0, $6
+	addui	$6, $12, 1
+	addui	$11, $sp, 11
+	addu	$13, $13, $11
+	lw	$12, 0($12)
+	sw	$12, 0($13)
+L.114:
+	lw	$13, 0($6)
+	subi	$13, $13, 48
+	addu	$13, $0, $13
+	addui	$12, $0, 10
+	sgeu	$13, $13, $12
+	bnez	$13, L.116
+	slti	$13, $7, 19
+	bnez	$13, L.113
+L.116:
+	sle	$13, $7, $0
+	bnez	$13, L.117
+	addui	$13, $sp, 11
+	addu	$13, $7, $13
+	sw	$0, 0($13)
+	addui	$13, $sp, 11
+	sw	$13, 0($sp)
+	addui	$13, $sp, 9
+	sw	$13, 1($sp)
+	addui	$13, $0, 10
+	sw	$13, 2($sp)
+	jal	strtol
+	addu	$13, $0, $1
+	sw	$13, 10($sp)
+L.117:
+	lw	$13, 31($sp)
+	sw	$6, 0($13)
+	lw	$1, 10($sp)
+L.112:
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 31
+	jr	$ra
+.global	kprintf_vm
+kprintf_vm:
+	subui	$sp, $sp, 141
+	sw	$2, 5($sp)
+	sw	$3, 6($sp)
+	sw	$4, 7($sp)
+	sw	$5, 8($sp)
+	sw	$6, 9($sp)
+	sw	$7, 10($sp)
+	sw	$12, 11($sp)
+	sw	$13, 12($sp)
+	sw	$ra, 13($sp)
+	addui	$6, $sp, 20
+	lw	$13, 142($sp)
+	sw	$13, 140($sp)
+	sw	$6, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 106
+	sw	$13, 2($sp)
+	jal	memset
+	addui	$13, $0, 101
+	sw	$13, 101($6)
+	lw	$13, 141($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.121
+	lw	$13, 141($sp)
+	lw	$13, 5($13)
+	lw	$13, 6($13)
+	lw	$13, 2($13)
+	sw	$13, 19($sp)
+	j	L.122
+L.121:
+	la	$13, tty_non_init_write
+	sw	$13, 19($sp)
+L.122:
+	lw	$13, 19($sp)
+	sw	$13, 127($sp)
+	lw	$13, 127($sp)
+	sw	$13, 103($6)
+	lw	$13, 141($sp)
+	sw	$13, 105($6)
+	j	L.124
+L.123:
+	lw	$13, 140($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 37
+	bnez	$13, L.126
+	addui	$13, $0, 1
+	lw	$12, 140($sp)
+	addui	$12, $12, 1
+	sw	$12, 140($sp)
+	sw	$13, 139($sp)
+	addui	$3, $sp, 128
+	addui	$2, $0, 32
+	addu	$13, $0, $0
+	addu	$7, $0, $13
+	addu	$4, $0, $13
+	lw	$13, 140($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 45
+	bnez	$13, L.128
+	lw	$13, 140($sp)
+	addui	$13, $13, 1
+	sw	$13, 140($sp)
+	addui	$13, $0, 2
+	sw	$13, 139($sp)
+L.128:
+	lw	$13, 140($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 48
+	bnez	$13, L.130
+	addui	$2, $0, 48
+	lw	$13, 140($sp)
+	addui	$13, $13, 1
+	sw	$13, 140($sp)
+L.130:
+	addui	$13, $sp, 140
+	sw	$13, 0($sp)
+	jal	pass_number
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	lw	$13, 140($sp)
+	lw	$13, 0($13)
+	snei	$13, $13, 46
+	bnez	$13, L.132
+	lw	$13, 140($sp)
+	addui	$13, $13, 1
+	sw	$13, 140($sp)
+	addui	$2, $0, 48
+	addui	$13, $sp, 140
+	sw	$13, 0($sp)
+	jal	pass_number
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+L.132:
+	lw	$13, 140($sp)
+	lw	$13, 0($13)
+	sw	$13, 18($sp)
+	seqi	$13, $13, 108
+	bnez	$13, L.136
+	lw	$13, 18($sp)
+	snei	$13, $13, 122
+	bnez	$13, L.134
+L.136:
+	lw	$13, 140($sp)
+	addui	$13, $13, 1
+	sw	$13, 140($sp)
+L.134:
+	lw	$13, 140($sp)
+	lw	$13, 0($13)
+	sw	$13, 17($sp)
+	lw	$13, 17($sp)
+	sw	$13, 16($sp)
+	addui	$12, $0, 99
+	seq	$13, $13, $12
+	bnez	$13, L.153
+	lw	$13, 16($sp)
+	seqi	$13, $13, 100
+	bnez	$13, L.141
+	lw	$13, 16($sp)
+	slt	$13, $13, $12
+	bnez	$13, L.137
+L.154:
+	lw	$13, 17($sp)
+	sw	$13, 15($sp)
+	slti	$13, $13, 111
+	bnez	$13, L.137
+	lw	$13, 15($sp)
+	sgti	$13, $13, 120
+	bnez	$13, L.137
+	lw	$13, 15($sp)
+	lw	$13, L.155-111($13)
+	jr	$13
+.data
+L.155:
+	.word	L.142
+	.word	L.143
+	.word	L.137
+	.word	L.137
+	.word	L.146
+	.word	L.137
+	.word	L.140
+	.word	L.137
+	.word	L.137
+	.word	L.145
+.text
+L.140:
+	lw	$13, 143($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	sw	$3, 1($sp)
+	jal	kputud_buf
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.138
+L.141:
+	lw	$13, 143($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	sw	$3, 1($sp)
+	jal	kputd_buf
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.138
+L.142:
+	lw	$13, 143($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	sw	$3, 1($sp)
+	addui	$13, $0, 30
+	sw	$13, 2($sp)
+	addui	$13, $0, 3
+	sw	$13, 3($sp)
+	addui	$13, $0, 7
+	sw	$13, 4($sp)
+	jal	_kputnum_buf
+	addu	$13, $0, $1
+	add	$7, $7, $13
+	addui	$3, $sp, 128
+	j	L.138
+L.143:
+	la	$13, L.144
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	sw	$3, 2($sp)
+	jal	kputs_vm_buf
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	addu	$3, $7, $3
+L.145:
+	lw	$13, 143($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($sp)
+	sw	$3, 1($sp)
+	addui	$13, $0, 28
+	sw	$13, 2($sp)
+	addui	$13, $0, 4
+	sw	$13, 3($sp)
+	addui	$13, $0, 15
+	sw	$13, 4($sp)
+	jal	_kputnum_buf
+	addu	$13, $0, $1
+	add	$7, $7, $13
+	addui	$3, $sp, 128
+	j	L.138
+L.146:
+	lw	$13, 143($sp)
+	lw	$13, 0($13)
+	sw	$13, 126($sp)
+	lw	$13, 144($sp)
+	sw	$13, 14($sp)
+	lw	$12, 16($13)
+	addu	$12, $0, $12
+	sequ	$13, $12, $0
+	bnez	$13, L.147
+	lw	$13, 126($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 1
+	sw	$13, 1($sp)
+	lw	$13, 14($sp)
+	sw	$13, 2($sp)
+	jal	is_vaddr_ok
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.147
+	lw	$13, 144($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	jal	send_sig
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+	j	L.119
+L.147:
+	lw	$13, 144($sp)
+	sw	$13, 0($sp)
+	lw	$13, 126($sp)
+	sw	$13, 1($sp)
+	addui	$13, $0, 1024
+	sw	$13, 2($sp)
+	jal	resolve_user_pages
+	addu	$13, $0, $1
+	seq	$13, $13, $0
+	bnez	$13, L.149
+	lw	$13, 144($sp)
+	sw	$13, 0($sp)
+	addui	$13, $0, 11
+	sw	$13, 1($sp)
+	jal	send_sig
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xfc1a
+	j	L.119
+L.149:
+	lw	$13, 144($sp)
+	lw	$13, 16($13)
+	addu	$13, $0, $13
+	lw	$12, 126($sp)
+	addu	$3, $13, $12
+	addu	$13, $0, $3
+	sneu	$13, $13, $0
+	bnez	$13, L.151
+	la	$3, NULL_STR
+L.151:
+	sw	$3, 0($sp)
+	jal	strlen
+	addu	$13, $0, $1
+	addu	$7, $0, $13
+	j	L.138
+L.153:
+L.137:
+	lw	$13, 143($sp)
+	lw	$13, 0($13)
+	sw	$13, 0($3)
+	addui	$7, $0, 1
+L.138:
+	lw	$13, 143($sp)
+	addui	$13, $13, 1
+	sw	$13, 143($sp)
+	lw	$13, 140($sp)
+	addui	$13, $13, 1
+	sw	$13, 140($sp)
+	sub	$5, $5, $7
+	sle	$13, $4, $0
+	bnez	$13, L.157
+	sle	$13, $4, $7
+	bnez	$13, L.159
+	addui	$2, $0, 48
+	sub	$5, $4, $7
+	j	L.160
+L.159:
+	addu	$7, $0, $4
+L.160:
+L.157:
+	sle	$13, $5, $0
+	bnez	$13, L.161
+	lw	$13, 139($sp)
+	snei	$13, $13, 1
+	bnez	$13, L.163
+	sw	$6, 0($sp)
+	sw	$2, 1($sp)
+	sw	$5, 2($sp)
+	jal	fill_padding
+	sw	$6, 0($sp)
+	sw	$3, 1($sp)
+	sw	$7, 2($sp)
+	jal	append_buffer
+	j	L.127
+L.163:
+	sw	$6, 0($sp)
+	sw	$3, 1($sp)
+	sw	$7, 2($sp)
+	jal	append_buffer
+	sw	$6, 0($sp)
+	sw	$2, 1($sp)
+	sw	$5, 2($sp)
+	jal	fill_padding
+	j	L.127
+L.161:
+	sw	$6, 0($sp)
+	sw	$3, 1($sp)
+	sw	$7, 2($sp)
+	jal	append_buffer
+	j	L.127
+L.126:
+	sw	$6, 0($sp)
+	lw	$13, 140($sp)
+	addui	$12, $13, 1
+	sw	$12, 140($sp)
+	lw	$13, 0($13)
+	sw	$13, 1($sp)
+	jal	add_char_to_buffer
+L.127:
+L.124:
+	lw	$13, 140($sp)
+	lw	$13, 0($13)
+	sne	$13, $13, $0
+	bnez	$13, L.123
+	sw	$6, 0($sp)
+	jal	flush_buffer
+	lw	$1, 104($6)
+L.119:
+	lw	$2, 5($sp)
+	lw	$3, 6($sp)
+	lw	$4, 7($sp)
+	lw	$5, 8($sp)
+	lw	$6, 9($sp)
+	lw	$7, 10($sp)
+	lw	$12, 11($sp)
+	lw	$13, 12($sp)
+	lw	$ra, 13($sp)
+	addui	$sp, $sp, 141
+	jr	$ra
+.global	filp_kprint
+filp_kprint:
+	subui	$sp, $sp, 7
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$7, $sp, 8
+	addui	$7, $7, 1
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, proc_table($0)
+	sw	$13, 3($sp)
+	jal	kprintf_vm
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.165:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	kprintf
+kprintf:
+	subui	$sp, $sp, 7
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$7, $sp, 7
+	addui	$7, $7, 1
+	lw	$13, tty1_filp($0)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, proc_table($0)
+	sw	$13, 3($sp)
+	jal	kprintf_vm
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.166:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	kprintf2
+kprintf2:
+	subui	$sp, $sp, 7
+	sw	$7, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	addui	$7, $sp, 7
+	addui	$7, $7, 1
+	lw	$13, tty2_filp($0)
+	sw	$13, 0($sp)
+	lw	$13, 7($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, proc_table($0)
+	sw	$13, 3($sp)
+	jal	kprintf_vm
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.167:
+	lw	$7, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	klog
+klog:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$7, $sp, 8
+	addui	$7, $7, 1
+	jal	get_uptime
+	addu	$13, $0, $1
+	la	$12, L.169
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	jal	kprintf2
+	lw	$13, tty2_filp($0)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, proc_table($0)
+	sw	$13, 3($sp)
+	jal	kprintf_vm
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.168:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	kerror
+kerror:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$7, $sp, 8
+	addui	$7, $7, 1
+	jal	get_uptime
+	addu	$13, $0, $1
+	la	$12, L.171
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	jal	kprintf2
+	lw	$13, tty2_filp($0)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, proc_table($0)
+	sw	$13, 3($sp)
+	jal	kprintf_vm
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.170:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.global	kwarn
+kwarn:
+	subui	$sp, $sp, 8
+	sw	$7, 4($sp)
+	sw	$12, 5($sp)
+	sw	$13, 6($sp)
+	sw	$ra, 7($sp)
+	addui	$7, $sp, 8
+	addui	$7, $7, 1
+	jal	get_uptime
+	addu	$13, $0, $1
+	la	$12, L.173
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	jal	kprintf2
+	lw	$13, tty2_filp($0)
+	sw	$13, 0($sp)
+	lw	$13, 8($sp)
+	sw	$13, 1($sp)
+	sw	$7, 2($sp)
+	lw	$13, proc_table($0)
+	sw	$13, 3($sp)
+	jal	kprintf_vm
+	addu	$13, $0, $1
+	addu	$1, $0, $13
+L.172:
+	lw	$7, 4($sp)
+	lw	$12, 5($sp)
+	lw	$13, 6($sp)
+	lw	$ra, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+.extern	tty1_filp 1
+.extern	tty2_filp 1
+.extern	tty2_dev 1
+.extern	tty_dev 1
+.extern	devices 9
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.173:
+	.asciiz	"[%d] WARN: "
+L.171:
+	.asciiz	"[%d] ERROR: "
+L.169:
+	.asciiz	"[%d] "
+L.144:
+	.asciiz	"0x"
+L.57:
+	.asciiz	"SUSPEND"
+L.54:
+	.asciiz	"DONTREPLY"
+L.48:
+	.asciiz	"ENOTEMPTY"
+L.47:
+	.asciiz	"ENOSYS"
+L.46:
+	.asciiz	"ENOLCK"
+L.45:
+	.asciiz	"ENAMETOOLONG"
+L.44:
+	.asciiz	"EDEADLK"
+L.43:
+	.asciiz	"ERANGE"
+L.42:
+	.asciiz	"EDOM"
+L.41:
+	.asciiz	"EPIPE"
+L.40:
+	.asciiz	"EMLINK"
+L.39:
+	.asciiz	"EROFS"
+L.38:
+	.asciiz	"ESPIPE"
+L.37:
+	.asciiz	"ENOSPC"
+L.36:
+	.asciiz	"EFBIG"
+L.35:
+	.asciiz	"ETXTBSY"
+L.34:
+	.asciiz	"ENOTTY"
+L.33:
+	.asciiz	"EMFILE"
+L.32:
+	.asciiz	"ENFILE"
+L.31:
+	.asciiz	"EINVAL"
+L.30:
+	.asciiz	"EISDIR"
+L.29:
+	.asciiz	"ENOTDIR"
+L.28:
+	.asciiz	"ENODEV"
+L.27:
+	.asciiz	"EXDEV"
+L.26:
+	.asciiz	"EEXIST"
+L.25:
+	.asciiz	"EBUSY"
+L.24:
+	.asciiz	"ENOTBLK"
+L.23:
+	.asciiz	"EFAULT"
+L.22:
+	.asciiz	"EACCES"
+L.21:
+	.asciiz	"ENOMEM"
+L.20:
+	.asciiz	"EAGAIN"
+L.19:
+	.asciiz	"ECHILD"
+L.18:
+	.asciiz	"EBADF"
+L.17:
+	.asciiz	"ENOEXEC"
+L.16:
+	.asciiz	"E2BIG"
+L.15:
+	.asciiz	"ENXIO"
+L.14:
+	.asciiz	"EIO"
+L.13:
+	.asciiz	"EINTR"
+L.12:
+	.asciiz	"ESRCH"
+L.11:
+	.asciiz	"ENOENT"
+L.10:
+	.asciiz	"EPERM"
+L.9:
+	.asciiz	"OK"
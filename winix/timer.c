@@ -1,32 +1,74 @@
 /**
- * 
+ *
  * Winix timer module
  *
+ * Pending timers are kept in a hierarchical timing wheel. Level 0 has
+ * one slot per tick for the next WHEEL_SIZE ticks, and each level above
+ * has slots WHEEL_SIZE times as wide as the one below. Timers are put in
+ * the slot of their timeout in the lowest level that covers it, and are
+ * moved down a level (cascaded) when the level below wraps around to
+ * their slot. Inserting and removing a timer take constant time, and
+ * do_ticks() only looks at the slot of the current tick.
+ *
+ * High resolution timers (TIMER_HIRES) are due part way through a tick.
+ * They wait in the wheel until that tick, and then in the split list,
+ * sorted by their offset into the tick, until kernel/clock.c runs them.
+ *
  * @author Bruce Tan
  * @email brucetansh@gmail.com
- * 
+ *
  * @author Paul Monigatti
  * @email paulmoni@waikato.ac.nz
- * 
+ *
  * @create date 2017-08-23 06:13:01
- * 
+ *
 */
 #include <kernel/kernel.h>
 #include <winix/rex.h>
 #include <kernel/clock.h>
 #include <kernel/exception.h>
+#include <winix/bitmap.h>
+
+#define WHEEL_BITS          5
+#define WHEEL_SIZE          (1 << WHEEL_BITS)
+#define WHEEL_MASK          (WHEEL_SIZE - 1)
+#define WHEEL_LEVELS        5
+#define LEVEL_SHIFT(n)      ((n) * WHEEL_BITS)
+// timeouts further away than this are kept in the last slot of the top
+// level, until they come within range
+#define WHEEL_RANGE         ((clock_t)1 << LEVEL_SHIFT(WHEEL_LEVELS))
+
+#define SLOT_MASK(slot)     (0x80000000U >> (slot))
+
+// the split list is kept in the slot after the wheel
+#define SPLIT_SLOT          (WHEEL_LEVELS * WHEEL_SIZE)
 
+// slot i of level n is wheel[n * WHEEL_SIZE + i]
+PRIVATE struct timer *wheel[WHEEL_LEVELS * WHEEL_SIZE + 1];
 
-// a linked list of pending timers to be alarmed
-PRIVATE struct timer *pending_timers = NULL;
+// bit i of wheel_map[n] is set if slot i of level n is not empty
+PRIVATE unsigned int wheel_map[WHEEL_LEVELS];
+
+// the next tick to be run, lags behind the uptime until do_ticks()
+// catches up
+PRIVATE clock_t wheel_time;
+
+void init_timer(){
+    memset(wheel, 0, sizeof(wheel));
+    memset(wheel_map, 0, sizeof(wheel_map));
+    wheel_time = get_uptime();
+    next_timeout = TIMER_NEVER;
+}
 
 void kreport_timers(){
-    struct timer *mq = pending_timers;
-    
-    while(mq != NULL)
-    {
-        klog("timer timeout %d from %d\n",mq->time_out, mq->proc_nr);
-        mq = mq->next;
+    struct timer *mq;
+    int i;
+
+    for(i = 0; i <= SPLIT_SLOT; i++){
+        for(mq = wheel[i]; mq != NULL; mq = mq->next){
+            klog("timer timeout %d+%d from %d, level %d slot %d\n", mq->time_out,
+                mq->offset, mq->proc_nr, i / WHEEL_SIZE, i % WHEEL_SIZE);
+        }
     }
     klog("next timeout %d\n",next_timeout);
 }
@@ -41,92 +83,320 @@ int new_timer(int procnr_from, struct timer* curr, clock_t timeout, timerhandler
         curr->time_out = get_uptime() + timeout;
         curr->handler = watchdog;
         curr->proc_nr = procnr_from;
+        curr->offset = 0;
+        curr->flags &= ~TIMER_HIRES;
         curr->next = NULL;
         insert_timer(curr);
         return 0;
     }
-    
+
     // PANIC("No timer left");
     return -EINVAL;
 }
 
+/**
+ * distance from slot from to the next non empty slot of a level,
+ * counting slot from itself last
+ * @param level
+ * @param from
+ * @return 1 to WHEEL_SIZE, or -1 if the level is empty
+ */
+PRIVATE int next_slot(int level, int from){
+    unsigned int map = wheel_map[level];
+    int slot;
+
+    if(!map)
+        return -1;
+    from = (from + 1) & WHEEL_MASK;
+    slot = bitmap_first_set(map & (0xffffffffU >> from));
+    if(slot < 0)
+        slot = bitmap_first_set(map);
+    return ((slot - from) & WHEEL_MASK) + 1;
+}
 
 /**
- * get the most recent alarm in the linkedlist
- * @return 
+ * the tick at which a slot of the wheel is run, or cascaded into the
+ * level below
+ * @param level
+ * @param slot
+ * @return
  */
-struct timer* dequeue_alarm(){
-    struct timer* mq;
-    mq = pending_timers;
-    if(!mq)
-        PANIC("No alarm in the queue");
-    
-    pending_timers = mq->next;
-    if(pending_timers)
-        next_timeout = pending_timers->time_out;
+PRIVATE clock_t slot_time(int level, int slot){
+    clock_t cur = wheel_time >> LEVEL_SHIFT(level);
+    int dist;
+
+    if(level == 0 && slot == (cur & WHEEL_MASK))
+        return wheel_time;
+    // the current slot of an upper level was cascaded as the wheel entered it
+    dist = (slot - (int)(cur & WHEEL_MASK)) & WHEEL_MASK;
+    if(dist == 0)
+        dist = WHEEL_SIZE;
+    return (cur + dist) << LEVEL_SHIFT(level);
+}
+
+/**
+ * the earliest tick at which the wheel has work to do, timers to run or
+ * to cascade. This is a lower bound on the earliest timeout
+ * @return
+ */
+PRIVATE clock_t wheel_next_event(){
+    clock_t event, next = TIMER_NEVER;
+    int level, dist, cur;
+
+    for(level = 0; level < WHEEL_LEVELS; level++){
+        cur = (wheel_time >> LEVEL_SHIFT(level)) & WHEEL_MASK;
+        // slot cur of level 0 is checked as well, it has not been run yet
+        dist = next_slot(level, level == 0 ? cur - 1 : cur);
+        if(dist < 0)
+            continue;
+        event = slot_time(level, (cur + dist - (level == 0)) & WHEEL_MASK);
+        if(event < next)
+            next = event;
+    }
+    return next;
+}
+
+/**
+ * put a timer in the wheel, relative to wheel_time
+ * @param timer
+ */
+PRIVATE void wheel_add(struct timer *timer){
+    clock_t expires = timer->time_out;
+    clock_t delta;
+    int level, slot, i;
+
+    if(expires < wheel_time)
+        expires = wheel_time;
+    delta = expires - wheel_time;
+    if(delta >= WHEEL_RANGE){
+        delta = WHEEL_RANGE - 1;
+        expires = wheel_time + delta;
+    }
+    for(level = 0; level < WHEEL_LEVELS - 1; level++){
+        if(delta < ((clock_t)1 << LEVEL_SHIFT(level + 1)))
+            break;
+    }
+    slot = (expires >> LEVEL_SHIFT(level)) & WHEEL_MASK;
+    i = level * WHEEL_SIZE + slot;
+
+    // appended, so that timers of the same tick run in the order they were set
+    timer->wheel_slot = i;
+    timer->next = NULL;
+    if(wheel[i]){
+        timer->prev = wheel[i]->prev;
+        timer->prev->next = timer;
+        wheel[i]->prev = timer;
+    }else{
+        timer->prev = timer;
+        wheel[i] = timer;
+    }
+    wheel_map[level] |= SLOT_MASK(slot);
+}
+
+/**
+ * take a timer off its slot, the prev of the first timer of a slot
+ * is the last one
+ * @param timer
+ */
+PRIVATE void wheel_del(struct timer *timer){
+    int i = timer->wheel_slot;
+    struct timer *head = wheel[i];
+
+    if(timer == head)
+        wheel[i] = timer->next;
     else
-        next_timeout = TIMER_NEVER;
+        timer->prev->next = timer->next;
+    if(timer->next)
+        timer->next->prev = timer->prev;
+    else if(timer != head)
+        head->prev = timer->prev;
+    if(!wheel[i] && i != SPLIT_SLOT)
+        wheel_map[i / WHEEL_SIZE] &= ~SLOT_MASK(i % WHEEL_SIZE);
+    timer->next = timer->prev = NULL;
+}
+
+/**
+ * put a high resolution timer that is due in the current tick on the
+ * split list, in the order of its offset into the tick
+ * @param timer
+ */
+void insert_split(struct timer *timer){
+    struct timer *curr = wheel[SPLIT_SLOT];
+
+    while(curr && curr->offset <= timer->offset)
+        curr = curr->next;
+
+    timer->wheel_slot = SPLIT_SLOT;
+    timer->next = curr;
+    if(!wheel[SPLIT_SLOT]){
+        timer->prev = timer;
+        wheel[SPLIT_SLOT] = timer;
+    }else if(!curr){
+        timer->prev = wheel[SPLIT_SLOT]->prev;
+        timer->prev->next = timer;
+        wheel[SPLIT_SLOT]->prev = timer;
+    }else{
+        timer->prev = curr->prev;
+        if(curr == wheel[SPLIT_SLOT])
+            wheel[SPLIT_SLOT] = timer;
+        else
+            curr->prev->next = timer;
+        curr->prev = timer;
+    }
+}
+
+/**
+ * offset into the current tick of the first timer on the split list
+ * @return the offset, or -1 if the list is empty
+ */
+int next_split(){
+    return wheel[SPLIT_SLOT] ? wheel[SPLIT_SLOT]->offset : -1;
+}
+
+/**
+ * get the next timer on the split list that is due by elapsed counts
+ * into the current tick
+ *
+ * NOTE: this method is called during exception context
+ * @param elapsed
+ * @return the timer, or NULL if none is due
+ */
+struct timer* dequeue_split(int elapsed){
+    struct timer* mq = wheel[SPLIT_SLOT];
+
+    if(!mq || mq->offset > elapsed)
+        return NULL;
+    wheel_del(mq);
     mq->flags &= ~TIMER_INUSE;
-    mq->next = NULL;
     return mq;
 }
 
 /**
- * insert a new timer into the system, 
- * insertion sort is used to sort the timers
- * @param timer 
+ * move the timers of the current slot of a level down, and of the level
+ * above as well if this level has wrapped around
+ * @param level
  */
-void insert_timer(struct timer *timer){
-    struct timer *prev = NULL;
-    struct timer *curr;
-    clock_t new_timeout;
+PRIVATE void cascade(int level){
+    struct timer *timer, *next;
+    int slot = (wheel_time >> LEVEL_SHIFT(level)) & WHEEL_MASK;
+    int i = level * WHEEL_SIZE + slot;
 
-    disable_interrupt();
-    curr = pending_timers;
-    new_timeout = timer->time_out;
-    while(curr && curr->time_out < new_timeout){
-        prev = curr;
-        curr = curr->next;
+    timer = wheel[i];
+    wheel[i] = NULL;
+    wheel_map[level] &= ~SLOT_MASK(slot);
+    while(timer){
+        next = timer->next;
+        wheel_add(timer);
+        timer = next;
     }
+    if(slot == 0 && level + 1 < WHEEL_LEVELS)
+        cascade(level + 1);
+}
 
-    if(prev){
-        prev->next = timer;
-        timer->next = curr;
-    }else{
-        timer->next = pending_timers;
-        pending_timers = timer;
-        next_timeout = pending_timers->time_out;
+/**
+ * get the next timer that is due by now, the wheel is turned up to now
+ * as it goes
+ * 
+ * NOTE: this method is called during exception context
+ * @param now
+ * @return the timer, or NULL if none is due
+ */
+struct timer* dequeue_alarm(clock_t now){
+    struct timer* mq;
+    int slot, step, dist;
+
+    while(wheel_time <= now){
+        slot = wheel_time & WHEEL_MASK;
+        if((mq = wheel[slot])){
+            wheel_del(mq);
+            if((mq->flags & TIMER_HIRES) && mq->offset){
+                insert_split(mq);
+                continue;
+            }
+            mq->flags &= ~TIMER_INUSE;
+            return mq;
+        }
+
+        // skip the empty slots up to the next timer, the end of level 0, or now
+        step = WHEEL_SIZE - slot;
+        dist = next_slot(0, slot);
+        if(dist > 0 && dist < step)
+            step = dist;
+        if(now + 1 - wheel_time < step)
+            step = now + 1 - wheel_time;
+        wheel_time += step;
+        if(!(wheel_time & WHEEL_MASK))
+            cascade(1);
     }
-    timer->flags &= TIMER_INUSE;
+    next_timeout = wheel_next_event();
+    return NULL;
+}
+
+/**
+ * the value in [first, last] with the most trailing zero bits
+ */
+PRIVATE clock_t most_aligned(clock_t first, clock_t last){
+    clock_t mask = ~(clock_t)0;
+
+    while((mask << 1) && (last & (mask << 1)) >= first)
+        mask <<= 1;
+    return last & mask;
+}
+
+/**
+ * Pick the time a timer with slack goes off at, out of slack timer counts
+ * from offset counts into tick. This is a tick if there is one in reach,
+ * so that no split is needed, and the tick or offset with the most trailing
+ * zero bits, which nearby timers of other processes are likely to share.
+ * @param tick      due tick, updated in place
+ * @param offset    timer counts into the tick, updated in place
+ * @param slack
+ */
+void slack_deadline(clock_t* tick, int* offset, clock_t slack){
+    clock_t first, last;
+
+    if(!slack)
+        return;
+    // ticks in reach, counted from tick
+    first = *offset ? 1 : 0;
+    last = (*offset + slack) / TICK_COUNTS;
+    if(first <= last){
+        *tick = most_aligned(*tick + first, *tick + last);
+        *offset = 0;
+        return;
+    }
+    *offset = (int)most_aligned(*offset, *offset + slack);
+}
+
+/**
+ * insert a new timer into the system
+ * @param timer
+ */
+void insert_timer(struct timer *timer){
+    clock_t event;
+
+    disable_interrupt();
+    wheel_add(timer);
+    event = slot_time(timer->wheel_slot / WHEEL_SIZE, timer->wheel_slot % WHEEL_SIZE);
+    if(event < next_timeout)
+        next_timeout = event;
+    timer->flags &= TIMER_INUSE | TIMER_HIRES;
 
     enable_interrupt();
-    
+
     // if(is_debugging_timer())
     //     kreport_timers();
 }
 
 /**
- * remove timer from the pending_timers
- * @param timer 
+ * remove timer from the wheel or the split list, next_timeout is left as it is, and
+ * at worst wakes do_ticks() up for nothing
+ * @param timer
  */
 void remove_timer(struct timer *timer){
-    struct timer *prev = NULL;
-    struct timer *curr;
-
     disable_interrupt();
-    curr = pending_timers;
-    while(curr && curr != timer){
-        prev = curr;
-        curr = curr->next;
-    }
-
-    if(prev){
-        prev->next = curr->next;
-    }else{
-        pending_timers = pending_timers->next;
-        if(pending_timers != NULL)
-            next_timeout = pending_timers->time_out;
-    }
+    if(timer->flags & TIMER_INUSE)
+        wheel_del(timer);
     timer->flags &= ~TIMER_INUSE;
     enable_interrupt();
 }
@@ -0,0 +1,1025 @@
+.global	init_timer
+.text
+init_timer:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, wheel
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 161
+	sw	$13, 2($sp)
+	jal	memset
+	la	$13, wheel_map
+	sw	$13, 0($sp)
+	sw	$0, 1($sp)
+	addui	$13, $0, 5
+	sw	$13, 2($sp)
+	jal	memset
+	jal	get_uptime
+	addu	$13, $0, $1
+	sw	$13, wheel_time($0)
+	lhi	$13, 0x7fff
+	ori	$13, $13, 0xffff
+	sw	$13, next_timeout($0)
+L.9:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	kreport_timers
+kreport_timers:
+	subui	$sp, $sp, 11
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	addu	$6, $0, $0
+L.11:
+	lw	$7, wheel($6)
+	j	L.18
+L.15:
+	la	$13, L.19
+	sw	$13, 0($sp)
+	lw	$13, 1($7)
+	sw	$13, 1($sp)
+	lw	$13, 2($7)
+	sw	$13, 2($sp)
+	lw	$13, 0($7)
+	sw	$13, 3($sp)
+	addui	$13, $0, 32
+	div	$12, $6, $13
+	sw	$12, 4($sp)
+	rem	$13, $6, $13
+	sw	$13, 5($sp)
+	jal	klog
+L.16:
+	lw	$7, 5($7)
+L.18:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.15
+L.12:
+	addi	$6, $6, 1
+	slei	$13, $6, 160
+	bnez	$13, L.11
+	la	$13, L.20
+	sw	$13, 0($sp)
+	lw	$13, next_timeout($0)
+	sw	$13, 1($sp)
+	jal	klog
+L.10:
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+.global	new_timer
+new_timer:
+	subui	$sp, $sp, 5
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 7($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.22
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+	j	L.21
+L.22:
+	lw	$13, 6($sp)
+	lw	$13, 9($13)
+	andi	$13, $13, 1
+	sne	$13, $13, $0
+	bnez	$13, L.24
+	lw	$13, 6($sp)
+	addui	$13, $13, 9
+	lw	$12, 0($13)
+	ori	$12, $12, 1
+	sw	$12, 0($13)
+	jal	get_uptime
+	addu	$13, $0, $1
+	lw	$12, 6($sp)
+	lw	$11, 7($sp)
+	addu	$13, $13, $11
+	sw	$13, 1($12)
+	lw	$13, 6($sp)
+	lw	$12, 8($sp)
+	sw	$12, 8($13)
+	lw	$13, 6($sp)
+	lw	$12, 5($sp)
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	sw	$0, 2($13)
+	lw	$13, 6($sp)
+	addui	$13, $13, 9
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffd
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lw	$13, 6($sp)
+	sw	$0, 5($13)
+	lw	$13, 6($sp)
+	sw	$13, 0($sp)
+	jal	insert_timer
+	addu	$1, $0, $0
+	j	L.21
+L.24:
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffea
+L.21:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+next_slot:
+	subui	$sp, $sp, 6
+	sw	$6, 1($sp)
+	sw	$7, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$13, 6($sp)
+	lw	$7, wheel_map($13)
+	sneu	$13, $7, $0
+	bnez	$13, L.27
+	lhi	$1, 0xffff
+	ori	$1, $1, 0xffff
+	j	L.26
+L.27:
+	lw	$13, 7($sp)
+	addi	$13, $13, 1
+	andi	$13, $13, 31
+	sw	$13, 7($sp)
+	lhi	$13, 0xffff
+	ori	$13, $13, 0xffff
+	lw	$12, 7($sp)
+	srl	$13, $13, $12
+	and	$13, $7, $13
+	sw	$13, 0($sp)
+	jal	bitmap_first_set
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+	sge	$13, $6, $0
+	bnez	$13, L.29
+	sw	$7, 0($sp)
+	jal	bitmap_first_set
+	addu	$13, $0, $1
+	addu	$6, $0, $13
+L.29:
+	lw	$13, 7($sp)
+	sub	$13, $6, $13
+	andi	$13, $13, 31
+	addi	$1, $13, 1
+L.26:
+	lw	$6, 1($sp)
+	lw	$7, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+slot_time:
+	subui	$sp, $sp, 5
+	sw	$6, 0($sp)
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, wheel_time($0)
+	addui	$12, $0, 5
+	lw	$11, 5($sp)
+	mult	$12, $12, $11
+	srl	$7, $13, $12
+	lw	$13, 5($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.32
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	addui	$12, $0, 31
+	and	$12, $7, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.32
+	lw	$1, wheel_time($0)
+	j	L.31
+L.32:
+	lw	$13, 6($sp)
+	addui	$12, $0, 31
+	and	$12, $7, $12
+	addu	$12, $0, $12
+	sub	$13, $13, $12
+	andi	$6, $13, 31
+	sne	$13, $6, $0
+	bnez	$13, L.34
+	addui	$6, $0, 32
+L.34:
+	addu	$13, $0, $6
+	addu	$13, $7, $13
+	addui	$12, $0, 5
+	lw	$11, 5($sp)
+	mult	$12, $12, $11
+	sll	$1, $13, $12
+L.31:
+	lw	$6, 0($sp)
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+wheel_next_event:
+	subui	$sp, $sp, 12
+	sw	$2, 2($sp)
+	sw	$3, 3($sp)
+	sw	$4, 4($sp)
+	sw	$5, 5($sp)
+	sw	$6, 6($sp)
+	sw	$7, 7($sp)
+	sw	$12, 8($sp)
+	sw	$13, 9($sp)
+	sw	$ra, 10($sp)
+	lhi	$3, 0x7fff
+	ori	$3, $3, 0xffff
+	addu	$7, $0, $0
+L.37:
+	lw	$13, wheel_time($0)
+	addui	$12, $0, 5
+	mult	$12, $12, $7
+	srl	$13, $13, $12
+	addui	$12, $0, 31
+	and	$13, $13, $12
+	addu	$6, $0, $13
+	sw	$7, 0($sp)
+	sne	$13, $7, $0
+	bnez	$13, L.42
+	subi	$2, $6, 1
+	j	L.43
+L.42:
+	addu	$2, $0, $6
+L.43:
+	sw	$2, 1($sp)
+	jal	next_slot
+	addu	$13, $0, $1
+	addu	$5, $0, $13
+	sge	$13, $5, $0
+	bnez	$13, L.44
+	j	L.38
+L.44:
+	sw	$7, 0($sp)
+	sne	$13, $7, $0
+	bnez	$13, L.47
+	addui	$13, $0, 1
+	sw	$13, 11($sp)
+	j	L.48
+L.47:
+	sw	$0, 11($sp)
+L.48:
+	add	$13, $6, $5
+	lw	$12, 11($sp)
+	sub	$13, $13, $12
+	andi	$13, $13, 31
+	sw	$13, 1($sp)
+	jal	slot_time
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	sgeu	$13, $4, $3
+	bnez	$13, L.49
+	addu	$3, $0, $4
+L.49:
+L.38:
+	addi	$7, $7, 1
+	slti	$13, $7, 5
+	bnez	$13, L.37
+	addu	$1, $0, $3
+L.36:
+	lw	$2, 2($sp)
+	lw	$3, 3($sp)
+	lw	$4, 4($sp)
+	lw	$5, 5($sp)
+	lw	$6, 6($sp)
+	lw	$7, 7($sp)
+	lw	$12, 8($sp)
+	lw	$13, 9($sp)
+	lw	$ra, 10($sp)
+	addui	$sp, $sp, 12
+	jr	$ra
+wheel_add:
+	subui	$sp, $sp, 8
+	sw	$3, 0($sp)
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	lw	$13, 8($sp)
+	lw	$5, 1($13)
+	lw	$13, wheel_time($0)
+	sgeu	$13, $5, $13
+	bnez	$13, L.52
+	lw	$5, wheel_time($0)
+L.52:
+	lw	$13, wheel_time($0)
+	subu	$6, $5, $13
+	lhi	$13, 0x200
+	ori	$13, $13, 0x0
+	sltu	$13, $6, $13
+	bnez	$13, L.54
+	lhi	$6, 0x1ff
+	ori	$6, $6, 0xffff
+	lw	$13, wheel_time($0)
+	addu	$5, $13, $6
+L.54:
+	addu	$7, $0, $0
+L.56:
+	addui	$13, $0, 5
+	addui	$12, $0, 1
+	mult	$13, $13, $7
+	addi	$13, $13, 5
+	sll	$13, $12, $13
+	sgeu	$13, $6, $13
+	bnez	$13, L.60
+	j	L.58
+L.60:
+L.57:
+	addi	$7, $7, 1
+	slti	$13, $7, 4
+	bnez	$13, L.56
+L.58:
+	addui	$13, $0, 5
+	mult	$13, $13, $7
+	srl	$13, $5, $13
+	addui	$12, $0, 31
+	and	$13, $13, $12
+	addu	$3, $0, $13
+	slli	$13, $7, 5
+	add	$4, $13, $3
+	lw	$13, 8($sp)
+	sw	$4, 7($13)
+	lw	$13, 8($sp)
+	sw	$0, 5($13)
+	lw	$13, wheel($4)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.62
+	lw	$13, 8($sp)
+	lw	$12, wheel($4)
+	lw	$12, 6($12)
+	sw	$12, 6($13)
+	lw	$13, 8($sp)
+	lw	$12, 6($13)
+	sw	$13, 5($12)
+	lw	$13, wheel($4)
+	lw	$12, 8($sp)
+	sw	$12, 6($13)
+	j	L.63
+L.62:
+	lw	$13, 8($sp)
+	sw	$13, 6($13)
+	lw	$13, 8($sp)
+	sw	$13, wheel($4)
+L.63:
+	la	$13, wheel_map
+	addu	$13, $7, $13
+	lw	$12, 0($13)
+	lhi	$11, 0x8000
+	ori	$11, $11, 0x0
+	srl	$11, $11, $3
+	or	$12, $12, $11
+	sw	$12, 0($13)
+L.51:
+	lw	$3, 0($sp)
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	addui	$sp, $sp, 8
+	jr	$ra
+wheel_del:
+	subui	$sp, $sp, 6
+	sw	$7, 0($sp)
+	sw	$10, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	lw	$13, 6($sp)
+	lw	$7, 7($13)
+	lw	$13, wheel($7)
+	sw	$13, 5($sp)
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	lw	$12, 5($sp)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.65
+	lw	$13, 6($sp)
+	lw	$13, 5($13)
+	sw	$13, wheel($7)
+	j	L.66
+L.65:
+	lw	$13, 6($sp)
+	lw	$12, 6($13)
+	lw	$13, 5($13)
+	sw	$13, 5($12)
+L.66:
+	lw	$13, 6($sp)
+	lw	$13, 5($13)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.67
+	lw	$13, 6($sp)
+	lw	$12, 5($13)
+	lw	$13, 6($13)
+	sw	$13, 6($12)
+	j	L.68
+L.67:
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	lw	$12, 5($sp)
+	addu	$12, $0, $12
+	sequ	$13, $13, $12
+	bnez	$13, L.69
+	lw	$13, 5($sp)
+	lw	$12, 6($sp)
+	lw	$12, 6($12)
+	sw	$12, 6($13)
+L.69:
+L.68:
+	lw	$13, wheel($7)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.71
+	seqi	$13, $7, 160
+	bnez	$13, L.71
+	addui	$13, $0, 32
+	div	$12, $7, $13
+	la	$11, wheel_map
+	addu	$12, $12, $11
+	lw	$11, 0($12)
+	lhi	$10, 0x8000
+	ori	$10, $10, 0x0
+	rem	$13, $7, $13
+	srl	$13, $10, $13
+	subu	$13, $0, $13
+	subui	$13, $13, 1
+	and	$13, $11, $13
+	sw	$13, 0($12)
+L.71:
+	lw	$13, 6($sp)
+	addu	$12, $0, $0
+	sw	$12, 6($13)
+	sw	$12, 5($13)
+L.64:
+	lw	$7, 0($sp)
+	lw	$10, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+.global	insert_split
+insert_split:
+	subui	$sp, $sp, 3
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lw	$7, wheel+160($0)
+	j	L.76
+L.75:
+	lw	$7, 5($7)
+L.76:
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.78
+	lw	$13, 2($7)
+	lw	$12, 3($sp)
+	lw	$12, 2($12)
+	sle	$13, $13, $12
+	bnez	$13, L.75
+L.78:
+	lw	$13, 3($sp)
+	addui	$12, $0, 160
+	sw	$12, 7($13)
+	lw	$13, 3($sp)
+	sw	$7, 5($13)
+	lw	$13, wheel+160($0)
+	addu	$13, $0, $13
+	sneu	$13, $13, $0
+	bnez	$13, L.79
+	lw	$13, 3($sp)
+	sw	$13, 6($13)
+	lw	$13, 3($sp)
+	sw	$13, wheel+160($0)
+	j	L.80
+L.79:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.83
+	lw	$13, 3($sp)
+	lw	$12, wheel+160($0)
+	lw	$12, 6($12)
+	sw	$12, 6($13)
+	lw	$13, 3($sp)
+	lw	$12, 6($13)
+	sw	$13, 5($12)
+	lw	$13, wheel+160($0)
+	lw	$12, 3($sp)
+	sw	$12, 6($13)
+	j	L.84
+L.83:
+	lw	$13, 3($sp)
+	lw	$12, 6($7)
+	sw	$12, 6($13)
+	addu	$13, $0, $7
+	lw	$12, wheel+160($0)
+	addu	$12, $0, $12
+	sneu	$13, $13, $12
+	bnez	$13, L.87
+	lw	$13, 3($sp)
+	sw	$13, wheel+160($0)
+	j	L.88
+L.87:
+	lw	$13, 6($7)
+	lw	$12, 3($sp)
+	sw	$12, 5($13)
+L.88:
+	lw	$13, 3($sp)
+	sw	$13, 6($7)
+L.84:
+L.80:
+L.73:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 3
+	jr	$ra
+.global	next_split
+next_split:
+	subui	$sp, $sp, 2
+	sw	$7, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, wheel+160($0)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.95
+	lw	$13, wheel+160($0)
+	lw	$7, 2($13)
+	j	L.96
+L.95:
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffff
+L.96:
+	addu	$1, $0, $7
+L.91:
+	lw	$7, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	dequeue_split
+dequeue_split:
+	subui	$sp, $sp, 6
+	sw	$7, 1($sp)
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lw	$7, wheel+160($0)
+	addu	$13, $0, $7
+	sequ	$13, $13, $0
+	bnez	$13, L.101
+	lw	$13, 2($7)
+	lw	$12, 6($sp)
+	sle	$13, $13, $12
+	bnez	$13, L.99
+L.101:
+	addu	$1, $0, $0
+	j	L.97
+L.99:
+	sw	$7, 0($sp)
+	jal	wheel_del
+	addui	$13, $7, 9
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffe
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $7
+L.97:
+	lw	$7, 1($sp)
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 6
+	jr	$ra
+cascade:
+	subui	$sp, $sp, 9
+	sw	$4, 1($sp)
+	sw	$5, 2($sp)
+	sw	$6, 3($sp)
+	sw	$7, 4($sp)
+	sw	$11, 5($sp)
+	sw	$12, 6($sp)
+	sw	$13, 7($sp)
+	sw	$ra, 8($sp)
+	lw	$13, wheel_time($0)
+	addui	$12, $0, 5
+	lw	$11, 9($sp)
+	mult	$12, $12, $11
+	srl	$13, $13, $12
+	addui	$12, $0, 31
+	and	$13, $13, $12
+	addu	$5, $0, $13
+	lw	$13, 9($sp)
+	slli	$13, $13, 5
+	add	$4, $13, $5
+	la	$13, wheel
+	addu	$13, $4, $13
+	lw	$7, 0($13)
+	sw	$0, 0($13)
+	lw	$13, 9($sp)
+	la	$12, wheel_map
+	addu	$13, $13, $12
+	lw	$12, 0($13)
+	lhi	$11, 0x8000
+	ori	$11, $11, 0x0
+	srl	$11, $11, $5
+	subu	$11, $0, $11
+	subui	$11, $11, 1
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	j	L.104
+L.103:
+	lw	$6, 5($7)
+	sw	$7, 0($sp)
+	jal	wheel_add
+	addu	$7, $0, $6
+L.104:
+	addu	$13, $0, $7
+	sneu	$13, $13, $0
+	bnez	$13, L.103
+	sne	$13, $5, $0
+	bnez	$13, L.106
+	lw	$13, 9($sp)
+	addi	$13, $13, 1
+	sgei	$13, $13, 5
+	bnez	$13, L.106
+	lw	$13, 9($sp)
+	addi	$13, $13, 1
+	sw	$13, 0($sp)
+	jal	cascade
+L.106:
+L.102:
+	lw	$4, 1($sp)
+	lw	$5, 2($sp)
+	lw	$6, 3($sp)
+	lw	$7, 4($sp)
+	lw	$11, 5($sp)
+	lw	$12, 6($sp)
+	lw	$13, 7($sp)
+	lw	$ra, 8($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	dequeue_alarm
+dequeue_alarm:
+	subui	$sp, $sp, 11
+	sw	$4, 2($sp)
+	sw	$5, 3($sp)
+	sw	$6, 4($sp)
+	sw	$7, 5($sp)
+	sw	$11, 6($sp)
+	sw	$12, 7($sp)
+	sw	$13, 8($sp)
+	sw	$ra, 9($sp)
+	j	L.110
+L.109:
+	lw	$13, wheel_time($0)
+	addui	$12, $0, 31
+	and	$13, $13, $12
+	addu	$6, $0, $13
+	lw	$13, wheel($6)
+	addu	$5, $0, $13
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.112
+	sw	$5, 0($sp)
+	jal	wheel_del
+	addu	$13, $0, $0
+	sw	$13, 10($sp)
+	lw	$12, 9($5)
+	andi	$12, $12, 2
+	seq	$13, $12, $13
+	bnez	$13, L.114
+	lw	$13, 2($5)
+	lw	$12, 10($sp)
+	seq	$13, $13, $12
+	bnez	$13, L.114
+	sw	$5, 0($sp)
+	jal	insert_split
+	j	L.110
+L.114:
+	addui	$13, $5, 9
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffe
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	addu	$1, $0, $5
+	j	L.108
+L.112:
+	addui	$13, $0, 32
+	sub	$7, $13, $6
+	sw	$0, 0($sp)
+	sw	$6, 1($sp)
+	jal	next_slot
+	addu	$13, $0, $1
+	addu	$4, $0, $13
+	sle	$13, $4, $0
+	bnez	$13, L.116
+	sge	$13, $4, $7
+	bnez	$13, L.116
+	addu	$7, $0, $4
+L.116:
+	lw	$13, 11($sp)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	lw	$12, wheel_time($0)
+	subu	$13, $13, $12
+	addu	$12, $0, $7
+	sgeu	$13, $13, $12
+	bnez	$13, L.118
+	lw	$13, 11($sp)
+	addui	$12, $0, 1
+	addu	$13, $13, $12
+	lw	$12, wheel_time($0)
+	subu	$13, $13, $12
+	addu	$7, $0, $13
+L.118:
+	lw	$13, wheel_time($0)
+	addu	$12, $0, $7
+	addu	$13, $13, $12
+	sw	$13, wheel_time($0)
+	lw	$13, wheel_time($0)
+	addui	$12, $0, 31
+	and	$13, $13, $12
+	sneu	$13, $13, $0
+	bnez	$13, L.120
+	addui	$13, $0, 1
+	sw	$13, 0($sp)
+	jal	cascade
+L.120:
+L.110:
+	lw	$13, wheel_time($0)
+	lw	$12, 11($sp)
+	sleu	$13, $13, $12
+	bnez	$13, L.109
+	jal	wheel_next_event
+	addu	$13, $0, $1
+	sw	$13, next_timeout($0)
+	addu	$1, $0, $0
+L.108:
+	lw	$4, 2($sp)
+	lw	$5, 3($sp)
+	lw	$6, 4($sp)
+	lw	$7, 5($sp)
+	lw	$11, 6($sp)
+	lw	$12, 7($sp)
+	lw	$13, 8($sp)
+	lw	$ra, 9($sp)
+	addui	$sp, $sp, 11
+	jr	$ra
+most_aligned:
+	subui	$sp, $sp, 4
+	sw	$7, 0($sp)
+	sw	$12, 1($sp)
+	sw	$13, 2($sp)
+	lhi	$7, 0xffff
+	ori	$7, $7, 0xffff
+	j	L.124
+L.123:
+	slli	$7, $7, 1
+L.124:
+	slli	$13, $7, 1
+	sw	$13, 3($sp)
+	sequ	$13, $13, $0
+	bnez	$13, L.126
+	lw	$13, 5($sp)
+	lw	$12, 3($sp)
+	and	$13, $13, $12
+	lw	$12, 4($sp)
+	sgeu	$13, $13, $12
+	bnez	$13, L.123
+L.126:
+	lw	$13, 5($sp)
+	and	$1, $13, $7
+L.122:
+	lw	$7, 0($sp)
+	lw	$12, 1($sp)
+	lw	$13, 2($sp)
+	addui	$sp, $sp, 4
+	jr	$ra
+.global	slack_deadline
+slack_deadline:
+	subui	$sp, $sp, 9
+	sw	$7, 2($sp)
+	sw	$11, 3($sp)
+	sw	$12, 4($sp)
+	sw	$13, 5($sp)
+	sw	$ra, 6($sp)
+	lw	$13, 11($sp)
+	sneu	$13, $13, $0
+	bnez	$13, L.128
+	j	L.127
+L.128:
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	seq	$13, $13, $0
+	bnez	$13, L.131
+	addui	$7, $0, 1
+	j	L.132
+L.131:
+	addu	$7, $0, $0
+L.132:
+	addu	$13, $0, $7
+	sw	$13, 8($sp)
+	lw	$13, 10($sp)
+	lw	$13, 0($13)
+	addu	$13, $0, $13
+	lw	$12, 11($sp)
+	addu	$13, $13, $12
+	addui	$12, $0, 40
+	divu	$13, $13, $12
+	sw	$13, 7($sp)
+	lw	$13, 8($sp)
+	lw	$12, 7($sp)
+	sgtu	$13, $13, $12
+	bnez	$13, L.133
+	lw	$13, 9($sp)
+	lw	$12, 0($13)
+	lw	$11, 8($sp)
+	addu	$11, $12, $11
+	sw	$11, 0($sp)
+	lw	$11, 7($sp)
+	addu	$12, $12, $11
+	sw	$12, 1($sp)
+	jal	most_aligned
+	addu	$12, $0, $1
+	sw	$12, 0($13)
+	lw	$13, 10($sp)
+	sw	$0, 0($13)
+	j	L.127
+L.133:
+	lw	$13, 10($sp)
+	lw	$12, 0($13)
+	addu	$12, $0, $12
+	sw	$12, 0($sp)
+	lw	$11, 11($sp)
+	addu	$12, $12, $11
+	sw	$12, 1($sp)
+	jal	most_aligned
+	addu	$12, $0, $1
+	addu	$12, $0, $12
+	sw	$12, 0($13)
+L.127:
+	lw	$7, 2($sp)
+	lw	$11, 3($sp)
+	lw	$12, 4($sp)
+	lw	$13, 5($sp)
+	lw	$ra, 6($sp)
+	addui	$sp, $sp, 9
+	jr	$ra
+.global	insert_timer
+insert_timer:
+	subui	$sp, $sp, 7
+	sw	$11, 2($sp)
+	sw	$12, 3($sp)
+	sw	$13, 4($sp)
+	sw	$ra, 5($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	sw	$0, 0($13)
+	lw	$13, 7($sp)
+	sw	$13, 0($sp)
+	jal	wheel_add
+	lw	$13, 7($sp)
+	lw	$13, 7($13)
+	addui	$12, $0, 32
+	div	$11, $13, $12
+	sw	$11, 0($sp)
+	rem	$13, $13, $12
+	sw	$13, 1($sp)
+	jal	slot_time
+	addu	$13, $0, $1
+	sw	$13, 6($sp)
+	lw	$13, 6($sp)
+	lw	$12, next_timeout($0)
+	sgeu	$13, $13, $12
+	bnez	$13, L.136
+	lw	$13, 6($sp)
+	sw	$13, next_timeout($0)
+L.136:
+	lw	$13, 7($sp)
+	addui	$13, $13, 9
+	lw	$12, 0($13)
+	andi	$12, $12, 3
+	sw	$12, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	addui	$12, $0, 3
+	sw	$12, 0($13)
+L.135:
+	lw	$11, 2($sp)
+	lw	$12, 3($sp)
+	lw	$13, 4($sp)
+	lw	$ra, 5($sp)
+	addui	$sp, $sp, 7
+	jr	$ra
+.global	remove_timer
+remove_timer:
+	subui	$sp, $sp, 5
+	sw	$11, 1($sp)
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	sw	$0, 0($13)
+	lw	$13, 5($sp)
+	lw	$13, 9($13)
+	andi	$13, $13, 1
+	seq	$13, $13, $0
+	bnez	$13, L.139
+	lw	$13, 5($sp)
+	sw	$13, 0($sp)
+	jal	wheel_del
+L.139:
+	lw	$13, 5($sp)
+	addui	$13, $13, 9
+	lw	$12, 0($13)
+	lhi	$11, 0xffff
+	ori	$11, $11, 0xfffe
+	and	$12, $12, $11
+	sw	$12, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x2000
+	addui	$12, $0, 3
+	sw	$12, 0($13)
+L.138:
+	lw	$11, 1($sp)
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.bss
+wheel_time:
+	.space	1
+wheel_map:
+	.space	5
+wheel:
+	.space	161
+.extern	next_timeout 1
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.20:
+	.asciiz	"next timeout %d\n"
+L.19:
+	.asciiz	"timer timeout %d+%d from %d, level %d slot %d\n"
@@ -0,0 +1,139 @@
+.global	align_page
+.text
+align_page:
+	subui	$sp, $sp, 2
+	sw	$12, 0($sp)
+	sw	$13, 1($sp)
+	lw	$13, 2($sp)
+	subi	$13, $13, 1
+	srai	$13, $13, 10
+	slli	$13, $13, 10
+	addu	$13, $0, $13
+	addui	$12, $0, 1024
+	addu	$13, $13, $12
+	addu	$1, $0, $13
+L.9:
+	lw	$12, 0($sp)
+	lw	$13, 1($sp)
+	addui	$sp, $sp, 2
+	jr	$ra
+.global	_panic
+_panic:
+	subui	$sp, $sp, 5
+	sw	$12, 2($sp)
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	la	$13, L.11
+	sw	$13, 0($sp)
+	jal	kprintf
+	lw	$13, 5($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.12
+	la	$13, L.14
+	sw	$13, 0($sp)
+	lw	$13, 5($sp)
+	sw	$13, 1($sp)
+	jal	kprintf
+L.12:
+	lw	$13, 6($sp)
+	addu	$13, $0, $13
+	sequ	$13, $13, $0
+	bnez	$13, L.19
+	la	$13, L.17
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	jal	kprintf
+	j	L.19
+L.18:
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3004
+	sw	$0, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3002
+	addui	$12, $0, 121
+	sw	$12, 0($13)
+	lhi	$13, 0x7
+	ori	$13, $13, 0x3003
+	addui	$12, $0, 80
+	sw	$12, 0($13)
+L.19:
+	j	L.18
+L.10:
+	lw	$12, 2($sp)
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.global	_assert
+_assert:
+	subui	$sp, $sp, 5
+	sw	$13, 3($sp)
+	sw	$ra, 4($sp)
+	lw	$13, 5($sp)
+	sne	$13, $13, $0
+	bnez	$13, L.22
+	la	$13, L.24
+	sw	$13, 0($sp)
+	lw	$13, 6($sp)
+	sw	$13, 1($sp)
+	lw	$13, 7($sp)
+	sw	$13, 2($sp)
+	jal	kprintf
+	jal	irq_count
+	addu	$13, $0, $1
+	sne	$13, $13, $0
+	bnez	$13, L.25
+	lhi	$13, 0x1337
+	ori	$13, $13, 0x6
+	sw	$13, 0($sp)
+	jal	wramp_syscall
+L.25:
+	addu	$13, $0, $0
+	sw	$13, 0($sp)
+	sw	$13, 1($sp)
+	jal	_panic
+L.22:
+L.21:
+	lw	$13, 3($sp)
+	lw	$ra, 4($sp)
+	addui	$sp, $sp, 5
+	jr	$ra
+.extern	BSS_END 1
+.extern	DATA_END 1
+.extern	TEXT_END 1
+.extern	BSS_BEGIN 1
+.extern	DATA_BEGIN 1
+.extern	TEXT_BEGIN 1
+.extern	pgrp_hash 128
+.extern	pid_hash 128
+.extern	nr_proc_slots 1
+.extern	block_q 2
+.extern	ready_map 1
+.extern	stride_q 1
+.extern	ready_q 12
+.extern	proc_table 1
+.extern	curr_syscall_caller 1
+.extern	curr_scheduling_proc 1
+.extern	inode_table 1248
+.extern	DISK_RAW_SIZE 1
+.extern	DISK_RLE_LEN 1
+.extern	DISK_RLE 0
+.extern	DISK_RAW 0
+.extern	start_unix_time 1
+.extern	trace_syscall 1
+.extern	errlist 40
+.extern	__iotab 8
+.extern	_stderr 6
+.extern	_stdout 6
+.extern	_stdin 6
+.data
+L.24:
+	.asciiz	"\nAssert Failed at line %d in %s"
+L.17:
+	.asciiz	" in %s\n"
+L.14:
+	.asciiz	"%s"
+L.11:
+	.asciiz	"\r\nPanic! "